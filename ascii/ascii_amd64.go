@@ -1,93 +1,127 @@
+//go:build !noasm && amd64
+
 package ascii
 
-import (
-	"golang.org/x/sys/cpu"
-)
+import "golang.org/x/sys/cpu"
 
+// The AVX-512 kernels are built with -mavx512f -mavx512vl and use the EVEX
+// 128- and 256-bit forms, so they need VL along with BW and VBMI.
 var (
-	hasSSE41 = cpu.X86.HasSSE41
-	hasAVX2  = cpu.X86.HasAVX
+	hasSSE41  = cpu.X86.HasSSE41
+	hasAVX2   = cpu.X86.HasAVX2
+	hasAVX512 = cpu.X86.HasAVX512F && cpu.X86.HasAVX512VL && cpu.X86.HasAVX512BW && cpu.X86.HasAVX512VBMI
 )
 
-func ValidString(s string) bool {
-	if hasAVX2 {
-		return isAsciiAvx(s)
-	}
-
-	if hasSSE41 {
-		return isAsciiSse(s)
+func detectISA() isa {
+	switch {
+	case hasAVX512:
+		return isaAVX512
+	case hasAVX2:
+		return isaAVX2
+	case hasSSE41:
+		return isaSSE41
 	}
-
-	return isAsciiGo(s)
+	return isaGeneric
 }
 
-func IndexMask(s string, mask byte) int {
-	if hasAVX2 {
-		return indexMaskAvx(s, mask)
+// kernelsFor builds the dispatch table for t. Each tier starts from the one
+// below it and replaces the operations it has kernels for.
+func kernelsFor(t isa) kernels {
+	k := genericKernels()
+	if t < isaSSE41 {
+		return k
 	}
 
-	return indexMaskGo(s, mask)
-}
-
-func EqualFold(a, b string) bool {
-	if len(a) < 32 || !hasAVX2 {
+	k.validString = isAsciiSse
+	k.indexMask = indexMaskSse
+	k.equalFold = func(a, b string) bool {
+		if len(a) >= 16 {
+			return equalFoldSse(a, b)
+		}
 		return equalFoldGo(a, b)
 	}
-
-	return equalFoldAvx(a, b)
-}
-
-func IndexFold(a, b string) int {
-	// TODO: implement acceleration for this
-	return indexFoldGo(a, b)
-}
-
-func indexFoldRabinKarp(a, b string) int {
-	// FIXME: definitely not Rabin-Karp
-	return indexFoldGo(a, b)
-}
-
-func IndexAny(s, chars string) int {
-	return indexAnyGo(s, chars)
-}
-
-// CharSet represents a precomputed character set for fast IndexAny lookups.
-// Build once with MakeCharSet, then reuse with IndexAnyCharSet.
-type CharSet struct {
-	bitset [4]uint64
-}
-
-// MakeCharSet creates a CharSet from the given characters.
-func MakeCharSet(chars string) CharSet {
-	var cs CharSet
-	for i := 0; i < len(chars); i++ {
-		c := chars[i]
-		cs.bitset[c>>6] |= 1 << (c & 63)
+	if t < isaAVX2 {
+		return k
 	}
-	return cs
-}
 
-// IndexAnyCharSet finds the first occurrence of any byte from cs in data.
-// Returns -1 if no match is found.
-func IndexAnyCharSet(data string, cs CharSet) int {
-	if cs.bitset == [4]uint64{} {
-		return -1
+	k.validString = isAsciiAvx
+	k.indexMask = indexMaskAvx
+	k.equalFold = func(a, b string) bool {
+		if len(a) >= 32 {
+			return equalFoldAvx(a, b)
+		}
+		if len(a) >= 16 {
+			return equalFoldSse(a, b)
+		}
+		return equalFoldGo(a, b)
+	}
+	k.indexFold = func(haystack, needle string) int {
+		// O(1) rare byte selection via sampling (case-insensitive)
+		rare1, off1, rare2, off2 := selectRarePairSample(needle, nil, false)
+		// Pass original needle - C code folds on-the-fly during verification (no alloc)
+		return indexFoldAvx(haystack, rare1, off1, rare2, off2, needle)
 	}
-	for i := 0; i < len(data); i++ {
-		c := data[i]
-		if cs.bitset[c>>6]&(1<<(c&63)) != 0 {
-			return i
+	k.countFold = func(haystack, needle string) int {
+		rare1, off1, rare2, off2 := selectRarePairSample(needle, nil, false)
+		return countFoldAvx(haystack, rare1, off1, rare2, off2, needle)
+	}
+	k.indexAnyCharSet = func(data string, cs CharSet) int {
+		if len(data) < 16 {
+			return indexAnyCharSetGo(data, cs)
 		}
+		return indexAnyAvxBitset(data, cs.bitset[0], cs.bitset[1], cs.bitset[2], cs.bitset[3])
+	}
+	k.indexExact = indexExactAvx
+	k.searchFold = searchNeedleFoldAvx
+	k.indexAllExact = indexAllExactAvx
+	k.searchAllFold = searchAllFoldAvx
+	k.countExact = countExactAvx
+	k.countNeedleFold = countNeedleFoldAvx
+	k.lastIndexExact = lastIndexExactAvx
+	k.lastSearchNeedleFold = lastSearchNeedleFoldAvx
+	k.indexWordExact = indexWordExactAvx
+	k.searchWordFold = searchWordFoldAvx
+	k.lastIndexFold = func(haystack, needle string) int {
+		rare1, off1, rare2, off2 := selectRarePairSample(needle, nil, false)
+		return lastIndexFoldAvx(haystack, rare1, off1, rare2, off2, needle)
+	}
+	k.searchTBL = (*BooleanSearch).searchTBLAVX2
+	k.searchFDR = (*BooleanSearch).searchFDRAVX2
+	if t < isaAVX512 {
+		return k
+	}
+
+	k.validString = isAsciiAvx512
+	k.indexMask = indexMaskAvx512
+	k.equalFold = equalFoldAvx512
+	k.indexFold = func(haystack, needle string) int {
+		rare1, off1, rare2, off2 := selectRarePairSample(needle, nil, false)
+		return indexFoldAvx512(haystack, rare1, off1, rare2, off2, needle)
+	}
+	k.countFold = func(haystack, needle string) int {
+		rare1, off1, rare2, off2 := selectRarePairSample(needle, nil, false)
+		return countFoldAvx512(haystack, rare1, off1, rare2, off2, needle)
+	}
+	k.indexExact = indexExactAvx512
+	k.searchFold = searchNeedleFoldAvx512
+	k.indexAllExact = indexAllExactAvx512
+	k.searchAllFold = searchAllFoldAvx512
+	k.countExact = countExactAvx512
+	k.countNeedleFold = countNeedleFoldAvx512
+	k.lastIndexExact = lastIndexExactAvx512
+	k.lastSearchNeedleFold = lastSearchNeedleFoldAvx512
+	k.indexWordExact = indexWordExactAvx512
+	k.searchWordFold = searchWordFoldAvx512
+	k.lastIndexFold = func(haystack, needle string) int {
+		rare1, off1, rare2, off2 := selectRarePairSample(needle, nil, false)
+		return lastIndexFoldAvx512(haystack, rare1, off1, rare2, off2, needle)
 	}
-	return -1
+	return k
 }
 
-// Index finds the first occurrence of the pattern in haystack.
-// Uses the case sensitivity specified when the Searcher was created.
-// On amd64, this falls back to Go implementation (no SIMD acceleration yet).
-func (s Searcher) Index(haystack string) int {
-	if s.caseSensitive {
-		return strings.Index(haystack, s.raw)
+func indexFoldRabinKarp(haystack, needle string) int {
+	if activeISA < isaAVX2 {
+		return indexFoldRabinKarpGo(haystack, needle)
 	}
-	return indexFoldGo(haystack, s.raw)
+	return indexFoldRabinKarpAvx(haystack, needle)
 }
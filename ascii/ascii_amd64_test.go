@@ -0,0 +1,318 @@
+//go:build !noasm && amd64
+
+package ascii
+
+import (
+	"math/rand"
+	"strings"
+	"testing"
+)
+
+// indexFoldC is the rare-byte IndexFold kernel benchmarked by the shared tests.
+var indexFoldC = indexFoldAvx
+
+func TestIndexFoldAvx(t *testing.T) {
+	if !hasAVX2 {
+		t.Skip("AVX2 not supported")
+	}
+
+	// Every haystack length around the 32/64/128-byte block sizes, with the
+	// match at the very end so the masked tail has to find it.
+	for _, needle := range []string{"q", "Qz", "quartz", `"num":`, strings.Repeat("Ab", 20)} {
+		for n := len(needle); n < 300; n++ {
+			haystack := strings.Repeat("a", n-len(needle)) + strings.ToUpper(needle)
+			rare1, off1, rare2, off2 := selectRarePairSample(needle, nil, false)
+			if got, want := indexFoldAvx(haystack, rare1, off1, rare2, off2, needle), indexFoldGo(haystack, needle); got != want {
+				t.Fatalf("needle=%q len=%d: got %d, want %d", needle, n, got, want)
+			}
+			if got := indexFoldAvx(haystack[:n-1], rare1, off1, rare2, off2, needle); got != -1 {
+				t.Fatalf("needle=%q len=%d: got %d, want -1", needle, n-1, got)
+			}
+		}
+	}
+}
+
+func TestIndexFoldAvxAdaptive(t *testing.T) {
+	if !hasAVX2 {
+		t.Skip("AVX2 not supported")
+	}
+
+	// Small alphabets produce enough false positives to exercise the cutover
+	// to the 2-byte filter and then to Rabin-Karp.
+	rng := rand.New(rand.NewSource(1))
+	for _, alphabet := range []string{"aA", "abAB", `"{}:,ab`} {
+		for i := 0; i < 500; i++ {
+			hay := make([]byte, rng.Intn(2000))
+			for j := range hay {
+				hay[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			needle := make([]byte, 1+rng.Intn(80))
+			for j := range needle {
+				needle[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			want := indexFoldGo(string(hay), string(needle))
+			if got := IndexFold(string(hay), string(needle)); got != want {
+				t.Fatalf("IndexFold(%q, %q) = %d, want %d", truncate(string(hay), 40), needle, got, want)
+			}
+			if got := indexFoldRabinKarp(string(hay), string(needle)); got != want {
+				t.Fatalf("indexFoldRabinKarp(%q, %q) = %d, want %d", truncate(string(hay), 40), needle, got, want)
+			}
+		}
+	}
+}
+
+func TestSearcherIndexAvx(t *testing.T) {
+	if !hasAVX2 {
+		t.Skip("AVX2 not supported")
+	}
+
+	rng := rand.New(rand.NewSource(2))
+	for _, alphabet := range []string{"aA", "abAB", `"{}:,aB`, "xyzXYZ0"} {
+		for i := 0; i < 500; i++ {
+			hay := make([]byte, rng.Intn(2000))
+			for j := range hay {
+				hay[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			needle := make([]byte, 1+rng.Intn(80))
+			for j := range needle {
+				needle[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			h, n := string(hay), string(needle)
+
+			want := strings.Index(h, n)
+			if got := NewSearcher(n, true).Index(h); got != want {
+				t.Fatalf("Searcher(%q, true).Index(%q) = %d, want %d", n, truncate(h, 40), got, want)
+			}
+			if got := indexExactRabinKarpAvx(h, n); got != want {
+				t.Fatalf("indexExactRabinKarpAvx(%q, %q) = %d, want %d", truncate(h, 40), n, got, want)
+			}
+
+			want = indexFoldGo(h, n)
+			if got := NewSearcher(n, false).Index(h); got != want {
+				t.Fatalf("Searcher(%q, false).Index(%q) = %d, want %d", n, truncate(h, 40), got, want)
+			}
+			if got := indexPrefoldedRabinKarpAvx(h, normalizeASCII(n)); got != want {
+				t.Fatalf("indexPrefoldedRabinKarpAvx(%q, %q) = %d, want %d", truncate(h, 40), n, got, want)
+			}
+		}
+	}
+}
+
+func TestIndexAnyAvxBitset(t *testing.T) {
+	if !hasAVX2 {
+		t.Skip("AVX2 not supported")
+	}
+
+	// Random sets over the full byte range, with the only match placed at every
+	// offset so both nibble tables and the masked tail are covered.
+	rng := rand.New(rand.NewSource(3))
+	for i := 0; i < 200; i++ {
+		chars := make([]byte, 1+rng.Intn(40))
+		for j := range chars {
+			chars[j] = byte(rng.Intn(256))
+		}
+		cs := MakeCharSet(string(chars))
+		var filler byte
+		for cs.bitset[filler>>6]&(1<<(filler&63)) != 0 {
+			filler++
+		}
+		n := rng.Intn(300)
+		data := make([]byte, n)
+		for j := range data {
+			data[j] = filler
+		}
+		if got := indexAnyAvxBitset(string(data), cs.bitset[0], cs.bitset[1], cs.bitset[2], cs.bitset[3]); got != -1 {
+			t.Fatalf("chars=%q len=%d: got %d, want -1", chars, n, got)
+		}
+		for pos := 0; pos < n; pos++ {
+			data[pos] = chars[rng.Intn(len(chars))]
+			got := indexAnyAvxBitset(string(data), cs.bitset[0], cs.bitset[1], cs.bitset[2], cs.bitset[3])
+			if got != pos {
+				t.Fatalf("chars=%q len=%d: got %d, want %d", chars, n, got, pos)
+			}
+			data[pos] = filler
+		}
+	}
+}
+
+func TestAvx512Kernels(t *testing.T) {
+	if !hasAVX512 {
+		t.Skip("AVX-512BW/VBMI not supported")
+	}
+
+	// Every length around the 64/128/256-byte block sizes, so each loop and
+	// the masked tail see the interesting byte in every position.
+	for n := 0; n < 600; n++ {
+		lower := strings.Repeat("x", n)
+		upper := strings.ToUpper(lower)
+		if !isAsciiAvx512(lower) {
+			t.Fatalf("isAsciiAvx512 len=%d: got false, want true", n)
+		}
+		if got := indexMaskAvx512(lower, 0x80); got != -1 {
+			t.Fatalf("indexMaskAvx512 len=%d: got %d, want -1", n, got)
+		}
+		if !equalFoldAvx512(lower, upper) {
+			t.Fatalf("equalFoldAvx512 len=%d: got false, want true", n)
+		}
+		for pos := 0; pos < n; pos++ {
+			b := []byte(lower)
+			b[pos] = 0xC3
+			if isAsciiAvx512(string(b)) {
+				t.Fatalf("isAsciiAvx512 len=%d pos=%d: got true, want false", n, pos)
+			}
+			if got := indexMaskAvx512(string(b), 0x80); got != pos {
+				t.Fatalf("indexMaskAvx512 len=%d: got %d, want %d", n, got, pos)
+			}
+			b[pos] = 'y'
+			if equalFoldAvx512(string(b), upper) {
+				t.Fatalf("equalFoldAvx512 len=%d pos=%d: got true, want false", n, pos)
+			}
+			// '@' and '`' differ from each other by 0x20 but are not letters
+			b[pos] = '@'
+			if equalFoldAvx512(string(b), strings.Repeat("x", pos)+"`"+strings.Repeat("x", n-pos-1)) {
+				t.Fatalf("equalFoldAvx512 len=%d pos=%d: non-letters folded", n, pos)
+			}
+		}
+	}
+
+	rng := rand.New(rand.NewSource(4))
+	for _, alphabet := range []string{"aA", "abAB", `"{}:,aB`, "xyzXYZ0"} {
+		for i := 0; i < 500; i++ {
+			hay := make([]byte, rng.Intn(2000))
+			for j := range hay {
+				hay[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			needle := make([]byte, 1+rng.Intn(80))
+			for j := range needle {
+				needle[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			h, n := string(hay), string(needle)
+			s := NewSearcher(n, false)
+
+			want := indexFoldGo(h, n)
+			if got := indexFoldAvx512(h, s.rare1, s.off1, s.rare2, s.off2, n); got != want {
+				t.Fatalf("indexFoldAvx512(%q, %q) = %d, want %d", truncate(h, 40), n, got, want)
+			}
+			if got := searchNeedleFoldAvx512(h, s.rare1, s.off1, s.rare2, s.off2, s.norm); got != want {
+				t.Fatalf("searchNeedleFoldAvx512(%q, %q) = %d, want %d", truncate(h, 40), n, got, want)
+			}
+
+			s = NewSearcher(n, true)
+			want = strings.Index(h, n)
+			if got := indexExactAvx512(h, s.rare1, s.off1, s.rare2, s.off2, s.raw); got != want {
+				t.Fatalf("indexExactAvx512(%q, %q) = %d, want %d", truncate(h, 40), n, got, want)
+			}
+		}
+	}
+}
+
+func TestSseKernels(t *testing.T) {
+	if !hasSSE41 {
+		t.Skip("SSE4.1 not supported")
+	}
+
+	for n := 0; n < 300; n++ {
+		lower := strings.Repeat("x", n)
+		upper := strings.ToUpper(lower)
+		if got := indexMaskSse(lower, 0x80); got != -1 {
+			t.Fatalf("indexMaskSse len=%d: got %d, want -1", n, got)
+		}
+		if !equalFoldSse(lower, upper) {
+			t.Fatalf("equalFoldSse len=%d: got false, want true", n)
+		}
+		for pos := 0; pos < n; pos++ {
+			b := []byte(lower)
+			b[pos] = 0xC3
+			if got := indexMaskSse(string(b), 0x80); got != pos {
+				t.Fatalf("indexMaskSse len=%d: got %d, want %d", n, got, pos)
+			}
+			b[pos] = 'y'
+			if equalFoldSse(string(b), upper) {
+				t.Fatalf("equalFoldSse len=%d pos=%d: got true, want false", n, pos)
+			}
+			b[pos] = '@'
+			if equalFoldSse(string(b), strings.Repeat("x", pos)+"`"+strings.Repeat("x", n-pos-1)) {
+				t.Fatalf("equalFoldSse len=%d pos=%d: non-letters folded", n, pos)
+			}
+		}
+	}
+}
+
+func TestKernelTiers(t *testing.T) {
+	// Every tier the CPU supports has to agree with the generic kernels,
+	// whichever one VELOZ_ISA selected for this run.
+	rng := rand.New(rand.NewSource(5))
+	for tier := isaGeneric; tier <= detectISA(); tier++ {
+		k := kernelsFor(tier)
+		for i := 0; i < 300; i++ {
+			hay := make([]byte, rng.Intn(300))
+			for j := range hay {
+				hay[j] = "aAbB:,\x80"[rng.Intn(7)]
+			}
+			needle := make([]byte, 1+rng.Intn(10))
+			for j := range needle {
+				needle[j] = "aAbB"[rng.Intn(4)]
+			}
+			h, n := string(hay), string(needle)
+			other := strings.ToUpper(h)
+
+			if got, want := k.validString(h), isAsciiGo(h); got != want {
+				t.Fatalf("%s validString(%q) = %v, want %v", isaNames[tier], h, got, want)
+			}
+			if got, want := k.indexMask(h, 0x80), indexMaskGo(h, 0x80); got != want {
+				t.Fatalf("%s indexMask(%q) = %d, want %d", isaNames[tier], h, got, want)
+			}
+			if got, want := k.equalFold(h, other), equalFoldGo(h, other); got != want {
+				t.Fatalf("%s equalFold(%q) = %v, want %v", isaNames[tier], h, got, want)
+			}
+			if len(h) >= len(n) {
+				if got, want := k.indexFold(h, n), indexFoldGo(h, n); got != want {
+					t.Fatalf("%s indexFold(%q, %q) = %d, want %d", isaNames[tier], h, n, got, want)
+				}
+			}
+			cs := MakeCharSet(n)
+			if got, want := k.indexAnyCharSet(h, cs), indexAnyCharSetGo(h, cs); got != want {
+				t.Fatalf("%s indexAnyCharSet(%q, %q) = %d, want %d", isaNames[tier], h, n, got, want)
+			}
+
+			var got, want [4]int
+			sr := NewSearcher(n, false)
+			gn := k.searchAllFold(h, sr.rare1, sr.off1, sr.rare2, sr.off2, sr.norm, got[:])
+			wn := genericKernels().searchAllFold(h, sr.rare1, sr.off1, sr.rare2, sr.off2, sr.norm, want[:])
+			if gn != wn || got != want {
+				t.Fatalf("%s searchAllFold(%q, %q) = %v, want %v", isaNames[tier], h, n, got[:gn], want[:wn])
+			}
+
+			count := strings.Count(normalizeASCII(h), sr.norm)
+			if got := k.countNeedleFold(h, sr.rare1, sr.off1, sr.rare2, sr.off2, sr.norm); got != count {
+				t.Fatalf("%s countNeedleFold(%q, %q) = %d, want %d", isaNames[tier], h, n, got, count)
+			}
+			if got := k.countFold(h, n); got != count {
+				t.Fatalf("%s countFold(%q, %q) = %d, want %d", isaNames[tier], h, n, got, count)
+			}
+
+			last := strings.LastIndex(normalizeASCII(h), sr.norm)
+			if got := k.lastIndexFold(h, n); got != last {
+				t.Fatalf("%s lastIndexFold(%q, %q) = %d, want %d", isaNames[tier], h, n, got, last)
+			}
+			if got := k.lastSearchNeedleFold(h, sr.rare1, sr.off1, sr.rare2, sr.off2, sr.norm); got != last {
+				t.Fatalf("%s lastSearchNeedleFold(%q, %q) = %d, want %d", isaNames[tier], h, n, got, last)
+			}
+
+			word := genericKernels().searchWordFold(h, sr.rare1, sr.off1, sr.rare2, sr.off2, sr.norm, &WordBoundary.bitset)
+			if got := k.searchWordFold(h, sr.rare1, sr.off1, sr.rare2, sr.off2, sr.norm, &WordBoundary.bitset); got != word {
+				t.Fatalf("%s searchWordFold(%q, %q) = %d, want %d", isaNames[tier], h, n, got, word)
+			}
+			se := NewSearcher(n, true)
+			word = genericKernels().indexWordExact(h, se.rare1, se.off1, se.rare2, se.off2, n, &WordBoundary.bitset)
+			if got := k.indexWordExact(h, se.rare1, se.off1, se.rare2, se.off2, n, &WordBoundary.bitset); got != word {
+				t.Fatalf("%s indexWordExact(%q, %q) = %d, want %d", isaNames[tier], h, n, got, word)
+			}
+
+			bs := MakeBooleanSearch(Or(ContainsCI(n), ContainsCS(n+":")))
+			if got, want := k.searchTBL(bs, h, 0, nil), bs.searchTBLGo(h, 0, nil); got != want {
+				t.Fatalf("%s searchTBL(%q, %q) = %b, want %b", isaNames[tier], h, n, got, want)
+			}
+		}
+	}
+}
@@ -0,0 +1,164 @@
+//go:build !noasm && arm64
+
+package ascii
+
+import (
+	"math/rand"
+	"strings"
+	"testing"
+)
+
+// TestBoolSearchNEON checks the NEON TBL and FDR kernels against the Go
+// engines, found masks and first offsets both, on mixed-case patterns of
+// short and long lengths placed anywhere in the haystack, including its end.
+func TestBoolSearchNEON(t *testing.T) {
+	rng := rand.New(rand.NewSource(11))
+	const alphabet = "abcAB_-. \nxyzXYZ0123"
+	rnd := func(n int) string {
+		b := make([]byte, n)
+		for i := range b {
+			b[i] = alphabet[rng.Intn(len(alphabet))]
+		}
+		return string(b)
+	}
+
+	for i := 0; i < 2000; i++ {
+		fdr := i%2 == 1
+		np := 1 + rng.Intn(8)
+		if fdr {
+			np = 9 + rng.Intn(56)
+		}
+		patterns := make([]string, np)
+		var expr BoolExpr
+		for j := range patterns {
+			n := 3 + rng.Intn(4)
+			switch rng.Intn(8) {
+			case 0:
+				n = 9 + rng.Intn(8)
+			case 1:
+				n = 17 + rng.Intn(40)
+			}
+			patterns[j] = rnd(n)
+			var c BoolExpr = ContainsCI(patterns[j])
+			if rng.Intn(3) == 0 {
+				c = ContainsCS(patterns[j])
+			}
+			switch {
+			case expr == nil:
+				expr = c
+			case rng.Intn(6) == 0:
+				expr = And(expr, Not(c))
+			default:
+				expr = Or(expr, c)
+			}
+		}
+		bs := MakeBooleanSearch(expr)
+		if bs.banks != nil || bs.numScanned == 0 || bs.useFDR != fdr {
+			continue
+		}
+
+		// Fragments of the patterns in random case, ending on one of them
+		// every other time so that matches run up to the last byte
+		var sb strings.Builder
+		for n := rng.Intn(300); sb.Len() < n; {
+			if rng.Intn(3) != 0 {
+				sb.WriteString(rnd(1 + rng.Intn(8)))
+				continue
+			}
+			p := patterns[rng.Intn(np)]
+			if rng.Intn(2) == 0 {
+				p = p[:rng.Intn(len(p)+1)]
+			}
+			for _, c := range []byte(p) {
+				if rng.Intn(4) == 0 && isAlpha(c) {
+					c ^= 0x20
+				}
+				sb.WriteByte(c)
+			}
+		}
+		if rng.Intn(2) == 0 {
+			sb.WriteString(patterns[rng.Intn(np)])
+		}
+		// An exact-size copy, so that no capacity hides reads past the end
+		haystack := string([]byte(sb.String()))
+
+		var init uint64
+		if rng.Intn(4) == 0 {
+			init = uint64(rng.Int63()) & (1<<bs.numScanned - 1)
+		}
+		for _, detail := range []bool{false, true} {
+			var gotOff, wantOff *[64]int
+			if detail {
+				gotOff, wantOff = new([64]int), new([64]int)
+				for k := range gotOff {
+					gotOff[k], wantOff[k] = -1, -1
+				}
+			}
+			var got, want uint64
+			if fdr {
+				got, want = bs.searchFDRNEON(haystack, init, gotOff), bs.searchFDRGo(haystack, init, wantOff)
+			} else {
+				got, want = bs.searchTBLNEON(haystack, init, gotOff), bs.searchTBLGo(haystack, init, wantOff)
+			}
+			if got != want || detail && *gotOff != *wantOff {
+				t.Fatalf("fdr=%v patterns=%q haystack=%q init=%#x: foundMask = %#x, want %#x\noffsets %v\nwant    %v",
+					fdr, patterns, haystack, init, got, want, gotOff, wantOff)
+			}
+		}
+	}
+}
+
+// TestLastIndexNEON checks the NEON reverse kernels against strings.LastIndex
+// on small alphabets, where the rare bytes are common enough to drive the
+// kernels through their 2-byte and Rabin-Karp modes, with matches at either
+// end of the haystack and needles shorter and longer than a vector.
+func TestLastIndexNEON(t *testing.T) {
+	rng := rand.New(rand.NewSource(12))
+	alphabets := []string{"ab", "abAB", "abAB_ xyz\n0", "aA@`[{", "\x80\xff\xe1\xc1aA"}
+	for i := 0; i < 5000; i++ {
+		alphabet := alphabets[rng.Intn(len(alphabets))]
+		rnd := func(n int) string {
+			b := make([]byte, n)
+			for i := range b {
+				b[i] = alphabet[rng.Intn(len(alphabet))]
+			}
+			return string(b)
+		}
+		needle := rnd(1 + rng.Intn(6))
+		if i%4 == 0 {
+			needle = rnd(1 + rng.Intn(70))
+		}
+		n := rng.Intn(300)
+		if i%10 == 0 {
+			n = rng.Intn(3000)
+		}
+		b := []byte(rnd(n))
+		if n >= len(needle) {
+			switch rng.Intn(4) {
+			case 0:
+				copy(b[rng.Intn(n-len(needle)+1):], needle)
+			case 1:
+				copy(b[n-len(needle):], needle)
+			case 2:
+				copy(b, needle)
+			}
+		}
+		// An exact-size copy, so that no capacity hides reads past the end
+		haystack := string(b)
+
+		s := NewSearcher(needle, true)
+		want := strings.LastIndex(haystack, needle)
+		if got := lastIndexExactNEON(haystack, s.rare1, s.off1, s.rare2, s.off2, s.raw); got != want {
+			t.Fatalf("lastIndexExactNEON(%q, %q) = %d, want %d", haystack, needle, got, want)
+		}
+		s = NewSearcher(needle, false)
+		want = strings.LastIndex(normalizeASCII(haystack), normalizeASCII(needle))
+		if got := lastSearchNeedleFoldNEON(haystack, s.rare1, s.off1, s.rare2, s.off2, s.norm); got != want {
+			t.Fatalf("lastSearchNeedleFoldNEON(%q, %q) = %d, want %d", haystack, needle, got, want)
+		}
+		rare1, off1, rare2, off2 := selectRarePairSample(needle, nil, false)
+		if got := lastIndexFoldNEON(haystack, rare1, off1, rare2, off2, needle); got != want {
+			t.Fatalf("lastIndexFoldNEON(%q, %q) = %d, want %d", haystack, needle, got, want)
+		}
+	}
+}
@@ -1,5 +1,5 @@
 //go:build !noasm && amd64
-// Code generated by gocc -- DO NOT EDIT.
+// Code generated by gccasm -- DO NOT EDIT.
 
 package ascii
 
@@ -12,3 +12,54 @@ func equalFoldAvx(a string, b string) bool
 
 //go:noescape
 func indexMaskAvx(data string, mask byte) int
+
+//go:noescape
+func indexFoldRabinKarpAvx(haystack string, needle string) int
+
+//go:noescape
+func indexExactRabinKarpAvx(haystack string, needle string) int
+
+//go:noescape
+func indexPrefoldedRabinKarpAvx(haystack string, needle string) int
+
+//go:noescape
+func indexExactAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func indexFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func searchNeedleFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func indexAllExactAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, out []int) int
+
+//go:noescape
+func searchAllFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, out []int) int
+
+//go:noescape
+func indexWordExactAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, boundary *[4]uint64) int
+
+//go:noescape
+func searchWordFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, boundary *[4]uint64) int
+
+//go:noescape
+func countExactAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func countFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func countNeedleFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func lastIndexExactAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func lastIndexFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func lastSearchNeedleFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func indexAnyAvxBitset(data string, bitset0 uint64, bitset1 uint64, bitset2 uint64, bitset3 uint64) int
@@ -0,0 +1,53 @@
+//go:build !noasm && amd64
+// Code generated by gccasm -- DO NOT EDIT.
+
+package ascii
+
+
+//go:noescape
+func isAsciiAvx512(src string) bool
+
+//go:noescape
+func indexMaskAvx512(data string, mask byte) int
+
+//go:noescape
+func equalFoldAvx512(a string, b string) bool
+
+//go:noescape
+func indexExactAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func indexFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func searchNeedleFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func indexAllExactAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, out []int) int
+
+//go:noescape
+func searchAllFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, out []int) int
+
+//go:noescape
+func indexWordExactAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, boundary *[4]uint64) int
+
+//go:noescape
+func searchWordFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, boundary *[4]uint64) int
+
+//go:noescape
+func countExactAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func countFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func countNeedleFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func lastIndexExactAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func lastIndexFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func lastSearchNeedleFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
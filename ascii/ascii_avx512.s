@@ -0,0 +1,6660 @@
+//go:build !noasm && amd64
+// Code generated by gccasm -- DO NOT EDIT.
+//
+// Source file         : ascii_avx512.c
+// Compiler version    : gcc (Debian 12.2.0-14+deb12u1) 12.2.0
+// Target architecture : amd64
+// Compiler options    : -mavx512f -mavx512bw -mavx512vl -mavx512vbmi -mavx2 -mfma -mpopcnt
+
+#include "textflag.h"
+
+TEXT ·isAsciiAvx512(SB), NOSPLIT, $0-17
+	MOVQ         src+0(FP), DI
+	MOVQ         src_len+8(FP), SI
+	MOVQ         SI, DX     // <--                                  // mov	rdx, rsi
+	MOVQ         DI, AX     // <--                                  // mov	rax, rdi
+	XORB         DX, DX     // <--                                  // xor	dl, dl
+	ADDQ         DI, DX     // <--                                  // add	rdx, rdi
+	CMPQ         DI, DX     // <--                                  // cmp	rdi, rdx
+	JAE          LBB0_4     // <--                                  // jae	.LBB0_4
+	MOVL         $-0x80, DI // <--                                  // mov	edi, -128
+	VPBROADCASTB DI, Z2     // <--                                  // vpbroadcastb	zmm2, edi
+	JMP          LBB0_1     // <--                                  // jmp	.LBB0_1
+
+LBB0_0:
+	ADDQ $0x100, AX // <--                                  // add	rax, 256
+	CMPQ AX, DX     // <--                                  // cmp	rax, rdx
+	JAE  LBB0_4     // <--                                  // jae	.LBB0_4
+
+LBB0_1:
+	VMOVDQU32  0x40(AX), Z3            // <--                                  // vmovdqu32	zmm3, zmmword ptr [rax + 64]
+	VPORD      0(AX), Z3, Z1           // <--                                  // vpord	zmm1, zmm3, zmmword ptr [rax]
+	VMOVDQU32  0xc0(AX), Z0            // <--                                  // vmovdqu32	zmm0, zmmword ptr [rax + 192]
+	VPTERNLOGD $0xfe, 0x80(AX), Z1, Z0 // <--                                  // vpternlogd	zmm0, zmm1, zmmword ptr [rax + 128], 254
+	VPTESTMB   Z2, Z0, K0              // <--                                  // vptestmb	k0, zmm0, zmm2
+	KORTESTQ   K0, K0                  // <--                                  // kortestq	k0, k0
+	JE         LBB0_0                  // <--                                  // je	.LBB0_0
+
+LBB0_2:
+	XORL DX, DX // <--                                  // xor	edx, edx
+
+LBB0_3:
+	MOVL       DX, AX         // <--                                  // mov	eax, edx
+	VZEROUPPER                // <--                                  // vzeroupper
+	MOVB       AX, ret+16(FP) // <--
+	RET                       // <--                                  // ret
+
+LBB0_4:
+	MOVQ         SI, DX     // <--                                  // mov	rdx, rsi
+	ANDL         $0xc0, DX  // <--                                  // and	edx, 192
+	ADDQ         AX, DX     // <--                                  // add	rdx, rax
+	CMPQ         AX, DX     // <--                                  // cmp	rax, rdx
+	JAE          LBB0_7     // <--                                  // jae	.LBB0_7
+	MOVL         $-0x80, DI // <--                                  // mov	edi, -128
+	VPBROADCASTB DI, Z0     // <--                                  // vpbroadcastb	zmm0, edi
+	JMP          LBB0_6     // <--                                  // jmp	.LBB0_6
+
+LBB0_5:
+	ADDQ $0x40, AX // <--                                  // add	rax, 64
+	CMPQ AX, DX    // <--                                  // cmp	rax, rdx
+	JAE  LBB0_7    // <--                                  // jae	.LBB0_7
+
+LBB0_6:
+	VMOVDQU8 0(AX), Z4  // <--                                  // vmovdqu8	zmm4, zmmword ptr [rax]
+	VPTESTMB Z0, Z4, K0 // <--                                  // vptestmb	k0, zmm4, zmm0
+	KORTESTQ K0, K0     // <--                                  // kortestq	k0, k0
+	JE       LBB0_5     // <--                                  // je	.LBB0_5
+	JMP      LBB0_2     // <--                                  // jmp	.LBB0_2
+
+LBB0_7:
+	MOVL         $0x1, DX       // <--                                  // mov	edx, 1
+	ANDL         $0x3f, SI      // <--                                  // and	esi, 63
+	JE           LBB0_3         // <--                                  // je	.LBB0_3
+	MOVL         SI, CX         // <--                                  // mov	ecx, esi
+	MOVL         $0x1, DX       // <--                                  // mov	edx, 1
+	SHLQ         CX, DX         // <--                                  // shl	rdx, cl
+	SUBQ         $0x1, DX       // <--                                  // sub	rdx, 1
+	KMOVQ        DX, K1         // <--                                  // kmovq	k1, rdx
+	VMOVDQU8.Z   0(AX), K1, Z1  // <--                                  // vmovdqu8	zmm1{k1}{z}, zmmword ptr [rax]
+	MOVL         $-0x80, AX     // <--                                  // mov	eax, -128
+	VPBROADCASTB AX, Z0         // <--                                  // vpbroadcastb	zmm0, eax
+	VPTESTMB     Z0, Z1, K0     // <--                                  // vptestmb	k0, zmm1, zmm0
+	KORTESTQ     K0, K0         // <--                                  // kortestq	k0, k0
+	SETEQ        DX             // <--                                  // sete	dl
+	MOVL         DX, AX         // <--                                  // mov	eax, edx
+	VZEROUPPER                  // <--                                  // vzeroupper
+	MOVB         AX, ret+16(FP) // <--
+	RET                         // <--                                  // ret
+
+TEXT ·indexMaskAvx512(SB), NOSPLIT, $0-32
+	MOVQ         data+0(FP), DI
+	MOVQ         data_len+8(FP), SI
+	MOVBQZX      mask+16(FP), DX
+	MOVQ         SI, AX // <--                                  // mov	rax, rsi
+	VPBROADCASTB DX, Z0 // <--                                  // vpbroadcastb	zmm0, edx
+	MOVQ         DI, DX // <--                                  // mov	rdx, rdi
+	XORB         AX, AX // <--                                  // xor	al, al
+	ADDQ         DI, AX // <--                                  // add	rax, rdi
+	CMPQ         DI, AX // <--                                  // cmp	rdi, rax
+	JAE          LBB1_4 // <--                                  // jae	.LBB1_4
+
+LBB1_0:
+	VMOVDQU64  0(DX), Z1                 // <--                                  // vmovdqu64	zmm1, zmmword ptr [rdx]
+	VMOVDQU64  0x40(DX), Z2              // <--                                  // vmovdqu64	zmm2, zmmword ptr [rdx + 64]
+	VMOVDQU64  0x80(DX), Z3              // <--                                  // vmovdqu64	zmm3, zmmword ptr [rdx + 128]
+	VMOVDQU64  0xc0(DX), Z4              // <--                                  // vmovdqu64	zmm4, zmmword ptr [rdx + 192]
+	VPORD      Z1, Z2, Z6                // <--                                  // vpord	zmm6, zmm2, zmm1
+	LONG       $0x487df162; WORD $0xeb6f // VMOVDQA32 Z3, Z5                     // vmovdqa32	zmm5, zmm3
+	VPTERNLOGD $0xfe, Z6, Z4, Z5         // <--                                  // vpternlogd	zmm5, zmm4, zmm6, 254
+	VPTESTMB   Z0, Z5, K0                // <--                                  // vptestmb	k0, zmm5, zmm0
+	KORTESTQ   K0, K0                    // <--                                  // kortestq	k0, k0
+	JE         LBB1_3                    // <--                                  // je	.LBB1_3
+	VPTESTMB   Z0, Z1, K0                // <--                                  // vptestmb	k0, zmm1, zmm0
+	SUBQ       DI, DX                    // <--                                  // sub	rdx, rdi
+	KORTESTQ   K0, K0                    // <--                                  // kortestq	k0, k0
+	JNE        LBB1_7                    // <--                                  // jne	.LBB1_7
+	VPTESTMB   Z0, Z2, K0                // <--                                  // vptestmb	k0, zmm2, zmm0
+	KORTESTQ   K0, K0                    // <--                                  // kortestq	k0, k0
+	JNE        LBB1_2                    // <--                                  // jne	.LBB1_2
+	VPTESTMB   Z0, Z3, K0                // <--                                  // vptestmb	k0, zmm3, zmm0
+	KORTESTQ   K0, K0                    // <--                                  // kortestq	k0, k0
+	JNE        LBB1_8                    // <--                                  // jne	.LBB1_8
+	VPTESTMB   Z0, Z4, K2                // <--                                  // vptestmb	k2, zmm4, zmm0
+	KMOVQ      K2, AX                    // <--                                  // kmovq	rax, k2
+	TZCNTQ     AX, AX                    // <--                                  // tzcnt	rax, rax
+	CDQE                                 // <--                                  // cdqe
+	LEAQ       0xc0(DX)(AX*1), AX        // <--                                  // lea	rax, [rdx + rax + 192]
+
+LBB1_1:
+	VZEROUPPER                // <--                                  // vzeroupper
+	MOVQ       AX, ret+24(FP) // <--
+	RET                       // <--                                  // ret
+
+LBB1_2:
+	KMOVQ      K0, AX             // <--                                  // kmovq	rax, k0
+	TZCNTQ     AX, AX             // <--                                  // tzcnt	rax, rax
+	CDQE                          // <--                                  // cdqe
+	LEAQ       0x40(DX)(AX*1), AX // <--                                  // lea	rax, [rdx + rax + 64]
+	VZEROUPPER                    // <--                                  // vzeroupper
+	MOVQ       AX, ret+24(FP)     // <--
+	RET                           // <--                                  // ret
+
+LBB1_3:
+	ADDQ $0x100, DX // <--                                  // add	rdx, 256
+	CMPQ DX, AX     // <--                                  // cmp	rdx, rax
+	JB   LBB1_0     // <--                                  // jb	.LBB1_0
+
+LBB1_4:
+	MOVQ SI, AX    // <--                                  // mov	rax, rsi
+	ANDL $0xc0, AX // <--                                  // and	eax, 192
+	ADDQ DX, AX    // <--                                  // add	rax, rdx
+	CMPQ DX, AX    // <--                                  // cmp	rdx, rax
+	JB   LBB1_6    // <--                                  // jb	.LBB1_6
+	JMP  LBB1_9    // <--                                  // jmp	.LBB1_9
+
+LBB1_5:
+	ADDQ $0x40, DX // <--                                  // add	rdx, 64
+	CMPQ DX, AX    // <--                                  // cmp	rdx, rax
+	JAE  LBB1_9    // <--                                  // jae	.LBB1_9
+
+LBB1_6:
+	VMOVDQU8 0(DX), Z7  // <--                                  // vmovdqu8	zmm7, zmmword ptr [rdx]
+	VPTESTMB Z0, Z7, K0 // <--                                  // vptestmb	k0, zmm7, zmm0
+	KORTESTQ K0, K0     // <--                                  // kortestq	k0, k0
+	JE       LBB1_5     // <--                                  // je	.LBB1_5
+	XORL     CX, CX     // <--                                  // xor	ecx, ecx
+	KMOVQ    K0, AX     // <--                                  // kmovq	rax, k0
+	TZCNTQ   AX, CX     // <--                                  // tzcnt	rcx, rax
+	MOVQ     DX, AX     // <--                                  // mov	rax, rdx
+	SUBQ     DI, AX     // <--                                  // sub	rax, rdi
+	MOVLQSX  CX, DX     // <--                                  // movsxd	rdx, ecx
+	ADDQ     DX, AX     // <--                                  // add	rax, rdx
+	JMP      LBB1_1     // <--                                  // jmp	.LBB1_1
+
+LBB1_7:
+	KMOVQ      K0, AX         // <--                                  // kmovq	rax, k0
+	TZCNTQ     AX, AX         // <--                                  // tzcnt	rax, rax
+	CDQE                      // <--                                  // cdqe
+	ADDQ       DX, AX         // <--                                  // add	rax, rdx
+	VZEROUPPER                // <--                                  // vzeroupper
+	MOVQ       AX, ret+24(FP) // <--
+	RET                       // <--                                  // ret
+
+LBB1_8:
+	KMOVQ      K0, AX             // <--                                  // kmovq	rax, k0
+	TZCNTQ     AX, AX             // <--                                  // tzcnt	rax, rax
+	CDQE                          // <--                                  // cdqe
+	LEAQ       0x80(DX)(AX*1), AX // <--                                  // lea	rax, [rdx + rax + 128]
+	VZEROUPPER                    // <--                                  // vzeroupper
+	MOVQ       AX, ret+24(FP)     // <--
+	RET                           // <--                                  // ret
+
+LBB1_9:
+	ANDL       $0x3f, SI     // <--                                  // and	esi, 63
+	JE         LBB1_10       // <--                                  // je	.LBB1_10
+	MOVL       $0x1, AX      // <--                                  // mov	eax, 1
+	MOVL       SI, CX        // <--                                  // mov	ecx, esi
+	SHLQ       CX, AX        // <--                                  // shl	rax, cl
+	SUBQ       $0x1, AX      // <--                                  // sub	rax, 1
+	KMOVQ      AX, K1        // <--                                  // kmovq	k1, rax
+	VMOVDQU8.Z 0(DX), K1, Z1 // <--                                  // vmovdqu8	zmm1{k1}{z}, zmmword ptr [rdx]
+	VPTESTMB   Z0, Z1, K0    // <--                                  // vptestmb	k0, zmm1, zmm0
+	KORTESTQ   K0, K0        // <--                                  // kortestq	k0, k0
+	JE         LBB1_10       // <--                                  // je	.LBB1_10
+	KMOVQ      K0, AX        // <--                                  // kmovq	rax, k0
+	TZCNTQ     AX, AX        // <--                                  // tzcnt	rax, rax
+	SUBQ       DI, DX        // <--                                  // sub	rdx, rdi
+	CDQE                     // <--                                  // cdqe
+	ADDQ       DX, AX        // <--                                  // add	rax, rdx
+	JMP        LBB1_1        // <--                                  // jmp	.LBB1_1
+
+LBB1_10:
+	MOVQ $-0x1, AX // <--                                  // mov	rax, -1
+	JMP  LBB1_1    // <--                                  // jmp	.LBB1_1
+
+TEXT ·equalFoldAvx512(SB), NOSPLIT, $0-33
+	MOVQ         a+0(FP), DI
+	MOVQ         a_len+8(FP), SI
+	MOVQ         b+16(FP), DX
+	MOVQ         b_len+24(FP), CX
+	MOVQ         SI, R8          // <--                                  // mov	r8, rsi
+	XORL         AX, AX          // <--                                  // xor	eax, eax
+	MOVQ         DX, SI          // <--                                  // mov	rsi, rdx
+	CMPQ         R8, CX          // <--                                  // cmp	r8, rcx
+	JNE          LBB2_5          // <--                                  // jne	.LBB2_5
+	MOVQ         R8, CX          // <--                                  // mov	rcx, r8
+	ANDQ         $-0x80, CX      // <--                                  // and	rcx, -128
+	ADDQ         DI, CX          // <--                                  // add	rcx, rdi
+	CMPQ         DI, CX          // <--                                  // cmp	rdi, rcx
+	JAE          LBB2_2          // <--                                  // jae	.LBB2_2
+	MOVL         $0x20202020, AX // <--                                  // mov	eax, 538976288
+	VPBROADCASTD AX, Z5          // <--                                  // vpbroadcastd	zmm5, eax
+	MOVL         $-0x61, AX      // <--                                  // mov	eax, -97
+	VPBROADCASTB AX, Z4          // <--                                  // vpbroadcastb	zmm4, eax
+	MOVL         $0x1a, AX       // <--                                  // mov	eax, 26
+	VPBROADCASTB AX, Z3          // <--                                  // vpbroadcastb	zmm3, eax
+	MOVL         $0x20, AX       // <--                                  // mov	eax, 32
+	VPBROADCASTB AX, Z2          // <--                                  // vpbroadcastb	zmm2, eax
+	JMP          LBB2_1          // <--                                  // jmp	.LBB2_1
+
+LBB2_0:
+	SUBQ $-0x80, DI // <--                                  // sub	rdi, -128
+	SUBQ $-0x80, SI // <--                                  // sub	rsi, -128
+	CMPQ DI, CX     // <--                                  // cmp	rdi, rcx
+	JAE  LBB2_2     // <--                                  // jae	.LBB2_2
+
+LBB2_1:
+	VPORD      0(DI), Z5, Z0                        // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rdi]
+	VPORD      0x40(DI), Z5, Z1                     // <--                                  // vpord	zmm1, zmm5, zmmword ptr [rdi + 64]
+	VMOVDQU32  0(SI), Z6                            // <--                                  // vmovdqu32	zmm6, zmmword ptr [rsi]
+	VMOVDQU32  0x40(SI), Z7                         // <--                                  // vmovdqu32	zmm7, zmmword ptr [rsi + 64]
+	VPADDB     Z4, Z0, Z0                           // <--                                  // vpaddb	zmm0, zmm0, zmm4
+	VPADDB     Z4, Z1, Z1                           // <--                                  // vpaddb	zmm1, zmm1, zmm4
+	LONG       $0x487df362; WORD $0xcb3e; BYTE $0x1 // VPCMPLTUB Z3, Z0, K1                 // vpcmpltub	k1, zmm0, zmm3
+	VPXORD     0(DI), Z6, Z0                        // <--                                  // vpxord	zmm0, zmm6, zmmword ptr [rdi]
+	LONG       $0x497df362; WORD $0xc23f; BYTE $0x0 // VPCMPEQB Z2, Z0, K1, K0              // vpcmpeqb	k0{k1}, zmm0, zmm2
+	LONG       $0x4875f362; WORD $0xcb3e; BYTE $0x1 // VPCMPLTUB Z3, Z1, K1                 // vpcmpltub	k1, zmm1, zmm3
+	VPXORD     0x40(DI), Z7, Z1                     // <--                                  // vpxord	zmm1, zmm7, zmmword ptr [rdi + 64]
+	LONG       $0x4975f362; WORD $0xca3f; BYTE $0x0 // VPCMPEQB Z2, Z1, K1, K1              // vpcmpeqb	k1{k1}, zmm1, zmm2
+	KNOTQ      K1, K1                               // <--                                  // knotq	k1, k1
+	VPTESTMB   Z1, Z1, K1, K2                       // <--                                  // vptestmb	k2{k1}, zmm1, zmm1
+	KNOTQ      K0, K1                               // <--                                  // knotq	k1, k0
+	VPTESTMB   Z0, Z0, K1, K3                       // <--                                  // vptestmb	k3{k1}, zmm0, zmm0
+	KMOVQ      K2, AX                               // <--                                  // kmovq	rax, k2
+	KMOVQ      K3, DX                               // <--                                  // kmovq	rdx, k3
+	ORQ        DX, AX                               // <--                                  // or	rax, rdx
+	JE         LBB2_0                               // <--                                  // je	.LBB2_0
+	XORL       AX, AX                               // <--                                  // xor	eax, eax
+	VZEROUPPER                                      // <--                                  // vzeroupper
+	MOVB       AX, ret+32(FP)                       // <--
+	RET                                             // <--                                  // ret
+
+LBB2_2:
+	MOVQ R8, CX    // <--                                  // mov	rcx, r8
+	ANDL $0x7f, CX // <--                                  // and	ecx, 127
+	ANDL $0x40, R8 // <--                                  // and	r8d, 64
+	JNE  LBB2_7    // <--                                  // jne	.LBB2_7
+
+LBB2_3:
+	MOVL  $0x1, AX // <--                                  // mov	eax, 1
+	TESTQ CX, CX   // <--                                  // test	rcx, rcx
+	JNE   LBB2_6   // <--                                  // jne	.LBB2_6
+
+LBB2_4:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB2_5:
+	MOVB AX, ret+32(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB2_6:
+	MOVL         $0x1, AX                             // <--                                  // mov	eax, 1
+	SHLQ         CX, AX                               // <--                                  // shl	rax, cl
+	SUBQ         $0x1, AX                             // <--                                  // sub	rax, 1
+	KMOVQ        AX, K1                               // <--                                  // kmovq	k1, rax
+	MOVL         $0x20202020, AX                      // <--                                  // mov	eax, 538976288
+	VMOVDQU8.Z   0(DI), K1, Z1                        // <--                                  // vmovdqu8	zmm1{k1}{z}, zmmword ptr [rdi]
+	VMOVDQU8.Z   0(SI), K1, Z3                        // <--                                  // vmovdqu8	zmm3{k1}{z}, zmmword ptr [rsi]
+	VPBROADCASTD AX, Z0                               // <--                                  // vpbroadcastd	zmm0, eax
+	MOVL         $-0x61, AX                           // <--                                  // mov	eax, -97
+	VPBROADCASTB AX, Z2                               // <--                                  // vpbroadcastb	zmm2, eax
+	VPORD        Z1, Z0, Z0                           // <--                                  // vpord	zmm0, zmm0, zmm1
+	MOVL         $0x1a, AX                            // <--                                  // mov	eax, 26
+	VPADDB       Z2, Z0, Z0                           // <--                                  // vpaddb	zmm0, zmm0, zmm2
+	VPBROADCASTB AX, Z2                               // <--                                  // vpbroadcastb	zmm2, eax
+	MOVL         $0x20, AX                            // <--                                  // mov	eax, 32
+	LONG         $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VPXORD       Z3, Z1, Z0                           // <--                                  // vpxord	zmm0, zmm1, zmm3
+	VPBROADCASTB AX, Z1                               // <--                                  // vpbroadcastb	zmm1, eax
+	LONG         $0x497df362; WORD $0xc93f; BYTE $0x0 // VPCMPEQB Z1, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm1
+	KNOTQ        K1, K1                               // <--                                  // knotq	k1, k1
+	VPTESTMB     Z0, Z0, K1, K1                       // <--                                  // vptestmb	k1{k1}, zmm0, zmm0
+	KORTESTQ     K1, K1                               // <--                                  // kortestq	k1, k1
+	SETEQ        AX                                   // <--                                  // sete	al
+	VZEROUPPER                                        // <--                                  // vzeroupper
+	MOVB         AX, ret+32(FP)                       // <--
+	RET                                               // <--                                  // ret
+
+LBB2_7:
+	MOVL         $0x20202020, AX                      // <--                                  // mov	eax, 538976288
+	VMOVDQU32    0(SI), Z6                            // <--                                  // vmovdqu32	zmm6, zmmword ptr [rsi]
+	VPBROADCASTD AX, Z0                               // <--                                  // vpbroadcastd	zmm0, eax
+	MOVL         $-0x61, AX                           // <--                                  // mov	eax, -97
+	VPORD        0(DI), Z0, Z0                        // <--                                  // vpord	zmm0, zmm0, zmmword ptr [rdi]
+	VPBROADCASTB AX, Z1                               // <--                                  // vpbroadcastb	zmm1, eax
+	MOVL         $0x1a, AX                            // <--                                  // mov	eax, 26
+	VPADDB       Z1, Z0, Z0                           // <--                                  // vpaddb	zmm0, zmm0, zmm1
+	VPBROADCASTB AX, Z1                               // <--                                  // vpbroadcastb	zmm1, eax
+	MOVL         $0x20, AX                            // <--                                  // mov	eax, 32
+	LONG         $0x487df362; WORD $0xc93e; BYTE $0x1 // VPCMPLTUB Z1, Z0, K1                 // vpcmpltub	k1, zmm0, zmm1
+	VPXORD       0(DI), Z6, Z0                        // <--                                  // vpxord	zmm0, zmm6, zmmword ptr [rdi]
+	VPBROADCASTB AX, Z1                               // <--                                  // vpbroadcastb	zmm1, eax
+	XORL         AX, AX                               // <--                                  // xor	eax, eax
+	LONG         $0x497df362; WORD $0xc93f; BYTE $0x0 // VPCMPEQB Z1, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm1
+	KNOTQ        K1, K1                               // <--                                  // knotq	k1, k1
+	VPTESTMB     Z0, Z0, K1, K1                       // <--                                  // vptestmb	k1{k1}, zmm0, zmm0
+	KORTESTQ     K1, K1                               // <--                                  // kortestq	k1, k1
+	JNE          LBB2_4                               // <--                                  // jne	.LBB2_4
+	ADDQ         $0x40, DI                            // <--                                  // add	rdi, 64
+	ADDQ         $0x40, SI                            // <--                                  // add	rsi, 64
+	SUBQ         $0x40, CX                            // <--                                  // sub	rcx, 64
+	JMP          LBB2_3                               // <--                                  // jmp	.LBB2_3
+
+TEXT ·indexExactAvx512(SB), NOSPLIT, $200-72
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	PUSHQ        BP               // <--                                  // push	rbp
+	MOVQ         SP, BP           // <--                                  // mov	rbp, rsp
+	PUSHQ        R15              // <--                                  // push	r15
+	MOVL         R8, R15          // <--                                  // mov	r15d, r8d
+	PUSHQ        R14              // <--                                  // push	r14
+	PUSHQ        R13              // <--                                  // push	r13
+	PUSHQ        R12              // <--                                  // push	r12
+	PUSHQ        BX               // <--                                  // push	rbx
+	MOVQ         DI, BX           // <--                                  // mov	rbx, rdi
+	MOVQ         R9, DI           // <--                                  // mov	rdi, r9
+	ANDQ         $-0x40, SP       // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP        // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R9     // <--                                  // mov	r9, qword ptr [rbp + 24]
+	MOVQ         0x10(BP), R8     // <--                                  // mov	r8, qword ptr [rbp + 16]
+	CMPQ         SI, R9           // <--                                  // cmp	rsi, r9
+	JL           LBB3_27          // <--                                  // jl	.LBB3_27
+	MOVQ         SI, AX           // <--                                  // mov	rax, rsi
+	XORL         SI, SI           // <--                                  // xor	esi, esi
+	TESTQ        R9, R9           // <--                                  // test	r9, r9
+	JLE          LBB3_11          // <--                                  // jle	.LBB3_11
+	MOVQ         AX, R13          // <--                                  // mov	r13, rax
+	VPBROADCASTB DX, Z0           // <--                                  // vpbroadcastb	zmm0, edx
+	LEAQ         0(BX)(CX*1), R12 // <--                                  // lea	r12, [rbx + rcx]
+	XORL         R11, R11         // <--                                  // xor	r11d, r11d
+	SUBQ         R9, R13          // <--                                  // sub	r13, r9
+	XORL         R10, R10         // <--                                  // xor	r10d, r10d
+	MOVL         $0x1, R14        // <--                                  // mov	r14d, 1
+	KMOVD        R15, K7          // <--                                  // kmovd	k7, r15d
+	ADDQ         $0x1, R13        // <--                                  // add	r13, 1
+
+LBB3_0:
+	LEAQ     0xff(R10), DX     // <--                                  // lea	rdx, [r10 + 255]
+	CMPQ     R13, DX           // <--                                  // cmp	r13, rdx
+	JLE      LBB3_1            // <--                                  // jle	.LBB3_1
+	LEAQ     0(R12)(R10*1), CX // <--                                  // lea	rcx, [r12 + r10]
+	VPCMPEQB 0(CX), Z0, K1     // <--                                  // vpcmpeqb	k1, zmm0, zmmword ptr [rcx]
+	VPCMPEQB 0x40(CX), Z0, K2  // <--                                  // vpcmpeqb	k2, zmm0, zmmword ptr [rcx + 64]
+	VPCMPEQB 0x80(CX), Z0, K3  // <--                                  // vpcmpeqb	k3, zmm0, zmmword ptr [rcx + 128]
+	VPCMPEQB 0xc0(CX), Z0, K4  // <--                                  // vpcmpeqb	k4, zmm0, zmmword ptr [rcx + 192]
+	KMOVQ    K2, DX            // <--                                  // kmovq	rdx, k2
+	KMOVQ    K1, R15           // <--                                  // kmovq	r15, k1
+	ORQ      R15, DX           // <--                                  // or	rdx, r15
+	KMOVQ    K3, SI            // <--                                  // kmovq	rsi, k3
+	ORQ      SI, DX            // <--                                  // or	rdx, rsi
+	KMOVQ    K4, CX            // <--                                  // kmovq	rcx, k4
+	ORQ      CX, DX            // <--                                  // or	rdx, rcx
+	JE       LBB3_13           // <--                                  // je	.LBB3_13
+
+LBB3_1:
+	LEAQ       0x3f(R10), DX                        // <--                                  // lea	rdx, [r10 + 63]
+	CMPQ       R13, DX                              // <--                                  // cmp	r13, rdx
+	JG         LBB3_12                              // <--                                  // jg	.LBB3_12
+	CMPQ       R13, R10                             // <--                                  // cmp	r13, r10
+	JLE        LBB3_26                              // <--                                  // jle	.LBB3_26
+	MOVQ       R13, DX                              // <--                                  // mov	rdx, r13
+	MOVL       $0x1, SI                             // <--                                  // mov	esi, 1
+	SUBQ       R10, DX                              // <--                                  // sub	rdx, r10
+	MOVL       DX, CX                               // <--                                  // mov	ecx, edx
+	SHLQ       CX, SI                               // <--                                  // shl	rsi, cl
+	SUBQ       $0x1, SI                             // <--                                  // sub	rsi, 1
+	KMOVQ      SI, K1                               // <--                                  // kmovq	k1, rsi
+	VMOVDQU8.Z 0(R12)(R10*1), K1, Z1                // <--                                  // vmovdqu8	zmm1{k1}{z}, zmmword ptr [r12 + r10]
+	LONG       $0x4975f362; WORD $0xf03f; BYTE $0x0 // VPCMPEQB Z0, Z1, K1, K6              // vpcmpeqb	k6{k1}, zmm1, zmm0
+	KMOVQ      K6, R15                              // <--                                  // kmovq	r15, k6
+
+LBB3_2:
+	TESTQ R15, R15      // <--                                  // test	r15, r15
+	JE    LBB3_7        // <--                                  // je	.LBB3_7
+	MOVQ  R13, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], r13
+	KMOVD K7, K0        // <--                                  // kmovd	k0, k7
+	MOVQ  DX, 0x28(SP)  // <--                                  // mov	qword ptr [rsp + 40], rdx
+	MOVQ  AX, 0x38(SP)  // <--                                  // mov	qword ptr [rsp + 56], rax
+
+LBB3_3:
+	XORL    SI, SI          // <--                                  // xor	esi, esi
+	MOVQ    R9, CX          // <--                                  // mov	rcx, r9
+	MOVQ    R8, R13         // <--                                  // mov	r13, r8
+	TZCNTQ  R15, SI         // <--                                  // tzcnt	rsi, r15
+	MOVLQSX SI, SI          // <--                                  // movsxd	rsi, esi
+	ADDQ    R10, SI         // <--                                  // add	rsi, r10
+	LEAQ    0(BX)(SI*1), DX // <--                                  // lea	rdx, [rbx + rsi]
+	CMPQ    R9, $0x3f       // <--                                  // cmp	r9, 63
+	JLE     LBB3_9          // <--                                  // jle	.LBB3_9
+	MOVQ    0x38(SP), AX    // <--                                  // mov	rax, qword ptr [rsp + 56]
+	JMP     LBB3_5          // <--                                  // jmp	.LBB3_5
+
+LBB3_4:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, DX  // <--                                  // add	rdx, 64
+	ADDQ $0x40, R13 // <--                                  // add	r13, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB3_8     // <--                                  // jle	.LBB3_8
+
+LBB3_5:
+	VMOVDQU8 0(DX), Z5                    // <--                                  // vmovdqu8	zmm5, zmmword ptr [rdx]
+	LONG     $0x4855d362; LONG $0x4004d3f // VPCMPNEQB 0(R13), Z5, K1             // vpcmpneqb	k1, zmm5, zmmword ptr [r13 + 0]
+	KORTESTQ K1, K1                       // <--                                  // kortestq	k1, k1
+	JE       LBB3_4                       // <--                                  // je	.LBB3_4
+	MOVQ     AX, 0x38(SP)                 // <--                                  // mov	qword ptr [rsp + 56], rax
+
+LBB3_6:
+	MOVQ SI, DX        // <--                                  // mov	rdx, rsi
+	ADDQ $0x1, R11     // <--                                  // add	r11, 1
+	SARQ $0x8, DX      // <--                                  // sar	rdx, 8
+	ADDQ $0x4, DX      // <--                                  // add	rdx, 4
+	CMPQ R11, DX       // <--                                  // cmp	r11, rdx
+	JG   LBB3_14       // <--                                  // jg	.LBB3_14
+	LEAQ -0x1(R15), DX // <--                                  // lea	rdx, [r15 - 1]
+	ANDQ DX, R15       // <--                                  // and	r15, rdx
+	JNE  LBB3_3        // <--                                  // jne	.LBB3_3
+	MOVQ 0x30(SP), R13 // <--                                  // mov	r13, qword ptr [rsp + 48]
+	MOVQ 0x28(SP), DX  // <--                                  // mov	rdx, qword ptr [rsp + 40]
+	MOVQ 0x38(SP), AX  // <--                                  // mov	rax, qword ptr [rsp + 56]
+
+LBB3_7:
+	ADDQ DX, R10 // <--                                  // add	r10, rdx
+	JMP  LBB3_0  // <--                                  // jmp	.LBB3_0
+
+LBB3_8:
+	MOVQ  AX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rax
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB3_10      // <--                                  // je	.LBB3_10
+
+LBB3_9:
+	MOVQ       R14, AX                              // <--                                  // mov	rax, r14
+	SHLQ       CX, AX                               // <--                                  // shl	rax, cl
+	LEAQ       -0x1(AX), AX                         // <--                                  // lea	rax, [rax - 1]
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	VMOVDQU8.Z 0(DX), K1, Z1                        // <--                                  // vmovdqu8	zmm1{k1}{z}, zmmword ptr [rdx]
+	VMOVDQU8.Z 0(R13), K1, Z2                       // <--                                  // vmovdqu8	zmm2{k1}{z}, zmmword ptr [r13 + 0]
+	LONG       $0x4875f362; WORD $0xca3f; BYTE $0x4 // VPCMPNEQB Z2, Z1, K1                 // vpcmpneqb	k1, zmm1, zmm2
+	KORTESTQ   K1, K1                               // <--                                  // kortestq	k1, k1
+	JNE        LBB3_6                               // <--                                  // jne	.LBB3_6
+
+LBB3_10:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB3_11:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	MOVQ SI, AX         // <--                                  // mov	rax, rsi
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB3_12:
+	VPCMPEQB 0(R12)(R10*1), Z0, K5 // <--                                  // vpcmpeqb	k5, zmm0, zmmword ptr [r12 + r10]
+	MOVL     $0x40, DX             // <--                                  // mov	edx, 64
+	KMOVQ    K5, R15               // <--                                  // kmovq	r15, k5
+	JMP      LBB3_2                // <--                                  // jmp	.LBB3_2
+
+LBB3_13:
+	ADDQ $0x100, R10 // <--                                  // add	r10, 256
+	JMP  LBB3_0      // <--                                  // jmp	.LBB3_0
+
+LBB3_14:
+	MOVQ         0x38(SP), AX    // <--                                  // mov	rax, qword ptr [rsp + 56]
+	KMOVD        K0, R15         // <--                                  // kmovd	r15d, k0
+	LEAQ         0(BX)(DI*1), DX // <--                                  // lea	rdx, [rbx + rdi]
+	LEAQ         0x1(SI), R14    // <--                                  // lea	r14, [rsi + 1]
+	VPBROADCASTB R15, Z1         // <--                                  // vpbroadcastb	zmm1, r15d
+	XORL         R15, R15        // <--                                  // xor	r15d, r15d
+	CMPQ         R9, $0x3f       // <--                                  // cmp	r9, 63
+	MOVQ         DX, DI          // <--                                  // mov	rdi, rdx
+	SETLE        R15             // <--                                  // setle	r15b
+	MOVQ         0x30(SP), R13   // <--                                  // mov	r13, qword ptr [rsp + 48]
+	MOVQ         AX, 0x30(SP)    // <--                                  // mov	qword ptr [rsp + 48], rax
+	XORL         R11, R11        // <--                                  // xor	r11d, r11d
+	LEAQ         0x4(R15*4), R15 // <--                                  // lea	r15, [r15*4 + 4]
+	VMOVQ        R15, X7         // <--                                  // vmovq	xmm7, r15
+
+LBB3_15:
+	LEAQ     0x3f(R14), CX             // <--                                  // lea	rcx, [r14 + 63]
+	CMPQ     R13, CX                   // <--                                  // cmp	r13, rcx
+	JLE      LBB3_25                   // <--                                  // jle	.LBB3_25
+	VPCMPEQB 0(DI)(R14*1), Z1, K1      // <--                                  // vpcmpeqb	k1, zmm1, zmmword ptr [rdi + r14]
+	MOVL     $0x40, DX                 // <--                                  // mov	edx, 64
+	VPCMPEQB 0(R12)(R14*1), Z0, K1, K7 // <--                                  // vpcmpeqb	k7{k1}, zmm0, zmmword ptr [r12 + r14]
+	KMOVQ    K7, SI                    // <--                                  // kmovq	rsi, k7
+
+LBB3_16:
+	TESTQ SI, SI        // <--                                  // test	rsi, rsi
+	JE    LBB3_21       // <--                                  // je	.LBB3_21
+	MOVQ  R13, 0x28(SP) // <--                                  // mov	qword ptr [rsp + 40], r13
+	MOVQ  DX, R10       // <--                                  // mov	r10, rdx
+	VMOVQ X7, AX        // <--                                  // vmovq	rax, xmm7
+	MOVQ  DI, 0x38(SP)  // <--                                  // mov	qword ptr [rsp + 56], rdi
+
+LBB3_17:
+	XORL    DX, DX           // <--                                  // xor	edx, edx
+	MOVQ    R9, CX           // <--                                  // mov	rcx, r9
+	MOVQ    R8, R13          // <--                                  // mov	r13, r8
+	TZCNTQ  SI, DX           // <--                                  // tzcnt	rdx, rsi
+	MOVLQSX DX, DX           // <--                                  // movsxd	rdx, edx
+	ADDQ    R14, DX          // <--                                  // add	rdx, r14
+	LEAQ    0(BX)(DX*1), R15 // <--                                  // lea	r15, [rbx + rdx]
+	CMPQ    R9, $0x3f        // <--                                  // cmp	r9, 63
+	JLE     LBB3_23          // <--                                  // jle	.LBB3_23
+	MOVQ    0x38(SP), DI     // <--                                  // mov	rdi, qword ptr [rsp + 56]
+	JMP     LBB3_19          // <--                                  // jmp	.LBB3_19
+
+LBB3_18:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R15 // <--                                  // add	r15, 64
+	ADDQ $0x40, R13 // <--                                  // add	r13, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB3_22    // <--                                  // jle	.LBB3_22
+
+LBB3_19:
+	VMOVDQU8 0(R15), Z6                   // <--                                  // vmovdqu8	zmm6, zmmword ptr [r15]
+	LONG     $0x484dd362; LONG $0x400453f // VPCMPNEQB 0(R13), Z6, K0             // vpcmpneqb	k0, zmm6, zmmword ptr [r13 + 0]
+	KORTESTQ K0, K0                       // <--                                  // kortestq	k0, k0
+	JE       LBB3_18                      // <--                                  // je	.LBB3_18
+	MOVQ     DI, 0x38(SP)                 // <--                                  // mov	qword ptr [rsp + 56], rdi
+
+LBB3_20:
+	ADDQ $0x1, R11     // <--                                  // add	r11, 1
+	CMPQ R11, AX       // <--                                  // cmp	r11, rax
+	JG   LBB3_28       // <--                                  // jg	.LBB3_28
+	LEAQ -0x1(SI), DX  // <--                                  // lea	rdx, [rsi - 1]
+	ANDQ DX, SI        // <--                                  // and	rsi, rdx
+	JNE  LBB3_17       // <--                                  // jne	.LBB3_17
+	MOVQ 0x28(SP), R13 // <--                                  // mov	r13, qword ptr [rsp + 40]
+	MOVQ 0x38(SP), DI  // <--                                  // mov	rdi, qword ptr [rsp + 56]
+	MOVQ R10, DX       // <--                                  // mov	rdx, r10
+
+LBB3_21:
+	ADDQ DX, R14 // <--                                  // add	r14, rdx
+	JMP  LBB3_15 // <--                                  // jmp	.LBB3_15
+
+LBB3_22:
+	MOVQ  DI, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdi
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB3_24      // <--                                  // je	.LBB3_24
+
+LBB3_23:
+	MOVL       $0x1, DI                             // <--                                  // mov	edi, 1
+	SHLQ       CX, DI                               // <--                                  // shl	rdi, cl
+	LEAQ       -0x1(DI), DI                         // <--                                  // lea	rdi, [rdi - 1]
+	KMOVQ      DI, K1                               // <--                                  // kmovq	k1, rdi
+	VMOVDQU8.Z 0(R15), K1, Z3                       // <--                                  // vmovdqu8	zmm3{k1}{z}, zmmword ptr [r15]
+	VMOVDQU8.Z 0(R13), K1, Z4                       // <--                                  // vmovdqu8	zmm4{k1}{z}, zmmword ptr [r13 + 0]
+	LONG       $0x4865f362; WORD $0xc43f; BYTE $0x4 // VPCMPNEQB Z4, Z3, K0                 // vpcmpneqb	k0, zmm3, zmm4
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB3_20                              // <--                                  // jne	.LBB3_20
+
+LBB3_24:
+	MOVQ       DX, SI  // <--                                  // mov	rsi, rdx
+	VZEROUPPER         // <--                                  // vzeroupper
+	JMP        LBB3_11 // <--                                  // jmp	.LBB3_11
+
+LBB3_25:
+	CMPQ       R13, R14                             // <--                                  // cmp	r13, r14
+	JLE        LBB3_26                              // <--                                  // jle	.LBB3_26
+	MOVQ       R13, DX                              // <--                                  // mov	rdx, r13
+	MOVL       $0x1, SI                             // <--                                  // mov	esi, 1
+	SUBQ       R14, DX                              // <--                                  // sub	rdx, r14
+	MOVL       DX, CX                               // <--                                  // mov	ecx, edx
+	SHLQ       CX, SI                               // <--                                  // shl	rsi, cl
+	LEAQ       -0x1(SI), AX                         // <--                                  // lea	rax, [rsi - 1]
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	VMOVDQU8.Z 0(R12)(R14*1), K1, Z3                // <--                                  // vmovdqu8	zmm3{k1}{z}, zmmword ptr [r12 + r14]
+	LONG       $0x4965f362; WORD $0xc03f; BYTE $0x0 // VPCMPEQB Z0, Z3, K1, K0              // vpcmpeqb	k0{k1}, zmm3, zmm0
+	VMOVDQU8.Z 0(DI)(R14*1), K1, Z3                 // <--                                  // vmovdqu8	zmm3{k1}{z}, zmmword ptr [rdi + r14]
+	LONG       $0x4965f362; WORD $0xc93f; BYTE $0x0 // VPCMPEQB Z1, Z3, K1, K1              // vpcmpeqb	k1{k1}, zmm3, zmm1
+	KMOVQ      K0, AX                               // <--                                  // kmovq	rax, k0
+	KMOVQ      K1, SI                               // <--                                  // kmovq	rsi, k1
+	ANDQ       AX, SI                               // <--                                  // and	rsi, rax
+	JMP        LBB3_16                              // <--                                  // jmp	.LBB3_16
+
+LBB3_26:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB3_27:
+	MOVQ $-0x1, SI // <--                                  // mov	rsi, -1
+	JMP  LBB3_11   // <--                                  // jmp	.LBB3_11
+
+LBB3_28:
+	MOVQ 0x30(SP), AX     // <--                                  // mov	rax, qword ptr [rsp + 48]
+	MOVQ DX, SI           // <--                                  // mov	rsi, rdx
+	ADDQ $0x1, SI         // <--                                  // add	rsi, 1
+	SUBQ SI, AX           // <--                                  // sub	rax, rsi
+	LEAQ 0(BX)(SI*1), R11 // <--                                  // lea	r11, [rbx + rsi]
+	CMPQ R9, AX           // <--                                  // cmp	r9, rax
+	JG   LBB3_26          // <--                                  // jg	.LBB3_26
+	SUBQ R9, AX           // <--                                  // sub	rax, r9
+	MOVQ R9, DX           // <--                                  // mov	rdx, r9
+	MOVL $0x1000193, CX   // <--                                  // mov	ecx, 16777619
+	MOVL $0x1, R15        // <--                                  // mov	r15d, 1
+
+LBB3_29:
+	TESTB $0x1, DX // <--                                  // test	dl, 1
+	JE    LBB3_30  // <--                                  // je	.LBB3_30
+	IMULL CX, R15  // <--                                  // imul	r15d, ecx
+
+LBB3_30:
+	IMULL CX, CX   // <--                                  // imul	ecx, ecx
+	SHRQ  $0x1, DX // <--                                  // shr	rdx, 1
+	JNE   LBB3_29  // <--                                  // jne	.LBB3_29
+	XORL  DX, DX   // <--                                  // xor	edx, edx
+	XORL  R12, R12 // <--                                  // xor	r12d, r12d
+	XORL  R13, R13 // <--                                  // xor	r13d, r13d
+
+LBB3_31:
+	LONG    $0x93ed6945; WORD $0x1; BYTE $0x1 // IMULL $0x1000193, R13, R13           // imul	r13d, r13d, 16777619
+	MOVBLZX 0(R8)(R12*1), CX                  // <--                                  // movzx	ecx, byte ptr [r8 + r12]
+	LONG    $0x193d269; WORD $0x100           // IMULL $0x1000193, DX, DX             // imul	edx, edx, 16777619
+	ADDL    CX, R13                           // <--                                  // add	r13d, ecx
+	MOVBLZX 0(R11)(R12*1), CX                 // <--                                  // movzx	ecx, byte ptr [r11 + r12]
+	ADDQ    $0x1, R12                         // <--                                  // add	r12, 1
+	ADDL    CX, DX                            // <--                                  // add	edx, ecx
+	CMPQ    R9, R12                           // <--                                  // cmp	r9, r12
+	JNE     LBB3_31                           // <--                                  // jne	.LBB3_31
+	ADDQ    $0x1, AX                          // <--                                  // add	rax, 1
+	XORL    BX, BX                            // <--                                  // xor	ebx, ebx
+	JMP     LBB3_33                           // <--                                  // jmp	.LBB3_33
+
+LBB3_32:
+	ADDQ    $0x1, BX                // <--                                  // add	rbx, 1
+	CMPQ    BX, AX                  // <--                                  // cmp	rbx, rax
+	JE      LBB3_26                 // <--                                  // je	.LBB3_26
+	LONG    $0x193d269; WORD $0x100 // IMULL $0x1000193, DX, DX             // imul	edx, edx, 16777619
+	MOVBLZX 0(R11)(R9*1), CX        // <--                                  // movzx	ecx, byte ptr [r11 + r9]
+	ADDQ    $0x1, R11               // <--                                  // add	r11, 1
+	ADDL    CX, DX                  // <--                                  // add	edx, ecx
+	MOVBLZX -0x1(R11), CX           // <--                                  // movzx	ecx, byte ptr [r11 - 1]
+	IMULL   R15, CX                 // <--                                  // imul	ecx, r15d
+	SUBL    CX, DX                  // <--                                  // sub	edx, ecx
+
+LBB3_33:
+	CMPL R13, DX    // <--                                  // cmp	r13d, edx
+	JNE  LBB3_32    // <--                                  // jne	.LBB3_32
+	MOVQ R11, R10   // <--                                  // mov	r10, r11
+	CMPQ R12, $0x3f // <--                                  // cmp	r12, 63
+	JLE  LBB3_37    // <--                                  // jle	.LBB3_37
+	MOVQ R12, CX    // <--                                  // mov	rcx, r12
+	MOVQ R8, DI     // <--                                  // mov	rdi, r8
+
+LBB3_34:
+	VMOVDQU8 0(R10), Z7                          // <--                                  // vmovdqu8	zmm7, zmmword ptr [r10]
+	LONG     $0x4845f362; WORD $0x73f; BYTE $0x4 // VPCMPNEQB 0(DI), Z7, K0              // vpcmpneqb	k0, zmm7, zmmword ptr [rdi]
+	KORTESTQ K0, K0                              // <--                                  // kortestq	k0, k0
+	JNE      LBB3_32                             // <--                                  // jne	.LBB3_32
+	SUBQ     $0x40, CX                           // <--                                  // sub	rcx, 64
+	ADDQ     $0x40, R10                          // <--                                  // add	r10, 64
+	ADDQ     $0x40, DI                           // <--                                  // add	rdi, 64
+	CMPQ     CX, $0x3f                           // <--                                  // cmp	rcx, 63
+	JG       LBB3_34                             // <--                                  // jg	.LBB3_34
+	TESTQ    CX, CX                              // <--                                  // test	rcx, rcx
+	JE       LBB3_36                             // <--                                  // je	.LBB3_36
+
+LBB3_35:
+	MOVL       $0x1, R14                            // <--                                  // mov	r14d, 1
+	SHLQ       CX, R14                              // <--                                  // shl	r14, cl
+	LEAQ       -0x1(R14), CX                        // <--                                  // lea	rcx, [r14 - 1]
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(R10), K1, Z0                       // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r10]
+	VMOVDQU8.Z 0(DI), K1, Z1                        // <--                                  // vmovdqu8	zmm1{k1}{z}, zmmword ptr [rdi]
+	LONG       $0x487df362; WORD $0xc13f; BYTE $0x4 // VPCMPNEQB Z1, Z0, K0                 // vpcmpneqb	k0, zmm0, zmm1
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB3_32                              // <--                                  // jne	.LBB3_32
+
+LBB3_36:
+	ADDQ BX, SI  // <--                                  // add	rsi, rbx
+	JMP  LBB3_10 // <--                                  // jmp	.LBB3_10
+
+LBB3_37:
+	MOVQ R8, DI  // <--                                  // mov	rdi, r8
+	MOVQ R12, CX // <--                                  // mov	rcx, r12
+	JMP  LBB3_35 // <--                                  // jmp	.LBB3_35
+
+TEXT ·indexFoldAvx512(SB), NOSPLIT, $200-72
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	PUSHQ        BP              // <--                                  // push	rbp
+	MOVQ         DI, R10         // <--                                  // mov	r10, rdi
+	MOVQ         R9, DI          // <--                                  // mov	rdi, r9
+	MOVQ         SP, BP          // <--                                  // mov	rbp, rsp
+	PUSHQ        R15             // <--                                  // push	r15
+	PUSHQ        R14             // <--                                  // push	r14
+	PUSHQ        R13             // <--                                  // push	r13
+	PUSHQ        R12             // <--                                  // push	r12
+	PUSHQ        BX              // <--                                  // push	rbx
+	ANDQ         $-0x40, SP      // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP       // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R9    // <--                                  // mov	r9, qword ptr [rbp + 24]
+	MOVQ         0x10(BP), BX    // <--                                  // mov	rbx, qword ptr [rbp + 16]
+	CMPQ         SI, R9          // <--                                  // cmp	rsi, r9
+	JL           LBB4_36         // <--                                  // jl	.LBB4_36
+	MOVQ         SI, R15         // <--                                  // mov	r15, rsi
+	XORL         SI, SI          // <--                                  // xor	esi, esi
+	TESTQ        R9, R9          // <--                                  // test	r9, r9
+	JLE          LBB4_11         // <--                                  // jle	.LBB4_11
+	MOVQ         R15, AX         // <--                                  // mov	rax, r15
+	MOVQ         CX, R12         // <--                                  // mov	r12, rcx
+	LEAL         -0x61(DX), CX   // <--                                  // lea	ecx, [rdx - 97]
+	MOVL         R8, R14         // <--                                  // mov	r14d, r8d
+	SUBQ         R9, AX          // <--                                  // sub	rax, r9
+	VPBROADCASTB DX, Z5          // <--                                  // vpbroadcastb	zmm5, edx
+	MOVL         $0x20202020, DX // <--                                  // mov	edx, 538976288
+	MOVL         $0x1, R13       // <--                                  // mov	r13d, 1
+	ADDQ         $0x1, AX        // <--                                  // add	rax, 1
+	CMPB         CX, $0x19       // <--                                  // cmp	cl, 25
+	VPBROADCASTD DX, Z4          // <--                                  // vpbroadcastd	zmm4, edx
+	MOVL         $-0x61, DX      // <--                                  // mov	edx, -97
+	SETLS        CX              // <--                                  // setbe	cl
+	VPBROADCASTB DX, Z3          // <--                                  // vpbroadcastb	zmm3, edx
+	XORL         R8, R8          // <--                                  // xor	r8d, r8d
+	ADDQ         R10, R12        // <--                                  // add	r12, r10
+	MOVL         $0x1a, DX       // <--                                  // mov	edx, 26
+	SHLL         $0x5, CX        // <--                                  // shl	ecx, 5
+	XORL         R11, R11        // <--                                  // xor	r11d, r11d
+	VPBROADCASTB DX, Z2          // <--                                  // vpbroadcastb	zmm2, edx
+	VPBROADCASTB CX, Z6          // <--                                  // vpbroadcastb	zmm6, ecx
+	MOVQ         AX, DX          // <--                                  // mov	rdx, rax
+	MOVQ         R8, AX          // <--                                  // mov	rax, r8
+
+LBB4_0:
+	LEAQ  0xff(AX), CX                         // <--                                  // lea	rcx, [rax + 255]
+	CMPQ  DX, CX                               // <--                                  // cmp	rdx, rcx
+	JLE   LBB4_1                               // <--                                  // jle	.LBB4_1
+	LEAQ  0(R12)(AX*1), SI                     // <--                                  // lea	rsi, [r12 + rax]
+	VPORD 0(SI), Z6, Z0                        // <--                                  // vpord	zmm0, zmm6, zmmword ptr [rsi]
+	LONG  $0x487df362; WORD $0xc53f; BYTE $0x0 // VPCMPEQB Z5, Z0, K0                  // vpcmpeqb	k0, zmm0, zmm5
+	VPORD 0x40(SI), Z6, Z0                     // <--                                  // vpord	zmm0, zmm6, zmmword ptr [rsi + 64]
+	LONG  $0x487df362; WORD $0xcd3f; BYTE $0x0 // VPCMPEQB Z5, Z0, K1                  // vpcmpeqb	k1, zmm0, zmm5
+	VPORD 0x80(SI), Z6, Z0                     // <--                                  // vpord	zmm0, zmm6, zmmword ptr [rsi + 128]
+	LONG  $0x487df362; WORD $0xfd3f; BYTE $0x0 // VPCMPEQB Z5, Z0, K7                  // vpcmpeqb	k7, zmm0, zmm5
+	VPORD 0xc0(SI), Z6, Z0                     // <--                                  // vpord	zmm0, zmm6, zmmword ptr [rsi + 192]
+	KMOVQ K0, SI                               // <--                                  // kmovq	rsi, k0
+	KMOVQ K1, CX                               // <--                                  // kmovq	rcx, k1
+	ORQ   SI, CX                               // <--                                  // or	rcx, rsi
+	LONG  $0x487df362; WORD $0xed3f; BYTE $0x0 // VPCMPEQB Z5, Z0, K5                  // vpcmpeqb	k5, zmm0, zmm5
+	KMOVQ K7, R8                               // <--                                  // kmovq	r8, k7
+	ORQ   R8, CX                               // <--                                  // or	rcx, r8
+	KMOVQ K5, SI                               // <--                                  // kmovq	rsi, k5
+	ORQ   SI, CX                               // <--                                  // or	rcx, rsi
+	JE    LBB4_13                              // <--                                  // je	.LBB4_13
+
+LBB4_1:
+	LEAQ  0x3f(AX), CX                         // <--                                  // lea	rcx, [rax + 63]
+	CMPQ  DX, CX                               // <--                                  // cmp	rdx, rcx
+	JLE   LBB4_12                              // <--                                  // jle	.LBB4_12
+	VPORD 0(R12)(AX*1), Z6, Z0                 // <--                                  // vpord	zmm0, zmm6, zmmword ptr [r12 + rax]
+	LONG  $0x487d7162; WORD $0xc66f            // VMOVDQA32 Z6, Z8                     // vmovdqa32	zmm8, zmm6
+	MOVQ  $0x40, 0x20(SP)                      // <--                                  // mov	qword ptr [rsp + 32], 64
+	LONG  $0x487df362; WORD $0xf53f; BYTE $0x0 // VPCMPEQB Z5, Z0, K6                  // vpcmpeqb	k6, zmm0, zmm5
+	KMOVQ K6, R8                               // <--                                  // kmovq	r8, k6
+
+LBB4_2:
+	MOVL         $0x20, CX     // <--                                  // mov	ecx, 32
+	VPBROADCASTB CX, Z1        // <--                                  // vpbroadcastb	zmm1, ecx
+	TESTQ        R8, R8        // <--                                  // test	r8, r8
+	JE           LBB4_7        // <--                                  // je	.LBB4_7
+	MOVQ         DX, 0x30(SP)  // <--                                  // mov	qword ptr [rsp + 48], rdx
+	MOVQ         R12, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], r12
+	MOVQ         DI, 0x28(SP)  // <--                                  // mov	qword ptr [rsp + 40], rdi
+	MOVQ         AX, DI        // <--                                  // mov	rdi, rax
+	MOVQ         R8, AX        // <--                                  // mov	rax, r8
+
+LBB4_3:
+	XORL    SI, SI           // <--                                  // xor	esi, esi
+	MOVQ    R9, CX           // <--                                  // mov	rcx, r9
+	MOVQ    BX, R8           // <--                                  // mov	r8, rbx
+	TZCNTQ  AX, SI           // <--                                  // tzcnt	rsi, rax
+	MOVLQSX SI, SI           // <--                                  // movsxd	rsi, esi
+	ADDQ    DI, SI           // <--                                  // add	rsi, rdi
+	LEAQ    0(R10)(SI*1), DX // <--                                  // lea	rdx, [r10 + rsi]
+	CMPQ    R9, $0x3f        // <--                                  // cmp	r9, 63
+	JLE     LBB4_9           // <--                                  // jle	.LBB4_9
+	MOVQ    0x38(SP), R12    // <--                                  // mov	r12, qword ptr [rsp + 56]
+	JMP     LBB4_5           // <--                                  // jmp	.LBB4_5
+
+LBB4_4:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, DX // <--                                  // add	rdx, 64
+	ADDQ $0x40, R8 // <--                                  // add	r8, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB4_8    // <--                                  // jle	.LBB4_8
+
+LBB4_5:
+	VPORD     0(DX), Z4, Z0                        // <--                                  // vpord	zmm0, zmm4, zmmword ptr [rdx]
+	VMOVDQU32 0(R8), Z7                            // <--                                  // vmovdqu32	zmm7, zmmword ptr [r8]
+	VPADDB    Z3, Z0, Z0                           // <--                                  // vpaddb	zmm0, zmm0, zmm3
+	LONG      $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VPXORD    0(DX), Z7, Z0                        // <--                                  // vpxord	zmm0, zmm7, zmmword ptr [rdx]
+	LONG      $0x497df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K1, K0              // vpcmpeqb	k0{k1}, zmm0, zmm1
+	KNOTQ     K0, K0                               // <--                                  // knotq	k0, k0
+	KMOVQ     K0, K2                               // <--                                  // kmovq	k2, k0
+	VPTESTMB  Z0, Z0, K2, K0                       // <--                                  // vptestmb	k0{k2}, zmm0, zmm0
+	KORTESTQ  K0, K0                               // <--                                  // kortestq	k0, k0
+	JE        LBB4_4                               // <--                                  // je	.LBB4_4
+	MOVQ      R12, 0x38(SP)                        // <--                                  // mov	qword ptr [rsp + 56], r12
+
+LBB4_6:
+	MOVQ SI, DX        // <--                                  // mov	rdx, rsi
+	ADDQ $0x1, R11     // <--                                  // add	r11, 1
+	SARQ $0x8, DX      // <--                                  // sar	rdx, 8
+	ADDQ $0x4, DX      // <--                                  // add	rdx, 4
+	CMPQ R11, DX       // <--                                  // cmp	r11, rdx
+	JG   LBB4_14       // <--                                  // jg	.LBB4_14
+	LEAQ -0x1(AX), DX  // <--                                  // lea	rdx, [rax - 1]
+	ANDQ DX, AX        // <--                                  // and	rax, rdx
+	JNE  LBB4_3        // <--                                  // jne	.LBB4_3
+	MOVQ DI, AX        // <--                                  // mov	rax, rdi
+	MOVQ 0x30(SP), DX  // <--                                  // mov	rdx, qword ptr [rsp + 48]
+	MOVQ 0x38(SP), R12 // <--                                  // mov	r12, qword ptr [rsp + 56]
+	MOVQ 0x28(SP), DI  // <--                                  // mov	rdi, qword ptr [rsp + 40]
+
+LBB4_7:
+	MOVQ 0x20(SP), SI // <--                                  // mov	rsi, qword ptr [rsp + 32]
+	ADDQ SI, AX       // <--                                  // add	rax, rsi
+	JMP  LBB4_0       // <--                                  // jmp	.LBB4_0
+
+LBB4_8:
+	MOVQ  R12, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], r12
+	TESTQ CX, CX        // <--                                  // test	rcx, rcx
+	JE    LBB4_10       // <--                                  // je	.LBB4_10
+
+LBB4_9:
+	MOVQ       R13, R12                             // <--                                  // mov	r12, r13
+	SHLQ       CX, R12                              // <--                                  // shl	r12, cl
+	MOVQ       R12, CX                              // <--                                  // mov	rcx, r12
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(DX), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rdx]
+	VMOVDQU8.Z 0(R8), K1, Z7                        // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [r8]
+	VPORD      Z0, Z4, Z10                          // <--                                  // vpord	zmm10, zmm4, zmm0
+	VPXORD     Z7, Z0, Z0                           // <--                                  // vpxord	zmm0, zmm0, zmm7
+	VPADDB     Z3, Z10, Z11                         // <--                                  // vpaddb	zmm11, zmm10, zmm3
+	LONG       $0x4825f362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z11, K1                // vpcmpltub	k1, zmm11, zmm2
+	LONG       $0x497df362; WORD $0xc93f; BYTE $0x0 // VPCMPEQB Z1, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm1
+	KNOTQ      K1, K1                               // <--                                  // knotq	k1, k1
+	VPTESTMB   Z0, Z0, K1, K1                       // <--                                  // vptestmb	k1{k1}, zmm0, zmm0
+	KORTESTQ   K1, K1                               // <--                                  // kortestq	k1, k1
+	JNE        LBB4_6                               // <--                                  // jne	.LBB4_6
+
+LBB4_10:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB4_11:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	MOVQ SI, AX         // <--                                  // mov	rax, rsi
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB4_12:
+	CMPQ       DX, AX                               // <--                                  // cmp	rdx, rax
+	JLE        LBB4_35                              // <--                                  // jle	.LBB4_35
+	MOVQ       DX, SI                               // <--                                  // mov	rsi, rdx
+	MOVL       $0x1, R8                             // <--                                  // mov	r8d, 1
+	LONG       $0x487d7162; WORD $0xc66f            // VMOVDQA32 Z6, Z8                     // vmovdqa32	zmm8, zmm6
+	SUBQ       AX, SI                               // <--                                  // sub	rsi, rax
+	MOVL       SI, CX                               // <--                                  // mov	ecx, esi
+	MOVQ       SI, 0x20(SP)                         // <--                                  // mov	qword ptr [rsp + 32], rsi
+	SHLQ       CX, R8                               // <--                                  // shl	r8, cl
+	LEAQ       -0x1(R8), SI                         // <--                                  // lea	rsi, [r8 - 1]
+	KMOVQ      SI, K1                               // <--                                  // kmovq	k1, rsi
+	VMOVDQU8.Z 0(R12)(AX*1), K1, Z0                 // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r12 + rax]
+	VPORD      Z0, Z6, Z0                           // <--                                  // vpord	zmm0, zmm6, zmm0
+	LONG       $0x497df362; WORD $0xf53f; BYTE $0x0 // VPCMPEQB Z5, Z0, K1, K6              // vpcmpeqb	k6{k1}, zmm0, zmm5
+	KMOVQ      K6, R8                               // <--                                  // kmovq	r8, k6
+	JMP        LBB4_2                               // <--                                  // jmp	.LBB4_2
+
+LBB4_13:
+	ADDQ $0x100, AX // <--                                  // add	rax, 256
+	JMP  LBB4_0     // <--                                  // jmp	.LBB4_0
+
+LBB4_14:
+	LEAL         -0x61(R14), DX  // <--                                  // lea	edx, [r14 - 97]
+	MOVQ         0x28(SP), DI    // <--                                  // mov	rdi, qword ptr [rsp + 40]
+	MOVQ         0x30(SP), AX    // <--                                  // mov	rax, qword ptr [rsp + 48]
+	LEAQ         0x1(SI), R13    // <--                                  // lea	r13, [rsi + 1]
+	CMPB         DX, $0x19       // <--                                  // cmp	dl, 25
+	VPBROADCASTB R14, Z6         // <--                                  // vpbroadcastb	zmm6, r14d
+	MOVQ         R15, 0x28(SP)   // <--                                  // mov	qword ptr [rsp + 40], r15
+	MOVQ         0x38(SP), R12   // <--                                  // mov	r12, qword ptr [rsp + 56]
+	SETLS        DX              // <--                                  // setbe	dl
+	XORL         R14, R14        // <--                                  // xor	r14d, r14d
+	ADDQ         R10, DI         // <--                                  // add	rdi, r10
+	SHLL         $0x5, DX        // <--                                  // shl	edx, 5
+	CMPQ         R9, $0x3f       // <--                                  // cmp	r9, 63
+	VPBROADCASTB DX, Z9          // <--                                  // vpbroadcastb	zmm9, edx
+	MOVL         $0x20202020, DX // <--                                  // mov	edx, 538976288
+	SETLE        R14             // <--                                  // setle	r14b
+	XORL         R11, R11        // <--                                  // xor	r11d, r11d
+	VPBROADCASTD DX, Z4          // <--                                  // vpbroadcastd	zmm4, edx
+	MOVL         $-0x61, DX      // <--                                  // mov	edx, -97
+	LEAQ         0x4(R14*4), R14 // <--                                  // lea	r14, [r14*4 + 4]
+	VPBROADCASTB DX, Z3          // <--                                  // vpbroadcastb	zmm3, edx
+	MOVL         $0x1a, DX       // <--                                  // mov	edx, 26
+	VPBROADCASTB DX, Z2          // <--                                  // vpbroadcastb	zmm2, edx
+	MOVQ         AX, DX          // <--                                  // mov	rdx, rax
+	LEAQ         0x3f(R13), AX   // <--                                  // lea	rax, [r13 + 63]
+	CMPQ         DX, AX          // <--                                  // cmp	rdx, rax
+	JLE          LBB4_22         // <--                                  // jle	.LBB4_22
+
+LBB4_15:
+	VPORD 0(DI)(R13*1), Z9, Z1                 // <--                                  // vpord	zmm1, zmm9, zmmword ptr [rdi + r13]
+	VPORD 0(R12)(R13*1), Z8, Z0                // <--                                  // vpord	zmm0, zmm8, zmmword ptr [r12 + r13]
+	MOVL  $0x40, R15                           // <--                                  // mov	r15d, 64
+	LONG  $0x4875f362; WORD $0xce3f; BYTE $0x0 // VPCMPEQB Z6, Z1, K1                  // vpcmpeqb	k1, zmm1, zmm6
+	LONG  $0x497df362; WORD $0xfd3f; BYTE $0x0 // VPCMPEQB Z5, Z0, K1, K7              // vpcmpeqb	k7{k1}, zmm0, zmm5
+	KMOVQ K7, AX                               // <--                                  // kmovq	rax, k7
+
+LBB4_16:
+	MOVL         $0x20, CX     // <--                                  // mov	ecx, 32
+	VPBROADCASTB CX, Z1        // <--                                  // vpbroadcastb	zmm1, ecx
+	TESTQ        AX, AX        // <--                                  // test	rax, rax
+	JE           LBB4_21       // <--                                  // je	.LBB4_21
+	MOVQ         R15, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], r15
+	MOVQ         DI, R15       // <--                                  // mov	r15, rdi
+	MOVQ         DX, 0x38(SP)  // <--                                  // mov	qword ptr [rsp + 56], rdx
+	MOVQ         AX, DX        // <--                                  // mov	rdx, rax
+
+LBB4_17:
+	XORL    SI, SI           // <--                                  // xor	esi, esi
+	TZCNTQ  DX, SI           // <--                                  // tzcnt	rsi, rdx
+	MOVLQSX SI, SI           // <--                                  // movsxd	rsi, esi
+	ADDQ    R13, SI          // <--                                  // add	rsi, r13
+	LEAQ    0(R10)(SI*1), R8 // <--                                  // lea	r8, [r10 + rsi]
+	CMPQ    R9, $0x3f        // <--                                  // cmp	r9, 63
+	JLE     LBB4_34          // <--                                  // jle	.LBB4_34
+	MOVQ    0x38(SP), DI     // <--                                  // mov	rdi, qword ptr [rsp + 56]
+	MOVQ    R9, CX           // <--                                  // mov	rcx, r9
+	MOVQ    BX, AX           // <--                                  // mov	rax, rbx
+	JMP     LBB4_19          // <--                                  // jmp	.LBB4_19
+
+LBB4_18:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R8 // <--                                  // add	r8, 64
+	ADDQ $0x40, AX // <--                                  // add	rax, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB4_23   // <--                                  // jle	.LBB4_23
+
+LBB4_19:
+	VPORD     0(R8), Z4, Z0                        // <--                                  // vpord	zmm0, zmm4, zmmword ptr [r8]
+	VMOVDQU32 0(AX), Z7                            // <--                                  // vmovdqu32	zmm7, zmmword ptr [rax]
+	VPADDB    Z3, Z0, Z0                           // <--                                  // vpaddb	zmm0, zmm0, zmm3
+	LONG      $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VPXORD    0(R8), Z7, Z0                        // <--                                  // vpxord	zmm0, zmm7, zmmword ptr [r8]
+	LONG      $0x497df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K1, K0              // vpcmpeqb	k0{k1}, zmm0, zmm1
+	KNOTQ     K0, K0                               // <--                                  // knotq	k0, k0
+	KMOVQ     K0, K3                               // <--                                  // kmovq	k3, k0
+	VPTESTMB  Z0, Z0, K3, K0                       // <--                                  // vptestmb	k0{k3}, zmm0, zmm0
+	KORTESTQ  K0, K0                               // <--                                  // kortestq	k0, k0
+	JE        LBB4_18                              // <--                                  // je	.LBB4_18
+	ADDQ      $0x1, R11                            // <--                                  // add	r11, 1
+	MOVQ      DI, 0x38(SP)                         // <--                                  // mov	qword ptr [rsp + 56], rdi
+	CMPQ      R11, R14                             // <--                                  // cmp	r11, r14
+	JG        LBB4_25                              // <--                                  // jg	.LBB4_25
+
+LBB4_20:
+	LEAQ -0x1(DX), AX  // <--                                  // lea	rax, [rdx - 1]
+	ANDQ AX, DX        // <--                                  // and	rdx, rax
+	JNE  LBB4_17       // <--                                  // jne	.LBB4_17
+	MOVQ R15, DI       // <--                                  // mov	rdi, r15
+	MOVQ 0x38(SP), DX  // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVQ 0x30(SP), R15 // <--                                  // mov	r15, qword ptr [rsp + 48]
+
+LBB4_21:
+	ADDQ R15, R13      // <--                                  // add	r13, r15
+	LEAQ 0x3f(R13), AX // <--                                  // lea	rax, [r13 + 63]
+	CMPQ DX, AX        // <--                                  // cmp	rdx, rax
+	JG   LBB4_15       // <--                                  // jg	.LBB4_15
+
+LBB4_22:
+	CMPQ       DX, R13                              // <--                                  // cmp	rdx, r13
+	JLE        LBB4_35                              // <--                                  // jle	.LBB4_35
+	MOVQ       DX, R15                              // <--                                  // mov	r15, rdx
+	MOVL       $0x1, AX                             // <--                                  // mov	eax, 1
+	SUBQ       R13, R15                             // <--                                  // sub	r15, r13
+	MOVL       R15, CX                              // <--                                  // mov	ecx, r15d
+	SHLQ       CX, AX                               // <--                                  // shl	rax, cl
+	SUBQ       $0x1, AX                             // <--                                  // sub	rax, 1
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	VMOVDQU8.Z 0(R12)(R13*1), K1, Z0                // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r12 + r13]
+	VPORD      Z0, Z8, Z0                           // <--                                  // vpord	zmm0, zmm8, zmm0
+	LONG       $0x497df362; WORD $0xc53f; BYTE $0x0 // VPCMPEQB Z5, Z0, K1, K0              // vpcmpeqb	k0{k1}, zmm0, zmm5
+	VMOVDQU8.Z 0(DI)(R13*1), K1, Z0                 // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rdi + r13]
+	VPORD      Z9, Z0, Z0                           // <--                                  // vpord	zmm0, zmm0, zmm9
+	LONG       $0x497df362; WORD $0xce3f; BYTE $0x0 // VPCMPEQB Z6, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm6
+	KMOVQ      K0, SI                               // <--                                  // kmovq	rsi, k0
+	KMOVQ      K1, AX                               // <--                                  // kmovq	rax, k1
+	ANDQ       SI, AX                               // <--                                  // and	rax, rsi
+	JMP        LBB4_16                              // <--                                  // jmp	.LBB4_16
+
+LBB4_23:
+	MOVQ  DI, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdi
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB4_10      // <--                                  // je	.LBB4_10
+
+LBB4_24:
+	MOVL       $0x1, DI                             // <--                                  // mov	edi, 1
+	SHLQ       CX, DI                               // <--                                  // shl	rdi, cl
+	LEAQ       -0x1(DI), DI                         // <--                                  // lea	rdi, [rdi - 1]
+	KMOVQ      DI, K1                               // <--                                  // kmovq	k1, rdi
+	VMOVDQU8.Z 0(R8), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r8]
+	VMOVDQU8.Z 0(AX), K1, Z7                        // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [rax]
+	VPORD      Z0, Z4, Z12                          // <--                                  // vpord	zmm12, zmm4, zmm0
+	VPXORD     Z7, Z0, Z0                           // <--                                  // vpxord	zmm0, zmm0, zmm7
+	VPADDB     Z3, Z12, Z13                         // <--                                  // vpaddb	zmm13, zmm12, zmm3
+	LONG       $0x4815f362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z13, K1                // vpcmpltub	k1, zmm13, zmm2
+	LONG       $0x497df362; WORD $0xc93f; BYTE $0x0 // VPCMPEQB Z1, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm1
+	KNOTQ      K1, K1                               // <--                                  // knotq	k1, k1
+	VPTESTMB   Z0, Z0, K1, K1                       // <--                                  // vptestmb	k1{k1}, zmm0, zmm0
+	KORTESTQ   K1, K1                               // <--                                  // kortestq	k1, k1
+	JE         LBB4_10                              // <--                                  // je	.LBB4_10
+	ADDQ       $0x1, R11                            // <--                                  // add	r11, 1
+	CMPQ       R11, R14                             // <--                                  // cmp	r11, r14
+	JLE        LBB4_20                              // <--                                  // jle	.LBB4_20
+
+LBB4_25:
+	MOVQ 0x28(SP), R15    // <--                                  // mov	r15, qword ptr [rsp + 40]
+	ADDQ $0x1, SI         // <--                                  // add	rsi, 1
+	LEAQ 0(R10)(SI*1), R8 // <--                                  // lea	r8, [r10 + rsi]
+	SUBQ SI, R15          // <--                                  // sub	r15, rsi
+	MOVQ R15, R12         // <--                                  // mov	r12, r15
+	CMPQ R9, R15          // <--                                  // cmp	r9, r15
+	JG   LBB4_35          // <--                                  // jg	.LBB4_35
+	SUBQ R9, R12          // <--                                  // sub	r12, r9
+	MOVQ R9, AX           // <--                                  // mov	rax, r9
+	MOVL $0x1000193, DX   // <--                                  // mov	edx, 16777619
+	MOVL $0x1, R15        // <--                                  // mov	r15d, 1
+
+LBB4_26:
+	WORD  $0x1a8  // TESTB $0x1, AX                       // test	al, 1
+	JE    LBB4_27 // <--                                  // je	.LBB4_27
+	IMULL DX, R15 // <--                                  // imul	r15d, edx
+
+LBB4_27:
+	IMULL DX, DX   // <--                                  // imul	edx, edx
+	SHRQ  $0x1, AX // <--                                  // shr	rax, 1
+	JNE   LBB4_26  // <--                                  // jne	.LBB4_26
+	XORL  AX, AX   // <--                                  // xor	eax, eax
+	XORL  R14, R14 // <--                                  // xor	r14d, r14d
+	XORL  R11, R11 // <--                                  // xor	r11d, r11d
+
+LBB4_28:
+	MOVBLZX      0(BX)(R14*1), DX                  // <--                                  // movzx	edx, byte ptr [rbx + r14]
+	LONG         $0x93db6945; WORD $0x1; BYTE $0x1 // IMULL $0x1000193, R11, R11           // imul	r11d, r11d, 16777619
+	LEAL         -0x61(DX), DI                     // <--                                  // lea	edi, [rdx - 97]
+	LEAL         -0x20(DX), CX                     // <--                                  // lea	ecx, [rdx - 32]
+	CMPB         DI, $0x1a                         // <--                                  // cmp	dil, 26
+	CMOVLCS      CX, DX                            // <--                                  // cmovb	edx, ecx
+	MOVBLZX      DX, DX                            // <--                                  // movzx	edx, dl
+	ADDL         DX, R11                           // <--                                  // add	r11d, edx
+	LONG         $0x193d069; WORD $0x100           // IMULL $0x1000193, AX, DX             // imul	edx, eax, 16777619
+	MOVBLZX      0(R8)(R14*1), AX                  // <--                                  // movzx	eax, byte ptr [r8 + r14]
+	LEAL         -0x61(AX), DI                     // <--                                  // lea	edi, [rax - 97]
+	LEAL         -0x20(AX), CX                     // <--                                  // lea	ecx, [rax - 32]
+	CMPB         DI, $0x1a                         // <--                                  // cmp	dil, 26
+	CMOVLCS      CX, AX                            // <--                                  // cmovb	eax, ecx
+	ADDQ         $0x1, R14                         // <--                                  // add	r14, 1
+	MOVBLZX      AX, AX                            // <--                                  // movzx	eax, al
+	ADDL         DX, AX                            // <--                                  // add	eax, edx
+	CMPQ         R9, R14                           // <--                                  // cmp	r9, r14
+	JNE          LBB4_28                           // <--                                  // jne	.LBB4_28
+	MOVL         $0x20202020, DX                   // <--                                  // mov	edx, 538976288
+	MOVQ         SI, 0x38(SP)                      // <--                                  // mov	qword ptr [rsp + 56], rsi
+	ADDQ         $0x1, R12                         // <--                                  // add	r12, 1
+	XORL         R10, R10                          // <--                                  // xor	r10d, r10d
+	VPBROADCASTD DX, Z4                            // <--                                  // vpbroadcastd	zmm4, edx
+	MOVL         $-0x61, DX                        // <--                                  // mov	edx, -97
+	MOVL         $0x1, R13                         // <--                                  // mov	r13d, 1
+	VPBROADCASTB DX, Z3                            // <--                                  // vpbroadcastb	zmm3, edx
+	MOVL         $0x1a, DX                         // <--                                  // mov	edx, 26
+	VPBROADCASTB DX, Z2                            // <--                                  // vpbroadcastb	zmm2, edx
+	MOVL         $0x20, DX                         // <--                                  // mov	edx, 32
+	VPBROADCASTB DX, Z1                            // <--                                  // vpbroadcastb	zmm1, edx
+	JMP          LBB4_30                           // <--                                  // jmp	.LBB4_30
+
+LBB4_29:
+	ADDQ    $0x1, R10               // <--                                  // add	r10, 1
+	CMPQ    R10, R12                // <--                                  // cmp	r10, r12
+	JE      LBB4_35                 // <--                                  // je	.LBB4_35
+	MOVBLZX 0(R8), DX               // <--                                  // movzx	edx, byte ptr [r8]
+	LONG    $0x193c069; WORD $0x100 // IMULL $0x1000193, AX, AX             // imul	eax, eax, 16777619
+	LEAL    -0x61(DX), DI           // <--                                  // lea	edi, [rdx - 97]
+	LEAL    -0x20(DX), CX           // <--                                  // lea	ecx, [rdx - 32]
+	CMPB    DI, $0x1a               // <--                                  // cmp	dil, 26
+	CMOVLCS CX, DX                  // <--                                  // cmovb	edx, ecx
+	MOVBLZX DX, DX                  // <--                                  // movzx	edx, dl
+	IMULL   R15, DX                 // <--                                  // imul	edx, r15d
+	SUBL    DX, AX                  // <--                                  // sub	eax, edx
+	MOVBLZX 0(R8)(R9*1), DX         // <--                                  // movzx	edx, byte ptr [r8 + r9]
+	LEAL    -0x61(DX), DI           // <--                                  // lea	edi, [rdx - 97]
+	LEAL    -0x20(DX), CX           // <--                                  // lea	ecx, [rdx - 32]
+	CMPB    DI, $0x1a               // <--                                  // cmp	dil, 26
+	CMOVLCS CX, DX                  // <--                                  // cmovb	edx, ecx
+	ADDQ    $0x1, R8                // <--                                  // add	r8, 1
+	MOVBLZX DX, DX                  // <--                                  // movzx	edx, dl
+	ADDL    DX, AX                  // <--                                  // add	eax, edx
+
+LBB4_30:
+	CMPL R11, AX    // <--                                  // cmp	r11d, eax
+	JNE  LBB4_29    // <--                                  // jne	.LBB4_29
+	MOVQ R8, DI     // <--                                  // mov	rdi, r8
+	MOVQ R14, CX    // <--                                  // mov	rcx, r14
+	MOVQ BX, DX     // <--                                  // mov	rdx, rbx
+	CMPQ R14, $0x3f // <--                                  // cmp	r14, 63
+	JLE  LBB4_32    // <--                                  // jle	.LBB4_32
+
+LBB4_31:
+	VPORD     0(DI), Z4, Z0                        // <--                                  // vpord	zmm0, zmm4, zmmword ptr [rdi]
+	VMOVDQU32 0(DX), Z5                            // <--                                  // vmovdqu32	zmm5, zmmword ptr [rdx]
+	VPADDB    Z3, Z0, Z0                           // <--                                  // vpaddb	zmm0, zmm0, zmm3
+	LONG      $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VPXORD    0(DI), Z5, Z0                        // <--                                  // vpxord	zmm0, zmm5, zmmword ptr [rdi]
+	LONG      $0x497df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K1, K0              // vpcmpeqb	k0{k1}, zmm0, zmm1
+	KNOTQ     K0, K0                               // <--                                  // knotq	k0, k0
+	KMOVQ     K0, K4                               // <--                                  // kmovq	k4, k0
+	VPTESTMB  Z0, Z0, K4, K0                       // <--                                  // vptestmb	k0{k4}, zmm0, zmm0
+	KORTESTQ  K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE       LBB4_29                              // <--                                  // jne	.LBB4_29
+	SUBQ      $0x40, CX                            // <--                                  // sub	rcx, 64
+	ADDQ      $0x40, DI                            // <--                                  // add	rdi, 64
+	ADDQ      $0x40, DX                            // <--                                  // add	rdx, 64
+	CMPQ      CX, $0x3f                            // <--                                  // cmp	rcx, 63
+	JG        LBB4_31                              // <--                                  // jg	.LBB4_31
+	TESTQ     CX, CX                               // <--                                  // test	rcx, rcx
+	JE        LBB4_33                              // <--                                  // je	.LBB4_33
+
+LBB4_32:
+	MOVQ       R13, SI                              // <--                                  // mov	rsi, r13
+	SHLQ       CX, SI                               // <--                                  // shl	rsi, cl
+	LEAQ       -0x1(SI), SI                         // <--                                  // lea	rsi, [rsi - 1]
+	KMOVQ      SI, K1                               // <--                                  // kmovq	k1, rsi
+	VMOVDQU8.Z 0(DI), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rdi]
+	VMOVDQU8.Z 0(DX), K1, Z6                        // <--                                  // vmovdqu8	zmm6{k1}{z}, zmmword ptr [rdx]
+	VPORD      Z0, Z4, Z5                           // <--                                  // vpord	zmm5, zmm4, zmm0
+	VPXORD     Z6, Z0, Z0                           // <--                                  // vpxord	zmm0, zmm0, zmm6
+	VPADDB     Z3, Z5, Z5                           // <--                                  // vpaddb	zmm5, zmm5, zmm3
+	LONG       $0x4855f362; WORD $0xc23e; BYTE $0x1 // VPCMPLTUB Z2, Z5, K0                 // vpcmpltub	k0, zmm5, zmm2
+	KMOVQ      K0, K5                               // <--                                  // kmovq	k5, k0
+	LONG       $0x4d7df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K5, K0              // vpcmpeqb	k0{k5}, zmm0, zmm1
+	KNOTQ      K0, K0                               // <--                                  // knotq	k0, k0
+	KMOVQ      K0, K6                               // <--                                  // kmovq	k6, k0
+	VPTESTMB   Z0, Z0, K6, K0                       // <--                                  // vptestmb	k0{k6}, zmm0, zmm0
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB4_29                              // <--                                  // jne	.LBB4_29
+
+LBB4_33:
+	MOVQ 0x38(SP), SI // <--                                  // mov	rsi, qword ptr [rsp + 56]
+	ADDQ R10, SI      // <--                                  // add	rsi, r10
+	JMP  LBB4_10      // <--                                  // jmp	.LBB4_10
+
+LBB4_34:
+	MOVQ BX, AX  // <--                                  // mov	rax, rbx
+	MOVQ R9, CX  // <--                                  // mov	rcx, r9
+	JMP  LBB4_24 // <--                                  // jmp	.LBB4_24
+
+LBB4_35:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB4_36:
+	MOVQ $-0x1, SI // <--                                  // mov	rsi, -1
+	JMP  LBB4_11   // <--                                  // jmp	.LBB4_11
+
+TEXT ·searchNeedleFoldAvx512(SB), NOSPLIT, $200-72
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	PUSHQ        BP               // <--                                  // push	rbp
+	MOVQ         DI, R10          // <--                                  // mov	r10, rdi
+	MOVQ         R9, DI           // <--                                  // mov	rdi, r9
+	MOVQ         SP, BP           // <--                                  // mov	rbp, rsp
+	PUSHQ        R15              // <--                                  // push	r15
+	PUSHQ        R14              // <--                                  // push	r14
+	PUSHQ        R13              // <--                                  // push	r13
+	PUSHQ        R12              // <--                                  // push	r12
+	PUSHQ        BX               // <--                                  // push	rbx
+	ANDQ         $-0x40, SP       // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP        // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R9     // <--                                  // mov	r9, qword ptr [rbp + 24]
+	MOVQ         0x10(BP), R11    // <--                                  // mov	r11, qword ptr [rbp + 16]
+	CMPQ         SI, R9           // <--                                  // cmp	rsi, r9
+	JL           LBB5_36          // <--                                  // jl	.LBB5_36
+	MOVQ         SI, R15          // <--                                  // mov	r15, rsi
+	XORL         SI, SI           // <--                                  // xor	esi, esi
+	TESTQ        R9, R9           // <--                                  // test	r9, r9
+	JLE          LBB5_11          // <--                                  // jle	.LBB5_11
+	MOVQ         R15, AX          // <--                                  // mov	rax, r15
+	MOVQ         CX, BX           // <--                                  // mov	rbx, rcx
+	LEAL         -0x61(DX), CX    // <--                                  // lea	ecx, [rdx - 97]
+	MOVL         R8, R14          // <--                                  // mov	r14d, r8d
+	SUBQ         R9, AX           // <--                                  // sub	rax, r9
+	VPBROADCASTB DX, Z4           // <--                                  // vpbroadcastb	zmm4, edx
+	MOVL         $-0x41, DX       // <--                                  // mov	edx, -65
+	MOVL         $0x1, R13        // <--                                  // mov	r13d, 1
+	ADDQ         $0x1, AX         // <--                                  // add	rax, 1
+	CMPB         CX, $0x19        // <--                                  // cmp	cl, 25
+	VPBROADCASTB DX, Z3           // <--                                  // vpbroadcastb	zmm3, edx
+	MOVL         $0x1a, DX        // <--                                  // mov	edx, 26
+	SETLS        CX               // <--                                  // setbe	cl
+	VPBROADCASTB DX, Z2           // <--                                  // vpbroadcastb	zmm2, edx
+	LEAQ         0(R10)(BX*1), R8 // <--                                  // lea	r8, [r10 + rbx]
+	XORL         R12, R12         // <--                                  // xor	r12d, r12d
+	MOVL         $0x20, DX        // <--                                  // mov	edx, 32
+	SHLL         $0x5, CX         // <--                                  // shl	ecx, 5
+	VPBROADCASTB DX, Z1           // <--                                  // vpbroadcastb	zmm1, edx
+	VPBROADCASTB CX, Z5           // <--                                  // vpbroadcastb	zmm5, ecx
+	MOVQ         AX, DX           // <--                                  // mov	rdx, rax
+	MOVQ         R12, AX          // <--                                  // mov	rax, r12
+
+LBB5_0:
+	LEAQ  0xff(AX), CX                         // <--                                  // lea	rcx, [rax + 255]
+	CMPQ  DX, CX                               // <--                                  // cmp	rdx, rcx
+	JLE   LBB5_1                               // <--                                  // jle	.LBB5_1
+	LEAQ  0(R8)(AX*1), SI                      // <--                                  // lea	rsi, [r8 + rax]
+	VPORD 0(SI), Z5, Z0                        // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi]
+	LONG  $0x487df362; WORD $0xc43f; BYTE $0x0 // VPCMPEQB Z4, Z0, K0                  // vpcmpeqb	k0, zmm0, zmm4
+	VPORD 0x40(SI), Z5, Z0                     // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi + 64]
+	LONG  $0x487df362; WORD $0xcc3f; BYTE $0x0 // VPCMPEQB Z4, Z0, K1                  // vpcmpeqb	k1, zmm0, zmm4
+	VPORD 0x80(SI), Z5, Z0                     // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi + 128]
+	LONG  $0x487df362; WORD $0xd43f; BYTE $0x0 // VPCMPEQB Z4, Z0, K2                  // vpcmpeqb	k2, zmm0, zmm4
+	VPORD 0xc0(SI), Z5, Z0                     // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi + 192]
+	KMOVQ K0, SI                               // <--                                  // kmovq	rsi, k0
+	KMOVQ K1, CX                               // <--                                  // kmovq	rcx, k1
+	ORQ   SI, CX                               // <--                                  // or	rcx, rsi
+	LONG  $0x487df362; WORD $0xdc3f; BYTE $0x0 // VPCMPEQB Z4, Z0, K3                  // vpcmpeqb	k3, zmm0, zmm4
+	KMOVQ K2, BX                               // <--                                  // kmovq	rbx, k2
+	ORQ   BX, CX                               // <--                                  // or	rcx, rbx
+	KMOVQ K3, SI                               // <--                                  // kmovq	rsi, k3
+	ORQ   SI, CX                               // <--                                  // or	rcx, rsi
+	JE    LBB5_13                              // <--                                  // je	.LBB5_13
+
+LBB5_1:
+	LEAQ  0x3f(AX), CX                         // <--                                  // lea	rcx, [rax + 63]
+	CMPQ  DX, CX                               // <--                                  // cmp	rdx, rcx
+	JLE   LBB5_12                              // <--                                  // jle	.LBB5_12
+	VPORD 0(R8)(AX*1), Z5, Z0                  // <--                                  // vpord	zmm0, zmm5, zmmword ptr [r8 + rax]
+	LONG  $0x487d7162; WORD $0xc56f            // VMOVDQA32 Z5, Z8                     // vmovdqa32	zmm8, zmm5
+	MOVL  $0x40, CX                            // <--                                  // mov	ecx, 64
+	LONG  $0x487df362; WORD $0xe43f; BYTE $0x0 // VPCMPEQB Z4, Z0, K4                  // vpcmpeqb	k4, zmm0, zmm4
+	KMOVQ K4, BX                               // <--                                  // kmovq	rbx, k4
+
+LBB5_2:
+	TESTQ BX, BX       // <--                                  // test	rbx, rbx
+	JE    LBB5_7       // <--                                  // je	.LBB5_7
+	MOVQ  DX, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], rdx
+	MOVQ  R8, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], r8
+	MOVQ  CX, 0x20(SP) // <--                                  // mov	qword ptr [rsp + 32], rcx
+	MOVQ  DI, 0x28(SP) // <--                                  // mov	qword ptr [rsp + 40], rdi
+	MOVQ  AX, DI       // <--                                  // mov	rdi, rax
+	MOVQ  BX, AX       // <--                                  // mov	rax, rbx
+
+LBB5_3:
+	XORL    SI, SI           // <--                                  // xor	esi, esi
+	MOVQ    R9, CX           // <--                                  // mov	rcx, r9
+	MOVQ    R11, BX          // <--                                  // mov	rbx, r11
+	TZCNTQ  AX, SI           // <--                                  // tzcnt	rsi, rax
+	MOVLQSX SI, SI           // <--                                  // movsxd	rsi, esi
+	ADDQ    DI, SI           // <--                                  // add	rsi, rdi
+	LEAQ    0(R10)(SI*1), DX // <--                                  // lea	rdx, [r10 + rsi]
+	CMPQ    R9, $0x3f        // <--                                  // cmp	r9, 63
+	JLE     LBB5_9           // <--                                  // jle	.LBB5_9
+	MOVQ    0x38(SP), R8     // <--                                  // mov	r8, qword ptr [rsp + 56]
+	JMP     LBB5_5           // <--                                  // jmp	.LBB5_5
+
+LBB5_4:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, DX // <--                                  // add	rdx, 64
+	ADDQ $0x40, BX // <--                                  // add	rbx, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB5_8    // <--                                  // jle	.LBB5_8
+
+LBB5_5:
+	VPADDB   0(DX), Z3, Z0                        // <--                                  // vpaddb	zmm0, zmm3, zmmword ptr [rdx]
+	LONG     $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VMOVDQU8 0(DX), Z0                            // <--                                  // vmovdqu8	zmm0, zmmword ptr [rdx]
+	VPADDB   Z0, Z1, K1, Z0                       // <--                                  // vpaddb	zmm0{k1}, zmm1, zmm0
+	LONG     $0x487df362; WORD $0x33f; BYTE $0x4  // VPCMPNEQB 0(BX), Z0, K0              // vpcmpneqb	k0, zmm0, zmmword ptr [rbx]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JE       LBB5_4                               // <--                                  // je	.LBB5_4
+	MOVQ     R8, 0x38(SP)                         // <--                                  // mov	qword ptr [rsp + 56], r8
+
+LBB5_6:
+	MOVQ SI, DX       // <--                                  // mov	rdx, rsi
+	ADDQ $0x1, R12    // <--                                  // add	r12, 1
+	SARQ $0x8, DX     // <--                                  // sar	rdx, 8
+	ADDQ $0x4, DX     // <--                                  // add	rdx, 4
+	CMPQ R12, DX      // <--                                  // cmp	r12, rdx
+	JG   LBB5_14      // <--                                  // jg	.LBB5_14
+	LEAQ -0x1(AX), DX // <--                                  // lea	rdx, [rax - 1]
+	ANDQ DX, AX       // <--                                  // and	rax, rdx
+	JNE  LBB5_3       // <--                                  // jne	.LBB5_3
+	MOVQ DI, AX       // <--                                  // mov	rax, rdi
+	MOVQ 0x30(SP), DX // <--                                  // mov	rdx, qword ptr [rsp + 48]
+	MOVQ 0x38(SP), R8 // <--                                  // mov	r8, qword ptr [rsp + 56]
+	MOVQ 0x20(SP), CX // <--                                  // mov	rcx, qword ptr [rsp + 32]
+	MOVQ 0x28(SP), DI // <--                                  // mov	rdi, qword ptr [rsp + 40]
+
+LBB5_7:
+	ADDQ CX, AX // <--                                  // add	rax, rcx
+	JMP  LBB5_0 // <--                                  // jmp	.LBB5_0
+
+LBB5_8:
+	MOVQ  R8, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], r8
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB5_10      // <--                                  // je	.LBB5_10
+
+LBB5_9:
+	MOVQ       R13, R8                              // <--                                  // mov	r8, r13
+	SHLQ       CX, R8                               // <--                                  // shl	r8, cl
+	MOVQ       R8, CX                               // <--                                  // mov	rcx, r8
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(DX), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rdx]
+	VMOVDQU8.Z 0(BX), K1, Z7                        // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [rbx]
+	VPADDB     Z3, Z0, Z6                           // <--                                  // vpaddb	zmm6, zmm0, zmm3
+	LONG       $0x484df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z6, K1                 // vpcmpltub	k1, zmm6, zmm2
+	LONG       $0x48fdf162; WORD $0xf06f            // VMOVDQA64 Z0, Z6                     // vmovdqa64	zmm6, zmm0
+	VPADDB     Z1, Z0, K1, Z6                       // <--                                  // vpaddb	zmm6{k1}, zmm0, zmm1
+	LONG       $0x484df362; WORD $0xc73f; BYTE $0x4 // VPCMPNEQB Z7, Z6, K0                 // vpcmpneqb	k0, zmm6, zmm7
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB5_6                               // <--                                  // jne	.LBB5_6
+
+LBB5_10:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB5_11:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	MOVQ SI, AX         // <--                                  // mov	rax, rsi
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB5_12:
+	CMPQ       DX, AX                               // <--                                  // cmp	rdx, rax
+	JLE        LBB5_35                              // <--                                  // jle	.LBB5_35
+	MOVQ       DX, CX                               // <--                                  // mov	rcx, rdx
+	MOVL       $0x1, BX                             // <--                                  // mov	ebx, 1
+	LONG       $0x487d7162; WORD $0xc56f            // VMOVDQA32 Z5, Z8                     // vmovdqa32	zmm8, zmm5
+	SUBQ       AX, CX                               // <--                                  // sub	rcx, rax
+	SHLQ       CX, BX                               // <--                                  // shl	rbx, cl
+	LEAQ       -0x1(BX), SI                         // <--                                  // lea	rsi, [rbx - 1]
+	KMOVQ      SI, K1                               // <--                                  // kmovq	k1, rsi
+	VMOVDQU8.Z 0(R8)(AX*1), K1, Z0                  // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r8 + rax]
+	VPORD      Z0, Z5, Z0                           // <--                                  // vpord	zmm0, zmm5, zmm0
+	LONG       $0x497df362; WORD $0xec3f; BYTE $0x0 // VPCMPEQB Z4, Z0, K1, K5              // vpcmpeqb	k5{k1}, zmm0, zmm4
+	KMOVQ      K5, BX                               // <--                                  // kmovq	rbx, k5
+	JMP        LBB5_2                               // <--                                  // jmp	.LBB5_2
+
+LBB5_13:
+	ADDQ $0x100, AX // <--                                  // add	rax, 256
+	JMP  LBB5_0     // <--                                  // jmp	.LBB5_0
+
+LBB5_14:
+	LEAL         -0x61(R14), DX   // <--                                  // lea	edx, [r14 - 97]
+	MOVQ         0x30(SP), AX     // <--                                  // mov	rax, qword ptr [rsp + 48]
+	MOVQ         0x28(SP), DI     // <--                                  // mov	rdi, qword ptr [rsp + 40]
+	MOVL         $-0x41, CX       // <--                                  // mov	ecx, -65
+	CMPB         DX, $0x19        // <--                                  // cmp	dl, 25
+	LEAQ         0x1(SI), R12     // <--                                  // lea	r12, [rsi + 1]
+	MOVQ         R15, 0x20(SP)    // <--                                  // mov	qword ptr [rsp + 32], r15
+	VPBROADCASTB R14, Z0          // <--                                  // vpbroadcastb	zmm0, r14d
+	SETLS        DX               // <--                                  // setbe	dl
+	VPBROADCASTB CX, Z3           // <--                                  // vpbroadcastb	zmm3, ecx
+	XORL         R14, R14         // <--                                  // xor	r14d, r14d
+	MOVL         $0x1a, CX        // <--                                  // mov	ecx, 26
+	SHLL         $0x5, DX         // <--                                  // shl	edx, 5
+	CMPQ         R9, $0x3f        // <--                                  // cmp	r9, 63
+	VPBROADCASTB CX, Z2           // <--                                  // vpbroadcastb	zmm2, ecx
+	MOVL         $0x20, CX        // <--                                  // mov	ecx, 32
+	SETLE        R14              // <--                                  // setle	r14b
+	VPBROADCASTB DX, Z7           // <--                                  // vpbroadcastb	zmm7, edx
+	LEAQ         0(R10)(DI*1), DX // <--                                  // lea	rdx, [r10 + rdi]
+	XORL         BX, BX           // <--                                  // xor	ebx, ebx
+	MOVQ         AX, DI           // <--                                  // mov	rdi, rax
+	LEAQ         0x3f(R12), AX    // <--                                  // lea	rax, [r12 + 63]
+	MOVQ         0x38(SP), R8     // <--                                  // mov	r8, qword ptr [rsp + 56]
+	LEAQ         0x4(R14*4), R14  // <--                                  // lea	r14, [r14*4 + 4]
+	MOVL         $0x1, R13        // <--                                  // mov	r13d, 1
+	VPBROADCASTB CX, Z1           // <--                                  // vpbroadcastb	zmm1, ecx
+	CMPQ         DI, AX           // <--                                  // cmp	rdi, rax
+	JLE          LBB5_22          // <--                                  // jle	.LBB5_22
+
+LBB5_15:
+	VPORD 0(DX)(R12*1), Z7, Z9                 // <--                                  // vpord	zmm9, zmm7, zmmword ptr [rdx + r12]
+	VPORD 0(R8)(R12*1), Z8, Z6                 // <--                                  // vpord	zmm6, zmm8, zmmword ptr [r8 + r12]
+	MOVL  $0x40, CX                            // <--                                  // mov	ecx, 64
+	LONG  $0x4835f362; WORD $0xc83f; BYTE $0x0 // VPCMPEQB Z0, Z9, K1                  // vpcmpeqb	k1, zmm9, zmm0
+	LONG  $0x494df362; WORD $0xf43f; BYTE $0x0 // VPCMPEQB Z4, Z6, K1, K6              // vpcmpeqb	k6{k1}, zmm6, zmm4
+	KMOVQ K6, AX                               // <--                                  // kmovq	rax, k6
+
+LBB5_16:
+	TESTQ AX, AX       // <--                                  // test	rax, rax
+	JE    LBB5_21      // <--                                  // je	.LBB5_21
+	MOVQ  DI, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], rdi
+	MOVQ  DX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdx
+	MOVQ  CX, 0x28(SP) // <--                                  // mov	qword ptr [rsp + 40], rcx
+
+LBB5_17:
+	XORL    SI, SI           // <--                                  // xor	esi, esi
+	TZCNTQ  AX, SI           // <--                                  // tzcnt	rsi, rax
+	MOVLQSX SI, SI           // <--                                  // movsxd	rsi, esi
+	ADDQ    R12, SI          // <--                                  // add	rsi, r12
+	LEAQ    0(R10)(SI*1), DI // <--                                  // lea	rdi, [r10 + rsi]
+	CMPQ    R9, $0x3f        // <--                                  // cmp	r9, 63
+	JLE     LBB5_34          // <--                                  // jle	.LBB5_34
+	MOVQ    0x38(SP), DX     // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVQ    R9, CX           // <--                                  // mov	rcx, r9
+	MOVQ    R11, R15         // <--                                  // mov	r15, r11
+	JMP     LBB5_19          // <--                                  // jmp	.LBB5_19
+
+LBB5_18:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, DI  // <--                                  // add	rdi, 64
+	ADDQ $0x40, R15 // <--                                  // add	r15, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB5_23    // <--                                  // jle	.LBB5_23
+
+LBB5_19:
+	VPADDB   0(DI), Z3, Z6                        // <--                                  // vpaddb	zmm6, zmm3, zmmword ptr [rdi]
+	VMOVDQU8 0(DI), Z5                            // <--                                  // vmovdqu8	zmm5, zmmword ptr [rdi]
+	LONG     $0x484df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z6, K1                 // vpcmpltub	k1, zmm6, zmm2
+	VPADDB   Z5, Z1, K1, Z5                       // <--                                  // vpaddb	zmm5{k1}, zmm1, zmm5
+	LONG     $0x4855d362; WORD $0x73f; BYTE $0x4  // VPCMPNEQB 0(R15), Z5, K0             // vpcmpneqb	k0, zmm5, zmmword ptr [r15]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JE       LBB5_18                              // <--                                  // je	.LBB5_18
+	ADDQ     $0x1, BX                             // <--                                  // add	rbx, 1
+	MOVQ     DX, 0x38(SP)                         // <--                                  // mov	qword ptr [rsp + 56], rdx
+	CMPQ     BX, R14                              // <--                                  // cmp	rbx, r14
+	JG       LBB5_25                              // <--                                  // jg	.LBB5_25
+
+LBB5_20:
+	LEAQ -0x1(AX), CX // <--                                  // lea	rcx, [rax - 1]
+	ANDQ CX, AX       // <--                                  // and	rax, rcx
+	JNE  LBB5_17      // <--                                  // jne	.LBB5_17
+	MOVQ 0x30(SP), DI // <--                                  // mov	rdi, qword ptr [rsp + 48]
+	MOVQ 0x38(SP), DX // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVQ 0x28(SP), CX // <--                                  // mov	rcx, qword ptr [rsp + 40]
+
+LBB5_21:
+	ADDQ CX, R12       // <--                                  // add	r12, rcx
+	LEAQ 0x3f(R12), AX // <--                                  // lea	rax, [r12 + 63]
+	CMPQ DI, AX        // <--                                  // cmp	rdi, rax
+	JG   LBB5_15       // <--                                  // jg	.LBB5_15
+
+LBB5_22:
+	CMPQ       DI, R12                              // <--                                  // cmp	rdi, r12
+	JLE        LBB5_35                              // <--                                  // jle	.LBB5_35
+	MOVQ       DI, CX                               // <--                                  // mov	rcx, rdi
+	MOVL       $0x1, AX                             // <--                                  // mov	eax, 1
+	SUBQ       R12, CX                              // <--                                  // sub	rcx, r12
+	SHLQ       CX, AX                               // <--                                  // shl	rax, cl
+	SUBQ       $0x1, AX                             // <--                                  // sub	rax, 1
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	VMOVDQU8.Z 0(R8)(R12*1), K1, Z6                 // <--                                  // vmovdqu8	zmm6{k1}{z}, zmmword ptr [r8 + r12]
+	VPORD      Z6, Z8, Z6                           // <--                                  // vpord	zmm6, zmm8, zmm6
+	LONG       $0x494df362; WORD $0xc43f; BYTE $0x0 // VPCMPEQB Z4, Z6, K1, K0              // vpcmpeqb	k0{k1}, zmm6, zmm4
+	VMOVDQU8.Z 0(DX)(R12*1), K1, Z6                 // <--                                  // vmovdqu8	zmm6{k1}{z}, zmmword ptr [rdx + r12]
+	VPORD      Z7, Z6, Z6                           // <--                                  // vpord	zmm6, zmm6, zmm7
+	LONG       $0x494df362; WORD $0xc83f; BYTE $0x0 // VPCMPEQB Z0, Z6, K1, K1              // vpcmpeqb	k1{k1}, zmm6, zmm0
+	KMOVQ      K0, SI                               // <--                                  // kmovq	rsi, k0
+	KMOVQ      K1, AX                               // <--                                  // kmovq	rax, k1
+	ANDQ       SI, AX                               // <--                                  // and	rax, rsi
+	JMP        LBB5_16                              // <--                                  // jmp	.LBB5_16
+
+LBB5_23:
+	MOVQ  DX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdx
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB5_10      // <--                                  // je	.LBB5_10
+
+LBB5_24:
+	MOVQ       R13, DX                              // <--                                  // mov	rdx, r13
+	SHLQ       CX, DX                               // <--                                  // shl	rdx, cl
+	MOVQ       DX, CX                               // <--                                  // mov	rcx, rdx
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(DI), K1, Z5                        // <--                                  // vmovdqu8	zmm5{k1}{z}, zmmword ptr [rdi]
+	VMOVDQU8.Z 0(R15), K1, Z10                      // <--                                  // vmovdqu8	zmm10{k1}{z}, zmmword ptr [r15]
+	VPADDB     Z3, Z5, Z6                           // <--                                  // vpaddb	zmm6, zmm5, zmm3
+	LONG       $0x484df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z6, K1                 // vpcmpltub	k1, zmm6, zmm2
+	LONG       $0x48fdf162; WORD $0xf56f            // VMOVDQA64 Z5, Z6                     // vmovdqa64	zmm6, zmm5
+	VPADDB     Z1, Z5, K1, Z6                       // <--                                  // vpaddb	zmm6{k1}, zmm5, zmm1
+	LONG       $0x484dd362; WORD $0xc23f; BYTE $0x4 // VPCMPNEQB Z10, Z6, K0                // vpcmpneqb	k0, zmm6, zmm10
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JE         LBB5_10                              // <--                                  // je	.LBB5_10
+	ADDQ       $0x1, BX                             // <--                                  // add	rbx, 1
+	CMPQ       BX, R14                              // <--                                  // cmp	rbx, r14
+	JLE        LBB5_20                              // <--                                  // jle	.LBB5_20
+
+LBB5_25:
+	MOVQ 0x20(SP), R15    // <--                                  // mov	r15, qword ptr [rsp + 32]
+	ADDQ $0x1, SI         // <--                                  // add	rsi, 1
+	LEAQ 0(R10)(SI*1), DI // <--                                  // lea	rdi, [r10 + rsi]
+	SUBQ SI, R15          // <--                                  // sub	r15, rsi
+	CMPQ R9, R15          // <--                                  // cmp	r9, r15
+	JG   LBB5_35          // <--                                  // jg	.LBB5_35
+	MOVQ R15, BX          // <--                                  // mov	rbx, r15
+	MOVQ R9, AX           // <--                                  // mov	rax, r9
+	MOVL $0x1000193, DX   // <--                                  // mov	edx, 16777619
+	MOVL $0x1, R15        // <--                                  // mov	r15d, 1
+	SUBQ R9, BX           // <--                                  // sub	rbx, r9
+
+LBB5_26:
+	WORD  $0x1a8  // TESTB $0x1, AX                       // test	al, 1
+	JE    LBB5_27 // <--                                  // je	.LBB5_27
+	IMULL DX, R15 // <--                                  // imul	r15d, edx
+
+LBB5_27:
+	IMULL DX, DX   // <--                                  // imul	edx, edx
+	SHRQ  $0x1, AX // <--                                  // shr	rax, 1
+	JNE   LBB5_26  // <--                                  // jne	.LBB5_26
+	XORL  AX, AX   // <--                                  // xor	eax, eax
+	XORL  R13, R13 // <--                                  // xor	r13d, r13d
+	XORL  R8, R8   // <--                                  // xor	r8d, r8d
+
+LBB5_28:
+	LONG         $0x93c06945; WORD $0x1; BYTE $0x1 // IMULL $0x1000193, R8, R8             // imul	r8d, r8d, 16777619
+	MOVBLZX      0(R11)(R13*1), DX                 // <--                                  // movzx	edx, byte ptr [r11 + r13]
+	ADDL         DX, R8                            // <--                                  // add	r8d, edx
+	LONG         $0x193d069; WORD $0x100           // IMULL $0x1000193, AX, DX             // imul	edx, eax, 16777619
+	MOVBLZX      0(DI)(R13*1), AX                  // <--                                  // movzx	eax, byte ptr [rdi + r13]
+	LEAL         -0x41(AX), R10                    // <--                                  // lea	r10d, [rax - 65]
+	LEAL         0x20(AX), CX                      // <--                                  // lea	ecx, [rax + 32]
+	CMPB         R10, $0x1a                        // <--                                  // cmp	r10b, 26
+	CMOVLCS      CX, AX                            // <--                                  // cmovb	eax, ecx
+	ADDQ         $0x1, R13                         // <--                                  // add	r13, 1
+	MOVBLZX      AX, AX                            // <--                                  // movzx	eax, al
+	ADDL         DX, AX                            // <--                                  // add	eax, edx
+	CMPQ         R9, R13                           // <--                                  // cmp	r9, r13
+	JNE          LBB5_28                           // <--                                  // jne	.LBB5_28
+	MOVL         $-0x41, DX                        // <--                                  // mov	edx, -65
+	MOVQ         SI, 0x38(SP)                      // <--                                  // mov	qword ptr [rsp + 56], rsi
+	ADDQ         $0x1, BX                          // <--                                  // add	rbx, 1
+	XORL         R10, R10                          // <--                                  // xor	r10d, r10d
+	VPBROADCASTB DX, Z3                            // <--                                  // vpbroadcastb	zmm3, edx
+	MOVL         $0x1a, DX                         // <--                                  // mov	edx, 26
+	MOVL         $0x1, R12                         // <--                                  // mov	r12d, 1
+	VPBROADCASTB DX, Z2                            // <--                                  // vpbroadcastb	zmm2, edx
+	MOVL         $0x20, DX                         // <--                                  // mov	edx, 32
+	VPBROADCASTB DX, Z1                            // <--                                  // vpbroadcastb	zmm1, edx
+	JMP          LBB5_30                           // <--                                  // jmp	.LBB5_30
+
+LBB5_29:
+	ADDQ    $0x1, R10               // <--                                  // add	r10, 1
+	CMPQ    R10, BX                 // <--                                  // cmp	r10, rbx
+	JE      LBB5_35                 // <--                                  // je	.LBB5_35
+	LONG    $0x193d069; WORD $0x100 // IMULL $0x1000193, AX, DX             // imul	edx, eax, 16777619
+	MOVBLZX 0(DI), AX               // <--                                  // movzx	eax, byte ptr [rdi]
+	LEAL    -0x41(AX), R14          // <--                                  // lea	r14d, [rax - 65]
+	LEAL    0x20(AX), CX            // <--                                  // lea	ecx, [rax + 32]
+	CMPB    R14, $0x1a              // <--                                  // cmp	r14b, 26
+	CMOVLCS CX, AX                  // <--                                  // cmovb	eax, ecx
+	MOVBLZX AX, AX                  // <--                                  // movzx	eax, al
+	IMULL   R15, AX                 // <--                                  // imul	eax, r15d
+	SUBL    AX, DX                  // <--                                  // sub	edx, eax
+	MOVBLZX 0(DI)(R9*1), AX         // <--                                  // movzx	eax, byte ptr [rdi + r9]
+	LEAL    -0x41(AX), R14          // <--                                  // lea	r14d, [rax - 65]
+	LEAL    0x20(AX), CX            // <--                                  // lea	ecx, [rax + 32]
+	CMPB    R14, $0x1a              // <--                                  // cmp	r14b, 26
+	CMOVLCS CX, AX                  // <--                                  // cmovb	eax, ecx
+	ADDQ    $0x1, DI                // <--                                  // add	rdi, 1
+	MOVBLZX AX, AX                  // <--                                  // movzx	eax, al
+	ADDL    DX, AX                  // <--                                  // add	eax, edx
+
+LBB5_30:
+	CMPL R8, AX     // <--                                  // cmp	r8d, eax
+	JNE  LBB5_29    // <--                                  // jne	.LBB5_29
+	MOVQ DI, R14    // <--                                  // mov	r14, rdi
+	MOVQ R13, CX    // <--                                  // mov	rcx, r13
+	MOVQ R11, DX    // <--                                  // mov	rdx, r11
+	CMPQ R13, $0x3f // <--                                  // cmp	r13, 63
+	JLE  LBB5_32    // <--                                  // jle	.LBB5_32
+
+LBB5_31:
+	VPADDB   0(R14), Z3, Z0                       // <--                                  // vpaddb	zmm0, zmm3, zmmword ptr [r14]
+	LONG     $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VMOVDQU8 0(R14), Z0                           // <--                                  // vmovdqu8	zmm0, zmmword ptr [r14]
+	VPADDB   Z0, Z1, K1, Z0                       // <--                                  // vpaddb	zmm0{k1}, zmm1, zmm0
+	LONG     $0x487df362; WORD $0x23f; BYTE $0x4  // VPCMPNEQB 0(DX), Z0, K0              // vpcmpneqb	k0, zmm0, zmmword ptr [rdx]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE      LBB5_29                              // <--                                  // jne	.LBB5_29
+	SUBQ     $0x40, CX                            // <--                                  // sub	rcx, 64
+	ADDQ     $0x40, R14                           // <--                                  // add	r14, 64
+	ADDQ     $0x40, DX                            // <--                                  // add	rdx, 64
+	CMPQ     CX, $0x3f                            // <--                                  // cmp	rcx, 63
+	JG       LBB5_31                              // <--                                  // jg	.LBB5_31
+	TESTQ    CX, CX                               // <--                                  // test	rcx, rcx
+	JE       LBB5_33                              // <--                                  // je	.LBB5_33
+
+LBB5_32:
+	MOVQ       R12, SI                              // <--                                  // mov	rsi, r12
+	SHLQ       CX, SI                               // <--                                  // shl	rsi, cl
+	LEAQ       -0x1(SI), SI                         // <--                                  // lea	rsi, [rsi - 1]
+	KMOVQ      SI, K1                               // <--                                  // kmovq	k1, rsi
+	VMOVDQU8.Z 0(R14), K1, Z0                       // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r14]
+	VMOVDQU8.Z 0(DX), K1, Z5                        // <--                                  // vmovdqu8	zmm5{k1}{z}, zmmword ptr [rdx]
+	VPADDB     Z3, Z0, Z4                           // <--                                  // vpaddb	zmm4, zmm0, zmm3
+	LONG       $0x485df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z4, K1                 // vpcmpltub	k1, zmm4, zmm2
+	LONG       $0x48fdf162; WORD $0xe06f            // VMOVDQA64 Z0, Z4                     // vmovdqa64	zmm4, zmm0
+	VPADDB     Z1, Z0, K1, Z4                       // <--                                  // vpaddb	zmm4{k1}, zmm0, zmm1
+	LONG       $0x485df362; WORD $0xc53f; BYTE $0x4 // VPCMPNEQB Z5, Z4, K0                 // vpcmpneqb	k0, zmm4, zmm5
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB5_29                              // <--                                  // jne	.LBB5_29
+
+LBB5_33:
+	MOVQ 0x38(SP), SI // <--                                  // mov	rsi, qword ptr [rsp + 56]
+	ADDQ R10, SI      // <--                                  // add	rsi, r10
+	JMP  LBB5_10      // <--                                  // jmp	.LBB5_10
+
+LBB5_34:
+	MOVQ R11, R15 // <--                                  // mov	r15, r11
+	MOVQ R9, CX   // <--                                  // mov	rcx, r9
+	JMP  LBB5_24  // <--                                  // jmp	.LBB5_24
+
+LBB5_35:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB5_36:
+	MOVQ $-0x1, SI // <--                                  // mov	rsi, -1
+	JMP  LBB5_11   // <--                                  // jmp	.LBB5_11
+
+TEXT ·indexAllExactAvx512(SB), NOSPLIT, $224-96
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	MOVQ         out+64(FP), AX
+	MOVQ         AX, 24(SP)
+	MOVQ         out_len+72(FP), AX
+	MOVQ         AX, 32(SP)
+	MOVQ         out_cap+80(FP), AX
+	MOVQ         AX, 40(SP)
+	PUSHQ        BP            // <--                                  // push	rbp
+	MOVQ         R9, AX        // <--                                  // mov	rax, r9
+	MOVQ         SP, BP        // <--                                  // mov	rbp, rsp
+	PUSHQ        R15           // <--                                  // push	r15
+	PUSHQ        R14           // <--                                  // push	r14
+	PUSHQ        R13           // <--                                  // push	r13
+	PUSHQ        R12           // <--                                  // push	r12
+	PUSHQ        BX            // <--                                  // push	rbx
+	ANDQ         $-0x40, SP    // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP     // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R9  // <--                                  // mov	r9, qword ptr [rbp + 24]
+	MOVQ         0x10(BP), R11 // <--                                  // mov	r11, qword ptr [rbp + 16]
+	MOVQ         SI, 0x18(SP)  // <--                                  // mov	qword ptr [rsp + 24], rsi
+	CMPQ         SI, R9        // <--                                  // cmp	rsi, r9
+	JL           LBB6_8        // <--                                  // jl	.LBB6_8
+	TESTQ        R9, R9        // <--                                  // test	r9, r9
+	JLE          LBB6_8        // <--                                  // jle	.LBB6_8
+	SUBQ         R9, SI        // <--                                  // sub	rsi, r9
+	MOVL         R8, R10       // <--                                  // mov	r10d, r8d
+	MOVQ         CX, R13       // <--                                  // mov	r13, rcx
+	XORL         R15, R15      // <--                                  // xor	r15d, r15d
+	MOVQ         SI, R12       // <--                                  // mov	r12, rsi
+	MOVQ         AX, 0x28(SP)  // <--                                  // mov	qword ptr [rsp + 40], rax
+	VPBROADCASTB DX, Z1        // <--                                  // vpbroadcastb	zmm1, edx
+	ADDQ         DI, R13       // <--                                  // add	r13, rdi
+	KMOVD        R10, K0       // <--                                  // kmovd	k0, r10d
+	ADDQ         $0x1, R12     // <--                                  // add	r12, 1
+	XORL         DX, DX        // <--                                  // xor	edx, edx
+	MOVQ         DI, R10       // <--                                  // mov	r10, rdi
+	MOVL         $0x1, R8      // <--                                  // mov	r8d, 1
+	MOVQ         R15, AX       // <--                                  // mov	rax, r15
+
+LBB6_0:
+	LEAQ 0xff(R15), CX // <--                                  // lea	rcx, [r15 + 255]
+	CMPQ R12, CX       // <--                                  // cmp	r12, rcx
+	JLE  LBB6_2        // <--                                  // jle	.LBB6_2
+
+LBB6_1:
+	LEAQ     0(R13)(R15*1), SI // <--                                  // lea	rsi, [r13 + r15 + 0]
+	VPCMPEQB 0(SI), Z1, K1     // <--                                  // vpcmpeqb	k1, zmm1, zmmword ptr [rsi]
+	VPCMPEQB 0x40(SI), Z1, K2  // <--                                  // vpcmpeqb	k2, zmm1, zmmword ptr [rsi + 64]
+	VPCMPEQB 0x80(SI), Z1, K3  // <--                                  // vpcmpeqb	k3, zmm1, zmmword ptr [rsi + 128]
+	VPCMPEQB 0xc0(SI), Z1, K4  // <--                                  // vpcmpeqb	k4, zmm1, zmmword ptr [rsi + 192]
+	KMOVQ    K2, CX            // <--                                  // kmovq	rcx, k2
+	KMOVQ    K1, BX            // <--                                  // kmovq	rbx, k1
+	ORQ      BX, CX            // <--                                  // or	rcx, rbx
+	KMOVQ    K3, DI            // <--                                  // kmovq	rdi, k3
+	ORQ      DI, CX            // <--                                  // or	rcx, rdi
+	KMOVQ    K4, SI            // <--                                  // kmovq	rsi, k4
+	ORQ      SI, CX            // <--                                  // or	rcx, rsi
+	JNE      LBB6_2            // <--                                  // jne	.LBB6_2
+	ADDQ     $0x100, R15       // <--                                  // add	r15, 256
+	LEAQ     0xff(R15), CX     // <--                                  // lea	rcx, [r15 + 255]
+	CMPQ     R12, CX           // <--                                  // cmp	r12, rcx
+	JG       LBB6_1            // <--                                  // jg	.LBB6_1
+
+LBB6_2:
+	LEAQ     0x3f(R15), CX         // <--                                  // lea	rcx, [r15 + 63]
+	CMPQ     R12, CX               // <--                                  // cmp	r12, rcx
+	JLE      LBB6_14               // <--                                  // jle	.LBB6_14
+	VPCMPEQB 0(R13)(R15*1), Z1, K5 // <--                                  // vpcmpeqb	k5, zmm1, zmmword ptr [r13 + r15 + 0]
+	MOVL     $0x40, SI             // <--                                  // mov	esi, 64
+	KMOVQ    K5, DI                // <--                                  // kmovq	rdi, k5
+	TESTQ    DI, DI                // <--                                  // test	rdi, rdi
+	JE       LBB6_15               // <--                                  // je	.LBB6_15
+
+LBB6_3:
+	MOVQ SI, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], rsi
+	MOVQ DX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdx
+	MOVQ R15, DX      // <--                                  // mov	rdx, r15
+	MOVQ DI, R15      // <--                                  // mov	r15, rdi
+
+LBB6_4:
+	XORL    DI, DI           // <--                                  // xor	edi, edi
+	TZCNTQ  R15, DI          // <--                                  // tzcnt	rdi, r15
+	MOVLQSX DI, DI           // <--                                  // movsxd	rdi, edi
+	ADDQ    DX, DI           // <--                                  // add	rdi, rdx
+	LEAQ    0(R10)(DI*1), SI // <--                                  // lea	rsi, [r10 + rdi]
+	CMPQ    R9, $0x3f        // <--                                  // cmp	r9, 63
+	JLE     LBB6_16          // <--                                  // jle	.LBB6_16
+	MOVQ    0x38(SP), BX     // <--                                  // mov	rbx, qword ptr [rsp + 56]
+	MOVQ    R9, CX           // <--                                  // mov	rcx, r9
+	MOVQ    R11, R14         // <--                                  // mov	r14, r11
+	JMP     LBB6_6           // <--                                  // jmp	.LBB6_6
+
+LBB6_5:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, SI  // <--                                  // add	rsi, 64
+	ADDQ $0x40, R14 // <--                                  // add	r14, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB6_10    // <--                                  // jle	.LBB6_10
+
+LBB6_6:
+	VMOVDQU8 0(SI), Z0                           // <--                                  // vmovdqu8	zmm0, zmmword ptr [rsi]
+	LONG     $0x487dd362; WORD $0xe3f; BYTE $0x4 // VPCMPNEQB 0(R14), Z0, K1             // vpcmpneqb	k1, zmm0, zmmword ptr [r14]
+	KORTESTQ K1, K1                              // <--                                  // kortestq	k1, k1
+	JE       LBB6_5                              // <--                                  // je	.LBB6_5
+	MOVQ     BX, 0x38(SP)                        // <--                                  // mov	qword ptr [rsp + 56], rbx
+
+LBB6_7:
+	MOVQ DI, CX        // <--                                  // mov	rcx, rdi
+	ADDQ $0x1, AX      // <--                                  // add	rax, 1
+	SARQ $0x8, CX      // <--                                  // sar	rcx, 8
+	ADDQ $0x4, CX      // <--                                  // add	rcx, 4
+	CMPQ AX, CX        // <--                                  // cmp	rax, rcx
+	JG   LBB6_21       // <--                                  // jg	.LBB6_21
+	LEAQ -0x1(R15), CX // <--                                  // lea	rcx, [r15 - 1]
+	ANDQ CX, R15       // <--                                  // and	r15, rcx
+	JNE  LBB6_4        // <--                                  // jne	.LBB6_4
+	MOVQ 0x30(SP), SI  // <--                                  // mov	rsi, qword ptr [rsp + 48]
+	MOVQ DX, R15       // <--                                  // mov	r15, rdx
+	MOVQ 0x38(SP), DX  // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	ADDQ SI, R15       // <--                                  // add	r15, rsi
+	JMP  LBB6_0        // <--                                  // jmp	.LBB6_0
+
+LBB6_8:
+	XORL DX, DX // <--                                  // xor	edx, edx
+
+LBB6_9:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	MOVQ DX, AX         // <--                                  // mov	rax, rdx
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+88(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB6_10:
+	MOVQ  BX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rbx
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB6_12      // <--                                  // je	.LBB6_12
+
+LBB6_11:
+	MOVQ       R8, BX                               // <--                                  // mov	rbx, r8
+	SHLQ       CX, BX                               // <--                                  // shl	rbx, cl
+	LEAQ       -0x1(BX), BX                         // <--                                  // lea	rbx, [rbx - 1]
+	KMOVQ      BX, K1                               // <--                                  // kmovq	k1, rbx
+	VMOVDQU8.Z 0(SI), K1, Z2                        // <--                                  // vmovdqu8	zmm2{k1}{z}, zmmword ptr [rsi]
+	VMOVDQU8.Z 0(R14), K1, Z3                       // <--                                  // vmovdqu8	zmm3{k1}{z}, zmmword ptr [r14]
+	LONG       $0x486df362; WORD $0xcb3f; BYTE $0x4 // VPCMPNEQB Z3, Z2, K1                 // vpcmpneqb	k1, zmm2, zmm3
+	KORTESTQ   K1, K1                               // <--                                  // kortestq	k1, k1
+	JNE        LBB6_7                               // <--                                  // jne	.LBB6_7
+	MOVQ       0x38(SP), DX                         // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVQ       DI, R14                              // <--                                  // mov	r14, rdi
+	JMP        LBB6_13                              // <--                                  // jmp	.LBB6_13
+
+LBB6_12:
+	MOVQ DI, R14 // <--                                  // mov	r14, rdi
+	MOVQ BX, DX  // <--                                  // mov	rdx, rbx
+
+LBB6_13:
+	MOVQ 0x20(BP), BX      // <--                                  // mov	rbx, qword ptr [rbp + 32]
+	MOVQ R14, 0(BX)(DX*8)  // <--                                  // mov	qword ptr [rbx + rdx*8], r14
+	ADDQ $0x1, DX          // <--                                  // add	rdx, 1
+	CMPQ 0x28(BP), DX      // <--                                  // cmp	qword ptr [rbp + 40], rdx
+	JE   LBB6_20           // <--                                  // je	.LBB6_20
+	LEAQ 0(R9)(R14*1), R15 // <--                                  // lea	r15, [r9 + r14]
+	JMP  LBB6_0            // <--                                  // jmp	.LBB6_0
+
+LBB6_14:
+	CMPQ       R12, R15                             // <--                                  // cmp	r12, r15
+	JLE        LBB6_20                              // <--                                  // jle	.LBB6_20
+	MOVQ       R12, SI                              // <--                                  // mov	rsi, r12
+	MOVQ       R8, DI                               // <--                                  // mov	rdi, r8
+	SUBQ       R15, SI                              // <--                                  // sub	rsi, r15
+	MOVL       SI, CX                               // <--                                  // mov	ecx, esi
+	SHLQ       CX, DI                               // <--                                  // shl	rdi, cl
+	LEAQ       -0x1(DI), BX                         // <--                                  // lea	rbx, [rdi - 1]
+	KMOVQ      BX, K1                               // <--                                  // kmovq	k1, rbx
+	VMOVDQU8.Z 0(R13)(R15*1), K1, Z2                // <--                                  // vmovdqu8	zmm2{k1}{z}, zmmword ptr [r13 + r15 + 0]
+	LONG       $0x496df362; WORD $0xf13f; BYTE $0x0 // VPCMPEQB Z1, Z2, K1, K6              // vpcmpeqb	k6{k1}, zmm2, zmm1
+	KMOVQ      K6, DI                               // <--                                  // kmovq	rdi, k6
+	TESTQ      DI, DI                               // <--                                  // test	rdi, rdi
+	JNE        LBB6_3                               // <--                                  // jne	.LBB6_3
+
+LBB6_15:
+	ADDQ SI, R15 // <--                                  // add	r15, rsi
+	JMP  LBB6_0  // <--                                  // jmp	.LBB6_0
+
+LBB6_16:
+	MOVQ R11, R14 // <--                                  // mov	r14, r11
+	MOVQ R9, CX   // <--                                  // mov	rcx, r9
+	JMP  LBB6_11  // <--                                  // jmp	.LBB6_11
+
+LBB6_17:
+	VMOVQ DI, X7  // <--                                  // vmovq	xmm7, rdi
+	TESTQ CX, CX  // <--                                  // test	rcx, rcx
+	JE    LBB6_19 // <--                                  // je	.LBB6_19
+
+LBB6_18:
+	MOVL       $0x1, DI                             // <--                                  // mov	edi, 1
+	SHLQ       CX, DI                               // <--                                  // shl	rdi, cl
+	LEAQ       -0x1(DI), DI                         // <--                                  // lea	rdi, [rdi - 1]
+	KMOVQ      DI, K1                               // <--                                  // kmovq	k1, rdi
+	VMOVDQU8.Z 0(R10), K1, Z1                       // <--                                  // vmovdqu8	zmm1{k1}{z}, zmmword ptr [r10]
+	VMOVDQU8.Z 0(SI), K1, Z2                        // <--                                  // vmovdqu8	zmm2{k1}{z}, zmmword ptr [rsi]
+	LONG       $0x4875f362; WORD $0xc23f; BYTE $0x4 // VPCMPNEQB Z2, Z1, K0                 // vpcmpneqb	k0, zmm1, zmm2
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB6_40                              // <--                                  // jne	.LBB6_40
+
+LBB6_19:
+	MOVQ  0x20(BP), BX     // <--                                  // mov	rbx, qword ptr [rbp + 32]
+	LEAQ  0(R14)(R8*1), AX // <--                                  // lea	rax, [r14 + r8]
+	VMOVQ X7, DI           // <--                                  // vmovq	rdi, xmm7
+	MOVQ  AX, 0(BX)(DX*8)  // <--                                  // mov	qword ptr [rbx + rdx*8], rax
+	ADDQ  $0x1, DX         // <--                                  // add	rdx, 1
+	CMPQ  0x28(BP), DX     // <--                                  // cmp	qword ptr [rbp + 40], rdx
+	JE    LBB6_20          // <--                                  // je	.LBB6_20
+	MOVQ  0x18(SP), R13    // <--                                  // mov	r13, qword ptr [rsp + 24]
+	ADDQ  R9, R14          // <--                                  // add	r14, r9
+	ADDQ  R14, R8          // <--                                  // add	r8, r14
+	SUBQ  R8, R13          // <--                                  // sub	r13, r8
+	LEAQ  0(DI)(R8*1), BX  // <--                                  // lea	rbx, [rdi + r8]
+	CMPQ  R9, R13          // <--                                  // cmp	r9, r13
+	JLE   LBB6_36          // <--                                  // jle	.LBB6_36
+
+LBB6_20:
+	VZEROUPPER        // <--                                  // vzeroupper
+	JMP        LBB6_9 // <--                                  // jmp	.LBB6_9
+
+LBB6_21:
+	MOVQ         0x28(SP), AX    // <--                                  // mov	rax, qword ptr [rsp + 40]
+	MOVQ         DI, SI          // <--                                  // mov	rsi, rdi
+	MOVQ         R10, DI         // <--                                  // mov	rdi, r10
+	XORL         R15, R15        // <--                                  // xor	r15d, r15d
+	ADDQ         $0x1, SI        // <--                                  // add	rsi, 1
+	MOVQ         0x38(SP), DX    // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	KMOVD        K0, R10         // <--                                  // kmovd	r10d, k0
+	MOVL         $0x1, R14       // <--                                  // mov	r14d, 1
+	ADDQ         DI, AX          // <--                                  // add	rax, rdi
+	CMPQ         R9, $0x3f       // <--                                  // cmp	r9, 63
+	VPBROADCASTB R10, Z3         // <--                                  // vpbroadcastb	zmm3, r10d
+	MOVQ         R12, R10        // <--                                  // mov	r10, r12
+	MOVQ         AX, 0x28(SP)    // <--                                  // mov	qword ptr [rsp + 40], rax
+	SETLE        R15             // <--                                  // setle	r15b
+	MOVQ         SI, R12         // <--                                  // mov	r12, rsi
+	XORL         BX, BX          // <--                                  // xor	ebx, ebx
+	LEAQ         0x4(R15*4), R15 // <--                                  // lea	r15, [r15*4 + 4]
+
+LBB6_22:
+	LEAQ 0x3f(R12), AX // <--                                  // lea	rax, [r12 + 63]
+	CMPQ R10, AX       // <--                                  // cmp	r10, rax
+	JLE  LBB6_29       // <--                                  // jle	.LBB6_29
+
+LBB6_23:
+	MOVQ     0x28(SP), AX              // <--                                  // mov	rax, qword ptr [rsp + 40]
+	MOVL     $0x40, CX                 // <--                                  // mov	ecx, 64
+	VPCMPEQB 0(AX)(R12*1), Z3, K1      // <--                                  // vpcmpeqb	k1, zmm3, zmmword ptr [rax + r12]
+	VPCMPEQB 0(R13)(R12*1), Z1, K1, K7 // <--                                  // vpcmpeqb	k7{k1}, zmm1, zmmword ptr [r13 + r12 + 0]
+	KMOVQ    K7, SI                    // <--                                  // kmovq	rsi, k7
+
+LBB6_24:
+	TESTQ SI, SI        // <--                                  // test	rsi, rsi
+	JE    LBB6_44       // <--                                  // je	.LBB6_44
+	MOVQ  R13, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], r13
+	MOVQ  CX, 0x20(SP)  // <--                                  // mov	qword ptr [rsp + 32], rcx
+	MOVQ  R10, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], r10
+	MOVQ  R12, R10      // <--                                  // mov	r10, r12
+	MOVQ  SI, R12       // <--                                  // mov	r12, rsi
+
+LBB6_25:
+	XORL    SI, SI          // <--                                  // xor	esi, esi
+	TZCNTQ  R12, SI         // <--                                  // tzcnt	rsi, r12
+	MOVLQSX SI, SI          // <--                                  // movsxd	rsi, esi
+	ADDQ    R10, SI         // <--                                  // add	rsi, r10
+	LEAQ    0(DI)(SI*1), R8 // <--                                  // lea	r8, [rdi + rsi]
+	CMPQ    R9, $0x3f       // <--                                  // cmp	r9, 63
+	JLE     LBB6_34         // <--                                  // jle	.LBB6_34
+	MOVQ    0x38(SP), R13   // <--                                  // mov	r13, qword ptr [rsp + 56]
+	MOVQ    R9, CX          // <--                                  // mov	rcx, r9
+	MOVQ    R11, AX         // <--                                  // mov	rax, r11
+	JMP     LBB6_27         // <--                                  // jmp	.LBB6_27
+
+LBB6_26:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R8 // <--                                  // add	r8, 64
+	ADDQ $0x40, AX // <--                                  // add	rax, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB6_30   // <--                                  // jle	.LBB6_30
+
+LBB6_27:
+	VMOVDQU8 0(R8), Z5                          // <--                                  // vmovdqu8	zmm5, zmmword ptr [r8]
+	LONG     $0x4855f362; WORD $0x3f; BYTE $0x4 // VPCMPNEQB 0(AX), Z5, K0              // vpcmpneqb	k0, zmm5, zmmword ptr [rax]
+	KORTESTQ K0, K0                             // <--                                  // kortestq	k0, k0
+	JE       LBB6_26                            // <--                                  // je	.LBB6_26
+	MOVQ     R13, 0x38(SP)                      // <--                                  // mov	qword ptr [rsp + 56], r13
+
+LBB6_28:
+	ADDQ $0x1, BX      // <--                                  // add	rbx, 1
+	CMPQ BX, R15       // <--                                  // cmp	rbx, r15
+	JG   LBB6_35       // <--                                  // jg	.LBB6_35
+	LEAQ -0x1(R12), AX // <--                                  // lea	rax, [r12 - 1]
+	ANDQ AX, R12       // <--                                  // and	r12, rax
+	JNE  LBB6_25       // <--                                  // jne	.LBB6_25
+	MOVQ 0x20(SP), CX  // <--                                  // mov	rcx, qword ptr [rsp + 32]
+	MOVQ R10, R12      // <--                                  // mov	r12, r10
+	MOVQ 0x38(SP), R10 // <--                                  // mov	r10, qword ptr [rsp + 56]
+	MOVQ 0x30(SP), R13 // <--                                  // mov	r13, qword ptr [rsp + 48]
+	ADDQ CX, R12       // <--                                  // add	r12, rcx
+	LEAQ 0x3f(R12), AX // <--                                  // lea	rax, [r12 + 63]
+	CMPQ R10, AX       // <--                                  // cmp	r10, rax
+	JG   LBB6_23       // <--                                  // jg	.LBB6_23
+
+LBB6_29:
+	CMPQ       R10, R12                             // <--                                  // cmp	r10, r12
+	JLE        LBB6_20                              // <--                                  // jle	.LBB6_20
+	MOVQ       R10, CX                              // <--                                  // mov	rcx, r10
+	MOVQ       R14, AX                              // <--                                  // mov	rax, r14
+	SUBQ       R12, CX                              // <--                                  // sub	rcx, r12
+	SHLQ       CX, AX                               // <--                                  // shl	rax, cl
+	SUBQ       $0x1, AX                             // <--                                  // sub	rax, 1
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	MOVQ       0x28(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 40]
+	VMOVDQU8.Z 0(R13)(R12*1), K1, Z4                // <--                                  // vmovdqu8	zmm4{k1}{z}, zmmword ptr [r13 + r12 + 0]
+	LONG       $0x495df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z4, K1, K0              // vpcmpeqb	k0{k1}, zmm4, zmm1
+	VMOVDQU8.Z 0(AX)(R12*1), K1, Z4                 // <--                                  // vmovdqu8	zmm4{k1}{z}, zmmword ptr [rax + r12]
+	LONG       $0x495df362; WORD $0xcb3f; BYTE $0x0 // VPCMPEQB Z3, Z4, K1, K1              // vpcmpeqb	k1{k1}, zmm4, zmm3
+	KMOVQ      K0, AX                               // <--                                  // kmovq	rax, k0
+	KMOVQ      K1, SI                               // <--                                  // kmovq	rsi, k1
+	ANDQ       AX, SI                               // <--                                  // and	rsi, rax
+	JMP        LBB6_24                              // <--                                  // jmp	.LBB6_24
+
+LBB6_30:
+	MOVQ  R13, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], r13
+	TESTQ CX, CX        // <--                                  // test	rcx, rcx
+	JE    LBB6_32       // <--                                  // je	.LBB6_32
+
+LBB6_31:
+	MOVQ       R14, R13                             // <--                                  // mov	r13, r14
+	SHLQ       CX, R13                              // <--                                  // shl	r13, cl
+	MOVQ       R13, CX                              // <--                                  // mov	rcx, r13
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(R8), K1, Z7                        // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [r8]
+	VMOVDQU8.Z 0(AX), K1, Z4                        // <--                                  // vmovdqu8	zmm4{k1}{z}, zmmword ptr [rax]
+	LONG       $0x4845f362; WORD $0xc43f; BYTE $0x4 // VPCMPNEQB Z4, Z7, K0                 // vpcmpneqb	k0, zmm7, zmm4
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB6_28                              // <--                                  // jne	.LBB6_28
+	MOVQ       0x38(SP), R10                        // <--                                  // mov	r10, qword ptr [rsp + 56]
+	MOVQ       0x30(SP), R13                        // <--                                  // mov	r13, qword ptr [rsp + 48]
+	MOVQ       SI, R8                               // <--                                  // mov	r8, rsi
+	JMP        LBB6_33                              // <--                                  // jmp	.LBB6_33
+
+LBB6_32:
+	MOVQ R13, R10      // <--                                  // mov	r10, r13
+	MOVQ 0x30(SP), R13 // <--                                  // mov	r13, qword ptr [rsp + 48]
+	MOVQ SI, R8        // <--                                  // mov	r8, rsi
+
+LBB6_33:
+	MOVQ 0x20(BP), AX     // <--                                  // mov	rax, qword ptr [rbp + 32]
+	MOVQ R8, 0(AX)(DX*8)  // <--                                  // mov	qword ptr [rax + rdx*8], r8
+	ADDQ $0x1, DX         // <--                                  // add	rdx, 1
+	CMPQ 0x28(BP), DX     // <--                                  // cmp	qword ptr [rbp + 40], rdx
+	JE   LBB6_20          // <--                                  // je	.LBB6_20
+	LEAQ 0(R9)(R8*1), R12 // <--                                  // lea	r12, [r9 + r8]
+	JMP  LBB6_22          // <--                                  // jmp	.LBB6_22
+
+LBB6_34:
+	MOVQ R11, AX // <--                                  // mov	rax, r11
+	MOVQ R9, CX  // <--                                  // mov	rcx, r9
+	JMP  LBB6_31 // <--                                  // jmp	.LBB6_31
+
+LBB6_35:
+	MOVQ 0x18(SP), R14   // <--                                  // mov	r14, qword ptr [rsp + 24]
+	MOVQ SI, R8          // <--                                  // mov	r8, rsi
+	ADDQ $0x1, R8        // <--                                  // add	r8, 1
+	SUBQ R8, R14         // <--                                  // sub	r14, r8
+	LEAQ 0(DI)(R8*1), BX // <--                                  // lea	rbx, [rdi + r8]
+	MOVQ R14, R13        // <--                                  // mov	r13, r14
+	CMPQ R9, R14         // <--                                  // cmp	r9, r14
+	JG   LBB6_20         // <--                                  // jg	.LBB6_20
+
+LBB6_36:
+	SUBQ R9, R13        // <--                                  // sub	r13, r9
+	MOVQ R9, AX         // <--                                  // mov	rax, r9
+	MOVL $0x1000193, CX // <--                                  // mov	ecx, 16777619
+	MOVL $0x1, R15      // <--                                  // mov	r15d, 1
+
+LBB6_37:
+	WORD  $0x1a8  // TESTB $0x1, AX                       // test	al, 1
+	JE    LBB6_38 // <--                                  // je	.LBB6_38
+	IMULL CX, R15 // <--                                  // imul	r15d, ecx
+
+LBB6_38:
+	IMULL CX, CX   // <--                                  // imul	ecx, ecx
+	SHRQ  $0x1, AX // <--                                  // shr	rax, 1
+	JNE   LBB6_37  // <--                                  // jne	.LBB6_37
+	XORL  AX, AX   // <--                                  // xor	eax, eax
+	XORL  CX, CX   // <--                                  // xor	ecx, ecx
+	XORL  R12, R12 // <--                                  // xor	r12d, r12d
+
+LBB6_39:
+	LONG    $0x93e46945; WORD $0x1; BYTE $0x1 // IMULL $0x1000193, R12, R12           // imul	r12d, r12d, 16777619
+	MOVBLZX 0(R11)(CX*1), SI                  // <--                                  // movzx	esi, byte ptr [r11 + rcx]
+	LONG    $0x193c069; WORD $0x100           // IMULL $0x1000193, AX, AX             // imul	eax, eax, 16777619
+	ADDL    SI, R12                           // <--                                  // add	r12d, esi
+	MOVBLZX 0(BX)(CX*1), SI                   // <--                                  // movzx	esi, byte ptr [rbx + rcx]
+	ADDQ    $0x1, CX                          // <--                                  // add	rcx, 1
+	ADDL    SI, AX                            // <--                                  // add	eax, esi
+	CMPQ    R9, CX                            // <--                                  // cmp	r9, rcx
+	JG      LBB6_39                           // <--                                  // jg	.LBB6_39
+	ADDQ    $0x1, R13                         // <--                                  // add	r13, 1
+	XORL    R14, R14                          // <--                                  // xor	r14d, r14d
+	VMOVQ   DI, X7                            // <--                                  // vmovq	xmm7, rdi
+	JMP     LBB6_41                           // <--                                  // jmp	.LBB6_41
+
+LBB6_40:
+	ADDQ    $0x1, R14               // <--                                  // add	r14, 1
+	CMPQ    R14, R13                // <--                                  // cmp	r14, r13
+	JE      LBB6_20                 // <--                                  // je	.LBB6_20
+	LONG    $0x193c069; WORD $0x100 // IMULL $0x1000193, AX, AX             // imul	eax, eax, 16777619
+	MOVBLZX 0(BX)(R9*1), CX         // <--                                  // movzx	ecx, byte ptr [rbx + r9]
+	ADDQ    $0x1, BX                // <--                                  // add	rbx, 1
+	ADDL    CX, AX                  // <--                                  // add	eax, ecx
+	MOVBLZX -0x1(BX), CX            // <--                                  // movzx	ecx, byte ptr [rbx - 1]
+	IMULL   R15, CX                 // <--                                  // imul	ecx, r15d
+	SUBL    CX, AX                  // <--                                  // sub	eax, ecx
+
+LBB6_41:
+	CMPL  R12, AX   // <--                                  // cmp	r12d, eax
+	JNE   LBB6_40   // <--                                  // jne	.LBB6_40
+	MOVQ  BX, R10   // <--                                  // mov	r10, rbx
+	CMPQ  R9, $0x3f // <--                                  // cmp	r9, 63
+	JLE   LBB6_45   // <--                                  // jle	.LBB6_45
+	MOVQ  R9, CX    // <--                                  // mov	rcx, r9
+	MOVQ  R11, SI   // <--                                  // mov	rsi, r11
+	VMOVQ X7, DI    // <--                                  // vmovq	rdi, xmm7
+	JMP   LBB6_43   // <--                                  // jmp	.LBB6_43
+
+LBB6_42:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R10 // <--                                  // add	r10, 64
+	ADDQ $0x40, SI  // <--                                  // add	rsi, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB6_17    // <--                                  // jle	.LBB6_17
+
+LBB6_43:
+	VMOVDQU8 0(R10), Z6                          // <--                                  // vmovdqu8	zmm6, zmmword ptr [r10]
+	LONG     $0x484df362; WORD $0x63f; BYTE $0x4 // VPCMPNEQB 0(SI), Z6, K0              // vpcmpneqb	k0, zmm6, zmmword ptr [rsi]
+	KORTESTQ K0, K0                              // <--                                  // kortestq	k0, k0
+	JE       LBB6_42                             // <--                                  // je	.LBB6_42
+	VMOVQ    DI, X7                              // <--                                  // vmovq	xmm7, rdi
+	JMP      LBB6_40                             // <--                                  // jmp	.LBB6_40
+
+LBB6_44:
+	ADDQ CX, R12 // <--                                  // add	r12, rcx
+	JMP  LBB6_22 // <--                                  // jmp	.LBB6_22
+
+LBB6_45:
+	MOVQ R11, SI // <--                                  // mov	rsi, r11
+	MOVQ R9, CX  // <--                                  // mov	rcx, r9
+	JMP  LBB6_18 // <--                                  // jmp	.LBB6_18
+
+TEXT ·searchAllFoldAvx512(SB), NOSPLIT, $224-96
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	MOVQ         out+64(FP), AX
+	MOVQ         AX, 24(SP)
+	MOVQ         out_len+72(FP), AX
+	MOVQ         AX, 32(SP)
+	MOVQ         out_cap+80(FP), AX
+	MOVQ         AX, 40(SP)
+	PUSHQ        BP               // <--                                  // push	rbp
+	MOVQ         SP, BP           // <--                                  // mov	rbp, rsp
+	PUSHQ        R15              // <--                                  // push	r15
+	MOVQ         DI, R15          // <--                                  // mov	r15, rdi
+	MOVQ         R9, DI           // <--                                  // mov	rdi, r9
+	PUSHQ        R14              // <--                                  // push	r14
+	PUSHQ        R13              // <--                                  // push	r13
+	PUSHQ        R12              // <--                                  // push	r12
+	PUSHQ        BX               // <--                                  // push	rbx
+	ANDQ         $-0x40, SP       // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP        // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R9     // <--                                  // mov	r9, qword ptr [rbp + 24]
+	MOVQ         0x10(BP), R10    // <--                                  // mov	r10, qword ptr [rbp + 16]
+	MOVQ         SI, 0x18(SP)     // <--                                  // mov	qword ptr [rsp + 24], rsi
+	TESTQ        R9, R9           // <--                                  // test	r9, r9
+	JLE          LBB7_8           // <--                                  // jle	.LBB7_8
+	MOVQ         SI, AX           // <--                                  // mov	rax, rsi
+	CMPQ         SI, R9           // <--                                  // cmp	rsi, r9
+	JL           LBB7_8           // <--                                  // jl	.LBB7_8
+	MOVL         DX, SI           // <--                                  // mov	esi, edx
+	SUBQ         R9, AX           // <--                                  // sub	rax, r9
+	MOVL         R8, DX           // <--                                  // mov	edx, r8d
+	MOVQ         DI, 0x28(SP)     // <--                                  // mov	qword ptr [rsp + 40], rdi
+	MOVQ         AX, R8           // <--                                  // mov	r8, rax
+	LEAL         -0x61(SI), AX    // <--                                  // lea	eax, [rsi - 97]
+	VPBROADCASTB SI, Z6           // <--                                  // vpbroadcastb	zmm6, esi
+	MOVL         $0x1, R14        // <--                                  // mov	r14d, 1
+	ADDQ         $0x1, R8         // <--                                  // add	r8, 1
+	WORD         $0x193c          // CMPB AX, $0x19                       // cmp	al, 25
+	SETLS        AX               // <--                                  // setbe	al
+	XORL         R13, R13         // <--                                  // xor	r13d, r13d
+	XORL         R11, R11         // <--                                  // xor	r11d, r11d
+	SHLL         $0x5, AX         // <--                                  // shl	eax, 5
+	MOVQ         R13, DI          // <--                                  // mov	rdi, r13
+	VPBROADCASTB AX, Z5           // <--                                  // vpbroadcastb	zmm5, eax
+	LEAQ         0(R15)(CX*1), AX // <--                                  // lea	rax, [r15 + rcx]
+	MOVQ         AX, 0x38(SP)     // <--                                  // mov	qword ptr [rsp + 56], rax
+	MOVL         $-0x41, AX       // <--                                  // mov	eax, -65
+	VPBROADCASTB AX, Z3           // <--                                  // vpbroadcastb	zmm3, eax
+	MOVL         $0x1a, AX        // <--                                  // mov	eax, 26
+	VPBROADCASTB AX, Z2           // <--                                  // vpbroadcastb	zmm2, eax
+	MOVL         $0x20, AX        // <--                                  // mov	eax, 32
+	VPBROADCASTB AX, Z1           // <--                                  // vpbroadcastb	zmm1, eax
+
+LBB7_0:
+	LEAQ 0xff(DI), CX // <--                                  // lea	rcx, [rdi + 255]
+	CMPQ R8, CX       // <--                                  // cmp	r8, rcx
+	JLE  LBB7_2       // <--                                  // jle	.LBB7_2
+
+LBB7_1:
+	MOVQ  0x38(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 56]
+	LEAQ  0(AX)(DI*1), SI                      // <--                                  // lea	rsi, [rax + rdi]
+	VPORD 0(SI), Z5, Z0                        // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi]
+	LONG  $0x487df362; WORD $0xc63f; BYTE $0x0 // VPCMPEQB Z6, Z0, K0                  // vpcmpeqb	k0, zmm0, zmm6
+	VPORD 0x40(SI), Z5, Z0                     // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi + 64]
+	LONG  $0x487df362; WORD $0xce3f; BYTE $0x0 // VPCMPEQB Z6, Z0, K1                  // vpcmpeqb	k1, zmm0, zmm6
+	VPORD 0x80(SI), Z5, Z0                     // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi + 128]
+	KMOVQ K0, AX                               // <--                                  // kmovq	rax, k0
+	LONG  $0x487df362; WORD $0xd63f; BYTE $0x0 // VPCMPEQB Z6, Z0, K2                  // vpcmpeqb	k2, zmm0, zmm6
+	VPORD 0xc0(SI), Z5, Z0                     // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi + 192]
+	KMOVQ K1, CX                               // <--                                  // kmovq	rcx, k1
+	ORQ   AX, CX                               // <--                                  // or	rcx, rax
+	LONG  $0x487df362; WORD $0xde3f; BYTE $0x0 // VPCMPEQB Z6, Z0, K3                  // vpcmpeqb	k3, zmm0, zmm6
+	KMOVQ K2, BX                               // <--                                  // kmovq	rbx, k2
+	ORQ   BX, CX                               // <--                                  // or	rcx, rbx
+	KMOVQ K3, SI                               // <--                                  // kmovq	rsi, k3
+	ORQ   SI, CX                               // <--                                  // or	rcx, rsi
+	JNE   LBB7_2                               // <--                                  // jne	.LBB7_2
+	ADDQ  $0x100, DI                           // <--                                  // add	rdi, 256
+	LEAQ  0xff(DI), CX                         // <--                                  // lea	rcx, [rdi + 255]
+	CMPQ  R8, CX                               // <--                                  // cmp	r8, rcx
+	JG    LBB7_1                               // <--                                  // jg	.LBB7_1
+
+LBB7_2:
+	LEAQ  0x3f(DI), CX                         // <--                                  // lea	rcx, [rdi + 63]
+	CMPQ  R8, CX                               // <--                                  // cmp	r8, rcx
+	JLE   LBB7_13                              // <--                                  // jle	.LBB7_13
+	MOVQ  0x38(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 56]
+	LONG  $0x487d7162; WORD $0xcd6f            // VMOVDQA32 Z5, Z9                     // vmovdqa32	zmm9, zmm5
+	MOVL  $0x40, CX                            // <--                                  // mov	ecx, 64
+	VPORD 0(AX)(DI*1), Z5, Z0                  // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rax + rdi]
+	LONG  $0x487df362; WORD $0xe63f; BYTE $0x0 // VPCMPEQB Z6, Z0, K4                  // vpcmpeqb	k4, zmm0, zmm6
+	KMOVQ K4, R12                              // <--                                  // kmovq	r12, k4
+
+LBB7_3:
+	TESTQ R12, R12     // <--                                  // test	r12, r12
+	JE    LBB7_41      // <--                                  // je	.LBB7_41
+	MOVQ  CX, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], rcx
+	MOVQ  DI, AX       // <--                                  // mov	rax, rdi
+	MOVQ  R12, DI      // <--                                  // mov	rdi, r12
+	KMOVD DX, K7       // <--                                  // kmovd	k7, edx
+
+LBB7_4:
+	XORL    SI, SI           // <--                                  // xor	esi, esi
+	TZCNTQ  DI, SI           // <--                                  // tzcnt	rsi, rdi
+	MOVLQSX SI, SI           // <--                                  // movsxd	rsi, esi
+	ADDQ    AX, SI           // <--                                  // add	rsi, rax
+	LEAQ    0(R15)(SI*1), BX // <--                                  // lea	rbx, [r15 + rsi]
+	CMPQ    R9, $0x3f        // <--                                  // cmp	r9, 63
+	JLE     LBB7_14          // <--                                  // jle	.LBB7_14
+	MOVQ    R9, CX           // <--                                  // mov	rcx, r9
+	MOVQ    R10, R12         // <--                                  // mov	r12, r10
+	KMOVD   K7, DX           // <--                                  // kmovd	edx, k7
+	JMP     LBB7_6           // <--                                  // jmp	.LBB7_6
+
+LBB7_5:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, BX  // <--                                  // add	rbx, 64
+	ADDQ $0x40, R12 // <--                                  // add	r12, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB7_10    // <--                                  // jle	.LBB7_10
+
+LBB7_6:
+	VPADDB   0(BX), Z3, Z0                        // <--                                  // vpaddb	zmm0, zmm3, zmmword ptr [rbx]
+	LONG     $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VMOVDQU8 0(BX), Z0                            // <--                                  // vmovdqu8	zmm0, zmmword ptr [rbx]
+	VPADDB   Z0, Z1, K1, Z0                       // <--                                  // vpaddb	zmm0{k1}, zmm1, zmm0
+	LONG     $0x487dd362; LONG $0x424043f         // VPCMPNEQB 0(R12), Z0, K0             // vpcmpneqb	k0, zmm0, zmmword ptr [r12]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JE       LBB7_5                               // <--                                  // je	.LBB7_5
+	KMOVD    DX, K7                               // <--                                  // kmovd	k7, edx
+
+LBB7_7:
+	MOVQ  SI, CX       // <--                                  // mov	rcx, rsi
+	ADDQ  $0x1, R13    // <--                                  // add	r13, 1
+	SARQ  $0x8, CX     // <--                                  // sar	rcx, 8
+	ADDQ  $0x4, CX     // <--                                  // add	rcx, 4
+	CMPQ  R13, CX      // <--                                  // cmp	r13, rcx
+	JG    LBB7_19      // <--                                  // jg	.LBB7_19
+	LEAQ  -0x1(DI), CX // <--                                  // lea	rcx, [rdi - 1]
+	ANDQ  CX, DI       // <--                                  // and	rdi, rcx
+	JNE   LBB7_4       // <--                                  // jne	.LBB7_4
+	MOVQ  0x30(SP), CX // <--                                  // mov	rcx, qword ptr [rsp + 48]
+	MOVQ  AX, DI       // <--                                  // mov	rdi, rax
+	KMOVD K7, DX       // <--                                  // kmovd	edx, k7
+	ADDQ  CX, DI       // <--                                  // add	rdi, rcx
+	JMP   LBB7_0       // <--                                  // jmp	.LBB7_0
+
+LBB7_8:
+	XORL R11, R11 // <--                                  // xor	r11d, r11d
+
+LBB7_9:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	MOVQ R11, AX        // <--                                  // mov	rax, r11
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+88(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB7_10:
+	KMOVD DX, K7  // <--                                  // kmovd	k7, edx
+	TESTQ CX, CX  // <--                                  // test	rcx, rcx
+	JE    LBB7_12 // <--                                  // je	.LBB7_12
+
+LBB7_11:
+	MOVQ       R14, DX                              // <--                                  // mov	rdx, r14
+	SHLQ       CX, DX                               // <--                                  // shl	rdx, cl
+	LEAQ       -0x1(DX), DX                         // <--                                  // lea	rdx, [rdx - 1]
+	KMOVQ      DX, K1                               // <--                                  // kmovq	k1, rdx
+	VMOVDQU8.Z 0(BX), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rbx]
+	VMOVDQU8.Z 0(R12), K1, Z8                       // <--                                  // vmovdqu8	zmm8{k1}{z}, zmmword ptr [r12]
+	VPADDB     Z3, Z0, Z7                           // <--                                  // vpaddb	zmm7, zmm0, zmm3
+	LONG       $0x4845f362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z7, K1                 // vpcmpltub	k1, zmm7, zmm2
+	LONG       $0x48fdf162; WORD $0xf86f            // VMOVDQA64 Z0, Z7                     // vmovdqa64	zmm7, zmm0
+	VPADDB     Z1, Z0, K1, Z7                       // <--                                  // vpaddb	zmm7{k1}, zmm0, zmm1
+	LONG       $0x4845d362; WORD $0xc03f; BYTE $0x4 // VPCMPNEQB Z8, Z7, K0                 // vpcmpneqb	k0, zmm7, zmm8
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB7_7                               // <--                                  // jne	.LBB7_7
+
+LBB7_12:
+	MOVQ  0x20(BP), AX     // <--                                  // mov	rax, qword ptr [rbp + 32]
+	KMOVD K7, DX           // <--                                  // kmovd	edx, k7
+	MOVQ  SI, 0(AX)(R11*8) // <--                                  // mov	qword ptr [rax + r11*8], rsi
+	ADDQ  $0x1, R11        // <--                                  // add	r11, 1
+	CMPQ  0x28(BP), R11    // <--                                  // cmp	qword ptr [rbp + 40], r11
+	JE    LBB7_18          // <--                                  // je	.LBB7_18
+	LEAQ  0(R9)(SI*1), DI  // <--                                  // lea	rdi, [r9 + rsi]
+	JMP   LBB7_0           // <--                                  // jmp	.LBB7_0
+
+LBB7_13:
+	CMPQ       R8, DI                               // <--                                  // cmp	r8, rdi
+	JLE        LBB7_18                              // <--                                  // jle	.LBB7_18
+	MOVQ       R8, CX                               // <--                                  // mov	rcx, r8
+	MOVQ       R14, R12                             // <--                                  // mov	r12, r14
+	LONG       $0x487d7162; WORD $0xcd6f            // VMOVDQA32 Z5, Z9                     // vmovdqa32	zmm9, zmm5
+	SUBQ       DI, CX                               // <--                                  // sub	rcx, rdi
+	SHLQ       CX, R12                              // <--                                  // shl	r12, cl
+	LEAQ       -0x1(R12), AX                        // <--                                  // lea	rax, [r12 - 1]
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	MOVQ       0x38(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 56]
+	VMOVDQU8.Z 0(AX)(DI*1), K1, Z0                  // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rax + rdi]
+	VPORD      Z0, Z5, Z0                           // <--                                  // vpord	zmm0, zmm5, zmm0
+	LONG       $0x497df362; WORD $0xee3f; BYTE $0x0 // VPCMPEQB Z6, Z0, K1, K5              // vpcmpeqb	k5{k1}, zmm0, zmm6
+	KMOVQ      K5, R12                              // <--                                  // kmovq	r12, k5
+	JMP        LBB7_3                               // <--                                  // jmp	.LBB7_3
+
+LBB7_14:
+	MOVQ R10, R12 // <--                                  // mov	r12, r10
+	MOVQ R9, CX   // <--                                  // mov	rcx, r9
+	JMP  LBB7_11  // <--                                  // jmp	.LBB7_11
+
+LBB7_15:
+	MOVQ  SI, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rsi
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB7_17      // <--                                  // je	.LBB7_17
+
+LBB7_16:
+	MOVQ       R13, SI                              // <--                                  // mov	rsi, r13
+	SHLQ       CX, SI                               // <--                                  // shl	rsi, cl
+	LEAQ       -0x1(SI), SI                         // <--                                  // lea	rsi, [rsi - 1]
+	KMOVQ      SI, K1                               // <--                                  // kmovq	k1, rsi
+	VMOVDQU8.Z 0(R15), K1, Z0                       // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r15]
+	VMOVDQU8.Z 0(DX), K1, Z7                        // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [rdx]
+	VPADDB     Z3, Z0, Z6                           // <--                                  // vpaddb	zmm6, zmm0, zmm3
+	LONG       $0x484df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z6, K1                 // vpcmpltub	k1, zmm6, zmm2
+	LONG       $0x48fdf162; WORD $0xf06f            // VMOVDQA64 Z0, Z6                     // vmovdqa64	zmm6, zmm0
+	VPADDB     Z1, Z0, K1, Z6                       // <--                                  // vpaddb	zmm6{k1}, zmm0, zmm1
+	LONG       $0x484df362; WORD $0xc73f; BYTE $0x4 // VPCMPNEQB Z7, Z6, K0                 // vpcmpneqb	k0, zmm6, zmm7
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB7_37                              // <--                                  // jne	.LBB7_37
+	MOVQ       0x38(SP), SI                         // <--                                  // mov	rsi, qword ptr [rsp + 56]
+
+LBB7_17:
+	MOVQ  0x20(BP), DX     // <--                                  // mov	rdx, qword ptr [rbp + 32]
+	LEAQ  0(BX)(SI*1), AX  // <--                                  // lea	rax, [rbx + rsi]
+	VMOVQ X4, R14          // <--                                  // vmovq	r14, xmm4
+	MOVQ  AX, 0(DX)(R11*8) // <--                                  // mov	qword ptr [rdx + r11*8], rax
+	ADDQ  $0x1, R11        // <--                                  // add	r11, 1
+	CMPQ  0x28(BP), R11    // <--                                  // cmp	qword ptr [rbp + 40], r11
+	JE    LBB7_18          // <--                                  // je	.LBB7_18
+	MOVQ  0x18(SP), R12    // <--                                  // mov	r12, qword ptr [rsp + 24]
+	ADDQ  R9, BX           // <--                                  // add	rbx, r9
+	ADDQ  BX, SI           // <--                                  // add	rsi, rbx
+	SUBQ  SI, R12          // <--                                  // sub	r12, rsi
+	LEAQ  0(R14)(SI*1), DI // <--                                  // lea	rdi, [r14 + rsi]
+	CMPQ  R9, R12          // <--                                  // cmp	r9, r12
+	JLE   LBB7_33          // <--                                  // jle	.LBB7_33
+
+LBB7_18:
+	VZEROUPPER        // <--                                  // vzeroupper
+	JMP        LBB7_9 // <--                                  // jmp	.LBB7_9
+
+LBB7_19:
+	KMOVD        K7, DX           // <--                                  // kmovd	edx, k7
+	LEAL         -0x61(DX), AX    // <--                                  // lea	eax, [rdx - 97]
+	MOVQ         0x28(SP), DI     // <--                                  // mov	rdi, qword ptr [rsp + 40]
+	MOVQ         R8, 0x30(SP)     // <--                                  // mov	qword ptr [rsp + 48], r8
+	WORD         $0x193c          // CMPB AX, $0x19                       // cmp	al, 25
+	VPBROADCASTB DX, Z0           // <--                                  // vpbroadcastb	zmm0, edx
+	MOVQ         0x20(BP), DX     // <--                                  // mov	rdx, qword ptr [rbp + 32]
+	LEAQ         0x1(SI), R13     // <--                                  // lea	r13, [rsi + 1]
+	SETLS        AX               // <--                                  // setbe	al
+	XORL         BX, BX           // <--                                  // xor	ebx, ebx
+	MOVL         $0x1, R14        // <--                                  // mov	r14d, 1
+	SHLL         $0x5, AX         // <--                                  // shl	eax, 5
+	CMPQ         R9, $0x3f        // <--                                  // cmp	r9, 63
+	VPBROADCASTB AX, Z8           // <--                                  // vpbroadcastb	zmm8, eax
+	LEAQ         0(R15)(DI*1), AX // <--                                  // lea	rax, [r15 + rdi]
+	SETLE        BX               // <--                                  // setle	bl
+	XORL         R12, R12         // <--                                  // xor	r12d, r12d
+	MOVQ         AX, 0x28(SP)     // <--                                  // mov	qword ptr [rsp + 40], rax
+	MOVL         $-0x41, AX       // <--                                  // mov	eax, -65
+	LEAQ         0x4(BX*4), BX    // <--                                  // lea	rbx, [rbx*4 + 4]
+	VPBROADCASTB AX, Z3           // <--                                  // vpbroadcastb	zmm3, eax
+	MOVL         $0x1a, AX        // <--                                  // mov	eax, 26
+	VPBROADCASTB AX, Z2           // <--                                  // vpbroadcastb	zmm2, eax
+	MOVL         $0x20, AX        // <--                                  // mov	eax, 32
+	VPBROADCASTB AX, Z1           // <--                                  // vpbroadcastb	zmm1, eax
+
+LBB7_20:
+	LEAQ 0x3f(R13), AX // <--                                  // lea	rax, [r13 + 63]
+	CMPQ 0x30(SP), AX  // <--                                  // cmp	qword ptr [rsp + 48], rax
+	JLE  LBB7_27       // <--                                  // jle	.LBB7_27
+
+LBB7_21:
+	MOVQ  0x38(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 56]
+	MOVL  $0x40, CX                            // <--                                  // mov	ecx, 64
+	VPORD 0(AX)(R13*1), Z9, Z7                 // <--                                  // vpord	zmm7, zmm9, zmmword ptr [rax + r13]
+	MOVQ  0x28(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 40]
+	VPORD 0(AX)(R13*1), Z8, Z10                // <--                                  // vpord	zmm10, zmm8, zmmword ptr [rax + r13]
+	LONG  $0x482df362; WORD $0xc83f; BYTE $0x0 // VPCMPEQB Z0, Z10, K1                 // vpcmpeqb	k1, zmm10, zmm0
+	LONG  $0x4945f362; WORD $0xf63f; BYTE $0x0 // VPCMPEQB Z6, Z7, K1, K6              // vpcmpeqb	k6{k1}, zmm7, zmm6
+	KMOVQ K6, SI                               // <--                                  // kmovq	rsi, k6
+
+LBB7_22:
+	TESTQ SI, SI       // <--                                  // test	rsi, rsi
+	JE    LBB7_42      // <--                                  // je	.LBB7_42
+	MOVQ  CX, 0x20(SP) // <--                                  // mov	qword ptr [rsp + 32], rcx
+	MOVQ  R13, R8      // <--                                  // mov	r8, r13
+	MOVQ  SI, R13      // <--                                  // mov	r13, rsi
+	MOVQ  DX, 0x20(BP) // <--                                  // mov	qword ptr [rbp + 32], rdx
+
+LBB7_23:
+	XORL    DI, DI           // <--                                  // xor	edi, edi
+	TZCNTQ  R13, DI          // <--                                  // tzcnt	rdi, r13
+	MOVLQSX DI, DI           // <--                                  // movsxd	rdi, edi
+	ADDQ    R8, DI           // <--                                  // add	rdi, r8
+	LEAQ    0(R15)(DI*1), SI // <--                                  // lea	rsi, [r15 + rdi]
+	CMPQ    R9, $0x3f        // <--                                  // cmp	r9, 63
+	JLE     LBB7_31          // <--                                  // jle	.LBB7_31
+	MOVQ    0x20(BP), DX     // <--                                  // mov	rdx, qword ptr [rbp + 32]
+	MOVQ    R9, CX           // <--                                  // mov	rcx, r9
+	MOVQ    R10, AX          // <--                                  // mov	rax, r10
+	JMP     LBB7_25          // <--                                  // jmp	.LBB7_25
+
+LBB7_24:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, SI // <--                                  // add	rsi, 64
+	ADDQ $0x40, AX // <--                                  // add	rax, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB7_28   // <--                                  // jle	.LBB7_28
+
+LBB7_25:
+	VPADDB   0(SI), Z3, Z5                        // <--                                  // vpaddb	zmm5, zmm3, zmmword ptr [rsi]
+	VMOVDQU8 0(SI), Z4                            // <--                                  // vmovdqu8	zmm4, zmmword ptr [rsi]
+	LONG     $0x4855f362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z5, K1                 // vpcmpltub	k1, zmm5, zmm2
+	VPADDB   Z4, Z1, K1, Z4                       // <--                                  // vpaddb	zmm4{k1}, zmm1, zmm4
+	LONG     $0x485df362; WORD $0x3f; BYTE $0x4   // VPCMPNEQB 0(AX), Z4, K0              // vpcmpneqb	k0, zmm4, zmmword ptr [rax]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JE       LBB7_24                              // <--                                  // je	.LBB7_24
+	MOVQ     DX, 0x20(BP)                         // <--                                  // mov	qword ptr [rbp + 32], rdx
+
+LBB7_26:
+	ADDQ $0x1, R12     // <--                                  // add	r12, 1
+	CMPQ R12, BX       // <--                                  // cmp	r12, rbx
+	JG   LBB7_32       // <--                                  // jg	.LBB7_32
+	LEAQ -0x1(R13), AX // <--                                  // lea	rax, [r13 - 1]
+	ANDQ AX, R13       // <--                                  // and	r13, rax
+	JNE  LBB7_23       // <--                                  // jne	.LBB7_23
+	MOVQ 0x20(SP), CX  // <--                                  // mov	rcx, qword ptr [rsp + 32]
+	MOVQ R8, R13       // <--                                  // mov	r13, r8
+	MOVQ 0x20(BP), DX  // <--                                  // mov	rdx, qword ptr [rbp + 32]
+	ADDQ CX, R13       // <--                                  // add	r13, rcx
+	LEAQ 0x3f(R13), AX // <--                                  // lea	rax, [r13 + 63]
+	CMPQ 0x30(SP), AX  // <--                                  // cmp	qword ptr [rsp + 48], rax
+	JG   LBB7_21       // <--                                  // jg	.LBB7_21
+
+LBB7_27:
+	MOVQ       0x30(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 48]
+	CMPQ       AX, R13                              // <--                                  // cmp	rax, r13
+	JLE        LBB7_18                              // <--                                  // jle	.LBB7_18
+	MOVQ       AX, CX                               // <--                                  // mov	rcx, rax
+	MOVQ       R14, AX                              // <--                                  // mov	rax, r14
+	SUBQ       R13, CX                              // <--                                  // sub	rcx, r13
+	SHLQ       CX, AX                               // <--                                  // shl	rax, cl
+	SUBQ       $0x1, AX                             // <--                                  // sub	rax, 1
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	MOVQ       0x38(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 56]
+	VMOVDQU8.Z 0(AX)(R13*1), K1, Z7                 // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [rax + r13]
+	MOVQ       0x28(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 40]
+	VPORD      Z7, Z9, Z7                           // <--                                  // vpord	zmm7, zmm9, zmm7
+	LONG       $0x4945f362; WORD $0xc63f; BYTE $0x0 // VPCMPEQB Z6, Z7, K1, K0              // vpcmpeqb	k0{k1}, zmm7, zmm6
+	VMOVDQU8.Z 0(AX)(R13*1), K1, Z7                 // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [rax + r13]
+	VPORD      Z8, Z7, Z7                           // <--                                  // vpord	zmm7, zmm7, zmm8
+	LONG       $0x4945f362; WORD $0xc83f; BYTE $0x0 // VPCMPEQB Z0, Z7, K1, K1              // vpcmpeqb	k1{k1}, zmm7, zmm0
+	KMOVQ      K0, AX                               // <--                                  // kmovq	rax, k0
+	KMOVQ      K1, SI                               // <--                                  // kmovq	rsi, k1
+	ANDQ       AX, SI                               // <--                                  // and	rsi, rax
+	JMP        LBB7_22                              // <--                                  // jmp	.LBB7_22
+
+LBB7_28:
+	MOVQ  DX, 0x20(BP) // <--                                  // mov	qword ptr [rbp + 32], rdx
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB7_30      // <--                                  // je	.LBB7_30
+
+LBB7_29:
+	MOVQ       R14, DX                              // <--                                  // mov	rdx, r14
+	SHLQ       CX, DX                               // <--                                  // shl	rdx, cl
+	LEAQ       -0x1(DX), DX                         // <--                                  // lea	rdx, [rdx - 1]
+	KMOVQ      DX, K1                               // <--                                  // kmovq	k1, rdx
+	VMOVDQU8.Z 0(SI), K1, Z5                        // <--                                  // vmovdqu8	zmm5{k1}{z}, zmmword ptr [rsi]
+	VMOVDQU8.Z 0(AX), K1, Z4                        // <--                                  // vmovdqu8	zmm4{k1}{z}, zmmword ptr [rax]
+	VPADDB     Z3, Z5, Z7                           // <--                                  // vpaddb	zmm7, zmm5, zmm3
+	LONG       $0x4845f362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z7, K1                 // vpcmpltub	k1, zmm7, zmm2
+	LONG       $0x48fdf162; WORD $0xfd6f            // VMOVDQA64 Z5, Z7                     // vmovdqa64	zmm7, zmm5
+	VPADDB     Z1, Z5, K1, Z7                       // <--                                  // vpaddb	zmm7{k1}, zmm5, zmm1
+	LONG       $0x4845f362; WORD $0xc43f; BYTE $0x4 // VPCMPNEQB Z4, Z7, K0                 // vpcmpneqb	k0, zmm7, zmm4
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB7_26                              // <--                                  // jne	.LBB7_26
+	MOVQ       0x20(BP), DX                         // <--                                  // mov	rdx, qword ptr [rbp + 32]
+
+LBB7_30:
+	MOVQ DI, 0(DX)(R11*8) // <--                                  // mov	qword ptr [rdx + r11*8], rdi
+	ADDQ $0x1, R11        // <--                                  // add	r11, 1
+	CMPQ 0x28(BP), R11    // <--                                  // cmp	qword ptr [rbp + 40], r11
+	JE   LBB7_18          // <--                                  // je	.LBB7_18
+	LEAQ 0(R9)(DI*1), R13 // <--                                  // lea	r13, [r9 + rdi]
+	JMP  LBB7_20          // <--                                  // jmp	.LBB7_20
+
+LBB7_31:
+	MOVQ R10, AX // <--                                  // mov	rax, r10
+	MOVQ R9, CX  // <--                                  // mov	rcx, r9
+	JMP  LBB7_29 // <--                                  // jmp	.LBB7_29
+
+LBB7_32:
+	MOVQ         0x18(SP), BX     // <--                                  // mov	rbx, qword ptr [rsp + 24]
+	LEAQ         0x1(DI), SI      // <--                                  // lea	rsi, [rdi + 1]
+	LEAQ         0(R15)(SI*1), DI // <--                                  // lea	rdi, [r15 + rsi]
+	SUBQ         SI, BX           // <--                                  // sub	rbx, rsi
+	CMPQ         R9, BX           // <--                                  // cmp	r9, rbx
+	JG           LBB7_18          // <--                                  // jg	.LBB7_18
+	MOVL         $-0x41, AX       // <--                                  // mov	eax, -65
+	MOVQ         BX, R12          // <--                                  // mov	r12, rbx
+	MOVQ         R15, R14         // <--                                  // mov	r14, r15
+	VPBROADCASTB AX, Z3           // <--                                  // vpbroadcastb	zmm3, eax
+	MOVL         $0x1a, AX        // <--                                  // mov	eax, 26
+	VPBROADCASTB AX, Z2           // <--                                  // vpbroadcastb	zmm2, eax
+	MOVL         $0x20, AX        // <--                                  // mov	eax, 32
+	VPBROADCASTB AX, Z1           // <--                                  // vpbroadcastb	zmm1, eax
+
+LBB7_33:
+	SUBQ R9, R12        // <--                                  // sub	r12, r9
+	MOVQ R9, AX         // <--                                  // mov	rax, r9
+	MOVL $0x1000193, DX // <--                                  // mov	edx, 16777619
+	MOVL $0x1, R15      // <--                                  // mov	r15d, 1
+
+LBB7_34:
+	WORD  $0x1a8  // TESTB $0x1, AX                       // test	al, 1
+	JE    LBB7_35 // <--                                  // je	.LBB7_35
+	IMULL DX, R15 // <--                                  // imul	r15d, edx
+
+LBB7_35:
+	IMULL DX, DX   // <--                                  // imul	edx, edx
+	SHRQ  $0x1, AX // <--                                  // shr	rax, 1
+	JNE   LBB7_34  // <--                                  // jne	.LBB7_34
+	XORL  AX, AX   // <--                                  // xor	eax, eax
+	XORL  CX, CX   // <--                                  // xor	ecx, ecx
+	XORL  R8, R8   // <--                                  // xor	r8d, r8d
+
+LBB7_36:
+	LONG    $0x93c06945; WORD $0x1; BYTE $0x1 // IMULL $0x1000193, R8, R8             // imul	r8d, r8d, 16777619
+	MOVBLZX 0(R10)(CX*1), DX                  // <--                                  // movzx	edx, byte ptr [r10 + rcx]
+	ADDL    DX, R8                            // <--                                  // add	r8d, edx
+	LONG    $0x193d069; WORD $0x100           // IMULL $0x1000193, AX, DX             // imul	edx, eax, 16777619
+	MOVBLZX 0(DI)(CX*1), AX                   // <--                                  // movzx	eax, byte ptr [rdi + rcx]
+	LEAL    -0x41(AX), R13                    // <--                                  // lea	r13d, [rax - 65]
+	LEAL    0x20(AX), BX                      // <--                                  // lea	ebx, [rax + 32]
+	CMPB    R13, $0x1a                        // <--                                  // cmp	r13b, 26
+	CMOVLCS BX, AX                            // <--                                  // cmovb	eax, ebx
+	ADDQ    $0x1, CX                          // <--                                  // add	rcx, 1
+	MOVBLZX AX, AX                            // <--                                  // movzx	eax, al
+	ADDL    DX, AX                            // <--                                  // add	eax, edx
+	CMPQ    R9, CX                            // <--                                  // cmp	r9, rcx
+	JG      LBB7_36                           // <--                                  // jg	.LBB7_36
+	VMOVQ   R14, X4                           // <--                                  // vmovq	xmm4, r14
+	MOVQ    SI, 0x38(SP)                      // <--                                  // mov	qword ptr [rsp + 56], rsi
+	ADDQ    $0x1, R12                         // <--                                  // add	r12, 1
+	XORL    BX, BX                            // <--                                  // xor	ebx, ebx
+	MOVL    $0x1, R13                         // <--                                  // mov	r13d, 1
+	MOVL    R15, R14                          // <--                                  // mov	r14d, r15d
+	JMP     LBB7_38                           // <--                                  // jmp	.LBB7_38
+
+LBB7_37:
+	ADDQ    $0x1, BX                // <--                                  // add	rbx, 1
+	CMPQ    BX, R12                 // <--                                  // cmp	rbx, r12
+	JE      LBB7_18                 // <--                                  // je	.LBB7_18
+	LONG    $0x193d069; WORD $0x100 // IMULL $0x1000193, AX, DX             // imul	edx, eax, 16777619
+	MOVBLZX 0(DI), AX               // <--                                  // movzx	eax, byte ptr [rdi]
+	LEAL    -0x41(AX), R15          // <--                                  // lea	r15d, [rax - 65]
+	LEAL    0x20(AX), CX            // <--                                  // lea	ecx, [rax + 32]
+	CMPB    R15, $0x1a              // <--                                  // cmp	r15b, 26
+	CMOVLCS CX, AX                  // <--                                  // cmovb	eax, ecx
+	MOVBLZX AX, AX                  // <--                                  // movzx	eax, al
+	IMULL   R14, AX                 // <--                                  // imul	eax, r14d
+	SUBL    AX, DX                  // <--                                  // sub	edx, eax
+	MOVBLZX 0(DI)(R9*1), AX         // <--                                  // movzx	eax, byte ptr [rdi + r9]
+	LEAL    -0x41(AX), R15          // <--                                  // lea	r15d, [rax - 65]
+	LEAL    0x20(AX), CX            // <--                                  // lea	ecx, [rax + 32]
+	CMPB    R15, $0x1a              // <--                                  // cmp	r15b, 26
+	CMOVLCS CX, AX                  // <--                                  // cmovb	eax, ecx
+	ADDQ    $0x1, DI                // <--                                  // add	rdi, 1
+	MOVBLZX AX, AX                  // <--                                  // movzx	eax, al
+	ADDL    DX, AX                  // <--                                  // add	eax, edx
+
+LBB7_38:
+	CMPL R8, AX       // <--                                  // cmp	r8d, eax
+	JNE  LBB7_37      // <--                                  // jne	.LBB7_37
+	MOVQ DI, R15      // <--                                  // mov	r15, rdi
+	MOVQ R9, CX       // <--                                  // mov	rcx, r9
+	MOVQ R10, DX      // <--                                  // mov	rdx, r10
+	CMPQ R9, $0x3f    // <--                                  // cmp	r9, 63
+	JLE  LBB7_16      // <--                                  // jle	.LBB7_16
+	MOVQ 0x38(SP), SI // <--                                  // mov	rsi, qword ptr [rsp + 56]
+	JMP  LBB7_40      // <--                                  // jmp	.LBB7_40
+
+LBB7_39:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R15 // <--                                  // add	r15, 64
+	ADDQ $0x40, DX  // <--                                  // add	rdx, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB7_15    // <--                                  // jle	.LBB7_15
+
+LBB7_40:
+	VPADDB   0(R15), Z3, Z0                       // <--                                  // vpaddb	zmm0, zmm3, zmmword ptr [r15]
+	LONG     $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VMOVDQU8 0(R15), Z0                           // <--                                  // vmovdqu8	zmm0, zmmword ptr [r15]
+	VPADDB   Z0, Z1, K1, Z0                       // <--                                  // vpaddb	zmm0{k1}, zmm1, zmm0
+	LONG     $0x487df362; WORD $0x23f; BYTE $0x4  // VPCMPNEQB 0(DX), Z0, K0              // vpcmpneqb	k0, zmm0, zmmword ptr [rdx]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JE       LBB7_39                              // <--                                  // je	.LBB7_39
+	MOVQ     SI, 0x38(SP)                         // <--                                  // mov	qword ptr [rsp + 56], rsi
+	JMP      LBB7_37                              // <--                                  // jmp	.LBB7_37
+
+LBB7_41:
+	ADDQ CX, DI // <--                                  // add	rdi, rcx
+	JMP  LBB7_0 // <--                                  // jmp	.LBB7_0
+
+LBB7_42:
+	ADDQ CX, R13 // <--                                  // add	r13, rcx
+	JMP  LBB7_20 // <--                                  // jmp	.LBB7_20
+
+TEXT ·indexWordExactAvx512(SB), NOSPLIT, $208-80
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	MOVQ         boundary+64(FP), AX
+	MOVQ         AX, 24(SP)
+	PUSHQ        BP            // <--                                  // push	rbp
+	MOVQ         SP, BP        // <--                                  // mov	rbp, rsp
+	PUSHQ        R15           // <--                                  // push	r15
+	PUSHQ        R14           // <--                                  // push	r14
+	PUSHQ        R13           // <--                                  // push	r13
+	PUSHQ        R12           // <--                                  // push	r12
+	PUSHQ        BX            // <--                                  // push	rbx
+	ANDQ         $-0x40, SP    // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP     // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R11 // <--                                  // mov	r11, qword ptr [rbp + 24]
+	CMPQ         SI, R11       // <--                                  // cmp	rsi, r11
+	JL           LBB8_43       // <--                                  // jl	.LBB8_43
+	MOVQ         SI, R12       // <--                                  // mov	r12, rsi
+	XORL         SI, SI        // <--                                  // xor	esi, esi
+	TESTQ        R11, R11      // <--                                  // test	r11, r11
+	JLE          LBB8_14       // <--                                  // jle	.LBB8_14
+	MOVQ         CX, AX        // <--                                  // mov	rax, rcx
+	MOVQ         R12, R14      // <--                                  // mov	r14, r12
+	XORL         R13, R13      // <--                                  // xor	r13d, r13d
+	MOVL         $0x1, R15     // <--                                  // mov	r15d, 1
+	ADDQ         DI, AX        // <--                                  // add	rax, rdi
+	SUBQ         R11, R14      // <--                                  // sub	r14, r11
+	VPBROADCASTB DX, Z1        // <--                                  // vpbroadcastb	zmm1, edx
+	ADDQ         $0x1, R14     // <--                                  // add	r14, 1
+	MOVQ         AX, DX        // <--                                  // mov	rdx, rax
+	MOVQ         R13, AX       // <--                                  // mov	rax, r13
+
+LBB8_0:
+	LEAQ     0xff(R13), CX    // <--                                  // lea	rcx, [r13 + 255]
+	CMPQ     R14, CX          // <--                                  // cmp	r14, rcx
+	JLE      LBB8_1           // <--                                  // jle	.LBB8_1
+	LEAQ     0(DX)(R13*1), SI // <--                                  // lea	rsi, [rdx + r13]
+	VPCMPEQB 0(SI), Z1, K0    // <--                                  // vpcmpeqb	k0, zmm1, zmmword ptr [rsi]
+	VPCMPEQB 0x40(SI), Z1, K1 // <--                                  // vpcmpeqb	k1, zmm1, zmmword ptr [rsi + 64]
+	VPCMPEQB 0x80(SI), Z1, K2 // <--                                  // vpcmpeqb	k2, zmm1, zmmword ptr [rsi + 128]
+	VPCMPEQB 0xc0(SI), Z1, K3 // <--                                  // vpcmpeqb	k3, zmm1, zmmword ptr [rsi + 192]
+	KMOVQ    K1, CX           // <--                                  // kmovq	rcx, k1
+	KMOVQ    K0, BX           // <--                                  // kmovq	rbx, k0
+	ORQ      BX, CX           // <--                                  // or	rcx, rbx
+	KMOVQ    K2, R10          // <--                                  // kmovq	r10, k2
+	ORQ      R10, CX          // <--                                  // or	rcx, r10
+	KMOVQ    K3, SI           // <--                                  // kmovq	rsi, k3
+	ORQ      SI, CX           // <--                                  // or	rcx, rsi
+	JE       LBB8_16          // <--                                  // je	.LBB8_16
+
+LBB8_1:
+	LEAQ       0x3f(R13), CX                        // <--                                  // lea	rcx, [r13 + 63]
+	CMPQ       R14, CX                              // <--                                  // cmp	r14, rcx
+	JG         LBB8_15                              // <--                                  // jg	.LBB8_15
+	CMPQ       R14, R13                             // <--                                  // cmp	r14, r13
+	JLE        LBB8_42                              // <--                                  // jle	.LBB8_42
+	MOVQ       R14, R10                             // <--                                  // mov	r10, r14
+	MOVL       $0x1, BX                             // <--                                  // mov	ebx, 1
+	SUBQ       R13, R10                             // <--                                  // sub	r10, r13
+	MOVL       R10, CX                              // <--                                  // mov	ecx, r10d
+	SHLQ       CX, BX                               // <--                                  // shl	rbx, cl
+	SUBQ       $0x1, BX                             // <--                                  // sub	rbx, 1
+	KMOVQ      BX, K1                               // <--                                  // kmovq	k1, rbx
+	VMOVDQU8.Z 0(DX)(R13*1), K1, Z2                 // <--                                  // vmovdqu8	zmm2{k1}{z}, zmmword ptr [rdx + r13]
+	LONG       $0x496df362; WORD $0xe93f; BYTE $0x0 // VPCMPEQB Z1, Z2, K1, K5              // vpcmpeqb	k5{k1}, zmm2, zmm1
+	KMOVQ      K5, BX                               // <--                                  // kmovq	rbx, k5
+
+LBB8_2:
+	TESTQ BX, BX        // <--                                  // test	rbx, rbx
+	JE    LBB8_8        // <--                                  // je	.LBB8_8
+	MOVQ  R10, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], r10
+	MOVQ  BX, R10       // <--                                  // mov	r10, rbx
+	KMOVD R8, K7        // <--                                  // kmovd	k7, r8d
+	MOVQ  R9, 0x38(SP)  // <--                                  // mov	qword ptr [rsp + 56], r9
+	MOVQ  DX, R9        // <--                                  // mov	r9, rdx
+	MOVQ  R13, DX       // <--                                  // mov	rdx, r13
+	MOVQ  AX, R13       // <--                                  // mov	r13, rax
+
+LBB8_3:
+	XORL   AX, AX          // <--                                  // xor	eax, eax
+	TZCNTQ R10, AX         // <--                                  // tzcnt	rax, r10
+	CDQE                   // <--                                  // cdqe
+	ADDQ   DX, AX          // <--                                  // add	rax, rdx
+	LEAQ   0(DI)(AX*1), SI // <--                                  // lea	rsi, [rdi + rax]
+	CMPQ   R11, $0x3f      // <--                                  // cmp	r11, 63
+	JLE    LBB8_17         // <--                                  // jle	.LBB8_17
+	MOVQ   0x10(BP), BX    // <--                                  // mov	rbx, qword ptr [rbp + 16]
+	MOVQ   R11, CX         // <--                                  // mov	rcx, r11
+	KMOVD  K7, R8          // <--                                  // kmovd	r8d, k7
+	JMP    LBB8_5          // <--                                  // jmp	.LBB8_5
+
+LBB8_4:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, SI // <--                                  // add	rsi, 64
+	ADDQ $0x40, BX // <--                                  // add	rbx, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB8_9    // <--                                  // jle	.LBB8_9
+
+LBB8_5:
+	VMOVDQU8 0(SI), Z0                           // <--                                  // vmovdqu8	zmm0, zmmword ptr [rsi]
+	LONG     $0x487df362; WORD $0x33f; BYTE $0x4 // VPCMPNEQB 0(BX), Z0, K0              // vpcmpneqb	k0, zmm0, zmmword ptr [rbx]
+	KORTESTQ K0, K0                              // <--                                  // kortestq	k0, k0
+	JE       LBB8_4                              // <--                                  // je	.LBB8_4
+	KMOVD    R8, K7                              // <--                                  // kmovd	k7, r8d
+
+LBB8_6:
+	MOVQ AX, CX    // <--                                  // mov	rcx, rax
+	ADDQ $0x1, R13 // <--                                  // add	r13, 1
+	SARQ $0x8, CX  // <--                                  // sar	rcx, 8
+	ADDQ $0x4, CX  // <--                                  // add	rcx, 4
+	CMPQ R13, CX   // <--                                  // cmp	r13, rcx
+	JG   LBB8_18   // <--                                  // jg	.LBB8_18
+
+LBB8_7:
+	LEAQ  -0x1(R10), AX // <--                                  // lea	rax, [r10 - 1]
+	ANDQ  AX, R10       // <--                                  // and	r10, rax
+	TESTQ R10, R10      // <--                                  // test	r10, r10
+	JNE   LBB8_3        // <--                                  // jne	.LBB8_3
+	MOVQ  R13, AX       // <--                                  // mov	rax, r13
+	MOVQ  0x30(SP), R10 // <--                                  // mov	r10, qword ptr [rsp + 48]
+	MOVQ  DX, R13       // <--                                  // mov	r13, rdx
+	MOVQ  R9, DX        // <--                                  // mov	rdx, r9
+	MOVQ  0x38(SP), R9  // <--                                  // mov	r9, qword ptr [rsp + 56]
+	KMOVD K7, R8        // <--                                  // kmovd	r8d, k7
+
+LBB8_8:
+	ADDQ R10, R13 // <--                                  // add	r13, r10
+	JMP  LBB8_0   // <--                                  // jmp	.LBB8_0
+
+LBB8_9:
+	KMOVD R8, K7  // <--                                  // kmovd	k7, r8d
+	TESTQ CX, CX  // <--                                  // test	rcx, rcx
+	JE    LBB8_11 // <--                                  // je	.LBB8_11
+
+LBB8_10:
+	MOVQ       R15, R8                              // <--                                  // mov	r8, r15
+	SHLQ       CX, R8                               // <--                                  // shl	r8, cl
+	MOVQ       R8, CX                               // <--                                  // mov	rcx, r8
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(SI), K1, Z2                        // <--                                  // vmovdqu8	zmm2{k1}{z}, zmmword ptr [rsi]
+	VMOVDQU8.Z 0(BX), K1, Z3                        // <--                                  // vmovdqu8	zmm3{k1}{z}, zmmword ptr [rbx]
+	LONG       $0x486df362; WORD $0xc33f; BYTE $0x4 // VPCMPNEQB Z3, Z2, K0                 // vpcmpneqb	k0, zmm2, zmm3
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB8_6                               // <--                                  // jne	.LBB8_6
+
+LBB8_11:
+	TESTQ   AX, AX             // <--                                  // test	rax, rax
+	JE      LBB8_12            // <--                                  // je	.LBB8_12
+	MOVBLZX -0x1(DI)(AX*1), CX // <--                                  // movzx	ecx, byte ptr [rdi + rax - 1]
+	MOVQ    0x20(BP), BX       // <--                                  // mov	rbx, qword ptr [rbp + 32]
+	MOVL    CX, SI             // <--                                  // mov	esi, ecx
+	SHRB    $0x6, SI           // <--                                  // shr	sil, 6
+	MOVBLZX SI, SI             // <--                                  // movzx	esi, sil
+	MOVQ    0(BX)(SI*8), SI    // <--                                  // mov	rsi, qword ptr [rbx + rsi*8]
+	SHRQ    CX, SI             // <--                                  // shr	rsi, cl
+	ANDL    $0x1, SI           // <--                                  // and	esi, 1
+	JE      LBB8_7             // <--                                  // je	.LBB8_7
+
+LBB8_12:
+	LEAQ    0(R11)(AX*1), CX // <--                                  // lea	rcx, [r11 + rax]
+	CMPQ    R12, CX          // <--                                  // cmp	r12, rcx
+	JE      LBB8_13          // <--                                  // je	.LBB8_13
+	MOVBLZX 0(DI)(CX*1), CX  // <--                                  // movzx	ecx, byte ptr [rdi + rcx]
+	MOVQ    0x20(BP), BX     // <--                                  // mov	rbx, qword ptr [rbp + 32]
+	MOVL    CX, SI           // <--                                  // mov	esi, ecx
+	SHRB    $0x6, SI         // <--                                  // shr	sil, 6
+	MOVBLZX SI, SI           // <--                                  // movzx	esi, sil
+	MOVQ    0(BX)(SI*8), SI  // <--                                  // mov	rsi, qword ptr [rbx + rsi*8]
+	SHRQ    CX, SI           // <--                                  // shr	rsi, cl
+	ANDL    $0x1, SI         // <--                                  // and	esi, 1
+	JE      LBB8_7           // <--                                  // je	.LBB8_7
+
+LBB8_13:
+	MOVQ       AX, SI // <--                                  // mov	rsi, rax
+	VZEROUPPER        // <--                                  // vzeroupper
+
+LBB8_14:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	MOVQ SI, AX         // <--                                  // mov	rax, rsi
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+72(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB8_15:
+	VPCMPEQB 0(DX)(R13*1), Z1, K4 // <--                                  // vpcmpeqb	k4, zmm1, zmmword ptr [rdx + r13]
+	MOVL     $0x40, R10           // <--                                  // mov	r10d, 64
+	KMOVQ    K4, BX               // <--                                  // kmovq	rbx, k4
+	JMP      LBB8_2               // <--                                  // jmp	.LBB8_2
+
+LBB8_16:
+	ADDQ $0x100, R13 // <--                                  // add	r13, 256
+	JMP  LBB8_0      // <--                                  // jmp	.LBB8_0
+
+LBB8_17:
+	MOVQ 0x10(BP), BX // <--                                  // mov	rbx, qword ptr [rbp + 16]
+	MOVQ R11, CX      // <--                                  // mov	rcx, r11
+	JMP  LBB8_10      // <--                                  // jmp	.LBB8_10
+
+LBB8_18:
+	MOVQ         AX, SI          // <--                                  // mov	rsi, rax
+	MOVQ         R9, AX          // <--                                  // mov	rax, r9
+	XORL         R15, R15        // <--                                  // xor	r15d, r15d
+	MOVQ         0x38(SP), R9    // <--                                  // mov	r9, qword ptr [rsp + 56]
+	CMPQ         R11, $0x3f      // <--                                  // cmp	r11, 63
+	KMOVD        K7, R8          // <--                                  // kmovd	r8d, k7
+	LEAQ         0x1(SI), BX     // <--                                  // lea	rbx, [rsi + 1]
+	VPBROADCASTB R8, Z2          // <--                                  // vpbroadcastb	zmm2, r8d
+	LEAQ         0(DI)(R9*1), DX // <--                                  // lea	rdx, [rdi + r9]
+	SETLE        R15             // <--                                  // setle	r15b
+	MOVQ         AX, R8          // <--                                  // mov	r8, rax
+	XORL         R13, R13        // <--                                  // xor	r13d, r13d
+	MOVQ         DX, 0x30(SP)    // <--                                  // mov	qword ptr [rsp + 48], rdx
+	MOVL         $0x1, R10       // <--                                  // mov	r10d, 1
+	VMOVQ        DI, X3          // <--                                  // vmovq	xmm3, rdi
+	MOVQ         R12, AX         // <--                                  // mov	rax, r12
+	LEAQ         0x4(R15*4), R15 // <--                                  // lea	r15, [r15*4 + 4]
+	VMOVQ        R15, X7         // <--                                  // vmovq	xmm7, r15
+
+LBB8_19:
+	LEAQ     0x3f(BX), DX            // <--                                  // lea	rdx, [rbx + 63]
+	CMPQ     R14, DX                 // <--                                  // cmp	r14, rdx
+	JLE      LBB8_44                 // <--                                  // jle	.LBB8_44
+	MOVQ     0x30(SP), DI            // <--                                  // mov	rdi, qword ptr [rsp + 48]
+	MOVL     $0x40, R9               // <--                                  // mov	r9d, 64
+	VPCMPEQB 0(DI)(BX*1), Z2, K1     // <--                                  // vpcmpeqb	k1, zmm2, zmmword ptr [rdi + rbx]
+	VPCMPEQB 0(R8)(BX*1), Z1, K1, K6 // <--                                  // vpcmpeqb	k6{k1}, zmm1, zmmword ptr [r8 + rbx]
+	KMOVQ    K6, DI                  // <--                                  // kmovq	rdi, k6
+
+LBB8_20:
+	TESTQ DI, DI       // <--                                  // test	rdi, rdi
+	JE    LBB8_26      // <--                                  // je	.LBB8_26
+	MOVQ  R8, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], r8
+	VMOVQ X7, R12      // <--                                  // vmovq	r12, xmm7
+	VMOVQ X3, R15      // <--                                  // vmovq	r15, xmm3
+	MOVQ  R9, 0x28(SP) // <--                                  // mov	qword ptr [rsp + 40], r9
+	MOVQ  R14, R9      // <--                                  // mov	r9, r14
+	MOVQ  AX, R14      // <--                                  // mov	r14, rax
+
+LBB8_21:
+	XORL    SI, SI           // <--                                  // xor	esi, esi
+	MOVQ    0x10(BP), DX     // <--                                  // mov	rdx, qword ptr [rbp + 16]
+	MOVQ    R11, CX          // <--                                  // mov	rcx, r11
+	TZCNTQ  DI, SI           // <--                                  // tzcnt	rsi, rdi
+	MOVLQSX SI, SI           // <--                                  // movsxd	rsi, esi
+	ADDQ    BX, SI           // <--                                  // add	rsi, rbx
+	LEAQ    0(R15)(SI*1), AX // <--                                  // lea	rax, [r15 + rsi]
+	CMPQ    R11, $0x3f       // <--                                  // cmp	r11, 63
+	JLE     LBB8_28          // <--                                  // jle	.LBB8_28
+	MOVQ    0x38(SP), R8     // <--                                  // mov	r8, qword ptr [rsp + 56]
+	JMP     LBB8_23          // <--                                  // jmp	.LBB8_23
+
+LBB8_22:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, AX // <--                                  // add	rax, 64
+	ADDQ $0x40, DX // <--                                  // add	rdx, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB8_27   // <--                                  // jle	.LBB8_27
+
+LBB8_23:
+	VMOVDQU8 0(AX), Z6                           // <--                                  // vmovdqu8	zmm6, zmmword ptr [rax]
+	LONG     $0x484df362; WORD $0x23f; BYTE $0x4 // VPCMPNEQB 0(DX), Z6, K0              // vpcmpneqb	k0, zmm6, zmmword ptr [rdx]
+	KORTESTQ K0, K0                              // <--                                  // kortestq	k0, k0
+	JE       LBB8_22                             // <--                                  // je	.LBB8_22
+	MOVQ     R8, 0x38(SP)                        // <--                                  // mov	qword ptr [rsp + 56], r8
+
+LBB8_24:
+	ADDQ $0x1, R13 // <--                                  // add	r13, 1
+	CMPQ R13, R12  // <--                                  // cmp	r13, r12
+	JG   LBB8_31   // <--                                  // jg	.LBB8_31
+
+LBB8_25:
+	LEAQ  -0x1(DI), AX // <--                                  // lea	rax, [rdi - 1]
+	ANDQ  AX, DI       // <--                                  // and	rdi, rax
+	TESTQ DI, DI       // <--                                  // test	rdi, rdi
+	JNE   LBB8_21      // <--                                  // jne	.LBB8_21
+	MOVQ  R14, AX      // <--                                  // mov	rax, r14
+	MOVQ  0x38(SP), R8 // <--                                  // mov	r8, qword ptr [rsp + 56]
+	MOVQ  R9, R14      // <--                                  // mov	r14, r9
+	MOVQ  0x28(SP), R9 // <--                                  // mov	r9, qword ptr [rsp + 40]
+
+LBB8_26:
+	ADDQ R9, BX  // <--                                  // add	rbx, r9
+	JMP  LBB8_19 // <--                                  // jmp	.LBB8_19
+
+LBB8_27:
+	MOVQ  R8, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], r8
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB8_29      // <--                                  // je	.LBB8_29
+
+LBB8_28:
+	MOVQ       R10, R8                              // <--                                  // mov	r8, r10
+	SHLQ       CX, R8                               // <--                                  // shl	r8, cl
+	MOVQ       R8, CX                               // <--                                  // mov	rcx, r8
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(AX), K1, Z4                        // <--                                  // vmovdqu8	zmm4{k1}{z}, zmmword ptr [rax]
+	VMOVDQU8.Z 0(DX), K1, Z5                        // <--                                  // vmovdqu8	zmm5{k1}{z}, zmmword ptr [rdx]
+	LONG       $0x485df362; WORD $0xc53f; BYTE $0x4 // VPCMPNEQB Z5, Z4, K0                 // vpcmpneqb	k0, zmm4, zmm5
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB8_24                              // <--                                  // jne	.LBB8_24
+
+LBB8_29:
+	MOVBLZX -0x1(R15)(SI*1), CX // <--                                  // movzx	ecx, byte ptr [r15 + rsi - 1]
+	MOVQ    0x20(BP), DX        // <--                                  // mov	rdx, qword ptr [rbp + 32]
+	MOVL    CX, AX              // <--                                  // mov	eax, ecx
+	SHRB    $0x6, AX            // <--                                  // shr	al, 6
+	MOVBLZX AX, AX              // <--                                  // movzx	eax, al
+	MOVQ    0(DX)(AX*8), AX     // <--                                  // mov	rax, qword ptr [rdx + rax*8]
+	SHRQ    CX, AX              // <--                                  // shr	rax, cl
+	WORD    $0x1a8              // TESTB $0x1, AX                       // test	al, 1
+	JE      LBB8_25             // <--                                  // je	.LBB8_25
+	LEAQ    0(R11)(SI*1), AX    // <--                                  // lea	rax, [r11 + rsi]
+	CMPQ    R14, AX             // <--                                  // cmp	r14, rax
+	JE      LBB8_30             // <--                                  // je	.LBB8_30
+	MOVBLZX 0(R15)(AX*1), CX    // <--                                  // movzx	ecx, byte ptr [r15 + rax]
+	MOVL    CX, AX              // <--                                  // mov	eax, ecx
+	SHRB    $0x6, AX            // <--                                  // shr	al, 6
+	MOVBLZX AX, AX              // <--                                  // movzx	eax, al
+	MOVQ    0(DX)(AX*8), AX     // <--                                  // mov	rax, qword ptr [rdx + rax*8]
+	SHRQ    CX, AX              // <--                                  // shr	rax, cl
+	WORD    $0x1a8              // TESTB $0x1, AX                       // test	al, 1
+	JE      LBB8_25             // <--                                  // je	.LBB8_25
+
+LBB8_30:
+	VZEROUPPER         // <--                                  // vzeroupper
+	JMP        LBB8_14 // <--                                  // jmp	.LBB8_14
+
+LBB8_31:
+	LEAQ 0x1(SI), R9      // <--                                  // lea	r9, [rsi + 1]
+	MOVQ R14, AX          // <--                                  // mov	rax, r14
+	MOVQ R14, R12         // <--                                  // mov	r12, r14
+	MOVQ R15, DI          // <--                                  // mov	rdi, r15
+	SUBQ R9, AX           // <--                                  // sub	rax, r9
+	MOVQ 0x20(BP), R14    // <--                                  // mov	r14, qword ptr [rbp + 32]
+	LEAQ 0(R15)(R9*1), SI // <--                                  // lea	rsi, [r15 + r9]
+	CMPQ R11, AX          // <--                                  // cmp	r11, rax
+	JG   LBB8_42          // <--                                  // jg	.LBB8_42
+
+LBB8_32:
+	SUBQ R11, AX        // <--                                  // sub	rax, r11
+	MOVQ R11, DX        // <--                                  // mov	rdx, r11
+	MOVL $0x1, R15      // <--                                  // mov	r15d, 1
+	MOVQ AX, R8         // <--                                  // mov	r8, rax
+	MOVL $0x1000193, AX // <--                                  // mov	eax, 16777619
+
+LBB8_33:
+	TESTB $0x1, DX // <--                                  // test	dl, 1
+	JE    LBB8_34  // <--                                  // je	.LBB8_34
+	IMULL AX, R15  // <--                                  // imul	r15d, eax
+
+LBB8_34:
+	IMULL AX, AX         // <--                                  // imul	eax, eax
+	SHRQ  $0x1, DX       // <--                                  // shr	rdx, 1
+	JNE   LBB8_33        // <--                                  // jne	.LBB8_33
+	MOVL  $0x0, 0x38(SP) // <--                                  // mov	dword ptr [rsp + 56], 0
+	XORL  AX, AX         // <--                                  // xor	eax, eax
+	XORL  DX, DX         // <--                                  // xor	edx, edx
+
+LBB8_35:
+	MOVQ    0x10(BP), BX                 // <--                                  // mov	rbx, qword ptr [rbp + 16]
+	LONG    $0x38244c69; LONG $0x1000193 // IMULL $0x1000193, 0x38(SP), CX       // imul	ecx, dword ptr [rsp + 56], 16777619
+	LONG    $0x193c069; WORD $0x100      // IMULL $0x1000193, AX, AX             // imul	eax, eax, 16777619
+	MOVBLZX 0(BX)(DX*1), R10             // <--                                  // movzx	r10d, byte ptr [rbx + rdx]
+	LEAL    0(R10)(CX*1), BX             // <--                                  // lea	ebx, [r10 + rcx]
+	MOVBLZX 0(SI)(DX*1), CX              // <--                                  // movzx	ecx, byte ptr [rsi + rdx]
+	ADDQ    $0x1, DX                     // <--                                  // add	rdx, 1
+	MOVL    BX, 0x38(SP)                 // <--                                  // mov	dword ptr [rsp + 56], ebx
+	ADDL    CX, AX                       // <--                                  // add	eax, ecx
+	CMPQ    R11, DX                      // <--                                  // cmp	r11, rdx
+	JNE     LBB8_35                      // <--                                  // jne	.LBB8_35
+	ADDQ    $0x1, R8                     // <--                                  // add	r8, 1
+	MOVQ    R14, 0x20(BP)                // <--                                  // mov	qword ptr [rbp + 32], r14
+	XORL    BX, BX                       // <--                                  // xor	ebx, ebx
+	MOVQ    R12, R14                     // <--                                  // mov	r14, r12
+	MOVQ    R9, R12                      // <--                                  // mov	r12, r9
+	MOVQ    R8, R9                       // <--                                  // mov	r9, r8
+	MOVQ    DX, R8                       // <--                                  // mov	r8, rdx
+	JMP     LBB8_37                      // <--                                  // jmp	.LBB8_37
+
+LBB8_36:
+	ADDQ    $0x1, BX                // <--                                  // add	rbx, 1
+	CMPQ    BX, R9                  // <--                                  // cmp	rbx, r9
+	JE      LBB8_42                 // <--                                  // je	.LBB8_42
+	LONG    $0x193c069; WORD $0x100 // IMULL $0x1000193, AX, AX             // imul	eax, eax, 16777619
+	MOVBLZX 0(SI)(R11*1), DX        // <--                                  // movzx	edx, byte ptr [rsi + r11]
+	ADDQ    $0x1, SI                // <--                                  // add	rsi, 1
+	ADDL    DX, AX                  // <--                                  // add	eax, edx
+	MOVBLZX -0x1(SI), DX            // <--                                  // movzx	edx, byte ptr [rsi - 1]
+	IMULL   R15, DX                 // <--                                  // imul	edx, r15d
+	SUBL    DX, AX                  // <--                                  // sub	eax, edx
+
+LBB8_37:
+	CMPL 0x38(SP), AX  // <--                                  // cmp	dword ptr [rsp + 56], eax
+	JNE  LBB8_36       // <--                                  // jne	.LBB8_36
+	MOVQ SI, DX        // <--                                  // mov	rdx, rsi
+	CMPQ R8, $0x3f     // <--                                  // cmp	r8, 63
+	JLE  LBB8_45       // <--                                  // jle	.LBB8_45
+	MOVQ 0x10(BP), R13 // <--                                  // mov	r13, qword ptr [rbp + 16]
+	MOVQ R8, CX        // <--                                  // mov	rcx, r8
+
+LBB8_38:
+	VMOVDQU8 0(DX), Z7                    // <--                                  // vmovdqu8	zmm7, zmmword ptr [rdx]
+	LONG     $0x4845d362; LONG $0x400453f // VPCMPNEQB 0(R13), Z7, K0             // vpcmpneqb	k0, zmm7, zmmword ptr [r13 + 0]
+	KORTESTQ K0, K0                       // <--                                  // kortestq	k0, k0
+	JNE      LBB8_36                      // <--                                  // jne	.LBB8_36
+	SUBQ     $0x40, CX                    // <--                                  // sub	rcx, 64
+	ADDQ     $0x40, DX                    // <--                                  // add	rdx, 64
+	ADDQ     $0x40, R13                   // <--                                  // add	r13, 64
+	CMPQ     CX, $0x3f                    // <--                                  // cmp	rcx, 63
+	JG       LBB8_38                      // <--                                  // jg	.LBB8_38
+	TESTQ    CX, CX                       // <--                                  // test	rcx, rcx
+	JE       LBB8_40                      // <--                                  // je	.LBB8_40
+
+LBB8_39:
+	MOVL       $0x1, R10                            // <--                                  // mov	r10d, 1
+	SHLQ       CX, R10                              // <--                                  // shl	r10, cl
+	LEAQ       -0x1(R10), CX                        // <--                                  // lea	rcx, [r10 - 1]
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(DX), K1, Z2                        // <--                                  // vmovdqu8	zmm2{k1}{z}, zmmword ptr [rdx]
+	VMOVDQU8.Z 0(R13), K1, Z3                       // <--                                  // vmovdqu8	zmm3{k1}{z}, zmmword ptr [r13 + 0]
+	LONG       $0x486df362; WORD $0xc33f; BYTE $0x4 // VPCMPNEQB Z3, Z2, K0                 // vpcmpneqb	k0, zmm2, zmm3
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB8_36                              // <--                                  // jne	.LBB8_36
+
+LBB8_40:
+	MOVQ    R12, R9            // <--                                  // mov	r9, r12
+	MOVQ    R14, R12           // <--                                  // mov	r12, r14
+	MOVQ    0x20(BP), R14      // <--                                  // mov	r14, qword ptr [rbp + 32]
+	MOVQ    R8, DX             // <--                                  // mov	rdx, r8
+	LEAQ    0(BX)(R9*1), SI    // <--                                  // lea	rsi, [rbx + r9]
+	MOVBLZX -0x1(DI)(SI*1), CX // <--                                  // movzx	ecx, byte ptr [rdi + rsi - 1]
+	MOVL    CX, AX             // <--                                  // mov	eax, ecx
+	SHRB    $0x6, AX           // <--                                  // shr	al, 6
+	MOVBLZX AX, AX             // <--                                  // movzx	eax, al
+	MOVQ    0(R14)(AX*8), AX   // <--                                  // mov	rax, qword ptr [r14 + rax*8]
+	SHRQ    CX, AX             // <--                                  // shr	rax, cl
+	WORD    $0x1a8             // TESTB $0x1, AX                       // test	al, 1
+	JNE     LBB8_46            // <--                                  // jne	.LBB8_46
+
+LBB8_41:
+	LEAQ 0x1(BX)(R9*1), R9 // <--                                  // lea	r9, [rbx + r9 + 1]
+	MOVQ R12, AX           // <--                                  // mov	rax, r12
+	SUBQ R9, AX            // <--                                  // sub	rax, r9
+	LEAQ 0(DI)(R9*1), SI   // <--                                  // lea	rsi, [rdi + r9]
+	CMPQ AX, DX            // <--                                  // cmp	rax, rdx
+	JGE  LBB8_32           // <--                                  // jge	.LBB8_32
+
+LBB8_42:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB8_43:
+	MOVQ $-0x1, SI // <--                                  // mov	rsi, -1
+	JMP  LBB8_14   // <--                                  // jmp	.LBB8_14
+
+LBB8_44:
+	CMPQ       R14, BX                              // <--                                  // cmp	r14, rbx
+	JLE        LBB8_42                              // <--                                  // jle	.LBB8_42
+	MOVQ       R14, R9                              // <--                                  // mov	r9, r14
+	MOVL       $0x1, DX                             // <--                                  // mov	edx, 1
+	SUBQ       BX, R9                               // <--                                  // sub	r9, rbx
+	MOVL       R9, CX                               // <--                                  // mov	ecx, r9d
+	SHLQ       CX, DX                               // <--                                  // shl	rdx, cl
+	LEAQ       -0x1(DX), DI                         // <--                                  // lea	rdi, [rdx - 1]
+	KMOVQ      DI, K1                               // <--                                  // kmovq	k1, rdi
+	MOVQ       0x30(SP), DI                         // <--                                  // mov	rdi, qword ptr [rsp + 48]
+	VMOVDQU8.Z 0(R8)(BX*1), K1, Z4                  // <--                                  // vmovdqu8	zmm4{k1}{z}, zmmword ptr [r8 + rbx]
+	LONG       $0x495df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z4, K1, K0              // vpcmpeqb	k0{k1}, zmm4, zmm1
+	VMOVDQU8.Z 0(DI)(BX*1), K1, Z4                  // <--                                  // vmovdqu8	zmm4{k1}{z}, zmmword ptr [rdi + rbx]
+	LONG       $0x495df362; WORD $0xca3f; BYTE $0x0 // VPCMPEQB Z2, Z4, K1, K1              // vpcmpeqb	k1{k1}, zmm4, zmm2
+	KMOVQ      K0, DX                               // <--                                  // kmovq	rdx, k0
+	KMOVQ      K1, DI                               // <--                                  // kmovq	rdi, k1
+	ANDQ       DX, DI                               // <--                                  // and	rdi, rdx
+	JMP        LBB8_20                              // <--                                  // jmp	.LBB8_20
+
+LBB8_45:
+	MOVQ 0x10(BP), R13 // <--                                  // mov	r13, qword ptr [rbp + 16]
+	MOVQ R8, CX        // <--                                  // mov	rcx, r8
+	JMP  LBB8_39       // <--                                  // jmp	.LBB8_39
+
+LBB8_46:
+	LEAQ    0(R8)(SI*1), AX  // <--                                  // lea	rax, [r8 + rsi]
+	CMPQ    R12, AX          // <--                                  // cmp	r12, rax
+	JE      LBB8_30          // <--                                  // je	.LBB8_30
+	MOVBLZX 0(DI)(AX*1), CX  // <--                                  // movzx	ecx, byte ptr [rdi + rax]
+	MOVL    CX, AX           // <--                                  // mov	eax, ecx
+	SHRB    $0x6, AX         // <--                                  // shr	al, 6
+	MOVBLZX AX, AX           // <--                                  // movzx	eax, al
+	MOVQ    0(R14)(AX*8), AX // <--                                  // mov	rax, qword ptr [r14 + rax*8]
+	SHRQ    CX, AX           // <--                                  // shr	rax, cl
+	WORD    $0x1a8           // TESTB $0x1, AX                       // test	al, 1
+	JNE     LBB8_30          // <--                                  // jne	.LBB8_30
+	JMP     LBB8_41          // <--                                  // jmp	.LBB8_41
+
+TEXT ·searchWordFoldAvx512(SB), NOSPLIT, $208-80
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	MOVQ         boundary+64(FP), AX
+	MOVQ         AX, 24(SP)
+	PUSHQ        BP            // <--                                  // push	rbp
+	MOVQ         SP, BP        // <--                                  // mov	rbp, rsp
+	PUSHQ        R15           // <--                                  // push	r15
+	MOVQ         DI, R15       // <--                                  // mov	r15, rdi
+	MOVL         R8, DI        // <--                                  // mov	edi, r8d
+	PUSHQ        R14           // <--                                  // push	r14
+	PUSHQ        R13           // <--                                  // push	r13
+	PUSHQ        R12           // <--                                  // push	r12
+	PUSHQ        BX            // <--                                  // push	rbx
+	ANDQ         $-0x40, SP    // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP     // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R10 // <--                                  // mov	r10, qword ptr [rbp + 24]
+	MOVQ         0x10(BP), R8  // <--                                  // mov	r8, qword ptr [rbp + 16]
+	CMPQ         SI, R10       // <--                                  // cmp	rsi, r10
+	JL           LBB9_43       // <--                                  // jl	.LBB9_43
+	MOVQ         SI, R12       // <--                                  // mov	r12, rsi
+	XORL         SI, SI        // <--                                  // xor	esi, esi
+	TESTQ        R10, R10      // <--                                  // test	r10, r10
+	JLE          LBB9_14       // <--                                  // jle	.LBB9_14
+	MOVQ         R12, R13      // <--                                  // mov	r13, r12
+	MOVQ         CX, AX        // <--                                  // mov	rax, rcx
+	LEAL         -0x61(DX), CX // <--                                  // lea	ecx, [rdx - 97]
+	MOVQ         R9, 0x28(SP)  // <--                                  // mov	qword ptr [rsp + 40], r9
+	SUBQ         R10, R13      // <--                                  // sub	r13, r10
+	VPBROADCASTB DX, Z4        // <--                                  // vpbroadcastb	zmm4, edx
+	MOVL         $-0x41, DX    // <--                                  // mov	edx, -65
+	MOVQ         R8, R9        // <--                                  // mov	r9, r8
+	ADDQ         $0x1, R13     // <--                                  // add	r13, 1
+	CMPB         CX, $0x19     // <--                                  // cmp	cl, 25
+	VPBROADCASTB DX, Z3        // <--                                  // vpbroadcastb	zmm3, edx
+	MOVL         $0x1a, DX     // <--                                  // mov	edx, 26
+	SETLS        CX            // <--                                  // setbe	cl
+	ADDQ         R15, AX       // <--                                  // add	rax, r15
+	XORL         BX, BX        // <--                                  // xor	ebx, ebx
+	MOVL         $0x1, R14     // <--                                  // mov	r14d, 1
+	MOVQ         AX, 0x38(SP)  // <--                                  // mov	qword ptr [rsp + 56], rax
+	SHLL         $0x5, CX      // <--                                  // shl	ecx, 5
+	VPBROADCASTB DX, Z2        // <--                                  // vpbroadcastb	zmm2, edx
+	MOVQ         BX, R8        // <--                                  // mov	r8, rbx
+	MOVL         $0x20, DX     // <--                                  // mov	edx, 32
+	VPBROADCASTB CX, Z6        // <--                                  // vpbroadcastb	zmm6, ecx
+	VPBROADCASTB DX, Z1        // <--                                  // vpbroadcastb	zmm1, edx
+
+LBB9_0:
+	LEAQ  0xff(BX), DX                         // <--                                  // lea	rdx, [rbx + 255]
+	CMPQ  R13, DX                              // <--                                  // cmp	r13, rdx
+	JLE   LBB9_1                               // <--                                  // jle	.LBB9_1
+	MOVQ  0x38(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 56]
+	LEAQ  0(AX)(BX*1), CX                      // <--                                  // lea	rcx, [rax + rbx]
+	VPORD 0(CX), Z6, Z0                        // <--                                  // vpord	zmm0, zmm6, zmmword ptr [rcx]
+	LONG  $0x487df362; WORD $0xc43f; BYTE $0x0 // VPCMPEQB Z4, Z0, K0                  // vpcmpeqb	k0, zmm0, zmm4
+	VPORD 0x40(CX), Z6, Z0                     // <--                                  // vpord	zmm0, zmm6, zmmword ptr [rcx + 64]
+	LONG  $0x487df362; WORD $0xcc3f; BYTE $0x0 // VPCMPEQB Z4, Z0, K1                  // vpcmpeqb	k1, zmm0, zmm4
+	VPORD 0x80(CX), Z6, Z0                     // <--                                  // vpord	zmm0, zmm6, zmmword ptr [rcx + 128]
+	KMOVQ K0, AX                               // <--                                  // kmovq	rax, k0
+	LONG  $0x487df362; WORD $0xd43f; BYTE $0x0 // VPCMPEQB Z4, Z0, K2                  // vpcmpeqb	k2, zmm0, zmm4
+	VPORD 0xc0(CX), Z6, Z0                     // <--                                  // vpord	zmm0, zmm6, zmmword ptr [rcx + 192]
+	KMOVQ K1, DX                               // <--                                  // kmovq	rdx, k1
+	ORQ   AX, DX                               // <--                                  // or	rdx, rax
+	LONG  $0x487df362; WORD $0xdc3f; BYTE $0x0 // VPCMPEQB Z4, Z0, K3                  // vpcmpeqb	k3, zmm0, zmm4
+	KMOVQ K2, SI                               // <--                                  // kmovq	rsi, k2
+	ORQ   SI, DX                               // <--                                  // or	rdx, rsi
+	KMOVQ K3, CX                               // <--                                  // kmovq	rcx, k3
+	ORQ   CX, DX                               // <--                                  // or	rdx, rcx
+	JE    LBB9_16                              // <--                                  // je	.LBB9_16
+
+LBB9_1:
+	LEAQ       0x3f(BX), DX                         // <--                                  // lea	rdx, [rbx + 63]
+	CMPQ       R13, DX                              // <--                                  // cmp	r13, rdx
+	JG         LBB9_15                              // <--                                  // jg	.LBB9_15
+	CMPQ       R13, BX                              // <--                                  // cmp	r13, rbx
+	JLE        LBB9_42                              // <--                                  // jle	.LBB9_42
+	MOVQ       R13, DX                              // <--                                  // mov	rdx, r13
+	MOVL       $0x1, R11                            // <--                                  // mov	r11d, 1
+	LONG       $0x487d7162; WORD $0xc66f            // VMOVDQA32 Z6, Z8                     // vmovdqa32	zmm8, zmm6
+	SUBQ       BX, DX                               // <--                                  // sub	rdx, rbx
+	MOVL       DX, CX                               // <--                                  // mov	ecx, edx
+	SHLQ       CX, R11                              // <--                                  // shl	r11, cl
+	LEAQ       -0x1(R11), AX                        // <--                                  // lea	rax, [r11 - 1]
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	MOVQ       0x38(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 56]
+	VMOVDQU8.Z 0(AX)(BX*1), K1, Z0                  // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rax + rbx]
+	VPORD      Z0, Z6, Z0                           // <--                                  // vpord	zmm0, zmm6, zmm0
+	LONG       $0x497df362; WORD $0xec3f; BYTE $0x0 // VPCMPEQB Z4, Z0, K1, K5              // vpcmpeqb	k5{k1}, zmm0, zmm4
+	KMOVQ      K5, R11                              // <--                                  // kmovq	r11, k5
+
+LBB9_2:
+	TESTQ R11, R11     // <--                                  // test	r11, r11
+	JE    LBB9_8       // <--                                  // je	.LBB9_8
+	MOVQ  DX, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], rdx
+	MOVQ  BX, AX       // <--                                  // mov	rax, rbx
+	MOVQ  R8, BX       // <--                                  // mov	rbx, r8
+	MOVQ  R11, R8      // <--                                  // mov	r8, r11
+	KMOVD DI, K7       // <--                                  // kmovd	k7, edi
+
+LBB9_3:
+	XORL    DX, DX           // <--                                  // xor	edx, edx
+	TZCNTQ  R8, DX           // <--                                  // tzcnt	rdx, r8
+	MOVLQSX DX, DX           // <--                                  // movsxd	rdx, edx
+	ADDQ    AX, DX           // <--                                  // add	rdx, rax
+	LEAQ    0(R15)(DX*1), SI // <--                                  // lea	rsi, [r15 + rdx]
+	CMPQ    R10, $0x3f       // <--                                  // cmp	r10, 63
+	JLE     LBB9_17          // <--                                  // jle	.LBB9_17
+	MOVQ    R10, CX          // <--                                  // mov	rcx, r10
+	MOVQ    R9, R11          // <--                                  // mov	r11, r9
+	KMOVD   K7, DI           // <--                                  // kmovd	edi, k7
+	JMP     LBB9_5           // <--                                  // jmp	.LBB9_5
+
+LBB9_4:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, SI  // <--                                  // add	rsi, 64
+	ADDQ $0x40, R11 // <--                                  // add	r11, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB9_9     // <--                                  // jle	.LBB9_9
+
+LBB9_5:
+	VPADDB   0(SI), Z3, Z0                        // <--                                  // vpaddb	zmm0, zmm3, zmmword ptr [rsi]
+	LONG     $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VMOVDQU8 0(SI), Z0                            // <--                                  // vmovdqu8	zmm0, zmmword ptr [rsi]
+	VPADDB   Z0, Z1, K1, Z0                       // <--                                  // vpaddb	zmm0{k1}, zmm1, zmm0
+	LONG     $0x487dd362; WORD $0x33f; BYTE $0x4  // VPCMPNEQB 0(R11), Z0, K0             // vpcmpneqb	k0, zmm0, zmmword ptr [r11]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JE       LBB9_4                               // <--                                  // je	.LBB9_4
+	KMOVD    DI, K7                               // <--                                  // kmovd	k7, edi
+
+LBB9_6:
+	MOVQ DX, CX   // <--                                  // mov	rcx, rdx
+	ADDQ $0x1, BX // <--                                  // add	rbx, 1
+	SARQ $0x8, CX // <--                                  // sar	rcx, 8
+	ADDQ $0x4, CX // <--                                  // add	rcx, 4
+	CMPQ BX, CX   // <--                                  // cmp	rbx, rcx
+	JG   LBB9_18  // <--                                  // jg	.LBB9_18
+
+LBB9_7:
+	LEAQ  -0x1(R8), DX // <--                                  // lea	rdx, [r8 - 1]
+	ANDQ  DX, R8       // <--                                  // and	r8, rdx
+	TESTQ R8, R8       // <--                                  // test	r8, r8
+	JNE   LBB9_3       // <--                                  // jne	.LBB9_3
+	MOVQ  0x30(SP), DX // <--                                  // mov	rdx, qword ptr [rsp + 48]
+	MOVQ  BX, R8       // <--                                  // mov	r8, rbx
+	MOVQ  AX, BX       // <--                                  // mov	rbx, rax
+	KMOVD K7, DI       // <--                                  // kmovd	edi, k7
+
+LBB9_8:
+	ADDQ DX, BX // <--                                  // add	rbx, rdx
+	JMP  LBB9_0 // <--                                  // jmp	.LBB9_0
+
+LBB9_9:
+	KMOVD DI, K7  // <--                                  // kmovd	k7, edi
+	TESTQ CX, CX  // <--                                  // test	rcx, rcx
+	JE    LBB9_11 // <--                                  // je	.LBB9_11
+
+LBB9_10:
+	MOVQ       R14, DI                              // <--                                  // mov	rdi, r14
+	SHLQ       CX, DI                               // <--                                  // shl	rdi, cl
+	LEAQ       -0x1(DI), DI                         // <--                                  // lea	rdi, [rdi - 1]
+	KMOVQ      DI, K1                               // <--                                  // kmovq	k1, rdi
+	VMOVDQU8.Z 0(SI), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rsi]
+	VMOVDQU8.Z 0(R11), K1, Z5                       // <--                                  // vmovdqu8	zmm5{k1}{z}, zmmword ptr [r11]
+	VPADDB     Z3, Z0, Z7                           // <--                                  // vpaddb	zmm7, zmm0, zmm3
+	LONG       $0x4845f362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z7, K1                 // vpcmpltub	k1, zmm7, zmm2
+	LONG       $0x48fdf162; WORD $0xf86f            // VMOVDQA64 Z0, Z7                     // vmovdqa64	zmm7, zmm0
+	VPADDB     Z1, Z0, K1, Z7                       // <--                                  // vpaddb	zmm7{k1}, zmm0, zmm1
+	LONG       $0x4845f362; WORD $0xc53f; BYTE $0x4 // VPCMPNEQB Z5, Z7, K0                 // vpcmpneqb	k0, zmm7, zmm5
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB9_6                               // <--                                  // jne	.LBB9_6
+
+LBB9_11:
+	TESTQ   DX, DX              // <--                                  // test	rdx, rdx
+	JE      LBB9_12             // <--                                  // je	.LBB9_12
+	MOVBLZX -0x1(R15)(DX*1), CX // <--                                  // movzx	ecx, byte ptr [r15 + rdx - 1]
+	MOVQ    0x20(BP), DI        // <--                                  // mov	rdi, qword ptr [rbp + 32]
+	MOVL    CX, SI              // <--                                  // mov	esi, ecx
+	SHRB    $0x6, SI            // <--                                  // shr	sil, 6
+	MOVBLZX SI, SI              // <--                                  // movzx	esi, sil
+	MOVQ    0(DI)(SI*8), SI     // <--                                  // mov	rsi, qword ptr [rdi + rsi*8]
+	SHRQ    CX, SI              // <--                                  // shr	rsi, cl
+	ANDL    $0x1, SI            // <--                                  // and	esi, 1
+	JE      LBB9_7              // <--                                  // je	.LBB9_7
+
+LBB9_12:
+	LEAQ    0(R10)(DX*1), CX // <--                                  // lea	rcx, [r10 + rdx]
+	CMPQ    R12, CX          // <--                                  // cmp	r12, rcx
+	JE      LBB9_13          // <--                                  // je	.LBB9_13
+	MOVBLZX 0(R15)(CX*1), CX // <--                                  // movzx	ecx, byte ptr [r15 + rcx]
+	MOVQ    0x20(BP), DI     // <--                                  // mov	rdi, qword ptr [rbp + 32]
+	MOVL    CX, SI           // <--                                  // mov	esi, ecx
+	SHRB    $0x6, SI         // <--                                  // shr	sil, 6
+	MOVBLZX SI, SI           // <--                                  // movzx	esi, sil
+	MOVQ    0(DI)(SI*8), SI  // <--                                  // mov	rsi, qword ptr [rdi + rsi*8]
+	SHRQ    CX, SI           // <--                                  // shr	rsi, cl
+	ANDL    $0x1, SI         // <--                                  // and	esi, 1
+	JE      LBB9_7           // <--                                  // je	.LBB9_7
+
+LBB9_13:
+	MOVQ       DX, SI // <--                                  // mov	rsi, rdx
+	VZEROUPPER        // <--                                  // vzeroupper
+
+LBB9_14:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	MOVQ SI, AX         // <--                                  // mov	rax, rsi
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+72(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB9_15:
+	MOVQ  0x38(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 56]
+	LONG  $0x487d7162; WORD $0xc66f            // VMOVDQA32 Z6, Z8                     // vmovdqa32	zmm8, zmm6
+	MOVL  $0x40, DX                            // <--                                  // mov	edx, 64
+	VPORD 0(AX)(BX*1), Z6, Z0                  // <--                                  // vpord	zmm0, zmm6, zmmword ptr [rax + rbx]
+	LONG  $0x487df362; WORD $0xe43f; BYTE $0x0 // VPCMPEQB Z4, Z0, K4                  // vpcmpeqb	k4, zmm0, zmm4
+	KMOVQ K4, R11                              // <--                                  // kmovq	r11, k4
+	JMP   LBB9_2                               // <--                                  // jmp	.LBB9_2
+
+LBB9_16:
+	ADDQ $0x100, BX // <--                                  // add	rbx, 256
+	JMP  LBB9_0     // <--                                  // jmp	.LBB9_0
+
+LBB9_17:
+	MOVQ R9, R11 // <--                                  // mov	r11, r9
+	MOVQ R10, CX // <--                                  // mov	rcx, r10
+	JMP  LBB9_10 // <--                                  // jmp	.LBB9_10
+
+LBB9_18:
+	KMOVD        K7, DI           // <--                                  // kmovd	edi, k7
+	LEAQ         0x1(DX), R11     // <--                                  // lea	r11, [rdx + 1]
+	LEAL         -0x61(DI), DX    // <--                                  // lea	edx, [rdi - 97]
+	MOVQ         R9, R8           // <--                                  // mov	r8, r9
+	CMPB         DX, $0x19        // <--                                  // cmp	dl, 25
+	MOVQ         0x28(SP), R9     // <--                                  // mov	r9, qword ptr [rsp + 40]
+	VPBROADCASTB DI, Z6           // <--                                  // vpbroadcastb	zmm6, edi
+	SETLS        DX               // <--                                  // setbe	dl
+	XORL         R14, R14         // <--                                  // xor	r14d, r14d
+	SHLL         $0x5, DX         // <--                                  // shl	edx, 5
+	CMPQ         R10, $0x3f       // <--                                  // cmp	r10, 63
+	LEAQ         0(R15)(R9*1), AX // <--                                  // lea	rax, [r15 + r9]
+	VPBROADCASTB DX, Z7           // <--                                  // vpbroadcastb	zmm7, edx
+	MOVL         $-0x41, DX       // <--                                  // mov	edx, -65
+	SETLE        R14              // <--                                  // setle	r14b
+	MOVQ         AX, DI           // <--                                  // mov	rdi, rax
+	VPBROADCASTB DX, Z3           // <--                                  // vpbroadcastb	zmm3, edx
+	MOVL         $0x1a, DX        // <--                                  // mov	edx, 26
+	LEAQ         0x4(R14*4), R14  // <--                                  // lea	r14, [r14*4 + 4]
+	XORL         BX, BX           // <--                                  // xor	ebx, ebx
+	VPBROADCASTB DX, Z2           // <--                                  // vpbroadcastb	zmm2, edx
+	MOVL         $0x20, DX        // <--                                  // mov	edx, 32
+	VPBROADCASTB DX, Z1           // <--                                  // vpbroadcastb	zmm1, edx
+
+LBB9_19:
+	LEAQ  0x3f(R11), DX                        // <--                                  // lea	rdx, [r11 + 63]
+	CMPQ  R13, DX                              // <--                                  // cmp	r13, rdx
+	JLE   LBB9_44                              // <--                                  // jle	.LBB9_44
+	VPORD 0(DI)(R11*1), Z7, Z10                // <--                                  // vpord	zmm10, zmm7, zmmword ptr [rdi + r11]
+	MOVQ  0x38(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 56]
+	MOVL  $0x40, DX                            // <--                                  // mov	edx, 64
+	LONG  $0x482df362; WORD $0xce3f; BYTE $0x0 // VPCMPEQB Z6, Z10, K1                 // vpcmpeqb	k1, zmm10, zmm6
+	VPORD 0(AX)(R11*1), Z8, Z0                 // <--                                  // vpord	zmm0, zmm8, zmmword ptr [rax + r11]
+	LONG  $0x497df362; WORD $0xf43f; BYTE $0x0 // VPCMPEQB Z4, Z0, K1, K6              // vpcmpeqb	k6{k1}, zmm0, zmm4
+	KMOVQ K6, R9                               // <--                                  // kmovq	r9, k6
+
+LBB9_20:
+	TESTQ R9, R9       // <--                                  // test	r9, r9
+	JE    LBB9_26      // <--                                  // je	.LBB9_26
+	MOVQ  DI, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], rdi
+	MOVQ  DX, 0x28(SP) // <--                                  // mov	qword ptr [rsp + 40], rdx
+
+LBB9_21:
+	XORL    SI, SI           // <--                                  // xor	esi, esi
+	TZCNTQ  R9, SI           // <--                                  // tzcnt	rsi, r9
+	MOVLQSX SI, SI           // <--                                  // movsxd	rsi, esi
+	ADDQ    R11, SI          // <--                                  // add	rsi, r11
+	LEAQ    0(R15)(SI*1), DX // <--                                  // lea	rdx, [r15 + rsi]
+	CMPQ    R10, $0x3f       // <--                                  // cmp	r10, 63
+	JLE     LBB9_45          // <--                                  // jle	.LBB9_45
+	MOVQ    0x30(SP), DI     // <--                                  // mov	rdi, qword ptr [rsp + 48]
+	MOVQ    R10, CX          // <--                                  // mov	rcx, r10
+	MOVQ    R8, AX           // <--                                  // mov	rax, r8
+	JMP     LBB9_23          // <--                                  // jmp	.LBB9_23
+
+LBB9_22:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, DX // <--                                  // add	rdx, 64
+	ADDQ $0x40, AX // <--                                  // add	rax, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB9_27   // <--                                  // jle	.LBB9_27
+
+LBB9_23:
+	VPADDB   0(DX), Z3, Z0                        // <--                                  // vpaddb	zmm0, zmm3, zmmword ptr [rdx]
+	LONG     $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VMOVDQU8 0(DX), Z0                            // <--                                  // vmovdqu8	zmm0, zmmword ptr [rdx]
+	VPADDB   Z0, Z1, K1, Z0                       // <--                                  // vpaddb	zmm0{k1}, zmm1, zmm0
+	LONG     $0x487df362; WORD $0x3f; BYTE $0x4   // VPCMPNEQB 0(AX), Z0, K0              // vpcmpneqb	k0, zmm0, zmmword ptr [rax]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JE       LBB9_22                              // <--                                  // je	.LBB9_22
+	MOVQ     DI, 0x30(SP)                         // <--                                  // mov	qword ptr [rsp + 48], rdi
+
+LBB9_24:
+	ADDQ $0x1, BX // <--                                  // add	rbx, 1
+	CMPQ BX, R14  // <--                                  // cmp	rbx, r14
+	JG   LBB9_31  // <--                                  // jg	.LBB9_31
+
+LBB9_25:
+	LEAQ  -0x1(R9), AX // <--                                  // lea	rax, [r9 - 1]
+	ANDQ  AX, R9       // <--                                  // and	r9, rax
+	TESTQ R9, R9       // <--                                  // test	r9, r9
+	JNE   LBB9_21      // <--                                  // jne	.LBB9_21
+	MOVQ  0x30(SP), DI // <--                                  // mov	rdi, qword ptr [rsp + 48]
+	MOVQ  0x28(SP), DX // <--                                  // mov	rdx, qword ptr [rsp + 40]
+
+LBB9_26:
+	ADDQ DX, R11 // <--                                  // add	r11, rdx
+	JMP  LBB9_19 // <--                                  // jmp	.LBB9_19
+
+LBB9_27:
+	MOVQ  DI, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], rdi
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB9_29      // <--                                  // je	.LBB9_29
+
+LBB9_28:
+	MOVL       $0x1, DI                             // <--                                  // mov	edi, 1
+	SHLQ       CX, DI                               // <--                                  // shl	rdi, cl
+	LEAQ       -0x1(DI), DI                         // <--                                  // lea	rdi, [rdi - 1]
+	KMOVQ      DI, K1                               // <--                                  // kmovq	k1, rdi
+	VMOVDQU8.Z 0(DX), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rdx]
+	VMOVDQU8.Z 0(AX), K1, Z11                       // <--                                  // vmovdqu8	zmm11{k1}{z}, zmmword ptr [rax]
+	VPADDB     Z3, Z0, Z10                          // <--                                  // vpaddb	zmm10, zmm0, zmm3
+	LONG       $0x482df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z10, K1                // vpcmpltub	k1, zmm10, zmm2
+	VPADDB     Z1, Z0, K1, Z0                       // <--                                  // vpaddb	zmm0{k1}, zmm0, zmm1
+	LONG       $0x487dd362; WORD $0xc33f; BYTE $0x4 // VPCMPNEQB Z11, Z0, K0                // vpcmpneqb	k0, zmm0, zmm11
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB9_24                              // <--                                  // jne	.LBB9_24
+
+LBB9_29:
+	MOVBLZX -0x1(R15)(SI*1), CX // <--                                  // movzx	ecx, byte ptr [r15 + rsi - 1]
+	MOVQ    0x20(BP), DX        // <--                                  // mov	rdx, qword ptr [rbp + 32]
+	MOVL    CX, AX              // <--                                  // mov	eax, ecx
+	SHRB    $0x6, AX            // <--                                  // shr	al, 6
+	MOVBLZX AX, AX              // <--                                  // movzx	eax, al
+	MOVQ    0(DX)(AX*8), AX     // <--                                  // mov	rax, qword ptr [rdx + rax*8]
+	SHRQ    CX, AX              // <--                                  // shr	rax, cl
+	WORD    $0x1a8              // TESTB $0x1, AX                       // test	al, 1
+	JE      LBB9_25             // <--                                  // je	.LBB9_25
+	LEAQ    0(R10)(SI*1), AX    // <--                                  // lea	rax, [r10 + rsi]
+	CMPQ    R12, AX             // <--                                  // cmp	r12, rax
+	JE      LBB9_30             // <--                                  // je	.LBB9_30
+	MOVBLZX 0(R15)(AX*1), CX    // <--                                  // movzx	ecx, byte ptr [r15 + rax]
+	MOVL    CX, AX              // <--                                  // mov	eax, ecx
+	SHRB    $0x6, AX            // <--                                  // shr	al, 6
+	MOVBLZX AX, AX              // <--                                  // movzx	eax, al
+	MOVQ    0(DX)(AX*8), AX     // <--                                  // mov	rax, qword ptr [rdx + rax*8]
+	SHRQ    CX, AX              // <--                                  // shr	rax, cl
+	WORD    $0x1a8              // TESTB $0x1, AX                       // test	al, 1
+	JE      LBB9_25             // <--                                  // je	.LBB9_25
+
+LBB9_30:
+	VZEROUPPER         // <--                                  // vzeroupper
+	JMP        LBB9_14 // <--                                  // jmp	.LBB9_14
+
+LBB9_31:
+	LEAQ         0x1(SI), R9      // <--                                  // lea	r9, [rsi + 1]
+	MOVQ         R12, CX          // <--                                  // mov	rcx, r12
+	SUBQ         R9, CX           // <--                                  // sub	rcx, r9
+	LEAQ         0(R15)(R9*1), DX // <--                                  // lea	rdx, [r15 + r9]
+	CMPQ         R10, CX          // <--                                  // cmp	r10, rcx
+	JG           LBB9_42          // <--                                  // jg	.LBB9_42
+	MOVL         $-0x41, AX       // <--                                  // mov	eax, -65
+	MOVQ         R9, 0x38(SP)     // <--                                  // mov	qword ptr [rsp + 56], r9
+	MOVQ         0x20(BP), R9     // <--                                  // mov	r9, qword ptr [rbp + 32]
+	MOVQ         R15, R11         // <--                                  // mov	r11, r15
+	VPBROADCASTB AX, Z3           // <--                                  // vpbroadcastb	zmm3, eax
+	MOVL         $0x1a, AX        // <--                                  // mov	eax, 26
+	VPBROADCASTB AX, Z2           // <--                                  // vpbroadcastb	zmm2, eax
+	MOVL         $0x20, AX        // <--                                  // mov	eax, 32
+	VPBROADCASTB AX, Z1           // <--                                  // vpbroadcastb	zmm1, eax
+
+LBB9_32:
+	SUBQ R10, CX        // <--                                  // sub	rcx, r10
+	MOVL $0x1000193, AX // <--                                  // mov	eax, 16777619
+	MOVL $0x1, R14      // <--                                  // mov	r14d, 1
+	MOVQ CX, R13        // <--                                  // mov	r13, rcx
+	MOVQ R10, CX        // <--                                  // mov	rcx, r10
+
+LBB9_33:
+	TESTB $0x1, CX // <--                                  // test	cl, 1
+	JE    LBB9_34  // <--                                  // je	.LBB9_34
+	IMULL AX, R14  // <--                                  // imul	r14d, eax
+
+LBB9_34:
+	IMULL AX, AX   // <--                                  // imul	eax, eax
+	SHRQ  $0x1, CX // <--                                  // shr	rcx, 1
+	JNE   LBB9_33  // <--                                  // jne	.LBB9_33
+	XORL  AX, AX   // <--                                  // xor	eax, eax
+	XORL  DI, DI   // <--                                  // xor	edi, edi
+	XORL  R15, R15 // <--                                  // xor	r15d, r15d
+
+LBB9_35:
+	LONG    $0x93ff6945; WORD $0x1; BYTE $0x1 // IMULL $0x1000193, R15, R15           // imul	r15d, r15d, 16777619
+	MOVBLZX 0(R8)(DI*1), CX                   // <--                                  // movzx	ecx, byte ptr [r8 + rdi]
+	LONG    $0x193c069; WORD $0x100           // IMULL $0x1000193, AX, AX             // imul	eax, eax, 16777619
+	ADDL    CX, R15                           // <--                                  // add	r15d, ecx
+	MOVBLZX 0(DX)(DI*1), CX                   // <--                                  // movzx	ecx, byte ptr [rdx + rdi]
+	LEAL    -0x41(CX), BX                     // <--                                  // lea	ebx, [rcx - 65]
+	LEAL    0x20(CX), SI                      // <--                                  // lea	esi, [rcx + 32]
+	CMPB    BX, $0x1a                         // <--                                  // cmp	bl, 26
+	CMOVLCS SI, CX                            // <--                                  // cmovb	ecx, esi
+	ADDQ    $0x1, DI                          // <--                                  // add	rdi, 1
+	MOVBLZX CX, CX                            // <--                                  // movzx	ecx, cl
+	ADDL    CX, AX                            // <--                                  // add	eax, ecx
+	CMPQ    R10, DI                           // <--                                  // cmp	r10, rdi
+	JNE     LBB9_35                           // <--                                  // jne	.LBB9_35
+	ADDQ    $0x1, R13                         // <--                                  // add	r13, 1
+	XORL    BX, BX                            // <--                                  // xor	ebx, ebx
+	VMOVQ   R11, X5                           // <--                                  // vmovq	xmm5, r11
+	JMP     LBB9_37                           // <--                                  // jmp	.LBB9_37
+
+LBB9_36:
+	ADDQ    $0x1, BX                // <--                                  // add	rbx, 1
+	CMPQ    BX, R13                 // <--                                  // cmp	rbx, r13
+	JE      LBB9_42                 // <--                                  // je	.LBB9_42
+	LONG    $0x193c869; WORD $0x100 // IMULL $0x1000193, AX, CX             // imul	ecx, eax, 16777619
+	MOVBLZX 0(DX), AX               // <--                                  // movzx	eax, byte ptr [rdx]
+	LEAL    -0x41(AX), R11          // <--                                  // lea	r11d, [rax - 65]
+	LEAL    0x20(AX), SI            // <--                                  // lea	esi, [rax + 32]
+	CMPB    R11, $0x1a              // <--                                  // cmp	r11b, 26
+	CMOVLCS SI, AX                  // <--                                  // cmovb	eax, esi
+	MOVBLZX AX, AX                  // <--                                  // movzx	eax, al
+	IMULL   R14, AX                 // <--                                  // imul	eax, r14d
+	SUBL    AX, CX                  // <--                                  // sub	ecx, eax
+	MOVBLZX 0(DX)(R10*1), AX        // <--                                  // movzx	eax, byte ptr [rdx + r10]
+	LEAL    -0x41(AX), R11          // <--                                  // lea	r11d, [rax - 65]
+	LEAL    0x20(AX), SI            // <--                                  // lea	esi, [rax + 32]
+	CMPB    R11, $0x1a              // <--                                  // cmp	r11b, 26
+	CMOVLCS SI, AX                  // <--                                  // cmovb	eax, esi
+	ADDQ    $0x1, DX                // <--                                  // add	rdx, 1
+	MOVBLZX AX, AX                  // <--                                  // movzx	eax, al
+	ADDL    CX, AX                  // <--                                  // add	eax, ecx
+
+LBB9_37:
+	CMPL R15, AX      // <--                                  // cmp	r15d, eax
+	JNE  LBB9_36      // <--                                  // jne	.LBB9_36
+	MOVQ DX, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], rdx
+	MOVQ DX, R11      // <--                                  // mov	r11, rdx
+	CMPQ DI, $0x3f    // <--                                  // cmp	rdi, 63
+	JLE  LBB9_46      // <--                                  // jle	.LBB9_46
+	MOVQ DI, CX       // <--                                  // mov	rcx, rdi
+	MOVQ R8, SI       // <--                                  // mov	rsi, r8
+
+LBB9_38:
+	VPADDB   0(R11), Z3, Z0                       // <--                                  // vpaddb	zmm0, zmm3, zmmword ptr [r11]
+	LONG     $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VMOVDQU8 0(R11), Z0                           // <--                                  // vmovdqu8	zmm0, zmmword ptr [r11]
+	VPADDB   Z0, Z1, K1, Z0                       // <--                                  // vpaddb	zmm0{k1}, zmm1, zmm0
+	LONG     $0x487df362; WORD $0x63f; BYTE $0x4  // VPCMPNEQB 0(SI), Z0, K0              // vpcmpneqb	k0, zmm0, zmmword ptr [rsi]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE      LBB9_36                              // <--                                  // jne	.LBB9_36
+	SUBQ     $0x40, CX                            // <--                                  // sub	rcx, 64
+	ADDQ     $0x40, R11                           // <--                                  // add	r11, 64
+	ADDQ     $0x40, SI                            // <--                                  // add	rsi, 64
+	CMPQ     CX, $0x3f                            // <--                                  // cmp	rcx, 63
+	JG       LBB9_38                              // <--                                  // jg	.LBB9_38
+	MOVQ     R11, 0x30(SP)                        // <--                                  // mov	qword ptr [rsp + 48], r11
+	TESTQ    CX, CX                               // <--                                  // test	rcx, rcx
+	JE       LBB9_40                              // <--                                  // je	.LBB9_40
+
+LBB9_39:
+	MOVL       $0x1, R11                            // <--                                  // mov	r11d, 1
+	SHLQ       CX, R11                              // <--                                  // shl	r11, cl
+	MOVQ       R11, CX                              // <--                                  // mov	rcx, r11
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	MOVQ       0x30(SP), CX                         // <--                                  // mov	rcx, qword ptr [rsp + 48]
+	VMOVDQU8.Z 0(SI), K1, Z6                        // <--                                  // vmovdqu8	zmm6{k1}{z}, zmmword ptr [rsi]
+	VMOVDQU8.Z 0(CX), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rcx]
+	VPADDB     Z3, Z0, Z4                           // <--                                  // vpaddb	zmm4, zmm0, zmm3
+	LONG       $0x485df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z4, K1                 // vpcmpltub	k1, zmm4, zmm2
+	LONG       $0x48fdf162; WORD $0xe06f            // VMOVDQA64 Z0, Z4                     // vmovdqa64	zmm4, zmm0
+	VPADDB     Z1, Z0, K1, Z4                       // <--                                  // vpaddb	zmm4{k1}, zmm0, zmm1
+	LONG       $0x485df362; WORD $0xc63f; BYTE $0x4 // VPCMPNEQB Z6, Z4, K0                 // vpcmpneqb	k0, zmm4, zmm6
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB9_36                              // <--                                  // jne	.LBB9_36
+
+LBB9_40:
+	MOVQ    0x38(SP), AX        // <--                                  // mov	rax, qword ptr [rsp + 56]
+	VMOVQ   X5, R11             // <--                                  // vmovq	r11, xmm5
+	LEAQ    0(BX)(AX*1), SI     // <--                                  // lea	rsi, [rbx + rax]
+	MOVBLZX -0x1(R11)(SI*1), CX // <--                                  // movzx	ecx, byte ptr [r11 + rsi - 1]
+	MOVL    CX, AX              // <--                                  // mov	eax, ecx
+	SHRB    $0x6, AX            // <--                                  // shr	al, 6
+	MOVBLZX AX, AX              // <--                                  // movzx	eax, al
+	MOVQ    0(R9)(AX*8), AX     // <--                                  // mov	rax, qword ptr [r9 + rax*8]
+	SHRQ    CX, AX              // <--                                  // shr	rax, cl
+	WORD    $0x1a8              // TESTB $0x1, AX                       // test	al, 1
+	JNE     LBB9_47             // <--                                  // jne	.LBB9_47
+
+LBB9_41:
+	MOVQ 0x38(SP), AX      // <--                                  // mov	rax, qword ptr [rsp + 56]
+	MOVQ R12, CX           // <--                                  // mov	rcx, r12
+	LEAQ 0x1(BX)(AX*1), AX // <--                                  // lea	rax, [rbx + rax + 1]
+	SUBQ AX, CX            // <--                                  // sub	rcx, rax
+	MOVQ AX, 0x38(SP)      // <--                                  // mov	qword ptr [rsp + 56], rax
+	LEAQ 0(R11)(AX*1), DX  // <--                                  // lea	rdx, [r11 + rax]
+	CMPQ CX, DI            // <--                                  // cmp	rcx, rdi
+	JGE  LBB9_32           // <--                                  // jge	.LBB9_32
+
+LBB9_42:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB9_43:
+	MOVQ $-0x1, SI // <--                                  // mov	rsi, -1
+	JMP  LBB9_14   // <--                                  // jmp	.LBB9_14
+
+LBB9_44:
+	CMPQ       R13, R11                             // <--                                  // cmp	r13, r11
+	JLE        LBB9_42                              // <--                                  // jle	.LBB9_42
+	MOVQ       R13, DX                              // <--                                  // mov	rdx, r13
+	MOVL       $0x1, SI                             // <--                                  // mov	esi, 1
+	SUBQ       R11, DX                              // <--                                  // sub	rdx, r11
+	MOVL       DX, CX                               // <--                                  // mov	ecx, edx
+	SHLQ       CX, SI                               // <--                                  // shl	rsi, cl
+	LEAQ       -0x1(SI), AX                         // <--                                  // lea	rax, [rsi - 1]
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	MOVQ       0x38(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 56]
+	VMOVDQU8.Z 0(AX)(R11*1), K1, Z0                 // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rax + r11]
+	VPORD      Z0, Z8, Z0                           // <--                                  // vpord	zmm0, zmm8, zmm0
+	LONG       $0x497df362; WORD $0xc43f; BYTE $0x0 // VPCMPEQB Z4, Z0, K1, K0              // vpcmpeqb	k0{k1}, zmm0, zmm4
+	VMOVDQU8.Z 0(DI)(R11*1), K1, Z0                 // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rdi + r11]
+	VPORD      Z7, Z0, Z0                           // <--                                  // vpord	zmm0, zmm0, zmm7
+	LONG       $0x497df362; WORD $0xce3f; BYTE $0x0 // VPCMPEQB Z6, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm6
+	KMOVQ      K0, AX                               // <--                                  // kmovq	rax, k0
+	KMOVQ      K1, R9                               // <--                                  // kmovq	r9, k1
+	ANDQ       AX, R9                               // <--                                  // and	r9, rax
+	JMP        LBB9_20                              // <--                                  // jmp	.LBB9_20
+
+LBB9_45:
+	MOVQ R8, AX  // <--                                  // mov	rax, r8
+	MOVQ R10, CX // <--                                  // mov	rcx, r10
+	JMP  LBB9_28 // <--                                  // jmp	.LBB9_28
+
+LBB9_46:
+	MOVQ R8, SI  // <--                                  // mov	rsi, r8
+	MOVQ DI, CX  // <--                                  // mov	rcx, rdi
+	JMP  LBB9_39 // <--                                  // jmp	.LBB9_39
+
+LBB9_47:
+	LEAQ    0(DI)(SI*1), AX  // <--                                  // lea	rax, [rdi + rsi]
+	CMPQ    R12, AX          // <--                                  // cmp	r12, rax
+	JE      LBB9_30          // <--                                  // je	.LBB9_30
+	MOVBLZX 0(R11)(AX*1), CX // <--                                  // movzx	ecx, byte ptr [r11 + rax]
+	MOVL    CX, AX           // <--                                  // mov	eax, ecx
+	SHRB    $0x6, AX         // <--                                  // shr	al, 6
+	MOVBLZX AX, AX           // <--                                  // movzx	eax, al
+	MOVQ    0(R9)(AX*8), AX  // <--                                  // mov	rax, qword ptr [r9 + rax*8]
+	SHRQ    CX, AX           // <--                                  // shr	rax, cl
+	WORD    $0x1a8           // TESTB $0x1, AX                       // test	al, 1
+	JNE     LBB9_30          // <--                                  // jne	.LBB9_30
+	JMP     LBB9_41          // <--                                  // jmp	.LBB9_41
+
+TEXT ·countExactAvx512(SB), NOSPLIT, $200-72
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	PUSHQ        BP                // <--                                  // push	rbp
+	MOVQ         R9, R10           // <--                                  // mov	r10, r9
+	MOVQ         SP, BP            // <--                                  // mov	rbp, rsp
+	PUSHQ        R15               // <--                                  // push	r15
+	PUSHQ        R14               // <--                                  // push	r14
+	PUSHQ        R13               // <--                                  // push	r13
+	PUSHQ        R12               // <--                                  // push	r12
+	PUSHQ        BX                // <--                                  // push	rbx
+	ANDQ         $-0x40, SP        // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP         // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R9      // <--                                  // mov	r9, qword ptr [rbp + 24]
+	MOVQ         0x10(BP), R11     // <--                                  // mov	r11, qword ptr [rbp + 16]
+	MOVQ         SI, 0x18(SP)      // <--                                  // mov	qword ptr [rsp + 24], rsi
+	TESTQ        R9, R9            // <--                                  // test	r9, r9
+	JLE          LBB10_8           // <--                                  // jle	.LBB10_8
+	CMPQ         SI, R9            // <--                                  // cmp	rsi, r9
+	JL           LBB10_8           // <--                                  // jl	.LBB10_8
+	MOVQ         SI, AX            // <--                                  // mov	rax, rsi
+	MOVQ         R10, 0x28(SP)     // <--                                  // mov	qword ptr [rsp + 40], r10
+	MOVQ         DI, R13           // <--                                  // mov	r13, rdi
+	XORL         R15, R15          // <--                                  // xor	r15d, r15d
+	SUBQ         R9, AX            // <--                                  // sub	rax, r9
+	MOVL         R8, DI            // <--                                  // mov	edi, r8d
+	LEAQ         0(R13)(CX*1), R12 // <--                                  // lea	r12, [r13 + rcx + 0]
+	MOVQ         $0x0, 0x38(SP)    // <--                                  // mov	qword ptr [rsp + 56], 0
+	ADDQ         $0x1, AX          // <--                                  // add	rax, 1
+	VPBROADCASTB DX, Z1            // <--                                  // vpbroadcastb	zmm1, edx
+	MOVL         $0x1, R8          // <--                                  // mov	r8d, 1
+	MOVQ         AX, DX            // <--                                  // mov	rdx, rax
+	MOVQ         R15, AX           // <--                                  // mov	rax, r15
+
+LBB10_0:
+	LEAQ 0xff(R15), CX // <--                                  // lea	rcx, [r15 + 255]
+	CMPQ DX, CX        // <--                                  // cmp	rdx, rcx
+	JLE  LBB10_2       // <--                                  // jle	.LBB10_2
+
+LBB10_1:
+	LEAQ     0(R12)(R15*1), SI // <--                                  // lea	rsi, [r12 + r15]
+	VPCMPEQB 0(SI), Z1, K0     // <--                                  // vpcmpeqb	k0, zmm1, zmmword ptr [rsi]
+	VPCMPEQB 0x40(SI), Z1, K1  // <--                                  // vpcmpeqb	k1, zmm1, zmmword ptr [rsi + 64]
+	VPCMPEQB 0x80(SI), Z1, K2  // <--                                  // vpcmpeqb	k2, zmm1, zmmword ptr [rsi + 128]
+	VPCMPEQB 0xc0(SI), Z1, K3  // <--                                  // vpcmpeqb	k3, zmm1, zmmword ptr [rsi + 192]
+	KMOVQ    K1, CX            // <--                                  // kmovq	rcx, k1
+	KMOVQ    K0, R14           // <--                                  // kmovq	r14, k0
+	ORQ      R14, CX           // <--                                  // or	rcx, r14
+	KMOVQ    K2, BX            // <--                                  // kmovq	rbx, k2
+	ORQ      BX, CX            // <--                                  // or	rcx, rbx
+	KMOVQ    K3, SI            // <--                                  // kmovq	rsi, k3
+	ORQ      SI, CX            // <--                                  // or	rcx, rsi
+	JNE      LBB10_2           // <--                                  // jne	.LBB10_2
+	ADDQ     $0x100, R15       // <--                                  // add	r15, 256
+	LEAQ     0xff(R15), CX     // <--                                  // lea	rcx, [r15 + 255]
+	CMPQ     DX, CX            // <--                                  // cmp	rdx, rcx
+	JG       LBB10_1           // <--                                  // jg	.LBB10_1
+
+LBB10_2:
+	LEAQ     0x3f(R15), CX         // <--                                  // lea	rcx, [r15 + 63]
+	CMPQ     DX, CX                // <--                                  // cmp	rdx, rcx
+	JLE      LBB10_13              // <--                                  // jle	.LBB10_13
+	VPCMPEQB 0(R12)(R15*1), Z1, K4 // <--                                  // vpcmpeqb	k4, zmm1, zmmword ptr [r12 + r15]
+	MOVL     $0x40, CX             // <--                                  // mov	ecx, 64
+	KMOVQ    K4, R14               // <--                                  // kmovq	r14, k4
+	TESTQ    R14, R14              // <--                                  // test	r14, r14
+	JE       LBB10_14              // <--                                  // je	.LBB10_14
+
+LBB10_3:
+	MOVQ  CX, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], rcx
+	MOVQ  DX, R10      // <--                                  // mov	r10, rdx
+	MOVQ  R15, DX      // <--                                  // mov	rdx, r15
+	MOVQ  R14, R15     // <--                                  // mov	r15, r14
+	KMOVD DI, K7       // <--                                  // kmovd	k7, edi
+
+LBB10_4:
+	XORL    R14, R14          // <--                                  // xor	r14d, r14d
+	MOVQ    R9, CX            // <--                                  // mov	rcx, r9
+	MOVQ    R11, SI           // <--                                  // mov	rsi, r11
+	TZCNTQ  R15, R14          // <--                                  // tzcnt	r14, r15
+	MOVLQSX R14, R14          // <--                                  // movsxd	r14, r14d
+	ADDQ    DX, R14           // <--                                  // add	r14, rdx
+	LEAQ    0(R13)(R14*1), BX // <--                                  // lea	rbx, [r13 + r14 + 0]
+	CMPQ    R9, $0x3f         // <--                                  // cmp	r9, 63
+	JLE     LBB10_11          // <--                                  // jle	.LBB10_11
+	KMOVD   K7, DI            // <--                                  // kmovd	edi, k7
+	JMP     LBB10_6           // <--                                  // jmp	.LBB10_6
+
+LBB10_5:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, BX // <--                                  // add	rbx, 64
+	ADDQ $0x40, SI // <--                                  // add	rsi, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB10_10  // <--                                  // jle	.LBB10_10
+
+LBB10_6:
+	VMOVDQU8 0(BX), Z0                           // <--                                  // vmovdqu8	zmm0, zmmword ptr [rbx]
+	LONG     $0x487df362; WORD $0x63f; BYTE $0x4 // VPCMPNEQB 0(SI), Z0, K0              // vpcmpneqb	k0, zmm0, zmmword ptr [rsi]
+	KORTESTQ K0, K0                              // <--                                  // kortestq	k0, k0
+	JE       LBB10_5                             // <--                                  // je	.LBB10_5
+	KMOVD    DI, K7                              // <--                                  // kmovd	k7, edi
+
+LBB10_7:
+	MOVQ  R14, CX       // <--                                  // mov	rcx, r14
+	ADDQ  $0x1, AX      // <--                                  // add	rax, 1
+	SARQ  $0x8, CX      // <--                                  // sar	rcx, 8
+	ADDQ  $0x4, CX      // <--                                  // add	rcx, 4
+	CMPQ  AX, CX        // <--                                  // cmp	rax, rcx
+	JG    LBB10_19      // <--                                  // jg	.LBB10_19
+	LEAQ  -0x1(R15), CX // <--                                  // lea	rcx, [r15 - 1]
+	ANDQ  CX, R15       // <--                                  // and	r15, rcx
+	JNE   LBB10_4       // <--                                  // jne	.LBB10_4
+	MOVQ  0x30(SP), CX  // <--                                  // mov	rcx, qword ptr [rsp + 48]
+	MOVQ  DX, R15       // <--                                  // mov	r15, rdx
+	KMOVD K7, DI        // <--                                  // kmovd	edi, k7
+	MOVQ  R10, DX       // <--                                  // mov	rdx, r10
+	ADDQ  CX, R15       // <--                                  // add	r15, rcx
+	JMP   LBB10_0       // <--                                  // jmp	.LBB10_0
+
+LBB10_8:
+	MOVQ $0x0, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], 0
+
+LBB10_9:
+	MOVQ 0x38(SP), AX   // <--                                  // mov	rax, qword ptr [rsp + 56]
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB10_10:
+	KMOVD DI, K7   // <--                                  // kmovd	k7, edi
+	TESTQ CX, CX   // <--                                  // test	rcx, rcx
+	JE    LBB10_12 // <--                                  // je	.LBB10_12
+
+LBB10_11:
+	MOVQ       R8, DI                               // <--                                  // mov	rdi, r8
+	SHLQ       CX, DI                               // <--                                  // shl	rdi, cl
+	LEAQ       -0x1(DI), DI                         // <--                                  // lea	rdi, [rdi - 1]
+	KMOVQ      DI, K1                               // <--                                  // kmovq	k1, rdi
+	VMOVDQU8.Z 0(BX), K1, Z2                        // <--                                  // vmovdqu8	zmm2{k1}{z}, zmmword ptr [rbx]
+	VMOVDQU8.Z 0(SI), K1, Z3                        // <--                                  // vmovdqu8	zmm3{k1}{z}, zmmword ptr [rsi]
+	LONG       $0x486df362; WORD $0xc33f; BYTE $0x4 // VPCMPNEQB Z3, Z2, K0                 // vpcmpneqb	k0, zmm2, zmm3
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB10_7                              // <--                                  // jne	.LBB10_7
+
+LBB10_12:
+	ADDQ  $0x1, 0x38(SP)    // <--                                  // add	qword ptr [rsp + 56], 1
+	MOVQ  R10, DX           // <--                                  // mov	rdx, r10
+	LEAQ  0(R9)(R14*1), R15 // <--                                  // lea	r15, [r9 + r14]
+	KMOVD K7, DI            // <--                                  // kmovd	edi, k7
+	JMP   LBB10_0           // <--                                  // jmp	.LBB10_0
+
+LBB10_13:
+	CMPQ       DX, R15                              // <--                                  // cmp	rdx, r15
+	JLE        LBB10_18                             // <--                                  // jle	.LBB10_18
+	MOVQ       DX, CX                               // <--                                  // mov	rcx, rdx
+	MOVQ       R8, R14                              // <--                                  // mov	r14, r8
+	SUBQ       R15, CX                              // <--                                  // sub	rcx, r15
+	SHLQ       CX, R14                              // <--                                  // shl	r14, cl
+	LEAQ       -0x1(R14), BX                        // <--                                  // lea	rbx, [r14 - 1]
+	KMOVQ      BX, K1                               // <--                                  // kmovq	k1, rbx
+	VMOVDQU8.Z 0(R12)(R15*1), K1, Z2                // <--                                  // vmovdqu8	zmm2{k1}{z}, zmmword ptr [r12 + r15]
+	LONG       $0x496df362; WORD $0xe93f; BYTE $0x0 // VPCMPEQB Z1, Z2, K1, K5              // vpcmpeqb	k5{k1}, zmm2, zmm1
+	KMOVQ      K5, R14                              // <--                                  // kmovq	r14, k5
+	TESTQ      R14, R14                             // <--                                  // test	r14, r14
+	JNE        LBB10_3                              // <--                                  // jne	.LBB10_3
+
+LBB10_14:
+	ADDQ CX, R15 // <--                                  // add	r15, rcx
+	JMP  LBB10_0 // <--                                  // jmp	.LBB10_0
+
+LBB10_15:
+	MOVQ  R8, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], r8
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB10_17     // <--                                  // je	.LBB10_17
+
+LBB10_16:
+	MOVQ       R15, R8                              // <--                                  // mov	r8, r15
+	SHLQ       CX, R8                               // <--                                  // shl	r8, cl
+	MOVQ       R8, CX                               // <--                                  // mov	rcx, r8
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(SI), K1, Z1                        // <--                                  // vmovdqu8	zmm1{k1}{z}, zmmword ptr [rsi]
+	VMOVDQU8.Z 0(DX), K1, Z2                        // <--                                  // vmovdqu8	zmm2{k1}{z}, zmmword ptr [rdx]
+	LONG       $0x4875f362; WORD $0xc23f; BYTE $0x4 // VPCMPNEQB Z2, Z1, K0                 // vpcmpneqb	k0, zmm1, zmm2
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB10_38                             // <--                                  // jne	.LBB10_38
+	MOVQ       0x30(SP), R8                         // <--                                  // mov	r8, qword ptr [rsp + 48]
+
+LBB10_17:
+	MOVQ 0x18(SP), R10    // <--                                  // mov	r10, qword ptr [rsp + 24]
+	ADDQ R9, R12          // <--                                  // add	r12, r9
+	ADDQ $0x1, 0x38(SP)   // <--                                  // add	qword ptr [rsp + 56], 1
+	ADDQ R12, R8          // <--                                  // add	r8, r12
+	SUBQ R8, R10          // <--                                  // sub	r10, r8
+	LEAQ 0(R13)(R8*1), DI // <--                                  // lea	rdi, [r13 + r8 + 0]
+	CMPQ R9, R10          // <--                                  // cmp	r9, r10
+	JLE  LBB10_34         // <--                                  // jle	.LBB10_34
+
+LBB10_18:
+	VZEROUPPER         // <--                                  // vzeroupper
+	JMP        LBB10_9 // <--                                  // jmp	.LBB10_9
+
+LBB10_19:
+	MOVQ         R10, AX           // <--                                  // mov	rax, r10
+	MOVQ         0x28(SP), R10     // <--                                  // mov	r10, qword ptr [rsp + 40]
+	MOVQ         R14, SI           // <--                                  // mov	rsi, r14
+	KMOVD        K7, DI            // <--                                  // kmovd	edi, k7
+	VPBROADCASTB DI, Z3            // <--                                  // vpbroadcastb	zmm3, edi
+	ADDQ         $0x1, SI          // <--                                  // add	rsi, 1
+	MOVQ         0x38(SP), DX      // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVL         $0x1, R14         // <--                                  // mov	r14d, 1
+	LEAQ         0(R13)(R10*1), DI // <--                                  // lea	rdi, [r13 + r10 + 0]
+	MOVQ         DI, 0x28(SP)      // <--                                  // mov	qword ptr [rsp + 40], rdi
+	XORL         DI, DI            // <--                                  // xor	edi, edi
+	CMPQ         R9, $0x3f         // <--                                  // cmp	r9, 63
+	SETLE        DI                // <--                                  // setle	dil
+	XORL         BX, BX            // <--                                  // xor	ebx, ebx
+	LEAQ         0x4(DI*4), DI     // <--                                  // lea	rdi, [rdi*4 + 4]
+
+LBB10_20:
+	LEAQ 0x3f(SI), CX // <--                                  // lea	rcx, [rsi + 63]
+	CMPQ AX, CX       // <--                                  // cmp	rax, rcx
+	JLE  LBB10_27     // <--                                  // jle	.LBB10_27
+
+LBB10_21:
+	MOVQ     0x28(SP), CX             // <--                                  // mov	rcx, qword ptr [rsp + 40]
+	VPCMPEQB 0(CX)(SI*1), Z3, K1      // <--                                  // vpcmpeqb	k1, zmm3, zmmword ptr [rcx + rsi]
+	MOVL     $0x40, CX                // <--                                  // mov	ecx, 64
+	VPCMPEQB 0(R12)(SI*1), Z1, K1, K6 // <--                                  // vpcmpeqb	k6{k1}, zmm1, zmmword ptr [r12 + rsi]
+	KMOVQ    K6, R15                  // <--                                  // kmovq	r15, k6
+	TESTQ    R15, R15                 // <--                                  // test	r15, r15
+	JE       LBB10_28                 // <--                                  // je	.LBB10_28
+
+LBB10_22:
+	MOVQ R12, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], r12
+	MOVQ CX, 0x20(SP)  // <--                                  // mov	qword ptr [rsp + 32], rcx
+	MOVQ AX, 0x38(SP)  // <--                                  // mov	qword ptr [rsp + 56], rax
+	MOVQ SI, AX        // <--                                  // mov	rax, rsi
+	MOVQ R15, SI       // <--                                  // mov	rsi, r15
+
+LBB10_23:
+	XORL    R15, R15           // <--                                  // xor	r15d, r15d
+	TZCNTQ  SI, R15            // <--                                  // tzcnt	r15, rsi
+	MOVLQSX R15, R15           // <--                                  // movsxd	r15, r15d
+	ADDQ    AX, R15            // <--                                  // add	r15, rax
+	LEAQ    0(R13)(R15*1), R10 // <--                                  // lea	r10, [r13 + r15 + 0]
+	CMPQ    R9, $0x3f          // <--                                  // cmp	r9, 63
+	JLE     LBB10_32           // <--                                  // jle	.LBB10_32
+	MOVQ    0x38(SP), R12      // <--                                  // mov	r12, qword ptr [rsp + 56]
+	MOVQ    R9, CX             // <--                                  // mov	rcx, r9
+	MOVQ    R11, R8            // <--                                  // mov	r8, r11
+	JMP     LBB10_25           // <--                                  // jmp	.LBB10_25
+
+LBB10_24:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R10 // <--                                  // add	r10, 64
+	ADDQ $0x40, R8  // <--                                  // add	r8, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB10_29   // <--                                  // jle	.LBB10_29
+
+LBB10_25:
+	VMOVDQU8 0(R10), Z5                         // <--                                  // vmovdqu8	zmm5, zmmword ptr [r10]
+	LONG     $0x4855d362; WORD $0x3f; BYTE $0x4 // VPCMPNEQB 0(R8), Z5, K0              // vpcmpneqb	k0, zmm5, zmmword ptr [r8]
+	KORTESTQ K0, K0                             // <--                                  // kortestq	k0, k0
+	JE       LBB10_24                           // <--                                  // je	.LBB10_24
+	MOVQ     R12, 0x38(SP)                      // <--                                  // mov	qword ptr [rsp + 56], r12
+
+LBB10_26:
+	ADDQ $0x1, BX      // <--                                  // add	rbx, 1
+	CMPQ BX, DI        // <--                                  // cmp	rbx, rdi
+	JG   LBB10_33      // <--                                  // jg	.LBB10_33
+	LEAQ -0x1(SI), CX  // <--                                  // lea	rcx, [rsi - 1]
+	ANDQ CX, SI        // <--                                  // and	rsi, rcx
+	JNE  LBB10_23      // <--                                  // jne	.LBB10_23
+	MOVQ 0x20(SP), CX  // <--                                  // mov	rcx, qword ptr [rsp + 32]
+	MOVQ AX, SI        // <--                                  // mov	rsi, rax
+	MOVQ 0x38(SP), AX  // <--                                  // mov	rax, qword ptr [rsp + 56]
+	MOVQ 0x30(SP), R12 // <--                                  // mov	r12, qword ptr [rsp + 48]
+	ADDQ CX, SI        // <--                                  // add	rsi, rcx
+	LEAQ 0x3f(SI), CX  // <--                                  // lea	rcx, [rsi + 63]
+	CMPQ AX, CX        // <--                                  // cmp	rax, rcx
+	JG   LBB10_21      // <--                                  // jg	.LBB10_21
+
+LBB10_27:
+	CMPQ       AX, SI                               // <--                                  // cmp	rax, rsi
+	JLE        LBB10_42                             // <--                                  // jle	.LBB10_42
+	MOVQ       AX, CX                               // <--                                  // mov	rcx, rax
+	MOVQ       R14, R8                              // <--                                  // mov	r8, r14
+	SUBQ       SI, CX                               // <--                                  // sub	rcx, rsi
+	SHLQ       CX, R8                               // <--                                  // shl	r8, cl
+	LEAQ       -0x1(R8), R15                        // <--                                  // lea	r15, [r8 - 1]
+	KMOVQ      R15, K1                              // <--                                  // kmovq	k1, r15
+	MOVQ       0x28(SP), R15                        // <--                                  // mov	r15, qword ptr [rsp + 40]
+	VMOVDQU8.Z 0(R12)(SI*1), K1, Z4                 // <--                                  // vmovdqu8	zmm4{k1}{z}, zmmword ptr [r12 + rsi]
+	LONG       $0x495df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z4, K1, K0              // vpcmpeqb	k0{k1}, zmm4, zmm1
+	VMOVDQU8.Z 0(R15)(SI*1), K1, Z4                 // <--                                  // vmovdqu8	zmm4{k1}{z}, zmmword ptr [r15 + rsi]
+	LONG       $0x495df362; WORD $0xcb3f; BYTE $0x0 // VPCMPEQB Z3, Z4, K1, K1              // vpcmpeqb	k1{k1}, zmm4, zmm3
+	KMOVQ      K0, R8                               // <--                                  // kmovq	r8, k0
+	KMOVQ      K1, R15                              // <--                                  // kmovq	r15, k1
+	ANDQ       R8, R15                              // <--                                  // and	r15, r8
+	TESTQ      R15, R15                             // <--                                  // test	r15, r15
+	JNE        LBB10_22                             // <--                                  // jne	.LBB10_22
+
+LBB10_28:
+	ADDQ CX, SI   // <--                                  // add	rsi, rcx
+	JMP  LBB10_20 // <--                                  // jmp	.LBB10_20
+
+LBB10_29:
+	MOVQ  R12, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], r12
+	TESTQ CX, CX        // <--                                  // test	rcx, rcx
+	JE    LBB10_31      // <--                                  // je	.LBB10_31
+
+LBB10_30:
+	MOVQ       R14, R12                             // <--                                  // mov	r12, r14
+	SHLQ       CX, R12                              // <--                                  // shl	r12, cl
+	MOVQ       R12, CX                              // <--                                  // mov	rcx, r12
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(R10), K1, Z7                       // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [r10]
+	VMOVDQU8.Z 0(R8), K1, Z4                        // <--                                  // vmovdqu8	zmm4{k1}{z}, zmmword ptr [r8]
+	LONG       $0x4845f362; WORD $0xc43f; BYTE $0x4 // VPCMPNEQB Z4, Z7, K0                 // vpcmpneqb	k0, zmm7, zmm4
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB10_26                             // <--                                  // jne	.LBB10_26
+
+LBB10_31:
+	MOVQ 0x38(SP), AX     // <--                                  // mov	rax, qword ptr [rsp + 56]
+	MOVQ 0x30(SP), R12    // <--                                  // mov	r12, qword ptr [rsp + 48]
+	ADDQ $0x1, DX         // <--                                  // add	rdx, 1
+	LEAQ 0(R9)(R15*1), SI // <--                                  // lea	rsi, [r9 + r15]
+	JMP  LBB10_20         // <--                                  // jmp	.LBB10_20
+
+LBB10_32:
+	MOVQ R11, R8  // <--                                  // mov	r8, r11
+	MOVQ R9, CX   // <--                                  // mov	rcx, r9
+	JMP  LBB10_30 // <--                                  // jmp	.LBB10_30
+
+LBB10_33:
+	MOVQ R15, R8           // <--                                  // mov	r8, r15
+	MOVQ 0x18(SP), R14     // <--                                  // mov	r14, qword ptr [rsp + 24]
+	MOVQ DX, 0x38(SP)      // <--                                  // mov	qword ptr [rsp + 56], rdx
+	MOVL $0x1, R15         // <--                                  // mov	r15d, 1
+	ADDQ $0x1, R8          // <--                                  // add	r8, 1
+	LEAQ 0(R13)(R8*1), R10 // <--                                  // lea	r10, [r13 + r8 + 0]
+	SUBQ R8, R14           // <--                                  // sub	r14, r8
+	MOVQ R10, DI           // <--                                  // mov	rdi, r10
+	MOVQ R14, R10          // <--                                  // mov	r10, r14
+	CMPQ R9, R14           // <--                                  // cmp	r9, r14
+	JG   LBB10_18          // <--                                  // jg	.LBB10_18
+
+LBB10_34:
+	MOVQ R10, CX        // <--                                  // mov	rcx, r10
+	MOVQ R9, AX         // <--                                  // mov	rax, r9
+	MOVL $0x1000193, DX // <--                                  // mov	edx, 16777619
+	MOVL $0x1, R14      // <--                                  // mov	r14d, 1
+	SUBQ R9, CX         // <--                                  // sub	rcx, r9
+
+LBB10_35:
+	WORD  $0x1a8   // TESTB $0x1, AX                       // test	al, 1
+	JE    LBB10_36 // <--                                  // je	.LBB10_36
+	IMULL DX, R14  // <--                                  // imul	r14d, edx
+
+LBB10_36:
+	IMULL DX, DX   // <--                                  // imul	edx, edx
+	SHRQ  $0x1, AX // <--                                  // shr	rax, 1
+	JNE   LBB10_35 // <--                                  // jne	.LBB10_35
+	XORL  AX, AX   // <--                                  // xor	eax, eax
+	XORL  DX, DX   // <--                                  // xor	edx, edx
+	XORL  BX, BX   // <--                                  // xor	ebx, ebx
+
+LBB10_37:
+	LONG    $0x193db69; WORD $0x100 // IMULL $0x1000193, BX, BX             // imul	ebx, ebx, 16777619
+	MOVBLZX 0(R11)(DX*1), SI        // <--                                  // movzx	esi, byte ptr [r11 + rdx]
+	LONG    $0x193c069; WORD $0x100 // IMULL $0x1000193, AX, AX             // imul	eax, eax, 16777619
+	ADDL    SI, BX                  // <--                                  // add	ebx, esi
+	MOVBLZX 0(DI)(DX*1), SI         // <--                                  // movzx	esi, byte ptr [rdi + rdx]
+	ADDQ    $0x1, DX                // <--                                  // add	rdx, 1
+	ADDL    SI, AX                  // <--                                  // add	eax, esi
+	CMPQ    R9, DX                  // <--                                  // cmp	r9, rdx
+	JG      LBB10_37                // <--                                  // jg	.LBB10_37
+	MOVQ    R8, 0x30(SP)            // <--                                  // mov	qword ptr [rsp + 48], r8
+	LEAQ    0x1(CX), R10            // <--                                  // lea	r10, [rcx + 1]
+	XORL    R12, R12                // <--                                  // xor	r12d, r12d
+	JMP     LBB10_39                // <--                                  // jmp	.LBB10_39
+
+LBB10_38:
+	ADDQ    $0x1, R12               // <--                                  // add	r12, 1
+	CMPQ    R12, R10                // <--                                  // cmp	r12, r10
+	JE      LBB10_18                // <--                                  // je	.LBB10_18
+	LONG    $0x193c069; WORD $0x100 // IMULL $0x1000193, AX, AX             // imul	eax, eax, 16777619
+	MOVBLZX 0(DI)(R9*1), DX         // <--                                  // movzx	edx, byte ptr [rdi + r9]
+	ADDQ    $0x1, DI                // <--                                  // add	rdi, 1
+	ADDL    DX, AX                  // <--                                  // add	eax, edx
+	MOVBLZX -0x1(DI), DX            // <--                                  // movzx	edx, byte ptr [rdi - 1]
+	IMULL   R14, DX                 // <--                                  // imul	edx, r14d
+	SUBL    DX, AX                  // <--                                  // sub	eax, edx
+
+LBB10_39:
+	CMPL BX, AX       // <--                                  // cmp	ebx, eax
+	JNE  LBB10_38     // <--                                  // jne	.LBB10_38
+	MOVQ DI, SI       // <--                                  // mov	rsi, rdi
+	CMPQ R9, $0x3f    // <--                                  // cmp	r9, 63
+	JLE  LBB10_43     // <--                                  // jle	.LBB10_43
+	MOVQ 0x30(SP), R8 // <--                                  // mov	r8, qword ptr [rsp + 48]
+	MOVQ R9, CX       // <--                                  // mov	rcx, r9
+	MOVQ R11, DX      // <--                                  // mov	rdx, r11
+	JMP  LBB10_41     // <--                                  // jmp	.LBB10_41
+
+LBB10_40:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, SI // <--                                  // add	rsi, 64
+	ADDQ $0x40, DX // <--                                  // add	rdx, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB10_15  // <--                                  // jle	.LBB10_15
+
+LBB10_41:
+	VMOVDQU8 0(SI), Z6                           // <--                                  // vmovdqu8	zmm6, zmmword ptr [rsi]
+	LONG     $0x484df362; WORD $0x23f; BYTE $0x4 // VPCMPNEQB 0(DX), Z6, K0              // vpcmpneqb	k0, zmm6, zmmword ptr [rdx]
+	KORTESTQ K0, K0                              // <--                                  // kortestq	k0, k0
+	JE       LBB10_40                            // <--                                  // je	.LBB10_40
+	MOVQ     R8, 0x30(SP)                        // <--                                  // mov	qword ptr [rsp + 48], r8
+	JMP      LBB10_38                            // <--                                  // jmp	.LBB10_38
+
+LBB10_42:
+	MOVQ       DX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdx
+	VZEROUPPER              // <--                                  // vzeroupper
+	JMP        LBB10_9      // <--                                  // jmp	.LBB10_9
+
+LBB10_43:
+	MOVQ R11, DX  // <--                                  // mov	rdx, r11
+	MOVQ R9, CX   // <--                                  // mov	rcx, r9
+	JMP  LBB10_16 // <--                                  // jmp	.LBB10_16
+
+TEXT ·countFoldAvx512(SB), NOSPLIT, $200-72
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	PUSHQ        BP              // <--                                  // push	rbp
+	MOVQ         SP, BP          // <--                                  // mov	rbp, rsp
+	PUSHQ        R15             // <--                                  // push	r15
+	MOVQ         DI, R15         // <--                                  // mov	r15, rdi
+	MOVQ         R9, DI          // <--                                  // mov	rdi, r9
+	PUSHQ        R14             // <--                                  // push	r14
+	PUSHQ        R13             // <--                                  // push	r13
+	PUSHQ        R12             // <--                                  // push	r12
+	PUSHQ        BX              // <--                                  // push	rbx
+	ANDQ         $-0x40, SP      // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP       // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R9    // <--                                  // mov	r9, qword ptr [rbp + 24]
+	MOVQ         0x10(BP), R11   // <--                                  // mov	r11, qword ptr [rbp + 16]
+	MOVQ         SI, 0x20(SP)    // <--                                  // mov	qword ptr [rsp + 32], rsi
+	TESTQ        R9, R9          // <--                                  // test	r9, r9
+	JLE          LBB11_8         // <--                                  // jle	.LBB11_8
+	CMPQ         SI, R9          // <--                                  // cmp	rsi, r9
+	JL           LBB11_8         // <--                                  // jl	.LBB11_8
+	MOVQ         SI, BX          // <--                                  // mov	rbx, rsi
+	LEAL         -0x61(DX), AX   // <--                                  // lea	eax, [rdx - 97]
+	VPBROADCASTB DX, Z6          // <--                                  // vpbroadcastb	zmm6, edx
+	MOVQ         CX, R12         // <--                                  // mov	r12, rcx
+	SUBQ         R9, BX          // <--                                  // sub	rbx, r9
+	MOVL         $0x20202020, DX // <--                                  // mov	edx, 538976288
+	MOVQ         DI, 0x18(SP)    // <--                                  // mov	qword ptr [rsp + 24], rdi
+	MOVL         R8, R10         // <--                                  // mov	r10d, r8d
+	ADDQ         $0x1, BX        // <--                                  // add	rbx, 1
+	WORD         $0x193c         // CMPB AX, $0x19                       // cmp	al, 25
+	VPBROADCASTD DX, Z4          // <--                                  // vpbroadcastd	zmm4, edx
+	MOVL         $-0x61, DX      // <--                                  // mov	edx, -97
+	SETLS        AX              // <--                                  // setbe	al
+	VPBROADCASTB DX, Z3          // <--                                  // vpbroadcastb	zmm3, edx
+	XORL         R13, R13        // <--                                  // xor	r13d, r13d
+	XORL         R14, R14        // <--                                  // xor	r14d, r14d
+	SHLL         $0x5, AX        // <--                                  // shl	eax, 5
+	MOVL         $0x1a, DX       // <--                                  // mov	edx, 26
+	ADDQ         R15, R12        // <--                                  // add	r12, r15
+	MOVQ         R13, DI         // <--                                  // mov	rdi, r13
+	VPBROADCASTB AX, Z7          // <--                                  // vpbroadcastb	zmm7, eax
+	VPBROADCASTB DX, Z2          // <--                                  // vpbroadcastb	zmm2, edx
+	XORL         AX, AX          // <--                                  // xor	eax, eax
+	MOVQ         BX, DX          // <--                                  // mov	rdx, rbx
+	MOVL         $0x1, R8        // <--                                  // mov	r8d, 1
+	MOVQ         R11, BX         // <--                                  // mov	rbx, r11
+	MOVQ         R14, R11        // <--                                  // mov	r11, r14
+
+LBB11_0:
+	LEAQ 0xff(R11), CX // <--                                  // lea	rcx, [r11 + 255]
+	CMPQ DX, CX        // <--                                  // cmp	rdx, rcx
+	JLE  LBB11_2       // <--                                  // jle	.LBB11_2
+
+LBB11_1:
+	LEAQ  0(R12)(R11*1), SI                    // <--                                  // lea	rsi, [r12 + r11]
+	VPORD 0(SI), Z7, Z0                        // <--                                  // vpord	zmm0, zmm7, zmmword ptr [rsi]
+	LONG  $0x487df362; WORD $0xc63f; BYTE $0x0 // VPCMPEQB Z6, Z0, K0                  // vpcmpeqb	k0, zmm0, zmm6
+	VPORD 0x40(SI), Z7, Z0                     // <--                                  // vpord	zmm0, zmm7, zmmword ptr [rsi + 64]
+	LONG  $0x487df362; WORD $0xce3f; BYTE $0x0 // VPCMPEQB Z6, Z0, K1                  // vpcmpeqb	k1, zmm0, zmm6
+	VPORD 0x80(SI), Z7, Z0                     // <--                                  // vpord	zmm0, zmm7, zmmword ptr [rsi + 128]
+	KMOVQ K0, R14                              // <--                                  // kmovq	r14, k0
+	LONG  $0x487df362; WORD $0xf63f; BYTE $0x0 // VPCMPEQB Z6, Z0, K6                  // vpcmpeqb	k6, zmm0, zmm6
+	VPORD 0xc0(SI), Z7, Z0                     // <--                                  // vpord	zmm0, zmm7, zmmword ptr [rsi + 192]
+	KMOVQ K1, CX                               // <--                                  // kmovq	rcx, k1
+	ORQ   R14, CX                              // <--                                  // or	rcx, r14
+	LONG  $0x487df362; WORD $0xfe3f; BYTE $0x0 // VPCMPEQB Z6, Z0, K7                  // vpcmpeqb	k7, zmm0, zmm6
+	KMOVQ K6, R13                              // <--                                  // kmovq	r13, k6
+	ORQ   R13, CX                              // <--                                  // or	rcx, r13
+	KMOVQ K7, SI                               // <--                                  // kmovq	rsi, k7
+	ORQ   SI, CX                               // <--                                  // or	rcx, rsi
+	JNE   LBB11_2                              // <--                                  // jne	.LBB11_2
+	ADDQ  $0x100, R11                          // <--                                  // add	r11, 256
+	LEAQ  0xff(R11), CX                        // <--                                  // lea	rcx, [r11 + 255]
+	CMPQ  DX, CX                               // <--                                  // cmp	rdx, rcx
+	JG    LBB11_1                              // <--                                  // jg	.LBB11_1
+
+LBB11_2:
+	LEAQ  0x3f(R11), CX                        // <--                                  // lea	rcx, [r11 + 63]
+	CMPQ  DX, CX                               // <--                                  // cmp	rdx, rcx
+	JLE   LBB11_12                             // <--                                  // jle	.LBB11_12
+	VPORD 0(R12)(R11*1), Z7, Z0                // <--                                  // vpord	zmm0, zmm7, zmmword ptr [r12 + r11]
+	LONG  $0x487d7162; WORD $0xd76f            // VMOVDQA32 Z7, Z10                    // vmovdqa32	zmm10, zmm7
+	MOVL  $0x40, SI                            // <--                                  // mov	esi, 64
+	LONG  $0x487df362; WORD $0xee3f; BYTE $0x0 // VPCMPEQB Z6, Z0, K5                  // vpcmpeqb	k5, zmm0, zmm6
+	KMOVQ K5, R14                              // <--                                  // kmovq	r14, k5
+
+LBB11_3:
+	MOVL         $0x20, CX    // <--                                  // mov	ecx, 32
+	VPBROADCASTB CX, Z1       // <--                                  // vpbroadcastb	zmm1, ecx
+	TESTQ        R14, R14     // <--                                  // test	r14, r14
+	JE           LBB11_39     // <--                                  // je	.LBB11_39
+	MOVQ         DX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdx
+	MOVQ         SI, 0x28(SP) // <--                                  // mov	qword ptr [rsp + 40], rsi
+	MOVQ         AX, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], rax
+	MOVQ         R11, AX      // <--                                  // mov	rax, r11
+	MOVQ         R14, R11     // <--                                  // mov	r11, r14
+
+LBB11_4:
+	XORL    R13, R13           // <--                                  // xor	r13d, r13d
+	TZCNTQ  R11, R13           // <--                                  // tzcnt	r13, r11
+	MOVLQSX R13, R13           // <--                                  // movsxd	r13, r13d
+	ADDQ    AX, R13            // <--                                  // add	r13, rax
+	LEAQ    0(R15)(R13*1), R14 // <--                                  // lea	r14, [r15 + r13]
+	CMPQ    R9, $0x3f          // <--                                  // cmp	r9, 63
+	JLE     LBB11_13           // <--                                  // jle	.LBB11_13
+	MOVQ    0x38(SP), DX       // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVQ    R9, CX             // <--                                  // mov	rcx, r9
+	MOVQ    BX, SI             // <--                                  // mov	rsi, rbx
+	JMP     LBB11_6            // <--                                  // jmp	.LBB11_6
+
+LBB11_5:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R14 // <--                                  // add	r14, 64
+	ADDQ $0x40, SI  // <--                                  // add	rsi, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB11_9    // <--                                  // jle	.LBB11_9
+
+LBB11_6:
+	VPORD     0(R14), Z4, Z0                       // <--                                  // vpord	zmm0, zmm4, zmmword ptr [r14]
+	VMOVDQU32 0(SI), Z5                            // <--                                  // vmovdqu32	zmm5, zmmword ptr [rsi]
+	VPADDB    Z3, Z0, Z0                           // <--                                  // vpaddb	zmm0, zmm0, zmm3
+	LONG      $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VPXORD    0(R14), Z5, Z0                       // <--                                  // vpxord	zmm0, zmm5, zmmword ptr [r14]
+	LONG      $0x497df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K1, K0              // vpcmpeqb	k0{k1}, zmm0, zmm1
+	KNOTQ     K0, K0                               // <--                                  // knotq	k0, k0
+	KMOVQ     K0, K2                               // <--                                  // kmovq	k2, k0
+	VPTESTMB  Z0, Z0, K2, K0                       // <--                                  // vptestmb	k0{k2}, zmm0, zmm0
+	KORTESTQ  K0, K0                               // <--                                  // kortestq	k0, k0
+	JE        LBB11_5                              // <--                                  // je	.LBB11_5
+	MOVQ      DX, 0x38(SP)                         // <--                                  // mov	qword ptr [rsp + 56], rdx
+
+LBB11_7:
+	MOVQ R13, CX       // <--                                  // mov	rcx, r13
+	ADDQ $0x1, DI      // <--                                  // add	rdi, 1
+	SARQ $0x8, CX      // <--                                  // sar	rcx, 8
+	ADDQ $0x4, CX      // <--                                  // add	rcx, 4
+	CMPQ DI, CX        // <--                                  // cmp	rdi, rcx
+	JG   LBB11_18      // <--                                  // jg	.LBB11_18
+	LEAQ -0x1(R11), CX // <--                                  // lea	rcx, [r11 - 1]
+	ANDQ CX, R11       // <--                                  // and	r11, rcx
+	JNE  LBB11_4       // <--                                  // jne	.LBB11_4
+	MOVQ 0x28(SP), SI  // <--                                  // mov	rsi, qword ptr [rsp + 40]
+	MOVQ AX, R11       // <--                                  // mov	r11, rax
+	MOVQ 0x38(SP), DX  // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVQ 0x30(SP), AX  // <--                                  // mov	rax, qword ptr [rsp + 48]
+	ADDQ SI, R11       // <--                                  // add	r11, rsi
+	JMP  LBB11_0       // <--                                  // jmp	.LBB11_0
+
+LBB11_8:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	XORL AX, AX         // <--                                  // xor	eax, eax
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB11_9:
+	MOVQ  DX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdx
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB11_11     // <--                                  // je	.LBB11_11
+
+LBB11_10:
+	MOVQ       R8, DX                               // <--                                  // mov	rdx, r8
+	SHLQ       CX, DX                               // <--                                  // shl	rdx, cl
+	LEAQ       -0x1(DX), DX                         // <--                                  // lea	rdx, [rdx - 1]
+	KMOVQ      DX, K1                               // <--                                  // kmovq	k1, rdx
+	VMOVDQU8.Z 0(R14), K1, Z0                       // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r14]
+	VMOVDQU8.Z 0(SI), K1, Z8                        // <--                                  // vmovdqu8	zmm8{k1}{z}, zmmword ptr [rsi]
+	VPORD      Z0, Z4, Z5                           // <--                                  // vpord	zmm5, zmm4, zmm0
+	VPXORD     Z8, Z0, Z0                           // <--                                  // vpxord	zmm0, zmm0, zmm8
+	VPADDB     Z3, Z5, Z5                           // <--                                  // vpaddb	zmm5, zmm5, zmm3
+	LONG       $0x4855f362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z5, K1                 // vpcmpltub	k1, zmm5, zmm2
+	LONG       $0x497df362; WORD $0xc93f; BYTE $0x0 // VPCMPEQB Z1, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm1
+	KNOTQ      K1, K1                               // <--                                  // knotq	k1, k1
+	VPTESTMB   Z0, Z0, K1, K1                       // <--                                  // vptestmb	k1{k1}, zmm0, zmm0
+	KORTESTQ   K1, K1                               // <--                                  // kortestq	k1, k1
+	JNE        LBB11_7                              // <--                                  // jne	.LBB11_7
+
+LBB11_11:
+	MOVQ 0x30(SP), AX      // <--                                  // mov	rax, qword ptr [rsp + 48]
+	MOVQ 0x38(SP), DX      // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	LEAQ 0(R9)(R13*1), R11 // <--                                  // lea	r11, [r9 + r13]
+	ADDQ $0x1, AX          // <--                                  // add	rax, 1
+	JMP  LBB11_0           // <--                                  // jmp	.LBB11_0
+
+LBB11_12:
+	CMPQ       DX, R11                              // <--                                  // cmp	rdx, r11
+	JLE        LBB11_17                             // <--                                  // jle	.LBB11_17
+	MOVQ       DX, SI                               // <--                                  // mov	rsi, rdx
+	MOVQ       R8, R14                              // <--                                  // mov	r14, r8
+	LONG       $0x487d7162; WORD $0xd76f            // VMOVDQA32 Z7, Z10                    // vmovdqa32	zmm10, zmm7
+	SUBQ       R11, SI                              // <--                                  // sub	rsi, r11
+	MOVL       SI, CX                               // <--                                  // mov	ecx, esi
+	SHLQ       CX, R14                              // <--                                  // shl	r14, cl
+	LEAQ       -0x1(R14), CX                        // <--                                  // lea	rcx, [r14 - 1]
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(R12)(R11*1), K1, Z0                // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r12 + r11]
+	VPORD      Z0, Z7, Z0                           // <--                                  // vpord	zmm0, zmm7, zmm0
+	LONG       $0x497df362; WORD $0xf63f; BYTE $0x0 // VPCMPEQB Z6, Z0, K1, K6              // vpcmpeqb	k6{k1}, zmm0, zmm6
+	KMOVQ      K6, R14                              // <--                                  // kmovq	r14, k6
+	JMP        LBB11_3                              // <--                                  // jmp	.LBB11_3
+
+LBB11_13:
+	MOVQ BX, SI   // <--                                  // mov	rsi, rbx
+	MOVQ R9, CX   // <--                                  // mov	rcx, r9
+	JMP  LBB11_10 // <--                                  // jmp	.LBB11_10
+
+LBB11_14:
+	VMOVQ R8, X5   // <--                                  // vmovq	xmm5, r8
+	TESTQ CX, CX   // <--                                  // test	rcx, rcx
+	JE    LBB11_16 // <--                                  // je	.LBB11_16
+
+LBB11_15:
+	MOVQ       R14, R8                              // <--                                  // mov	r8, r14
+	SHLQ       CX, R8                               // <--                                  // shl	r8, cl
+	MOVQ       R8, CX                               // <--                                  // mov	rcx, r8
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(R10), K1, Z0                       // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r10]
+	VMOVDQU8.Z 0(SI), K1, Z7                        // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [rsi]
+	VPORD      Z0, Z3, Z6                           // <--                                  // vpord	zmm6, zmm3, zmm0
+	VPXORD     Z7, Z0, Z0                           // <--                                  // vpxord	zmm0, zmm0, zmm7
+	VPADDB     Z2, Z6, Z6                           // <--                                  // vpaddb	zmm6, zmm6, zmm2
+	LONG       $0x484df362; WORD $0xc93e; BYTE $0x1 // VPCMPLTUB Z1, Z6, K1                 // vpcmpltub	k1, zmm6, zmm1
+	LONG       $0x497df362; WORD $0xc43f; BYTE $0x0 // VPCMPEQB Z4, Z0, K1, K0              // vpcmpeqb	k0{k1}, zmm0, zmm4
+	KNOTQ      K0, K0                               // <--                                  // knotq	k0, k0
+	KMOVQ      K0, K5                               // <--                                  // kmovq	k5, k0
+	VPTESTMB   Z0, Z0, K5, K0                       // <--                                  // vptestmb	k0{k5}, zmm0, zmm0
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB11_35                             // <--                                  // jne	.LBB11_35
+
+LBB11_16:
+	MOVQ  0x38(SP), DI     // <--                                  // mov	rdi, qword ptr [rsp + 56]
+	MOVQ  0x20(SP), R13    // <--                                  // mov	r13, qword ptr [rsp + 32]
+	ADDQ  R9, R12          // <--                                  // add	r12, r9
+	VMOVQ X5, R8           // <--                                  // vmovq	r8, xmm5
+	ADDQ  $0x1, AX         // <--                                  // add	rax, 1
+	ADDQ  R12, DI          // <--                                  // add	rdi, r12
+	SUBQ  DI, R13          // <--                                  // sub	r13, rdi
+	LEAQ  0(R8)(DI*1), R10 // <--                                  // lea	r10, [r8 + rdi]
+	CMPQ  R9, R13          // <--                                  // cmp	r9, r13
+	JLE   LBB11_31         // <--                                  // jle	.LBB11_31
+
+LBB11_17:
+	VZEROUPPER                // <--                                  // vzeroupper
+	LEAQ       -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	BYTE       $0x5b          // POPQ BX                              // pop	rbx
+	WORD       $0x5c41        // POPQ R12                             // pop	r12
+	WORD       $0x5d41        // POPQ R13                             // pop	r13
+	WORD       $0x5e41        // POPQ R14                             // pop	r14
+	WORD       $0x5f41        // POPQ R15                             // pop	r15
+	BYTE       $0x5d          // POPQ BP                              // pop	rbp
+	MOVQ       AX, ret+64(FP) // <--
+	RET                       // <--                                  // ret
+
+LBB11_18:
+	LEAL         -0x61(R10), DX   // <--                                  // lea	edx, [r10 - 97]
+	MOVQ         R13, SI          // <--                                  // mov	rsi, r13
+	MOVQ         0x18(SP), DI     // <--                                  // mov	rdi, qword ptr [rsp + 24]
+	MOVQ         BX, R11          // <--                                  // mov	r11, rbx
+	ADDQ         $0x1, SI         // <--                                  // add	rsi, 1
+	CMPB         DX, $0x19        // <--                                  // cmp	dl, 25
+	MOVQ         0x38(SP), BX     // <--                                  // mov	rbx, qword ptr [rsp + 56]
+	MOVQ         0x30(SP), AX     // <--                                  // mov	rax, qword ptr [rsp + 48]
+	SETLS        DX               // <--                                  // setbe	dl
+	XORL         R14, R14         // <--                                  // xor	r14d, r14d
+	VPBROADCASTB R10, Z8          // <--                                  // vpbroadcastb	zmm8, r10d
+	MOVL         $0x1, R13        // <--                                  // mov	r13d, 1
+	SHLL         $0x5, DX         // <--                                  // shl	edx, 5
+	CMPQ         R9, $0x3f        // <--                                  // cmp	r9, 63
+	VPBROADCASTB DX, Z9           // <--                                  // vpbroadcastb	zmm9, edx
+	LEAQ         0(R15)(DI*1), DX // <--                                  // lea	rdx, [r15 + rdi]
+	SETLE        R14              // <--                                  // setle	r14b
+	XORL         R10, R10         // <--                                  // xor	r10d, r10d
+	MOVQ         DX, 0x28(SP)     // <--                                  // mov	qword ptr [rsp + 40], rdx
+	MOVL         $0x20202020, DX  // <--                                  // mov	edx, 538976288
+	LEAQ         0x4(R14*4), R14  // <--                                  // lea	r14, [r14*4 + 4]
+	VPBROADCASTD DX, Z4           // <--                                  // vpbroadcastd	zmm4, edx
+	MOVL         $-0x61, DX       // <--                                  // mov	edx, -97
+	VPBROADCASTB DX, Z3           // <--                                  // vpbroadcastb	zmm3, edx
+	MOVL         $0x1a, DX        // <--                                  // mov	edx, 26
+	VPBROADCASTB DX, Z2           // <--                                  // vpbroadcastb	zmm2, edx
+	MOVQ         BX, DX           // <--                                  // mov	rdx, rbx
+	MOVQ         SI, BX           // <--                                  // mov	rbx, rsi
+
+LBB11_19:
+	LEAQ 0x3f(BX), CX // <--                                  // lea	rcx, [rbx + 63]
+	CMPQ DX, CX       // <--                                  // cmp	rdx, rcx
+	JLE  LBB11_26     // <--                                  // jle	.LBB11_26
+
+LBB11_20:
+	MOVQ  0x28(SP), DI                         // <--                                  // mov	rdi, qword ptr [rsp + 40]
+	VPORD 0(R12)(BX*1), Z10, Z0                // <--                                  // vpord	zmm0, zmm10, zmmword ptr [r12 + rbx]
+	MOVL  $0x40, CX                            // <--                                  // mov	ecx, 64
+	VPORD 0(DI)(BX*1), Z9, Z1                  // <--                                  // vpord	zmm1, zmm9, zmmword ptr [rdi + rbx]
+	LONG  $0x4875d362; WORD $0xc83f; BYTE $0x0 // VPCMPEQB Z8, Z1, K1                  // vpcmpeqb	k1, zmm1, zmm8
+	LONG  $0x497df362; WORD $0xfe3f; BYTE $0x0 // VPCMPEQB Z6, Z0, K1, K7              // vpcmpeqb	k7{k1}, zmm0, zmm6
+	KMOVQ K7, SI                               // <--                                  // kmovq	rsi, k7
+
+LBB11_21:
+	MOVL         $0x20, DI     // <--                                  // mov	edi, 32
+	VPBROADCASTB DI, Z1        // <--                                  // vpbroadcastb	zmm1, edi
+	TESTQ        SI, SI        // <--                                  // test	rsi, rsi
+	JE           LBB11_40      // <--                                  // je	.LBB11_40
+	MOVQ         R12, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], r12
+	MOVQ         CX, 0x18(SP)  // <--                                  // mov	qword ptr [rsp + 24], rcx
+	MOVQ         DX, 0x38(SP)  // <--                                  // mov	qword ptr [rsp + 56], rdx
+	MOVQ         BX, DX        // <--                                  // mov	rdx, rbx
+	MOVQ         SI, BX        // <--                                  // mov	rbx, rsi
+
+LBB11_22:
+	XORL    DI, DI           // <--                                  // xor	edi, edi
+	MOVQ    R9, CX           // <--                                  // mov	rcx, r9
+	MOVQ    R11, SI          // <--                                  // mov	rsi, r11
+	TZCNTQ  BX, DI           // <--                                  // tzcnt	rdi, rbx
+	MOVLQSX DI, DI           // <--                                  // movsxd	rdi, edi
+	ADDQ    DX, DI           // <--                                  // add	rdi, rdx
+	LEAQ    0(R15)(DI*1), R8 // <--                                  // lea	r8, [r15 + rdi]
+	CMPQ    R9, $0x3f        // <--                                  // cmp	r9, 63
+	JLE     LBB11_28         // <--                                  // jle	.LBB11_28
+	MOVQ    0x38(SP), R12    // <--                                  // mov	r12, qword ptr [rsp + 56]
+	JMP     LBB11_24         // <--                                  // jmp	.LBB11_24
+
+LBB11_23:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R8 // <--                                  // add	r8, 64
+	ADDQ $0x40, SI // <--                                  // add	rsi, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB11_27  // <--                                  // jle	.LBB11_27
+
+LBB11_24:
+	VPORD     0(R8), Z4, Z0                        // <--                                  // vpord	zmm0, zmm4, zmmword ptr [r8]
+	VMOVDQU32 0(SI), Z7                            // <--                                  // vmovdqu32	zmm7, zmmword ptr [rsi]
+	VPADDB    Z3, Z0, Z0                           // <--                                  // vpaddb	zmm0, zmm0, zmm3
+	LONG      $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VPXORD    0(R8), Z7, Z0                        // <--                                  // vpxord	zmm0, zmm7, zmmword ptr [r8]
+	LONG      $0x497df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K1, K0              // vpcmpeqb	k0{k1}, zmm0, zmm1
+	KNOTQ     K0, K0                               // <--                                  // knotq	k0, k0
+	KMOVQ     K0, K3                               // <--                                  // kmovq	k3, k0
+	VPTESTMB  Z0, Z0, K3, K0                       // <--                                  // vptestmb	k0{k3}, zmm0, zmm0
+	KORTESTQ  K0, K0                               // <--                                  // kortestq	k0, k0
+	JE        LBB11_23                             // <--                                  // je	.LBB11_23
+	MOVQ      R12, 0x38(SP)                        // <--                                  // mov	qword ptr [rsp + 56], r12
+
+LBB11_25:
+	ADDQ $0x1, R10     // <--                                  // add	r10, 1
+	CMPQ R10, R14      // <--                                  // cmp	r10, r14
+	JG   LBB11_30      // <--                                  // jg	.LBB11_30
+	LEAQ -0x1(BX), CX  // <--                                  // lea	rcx, [rbx - 1]
+	ANDQ CX, BX        // <--                                  // and	rbx, rcx
+	JNE  LBB11_22      // <--                                  // jne	.LBB11_22
+	MOVQ 0x18(SP), CX  // <--                                  // mov	rcx, qword ptr [rsp + 24]
+	MOVQ DX, BX        // <--                                  // mov	rbx, rdx
+	MOVQ 0x38(SP), DX  // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVQ 0x30(SP), R12 // <--                                  // mov	r12, qword ptr [rsp + 48]
+	ADDQ CX, BX        // <--                                  // add	rbx, rcx
+	LEAQ 0x3f(BX), CX  // <--                                  // lea	rcx, [rbx + 63]
+	CMPQ DX, CX        // <--                                  // cmp	rdx, rcx
+	JG   LBB11_20      // <--                                  // jg	.LBB11_20
+
+LBB11_26:
+	CMPQ       DX, BX                               // <--                                  // cmp	rdx, rbx
+	JLE        LBB11_17                             // <--                                  // jle	.LBB11_17
+	MOVQ       DX, CX                               // <--                                  // mov	rcx, rdx
+	MOVQ       R13, SI                              // <--                                  // mov	rsi, r13
+	SUBQ       BX, CX                               // <--                                  // sub	rcx, rbx
+	SHLQ       CX, SI                               // <--                                  // shl	rsi, cl
+	LEAQ       -0x1(SI), DI                         // <--                                  // lea	rdi, [rsi - 1]
+	KMOVQ      DI, K1                               // <--                                  // kmovq	k1, rdi
+	VMOVDQU8.Z 0(R12)(BX*1), K1, Z0                 // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r12 + rbx]
+	MOVQ       0x28(SP), DI                         // <--                                  // mov	rdi, qword ptr [rsp + 40]
+	VPORD      Z0, Z10, Z0                          // <--                                  // vpord	zmm0, zmm10, zmm0
+	LONG       $0x497df362; WORD $0xc63f; BYTE $0x0 // VPCMPEQB Z6, Z0, K1, K0              // vpcmpeqb	k0{k1}, zmm0, zmm6
+	VMOVDQU8.Z 0(DI)(BX*1), K1, Z0                  // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rdi + rbx]
+	VPORD      Z9, Z0, Z0                           // <--                                  // vpord	zmm0, zmm0, zmm9
+	LONG       $0x497dd362; WORD $0xc83f; BYTE $0x0 // VPCMPEQB Z8, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm8
+	KMOVQ      K0, DI                               // <--                                  // kmovq	rdi, k0
+	KMOVQ      K1, SI                               // <--                                  // kmovq	rsi, k1
+	ANDQ       DI, SI                               // <--                                  // and	rsi, rdi
+	JMP        LBB11_21                             // <--                                  // jmp	.LBB11_21
+
+LBB11_27:
+	MOVQ  R12, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], r12
+	TESTQ CX, CX        // <--                                  // test	rcx, rcx
+	JE    LBB11_29      // <--                                  // je	.LBB11_29
+
+LBB11_28:
+	MOVQ       R13, R12                             // <--                                  // mov	r12, r13
+	SHLQ       CX, R12                              // <--                                  // shl	r12, cl
+	MOVQ       R12, CX                              // <--                                  // mov	rcx, r12
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(R8), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r8]
+	VMOVDQU8.Z 0(SI), K1, Z7                        // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [rsi]
+	VPORD      Z0, Z4, Z5                           // <--                                  // vpord	zmm5, zmm4, zmm0
+	VPXORD     Z7, Z0, Z0                           // <--                                  // vpxord	zmm0, zmm0, zmm7
+	VPADDB     Z3, Z5, Z5                           // <--                                  // vpaddb	zmm5, zmm5, zmm3
+	LONG       $0x4855f362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z5, K1                 // vpcmpltub	k1, zmm5, zmm2
+	LONG       $0x497df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K1, K0              // vpcmpeqb	k0{k1}, zmm0, zmm1
+	KNOTQ      K0, K0                               // <--                                  // knotq	k0, k0
+	KMOVQ      K0, K4                               // <--                                  // kmovq	k4, k0
+	VPTESTMB   Z0, Z0, K4, K0                       // <--                                  // vptestmb	k0{k4}, zmm0, zmm0
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB11_25                             // <--                                  // jne	.LBB11_25
+
+LBB11_29:
+	MOVQ 0x38(SP), DX    // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVQ 0x30(SP), R12   // <--                                  // mov	r12, qword ptr [rsp + 48]
+	ADDQ $0x1, AX        // <--                                  // add	rax, 1
+	LEAQ 0(R9)(DI*1), BX // <--                                  // lea	rbx, [r9 + rdi]
+	JMP  LBB11_19        // <--                                  // jmp	.LBB11_19
+
+LBB11_30:
+	MOVQ         0x20(SP), R13     // <--                                  // mov	r13, qword ptr [rsp + 32]
+	ADDQ         $0x1, DI          // <--                                  // add	rdi, 1
+	LEAQ         0(R15)(DI*1), R10 // <--                                  // lea	r10, [r15 + rdi]
+	SUBQ         DI, R13           // <--                                  // sub	r13, rdi
+	CMPQ         R9, R13           // <--                                  // cmp	r9, r13
+	JG           LBB11_17          // <--                                  // jg	.LBB11_17
+	MOVL         $0x20202020, DX   // <--                                  // mov	edx, 538976288
+	MOVQ         R15, R8           // <--                                  // mov	r8, r15
+	VPBROADCASTD DX, Z3            // <--                                  // vpbroadcastd	zmm3, edx
+	MOVL         $-0x61, DX        // <--                                  // mov	edx, -97
+	VPBROADCASTB DX, Z2            // <--                                  // vpbroadcastb	zmm2, edx
+	MOVL         $0x1a, DX         // <--                                  // mov	edx, 26
+	VPBROADCASTB DX, Z1            // <--                                  // vpbroadcastb	zmm1, edx
+
+LBB11_31:
+	SUBQ R9, R13        // <--                                  // sub	r13, r9
+	MOVQ R9, DX         // <--                                  // mov	rdx, r9
+	MOVL $0x1000193, CX // <--                                  // mov	ecx, 16777619
+	MOVL $0x1, R15      // <--                                  // mov	r15d, 1
+
+LBB11_32:
+	TESTB $0x1, DX // <--                                  // test	dl, 1
+	JE    LBB11_33 // <--                                  // je	.LBB11_33
+	IMULL CX, R15  // <--                                  // imul	r15d, ecx
+
+LBB11_33:
+	IMULL CX, CX   // <--                                  // imul	ecx, ecx
+	SHRQ  $0x1, DX // <--                                  // shr	rdx, 1
+	JNE   LBB11_32 // <--                                  // jne	.LBB11_32
+	XORL  DX, DX   // <--                                  // xor	edx, edx
+	XORL  SI, SI   // <--                                  // xor	esi, esi
+	XORL  BX, BX   // <--                                  // xor	ebx, ebx
+
+LBB11_34:
+	MOVBLZX      0(R11)(SI*1), CX        // <--                                  // movzx	ecx, byte ptr [r11 + rsi]
+	LONG         $0x193db69; WORD $0x100 // IMULL $0x1000193, BX, BX             // imul	ebx, ebx, 16777619
+	LEAL         -0x61(CX), R14          // <--                                  // lea	r14d, [rcx - 97]
+	LEAL         -0x20(CX), R12          // <--                                  // lea	r12d, [rcx - 32]
+	CMPB         R14, $0x1a              // <--                                  // cmp	r14b, 26
+	CMOVLCS      R12, CX                 // <--                                  // cmovb	ecx, r12d
+	MOVBLZX      CX, CX                  // <--                                  // movzx	ecx, cl
+	ADDL         CX, BX                  // <--                                  // add	ebx, ecx
+	LONG         $0x193ca69; WORD $0x100 // IMULL $0x1000193, DX, CX             // imul	ecx, edx, 16777619
+	MOVBLZX      0(R10)(SI*1), DX        // <--                                  // movzx	edx, byte ptr [r10 + rsi]
+	LEAL         -0x61(DX), R14          // <--                                  // lea	r14d, [rdx - 97]
+	LEAL         -0x20(DX), R12          // <--                                  // lea	r12d, [rdx - 32]
+	CMPB         R14, $0x1a              // <--                                  // cmp	r14b, 26
+	CMOVLCS      R12, DX                 // <--                                  // cmovb	edx, r12d
+	ADDQ         $0x1, SI                // <--                                  // add	rsi, 1
+	MOVBLZX      DX, DX                  // <--                                  // movzx	edx, dl
+	ADDL         CX, DX                  // <--                                  // add	edx, ecx
+	CMPQ         R9, SI                  // <--                                  // cmp	r9, rsi
+	JG           LBB11_34                // <--                                  // jg	.LBB11_34
+	ADDQ         $0x1, R13               // <--                                  // add	r13, 1
+	MOVL         $0x20, CX               // <--                                  // mov	ecx, 32
+	MOVQ         DI, 0x38(SP)            // <--                                  // mov	qword ptr [rsp + 56], rdi
+	XORL         R12, R12                // <--                                  // xor	r12d, r12d
+	MOVQ         R13, DI                 // <--                                  // mov	rdi, r13
+	MOVL         $0x1, R14               // <--                                  // mov	r14d, 1
+	MOVL         BX, R13                 // <--                                  // mov	r13d, ebx
+	MOVQ         R10, BX                 // <--                                  // mov	rbx, r10
+	VPBROADCASTB CX, Z4                  // <--                                  // vpbroadcastb	zmm4, ecx
+	VMOVQ        R8, X5                  // <--                                  // vmovq	xmm5, r8
+	JMP          LBB11_36                // <--                                  // jmp	.LBB11_36
+
+LBB11_35:
+	ADDQ    $0x1, R12               // <--                                  // add	r12, 1
+	CMPQ    R12, DI                 // <--                                  // cmp	r12, rdi
+	JE      LBB11_17                // <--                                  // je	.LBB11_17
+	MOVBLZX 0(BX), CX               // <--                                  // movzx	ecx, byte ptr [rbx]
+	LONG    $0x193d269; WORD $0x100 // IMULL $0x1000193, DX, DX             // imul	edx, edx, 16777619
+	LEAL    -0x61(CX), R10          // <--                                  // lea	r10d, [rcx - 97]
+	LEAL    -0x20(CX), SI           // <--                                  // lea	esi, [rcx - 32]
+	CMPB    R10, $0x1a              // <--                                  // cmp	r10b, 26
+	CMOVLCS SI, CX                  // <--                                  // cmovb	ecx, esi
+	MOVBLZX CX, CX                  // <--                                  // movzx	ecx, cl
+	IMULL   R15, CX                 // <--                                  // imul	ecx, r15d
+	SUBL    CX, DX                  // <--                                  // sub	edx, ecx
+	MOVBLZX 0(BX)(R9*1), CX         // <--                                  // movzx	ecx, byte ptr [rbx + r9]
+	LEAL    -0x61(CX), R10          // <--                                  // lea	r10d, [rcx - 97]
+	LEAL    -0x20(CX), SI           // <--                                  // lea	esi, [rcx - 32]
+	CMPB    R10, $0x1a              // <--                                  // cmp	r10b, 26
+	CMOVLCS SI, CX                  // <--                                  // cmovb	ecx, esi
+	ADDQ    $0x1, BX                // <--                                  // add	rbx, 1
+	MOVBLZX CX, CX                  // <--                                  // movzx	ecx, cl
+	ADDL    CX, DX                  // <--                                  // add	edx, ecx
+
+LBB11_36:
+	CMPL  R13, DX   // <--                                  // cmp	r13d, edx
+	JNE   LBB11_35  // <--                                  // jne	.LBB11_35
+	MOVQ  BX, R10   // <--                                  // mov	r10, rbx
+	MOVQ  R9, CX    // <--                                  // mov	rcx, r9
+	MOVQ  R11, SI   // <--                                  // mov	rsi, r11
+	CMPQ  R9, $0x3f // <--                                  // cmp	r9, 63
+	JLE   LBB11_15  // <--                                  // jle	.LBB11_15
+	VMOVQ X5, R8    // <--                                  // vmovq	r8, xmm5
+	JMP   LBB11_38  // <--                                  // jmp	.LBB11_38
+
+LBB11_37:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R10 // <--                                  // add	r10, 64
+	ADDQ $0x40, SI  // <--                                  // add	rsi, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB11_14   // <--                                  // jle	.LBB11_14
+
+LBB11_38:
+	VPORD     0(R10), Z3, Z0                       // <--                                  // vpord	zmm0, zmm3, zmmword ptr [r10]
+	VMOVDQU32 0(SI), Z6                            // <--                                  // vmovdqu32	zmm6, zmmword ptr [rsi]
+	VPADDB    Z2, Z0, Z0                           // <--                                  // vpaddb	zmm0, zmm0, zmm2
+	LONG      $0x487df362; WORD $0xc93e; BYTE $0x1 // VPCMPLTUB Z1, Z0, K1                 // vpcmpltub	k1, zmm0, zmm1
+	VPXORD    0(R10), Z6, Z0                       // <--                                  // vpxord	zmm0, zmm6, zmmword ptr [r10]
+	LONG      $0x497df362; WORD $0xcc3f; BYTE $0x0 // VPCMPEQB Z4, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm4
+	KNOTQ     K1, K1                               // <--                                  // knotq	k1, k1
+	VPTESTMB  Z0, Z0, K1, K1                       // <--                                  // vptestmb	k1{k1}, zmm0, zmm0
+	KORTESTQ  K1, K1                               // <--                                  // kortestq	k1, k1
+	JE        LBB11_37                             // <--                                  // je	.LBB11_37
+	VMOVQ     R8, X5                               // <--                                  // vmovq	xmm5, r8
+	JMP       LBB11_35                             // <--                                  // jmp	.LBB11_35
+
+LBB11_39:
+	ADDQ SI, R11 // <--                                  // add	r11, rsi
+	JMP  LBB11_0 // <--                                  // jmp	.LBB11_0
+
+LBB11_40:
+	ADDQ CX, BX   // <--                                  // add	rbx, rcx
+	JMP  LBB11_19 // <--                                  // jmp	.LBB11_19
+
+TEXT ·countNeedleFoldAvx512(SB), NOSPLIT, $200-72
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	PUSHQ        BP               // <--                                  // push	rbp
+	MOVQ         SP, BP           // <--                                  // mov	rbp, rsp
+	PUSHQ        R15              // <--                                  // push	r15
+	PUSHQ        R14              // <--                                  // push	r14
+	PUSHQ        R13              // <--                                  // push	r13
+	PUSHQ        R12              // <--                                  // push	r12
+	MOVQ         DI, R12          // <--                                  // mov	r12, rdi
+	MOVQ         R9, DI           // <--                                  // mov	rdi, r9
+	PUSHQ        BX               // <--                                  // push	rbx
+	ANDQ         $-0x40, SP       // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP        // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R9     // <--                                  // mov	r9, qword ptr [rbp + 24]
+	MOVQ         0x10(BP), R11    // <--                                  // mov	r11, qword ptr [rbp + 16]
+	MOVQ         SI, 0x20(SP)     // <--                                  // mov	qword ptr [rsp + 32], rsi
+	TESTQ        R9, R9           // <--                                  // test	r9, r9
+	JLE          LBB12_8          // <--                                  // jle	.LBB12_8
+	CMPQ         SI, R9           // <--                                  // cmp	rsi, r9
+	JL           LBB12_8          // <--                                  // jl	.LBB12_8
+	MOVQ         SI, BX           // <--                                  // mov	rbx, rsi
+	LEAL         -0x61(DX), AX    // <--                                  // lea	eax, [rdx - 97]
+	MOVQ         DI, 0x18(SP)     // <--                                  // mov	qword ptr [rsp + 24], rdi
+	VPBROADCASTB DX, Z6           // <--                                  // vpbroadcastb	zmm6, edx
+	SUBQ         R9, BX           // <--                                  // sub	rbx, r9
+	MOVL         $-0x41, DX       // <--                                  // mov	edx, -65
+	MOVL         $0x1, R15        // <--                                  // mov	r15d, 1
+	ADDQ         $0x1, BX         // <--                                  // add	rbx, 1
+	WORD         $0x193c          // CMPB AX, $0x19                       // cmp	al, 25
+	VPBROADCASTB DX, Z3           // <--                                  // vpbroadcastb	zmm3, edx
+	MOVL         $0x1a, DX        // <--                                  // mov	edx, 26
+	SETLS        AX               // <--                                  // setbe	al
+	VPBROADCASTB DX, Z2           // <--                                  // vpbroadcastb	zmm2, edx
+	XORL         R14, R14         // <--                                  // xor	r14d, r14d
+	MOVL         $0x20, DX        // <--                                  // mov	edx, 32
+	SHLL         $0x5, AX         // <--                                  // shl	eax, 5
+	VPBROADCASTB DX, Z1           // <--                                  // vpbroadcastb	zmm1, edx
+	MOVQ         R14, DI          // <--                                  // mov	rdi, r14
+	VPBROADCASTB AX, Z5           // <--                                  // vpbroadcastb	zmm5, eax
+	LEAQ         0(R12)(CX*1), AX // <--                                  // lea	rax, [r12 + rcx]
+	MOVQ         AX, 0x30(SP)     // <--                                  // mov	qword ptr [rsp + 48], rax
+	XORL         AX, AX           // <--                                  // xor	eax, eax
+
+LBB12_0:
+	LEAQ 0xff(DI), CX // <--                                  // lea	rcx, [rdi + 255]
+	CMPQ BX, CX       // <--                                  // cmp	rbx, rcx
+	JLE  LBB12_2      // <--                                  // jle	.LBB12_2
+
+LBB12_1:
+	MOVQ  0x30(SP), SI                         // <--                                  // mov	rsi, qword ptr [rsp + 48]
+	ADDQ  DI, SI                               // <--                                  // add	rsi, rdi
+	VPORD 0(SI), Z5, Z0                        // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi]
+	LONG  $0x487df362; WORD $0xc63f; BYTE $0x0 // VPCMPEQB Z6, Z0, K0                  // vpcmpeqb	k0, zmm0, zmm6
+	VPORD 0x40(SI), Z5, Z0                     // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi + 64]
+	LONG  $0x487df362; WORD $0xce3f; BYTE $0x0 // VPCMPEQB Z6, Z0, K1                  // vpcmpeqb	k1, zmm0, zmm6
+	VPORD 0x80(SI), Z5, Z0                     // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi + 128]
+	KMOVQ K0, DX                               // <--                                  // kmovq	rdx, k0
+	LONG  $0x487df362; WORD $0xd63f; BYTE $0x0 // VPCMPEQB Z6, Z0, K2                  // vpcmpeqb	k2, zmm0, zmm6
+	VPORD 0xc0(SI), Z5, Z0                     // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi + 192]
+	KMOVQ K1, CX                               // <--                                  // kmovq	rcx, k1
+	ORQ   DX, CX                               // <--                                  // or	rcx, rdx
+	LONG  $0x487df362; WORD $0xde3f; BYTE $0x0 // VPCMPEQB Z6, Z0, K3                  // vpcmpeqb	k3, zmm0, zmm6
+	KMOVQ K2, R10                              // <--                                  // kmovq	r10, k2
+	ORQ   R10, CX                              // <--                                  // or	rcx, r10
+	KMOVQ K3, SI                               // <--                                  // kmovq	rsi, k3
+	ORQ   SI, CX                               // <--                                  // or	rcx, rsi
+	JNE   LBB12_2                              // <--                                  // jne	.LBB12_2
+	ADDQ  $0x100, DI                           // <--                                  // add	rdi, 256
+	LEAQ  0xff(DI), CX                         // <--                                  // lea	rcx, [rdi + 255]
+	CMPQ  BX, CX                               // <--                                  // cmp	rbx, rcx
+	JG    LBB12_1                              // <--                                  // jg	.LBB12_1
+
+LBB12_2:
+	LEAQ  0x3f(DI), CX                         // <--                                  // lea	rcx, [rdi + 63]
+	CMPQ  BX, CX                               // <--                                  // cmp	rbx, rcx
+	JLE   LBB12_12                             // <--                                  // jle	.LBB12_12
+	MOVQ  0x30(SP), SI                         // <--                                  // mov	rsi, qword ptr [rsp + 48]
+	LONG  $0x487d7162; WORD $0xcd6f            // VMOVDQA32 Z5, Z9                     // vmovdqa32	zmm9, zmm5
+	MOVL  $0x40, CX                            // <--                                  // mov	ecx, 64
+	VPORD 0(SI)(DI*1), Z5, Z0                  // <--                                  // vpord	zmm0, zmm5, zmmword ptr [rsi + rdi]
+	LONG  $0x487df362; WORD $0xe63f; BYTE $0x0 // VPCMPEQB Z6, Z0, K4                  // vpcmpeqb	k4, zmm0, zmm6
+	KMOVQ K4, R13                              // <--                                  // kmovq	r13, k4
+
+LBB12_3:
+	TESTQ R13, R13     // <--                                  // test	r13, r13
+	JE    LBB12_40     // <--                                  // je	.LBB12_40
+	MOVQ  CX, 0x28(SP) // <--                                  // mov	qword ptr [rsp + 40], rcx
+	MOVQ  AX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rax
+	MOVQ  DI, AX       // <--                                  // mov	rax, rdi
+	MOVQ  R13, DI      // <--                                  // mov	rdi, r13
+
+LBB12_4:
+	XORL    SI, SI            // <--                                  // xor	esi, esi
+	TZCNTQ  DI, SI            // <--                                  // tzcnt	rsi, rdi
+	MOVLQSX SI, SI            // <--                                  // movsxd	rsi, esi
+	ADDQ    AX, SI            // <--                                  // add	rsi, rax
+	LEAQ    0(R12)(SI*1), R10 // <--                                  // lea	r10, [r12 + rsi]
+	CMPQ    R9, $0x3f         // <--                                  // cmp	r9, 63
+	JLE     LBB12_13          // <--                                  // jle	.LBB12_13
+	MOVQ    0x38(SP), DX      // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVQ    R9, CX            // <--                                  // mov	rcx, r9
+	MOVQ    R11, R13          // <--                                  // mov	r13, r11
+	JMP     LBB12_6           // <--                                  // jmp	.LBB12_6
+
+LBB12_5:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R10 // <--                                  // add	r10, 64
+	ADDQ $0x40, R13 // <--                                  // add	r13, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB12_9    // <--                                  // jle	.LBB12_9
+
+LBB12_6:
+	VPADDB   0(R10), Z3, Z0                       // <--                                  // vpaddb	zmm0, zmm3, zmmword ptr [r10]
+	LONG     $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VMOVDQU8 0(R10), Z0                           // <--                                  // vmovdqu8	zmm0, zmmword ptr [r10]
+	VPADDB   Z0, Z1, K1, Z0                       // <--                                  // vpaddb	zmm0{k1}, zmm1, zmm0
+	LONG     $0x487dd362; LONG $0x400453f         // VPCMPNEQB 0(R13), Z0, K0             // vpcmpneqb	k0, zmm0, zmmword ptr [r13 + 0]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JE       LBB12_5                              // <--                                  // je	.LBB12_5
+	MOVQ     DX, 0x38(SP)                         // <--                                  // mov	qword ptr [rsp + 56], rdx
+
+LBB12_7:
+	MOVQ SI, CX       // <--                                  // mov	rcx, rsi
+	ADDQ $0x1, R14    // <--                                  // add	r14, 1
+	SARQ $0x8, CX     // <--                                  // sar	rcx, 8
+	ADDQ $0x4, CX     // <--                                  // add	rcx, 4
+	CMPQ R14, CX      // <--                                  // cmp	r14, rcx
+	JG   LBB12_18     // <--                                  // jg	.LBB12_18
+	LEAQ -0x1(DI), CX // <--                                  // lea	rcx, [rdi - 1]
+	ANDQ CX, DI       // <--                                  // and	rdi, rcx
+	JNE  LBB12_4      // <--                                  // jne	.LBB12_4
+	MOVQ 0x28(SP), CX // <--                                  // mov	rcx, qword ptr [rsp + 40]
+	MOVQ AX, DI       // <--                                  // mov	rdi, rax
+	MOVQ 0x38(SP), AX // <--                                  // mov	rax, qword ptr [rsp + 56]
+	ADDQ CX, DI       // <--                                  // add	rdi, rcx
+	JMP  LBB12_0      // <--                                  // jmp	.LBB12_0
+
+LBB12_8:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	XORL AX, AX         // <--                                  // xor	eax, eax
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB12_9:
+	MOVQ  DX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdx
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB12_11     // <--                                  // je	.LBB12_11
+
+LBB12_10:
+	MOVQ       R15, DX                              // <--                                  // mov	rdx, r15
+	SHLQ       CX, DX                               // <--                                  // shl	rdx, cl
+	LEAQ       -0x1(DX), DX                         // <--                                  // lea	rdx, [rdx - 1]
+	KMOVQ      DX, K1                               // <--                                  // kmovq	k1, rdx
+	VMOVDQU8.Z 0(R10), K1, Z0                       // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r10]
+	VMOVDQU8.Z 0(R13), K1, Z8                       // <--                                  // vmovdqu8	zmm8{k1}{z}, zmmword ptr [r13 + 0]
+	VPADDB     Z3, Z0, Z7                           // <--                                  // vpaddb	zmm7, zmm0, zmm3
+	LONG       $0x4845f362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z7, K1                 // vpcmpltub	k1, zmm7, zmm2
+	LONG       $0x48fdf162; WORD $0xf86f            // VMOVDQA64 Z0, Z7                     // vmovdqa64	zmm7, zmm0
+	VPADDB     Z1, Z0, K1, Z7                       // <--                                  // vpaddb	zmm7{k1}, zmm0, zmm1
+	LONG       $0x4845d362; WORD $0xc03f; BYTE $0x4 // VPCMPNEQB Z8, Z7, K0                 // vpcmpneqb	k0, zmm7, zmm8
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB12_7                              // <--                                  // jne	.LBB12_7
+
+LBB12_11:
+	MOVQ 0x38(SP), AX    // <--                                  // mov	rax, qword ptr [rsp + 56]
+	LEAQ 0(R9)(SI*1), DI // <--                                  // lea	rdi, [r9 + rsi]
+	ADDQ $0x1, AX        // <--                                  // add	rax, 1
+	JMP  LBB12_0         // <--                                  // jmp	.LBB12_0
+
+LBB12_12:
+	CMPQ       BX, DI                               // <--                                  // cmp	rbx, rdi
+	JLE        LBB12_17                             // <--                                  // jle	.LBB12_17
+	MOVQ       BX, CX                               // <--                                  // mov	rcx, rbx
+	MOVQ       R15, R13                             // <--                                  // mov	r13, r15
+	LONG       $0x487d7162; WORD $0xcd6f            // VMOVDQA32 Z5, Z9                     // vmovdqa32	zmm9, zmm5
+	SUBQ       DI, CX                               // <--                                  // sub	rcx, rdi
+	SHLQ       CX, R13                              // <--                                  // shl	r13, cl
+	LEAQ       -0x1(R13), SI                        // <--                                  // lea	rsi, [r13 - 1]
+	KMOVQ      SI, K1                               // <--                                  // kmovq	k1, rsi
+	MOVQ       0x30(SP), SI                         // <--                                  // mov	rsi, qword ptr [rsp + 48]
+	VMOVDQU8.Z 0(SI)(DI*1), K1, Z0                  // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rsi + rdi]
+	VPORD      Z0, Z5, Z0                           // <--                                  // vpord	zmm0, zmm5, zmm0
+	LONG       $0x497df362; WORD $0xee3f; BYTE $0x0 // VPCMPEQB Z6, Z0, K1, K5              // vpcmpeqb	k5{k1}, zmm0, zmm6
+	KMOVQ      K5, R13                              // <--                                  // kmovq	r13, k5
+	JMP        LBB12_3                              // <--                                  // jmp	.LBB12_3
+
+LBB12_13:
+	MOVQ R11, R13 // <--                                  // mov	r13, r11
+	MOVQ R9, CX   // <--                                  // mov	rcx, r9
+	JMP  LBB12_10 // <--                                  // jmp	.LBB12_10
+
+LBB12_14:
+	MOVQ  DI, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdi
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB12_16     // <--                                  // je	.LBB12_16
+
+LBB12_15:
+	MOVQ       R13, DI                              // <--                                  // mov	rdi, r13
+	SHLQ       CX, DI                               // <--                                  // shl	rdi, cl
+	LEAQ       -0x1(DI), DI                         // <--                                  // lea	rdi, [rdi - 1]
+	KMOVQ      DI, K1                               // <--                                  // kmovq	k1, rdi
+	VMOVDQU8.Z 0(R12), K1, Z0                       // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r12]
+	VMOVDQU8.Z 0(R14), K1, Z6                       // <--                                  // vmovdqu8	zmm6{k1}{z}, zmmword ptr [r14]
+	VPADDB     Z3, Z0, Z5                           // <--                                  // vpaddb	zmm5, zmm0, zmm3
+	LONG       $0x4855f362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z5, K1                 // vpcmpltub	k1, zmm5, zmm2
+	LONG       $0x48fdf162; WORD $0xe86f            // VMOVDQA64 Z0, Z5                     // vmovdqa64	zmm5, zmm0
+	VPADDB     Z1, Z0, K1, Z5                       // <--                                  // vpaddb	zmm5{k1}, zmm0, zmm1
+	LONG       $0x4855f362; WORD $0xc63f; BYTE $0x4 // VPCMPNEQB Z6, Z5, K0                 // vpcmpneqb	k0, zmm5, zmm6
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB12_35                             // <--                                  // jne	.LBB12_35
+	MOVQ       0x38(SP), DI                         // <--                                  // mov	rdi, qword ptr [rsp + 56]
+
+LBB12_16:
+	MOVQ  0x20(SP), BX     // <--                                  // mov	rbx, qword ptr [rsp + 32]
+	ADDQ  R9, R10          // <--                                  // add	r10, r9
+	VMOVQ X4, R15          // <--                                  // vmovq	r15, xmm4
+	ADDQ  $0x1, AX         // <--                                  // add	rax, 1
+	ADDQ  R10, DI          // <--                                  // add	rdi, r10
+	SUBQ  DI, BX           // <--                                  // sub	rbx, rdi
+	LEAQ  0(R15)(DI*1), SI // <--                                  // lea	rsi, [r15 + rdi]
+	CMPQ  R9, BX           // <--                                  // cmp	r9, rbx
+	JLE   LBB12_31         // <--                                  // jle	.LBB12_31
+
+LBB12_17:
+	VZEROUPPER                // <--                                  // vzeroupper
+	LEAQ       -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	BYTE       $0x5b          // POPQ BX                              // pop	rbx
+	WORD       $0x5c41        // POPQ R12                             // pop	r12
+	WORD       $0x5d41        // POPQ R13                             // pop	r13
+	WORD       $0x5e41        // POPQ R14                             // pop	r14
+	WORD       $0x5f41        // POPQ R15                             // pop	r15
+	BYTE       $0x5d          // POPQ BP                              // pop	rbp
+	MOVQ       AX, ret+64(FP) // <--
+	RET                       // <--                                  // ret
+
+LBB12_18:
+	LEAL         -0x61(R8), DX   // <--                                  // lea	edx, [r8 - 97]
+	ADDQ         $0x1, SI        // <--                                  // add	rsi, 1
+	MOVQ         0x18(SP), DI    // <--                                  // mov	rdi, qword ptr [rsp + 24]
+	MOVQ         0x38(SP), AX    // <--                                  // mov	rax, qword ptr [rsp + 56]
+	CMPB         DX, $0x19       // <--                                  // cmp	dl, 25
+	VPBROADCASTB R8, Z0          // <--                                  // vpbroadcastb	zmm0, r8d
+	MOVL         $0x1, R13       // <--                                  // mov	r13d, 1
+	SETLS        DX              // <--                                  // setbe	dl
+	ADDQ         R12, DI         // <--                                  // add	rdi, r12
+	XORL         R15, R15        // <--                                  // xor	r15d, r15d
+	SHLL         $0x5, DX        // <--                                  // shl	edx, 5
+	MOVQ         DI, 0x28(SP)    // <--                                  // mov	qword ptr [rsp + 40], rdi
+	CMPQ         R9, $0x3f       // <--                                  // cmp	r9, 63
+	VPBROADCASTB DX, Z8          // <--                                  // vpbroadcastb	zmm8, edx
+	MOVL         $-0x41, DX      // <--                                  // mov	edx, -65
+	SETLE        R15             // <--                                  // setle	r15b
+	XORL         R10, R10        // <--                                  // xor	r10d, r10d
+	VPBROADCASTB DX, Z3          // <--                                  // vpbroadcastb	zmm3, edx
+	MOVL         $0x1a, DX       // <--                                  // mov	edx, 26
+	LEAQ         0x4(R15*4), R15 // <--                                  // lea	r15, [r15*4 + 4]
+	VPBROADCASTB DX, Z2          // <--                                  // vpbroadcastb	zmm2, edx
+	MOVL         $0x20, DX       // <--                                  // mov	edx, 32
+	VPBROADCASTB DX, Z1          // <--                                  // vpbroadcastb	zmm1, edx
+
+LBB12_19:
+	LEAQ 0x3f(SI), DX // <--                                  // lea	rdx, [rsi + 63]
+	CMPQ BX, DX       // <--                                  // cmp	rbx, rdx
+	JLE  LBB12_26     // <--                                  // jle	.LBB12_26
+
+LBB12_20:
+	MOVQ  0x30(SP), DI                         // <--                                  // mov	rdi, qword ptr [rsp + 48]
+	MOVL  $0x40, DX                            // <--                                  // mov	edx, 64
+	VPORD 0(DI)(SI*1), Z9, Z7                  // <--                                  // vpord	zmm7, zmm9, zmmword ptr [rdi + rsi]
+	MOVQ  0x28(SP), DI                         // <--                                  // mov	rdi, qword ptr [rsp + 40]
+	VPORD 0(DI)(SI*1), Z8, Z10                 // <--                                  // vpord	zmm10, zmm8, zmmword ptr [rdi + rsi]
+	LONG  $0x482df362; WORD $0xc83f; BYTE $0x0 // VPCMPEQB Z0, Z10, K1                 // vpcmpeqb	k1, zmm10, zmm0
+	LONG  $0x4945f362; WORD $0xf63f; BYTE $0x0 // VPCMPEQB Z6, Z7, K1, K6              // vpcmpeqb	k6{k1}, zmm7, zmm6
+	KMOVQ K6, R14                              // <--                                  // kmovq	r14, k6
+
+LBB12_21:
+	TESTQ R14, R14     // <--                                  // test	r14, r14
+	JE    LBB12_41     // <--                                  // je	.LBB12_41
+	MOVQ  BX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rbx
+	MOVQ  DX, 0x18(SP) // <--                                  // mov	qword ptr [rsp + 24], rdx
+	MOVQ  R14, DX      // <--                                  // mov	rdx, r14
+
+LBB12_22:
+	XORL    DI, DI           // <--                                  // xor	edi, edi
+	MOVQ    R9, CX           // <--                                  // mov	rcx, r9
+	MOVQ    R11, R14         // <--                                  // mov	r14, r11
+	TZCNTQ  DX, DI           // <--                                  // tzcnt	rdi, rdx
+	MOVLQSX DI, DI           // <--                                  // movsxd	rdi, edi
+	ADDQ    SI, DI           // <--                                  // add	rdi, rsi
+	LEAQ    0(R12)(DI*1), R8 // <--                                  // lea	r8, [r12 + rdi]
+	CMPQ    R9, $0x3f        // <--                                  // cmp	r9, 63
+	JLE     LBB12_28         // <--                                  // jle	.LBB12_28
+	MOVQ    0x38(SP), BX     // <--                                  // mov	rbx, qword ptr [rsp + 56]
+	JMP     LBB12_24         // <--                                  // jmp	.LBB12_24
+
+LBB12_23:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R8  // <--                                  // add	r8, 64
+	ADDQ $0x40, R14 // <--                                  // add	r14, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB12_27   // <--                                  // jle	.LBB12_27
+
+LBB12_24:
+	VPADDB   0(R8), Z3, Z5                        // <--                                  // vpaddb	zmm5, zmm3, zmmword ptr [r8]
+	VMOVDQU8 0(R8), Z4                            // <--                                  // vmovdqu8	zmm4, zmmword ptr [r8]
+	LONG     $0x4855f362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z5, K1                 // vpcmpltub	k1, zmm5, zmm2
+	VPADDB   Z4, Z1, K1, Z4                       // <--                                  // vpaddb	zmm4{k1}, zmm1, zmm4
+	LONG     $0x485dd362; WORD $0x63f; BYTE $0x4  // VPCMPNEQB 0(R14), Z4, K0             // vpcmpneqb	k0, zmm4, zmmword ptr [r14]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JE       LBB12_23                             // <--                                  // je	.LBB12_23
+	MOVQ     BX, 0x38(SP)                         // <--                                  // mov	qword ptr [rsp + 56], rbx
+
+LBB12_25:
+	ADDQ $0x1, R10    // <--                                  // add	r10, 1
+	CMPQ R10, R15     // <--                                  // cmp	r10, r15
+	JG   LBB12_30     // <--                                  // jg	.LBB12_30
+	LEAQ -0x1(DX), CX // <--                                  // lea	rcx, [rdx - 1]
+	ANDQ CX, DX       // <--                                  // and	rdx, rcx
+	JNE  LBB12_22     // <--                                  // jne	.LBB12_22
+	MOVQ 0x18(SP), DX // <--                                  // mov	rdx, qword ptr [rsp + 24]
+	MOVQ 0x38(SP), BX // <--                                  // mov	rbx, qword ptr [rsp + 56]
+	ADDQ DX, SI       // <--                                  // add	rsi, rdx
+	LEAQ 0x3f(SI), DX // <--                                  // lea	rdx, [rsi + 63]
+	CMPQ BX, DX       // <--                                  // cmp	rbx, rdx
+	JG   LBB12_20     // <--                                  // jg	.LBB12_20
+
+LBB12_26:
+	CMPQ       BX, SI                               // <--                                  // cmp	rbx, rsi
+	JLE        LBB12_17                             // <--                                  // jle	.LBB12_17
+	MOVQ       BX, DX                               // <--                                  // mov	rdx, rbx
+	MOVQ       R13, DI                              // <--                                  // mov	rdi, r13
+	SUBQ       SI, DX                               // <--                                  // sub	rdx, rsi
+	MOVL       DX, CX                               // <--                                  // mov	ecx, edx
+	SHLQ       CX, DI                               // <--                                  // shl	rdi, cl
+	LEAQ       -0x1(DI), DI                         // <--                                  // lea	rdi, [rdi - 1]
+	KMOVQ      DI, K1                               // <--                                  // kmovq	k1, rdi
+	MOVQ       0x30(SP), DI                         // <--                                  // mov	rdi, qword ptr [rsp + 48]
+	VMOVDQU8.Z 0(DI)(SI*1), K1, Z7                  // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [rdi + rsi]
+	MOVQ       0x28(SP), DI                         // <--                                  // mov	rdi, qword ptr [rsp + 40]
+	VPORD      Z7, Z9, Z7                           // <--                                  // vpord	zmm7, zmm9, zmm7
+	LONG       $0x4945f362; WORD $0xc63f; BYTE $0x0 // VPCMPEQB Z6, Z7, K1, K0              // vpcmpeqb	k0{k1}, zmm7, zmm6
+	VMOVDQU8.Z 0(DI)(SI*1), K1, Z7                  // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [rdi + rsi]
+	VPORD      Z8, Z7, Z7                           // <--                                  // vpord	zmm7, zmm7, zmm8
+	LONG       $0x4945f362; WORD $0xc83f; BYTE $0x0 // VPCMPEQB Z0, Z7, K1, K1              // vpcmpeqb	k1{k1}, zmm7, zmm0
+	KMOVQ      K0, DI                               // <--                                  // kmovq	rdi, k0
+	KMOVQ      K1, R14                              // <--                                  // kmovq	r14, k1
+	ANDQ       DI, R14                              // <--                                  // and	r14, rdi
+	JMP        LBB12_21                             // <--                                  // jmp	.LBB12_21
+
+LBB12_27:
+	MOVQ  BX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rbx
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB12_29     // <--                                  // je	.LBB12_29
+
+LBB12_28:
+	MOVQ       R13, BX                              // <--                                  // mov	rbx, r13
+	SHLQ       CX, BX                               // <--                                  // shl	rbx, cl
+	LEAQ       -0x1(BX), BX                         // <--                                  // lea	rbx, [rbx - 1]
+	KMOVQ      BX, K1                               // <--                                  // kmovq	k1, rbx
+	VMOVDQU8.Z 0(R8), K1, Z5                        // <--                                  // vmovdqu8	zmm5{k1}{z}, zmmword ptr [r8]
+	VMOVDQU8.Z 0(R14), K1, Z4                       // <--                                  // vmovdqu8	zmm4{k1}{z}, zmmword ptr [r14]
+	VPADDB     Z3, Z5, Z7                           // <--                                  // vpaddb	zmm7, zmm5, zmm3
+	LONG       $0x4845f362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z7, K1                 // vpcmpltub	k1, zmm7, zmm2
+	LONG       $0x48fdf162; WORD $0xfd6f            // VMOVDQA64 Z5, Z7                     // vmovdqa64	zmm7, zmm5
+	VPADDB     Z1, Z5, K1, Z7                       // <--                                  // vpaddb	zmm7{k1}, zmm5, zmm1
+	LONG       $0x4845f362; WORD $0xc43f; BYTE $0x4 // VPCMPNEQB Z4, Z7, K0                 // vpcmpneqb	k0, zmm7, zmm4
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB12_25                             // <--                                  // jne	.LBB12_25
+
+LBB12_29:
+	MOVQ 0x38(SP), BX    // <--                                  // mov	rbx, qword ptr [rsp + 56]
+	ADDQ $0x1, AX        // <--                                  // add	rax, 1
+	LEAQ 0(R9)(DI*1), SI // <--                                  // lea	rsi, [r9 + rdi]
+	JMP  LBB12_19        // <--                                  // jmp	.LBB12_19
+
+LBB12_30:
+	MOVQ         0x20(SP), BX     // <--                                  // mov	rbx, qword ptr [rsp + 32]
+	ADDQ         $0x1, DI         // <--                                  // add	rdi, 1
+	LEAQ         0(R12)(DI*1), SI // <--                                  // lea	rsi, [r12 + rdi]
+	SUBQ         DI, BX           // <--                                  // sub	rbx, rdi
+	CMPQ         R9, BX           // <--                                  // cmp	r9, rbx
+	JG           LBB12_17         // <--                                  // jg	.LBB12_17
+	MOVL         $-0x41, DX       // <--                                  // mov	edx, -65
+	MOVQ         R12, R15         // <--                                  // mov	r15, r12
+	VPBROADCASTB DX, Z3           // <--                                  // vpbroadcastb	zmm3, edx
+	MOVL         $0x1a, DX        // <--                                  // mov	edx, 26
+	VPBROADCASTB DX, Z2           // <--                                  // vpbroadcastb	zmm2, edx
+	MOVL         $0x20, DX        // <--                                  // mov	edx, 32
+	VPBROADCASTB DX, Z1           // <--                                  // vpbroadcastb	zmm1, edx
+
+LBB12_31:
+	SUBQ R9, BX         // <--                                  // sub	rbx, r9
+	MOVQ R9, DX         // <--                                  // mov	rdx, r9
+	MOVL $0x1000193, CX // <--                                  // mov	ecx, 16777619
+	MOVL $0x1, R12      // <--                                  // mov	r12d, 1
+
+LBB12_32:
+	TESTB $0x1, DX // <--                                  // test	dl, 1
+	JE    LBB12_33 // <--                                  // je	.LBB12_33
+	IMULL CX, R12  // <--                                  // imul	r12d, ecx
+
+LBB12_33:
+	IMULL CX, CX   // <--                                  // imul	ecx, ecx
+	SHRQ  $0x1, DX // <--                                  // shr	rdx, 1
+	JNE   LBB12_32 // <--                                  // jne	.LBB12_32
+	XORL  DX, DX   // <--                                  // xor	edx, edx
+	XORL  R10, R10 // <--                                  // xor	r10d, r10d
+	XORL  R8, R8   // <--                                  // xor	r8d, r8d
+
+LBB12_34:
+	LONG    $0x93c06945; WORD $0x1; BYTE $0x1 // IMULL $0x1000193, R8, R8             // imul	r8d, r8d, 16777619
+	MOVBLZX 0(R11)(R10*1), CX                 // <--                                  // movzx	ecx, byte ptr [r11 + r10]
+	ADDL    CX, R8                            // <--                                  // add	r8d, ecx
+	LONG    $0x193ca69; WORD $0x100           // IMULL $0x1000193, DX, CX             // imul	ecx, edx, 16777619
+	MOVBLZX 0(SI)(R10*1), DX                  // <--                                  // movzx	edx, byte ptr [rsi + r10]
+	LEAL    -0x41(DX), R14                    // <--                                  // lea	r14d, [rdx - 65]
+	LEAL    0x20(DX), R13                     // <--                                  // lea	r13d, [rdx + 32]
+	CMPB    R14, $0x1a                        // <--                                  // cmp	r14b, 26
+	CMOVLCS R13, DX                           // <--                                  // cmovb	edx, r13d
+	ADDQ    $0x1, R10                         // <--                                  // add	r10, 1
+	MOVBLZX DX, DX                            // <--                                  // movzx	edx, dl
+	ADDL    CX, DX                            // <--                                  // add	edx, ecx
+	CMPQ    R9, R10                           // <--                                  // cmp	r9, r10
+	JG      LBB12_34                          // <--                                  // jg	.LBB12_34
+	VMOVQ   R15, X4                           // <--                                  // vmovq	xmm4, r15
+	MOVQ    DI, 0x38(SP)                      // <--                                  // mov	qword ptr [rsp + 56], rdi
+	ADDQ    $0x1, BX                          // <--                                  // add	rbx, 1
+	XORL    R10, R10                          // <--                                  // xor	r10d, r10d
+	MOVL    $0x1, R13                         // <--                                  // mov	r13d, 1
+	MOVL    R12, R15                          // <--                                  // mov	r15d, r12d
+	JMP     LBB12_36                          // <--                                  // jmp	.LBB12_36
+
+LBB12_35:
+	ADDQ    $0x1, R10               // <--                                  // add	r10, 1
+	CMPQ    R10, BX                 // <--                                  // cmp	r10, rbx
+	JE      LBB12_17                // <--                                  // je	.LBB12_17
+	LONG    $0x193ca69; WORD $0x100 // IMULL $0x1000193, DX, CX             // imul	ecx, edx, 16777619
+	MOVBLZX 0(SI), DX               // <--                                  // movzx	edx, byte ptr [rsi]
+	LEAL    -0x41(DX), R12          // <--                                  // lea	r12d, [rdx - 65]
+	LEAL    0x20(DX), R14           // <--                                  // lea	r14d, [rdx + 32]
+	CMPB    R12, $0x1a              // <--                                  // cmp	r12b, 26
+	CMOVLCS R14, DX                 // <--                                  // cmovb	edx, r14d
+	MOVBLZX DX, DX                  // <--                                  // movzx	edx, dl
+	IMULL   R15, DX                 // <--                                  // imul	edx, r15d
+	SUBL    DX, CX                  // <--                                  // sub	ecx, edx
+	MOVBLZX 0(SI)(R9*1), DX         // <--                                  // movzx	edx, byte ptr [rsi + r9]
+	LEAL    -0x41(DX), R12          // <--                                  // lea	r12d, [rdx - 65]
+	LEAL    0x20(DX), R14           // <--                                  // lea	r14d, [rdx + 32]
+	CMPB    R12, $0x1a              // <--                                  // cmp	r12b, 26
+	CMOVLCS R14, DX                 // <--                                  // cmovb	edx, r14d
+	ADDQ    $0x1, SI                // <--                                  // add	rsi, 1
+	MOVBLZX DX, DX                  // <--                                  // movzx	edx, dl
+	ADDL    CX, DX                  // <--                                  // add	edx, ecx
+
+LBB12_36:
+	CMPL R8, DX       // <--                                  // cmp	r8d, edx
+	JNE  LBB12_35     // <--                                  // jne	.LBB12_35
+	MOVQ SI, R12      // <--                                  // mov	r12, rsi
+	CMPQ R9, $0x3f    // <--                                  // cmp	r9, 63
+	JLE  LBB12_39     // <--                                  // jle	.LBB12_39
+	MOVQ 0x38(SP), DI // <--                                  // mov	rdi, qword ptr [rsp + 56]
+	MOVQ R9, CX       // <--                                  // mov	rcx, r9
+	MOVQ R11, R14     // <--                                  // mov	r14, r11
+	JMP  LBB12_38     // <--                                  // jmp	.LBB12_38
+
+LBB12_37:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R12 // <--                                  // add	r12, 64
+	ADDQ $0x40, R14 // <--                                  // add	r14, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB12_14   // <--                                  // jle	.LBB12_14
+
+LBB12_38:
+	VPADDB   0(R12), Z3, Z0                       // <--                                  // vpaddb	zmm0, zmm3, zmmword ptr [r12]
+	LONG     $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VMOVDQU8 0(R12), Z0                           // <--                                  // vmovdqu8	zmm0, zmmword ptr [r12]
+	VPADDB   Z0, Z1, K1, Z0                       // <--                                  // vpaddb	zmm0{k1}, zmm1, zmm0
+	LONG     $0x487dd362; WORD $0x63f; BYTE $0x4  // VPCMPNEQB 0(R14), Z0, K0             // vpcmpneqb	k0, zmm0, zmmword ptr [r14]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JE       LBB12_37                             // <--                                  // je	.LBB12_37
+	MOVQ     DI, 0x38(SP)                         // <--                                  // mov	qword ptr [rsp + 56], rdi
+	JMP      LBB12_35                             // <--                                  // jmp	.LBB12_35
+
+LBB12_39:
+	MOVQ R11, R14 // <--                                  // mov	r14, r11
+	MOVQ R9, CX   // <--                                  // mov	rcx, r9
+	JMP  LBB12_15 // <--                                  // jmp	.LBB12_15
+
+LBB12_40:
+	ADDQ CX, DI  // <--                                  // add	rdi, rcx
+	JMP  LBB12_0 // <--                                  // jmp	.LBB12_0
+
+LBB12_41:
+	ADDQ DX, SI   // <--                                  // add	rsi, rdx
+	JMP  LBB12_19 // <--                                  // jmp	.LBB12_19
+
+TEXT ·lastIndexExactAvx512(SB), NOSPLIT, $200-72
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	PUSHQ        BP              // <--                                  // push	rbp
+	MOVQ         SI, R10         // <--                                  // mov	r10, rsi
+	MOVQ         SP, BP          // <--                                  // mov	rbp, rsp
+	PUSHQ        R15             // <--                                  // push	r15
+	PUSHQ        R14             // <--                                  // push	r14
+	PUSHQ        R13             // <--                                  // push	r13
+	PUSHQ        R12             // <--                                  // push	r12
+	PUSHQ        BX              // <--                                  // push	rbx
+	ANDQ         $-0x40, SP      // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP       // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R11   // <--                                  // mov	r11, qword ptr [rbp + 24]
+	MOVQ         0x10(BP), R13   // <--                                  // mov	r13, qword ptr [rbp + 16]
+	CMPQ         SI, R11         // <--                                  // cmp	rsi, r11
+	JL           LBB13_24        // <--                                  // jl	.LBB13_24
+	MOVQ         SI, AX          // <--                                  // mov	rax, rsi
+	TESTQ        R11, R11        // <--                                  // test	r11, r11
+	JLE          LBB13_9         // <--                                  // jle	.LBB13_9
+	VPBROADCASTB DX, Z0          // <--                                  // vpbroadcastb	zmm0, edx
+	LEAQ         0(DI)(CX*1), DX // <--                                  // lea	rdx, [rdi + rcx]
+	SUBQ         R11, R10        // <--                                  // sub	r10, r11
+	MOVQ         DI, R12         // <--                                  // mov	r12, rdi
+	MOVQ         DX, 0x28(SP)    // <--                                  // mov	qword ptr [rsp + 40], rdx
+	ADDQ         $0x1, R10       // <--                                  // add	r10, 1
+	XORL         BX, BX          // <--                                  // xor	ebx, ebx
+	MOVL         $0x1, R14       // <--                                  // mov	r14d, 1
+	MOVQ         R10, SI         // <--                                  // mov	rsi, r10
+	KMOVD        R8, K7          // <--                                  // kmovd	k7, r8d
+
+LBB13_0:
+	CMPQ       SI, $0xff                            // <--                                  // cmp	rsi, 255
+	JG         LBB13_10                             // <--                                  // jg	.LBB13_10
+	CMPQ       SI, $0x3f                            // <--                                  // cmp	rsi, 63
+	JG         LBB13_11                             // <--                                  // jg	.LBB13_11
+	TESTQ      SI, SI                               // <--                                  // test	rsi, rsi
+	JE         LBB13_23                             // <--                                  // je	.LBB13_23
+	MOVL       SI, CX                               // <--                                  // mov	ecx, esi
+	MOVL       $0x1, AX                             // <--                                  // mov	eax, 1
+	XORL       SI, SI                               // <--                                  // xor	esi, esi
+	SHLQ       CX, AX                               // <--                                  // shl	rax, cl
+	SUBQ       $0x1, AX                             // <--                                  // sub	rax, 1
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	VMOVDQU8.Z 0(DX), K1, Z1                        // <--                                  // vmovdqu8	zmm1{k1}{z}, zmmword ptr [rdx]
+	LONG       $0x4975f362; WORD $0xc83f; BYTE $0x0 // VPCMPEQB Z0, Z1, K1, K1              // vpcmpeqb	k1{k1}, zmm1, zmm0
+	KORTESTQ   K1, K1                               // <--                                  // kortestq	k1, k1
+	JE         LBB13_23                             // <--                                  // je	.LBB13_23
+
+LBB13_1:
+	MOVQ  R9, 0x30(SP) // <--                                  // mov	qword ptr [rsp + 48], r9
+	LEAQ  0x3f(SI), R8 // <--                                  // lea	r8, [rsi + 63]
+	KMOVD K7, R15      // <--                                  // kmovd	r15d, k7
+	MOVQ  DX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdx
+	MOVQ  SI, DX       // <--                                  // mov	rdx, rsi
+	MOVQ  R8, SI       // <--                                  // mov	rsi, r8
+
+LBB13_2:
+	KMOVQ K1, AX           // <--                                  // kmovq	rax, k1
+	BSRQ  AX, AX           // <--                                  // bsr	rax, rax
+	MOVQ  SI, R8           // <--                                  // mov	r8, rsi
+	XORL  $0x3f, AX        // <--                                  // xor	eax, 63
+	SUBQ  AX, R8           // <--                                  // sub	r8, rax
+	LEAQ  0(R12)(R8*1), DI // <--                                  // lea	rdi, [r12 + r8]
+	CMPQ  R11, $0x3f       // <--                                  // cmp	r11, 63
+	JLE   LBB13_13         // <--                                  // jle	.LBB13_13
+	MOVQ  0x38(SP), R9     // <--                                  // mov	r9, qword ptr [rsp + 56]
+	MOVQ  R11, CX          // <--                                  // mov	rcx, r11
+	MOVQ  R13, AX          // <--                                  // mov	rax, r13
+	JMP   LBB13_4          // <--                                  // jmp	.LBB13_4
+
+LBB13_3:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, DI // <--                                  // add	rdi, 64
+	ADDQ $0x40, AX // <--                                  // add	rax, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB13_6   // <--                                  // jle	.LBB13_6
+
+LBB13_4:
+	VMOVDQU8 0(DI), Z5                          // <--                                  // vmovdqu8	zmm5, zmmword ptr [rdi]
+	LONG     $0x4855f362; WORD $0x3f; BYTE $0x4 // VPCMPNEQB 0(AX), Z5, K0              // vpcmpneqb	k0, zmm5, zmmword ptr [rax]
+	KORTESTQ K0, K0                             // <--                                  // kortestq	k0, k0
+	JE       LBB13_3                            // <--                                  // je	.LBB13_3
+	MOVQ     R9, 0x38(SP)                       // <--                                  // mov	qword ptr [rsp + 56], r9
+
+LBB13_5:
+	MOVQ     R10, AX      // <--                                  // mov	rax, r10
+	ADDQ     $0x1, BX     // <--                                  // add	rbx, 1
+	SUBQ     R8, AX       // <--                                  // sub	rax, r8
+	SARQ     $0x8, AX     // <--                                  // sar	rax, 8
+	ADDQ     $0x4, AX     // <--                                  // add	rax, 4
+	CMPQ     BX, AX       // <--                                  // cmp	rbx, rax
+	JG       LBB13_14     // <--                                  // jg	.LBB13_14
+	MOVL     R8, CX       // <--                                  // mov	ecx, r8d
+	MOVQ     R14, AX      // <--                                  // mov	rax, r14
+	SUBL     DX, CX       // <--                                  // sub	ecx, edx
+	SHLQ     CX, AX       // <--                                  // shl	rax, cl
+	KMOVQ    AX, K3       // <--                                  // kmovq	k3, rax
+	KANDNQ   K1, K3, K1   // <--                                  // kandnq	k1, k3, k1
+	KORTESTQ K1, K1       // <--                                  // kortestq	k1, k1
+	JNE      LBB13_2      // <--                                  // jne	.LBB13_2
+	MOVQ     DX, SI       // <--                                  // mov	rsi, rdx
+	MOVQ     0x30(SP), R9 // <--                                  // mov	r9, qword ptr [rsp + 48]
+	MOVQ     0x38(SP), DX // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	JMP      LBB13_0      // <--                                  // jmp	.LBB13_0
+
+LBB13_6:
+	MOVQ  R9, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], r9
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB13_8      // <--                                  // je	.LBB13_8
+
+LBB13_7:
+	MOVQ       R14, R9                              // <--                                  // mov	r9, r14
+	SHLQ       CX, R9                               // <--                                  // shl	r9, cl
+	MOVQ       R9, CX                               // <--                                  // mov	rcx, r9
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K2                               // <--                                  // kmovq	k2, rcx
+	VMOVDQU8.Z 0(DI), K2, Z1                        // <--                                  // vmovdqu8	zmm1{k2}{z}, zmmword ptr [rdi]
+	VMOVDQU8.Z 0(AX), K2, Z2                        // <--                                  // vmovdqu8	zmm2{k2}{z}, zmmword ptr [rax]
+	LONG       $0x4875f362; WORD $0xc23f; BYTE $0x4 // VPCMPNEQB Z2, Z1, K0                 // vpcmpneqb	k0, zmm1, zmm2
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB13_5                              // <--                                  // jne	.LBB13_5
+
+LBB13_8:
+	MOVQ       R8, AX // <--                                  // mov	rax, r8
+	VZEROUPPER        // <--                                  // vzeroupper
+
+LBB13_9:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB13_10:
+	LEAQ     -0x100(SI), CX   // <--                                  // lea	rcx, [rsi - 256]
+	LEAQ     0(DX)(CX*1), DI  // <--                                  // lea	rdi, [rdx + rcx]
+	VPCMPEQB 0(DI), Z0, K0    // <--                                  // vpcmpeqb	k0, zmm0, zmmword ptr [rdi]
+	VPCMPEQB 0x40(DI), Z0, K1 // <--                                  // vpcmpeqb	k1, zmm0, zmmword ptr [rdi + 64]
+	VPCMPEQB 0x80(DI), Z0, K4 // <--                                  // vpcmpeqb	k4, zmm0, zmmword ptr [rdi + 128]
+	VPCMPEQB 0xc0(DI), Z0, K5 // <--                                  // vpcmpeqb	k5, zmm0, zmmword ptr [rdi + 192]
+	KMOVQ    K1, AX           // <--                                  // kmovq	rax, k1
+	KMOVQ    K0, R15          // <--                                  // kmovq	r15, k0
+	ORQ      R15, AX          // <--                                  // or	rax, r15
+	KMOVQ    K4, R8           // <--                                  // kmovq	r8, k4
+	ORQ      R8, AX           // <--                                  // or	rax, r8
+	KMOVQ    K5, DI           // <--                                  // kmovq	rdi, k5
+	ORQ      DI, AX           // <--                                  // or	rax, rdi
+	JE       LBB13_12         // <--                                  // je	.LBB13_12
+
+LBB13_11:
+	SUBQ     $0x40, SI           // <--                                  // sub	rsi, 64
+	VPCMPEQB 0(DX)(SI*1), Z0, K1 // <--                                  // vpcmpeqb	k1, zmm0, zmmword ptr [rdx + rsi]
+	KORTESTQ K1, K1              // <--                                  // kortestq	k1, k1
+	JNE      LBB13_1             // <--                                  // jne	.LBB13_1
+	JMP      LBB13_0             // <--                                  // jmp	.LBB13_0
+
+LBB13_12:
+	MOVQ CX, SI  // <--                                  // mov	rsi, rcx
+	JMP  LBB13_0 // <--                                  // jmp	.LBB13_0
+
+LBB13_13:
+	MOVQ R13, AX // <--                                  // mov	rax, r13
+	MOVQ R11, CX // <--                                  // mov	rcx, r11
+	JMP  LBB13_7 // <--                                  // jmp	.LBB13_7
+
+LBB13_14:
+	MOVQ         0x30(SP), R9     // <--                                  // mov	r9, qword ptr [rsp + 48]
+	MOVQ         R8, AX           // <--                                  // mov	rax, r8
+	VPBROADCASTB R15, Z1          // <--                                  // vpbroadcastb	zmm1, r15d
+	MOVL         $0x1, BX         // <--                                  // mov	ebx, 1
+	LEAQ         0(R12)(R9*1), DX // <--                                  // lea	rdx, [r12 + r9]
+	XORL         R9, R9           // <--                                  // xor	r9d, r9d
+	CMPQ         R11, $0x3f       // <--                                  // cmp	r11, 63
+	SETLE        R9               // <--                                  // setle	r9b
+	XORL         R10, R10         // <--                                  // xor	r10d, r10d
+	LEAQ         0x4(R9*4), R9    // <--                                  // lea	r9, [r9*4 + 4]
+
+LBB13_15:
+	CMPQ     AX, $0x3f               // <--                                  // cmp	rax, 63
+	JLE      LBB13_25                // <--                                  // jle	.LBB13_25
+	SUBQ     $0x40, AX               // <--                                  // sub	rax, 64
+	MOVQ     0x28(SP), SI            // <--                                  // mov	rsi, qword ptr [rsp + 40]
+	VPCMPEQB 0(DX)(AX*1), Z1, K1     // <--                                  // vpcmpeqb	k1, zmm1, zmmword ptr [rdx + rax]
+	VPCMPEQB 0(SI)(AX*1), Z0, K1, K1 // <--                                  // vpcmpeqb	k1{k1}, zmm0, zmmword ptr [rsi + rax]
+	KORTESTQ K1, K1                  // <--                                  // kortestq	k1, k1
+	JE       LBB13_15                // <--                                  // je	.LBB13_15
+
+LBB13_16:
+	MOVQ DX, 0x38(SP)  // <--                                  // mov	qword ptr [rsp + 56], rdx
+	LEAQ 0x3f(AX), R14 // <--                                  // lea	r14, [rax + 63]
+
+LBB13_17:
+	KMOVQ K1, SI            // <--                                  // kmovq	rsi, k1
+	BSRQ  SI, CX            // <--                                  // bsr	rcx, rsi
+	MOVQ  R14, R8           // <--                                  // mov	r8, r14
+	XORL  $0x3f, CX         // <--                                  // xor	ecx, 63
+	SUBQ  CX, R8            // <--                                  // sub	r8, rcx
+	LEAQ  0(R12)(R8*1), R15 // <--                                  // lea	r15, [r12 + r8]
+	CMPQ  R11, $0x3f        // <--                                  // cmp	r11, 63
+	JLE   LBB13_26          // <--                                  // jle	.LBB13_26
+	MOVQ  0x38(SP), DX      // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVQ  R11, CX           // <--                                  // mov	rcx, r11
+	MOVQ  R13, SI           // <--                                  // mov	rsi, r13
+	MOVQ  R15, DI           // <--                                  // mov	rdi, r15
+	JMP   LBB13_19          // <--                                  // jmp	.LBB13_19
+
+LBB13_18:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, DI // <--                                  // add	rdi, 64
+	ADDQ $0x40, SI // <--                                  // add	rsi, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB13_21  // <--                                  // jle	.LBB13_21
+
+LBB13_19:
+	VMOVDQU8 0(DI), Z6                           // <--                                  // vmovdqu8	zmm6, zmmword ptr [rdi]
+	LONG     $0x484df362; WORD $0x63f; BYTE $0x4 // VPCMPNEQB 0(SI), Z6, K0              // vpcmpneqb	k0, zmm6, zmmword ptr [rsi]
+	KORTESTQ K0, K0                              // <--                                  // kortestq	k0, k0
+	JE       LBB13_18                            // <--                                  // je	.LBB13_18
+	MOVQ     DX, 0x38(SP)                        // <--                                  // mov	qword ptr [rsp + 56], rdx
+
+LBB13_20:
+	ADDQ     $0x1, R10    // <--                                  // add	r10, 1
+	CMPQ     R10, R9      // <--                                  // cmp	r10, r9
+	JG       LBB13_27     // <--                                  // jg	.LBB13_27
+	MOVL     R8, CX       // <--                                  // mov	ecx, r8d
+	MOVQ     BX, SI       // <--                                  // mov	rsi, rbx
+	SUBL     AX, CX       // <--                                  // sub	ecx, eax
+	SHLQ     CX, SI       // <--                                  // shl	rsi, cl
+	KMOVQ    SI, K6       // <--                                  // kmovq	k6, rsi
+	KANDNQ   K1, K6, K1   // <--                                  // kandnq	k1, k6, k1
+	KORTESTQ K1, K1       // <--                                  // kortestq	k1, k1
+	JNE      LBB13_17     // <--                                  // jne	.LBB13_17
+	MOVQ     0x38(SP), DX // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	JMP      LBB13_15     // <--                                  // jmp	.LBB13_15
+
+LBB13_21:
+	MOVQ  DX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdx
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB13_8      // <--                                  // je	.LBB13_8
+
+LBB13_22:
+	MOVQ       BX, DX                               // <--                                  // mov	rdx, rbx
+	SHLQ       CX, DX                               // <--                                  // shl	rdx, cl
+	LEAQ       -0x1(DX), DX                         // <--                                  // lea	rdx, [rdx - 1]
+	KMOVQ      DX, K2                               // <--                                  // kmovq	k2, rdx
+	VMOVDQU8.Z 0(DI), K2, Z3                        // <--                                  // vmovdqu8	zmm3{k2}{z}, zmmword ptr [rdi]
+	VMOVDQU8.Z 0(SI), K2, Z4                        // <--                                  // vmovdqu8	zmm4{k2}{z}, zmmword ptr [rsi]
+	LONG       $0x4865f362; WORD $0xc43f; BYTE $0x4 // VPCMPNEQB Z4, Z3, K0                 // vpcmpneqb	k0, zmm3, zmm4
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB13_20                             // <--                                  // jne	.LBB13_20
+	JMP        LBB13_8                              // <--                                  // jmp	.LBB13_8
+
+LBB13_23:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB13_24:
+	MOVQ $-0x1, AX // <--                                  // mov	rax, -1
+	JMP  LBB13_9   // <--                                  // jmp	.LBB13_9
+
+LBB13_25:
+	TESTQ      AX, AX                               // <--                                  // test	rax, rax
+	JE         LBB13_23                             // <--                                  // je	.LBB13_23
+	MOVL       AX, CX                               // <--                                  // mov	ecx, eax
+	MOVL       $0x1, SI                             // <--                                  // mov	esi, 1
+	SHLQ       CX, SI                               // <--                                  // shl	rsi, cl
+	LEAQ       -0x1(SI), AX                         // <--                                  // lea	rax, [rsi - 1]
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	MOVQ       0x28(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 40]
+	VMOVDQU8.Z 0(AX), K1, Z3                        // <--                                  // vmovdqu8	zmm3{k1}{z}, zmmword ptr [rax]
+	LONG       $0x4965f362; WORD $0xf83f; BYTE $0x0 // VPCMPEQB Z0, Z3, K1, K7              // vpcmpeqb	k7{k1}, zmm3, zmm0
+	VMOVDQU8.Z 0(DX), K1, Z3                        // <--                                  // vmovdqu8	zmm3{k1}{z}, zmmword ptr [rdx]
+	LONG       $0x4965f362; WORD $0xc93f; BYTE $0x0 // VPCMPEQB Z1, Z3, K1, K1              // vpcmpeqb	k1{k1}, zmm3, zmm1
+	KMOVQ      K7, AX                               // <--                                  // kmovq	rax, k7
+	KMOVQ      K1, SI                               // <--                                  // kmovq	rsi, k1
+	ANDQ       AX, SI                               // <--                                  // and	rsi, rax
+	KMOVQ      SI, K1                               // <--                                  // kmovq	k1, rsi
+	JE         LBB13_23                             // <--                                  // je	.LBB13_23
+	XORL       AX, AX                               // <--                                  // xor	eax, eax
+	JMP        LBB13_16                             // <--                                  // jmp	.LBB13_16
+
+LBB13_26:
+	MOVQ R15, DI  // <--                                  // mov	rdi, r15
+	MOVQ R11, CX  // <--                                  // mov	rcx, r11
+	MOVQ R13, SI  // <--                                  // mov	rsi, r13
+	JMP  LBB13_22 // <--                                  // jmp	.LBB13_22
+
+LBB13_27:
+	LEAQ  -0x1(R8), AX   // <--                                  // lea	rax, [r8 - 1]
+	TESTQ R8, R8         // <--                                  // test	r8, r8
+	JE    LBB13_23       // <--                                  // je	.LBB13_23
+	MOVQ  R11, DX        // <--                                  // mov	rdx, r11
+	MOVL  $0x1000193, CX // <--                                  // mov	ecx, 16777619
+	MOVL  $0x1, R10      // <--                                  // mov	r10d, 1
+
+LBB13_28:
+	TESTB $0x1, DX // <--                                  // test	dl, 1
+	JE    LBB13_29 // <--                                  // je	.LBB13_29
+	IMULL CX, R10  // <--                                  // imul	r10d, ecx
+
+LBB13_29:
+	IMULL CX, CX        // <--                                  // imul	ecx, ecx
+	SHRQ  $0x1, DX      // <--                                  // shr	rdx, 1
+	JNE   LBB13_28      // <--                                  // jne	.LBB13_28
+	LEAQ  -0x1(R11), CX // <--                                  // lea	rcx, [r11 - 1]
+	XORL  DX, DX        // <--                                  // xor	edx, edx
+	XORL  R8, R8        // <--                                  // xor	r8d, r8d
+
+LBB13_30:
+	LONG    $0x93c06945; WORD $0x1; BYTE $0x1 // IMULL $0x1000193, R8, R8             // imul	r8d, r8d, 16777619
+	MOVBLZX 0(R13)(CX*1), SI                  // <--                                  // movzx	esi, byte ptr [r13 + rcx + 0]
+	LONG    $0x193d269; WORD $0x100           // IMULL $0x1000193, DX, DX             // imul	edx, edx, 16777619
+	ADDL    SI, R8                            // <--                                  // add	r8d, esi
+	MOVBLZX -0x1(R15)(CX*1), SI               // <--                                  // movzx	esi, byte ptr [r15 + rcx - 1]
+	ADDL    SI, DX                            // <--                                  // add	edx, esi
+	SUBQ    $0x1, CX                          // <--                                  // sub	rcx, 1
+	JAE     LBB13_30                          // <--                                  // jae	.LBB13_30
+	ADDQ    AX, R12                           // <--                                  // add	r12, rax
+	JMP     LBB13_32                          // <--                                  // jmp	.LBB13_32
+
+LBB13_31:
+	SUBQ    $0x1, R12               // <--                                  // sub	r12, 1
+	TESTQ   AX, AX                  // <--                                  // test	rax, rax
+	JE      LBB13_23                // <--                                  // je	.LBB13_23
+	LONG    $0x193d269; WORD $0x100 // IMULL $0x1000193, DX, DX             // imul	edx, edx, 16777619
+	MOVBLZX 0(R12), CX              // <--                                  // movzx	ecx, byte ptr [r12]
+	SUBQ    $0x1, AX                // <--                                  // sub	rax, 1
+	ADDL    CX, DX                  // <--                                  // add	edx, ecx
+	MOVBLZX 0(R12)(R11*1), CX       // <--                                  // movzx	ecx, byte ptr [r12 + r11]
+	IMULL   R10, CX                 // <--                                  // imul	ecx, r10d
+	SUBL    CX, DX                  // <--                                  // sub	edx, ecx
+
+LBB13_32:
+	CMPL R8, DX     // <--                                  // cmp	r8d, edx
+	JNE  LBB13_31   // <--                                  // jne	.LBB13_31
+	MOVQ R12, DI    // <--                                  // mov	rdi, r12
+	CMPQ R11, $0x3f // <--                                  // cmp	r11, 63
+	JLE  LBB13_36   // <--                                  // jle	.LBB13_36
+	MOVQ R11, CX    // <--                                  // mov	rcx, r11
+	MOVQ R13, SI    // <--                                  // mov	rsi, r13
+
+LBB13_33:
+	VMOVDQU8 0(DI), Z7                           // <--                                  // vmovdqu8	zmm7, zmmword ptr [rdi]
+	LONG     $0x4845f362; WORD $0x63f; BYTE $0x4 // VPCMPNEQB 0(SI), Z7, K0              // vpcmpneqb	k0, zmm7, zmmword ptr [rsi]
+	KORTESTQ K0, K0                              // <--                                  // kortestq	k0, k0
+	JNE      LBB13_31                            // <--                                  // jne	.LBB13_31
+	SUBQ     $0x40, CX                           // <--                                  // sub	rcx, 64
+	ADDQ     $0x40, DI                           // <--                                  // add	rdi, 64
+	ADDQ     $0x40, SI                           // <--                                  // add	rsi, 64
+	CMPQ     CX, $0x3f                           // <--                                  // cmp	rcx, 63
+	JG       LBB13_33                            // <--                                  // jg	.LBB13_33
+	TESTQ    CX, CX                              // <--                                  // test	rcx, rcx
+	JE       LBB13_35                            // <--                                  // je	.LBB13_35
+
+LBB13_34:
+	MOVL       $0x1, R9                             // <--                                  // mov	r9d, 1
+	SHLQ       CX, R9                               // <--                                  // shl	r9, cl
+	LEAQ       -0x1(R9), BX                         // <--                                  // lea	rbx, [r9 - 1]
+	KMOVQ      BX, K1                               // <--                                  // kmovq	k1, rbx
+	VMOVDQU8.Z 0(DI), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rdi]
+	VMOVDQU8.Z 0(SI), K1, Z1                        // <--                                  // vmovdqu8	zmm1{k1}{z}, zmmword ptr [rsi]
+	LONG       $0x487df362; WORD $0xc13f; BYTE $0x4 // VPCMPNEQB Z1, Z0, K0                 // vpcmpneqb	k0, zmm0, zmm1
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB13_31                             // <--                                  // jne	.LBB13_31
+
+LBB13_35:
+	VZEROUPPER         // <--                                  // vzeroupper
+	JMP        LBB13_9 // <--                                  // jmp	.LBB13_9
+
+LBB13_36:
+	MOVQ R13, SI  // <--                                  // mov	rsi, r13
+	MOVQ R11, CX  // <--                                  // mov	rcx, r11
+	JMP  LBB13_34 // <--                                  // jmp	.LBB13_34
+
+TEXT ·lastIndexFoldAvx512(SB), NOSPLIT, $200-72
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	PUSHQ        BP              // <--                                  // push	rbp
+	MOVQ         SI, R11         // <--                                  // mov	r11, rsi
+	MOVQ         R9, SI          // <--                                  // mov	rsi, r9
+	MOVQ         SP, BP          // <--                                  // mov	rbp, rsp
+	PUSHQ        R15             // <--                                  // push	r15
+	PUSHQ        R14             // <--                                  // push	r14
+	PUSHQ        R13             // <--                                  // push	r13
+	PUSHQ        R12             // <--                                  // push	r12
+	PUSHQ        BX              // <--                                  // push	rbx
+	ANDQ         $-0x40, SP      // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP       // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R10   // <--                                  // mov	r10, qword ptr [rbp + 24]
+	MOVQ         0x10(BP), R9    // <--                                  // mov	r9, qword ptr [rbp + 16]
+	CMPQ         R11, R10        // <--                                  // cmp	r11, r10
+	JL           LBB14_28        // <--                                  // jl	.LBB14_28
+	MOVQ         R11, AX         // <--                                  // mov	rax, r11
+	TESTQ        R10, R10        // <--                                  // test	r10, r10
+	JLE          LBB14_12        // <--                                  // jle	.LBB14_12
+	LEAL         -0x61(DX), AX   // <--                                  // lea	eax, [rdx - 97]
+	SUBQ         R10, R11        // <--                                  // sub	r11, r10
+	MOVQ         DI, BX          // <--                                  // mov	rbx, rdi
+	MOVL         R8, DI          // <--                                  // mov	edi, r8d
+	WORD         $0x193c         // CMPB AX, $0x19                       // cmp	al, 25
+	VPBROADCASTB DX, Z5          // <--                                  // vpbroadcastb	zmm5, edx
+	LEAQ         0(BX)(CX*1), DX // <--                                  // lea	rdx, [rbx + rcx]
+	MOVL         $0x1, R12       // <--                                  // mov	r12d, 1
+	SETLS        AX              // <--                                  // setbe	al
+	MOVQ         DX, 0x28(SP)    // <--                                  // mov	qword ptr [rsp + 40], rdx
+	LEAQ         0x1(R11), R8    // <--                                  // lea	r8, [r11 + 1]
+	XORL         R11, R11        // <--                                  // xor	r11d, r11d
+	SHLL         $0x5, AX        // <--                                  // shl	eax, 5
+	MOVQ         R8, R14         // <--                                  // mov	r14, r8
+	VPBROADCASTB AX, Z6          // <--                                  // vpbroadcastb	zmm6, eax
+	MOVL         $0x20202020, AX // <--                                  // mov	eax, 538976288
+	VPBROADCASTD AX, Z4          // <--                                  // vpbroadcastd	zmm4, eax
+	MOVL         $-0x61, AX      // <--                                  // mov	eax, -97
+	VPBROADCASTB AX, Z3          // <--                                  // vpbroadcastb	zmm3, eax
+	MOVL         $0x1a, AX       // <--                                  // mov	eax, 26
+	VPBROADCASTB AX, Z2          // <--                                  // vpbroadcastb	zmm2, eax
+
+LBB14_0:
+	CMPQ R14, $0xff // <--                                  // cmp	r14, 255
+	JG   LBB14_7    // <--                                  // jg	.LBB14_7
+
+LBB14_1:
+	CMPQ       R14, $0x3f                           // <--                                  // cmp	r14, 63
+	JG         LBB14_37                             // <--                                  // jg	.LBB14_37
+	TESTQ      R14, R14                             // <--                                  // test	r14, r14
+	JE         LBB14_27                             // <--                                  // je	.LBB14_27
+	MOVL       R14, CX                              // <--                                  // mov	ecx, r14d
+	MOVL       $0x1, AX                             // <--                                  // mov	eax, 1
+	XORL       R14, R14                             // <--                                  // xor	r14d, r14d
+	SHLQ       CX, AX                               // <--                                  // shl	rax, cl
+	SUBQ       $0x1, AX                             // <--                                  // sub	rax, 1
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	VMOVDQU8.Z 0(DX), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rdx]
+	VPORD      Z6, Z0, Z0                           // <--                                  // vpord	zmm0, zmm0, zmm6
+	LONG       $0x497df362; WORD $0xcd3f; BYTE $0x0 // VPCMPEQB Z5, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm5
+	KORTESTQ   K1, K1                               // <--                                  // kortestq	k1, k1
+	JE         LBB14_27                             // <--                                  // je	.LBB14_27
+
+LBB14_2:
+	MOVQ         SI, 0x30(SP)   // <--                                  // mov	qword ptr [rsp + 48], rsi
+	LEAQ         0x3f(R14), R15 // <--                                  // lea	r15, [r14 + 63]
+	MOVL         $0x20, AX      // <--                                  // mov	eax, 32
+	MOVQ         DX, 0x38(SP)   // <--                                  // mov	qword ptr [rsp + 56], rdx
+	VPBROADCASTB AX, Z1         // <--                                  // vpbroadcastb	zmm1, eax
+	MOVQ         R14, DX        // <--                                  // mov	rdx, r14
+	MOVQ         R8, R14        // <--                                  // mov	r14, r8
+	MOVQ         R15, R8        // <--                                  // mov	r8, r15
+
+LBB14_3:
+	KMOVQ K1, AX           // <--                                  // kmovq	rax, k1
+	BSRQ  AX, CX           // <--                                  // bsr	rcx, rax
+	MOVQ  R8, AX           // <--                                  // mov	rax, r8
+	MOVQ  R9, R15          // <--                                  // mov	r15, r9
+	XORL  $0x3f, CX        // <--                                  // xor	ecx, 63
+	SUBQ  CX, AX           // <--                                  // sub	rax, rcx
+	MOVQ  R10, CX          // <--                                  // mov	rcx, r10
+	LEAQ  0(BX)(AX*1), R13 // <--                                  // lea	r13, [rbx + rax]
+	CMPQ  R10, $0x3f       // <--                                  // cmp	r10, 63
+	JLE   LBB14_10         // <--                                  // jle	.LBB14_10
+	MOVQ  0x38(SP), SI     // <--                                  // mov	rsi, qword ptr [rsp + 56]
+	JMP   LBB14_5          // <--                                  // jmp	.LBB14_5
+
+LBB14_4:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R13 // <--                                  // add	r13, 64
+	ADDQ $0x40, R15 // <--                                  // add	r15, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB14_9    // <--                                  // jle	.LBB14_9
+
+LBB14_5:
+	VPORD     0(R13), Z4, Z0                       // <--                                  // vpord	zmm0, zmm4, zmmword ptr [r13 + 0]
+	VMOVDQU32 0(R15), Z7                           // <--                                  // vmovdqu32	zmm7, zmmword ptr [r15]
+	VPADDB    Z3, Z0, Z0                           // <--                                  // vpaddb	zmm0, zmm0, zmm3
+	LONG      $0x487df362; WORD $0xd23e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K2                 // vpcmpltub	k2, zmm0, zmm2
+	VPXORD    0(R13), Z7, Z0                       // <--                                  // vpxord	zmm0, zmm7, zmmword ptr [r13 + 0]
+	LONG      $0x4a7df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K2, K0              // vpcmpeqb	k0{k2}, zmm0, zmm1
+	KNOTQ     K0, K0                               // <--                                  // knotq	k0, k0
+	KMOVQ     K0, K3                               // <--                                  // kmovq	k3, k0
+	VPTESTMB  Z0, Z0, K3, K0                       // <--                                  // vptestmb	k0{k3}, zmm0, zmm0
+	KORTESTQ  K0, K0                               // <--                                  // kortestq	k0, k0
+	JE        LBB14_4                              // <--                                  // je	.LBB14_4
+	MOVQ      SI, 0x38(SP)                         // <--                                  // mov	qword ptr [rsp + 56], rsi
+
+LBB14_6:
+	MOVQ     R14, CX      // <--                                  // mov	rcx, r14
+	ADDQ     $0x1, R11    // <--                                  // add	r11, 1
+	SUBQ     AX, CX       // <--                                  // sub	rcx, rax
+	SARQ     $0x8, CX     // <--                                  // sar	rcx, 8
+	ADDQ     $0x4, CX     // <--                                  // add	rcx, 4
+	CMPQ     R11, CX      // <--                                  // cmp	r11, rcx
+	JG       LBB14_14     // <--                                  // jg	.LBB14_14
+	SUBL     DX, AX       // <--                                  // sub	eax, edx
+	MOVQ     R12, R15     // <--                                  // mov	r15, r12
+	MOVL     AX, CX       // <--                                  // mov	ecx, eax
+	SHLQ     CX, R15      // <--                                  // shl	r15, cl
+	KMOVQ    R15, K6      // <--                                  // kmovq	k6, r15
+	KANDNQ   K1, K6, K1   // <--                                  // kandnq	k1, k6, k1
+	KORTESTQ K1, K1       // <--                                  // kortestq	k1, k1
+	JNE      LBB14_3      // <--                                  // jne	.LBB14_3
+	MOVQ     R14, R8      // <--                                  // mov	r8, r14
+	MOVQ     DX, R14      // <--                                  // mov	r14, rdx
+	MOVQ     0x30(SP), SI // <--                                  // mov	rsi, qword ptr [rsp + 48]
+	MOVQ     0x38(SP), DX // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	CMPQ     R14, $0xff   // <--                                  // cmp	r14, 255
+	JLE      LBB14_1      // <--                                  // jle	.LBB14_1
+
+LBB14_7:
+	LEAQ  -0x100(R14), CX                      // <--                                  // lea	rcx, [r14 - 256]
+	LONG  $0x487df162; WORD $0xc66f            // VMOVDQA32 Z6, Z0                     // vmovdqa32	zmm0, zmm6
+	LEAQ  0(DX)(CX*1), R13                     // <--                                  // lea	r13, [rdx + rcx]
+	VPORD 0(R13), Z6, Z1                       // <--                                  // vpord	zmm1, zmm6, zmmword ptr [r13 + 0]
+	LONG  $0x4875f362; WORD $0xc53f; BYTE $0x0 // VPCMPEQB Z5, Z1, K0                  // vpcmpeqb	k0, zmm1, zmm5
+	VPORD 0x40(R13), Z6, Z1                    // <--                                  // vpord	zmm1, zmm6, zmmword ptr [r13 + 64]
+	LONG  $0x4875f362; WORD $0xcd3f; BYTE $0x0 // VPCMPEQB Z5, Z1, K1                  // vpcmpeqb	k1, zmm1, zmm5
+	VPORD 0x80(R13), Z6, Z1                    // <--                                  // vpord	zmm1, zmm6, zmmword ptr [r13 + 128]
+	LONG  $0x4875f362; WORD $0xed3f; BYTE $0x0 // VPCMPEQB Z5, Z1, K5                  // vpcmpeqb	k5, zmm1, zmm5
+	VPORD 0xc0(R13), Z6, Z1                    // <--                                  // vpord	zmm1, zmm6, zmmword ptr [r13 + 192]
+	KMOVQ K0, R13                              // <--                                  // kmovq	r13, k0
+	KMOVQ K1, AX                               // <--                                  // kmovq	rax, k1
+	ORQ   R13, AX                              // <--                                  // or	rax, r13
+	LONG  $0x4875f362; WORD $0xfd3f; BYTE $0x0 // VPCMPEQB Z5, Z1, K7                  // vpcmpeqb	k7, zmm1, zmm5
+	KMOVQ K5, R15                              // <--                                  // kmovq	r15, k5
+	ORQ   R15, AX                              // <--                                  // or	rax, r15
+	KMOVQ K7, R15                              // <--                                  // kmovq	r15, k7
+	ORQ   R15, AX                              // <--                                  // or	rax, r15
+	JE    LBB14_13                             // <--                                  // je	.LBB14_13
+
+LBB14_8:
+	SUBQ     $0x40, R14                           // <--                                  // sub	r14, 64
+	VPORD    0(DX)(R14*1), Z0, Z0                 // <--                                  // vpord	zmm0, zmm0, zmmword ptr [rdx + r14]
+	LONG     $0x487df362; WORD $0xcd3f; BYTE $0x0 // VPCMPEQB Z5, Z0, K1                  // vpcmpeqb	k1, zmm0, zmm5
+	KORTESTQ K1, K1                               // <--                                  // kortestq	k1, k1
+	JNE      LBB14_2                              // <--                                  // jne	.LBB14_2
+	JMP      LBB14_0                              // <--                                  // jmp	.LBB14_0
+
+LBB14_9:
+	MOVQ  SI, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rsi
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB14_11     // <--                                  // je	.LBB14_11
+
+LBB14_10:
+	MOVQ       R12, SI                              // <--                                  // mov	rsi, r12
+	SHLQ       CX, SI                               // <--                                  // shl	rsi, cl
+	LEAQ       -0x1(SI), SI                         // <--                                  // lea	rsi, [rsi - 1]
+	KMOVQ      SI, K2                               // <--                                  // kmovq	k2, rsi
+	VMOVDQU8.Z 0(R13), K2, Z0                       // <--                                  // vmovdqu8	zmm0{k2}{z}, zmmword ptr [r13 + 0]
+	VMOVDQU8.Z 0(R15), K2, Z7                       // <--                                  // vmovdqu8	zmm7{k2}{z}, zmmword ptr [r15]
+	VPORD      Z0, Z4, Z8                           // <--                                  // vpord	zmm8, zmm4, zmm0
+	VPXORD     Z7, Z0, Z0                           // <--                                  // vpxord	zmm0, zmm0, zmm7
+	VPADDB     Z3, Z8, Z10                          // <--                                  // vpaddb	zmm10, zmm8, zmm3
+	LONG       $0x482df362; WORD $0xd23e; BYTE $0x1 // VPCMPLTUB Z2, Z10, K2                // vpcmpltub	k2, zmm10, zmm2
+	LONG       $0x4a7df362; WORD $0xd13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K2, K2              // vpcmpeqb	k2{k2}, zmm0, zmm1
+	KNOTQ      K2, K2                               // <--                                  // knotq	k2, k2
+	VPTESTMB   Z0, Z0, K2, K2                       // <--                                  // vptestmb	k2{k2}, zmm0, zmm0
+	KORTESTQ   K2, K2                               // <--                                  // kortestq	k2, k2
+	JNE        LBB14_6                              // <--                                  // jne	.LBB14_6
+
+LBB14_11:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB14_12:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB14_13:
+	MOVQ CX, R14 // <--                                  // mov	r14, rcx
+	JMP  LBB14_0 // <--                                  // jmp	.LBB14_0
+
+LBB14_14:
+	LEAL         -0x61(DI), CX   // <--                                  // lea	ecx, [rdi - 97]
+	MOVQ         0x30(SP), SI    // <--                                  // mov	rsi, qword ptr [rsp + 48]
+	VPBROADCASTB DI, Z7          // <--                                  // vpbroadcastb	zmm7, edi
+	MOVL         $0x1, R13       // <--                                  // mov	r13d, 1
+	CMPB         CX, $0x19       // <--                                  // cmp	cl, 25
+	SETLS        CX              // <--                                  // setbe	cl
+	LEAQ         0(BX)(SI*1), DX // <--                                  // lea	rdx, [rbx + rsi]
+	XORL         SI, SI          // <--                                  // xor	esi, esi
+	SHLL         $0x5, CX        // <--                                  // shl	ecx, 5
+	CMPQ         R10, $0x3f      // <--                                  // cmp	r10, 63
+	VPBROADCASTB CX, Z9          // <--                                  // vpbroadcastb	zmm9, ecx
+	MOVL         $0x20202020, CX // <--                                  // mov	ecx, 538976288
+	SETLE        SI              // <--                                  // setle	sil
+	XORL         R12, R12        // <--                                  // xor	r12d, r12d
+	VPBROADCASTD CX, Z4          // <--                                  // vpbroadcastd	zmm4, ecx
+	MOVL         $-0x61, CX      // <--                                  // mov	ecx, -97
+	LEAQ         0x4(SI*4), SI   // <--                                  // lea	rsi, [rsi*4 + 4]
+	VPBROADCASTB CX, Z3          // <--                                  // vpbroadcastb	zmm3, ecx
+	MOVL         $0x1a, CX       // <--                                  // mov	ecx, 26
+	VPBROADCASTB CX, Z2          // <--                                  // vpbroadcastb	zmm2, ecx
+
+LBB14_15:
+	CMPQ AX, $0x3f // <--                                  // cmp	rax, 63
+	JLE  LBB14_22  // <--                                  // jle	.LBB14_22
+
+LBB14_16:
+	SUBQ     $0x40, AX                            // <--                                  // sub	rax, 64
+	MOVQ     0x28(SP), DI                         // <--                                  // mov	rdi, qword ptr [rsp + 40]
+	VPORD    0(DX)(AX*1), Z9, Z1                  // <--                                  // vpord	zmm1, zmm9, zmmword ptr [rdx + rax]
+	VPORD    0(DI)(AX*1), Z6, Z0                  // <--                                  // vpord	zmm0, zmm6, zmmword ptr [rdi + rax]
+	LONG     $0x4875f362; WORD $0xcf3f; BYTE $0x0 // VPCMPEQB Z7, Z1, K1                  // vpcmpeqb	k1, zmm1, zmm7
+	LONG     $0x497df362; WORD $0xcd3f; BYTE $0x0 // VPCMPEQB Z5, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm5
+	KORTESTQ K1, K1                               // <--                                  // kortestq	k1, k1
+	JE       LBB14_15                             // <--                                  // je	.LBB14_15
+
+LBB14_17:
+	MOVQ         DX, 0x38(SP)  // <--                                  // mov	qword ptr [rsp + 56], rdx
+	MOVL         $0x20, CX     // <--                                  // mov	ecx, 32
+	LEAQ         0x3f(AX), R14 // <--                                  // lea	r14, [rax + 63]
+	VPBROADCASTB CX, Z1        // <--                                  // vpbroadcastb	zmm1, ecx
+
+LBB14_18:
+	KMOVQ K1, DI            // <--                                  // kmovq	rdi, k1
+	BSRQ  DI, CX            // <--                                  // bsr	rcx, rdi
+	MOVQ  R14, R11          // <--                                  // mov	r11, r14
+	XORL  $0x3f, CX         // <--                                  // xor	ecx, 63
+	SUBQ  CX, R11           // <--                                  // sub	r11, rcx
+	LEAQ  0(BX)(R11*1), R15 // <--                                  // lea	r15, [rbx + r11]
+	CMPQ  R10, $0x3f        // <--                                  // cmp	r10, 63
+	JLE   LBB14_26          // <--                                  // jle	.LBB14_26
+	MOVQ  0x38(SP), DX      // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVQ  R10, CX           // <--                                  // mov	rcx, r10
+	MOVQ  R9, DI            // <--                                  // mov	rdi, r9
+	MOVQ  R15, R8           // <--                                  // mov	r8, r15
+	JMP   LBB14_20          // <--                                  // jmp	.LBB14_20
+
+LBB14_19:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R8 // <--                                  // add	r8, 64
+	ADDQ $0x40, DI // <--                                  // add	rdi, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB14_23  // <--                                  // jle	.LBB14_23
+
+LBB14_20:
+	VPORD     0(R8), Z4, Z0                        // <--                                  // vpord	zmm0, zmm4, zmmword ptr [r8]
+	VPADDB    Z3, Z0, Z0                           // <--                                  // vpaddb	zmm0, zmm0, zmm3
+	LONG      $0x487df362; WORD $0xd23e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K2                 // vpcmpltub	k2, zmm0, zmm2
+	VMOVDQU32 0(DI), Z0                            // <--                                  // vmovdqu32	zmm0, zmmword ptr [rdi]
+	VPXORD    0(R8), Z0, Z0                        // <--                                  // vpxord	zmm0, zmm0, zmmword ptr [r8]
+	LONG      $0x4a7df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K2, K0              // vpcmpeqb	k0{k2}, zmm0, zmm1
+	KNOTQ     K0, K0                               // <--                                  // knotq	k0, k0
+	KMOVQ     K0, K4                               // <--                                  // kmovq	k4, k0
+	VPTESTMB  Z0, Z0, K4, K0                       // <--                                  // vptestmb	k0{k4}, zmm0, zmm0
+	KORTESTQ  K0, K0                               // <--                                  // kortestq	k0, k0
+	JE        LBB14_19                             // <--                                  // je	.LBB14_19
+	MOVQ      DX, 0x38(SP)                         // <--                                  // mov	qword ptr [rsp + 56], rdx
+
+LBB14_21:
+	ADDQ     $0x1, R12    // <--                                  // add	r12, 1
+	CMPQ     R12, SI      // <--                                  // cmp	r12, rsi
+	JG       LBB14_29     // <--                                  // jg	.LBB14_29
+	MOVL     R11, CX      // <--                                  // mov	ecx, r11d
+	MOVQ     R13, DI      // <--                                  // mov	rdi, r13
+	SUBL     AX, CX       // <--                                  // sub	ecx, eax
+	SHLQ     CX, DI       // <--                                  // shl	rdi, cl
+	KMOVQ    DI, K7       // <--                                  // kmovq	k7, rdi
+	KANDNQ   K1, K7, K1   // <--                                  // kandnq	k1, k7, k1
+	KORTESTQ K1, K1       // <--                                  // kortestq	k1, k1
+	JNE      LBB14_18     // <--                                  // jne	.LBB14_18
+	MOVQ     0x38(SP), DX // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	CMPQ     AX, $0x3f    // <--                                  // cmp	rax, 63
+	JG       LBB14_16     // <--                                  // jg	.LBB14_16
+
+LBB14_22:
+	TESTQ      AX, AX                               // <--                                  // test	rax, rax
+	JE         LBB14_27                             // <--                                  // je	.LBB14_27
+	MOVL       AX, CX                               // <--                                  // mov	ecx, eax
+	MOVL       $0x1, DI                             // <--                                  // mov	edi, 1
+	SHLQ       CX, DI                               // <--                                  // shl	rdi, cl
+	LEAQ       -0x1(DI), AX                         // <--                                  // lea	rax, [rdi - 1]
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	MOVQ       0x28(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 40]
+	VMOVDQU8.Z 0(AX), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rax]
+	VPORD      Z6, Z0, Z0                           // <--                                  // vpord	zmm0, zmm0, zmm6
+	LONG       $0x497df362; WORD $0xed3f; BYTE $0x0 // VPCMPEQB Z5, Z0, K1, K5              // vpcmpeqb	k5{k1}, zmm0, zmm5
+	VMOVDQU8.Z 0(DX), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rdx]
+	VPORD      Z9, Z0, Z0                           // <--                                  // vpord	zmm0, zmm0, zmm9
+	LONG       $0x497df362; WORD $0xcf3f; BYTE $0x0 // VPCMPEQB Z7, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm7
+	KMOVQ      K5, AX                               // <--                                  // kmovq	rax, k5
+	KMOVQ      K1, DI                               // <--                                  // kmovq	rdi, k1
+	ANDQ       AX, DI                               // <--                                  // and	rdi, rax
+	KMOVQ      DI, K1                               // <--                                  // kmovq	k1, rdi
+	JE         LBB14_27                             // <--                                  // je	.LBB14_27
+	XORL       AX, AX                               // <--                                  // xor	eax, eax
+	JMP        LBB14_17                             // <--                                  // jmp	.LBB14_17
+
+LBB14_23:
+	MOVQ  DX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdx
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB14_25     // <--                                  // je	.LBB14_25
+
+LBB14_24:
+	MOVQ       R13, DX                              // <--                                  // mov	rdx, r13
+	SHLQ       CX, DX                               // <--                                  // shl	rdx, cl
+	LEAQ       -0x1(DX), DX                         // <--                                  // lea	rdx, [rdx - 1]
+	KMOVQ      DX, K2                               // <--                                  // kmovq	k2, rdx
+	VMOVDQU8.Z 0(R8), K2, Z0                        // <--                                  // vmovdqu8	zmm0{k2}{z}, zmmword ptr [r8]
+	VMOVDQU8.Z 0(DI), K2, Z11                       // <--                                  // vmovdqu8	zmm11{k2}{z}, zmmword ptr [rdi]
+	VPORD      Z0, Z4, Z12                          // <--                                  // vpord	zmm12, zmm4, zmm0
+	VPXORD     Z11, Z0, Z0                          // <--                                  // vpxord	zmm0, zmm0, zmm11
+	VPADDB     Z3, Z12, Z13                         // <--                                  // vpaddb	zmm13, zmm12, zmm3
+	LONG       $0x4815f362; WORD $0xd23e; BYTE $0x1 // VPCMPLTUB Z2, Z13, K2                // vpcmpltub	k2, zmm13, zmm2
+	LONG       $0x4a7df362; WORD $0xd13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K2, K2              // vpcmpeqb	k2{k2}, zmm0, zmm1
+	KNOTQ      K2, K2                               // <--                                  // knotq	k2, k2
+	VPTESTMB   Z0, Z0, K2, K2                       // <--                                  // vptestmb	k2{k2}, zmm0, zmm0
+	KORTESTQ   K2, K2                               // <--                                  // kortestq	k2, k2
+	JNE        LBB14_21                             // <--                                  // jne	.LBB14_21
+
+LBB14_25:
+	MOVQ       R11, AX  // <--                                  // mov	rax, r11
+	VZEROUPPER          // <--                                  // vzeroupper
+	JMP        LBB14_12 // <--                                  // jmp	.LBB14_12
+
+LBB14_26:
+	MOVQ R15, R8  // <--                                  // mov	r8, r15
+	MOVQ R9, DI   // <--                                  // mov	rdi, r9
+	MOVQ R10, CX  // <--                                  // mov	rcx, r10
+	JMP  LBB14_24 // <--                                  // jmp	.LBB14_24
+
+LBB14_27:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB14_28:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	MOVQ $-0x1, AX      // <--                                  // mov	rax, -1
+	BYTE $0x5b          // POPQ BX                              // pop	rbx
+	WORD $0x5c41        // POPQ R12                             // pop	r12
+	WORD $0x5d41        // POPQ R13                             // pop	r13
+	WORD $0x5e41        // POPQ R14                             // pop	r14
+	WORD $0x5f41        // POPQ R15                             // pop	r15
+	BYTE $0x5d          // POPQ BP                              // pop	rbp
+	MOVQ AX, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB14_29:
+	LEAQ  -0x1(R11), AX  // <--                                  // lea	rax, [r11 - 1]
+	TESTQ R11, R11       // <--                                  // test	r11, r11
+	JE    LBB14_27       // <--                                  // je	.LBB14_27
+	MOVQ  R10, DX        // <--                                  // mov	rdx, r10
+	MOVL  $0x1000193, CX // <--                                  // mov	ecx, 16777619
+	MOVL  $0x1, R12      // <--                                  // mov	r12d, 1
+
+LBB14_30:
+	TESTB $0x1, DX // <--                                  // test	dl, 1
+	JE    LBB14_31 // <--                                  // je	.LBB14_31
+	IMULL CX, R12  // <--                                  // imul	r12d, ecx
+
+LBB14_31:
+	IMULL CX, CX        // <--                                  // imul	ecx, ecx
+	SHRQ  $0x1, DX      // <--                                  // shr	rdx, 1
+	JNE   LBB14_30      // <--                                  // jne	.LBB14_30
+	LEAQ  -0x1(R10), CX // <--                                  // lea	rcx, [r10 - 1]
+	XORL  R8, R8        // <--                                  // xor	r8d, r8d
+	XORL  SI, SI        // <--                                  // xor	esi, esi
+
+LBB14_32:
+	MOVBLZX      0(R9)(CX*1), DX                   // <--                                  // movzx	edx, byte ptr [r9 + rcx]
+	LONG         $0x193f669; WORD $0x100           // IMULL $0x1000193, SI, SI             // imul	esi, esi, 16777619
+	LEAL         -0x61(DX), R11                    // <--                                  // lea	r11d, [rdx - 97]
+	LEAL         -0x20(DX), DI                     // <--                                  // lea	edi, [rdx - 32]
+	CMPB         R11, $0x1a                        // <--                                  // cmp	r11b, 26
+	CMOVLCS      DI, DX                            // <--                                  // cmovb	edx, edi
+	LONG         $0x93c06945; WORD $0x1; BYTE $0x1 // IMULL $0x1000193, R8, R8             // imul	r8d, r8d, 16777619
+	MOVBLZX      DX, DX                            // <--                                  // movzx	edx, dl
+	ADDL         DX, SI                            // <--                                  // add	esi, edx
+	MOVBLZX      -0x1(R15)(CX*1), DX               // <--                                  // movzx	edx, byte ptr [r15 + rcx - 1]
+	LEAL         -0x61(DX), R11                    // <--                                  // lea	r11d, [rdx - 97]
+	LEAL         -0x20(DX), DI                     // <--                                  // lea	edi, [rdx - 32]
+	CMPB         R11, $0x1a                        // <--                                  // cmp	r11b, 26
+	CMOVLCS      DI, DX                            // <--                                  // cmovb	edx, edi
+	MOVBLZX      DX, DX                            // <--                                  // movzx	edx, dl
+	ADDL         DX, R8                            // <--                                  // add	r8d, edx
+	SUBQ         $0x1, CX                          // <--                                  // sub	rcx, 1
+	JAE          LBB14_32                          // <--                                  // jae	.LBB14_32
+	MOVL         $0x20202020, DX                   // <--                                  // mov	edx, 538976288
+	ADDQ         AX, BX                            // <--                                  // add	rbx, rax
+	MOVL         $0x1, DI                          // <--                                  // mov	edi, 1
+	VPBROADCASTD DX, Z4                            // <--                                  // vpbroadcastd	zmm4, edx
+	MOVL         $-0x61, DX                        // <--                                  // mov	edx, -97
+	VPBROADCASTB DX, Z3                            // <--                                  // vpbroadcastb	zmm3, edx
+	MOVL         $0x1a, DX                         // <--                                  // mov	edx, 26
+	VPBROADCASTB DX, Z2                            // <--                                  // vpbroadcastb	zmm2, edx
+	MOVL         $0x20, DX                         // <--                                  // mov	edx, 32
+	VPBROADCASTB DX, Z1                            // <--                                  // vpbroadcastb	zmm1, edx
+	JMP          LBB14_34                          // <--                                  // jmp	.LBB14_34
+
+LBB14_33:
+	TESTQ   AX, AX                            // <--                                  // test	rax, rax
+	JE      LBB14_27                          // <--                                  // je	.LBB14_27
+	MOVBLZX -0x1(BX), DX                      // <--                                  // movzx	edx, byte ptr [rbx - 1]
+	LONG    $0x93c86941; WORD $0x1; BYTE $0x1 // IMULL $0x1000193, R8, CX             // imul	ecx, r8d, 16777619
+	LEAL    -0x61(DX), R11                    // <--                                  // lea	r11d, [rdx - 97]
+	LEAL    -0x20(DX), R8                     // <--                                  // lea	r8d, [rdx - 32]
+	CMPB    R11, $0x1a                        // <--                                  // cmp	r11b, 26
+	CMOVLCS R8, DX                            // <--                                  // cmovb	edx, r8d
+	SUBQ    $0x1, AX                          // <--                                  // sub	rax, 1
+	MOVBLZX DX, R8                            // <--                                  // movzx	r8d, dl
+	MOVBLZX -0x1(BX)(R10*1), DX               // <--                                  // movzx	edx, byte ptr [rbx + r10 - 1]
+	ADDL    CX, R8                            // <--                                  // add	r8d, ecx
+	LEAL    -0x61(DX), R11                    // <--                                  // lea	r11d, [rdx - 97]
+	LEAL    -0x20(DX), CX                     // <--                                  // lea	ecx, [rdx - 32]
+	CMPB    R11, $0x1a                        // <--                                  // cmp	r11b, 26
+	CMOVLCS CX, DX                            // <--                                  // cmovb	edx, ecx
+	SUBQ    $0x1, BX                          // <--                                  // sub	rbx, 1
+	MOVBLZX DX, DX                            // <--                                  // movzx	edx, dl
+	IMULL   R12, DX                           // <--                                  // imul	edx, r12d
+	SUBL    DX, R8                            // <--                                  // sub	r8d, edx
+
+LBB14_34:
+	CMPL SI, R8     // <--                                  // cmp	esi, r8d
+	JNE  LBB14_33   // <--                                  // jne	.LBB14_33
+	MOVQ BX, R11    // <--                                  // mov	r11, rbx
+	MOVQ R10, CX    // <--                                  // mov	rcx, r10
+	MOVQ R9, DX     // <--                                  // mov	rdx, r9
+	CMPQ R10, $0x3f // <--                                  // cmp	r10, 63
+	JLE  LBB14_36   // <--                                  // jle	.LBB14_36
+
+LBB14_35:
+	VPORD     0(R11), Z4, Z0                       // <--                                  // vpord	zmm0, zmm4, zmmword ptr [r11]
+	VMOVDQU32 0(DX), Z5                            // <--                                  // vmovdqu32	zmm5, zmmword ptr [rdx]
+	VPADDB    Z3, Z0, Z0                           // <--                                  // vpaddb	zmm0, zmm0, zmm3
+	LONG      $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VPXORD    0(R11), Z5, Z0                       // <--                                  // vpxord	zmm0, zmm5, zmmword ptr [r11]
+	LONG      $0x497df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K1, K0              // vpcmpeqb	k0{k1}, zmm0, zmm1
+	KNOTQ     K0, K0                               // <--                                  // knotq	k0, k0
+	KMOVQ     K0, K5                               // <--                                  // kmovq	k5, k0
+	VPTESTMB  Z0, Z0, K5, K0                       // <--                                  // vptestmb	k0{k5}, zmm0, zmm0
+	KORTESTQ  K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE       LBB14_33                             // <--                                  // jne	.LBB14_33
+	SUBQ      $0x40, CX                            // <--                                  // sub	rcx, 64
+	ADDQ      $0x40, R11                           // <--                                  // add	r11, 64
+	ADDQ      $0x40, DX                            // <--                                  // add	rdx, 64
+	CMPQ      CX, $0x3f                            // <--                                  // cmp	rcx, 63
+	JG        LBB14_35                             // <--                                  // jg	.LBB14_35
+	TESTQ     CX, CX                               // <--                                  // test	rcx, rcx
+	JE        LBB14_11                             // <--                                  // je	.LBB14_11
+
+LBB14_36:
+	MOVQ       DI, R14                              // <--                                  // mov	r14, rdi
+	SHLQ       CX, R14                              // <--                                  // shl	r14, cl
+	MOVQ       R14, CX                              // <--                                  // mov	rcx, r14
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(R11), K1, Z0                       // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r11]
+	VMOVDQU8.Z 0(DX), K1, Z6                        // <--                                  // vmovdqu8	zmm6{k1}{z}, zmmword ptr [rdx]
+	VPORD      Z0, Z4, Z5                           // <--                                  // vpord	zmm5, zmm4, zmm0
+	VPXORD     Z6, Z0, Z0                           // <--                                  // vpxord	zmm0, zmm0, zmm6
+	VPADDB     Z3, Z5, Z5                           // <--                                  // vpaddb	zmm5, zmm5, zmm3
+	LONG       $0x4855f362; WORD $0xc23e; BYTE $0x1 // VPCMPLTUB Z2, Z5, K0                 // vpcmpltub	k0, zmm5, zmm2
+	KMOVQ      K0, K6                               // <--                                  // kmovq	k6, k0
+	LONG       $0x4e7df362; WORD $0xc13f; BYTE $0x0 // VPCMPEQB Z1, Z0, K6, K0              // vpcmpeqb	k0{k6}, zmm0, zmm1
+	KNOTQ      K0, K0                               // <--                                  // knotq	k0, k0
+	KMOVQ      K0, K7                               // <--                                  // kmovq	k7, k0
+	VPTESTMB   Z0, Z0, K7, K0                       // <--                                  // vptestmb	k0{k7}, zmm0, zmm0
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB14_33                             // <--                                  // jne	.LBB14_33
+	JMP        LBB14_11                             // <--                                  // jmp	.LBB14_11
+
+LBB14_37:
+	LONG $0x487df162; WORD $0xc66f // VMOVDQA32 Z6, Z0                     // vmovdqa32	zmm0, zmm6
+	JMP  LBB14_8                   // <--                                  // jmp	.LBB14_8
+
+TEXT ·lastSearchNeedleFoldAvx512(SB), NOSPLIT, $200-72
+	MOVQ         haystack+0(FP), DI
+	MOVQ         haystack_len+8(FP), SI
+	MOVBQZX      rare1+16(FP), DX
+	MOVQ         off1+24(FP), CX
+	MOVBQZX      rare2+32(FP), R8
+	MOVQ         off2+40(FP), R9
+	MOVQ         needle+48(FP), AX
+	MOVQ         AX, 8(SP)
+	MOVQ         needle_len+56(FP), AX
+	MOVQ         AX, 16(SP)
+	PUSHQ        BP              // <--                                  // push	rbp
+	MOVQ         SI, R11         // <--                                  // mov	r11, rsi
+	MOVQ         R9, SI          // <--                                  // mov	rsi, r9
+	MOVQ         SP, BP          // <--                                  // mov	rbp, rsp
+	PUSHQ        R15             // <--                                  // push	r15
+	PUSHQ        R14             // <--                                  // push	r14
+	PUSHQ        R13             // <--                                  // push	r13
+	PUSHQ        R12             // <--                                  // push	r12
+	PUSHQ        BX              // <--                                  // push	rbx
+	ANDQ         $-0x40, SP      // <--                                  // and	rsp, -64
+	SUBQ         $0x40, SP       // <--                                  // sub	rsp, 64
+	MOVQ         0x18(BP), R10   // <--                                  // mov	r10, qword ptr [rbp + 24]
+	MOVQ         0x10(BP), R9    // <--                                  // mov	r9, qword ptr [rbp + 16]
+	CMPQ         R11, R10        // <--                                  // cmp	r11, r10
+	JL           LBB15_28        // <--                                  // jl	.LBB15_28
+	MOVQ         R11, AX         // <--                                  // mov	rax, r11
+	TESTQ        R10, R10        // <--                                  // test	r10, r10
+	JLE          LBB15_12        // <--                                  // jle	.LBB15_12
+	SUBQ         R10, R11        // <--                                  // sub	r11, r10
+	LEAL         -0x61(DX), AX   // <--                                  // lea	eax, [rdx - 97]
+	MOVQ         DI, BX          // <--                                  // mov	rbx, rdi
+	MOVL         R8, DI          // <--                                  // mov	edi, r8d
+	MOVQ         R11, R8         // <--                                  // mov	r8, r11
+	VPBROADCASTB DX, Z4          // <--                                  // vpbroadcastb	zmm4, edx
+	LEAQ         0(BX)(CX*1), DX // <--                                  // lea	rdx, [rbx + rcx]
+	MOVL         $0x1, R12       // <--                                  // mov	r12d, 1
+	ADDQ         $0x1, R8        // <--                                  // add	r8, 1
+	WORD         $0x193c         // CMPB AX, $0x19                       // cmp	al, 25
+	MOVQ         DX, 0x28(SP)    // <--                                  // mov	qword ptr [rsp + 40], rdx
+	SETLS        AX              // <--                                  // setbe	al
+	MOVQ         R8, R14         // <--                                  // mov	r14, r8
+	XORL         R11, R11        // <--                                  // xor	r11d, r11d
+	SHLL         $0x5, AX        // <--                                  // shl	eax, 5
+	VPBROADCASTB AX, Z5          // <--                                  // vpbroadcastb	zmm5, eax
+	MOVL         $-0x41, AX      // <--                                  // mov	eax, -65
+	VPBROADCASTB AX, Z3          // <--                                  // vpbroadcastb	zmm3, eax
+	MOVL         $0x1a, AX       // <--                                  // mov	eax, 26
+	VPBROADCASTB AX, Z2          // <--                                  // vpbroadcastb	zmm2, eax
+	MOVL         $0x20, AX       // <--                                  // mov	eax, 32
+	VPBROADCASTB AX, Z1          // <--                                  // vpbroadcastb	zmm1, eax
+
+LBB15_0:
+	CMPQ R14, $0xff // <--                                  // cmp	r14, 255
+	JG   LBB15_7    // <--                                  // jg	.LBB15_7
+
+LBB15_1:
+	CMPQ       R14, $0x3f                           // <--                                  // cmp	r14, 63
+	JG         LBB15_37                             // <--                                  // jg	.LBB15_37
+	TESTQ      R14, R14                             // <--                                  // test	r14, r14
+	JE         LBB15_27                             // <--                                  // je	.LBB15_27
+	MOVL       R14, CX                              // <--                                  // mov	ecx, r14d
+	MOVL       $0x1, AX                             // <--                                  // mov	eax, 1
+	XORL       R14, R14                             // <--                                  // xor	r14d, r14d
+	SHLQ       CX, AX                               // <--                                  // shl	rax, cl
+	SUBQ       $0x1, AX                             // <--                                  // sub	rax, 1
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	VMOVDQU8.Z 0(DX), K1, Z0                        // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [rdx]
+	VPORD      Z5, Z0, Z0                           // <--                                  // vpord	zmm0, zmm0, zmm5
+	LONG       $0x497df362; WORD $0xcc3f; BYTE $0x0 // VPCMPEQB Z4, Z0, K1, K1              // vpcmpeqb	k1{k1}, zmm0, zmm4
+	KORTESTQ   K1, K1                               // <--                                  // kortestq	k1, k1
+	JE         LBB15_27                             // <--                                  // je	.LBB15_27
+
+LBB15_2:
+	MOVQ SI, 0x30(SP)   // <--                                  // mov	qword ptr [rsp + 48], rsi
+	LEAQ 0x3f(R14), R15 // <--                                  // lea	r15, [r14 + 63]
+	MOVQ DX, 0x38(SP)   // <--                                  // mov	qword ptr [rsp + 56], rdx
+	MOVQ R14, DX        // <--                                  // mov	rdx, r14
+	MOVQ R8, R14        // <--                                  // mov	r14, r8
+	MOVQ R15, R8        // <--                                  // mov	r8, r15
+
+LBB15_3:
+	KMOVQ K1, AX           // <--                                  // kmovq	rax, k1
+	BSRQ  AX, CX           // <--                                  // bsr	rcx, rax
+	MOVQ  R8, AX           // <--                                  // mov	rax, r8
+	MOVQ  R9, R15          // <--                                  // mov	r15, r9
+	XORL  $0x3f, CX        // <--                                  // xor	ecx, 63
+	SUBQ  CX, AX           // <--                                  // sub	rax, rcx
+	MOVQ  R10, CX          // <--                                  // mov	rcx, r10
+	LEAQ  0(BX)(AX*1), R13 // <--                                  // lea	r13, [rbx + rax]
+	CMPQ  R10, $0x3f       // <--                                  // cmp	r10, 63
+	JLE   LBB15_10         // <--                                  // jle	.LBB15_10
+	MOVQ  0x38(SP), SI     // <--                                  // mov	rsi, qword ptr [rsp + 56]
+	JMP   LBB15_5          // <--                                  // jmp	.LBB15_5
+
+LBB15_4:
+	SUBQ $0x40, CX  // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R13 // <--                                  // add	r13, 64
+	ADDQ $0x40, R15 // <--                                  // add	r15, 64
+	CMPQ CX, $0x3f  // <--                                  // cmp	rcx, 63
+	JLE  LBB15_9    // <--                                  // jle	.LBB15_9
+
+LBB15_5:
+	VPADDB   0(R13), Z3, Z0                       // <--                                  // vpaddb	zmm0, zmm3, zmmword ptr [r13 + 0]
+	LONG     $0x487df362; WORD $0xd23e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K2                 // vpcmpltub	k2, zmm0, zmm2
+	VMOVDQU8 0(R13), Z0                           // <--                                  // vmovdqu8	zmm0, zmmword ptr [r13 + 0]
+	VPADDB   Z0, Z1, K2, Z0                       // <--                                  // vpaddb	zmm0{k2}, zmm1, zmm0
+	LONG     $0x487dd362; WORD $0x73f; BYTE $0x4  // VPCMPNEQB 0(R15), Z0, K0             // vpcmpneqb	k0, zmm0, zmmword ptr [r15]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JE       LBB15_4                              // <--                                  // je	.LBB15_4
+	MOVQ     SI, 0x38(SP)                         // <--                                  // mov	qword ptr [rsp + 56], rsi
+
+LBB15_6:
+	MOVQ     R14, CX      // <--                                  // mov	rcx, r14
+	ADDQ     $0x1, R11    // <--                                  // add	r11, 1
+	SUBQ     AX, CX       // <--                                  // sub	rcx, rax
+	SARQ     $0x8, CX     // <--                                  // sar	rcx, 8
+	ADDQ     $0x4, CX     // <--                                  // add	rcx, 4
+	CMPQ     R11, CX      // <--                                  // cmp	r11, rcx
+	JG       LBB15_14     // <--                                  // jg	.LBB15_14
+	SUBL     DX, AX       // <--                                  // sub	eax, edx
+	MOVQ     R12, R15     // <--                                  // mov	r15, r12
+	MOVL     AX, CX       // <--                                  // mov	ecx, eax
+	SHLQ     CX, R15      // <--                                  // shl	r15, cl
+	KMOVQ    R15, K3      // <--                                  // kmovq	k3, r15
+	KANDNQ   K1, K3, K1   // <--                                  // kandnq	k1, k3, k1
+	KORTESTQ K1, K1       // <--                                  // kortestq	k1, k1
+	JNE      LBB15_3      // <--                                  // jne	.LBB15_3
+	MOVQ     R14, R8      // <--                                  // mov	r8, r14
+	MOVQ     DX, R14      // <--                                  // mov	r14, rdx
+	MOVQ     0x30(SP), SI // <--                                  // mov	rsi, qword ptr [rsp + 48]
+	MOVQ     0x38(SP), DX // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	CMPQ     R14, $0xff   // <--                                  // cmp	r14, 255
+	JLE      LBB15_1      // <--                                  // jle	.LBB15_1
+
+LBB15_7:
+	LEAQ  -0x100(R14), CX                      // <--                                  // lea	rcx, [r14 - 256]
+	LONG  $0x487df162; WORD $0xc56f            // VMOVDQA32 Z5, Z0                     // vmovdqa32	zmm0, zmm5
+	LEAQ  0(DX)(CX*1), R13                     // <--                                  // lea	r13, [rdx + rcx]
+	VPORD 0(R13), Z5, Z6                       // <--                                  // vpord	zmm6, zmm5, zmmword ptr [r13 + 0]
+	LONG  $0x484df362; WORD $0xc43f; BYTE $0x0 // VPCMPEQB Z4, Z6, K0                  // vpcmpeqb	k0, zmm6, zmm4
+	VPORD 0x40(R13), Z5, Z6                    // <--                                  // vpord	zmm6, zmm5, zmmword ptr [r13 + 64]
+	LONG  $0x484df362; WORD $0xcc3f; BYTE $0x0 // VPCMPEQB Z4, Z6, K1                  // vpcmpeqb	k1, zmm6, zmm4
+	VPORD 0x80(R13), Z5, Z6                    // <--                                  // vpord	zmm6, zmm5, zmmword ptr [r13 + 128]
+	LONG  $0x484df362; WORD $0xec3f; BYTE $0x0 // VPCMPEQB Z4, Z6, K5                  // vpcmpeqb	k5, zmm6, zmm4
+	VPORD 0xc0(R13), Z5, Z6                    // <--                                  // vpord	zmm6, zmm5, zmmword ptr [r13 + 192]
+	KMOVQ K0, R13                              // <--                                  // kmovq	r13, k0
+	KMOVQ K1, AX                               // <--                                  // kmovq	rax, k1
+	ORQ   R13, AX                              // <--                                  // or	rax, r13
+	LONG  $0x484df362; WORD $0xf43f; BYTE $0x0 // VPCMPEQB Z4, Z6, K6                  // vpcmpeqb	k6, zmm6, zmm4
+	KMOVQ K5, R15                              // <--                                  // kmovq	r15, k5
+	ORQ   R15, AX                              // <--                                  // or	rax, r15
+	KMOVQ K6, R15                              // <--                                  // kmovq	r15, k6
+	ORQ   R15, AX                              // <--                                  // or	rax, r15
+	JE    LBB15_13                             // <--                                  // je	.LBB15_13
+
+LBB15_8:
+	SUBQ     $0x40, R14                           // <--                                  // sub	r14, 64
+	VPORD    0(DX)(R14*1), Z0, Z0                 // <--                                  // vpord	zmm0, zmm0, zmmword ptr [rdx + r14]
+	LONG     $0x487df362; WORD $0xcc3f; BYTE $0x0 // VPCMPEQB Z4, Z0, K1                  // vpcmpeqb	k1, zmm0, zmm4
+	KORTESTQ K1, K1                               // <--                                  // kortestq	k1, k1
+	JNE      LBB15_2                              // <--                                  // jne	.LBB15_2
+	JMP      LBB15_0                              // <--                                  // jmp	.LBB15_0
+
+LBB15_9:
+	MOVQ  SI, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rsi
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB15_11     // <--                                  // je	.LBB15_11
+
+LBB15_10:
+	MOVQ       R12, SI                              // <--                                  // mov	rsi, r12
+	SHLQ       CX, SI                               // <--                                  // shl	rsi, cl
+	LEAQ       -0x1(SI), SI                         // <--                                  // lea	rsi, [rsi - 1]
+	KMOVQ      SI, K2                               // <--                                  // kmovq	k2, rsi
+	VMOVDQU8.Z 0(R13), K2, Z0                       // <--                                  // vmovdqu8	zmm0{k2}{z}, zmmword ptr [r13 + 0]
+	VMOVDQU8.Z 0(R15), K2, Z7                       // <--                                  // vmovdqu8	zmm7{k2}{z}, zmmword ptr [r15]
+	VPADDB     Z3, Z0, Z6                           // <--                                  // vpaddb	zmm6, zmm0, zmm3
+	LONG       $0x484df362; WORD $0xd23e; BYTE $0x1 // VPCMPLTUB Z2, Z6, K2                 // vpcmpltub	k2, zmm6, zmm2
+	LONG       $0x48fdf162; WORD $0xf06f            // VMOVDQA64 Z0, Z6                     // vmovdqa64	zmm6, zmm0
+	VPADDB     Z1, Z0, K2, Z6                       // <--                                  // vpaddb	zmm6{k2}, zmm0, zmm1
+	LONG       $0x484df362; WORD $0xc73f; BYTE $0x4 // VPCMPNEQB Z7, Z6, K0                 // vpcmpneqb	k0, zmm6, zmm7
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB15_6                              // <--                                  // jne	.LBB15_6
+
+LBB15_11:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB15_12:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	POPQ BX             // <--                                  // pop	rbx
+	POPQ R12            // <--                                  // pop	r12
+	POPQ R13            // <--                                  // pop	r13
+	POPQ R14            // <--                                  // pop	r14
+	POPQ R15            // <--                                  // pop	r15
+	POPQ BP             // <--                                  // pop	rbp
+	MOVQ AX, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB15_13:
+	MOVQ CX, R14 // <--                                  // mov	r14, rcx
+	JMP  LBB15_0 // <--                                  // jmp	.LBB15_0
+
+LBB15_14:
+	LEAL         -0x61(DI), CX   // <--                                  // lea	ecx, [rdi - 97]
+	MOVQ         0x30(SP), SI    // <--                                  // mov	rsi, qword ptr [rsp + 48]
+	VPBROADCASTB DI, Z0          // <--                                  // vpbroadcastb	zmm0, edi
+	MOVL         $0x1, R13       // <--                                  // mov	r13d, 1
+	CMPB         CX, $0x19       // <--                                  // cmp	cl, 25
+	SETLS        CX              // <--                                  // setbe	cl
+	LEAQ         0(BX)(SI*1), DX // <--                                  // lea	rdx, [rbx + rsi]
+	XORL         SI, SI          // <--                                  // xor	esi, esi
+	SHLL         $0x5, CX        // <--                                  // shl	ecx, 5
+	CMPQ         R10, $0x3f      // <--                                  // cmp	r10, 63
+	VPBROADCASTB CX, Z8          // <--                                  // vpbroadcastb	zmm8, ecx
+	MOVL         $-0x41, CX      // <--                                  // mov	ecx, -65
+	SETLE        SI              // <--                                  // setle	sil
+	XORL         R12, R12        // <--                                  // xor	r12d, r12d
+	VPBROADCASTB CX, Z3          // <--                                  // vpbroadcastb	zmm3, ecx
+	MOVL         $0x1a, CX       // <--                                  // mov	ecx, 26
+	LEAQ         0x4(SI*4), SI   // <--                                  // lea	rsi, [rsi*4 + 4]
+	VPBROADCASTB CX, Z2          // <--                                  // vpbroadcastb	zmm2, ecx
+	MOVL         $0x20, CX       // <--                                  // mov	ecx, 32
+	VPBROADCASTB CX, Z1          // <--                                  // vpbroadcastb	zmm1, ecx
+
+LBB15_15:
+	CMPQ AX, $0x3f // <--                                  // cmp	rax, 63
+	JLE  LBB15_22  // <--                                  // jle	.LBB15_22
+
+LBB15_16:
+	SUBQ     $0x40, AX                            // <--                                  // sub	rax, 64
+	MOVQ     0x28(SP), DI                         // <--                                  // mov	rdi, qword ptr [rsp + 40]
+	VPORD    0(DX)(AX*1), Z8, Z9                  // <--                                  // vpord	zmm9, zmm8, zmmword ptr [rdx + rax]
+	VPORD    0(DI)(AX*1), Z5, Z7                  // <--                                  // vpord	zmm7, zmm5, zmmword ptr [rdi + rax]
+	LONG     $0x4835f362; WORD $0xc83f; BYTE $0x0 // VPCMPEQB Z0, Z9, K1                  // vpcmpeqb	k1, zmm9, zmm0
+	LONG     $0x4945f362; WORD $0xcc3f; BYTE $0x0 // VPCMPEQB Z4, Z7, K1, K1              // vpcmpeqb	k1{k1}, zmm7, zmm4
+	KORTESTQ K1, K1                               // <--                                  // kortestq	k1, k1
+	JE       LBB15_15                             // <--                                  // je	.LBB15_15
+
+LBB15_17:
+	MOVQ DX, 0x38(SP)  // <--                                  // mov	qword ptr [rsp + 56], rdx
+	LEAQ 0x3f(AX), R14 // <--                                  // lea	r14, [rax + 63]
+
+LBB15_18:
+	KMOVQ K1, DI            // <--                                  // kmovq	rdi, k1
+	BSRQ  DI, CX            // <--                                  // bsr	rcx, rdi
+	MOVQ  R14, R11          // <--                                  // mov	r11, r14
+	XORL  $0x3f, CX         // <--                                  // xor	ecx, 63
+	SUBQ  CX, R11           // <--                                  // sub	r11, rcx
+	LEAQ  0(BX)(R11*1), R15 // <--                                  // lea	r15, [rbx + r11]
+	CMPQ  R10, $0x3f        // <--                                  // cmp	r10, 63
+	JLE   LBB15_26          // <--                                  // jle	.LBB15_26
+	MOVQ  0x38(SP), DX      // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	MOVQ  R10, CX           // <--                                  // mov	rcx, r10
+	MOVQ  R9, DI            // <--                                  // mov	rdi, r9
+	MOVQ  R15, R8           // <--                                  // mov	r8, r15
+	JMP   LBB15_20          // <--                                  // jmp	.LBB15_20
+
+LBB15_19:
+	SUBQ $0x40, CX // <--                                  // sub	rcx, 64
+	ADDQ $0x40, R8 // <--                                  // add	r8, 64
+	ADDQ $0x40, DI // <--                                  // add	rdi, 64
+	CMPQ CX, $0x3f // <--                                  // cmp	rcx, 63
+	JLE  LBB15_23  // <--                                  // jle	.LBB15_23
+
+LBB15_20:
+	VPADDB   0(R8), Z3, Z6                        // <--                                  // vpaddb	zmm6, zmm3, zmmword ptr [r8]
+	VMOVDQU8 0(R8), Z7                            // <--                                  // vmovdqu8	zmm7, zmmword ptr [r8]
+	LONG     $0x484df362; WORD $0xd23e; BYTE $0x1 // VPCMPLTUB Z2, Z6, K2                 // vpcmpltub	k2, zmm6, zmm2
+	VPADDB   Z7, Z1, K2, Z7                       // <--                                  // vpaddb	zmm7{k2}, zmm1, zmm7
+	LONG     $0x4845f362; WORD $0x73f; BYTE $0x4  // VPCMPNEQB 0(DI), Z7, K0              // vpcmpneqb	k0, zmm7, zmmword ptr [rdi]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JE       LBB15_19                             // <--                                  // je	.LBB15_19
+	MOVQ     DX, 0x38(SP)                         // <--                                  // mov	qword ptr [rsp + 56], rdx
+
+LBB15_21:
+	ADDQ     $0x1, R12    // <--                                  // add	r12, 1
+	CMPQ     R12, SI      // <--                                  // cmp	r12, rsi
+	JG       LBB15_29     // <--                                  // jg	.LBB15_29
+	MOVL     R11, CX      // <--                                  // mov	ecx, r11d
+	MOVQ     R13, DI      // <--                                  // mov	rdi, r13
+	SUBL     AX, CX       // <--                                  // sub	ecx, eax
+	SHLQ     CX, DI       // <--                                  // shl	rdi, cl
+	KMOVQ    DI, K4       // <--                                  // kmovq	k4, rdi
+	KANDNQ   K1, K4, K1   // <--                                  // kandnq	k1, k4, k1
+	KORTESTQ K1, K1       // <--                                  // kortestq	k1, k1
+	JNE      LBB15_18     // <--                                  // jne	.LBB15_18
+	MOVQ     0x38(SP), DX // <--                                  // mov	rdx, qword ptr [rsp + 56]
+	CMPQ     AX, $0x3f    // <--                                  // cmp	rax, 63
+	JG       LBB15_16     // <--                                  // jg	.LBB15_16
+
+LBB15_22:
+	TESTQ      AX, AX                               // <--                                  // test	rax, rax
+	JE         LBB15_27                             // <--                                  // je	.LBB15_27
+	MOVL       AX, CX                               // <--                                  // mov	ecx, eax
+	MOVL       $0x1, DI                             // <--                                  // mov	edi, 1
+	SHLQ       CX, DI                               // <--                                  // shl	rdi, cl
+	LEAQ       -0x1(DI), AX                         // <--                                  // lea	rax, [rdi - 1]
+	KMOVQ      AX, K1                               // <--                                  // kmovq	k1, rax
+	MOVQ       0x28(SP), AX                         // <--                                  // mov	rax, qword ptr [rsp + 40]
+	VMOVDQU8.Z 0(AX), K1, Z7                        // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [rax]
+	VPORD      Z5, Z7, Z7                           // <--                                  // vpord	zmm7, zmm7, zmm5
+	LONG       $0x4945f362; WORD $0xfc3f; BYTE $0x0 // VPCMPEQB Z4, Z7, K1, K7              // vpcmpeqb	k7{k1}, zmm7, zmm4
+	VMOVDQU8.Z 0(DX), K1, Z7                        // <--                                  // vmovdqu8	zmm7{k1}{z}, zmmword ptr [rdx]
+	VPORD      Z8, Z7, Z7                           // <--                                  // vpord	zmm7, zmm7, zmm8
+	LONG       $0x4945f362; WORD $0xc83f; BYTE $0x0 // VPCMPEQB Z0, Z7, K1, K1              // vpcmpeqb	k1{k1}, zmm7, zmm0
+	KMOVQ      K7, AX                               // <--                                  // kmovq	rax, k7
+	KMOVQ      K1, DI                               // <--                                  // kmovq	rdi, k1
+	ANDQ       AX, DI                               // <--                                  // and	rdi, rax
+	KMOVQ      DI, K1                               // <--                                  // kmovq	k1, rdi
+	JE         LBB15_27                             // <--                                  // je	.LBB15_27
+	XORL       AX, AX                               // <--                                  // xor	eax, eax
+	JMP        LBB15_17                             // <--                                  // jmp	.LBB15_17
+
+LBB15_23:
+	MOVQ  DX, 0x38(SP) // <--                                  // mov	qword ptr [rsp + 56], rdx
+	TESTQ CX, CX       // <--                                  // test	rcx, rcx
+	JE    LBB15_25     // <--                                  // je	.LBB15_25
+
+LBB15_24:
+	MOVQ       R13, DX                              // <--                                  // mov	rdx, r13
+	SHLQ       CX, DX                               // <--                                  // shl	rdx, cl
+	LEAQ       -0x1(DX), DX                         // <--                                  // lea	rdx, [rdx - 1]
+	KMOVQ      DX, K2                               // <--                                  // kmovq	k2, rdx
+	VMOVDQU8.Z 0(R8), K2, Z6                        // <--                                  // vmovdqu8	zmm6{k2}{z}, zmmword ptr [r8]
+	VMOVDQU8.Z 0(DI), K2, Z10                       // <--                                  // vmovdqu8	zmm10{k2}{z}, zmmword ptr [rdi]
+	VPADDB     Z3, Z6, Z7                           // <--                                  // vpaddb	zmm7, zmm6, zmm3
+	LONG       $0x4845f362; WORD $0xd23e; BYTE $0x1 // VPCMPLTUB Z2, Z7, K2                 // vpcmpltub	k2, zmm7, zmm2
+	LONG       $0x48fdf162; WORD $0xfe6f            // VMOVDQA64 Z6, Z7                     // vmovdqa64	zmm7, zmm6
+	VPADDB     Z1, Z6, K2, Z7                       // <--                                  // vpaddb	zmm7{k2}, zmm6, zmm1
+	LONG       $0x4845d362; WORD $0xc23f; BYTE $0x4 // VPCMPNEQB Z10, Z7, K0                // vpcmpneqb	k0, zmm7, zmm10
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB15_21                             // <--                                  // jne	.LBB15_21
+
+LBB15_25:
+	MOVQ       R11, AX  // <--                                  // mov	rax, r11
+	VZEROUPPER          // <--                                  // vzeroupper
+	JMP        LBB15_12 // <--                                  // jmp	.LBB15_12
+
+LBB15_26:
+	MOVQ R15, R8  // <--                                  // mov	r8, r15
+	MOVQ R9, DI   // <--                                  // mov	rdi, r9
+	MOVQ R10, CX  // <--                                  // mov	rcx, r10
+	JMP  LBB15_24 // <--                                  // jmp	.LBB15_24
+
+LBB15_27:
+	VZEROUPPER // <--                                  // vzeroupper
+
+LBB15_28:
+	LEAQ -0x28(BP), SP  // <--                                  // lea	rsp, [rbp - 40]
+	MOVQ $-0x1, AX      // <--                                  // mov	rax, -1
+	BYTE $0x5b          // POPQ BX                              // pop	rbx
+	WORD $0x5c41        // POPQ R12                             // pop	r12
+	WORD $0x5d41        // POPQ R13                             // pop	r13
+	WORD $0x5e41        // POPQ R14                             // pop	r14
+	WORD $0x5f41        // POPQ R15                             // pop	r15
+	BYTE $0x5d          // POPQ BP                              // pop	rbp
+	MOVQ AX, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB15_29:
+	LEAQ  -0x1(R11), AX  // <--                                  // lea	rax, [r11 - 1]
+	TESTQ R11, R11       // <--                                  // test	r11, r11
+	JE    LBB15_27       // <--                                  // je	.LBB15_27
+	MOVQ  R10, DX        // <--                                  // mov	rdx, r10
+	MOVL  $0x1000193, CX // <--                                  // mov	ecx, 16777619
+	MOVL  $0x1, R12      // <--                                  // mov	r12d, 1
+
+LBB15_30:
+	TESTB $0x1, DX // <--                                  // test	dl, 1
+	JE    LBB15_31 // <--                                  // je	.LBB15_31
+	IMULL CX, R12  // <--                                  // imul	r12d, ecx
+
+LBB15_31:
+	IMULL CX, CX        // <--                                  // imul	ecx, ecx
+	SHRQ  $0x1, DX      // <--                                  // shr	rdx, 1
+	JNE   LBB15_30      // <--                                  // jne	.LBB15_30
+	LEAQ  -0x1(R10), CX // <--                                  // lea	rcx, [r10 - 1]
+	XORL  SI, SI        // <--                                  // xor	esi, esi
+	XORL  DI, DI        // <--                                  // xor	edi, edi
+
+LBB15_32:
+	LONG         $0x193ff69; WORD $0x100 // IMULL $0x1000193, DI, DI             // imul	edi, edi, 16777619
+	MOVBLZX      0(R9)(CX*1), DX         // <--                                  // movzx	edx, byte ptr [r9 + rcx]
+	LONG         $0x193f669; WORD $0x100 // IMULL $0x1000193, SI, SI             // imul	esi, esi, 16777619
+	ADDL         DX, DI                  // <--                                  // add	edi, edx
+	MOVBLZX      -0x1(R15)(CX*1), DX     // <--                                  // movzx	edx, byte ptr [r15 + rcx - 1]
+	LEAL         -0x41(DX), R11          // <--                                  // lea	r11d, [rdx - 65]
+	LEAL         0x20(DX), R8            // <--                                  // lea	r8d, [rdx + 32]
+	CMPB         R11, $0x1a              // <--                                  // cmp	r11b, 26
+	CMOVLCS      R8, DX                  // <--                                  // cmovb	edx, r8d
+	MOVBLZX      DX, DX                  // <--                                  // movzx	edx, dl
+	ADDL         DX, SI                  // <--                                  // add	esi, edx
+	SUBQ         $0x1, CX                // <--                                  // sub	rcx, 1
+	JAE          LBB15_32                // <--                                  // jae	.LBB15_32
+	MOVL         $-0x41, DX              // <--                                  // mov	edx, -65
+	ADDQ         AX, BX                  // <--                                  // add	rbx, rax
+	MOVL         $0x1, R8                // <--                                  // mov	r8d, 1
+	VPBROADCASTB DX, Z3                  // <--                                  // vpbroadcastb	zmm3, edx
+	MOVL         $0x1a, DX               // <--                                  // mov	edx, 26
+	VPBROADCASTB DX, Z2                  // <--                                  // vpbroadcastb	zmm2, edx
+	MOVL         $0x20, DX               // <--                                  // mov	edx, 32
+	VPBROADCASTB DX, Z1                  // <--                                  // vpbroadcastb	zmm1, edx
+	JMP          LBB15_34                // <--                                  // jmp	.LBB15_34
+
+LBB15_33:
+	TESTQ   AX, AX                  // <--                                  // test	rax, rax
+	JE      LBB15_27                // <--                                  // je	.LBB15_27
+	MOVBLZX -0x1(BX), DX            // <--                                  // movzx	edx, byte ptr [rbx - 1]
+	LONG    $0x193ce69; WORD $0x100 // IMULL $0x1000193, SI, CX             // imul	ecx, esi, 16777619
+	LEAL    -0x41(DX), R11          // <--                                  // lea	r11d, [rdx - 65]
+	LEAL    0x20(DX), SI            // <--                                  // lea	esi, [rdx + 32]
+	CMPB    R11, $0x1a              // <--                                  // cmp	r11b, 26
+	CMOVLCS SI, DX                  // <--                                  // cmovb	edx, esi
+	SUBQ    $0x1, AX                // <--                                  // sub	rax, 1
+	MOVBLZX DX, SI                  // <--                                  // movzx	esi, dl
+	MOVBLZX -0x1(BX)(R10*1), DX     // <--                                  // movzx	edx, byte ptr [rbx + r10 - 1]
+	ADDL    CX, SI                  // <--                                  // add	esi, ecx
+	LEAL    -0x41(DX), R11          // <--                                  // lea	r11d, [rdx - 65]
+	LEAL    0x20(DX), CX            // <--                                  // lea	ecx, [rdx + 32]
+	CMPB    R11, $0x1a              // <--                                  // cmp	r11b, 26
+	CMOVLCS CX, DX                  // <--                                  // cmovb	edx, ecx
+	SUBQ    $0x1, BX                // <--                                  // sub	rbx, 1
+	MOVBLZX DX, DX                  // <--                                  // movzx	edx, dl
+	IMULL   R12, DX                 // <--                                  // imul	edx, r12d
+	SUBL    DX, SI                  // <--                                  // sub	esi, edx
+
+LBB15_34:
+	CMPL DI, SI     // <--                                  // cmp	edi, esi
+	JNE  LBB15_33   // <--                                  // jne	.LBB15_33
+	MOVQ BX, R11    // <--                                  // mov	r11, rbx
+	CMPQ R10, $0x3f // <--                                  // cmp	r10, 63
+	JLE  LBB15_38   // <--                                  // jle	.LBB15_38
+	MOVQ R10, CX    // <--                                  // mov	rcx, r10
+	MOVQ R9, DX     // <--                                  // mov	rdx, r9
+
+LBB15_35:
+	VPADDB   0(R11), Z3, Z0                       // <--                                  // vpaddb	zmm0, zmm3, zmmword ptr [r11]
+	LONG     $0x487df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z0, K1                 // vpcmpltub	k1, zmm0, zmm2
+	VMOVDQU8 0(R11), Z0                           // <--                                  // vmovdqu8	zmm0, zmmword ptr [r11]
+	VPADDB   Z0, Z1, K1, Z0                       // <--                                  // vpaddb	zmm0{k1}, zmm1, zmm0
+	LONG     $0x487df362; WORD $0x23f; BYTE $0x4  // VPCMPNEQB 0(DX), Z0, K0              // vpcmpneqb	k0, zmm0, zmmword ptr [rdx]
+	KORTESTQ K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE      LBB15_33                             // <--                                  // jne	.LBB15_33
+	SUBQ     $0x40, CX                            // <--                                  // sub	rcx, 64
+	ADDQ     $0x40, R11                           // <--                                  // add	r11, 64
+	ADDQ     $0x40, DX                            // <--                                  // add	rdx, 64
+	CMPQ     CX, $0x3f                            // <--                                  // cmp	rcx, 63
+	JG       LBB15_35                             // <--                                  // jg	.LBB15_35
+	TESTQ    CX, CX                               // <--                                  // test	rcx, rcx
+	JE       LBB15_11                             // <--                                  // je	.LBB15_11
+
+LBB15_36:
+	MOVQ       R8, R14                              // <--                                  // mov	r14, r8
+	SHLQ       CX, R14                              // <--                                  // shl	r14, cl
+	MOVQ       R14, CX                              // <--                                  // mov	rcx, r14
+	SUBQ       $0x1, CX                             // <--                                  // sub	rcx, 1
+	KMOVQ      CX, K1                               // <--                                  // kmovq	k1, rcx
+	VMOVDQU8.Z 0(R11), K1, Z0                       // <--                                  // vmovdqu8	zmm0{k1}{z}, zmmword ptr [r11]
+	VMOVDQU8.Z 0(DX), K1, Z5                        // <--                                  // vmovdqu8	zmm5{k1}{z}, zmmword ptr [rdx]
+	VPADDB     Z3, Z0, Z4                           // <--                                  // vpaddb	zmm4, zmm0, zmm3
+	LONG       $0x485df362; WORD $0xca3e; BYTE $0x1 // VPCMPLTUB Z2, Z4, K1                 // vpcmpltub	k1, zmm4, zmm2
+	LONG       $0x48fdf162; WORD $0xe06f            // VMOVDQA64 Z0, Z4                     // vmovdqa64	zmm4, zmm0
+	VPADDB     Z1, Z0, K1, Z4                       // <--                                  // vpaddb	zmm4{k1}, zmm0, zmm1
+	LONG       $0x485df362; WORD $0xc53f; BYTE $0x4 // VPCMPNEQB Z5, Z4, K0                 // vpcmpneqb	k0, zmm4, zmm5
+	KORTESTQ   K0, K0                               // <--                                  // kortestq	k0, k0
+	JNE        LBB15_33                             // <--                                  // jne	.LBB15_33
+	JMP        LBB15_11                             // <--                                  // jmp	.LBB15_11
+
+LBB15_37:
+	LONG $0x487df162; WORD $0xc56f // VMOVDQA32 Z5, Z0                     // vmovdqa32	zmm0, zmm5
+	JMP  LBB15_8                   // <--                                  // jmp	.LBB15_8
+
+LBB15_38:
+	MOVQ R9, DX   // <--                                  // mov	rdx, r9
+	MOVQ R10, CX  // <--                                  // mov	rcx, r10
+	JMP  LBB15_36 // <--                                  // jmp	.LBB15_36
@@ -10,6 +10,9 @@ import (
 
 var benchSink int
 
+// indexFoldC is the rare-byte IndexFold kernel benchmarked by the shared tests.
+var indexFoldC = indexFoldNEONC
+
 // BenchmarkPureScan tests raw scan throughput without matches (best case).
 func BenchmarkPureScan(b *testing.B) {
 	sizes := []struct {
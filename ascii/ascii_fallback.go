@@ -300,13 +300,14 @@ func selectRarePairFull(pattern string, ranks []byte, caseSensitive bool) (rare1
 // Construct once with NewSearcher, then call Index on multiple haystacks.
 // Amortizes pattern analysis cost across many searches.
 type Searcher struct {
-	raw           string // original pattern
-	norm          string // lowercase pattern (for case-insensitive verification)
-	rare1         byte   // first rare byte (lowercase for case-insensitive)
-	off1          int    // offset in pattern
-	rare2         byte   // second rare byte (lowercase for case-insensitive)
-	off2          int    // offset in pattern
-	caseSensitive bool   // if true, use exact matching
+	raw           string   // original pattern
+	norm          string   // lowercase pattern (for case-insensitive verification)
+	rare1         byte     // first rare byte (lowercase for case-insensitive)
+	off1          int      // offset in pattern
+	rare2         byte     // second rare byte (lowercase for case-insensitive)
+	off2          int      // offset in pattern
+	caseSensitive bool     // if true, use exact matching
+	boundary      *CharSet // non-nil: whole-word matches only (see WholeWord)
 }
 
 // ByteRank exposes the default frequency table for ASCII bytes (read-only).
@@ -547,6 +548,30 @@ func indexFoldGo[T string | []byte](s T, substr T) int {
 	return -1
 }
 
+func lastIndexFoldGo(s, substr string) int {
+	if len(substr) == 0 {
+		return len(s)
+	} else if len(substr) > len(s) {
+		return -1
+	}
+
+	first := substr[0]
+	complement := first
+	if first >= 'A' && first <= 'Z' {
+		complement += 0x20
+	} else if first >= 'a' && first <= 'z' {
+		complement -= 0x20
+	}
+
+	for i := len(s) - len(substr); i >= 0; i-- {
+		b := s[i]
+		if (b == first || b == complement) && equalFoldGo(s[i:i+len(substr)], substr) {
+			return i
+		}
+	}
+	return -1
+}
+
 // indexFoldRabinKarpGo is a scalar Rabin-Karp for case-insensitive search.
 // Uses rolling hash with antisigma trick, calls into SIMD EqualFold for verification.
 // Kept for benchmarking comparison against SIMD implementations.
@@ -21,8 +21,8 @@ TEXT ·indexFoldNEON(SB), NOSPLIT, $0-72
 	MOVD  off1+24(FP), R3         // R3 = off1
 	MOVBU rare2+32(FP), R4        // R4 = rare2 byte (save for 2-byte mode)
 	MOVD  off2+40(FP), R5         // R5 = off2 (save for 2-byte mode)
-	MOVD  norm_needle+48(FP), R6  // R6 = needle ptr
-	MOVD  needle_len+56(FP), R7   // R7 = needle len
+	MOVD  normNeedle+48(FP), R6      // R6 = needle ptr
+	MOVD  normNeedle_len+56(FP), R7  // R7 = needle len
 
 	// Early exits
 	SUBS  R7, R1, R9              // R9 = searchLen = haystack_len - needle_len
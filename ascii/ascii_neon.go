@@ -8,13 +8,13 @@ package ascii
 func indexAnyNeonBitset(data string, bitset0 uint64, bitset1 uint64, bitset2 uint64, bitset3 uint64) int
 
 //go:noescape
-func ValidString(data string) bool
+func isAsciiNeon(data string) bool
 
 //go:noescape
-func IndexMask(data string, mask byte) int
+func indexMaskNeon(data string, mask byte) int
 
 //go:noescape
-func EqualFold(a string, b string) bool
+func equalFoldNeon(a string, b string) bool
 
 //go:noescape
 func indexFoldRabinKarp(haystack string, needle string) int
@@ -33,3 +33,12 @@ func indexFoldNEONC(haystack string, rare1 byte, off1 int, rare2 byte, off2 int,
 
 //go:noescape
 func SearchNeedleFold(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func lastIndexExactNEON(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func lastIndexFoldNEON(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+//go:noescape
+func lastSearchNeedleFoldNEON(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
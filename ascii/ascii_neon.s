@@ -92,9 +92,9 @@ LBB0_14:
 	MOVD R0, ret+48(FP) // <--
 	RET                 // <--                                  // ret
 
-TEXT ·ValidString(SB), NOSPLIT, $0-17
+TEXT ·isAsciiNeon(SB), NOSPLIT, $0-17
 	MOVD data+0(FP), R0
-	MOVD length+8(FP), R1
+	MOVD data_len+8(FP), R1
 	CMP  $16, R1          // <--                                  // cmp	x1, #16
 	BCC  LBB1_7           // <--                                  // b.lo	.LBB1_7
 	ADD  R1, R0, R9       // <--                                  // add	x9, x0, x1
@@ -181,9 +181,9 @@ LBB1_14:
 	MOVB R0, ret+16(FP) // <--
 	RET                 // <--                                  // ret
 
-TEXT ·IndexMask(SB), NOSPLIT, $0-32
+TEXT ·indexMaskNeon(SB), NOSPLIT, $0-32
 	MOVD data+0(FP), R0
-	MOVD length+8(FP), R1
+	MOVD data_len+8(FP), R1
 	MOVB mask+16(FP), R2
 	CMP  $16, R1          // <--                                  // cmp	x1, #16
 	BCC  LBB2_11          // <--                                  // b.lo	.LBB2_11
@@ -370,7 +370,7 @@ LBB2_34:
 	MOVD R0, ret+24(FP) // <--
 	RET                 // <--                                  // ret
 
-TEXT ·EqualFold(SB), NOSPLIT, $0-33
+TEXT ·equalFoldNeon(SB), NOSPLIT, $0-33
 	MOVD a+0(FP), R0
 	MOVD a_len+8(FP), R1
 	MOVD b+16(FP), R2
@@ -20665,3 +20665,1071 @@ LBB9_1276:
 LBB9_1277:
 	VMOV V4.D[0], V3.D[1] // <--                                  // mov	v3.d[1], v4.d[0]
 	JMP  LBB9_1245        // <--                                  // b	.LBB9_1245
+
+TEXT ·lastIndexExactNEON(SB), NOSPLIT, $0-72
+	MOVD haystack+0(FP), R0
+	MOVD haystack_len+8(FP), R1
+	MOVB rare1+16(FP), R2
+	MOVD off1+24(FP), R3
+	MOVB rare2+32(FP), R4
+	MOVD off2+40(FP), R5
+	MOVD needle+48(FP), R6
+	MOVD needle_len+56(FP), R7
+	SUBS R7, R1, R8             // <--                                  // subs	x8, x1, x7
+	BGE  LBB10_1                // <--                                  // b.ge	.LBB10_1
+	MOVD $-1, R0                // <--                                  // mov	x0, #-1
+	MOVD R0, ret+64(FP)         // <--
+	RET                         // <--                                  // ret
+
+LBB10_1:
+	CMP  $1, R7         // <--                                  // cmp	x7, #1
+	BGE  LBB10_2        // <--                                  // b.ge	.LBB10_2
+	MOVD R1, R0         // <--                                  // mov	x0, x1
+	MOVD R0, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB10_2:
+	ADD  $1, R8, R8      // <--                                  // add	x8, x8, #1
+	ANDW $255, R2, R2    // <--                                  // and	w2, w2, #0xff
+	ANDW $255, R4, R4    // <--                                  // and	w4, w4, #0xff
+	MOVD R8, R9          // <--                                  // mov	x9, x8
+	MOVD ZR, R10         // <--                                  // mov	x10, xzr
+	ADD  R3, R0, R11     // <--                                  // add	x11, x0, x3
+	VDUP R2, V1.B16      // <--                                  // dup	v1.16b, w2
+	CMP  R5, R3          // <--                                  // cmp	x3, x5
+	CSEL GT, R3, R5, R15 // <--                                  // csel	x15, x3, x5, gt
+	SUB  R15, R1, R15    // <--                                  // sub	x15, x1, x15
+	SUB  $16, R15, R15   // <--                                  // sub	x15, x15, #16
+
+LBB10_3:
+	CMP   $64, R9                // <--                                  // cmp	x9, #64
+	BLT   LBB10_4                // <--                                  // b.lt	.LBB10_4
+	ADD   R9, R11, R12           // <--                                  // add	x12, x11, x9
+	WORD  $0xad7e1584            // FLDPQ -64(R12), (F4, F5)             // ldp	q4, q5, [x12, #-64]
+	WORD  $0xad7f1d86            // FLDPQ -32(R12), (F6, F7)             // ldp	q6, q7, [x12, #-32]
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	VCMEQ V1.B16, V5.B16, V5.B16 // <--                                  // cmeq	v5.16b, v5.16b, v1.16b
+	VCMEQ V1.B16, V6.B16, V6.B16 // <--                                  // cmeq	v6.16b, v6.16b, v1.16b
+	VCMEQ V1.B16, V7.B16, V7.B16 // <--                                  // cmeq	v7.16b, v7.16b, v1.16b
+	VORR  V5.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v5.16b
+	VORR  V7.B16, V6.B16, V6.B16 // <--                                  // orr	v6.16b, v6.16b, v7.16b
+	VORR  V6.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v6.16b
+	WORD  $0x4ee4bc84            // VADDP V4.D2, V4.D2, V4.D2            // addp	v4.2d, v4.2d, v4.2d
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	CBNZ  R12, LBB10_4           // <--                                  // cbnz	x12, .LBB10_4
+	SUB   $64, R9, R9            // <--                                  // sub	x9, x9, #64
+	JMP   LBB10_3                // <--                                  // b	.LBB10_3
+
+LBB10_4:
+	CMP   $16, R9                // <--                                  // cmp	x9, #16
+	BLT   LBB10_5                // <--                                  // b.lt	.LBB10_5
+	SUB   $16, R9, R13           // <--                                  // sub	x13, x9, #16
+	WORD  $0x3ced6964            // FMOVQ (R11)(R13), F4                 // ldr	q4, [x11, x13]
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	WORD  $0x0f0c8484            // VSHRN $4, V4.H8, V4.B8               // shrn	v4.8b, v4.8h, #4
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	JMP   LBB10_9                // <--                                  // b	.LBB10_9
+
+LBB10_5:
+	CMP   $1, R9                 // <--                                  // cmp	x9, #1
+	BLT   LBB10_33               // <--                                  // b.lt	.LBB10_33
+	MOVD  ZR, R13                // <--                                  // mov	x13, xzr
+	TBNZ  $63, R15, LBB10_6      // <--                                  // tbnz	x15, #63, .LBB10_6
+	WORD  $0x3dc00164            // FMOVQ (R11), F4                      // ldr	q4, [x11]
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	WORD  $0x0f0c8484            // VSHRN $4, V4.H8, V4.B8               // shrn	v4.8b, v4.8h, #4
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	LSL   $2, R9, R14            // <--                                  // lsl	x14, x9, #2
+	WORD  $0xd2800031            // MOVD $1, R17                         // mov	x17, #1
+	LSL   R14, R17, R17          // <--                                  // lsl	x17, x17, x14
+	SUB   $1, R17, R17           // <--                                  // sub	x17, x17, #1
+	AND   R17, R12, R12          // <--                                  // and	x12, x12, x17
+	JMP   LBB10_9                // <--                                  // b	.LBB10_9
+
+LBB10_6:
+	MOVD ZR, R12 // <--                                  // mov	x12, xzr
+	MOVD ZR, R14 // <--                                  // mov	x14, xzr
+
+LBB10_7:
+	WORD $0x386e6971   // MOVBU (R11)(R14), R17                // ldrb	w17, [x11, x14]
+	CMPW R2, R17       // <--                                  // cmp	w17, w2
+	BNE  LBB10_8       // <--                                  // b.ne	.LBB10_8
+	LSL  $2, R14, R17  // <--                                  // lsl	x17, x14, #2
+	WORD $0xd28001f8   // MOVD $15, R24                        // mov	x24, #15
+	LSL  R17, R24, R24 // <--                                  // lsl	x24, x24, x17
+	ORR  R24, R12, R12 // <--                                  // orr	x12, x12, x24
+
+LBB10_8:
+	ADD $1, R14, R14 // <--                                  // add	x14, x14, #1
+	CMP R9, R14      // <--                                  // cmp	x14, x9
+	BLT LBB10_7      // <--                                  // b.lt	.LBB10_7
+
+LBB10_9:
+	CBZ  R12, LBB10_11    // <--                                  // cbz	x12, .LBB10_11
+	CLZ  R12, R14         // <--                                  // clz	x14, x12
+	EOR  $63, R14, R14    // <--                                  // eor	x14, x14, #0x3f
+	ADD  R14>>2, R13, R14 // <--                                  // add	x14, x13, x14, lsr #2
+	MOVD ZR, R17          // <--                                  // mov	x17, xzr
+	JMP  LBB10_27         // <--                                  // b	.LBB10_27
+
+LBB10_10:
+	ADD  $1, R10, R10  // <--                                  // add	x10, x10, #1
+	SUB  R14, R8, R17  // <--                                  // sub	x17, x8, x14
+	ASR  $8, R17, R17  // <--                                  // asr	x17, x17, #8
+	ADD  $4, R17, R17  // <--                                  // add	x17, x17, #4
+	CMP  R17, R10      // <--                                  // cmp	x10, x17
+	BGT  LBB10_12      // <--                                  // b.gt	.LBB10_12
+	SUB  R13, R14, R17 // <--                                  // sub	x17, x14, x13
+	LSL  $2, R17, R17  // <--                                  // lsl	x17, x17, #2
+	WORD $0xd2800038   // MOVD $1, R24                         // mov	x24, #1
+	LSL  R17, R24, R24 // <--                                  // lsl	x24, x24, x17
+	SUB  $1, R24, R24  // <--                                  // sub	x24, x24, #1
+	AND  R24, R12, R12 // <--                                  // and	x12, x12, x24
+	JMP  LBB10_9       // <--                                  // b	.LBB10_9
+
+LBB10_11:
+	MOVD R13, R9 // <--                                  // mov	x9, x13
+	JMP  LBB10_3 // <--                                  // b	.LBB10_3
+
+LBB10_12:
+	MOVD R14, R9           // <--                                  // mov	x9, x14
+	ADD  R5, R0, R16       // <--                                  // add	x16, x0, x5
+	VDUP R4, V3.B16        // <--                                  // dup	v3.16b, w4
+	MOVD ZR, R10           // <--                                  // mov	x10, xzr
+	WORD $0xd280010c       // MOVD $8, R12                         // mov	x12, #8
+	WORD $0xd280008d       // MOVD $4, R13                         // mov	x13, #4
+	CMP  $63, R7           // <--                                  // cmp	x7, #63
+	CSEL GT, R13, R12, R19 // <--                                  // csel	x19, x13, x12, gt
+
+LBB10_13:
+	CMP   $16, R9                // <--                                  // cmp	x9, #16
+	BLT   LBB10_14               // <--                                  // b.lt	.LBB10_14
+	SUB   $16, R9, R13           // <--                                  // sub	x13, x9, #16
+	WORD  $0x3ced6964            // FMOVQ (R11)(R13), F4                 // ldr	q4, [x11, x13]
+	WORD  $0x3ced6a05            // FMOVQ (R16)(R13), F5                 // ldr	q5, [x16, x13]
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	VCMEQ V3.B16, V5.B16, V5.B16 // <--                                  // cmeq	v5.16b, v5.16b, v3.16b
+	VAND  V5.B16, V4.B16, V4.B16 // <--                                  // and	v4.16b, v4.16b, v5.16b
+	WORD  $0x0f0c8484            // VSHRN $4, V4.H8, V4.B8               // shrn	v4.8b, v4.8h, #4
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	JMP   LBB10_18               // <--                                  // b	.LBB10_18
+
+LBB10_14:
+	CMP   $1, R9                 // <--                                  // cmp	x9, #1
+	BLT   LBB10_33               // <--                                  // b.lt	.LBB10_33
+	MOVD  ZR, R13                // <--                                  // mov	x13, xzr
+	TBNZ  $63, R15, LBB10_15     // <--                                  // tbnz	x15, #63, .LBB10_15
+	WORD  $0x3dc00164            // FMOVQ (R11), F4                      // ldr	q4, [x11]
+	WORD  $0x3dc00205            // FMOVQ (R16), F5                      // ldr	q5, [x16]
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	VCMEQ V3.B16, V5.B16, V5.B16 // <--                                  // cmeq	v5.16b, v5.16b, v3.16b
+	VAND  V5.B16, V4.B16, V4.B16 // <--                                  // and	v4.16b, v4.16b, v5.16b
+	WORD  $0x0f0c8484            // VSHRN $4, V4.H8, V4.B8               // shrn	v4.8b, v4.8h, #4
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	LSL   $2, R9, R14            // <--                                  // lsl	x14, x9, #2
+	WORD  $0xd2800031            // MOVD $1, R17                         // mov	x17, #1
+	LSL   R14, R17, R17          // <--                                  // lsl	x17, x17, x14
+	SUB   $1, R17, R17           // <--                                  // sub	x17, x17, #1
+	AND   R17, R12, R12          // <--                                  // and	x12, x12, x17
+	JMP   LBB10_18               // <--                                  // b	.LBB10_18
+
+LBB10_15:
+	MOVD ZR, R12 // <--                                  // mov	x12, xzr
+	MOVD ZR, R14 // <--                                  // mov	x14, xzr
+
+LBB10_16:
+	WORD $0x386e6971   // MOVBU (R11)(R14), R17                // ldrb	w17, [x11, x14]
+	CMPW R2, R17       // <--                                  // cmp	w17, w2
+	BNE  LBB10_17      // <--                                  // b.ne	.LBB10_17
+	WORD $0x386e6a11   // MOVBU (R16)(R14), R17                // ldrb	w17, [x16, x14]
+	CMPW R4, R17       // <--                                  // cmp	w17, w4
+	BNE  LBB10_17      // <--                                  // b.ne	.LBB10_17
+	LSL  $2, R14, R17  // <--                                  // lsl	x17, x14, #2
+	WORD $0xd28001f8   // MOVD $15, R24                        // mov	x24, #15
+	LSL  R17, R24, R24 // <--                                  // lsl	x24, x24, x17
+	ORR  R24, R12, R12 // <--                                  // orr	x12, x12, x24
+
+LBB10_17:
+	ADD $1, R14, R14 // <--                                  // add	x14, x14, #1
+	CMP R9, R14      // <--                                  // cmp	x14, x9
+	BLT LBB10_16     // <--                                  // b.lt	.LBB10_16
+
+LBB10_18:
+	CBZ  R12, LBB10_20    // <--                                  // cbz	x12, .LBB10_20
+	CLZ  R12, R14         // <--                                  // clz	x14, x12
+	EOR  $63, R14, R14    // <--                                  // eor	x14, x14, #0x3f
+	ADD  R14>>2, R13, R14 // <--                                  // add	x14, x13, x14, lsr #2
+	WORD $0xd2800031      // MOVD $1, R17                         // mov	x17, #1
+	JMP  LBB10_27         // <--                                  // b	.LBB10_27
+
+LBB10_19:
+	ADD  $1, R10, R10  // <--                                  // add	x10, x10, #1
+	CMP  R19, R10      // <--                                  // cmp	x10, x19
+	BGT  LBB10_21      // <--                                  // b.gt	.LBB10_21
+	SUB  R13, R14, R17 // <--                                  // sub	x17, x14, x13
+	LSL  $2, R17, R17  // <--                                  // lsl	x17, x17, #2
+	WORD $0xd2800038   // MOVD $1, R24                         // mov	x24, #1
+	LSL  R17, R24, R24 // <--                                  // lsl	x24, x24, x17
+	SUB  $1, R24, R24  // <--                                  // sub	x24, x24, #1
+	AND  R24, R12, R12 // <--                                  // and	x12, x12, x24
+	JMP  LBB10_18      // <--                                  // b	.LBB10_18
+
+LBB10_20:
+	MOVD R13, R9  // <--                                  // mov	x9, x13
+	JMP  LBB10_13 // <--                                  // b	.LBB10_13
+
+LBB10_21:
+	CMP  $1, R14      // <--                                  // cmp	x14, #1
+	BLT  LBB10_33     // <--                                  // b.lt	.LBB10_33
+	SUB  $1, R14, R14 // <--                                  // sub	x14, x14, #1
+	MOVW $403, R3     // <--                                  // mov	w3, #403
+	WORD $0x72a02003  // MOVKW $(256<<16), R3                 // movk	w3, #256, lsl #16
+	WORD $0x52800033  // MOVW $1, R19                         // mov	w19, #1
+	WORD $0x2a0303ed  // MOVW R3, R13                         // mov	w13, w3
+	MOVD R7, R12      // <--                                  // mov	x12, x7
+
+LBB10_22:
+	TBZ  $0, R12, LBB10_23 // <--                                  // tbz	w12, #0, .LBB10_23
+	MULW R13, R19, R19     // <--                                  // mul	w19, w19, w13
+
+LBB10_23:
+	MULW R13, R13, R13 // <--                                  // mul	w13, w13, w13
+	LSR  $1, R12, R12  // <--                                  // lsr	x12, x12, #1
+	CBNZ R12, LBB10_22 // <--                                  // cbnz	x12, .LBB10_22
+	MOVW ZR, R5        // <--                                  // mov	w5, wzr
+	MOVW ZR, R12       // <--                                  // mov	w12, wzr
+	SUB  $1, R7, R13   // <--                                  // sub	x13, x7, #1
+	ADD  R14, R0, R16  // <--                                  // add	x16, x0, x14
+
+LBB10_24:
+	WORD  $0x386d68d7       // MOVBU (R6)(R13), R23                 // ldrb	w23, [x6, x13]
+	MADDW R3, R23, R5, R5   // <--                                  // madd	w5, w5, w3, w23
+	WORD  $0x386d6a17       // MOVBU (R16)(R13), R23                // ldrb	w23, [x16, x13]
+	MADDW R3, R23, R12, R12 // <--                                  // madd	w12, w12, w3, w23
+	SUBS  $1, R13, R13      // <--                                  // subs	x13, x13, #1
+	BGE   LBB10_24          // <--                                  // b.ge	.LBB10_24
+
+LBB10_25:
+	CMPW R5, R12     // <--                                  // cmp	w12, w5
+	BNE  LBB10_26    // <--                                  // b.ne	.LBB10_26
+	WORD $0xd2800051 // MOVD $2, R17                         // mov	x17, #2
+	JMP  LBB10_27    // <--                                  // b	.LBB10_27
+
+LBB10_26:
+	CBZ   R14, LBB10_33      // <--                                  // cbz	x14, .LBB10_33
+	SUB   $1, R14, R14       // <--                                  // sub	x14, x14, #1
+	WORD  $0x386e6817        // MOVBU (R0)(R14), R23                 // ldrb	w23, [x0, x14]
+	MADDW R3, R23, R12, R12  // <--                                  // madd	w12, w12, w3, w23
+	ADD   R7, R14, R13       // <--                                  // add	x13, x14, x7
+	WORD  $0x386d6817        // MOVBU (R0)(R13), R23                 // ldrb	w23, [x0, x13]
+	MSUBW R23, R12, R19, R12 // <--                                  // msub	w12, w19, w23, w12
+	JMP   LBB10_25           // <--                                  // b	.LBB10_25
+
+LBB10_27:
+	ADD  R14, R0, R20 // <--                                  // add	x20, x0, x14
+	CMP  $16, R7      // <--                                  // cmp	x7, #16
+	BLT  LBB10_29     // <--                                  // b.lt	.LBB10_29
+	MOVD R6, R21      // <--                                  // mov	x21, x6
+	MOVD R7, R22      // <--                                  // mov	x22, x7
+
+LBB10_28:
+	WORD  $0x3dc00290               // FMOVQ (R20), F16                     // ldr	q16, [x20]
+	WORD  $0x3dc002b1               // FMOVQ (R21), F17                     // ldr	q17, [x21]
+	VEOR  V17.B16, V16.B16, V16.B16 // <--                                  // eor	v16.16b, v16.16b, v17.16b
+	WORD  $0x6e30aa10               // VUMAXV V16.B16, V16                  // umaxv	b16, v16.16b
+	FMOVS F16, R24                  // <--                                  // fmov	w24, s16
+	CBNZW R24, LBB10_31             // <--                                  // cbnz	w24, .LBB10_31
+	ADD   $16, R20, R20             // <--                                  // add	x20, x20, #16
+	ADD   $16, R21, R21             // <--                                  // add	x21, x21, #16
+	SUB   $16, R22, R22             // <--                                  // sub	x22, x22, #16
+	CMP   $16, R22                  // <--                                  // cmp	x22, #16
+	BGE   LBB10_28                  // <--                                  // b.ge	.LBB10_28
+	CBZ   R22, LBB10_32             // <--                                  // cbz	x22, .LBB10_32
+	ADD   R22, R20, R20             // <--                                  // add	x20, x20, x22
+	ADD   R22, R21, R21             // <--                                  // add	x21, x21, x22
+	WORD  $0x3cdf0290               // FMOVQ -16(R20), F16                  // ldur	q16, [x20, #-16]
+	WORD  $0x3cdf02b1               // FMOVQ -16(R21), F17                  // ldur	q17, [x21, #-16]
+	VEOR  V17.B16, V16.B16, V16.B16 // <--                                  // eor	v16.16b, v16.16b, v17.16b
+	WORD  $0x6e30aa10               // VUMAXV V16.B16, V16                  // umaxv	b16, v16.16b
+	FMOVS F16, R24                  // <--                                  // fmov	w24, s16
+	CBNZW R24, LBB10_31             // <--                                  // cbnz	w24, .LBB10_31
+	JMP   LBB10_32                  // <--                                  // b	.LBB10_32
+
+LBB10_29:
+	MOVD ZR, R22 // <--                                  // mov	x22, xzr
+
+LBB10_30:
+	CMP  R7, R22      // <--                                  // cmp	x22, x7
+	BGE  LBB10_32     // <--                                  // b.ge	.LBB10_32
+	WORD $0x38766a97  // MOVBU (R20)(R22), R23                // ldrb	w23, [x20, x22]
+	WORD $0x387668d8  // MOVBU (R6)(R22), R24                 // ldrb	w24, [x6, x22]
+	CMPW R24, R23     // <--                                  // cmp	w23, w24
+	BNE  LBB10_31     // <--                                  // b.ne	.LBB10_31
+	ADD  $1, R22, R22 // <--                                  // add	x22, x22, #1
+	JMP  LBB10_30     // <--                                  // b	.LBB10_30
+
+LBB10_31:
+	CBZ R17, LBB10_10 // <--                                  // cbz	x17, .LBB10_10
+	CMP $1, R17       // <--                                  // cmp	x17, #1
+	BEQ LBB10_19      // <--                                  // b.eq	.LBB10_19
+	JMP LBB10_26      // <--                                  // b	.LBB10_26
+
+LBB10_32:
+	MOVD R14, R0        // <--                                  // mov	x0, x14
+	MOVD R0, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB10_33:
+	MOVD $-1, R0        // <--                                  // mov	x0, #-1
+	MOVD R0, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+TEXT ·lastIndexFoldNEON(SB), NOSPLIT, $0-72
+	MOVD haystack+0(FP), R0
+	MOVD haystack_len+8(FP), R1
+	MOVB rare1+16(FP), R2
+	MOVD off1+24(FP), R3
+	MOVB rare2+32(FP), R4
+	MOVD off2+40(FP), R5
+	MOVD needle+48(FP), R6
+	MOVD needle_len+56(FP), R7
+	SUBS R7, R1, R8             // <--                                  // subs	x8, x1, x7
+	BGE  LBB11_1                // <--                                  // b.ge	.LBB11_1
+	MOVD $-1, R0                // <--                                  // mov	x0, #-1
+	MOVD R0, ret+64(FP)         // <--
+	RET                         // <--                                  // ret
+
+LBB11_1:
+	CMP  $1, R7         // <--                                  // cmp	x7, #1
+	BGE  LBB11_2        // <--                                  // b.ge	.LBB11_2
+	MOVD R1, R0         // <--                                  // mov	x0, x1
+	MOVD R0, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB11_2:
+	ADD   $1, R8, R8       // <--                                  // add	x8, x8, #1
+	ANDW  $255, R2, R2     // <--                                  // and	w2, w2, #0xff
+	ANDW  $255, R4, R4     // <--                                  // and	w4, w4, #0xff
+	MOVD  R8, R9           // <--                                  // mov	x9, x8
+	MOVD  ZR, R10          // <--                                  // mov	x10, xzr
+	ADD   R3, R0, R11      // <--                                  // add	x11, x0, x3
+	SUBW  $97, R2, R12     // <--                                  // sub	w12, w2, #97
+	WORD  $0x5280040d      // MOVW $32, R13                        // mov	w13, #32
+	CMPW  $26, R12         // <--                                  // cmp	w12, #26
+	CSELW LO, R13, ZR, R25 // <--                                  // csel	w25, w13, wzr, lo
+	VDUP  R25, V0.B16      // <--                                  // dup	v0.16b, w25
+	VDUP  R2, V1.B16       // <--                                  // dup	v1.16b, w2
+	CMP   R5, R3           // <--                                  // cmp	x3, x5
+	CSEL  GT, R3, R5, R15  // <--                                  // csel	x15, x3, x5, gt
+	SUB   R15, R1, R15     // <--                                  // sub	x15, x1, x15
+	SUB   $16, R15, R15    // <--                                  // sub	x15, x15, #16
+	WORD  $0x4f01e414      // VMOVI $32, V20.B16                   // movi	v20.16b, #32
+	WORD  $0x4f04e7f5      // VMOVI $159, V21.B16                  // movi	v21.16b, #159
+	WORD  $0x4f00e756      // VMOVI $26, V22.B16                   // movi	v22.16b, #26
+
+LBB11_3:
+	CMP   $64, R9                // <--                                  // cmp	x9, #64
+	BLT   LBB11_4                // <--                                  // b.lt	.LBB11_4
+	ADD   R9, R11, R12           // <--                                  // add	x12, x11, x9
+	WORD  $0xad7e1584            // FLDPQ -64(R12), (F4, F5)             // ldp	q4, q5, [x12, #-64]
+	WORD  $0xad7f1d86            // FLDPQ -32(R12), (F6, F7)             // ldp	q6, q7, [x12, #-32]
+	VORR  V0.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v0.16b
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	VORR  V0.B16, V5.B16, V5.B16 // <--                                  // orr	v5.16b, v5.16b, v0.16b
+	VCMEQ V1.B16, V5.B16, V5.B16 // <--                                  // cmeq	v5.16b, v5.16b, v1.16b
+	VORR  V0.B16, V6.B16, V6.B16 // <--                                  // orr	v6.16b, v6.16b, v0.16b
+	VCMEQ V1.B16, V6.B16, V6.B16 // <--                                  // cmeq	v6.16b, v6.16b, v1.16b
+	VORR  V0.B16, V7.B16, V7.B16 // <--                                  // orr	v7.16b, v7.16b, v0.16b
+	VCMEQ V1.B16, V7.B16, V7.B16 // <--                                  // cmeq	v7.16b, v7.16b, v1.16b
+	VORR  V5.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v5.16b
+	VORR  V7.B16, V6.B16, V6.B16 // <--                                  // orr	v6.16b, v6.16b, v7.16b
+	VORR  V6.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v6.16b
+	WORD  $0x4ee4bc84            // VADDP V4.D2, V4.D2, V4.D2            // addp	v4.2d, v4.2d, v4.2d
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	CBNZ  R12, LBB11_4           // <--                                  // cbnz	x12, .LBB11_4
+	SUB   $64, R9, R9            // <--                                  // sub	x9, x9, #64
+	JMP   LBB11_3                // <--                                  // b	.LBB11_3
+
+LBB11_4:
+	CMP   $16, R9                // <--                                  // cmp	x9, #16
+	BLT   LBB11_5                // <--                                  // b.lt	.LBB11_5
+	SUB   $16, R9, R13           // <--                                  // sub	x13, x9, #16
+	WORD  $0x3ced6964            // FMOVQ (R11)(R13), F4                 // ldr	q4, [x11, x13]
+	VORR  V0.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v0.16b
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	WORD  $0x0f0c8484            // VSHRN $4, V4.H8, V4.B8               // shrn	v4.8b, v4.8h, #4
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	JMP   LBB11_9                // <--                                  // b	.LBB11_9
+
+LBB11_5:
+	CMP   $1, R9                 // <--                                  // cmp	x9, #1
+	BLT   LBB11_34               // <--                                  // b.lt	.LBB11_34
+	MOVD  ZR, R13                // <--                                  // mov	x13, xzr
+	TBNZ  $63, R15, LBB11_6      // <--                                  // tbnz	x15, #63, .LBB11_6
+	WORD  $0x3dc00164            // FMOVQ (R11), F4                      // ldr	q4, [x11]
+	VORR  V0.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v0.16b
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	WORD  $0x0f0c8484            // VSHRN $4, V4.H8, V4.B8               // shrn	v4.8b, v4.8h, #4
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	LSL   $2, R9, R14            // <--                                  // lsl	x14, x9, #2
+	WORD  $0xd2800031            // MOVD $1, R17                         // mov	x17, #1
+	LSL   R14, R17, R17          // <--                                  // lsl	x17, x17, x14
+	SUB   $1, R17, R17           // <--                                  // sub	x17, x17, #1
+	AND   R17, R12, R12          // <--                                  // and	x12, x12, x17
+	JMP   LBB11_9                // <--                                  // b	.LBB11_9
+
+LBB11_6:
+	MOVD ZR, R12 // <--                                  // mov	x12, xzr
+	MOVD ZR, R14 // <--                                  // mov	x14, xzr
+
+LBB11_7:
+	WORD $0x386e6971   // MOVBU (R11)(R14), R17                // ldrb	w17, [x11, x14]
+	ORRW R25, R17, R17 // <--                                  // orr	w17, w17, w25
+	CMPW R2, R17       // <--                                  // cmp	w17, w2
+	BNE  LBB11_8       // <--                                  // b.ne	.LBB11_8
+	LSL  $2, R14, R17  // <--                                  // lsl	x17, x14, #2
+	WORD $0xd28001f8   // MOVD $15, R24                        // mov	x24, #15
+	LSL  R17, R24, R24 // <--                                  // lsl	x24, x24, x17
+	ORR  R24, R12, R12 // <--                                  // orr	x12, x12, x24
+
+LBB11_8:
+	ADD $1, R14, R14 // <--                                  // add	x14, x14, #1
+	CMP R9, R14      // <--                                  // cmp	x14, x9
+	BLT LBB11_7      // <--                                  // b.lt	.LBB11_7
+
+LBB11_9:
+	CBZ  R12, LBB11_11    // <--                                  // cbz	x12, .LBB11_11
+	CLZ  R12, R14         // <--                                  // clz	x14, x12
+	EOR  $63, R14, R14    // <--                                  // eor	x14, x14, #0x3f
+	ADD  R14>>2, R13, R14 // <--                                  // add	x14, x13, x14, lsr #2
+	MOVD ZR, R17          // <--                                  // mov	x17, xzr
+	JMP  LBB11_27         // <--                                  // b	.LBB11_27
+
+LBB11_10:
+	ADD  $1, R10, R10  // <--                                  // add	x10, x10, #1
+	SUB  R14, R8, R17  // <--                                  // sub	x17, x8, x14
+	ASR  $8, R17, R17  // <--                                  // asr	x17, x17, #8
+	ADD  $4, R17, R17  // <--                                  // add	x17, x17, #4
+	CMP  R17, R10      // <--                                  // cmp	x10, x17
+	BGT  LBB11_12      // <--                                  // b.gt	.LBB11_12
+	SUB  R13, R14, R17 // <--                                  // sub	x17, x14, x13
+	LSL  $2, R17, R17  // <--                                  // lsl	x17, x17, #2
+	WORD $0xd2800038   // MOVD $1, R24                         // mov	x24, #1
+	LSL  R17, R24, R24 // <--                                  // lsl	x24, x24, x17
+	SUB  $1, R24, R24  // <--                                  // sub	x24, x24, #1
+	AND  R24, R12, R12 // <--                                  // and	x12, x12, x24
+	JMP  LBB11_9       // <--                                  // b	.LBB11_9
+
+LBB11_11:
+	MOVD R13, R9 // <--                                  // mov	x9, x13
+	JMP  LBB11_3 // <--                                  // b	.LBB11_3
+
+LBB11_12:
+	MOVD  R14, R9           // <--                                  // mov	x9, x14
+	ADD   R5, R0, R16       // <--                                  // add	x16, x0, x5
+	SUBW  $97, R4, R12      // <--                                  // sub	w12, w4, #97
+	WORD  $0x5280040d       // MOVW $32, R13                        // mov	w13, #32
+	CMPW  $26, R12          // <--                                  // cmp	w12, #26
+	CSELW LO, R13, ZR, R26  // <--                                  // csel	w26, w13, wzr, lo
+	VDUP  R26, V2.B16       // <--                                  // dup	v2.16b, w26
+	VDUP  R4, V3.B16        // <--                                  // dup	v3.16b, w4
+	MOVD  ZR, R10           // <--                                  // mov	x10, xzr
+	WORD  $0xd280010c       // MOVD $8, R12                         // mov	x12, #8
+	WORD  $0xd280008d       // MOVD $4, R13                         // mov	x13, #4
+	CMP   $63, R7           // <--                                  // cmp	x7, #63
+	CSEL  GT, R13, R12, R19 // <--                                  // csel	x19, x13, x12, gt
+
+LBB11_13:
+	CMP   $16, R9                // <--                                  // cmp	x9, #16
+	BLT   LBB11_14               // <--                                  // b.lt	.LBB11_14
+	SUB   $16, R9, R13           // <--                                  // sub	x13, x9, #16
+	WORD  $0x3ced6964            // FMOVQ (R11)(R13), F4                 // ldr	q4, [x11, x13]
+	WORD  $0x3ced6a05            // FMOVQ (R16)(R13), F5                 // ldr	q5, [x16, x13]
+	VORR  V0.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v0.16b
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	VORR  V2.B16, V5.B16, V5.B16 // <--                                  // orr	v5.16b, v5.16b, v2.16b
+	VCMEQ V3.B16, V5.B16, V5.B16 // <--                                  // cmeq	v5.16b, v5.16b, v3.16b
+	VAND  V5.B16, V4.B16, V4.B16 // <--                                  // and	v4.16b, v4.16b, v5.16b
+	WORD  $0x0f0c8484            // VSHRN $4, V4.H8, V4.B8               // shrn	v4.8b, v4.8h, #4
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	JMP   LBB11_18               // <--                                  // b	.LBB11_18
+
+LBB11_14:
+	CMP   $1, R9                 // <--                                  // cmp	x9, #1
+	BLT   LBB11_34               // <--                                  // b.lt	.LBB11_34
+	MOVD  ZR, R13                // <--                                  // mov	x13, xzr
+	TBNZ  $63, R15, LBB11_15     // <--                                  // tbnz	x15, #63, .LBB11_15
+	WORD  $0x3dc00164            // FMOVQ (R11), F4                      // ldr	q4, [x11]
+	WORD  $0x3dc00205            // FMOVQ (R16), F5                      // ldr	q5, [x16]
+	VORR  V0.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v0.16b
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	VORR  V2.B16, V5.B16, V5.B16 // <--                                  // orr	v5.16b, v5.16b, v2.16b
+	VCMEQ V3.B16, V5.B16, V5.B16 // <--                                  // cmeq	v5.16b, v5.16b, v3.16b
+	VAND  V5.B16, V4.B16, V4.B16 // <--                                  // and	v4.16b, v4.16b, v5.16b
+	WORD  $0x0f0c8484            // VSHRN $4, V4.H8, V4.B8               // shrn	v4.8b, v4.8h, #4
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	LSL   $2, R9, R14            // <--                                  // lsl	x14, x9, #2
+	WORD  $0xd2800031            // MOVD $1, R17                         // mov	x17, #1
+	LSL   R14, R17, R17          // <--                                  // lsl	x17, x17, x14
+	SUB   $1, R17, R17           // <--                                  // sub	x17, x17, #1
+	AND   R17, R12, R12          // <--                                  // and	x12, x12, x17
+	JMP   LBB11_18               // <--                                  // b	.LBB11_18
+
+LBB11_15:
+	MOVD ZR, R12 // <--                                  // mov	x12, xzr
+	MOVD ZR, R14 // <--                                  // mov	x14, xzr
+
+LBB11_16:
+	WORD $0x386e6971   // MOVBU (R11)(R14), R17                // ldrb	w17, [x11, x14]
+	ORRW R25, R17, R17 // <--                                  // orr	w17, w17, w25
+	CMPW R2, R17       // <--                                  // cmp	w17, w2
+	BNE  LBB11_17      // <--                                  // b.ne	.LBB11_17
+	WORD $0x386e6a11   // MOVBU (R16)(R14), R17                // ldrb	w17, [x16, x14]
+	ORRW R26, R17, R17 // <--                                  // orr	w17, w17, w26
+	CMPW R4, R17       // <--                                  // cmp	w17, w4
+	BNE  LBB11_17      // <--                                  // b.ne	.LBB11_17
+	LSL  $2, R14, R17  // <--                                  // lsl	x17, x14, #2
+	WORD $0xd28001f8   // MOVD $15, R24                        // mov	x24, #15
+	LSL  R17, R24, R24 // <--                                  // lsl	x24, x24, x17
+	ORR  R24, R12, R12 // <--                                  // orr	x12, x12, x24
+
+LBB11_17:
+	ADD $1, R14, R14 // <--                                  // add	x14, x14, #1
+	CMP R9, R14      // <--                                  // cmp	x14, x9
+	BLT LBB11_16     // <--                                  // b.lt	.LBB11_16
+
+LBB11_18:
+	CBZ  R12, LBB11_20    // <--                                  // cbz	x12, .LBB11_20
+	CLZ  R12, R14         // <--                                  // clz	x14, x12
+	EOR  $63, R14, R14    // <--                                  // eor	x14, x14, #0x3f
+	ADD  R14>>2, R13, R14 // <--                                  // add	x14, x13, x14, lsr #2
+	WORD $0xd2800031      // MOVD $1, R17                         // mov	x17, #1
+	JMP  LBB11_27         // <--                                  // b	.LBB11_27
+
+LBB11_19:
+	ADD  $1, R10, R10  // <--                                  // add	x10, x10, #1
+	CMP  R19, R10      // <--                                  // cmp	x10, x19
+	BGT  LBB11_21      // <--                                  // b.gt	.LBB11_21
+	SUB  R13, R14, R17 // <--                                  // sub	x17, x14, x13
+	LSL  $2, R17, R17  // <--                                  // lsl	x17, x17, #2
+	WORD $0xd2800038   // MOVD $1, R24                         // mov	x24, #1
+	LSL  R17, R24, R24 // <--                                  // lsl	x24, x24, x17
+	SUB  $1, R24, R24  // <--                                  // sub	x24, x24, #1
+	AND  R24, R12, R12 // <--                                  // and	x12, x12, x24
+	JMP  LBB11_18      // <--                                  // b	.LBB11_18
+
+LBB11_20:
+	MOVD R13, R9  // <--                                  // mov	x9, x13
+	JMP  LBB11_13 // <--                                  // b	.LBB11_13
+
+LBB11_21:
+	CMP  $1, R14      // <--                                  // cmp	x14, #1
+	BLT  LBB11_34     // <--                                  // b.lt	.LBB11_34
+	SUB  $1, R14, R14 // <--                                  // sub	x14, x14, #1
+	MOVW $403, R3     // <--                                  // mov	w3, #403
+	WORD $0x72a02003  // MOVKW $(256<<16), R3                 // movk	w3, #256, lsl #16
+	WORD $0x52800033  // MOVW $1, R19                         // mov	w19, #1
+	WORD $0x2a0303ed  // MOVW R3, R13                         // mov	w13, w3
+	MOVD R7, R12      // <--                                  // mov	x12, x7
+
+LBB11_22:
+	TBZ  $0, R12, LBB11_23 // <--                                  // tbz	w12, #0, .LBB11_23
+	MULW R13, R19, R19     // <--                                  // mul	w19, w19, w13
+
+LBB11_23:
+	MULW R13, R13, R13 // <--                                  // mul	w13, w13, w13
+	LSR  $1, R12, R12  // <--                                  // lsr	x12, x12, #1
+	CBNZ R12, LBB11_22 // <--                                  // cbnz	x12, .LBB11_22
+	MOVW ZR, R5        // <--                                  // mov	w5, wzr
+	MOVW ZR, R12       // <--                                  // mov	w12, wzr
+	SUB  $1, R7, R13   // <--                                  // sub	x13, x7, #1
+	ADD  R14, R0, R16  // <--                                  // add	x16, x0, x14
+
+LBB11_24:
+	WORD  $0x386d68d7       // MOVBU (R6)(R13), R23                 // ldrb	w23, [x6, x13]
+	SUBW  $97, R23, R24     // <--                                  // sub	w24, w23, #97
+	CMPW  $26, R24          // <--                                  // cmp	w24, #26
+	SUBW  $32, R23, R24     // <--                                  // sub	w24, w23, #32
+	CSELW LO, R24, R23, R23 // <--                                  // csel	w23, w24, w23, lo
+	MADDW R3, R23, R5, R5   // <--                                  // madd	w5, w5, w3, w23
+	WORD  $0x386d6a17       // MOVBU (R16)(R13), R23                // ldrb	w23, [x16, x13]
+	SUBW  $97, R23, R24     // <--                                  // sub	w24, w23, #97
+	CMPW  $26, R24          // <--                                  // cmp	w24, #26
+	SUBW  $32, R23, R24     // <--                                  // sub	w24, w23, #32
+	CSELW LO, R24, R23, R23 // <--                                  // csel	w23, w24, w23, lo
+	MADDW R3, R23, R12, R12 // <--                                  // madd	w12, w12, w3, w23
+	SUBS  $1, R13, R13      // <--                                  // subs	x13, x13, #1
+	BGE   LBB11_24          // <--                                  // b.ge	.LBB11_24
+
+LBB11_25:
+	CMPW R5, R12     // <--                                  // cmp	w12, w5
+	BNE  LBB11_26    // <--                                  // b.ne	.LBB11_26
+	WORD $0xd2800051 // MOVD $2, R17                         // mov	x17, #2
+	JMP  LBB11_27    // <--                                  // b	.LBB11_27
+
+LBB11_26:
+	CBZ   R14, LBB11_34      // <--                                  // cbz	x14, .LBB11_34
+	SUB   $1, R14, R14       // <--                                  // sub	x14, x14, #1
+	WORD  $0x386e6817        // MOVBU (R0)(R14), R23                 // ldrb	w23, [x0, x14]
+	SUBW  $97, R23, R24      // <--                                  // sub	w24, w23, #97
+	CMPW  $26, R24           // <--                                  // cmp	w24, #26
+	SUBW  $32, R23, R24      // <--                                  // sub	w24, w23, #32
+	CSELW LO, R24, R23, R23  // <--                                  // csel	w23, w24, w23, lo
+	MADDW R3, R23, R12, R12  // <--                                  // madd	w12, w12, w3, w23
+	ADD   R7, R14, R13       // <--                                  // add	x13, x14, x7
+	WORD  $0x386d6817        // MOVBU (R0)(R13), R23                 // ldrb	w23, [x0, x13]
+	SUBW  $97, R23, R24      // <--                                  // sub	w24, w23, #97
+	CMPW  $26, R24           // <--                                  // cmp	w24, #26
+	SUBW  $32, R23, R24      // <--                                  // sub	w24, w23, #32
+	CSELW LO, R24, R23, R23  // <--                                  // csel	w23, w24, w23, lo
+	MSUBW R23, R12, R19, R12 // <--                                  // msub	w12, w19, w23, w12
+	JMP   LBB11_25           // <--                                  // b	.LBB11_25
+
+LBB11_27:
+	ADD  R14, R0, R20 // <--                                  // add	x20, x0, x14
+	CMP  $16, R7      // <--                                  // cmp	x7, #16
+	BLT  LBB11_29     // <--                                  // b.lt	.LBB11_29
+	MOVD R6, R21      // <--                                  // mov	x21, x6
+	MOVD R7, R22      // <--                                  // mov	x22, x7
+
+LBB11_28:
+	WORD  $0x3dc00290               // FMOVQ (R20), F16                     // ldr	q16, [x20]
+	WORD  $0x3dc002b1               // FMOVQ (R21), F17                     // ldr	q17, [x21]
+	VEOR  V17.B16, V16.B16, V18.B16 // <--                                  // eor	v18.16b, v16.16b, v17.16b
+	VCMEQ V20.B16, V18.B16, V19.B16 // <--                                  // cmeq	v19.16b, v18.16b, v20.16b
+	VORR  V20.B16, V16.B16, V16.B16 // <--                                  // orr	v16.16b, v16.16b, v20.16b
+	VADD  V21.B16, V16.B16, V16.B16 // <--                                  // add	v16.16b, v16.16b, v21.16b
+	WORD  $0x6e3036d0               // VCMHI V16.B16, V22.B16, V16.B16      // cmhi	v16.16b, v22.16b, v16.16b
+	VAND  V19.B16, V16.B16, V16.B16 // <--                                  // and	v16.16b, v16.16b, v19.16b
+	VAND  V20.B16, V16.B16, V16.B16 // <--                                  // and	v16.16b, v16.16b, v20.16b
+	VEOR  V16.B16, V18.B16, V16.B16 // <--                                  // eor	v16.16b, v18.16b, v16.16b
+	WORD  $0x6e30aa10               // VUMAXV V16.B16, V16                  // umaxv	b16, v16.16b
+	FMOVS F16, R24                  // <--                                  // fmov	w24, s16
+	CBNZW R24, LBB11_32             // <--                                  // cbnz	w24, .LBB11_32
+	ADD   $16, R20, R20             // <--                                  // add	x20, x20, #16
+	ADD   $16, R21, R21             // <--                                  // add	x21, x21, #16
+	SUB   $16, R22, R22             // <--                                  // sub	x22, x22, #16
+	CMP   $16, R22                  // <--                                  // cmp	x22, #16
+	BGE   LBB11_28                  // <--                                  // b.ge	.LBB11_28
+	CBZ   R22, LBB11_33             // <--                                  // cbz	x22, .LBB11_33
+	ADD   R22, R20, R20             // <--                                  // add	x20, x20, x22
+	ADD   R22, R21, R21             // <--                                  // add	x21, x21, x22
+	WORD  $0x3cdf0290               // FMOVQ -16(R20), F16                  // ldur	q16, [x20, #-16]
+	WORD  $0x3cdf02b1               // FMOVQ -16(R21), F17                  // ldur	q17, [x21, #-16]
+	VEOR  V17.B16, V16.B16, V18.B16 // <--                                  // eor	v18.16b, v16.16b, v17.16b
+	VCMEQ V20.B16, V18.B16, V19.B16 // <--                                  // cmeq	v19.16b, v18.16b, v20.16b
+	VORR  V20.B16, V16.B16, V16.B16 // <--                                  // orr	v16.16b, v16.16b, v20.16b
+	VADD  V21.B16, V16.B16, V16.B16 // <--                                  // add	v16.16b, v16.16b, v21.16b
+	WORD  $0x6e3036d0               // VCMHI V16.B16, V22.B16, V16.B16      // cmhi	v16.16b, v22.16b, v16.16b
+	VAND  V19.B16, V16.B16, V16.B16 // <--                                  // and	v16.16b, v16.16b, v19.16b
+	VAND  V20.B16, V16.B16, V16.B16 // <--                                  // and	v16.16b, v16.16b, v20.16b
+	VEOR  V16.B16, V18.B16, V16.B16 // <--                                  // eor	v16.16b, v18.16b, v16.16b
+	WORD  $0x6e30aa10               // VUMAXV V16.B16, V16                  // umaxv	b16, v16.16b
+	FMOVS F16, R24                  // <--                                  // fmov	w24, s16
+	CBNZW R24, LBB11_32             // <--                                  // cbnz	w24, .LBB11_32
+	JMP   LBB11_33                  // <--                                  // b	.LBB11_33
+
+LBB11_29:
+	MOVD ZR, R22 // <--                                  // mov	x22, xzr
+
+LBB11_30:
+	CMP  R7, R22       // <--                                  // cmp	x22, x7
+	BGE  LBB11_33      // <--                                  // b.ge	.LBB11_33
+	WORD $0x38766a97   // MOVBU (R20)(R22), R23                // ldrb	w23, [x20, x22]
+	WORD $0x387668d8   // MOVBU (R6)(R22), R24                 // ldrb	w24, [x6, x22]
+	EORW R24, R23, R24 // <--                                  // eor	w24, w23, w24
+	CBZW R24, LBB11_31 // <--                                  // cbz	w24, .LBB11_31
+	CMPW $32, R24      // <--                                  // cmp	w24, #32
+	BNE  LBB11_32      // <--                                  // b.ne	.LBB11_32
+	ORRW $32, R23, R23 // <--                                  // orr	w23, w23, #0x20
+	SUBW $97, R23, R23 // <--                                  // sub	w23, w23, #97
+	CMPW $26, R23      // <--                                  // cmp	w23, #26
+	BCS  LBB11_32      // <--                                  // b.hs	.LBB11_32
+
+LBB11_31:
+	ADD $1, R22, R22 // <--                                  // add	x22, x22, #1
+	JMP LBB11_30     // <--                                  // b	.LBB11_30
+
+LBB11_32:
+	CBZ R17, LBB11_10 // <--                                  // cbz	x17, .LBB11_10
+	CMP $1, R17       // <--                                  // cmp	x17, #1
+	BEQ LBB11_19      // <--                                  // b.eq	.LBB11_19
+	JMP LBB11_26      // <--                                  // b	.LBB11_26
+
+LBB11_33:
+	MOVD R14, R0        // <--                                  // mov	x0, x14
+	MOVD R0, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB11_34:
+	MOVD $-1, R0        // <--                                  // mov	x0, #-1
+	MOVD R0, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+TEXT ·lastSearchNeedleFoldNEON(SB), NOSPLIT, $0-72
+	MOVD haystack+0(FP), R0
+	MOVD haystack_len+8(FP), R1
+	MOVB rare1+16(FP), R2
+	MOVD off1+24(FP), R3
+	MOVB rare2+32(FP), R4
+	MOVD off2+40(FP), R5
+	MOVD needle+48(FP), R6
+	MOVD needle_len+56(FP), R7
+	SUBS R7, R1, R8             // <--                                  // subs	x8, x1, x7
+	BGE  LBB12_1                // <--                                  // b.ge	.LBB12_1
+	MOVD $-1, R0                // <--                                  // mov	x0, #-1
+	MOVD R0, ret+64(FP)         // <--
+	RET                         // <--                                  // ret
+
+LBB12_1:
+	CMP  $1, R7         // <--                                  // cmp	x7, #1
+	BGE  LBB12_2        // <--                                  // b.ge	.LBB12_2
+	MOVD R1, R0         // <--                                  // mov	x0, x1
+	MOVD R0, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB12_2:
+	ADD   $1, R8, R8       // <--                                  // add	x8, x8, #1
+	ANDW  $255, R2, R2     // <--                                  // and	w2, w2, #0xff
+	ANDW  $255, R4, R4     // <--                                  // and	w4, w4, #0xff
+	MOVD  R8, R9           // <--                                  // mov	x9, x8
+	MOVD  ZR, R10          // <--                                  // mov	x10, xzr
+	ADD   R3, R0, R11      // <--                                  // add	x11, x0, x3
+	SUBW  $97, R2, R12     // <--                                  // sub	w12, w2, #97
+	WORD  $0x5280040d      // MOVW $32, R13                        // mov	w13, #32
+	CMPW  $26, R12         // <--                                  // cmp	w12, #26
+	CSELW LO, R13, ZR, R25 // <--                                  // csel	w25, w13, wzr, lo
+	VDUP  R25, V0.B16      // <--                                  // dup	v0.16b, w25
+	VDUP  R2, V1.B16       // <--                                  // dup	v1.16b, w2
+	CMP   R5, R3           // <--                                  // cmp	x3, x5
+	CSEL  GT, R3, R5, R15  // <--                                  // csel	x15, x3, x5, gt
+	SUB   R15, R1, R15     // <--                                  // sub	x15, x1, x15
+	SUB   $16, R15, R15    // <--                                  // sub	x15, x15, #16
+	WORD  $0x4f01e414      // VMOVI $32, V20.B16                   // movi	v20.16b, #32
+	WORD  $0x4f02e435      // VMOVI $65, V21.B16                   // movi	v21.16b, #65
+	WORD  $0x4f00e756      // VMOVI $26, V22.B16                   // movi	v22.16b, #26
+
+LBB12_3:
+	CMP   $64, R9                // <--                                  // cmp	x9, #64
+	BLT   LBB12_4                // <--                                  // b.lt	.LBB12_4
+	ADD   R9, R11, R12           // <--                                  // add	x12, x11, x9
+	WORD  $0xad7e1584            // FLDPQ -64(R12), (F4, F5)             // ldp	q4, q5, [x12, #-64]
+	WORD  $0xad7f1d86            // FLDPQ -32(R12), (F6, F7)             // ldp	q6, q7, [x12, #-32]
+	VORR  V0.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v0.16b
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	VORR  V0.B16, V5.B16, V5.B16 // <--                                  // orr	v5.16b, v5.16b, v0.16b
+	VCMEQ V1.B16, V5.B16, V5.B16 // <--                                  // cmeq	v5.16b, v5.16b, v1.16b
+	VORR  V0.B16, V6.B16, V6.B16 // <--                                  // orr	v6.16b, v6.16b, v0.16b
+	VCMEQ V1.B16, V6.B16, V6.B16 // <--                                  // cmeq	v6.16b, v6.16b, v1.16b
+	VORR  V0.B16, V7.B16, V7.B16 // <--                                  // orr	v7.16b, v7.16b, v0.16b
+	VCMEQ V1.B16, V7.B16, V7.B16 // <--                                  // cmeq	v7.16b, v7.16b, v1.16b
+	VORR  V5.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v5.16b
+	VORR  V7.B16, V6.B16, V6.B16 // <--                                  // orr	v6.16b, v6.16b, v7.16b
+	VORR  V6.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v6.16b
+	WORD  $0x4ee4bc84            // VADDP V4.D2, V4.D2, V4.D2            // addp	v4.2d, v4.2d, v4.2d
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	CBNZ  R12, LBB12_4           // <--                                  // cbnz	x12, .LBB12_4
+	SUB   $64, R9, R9            // <--                                  // sub	x9, x9, #64
+	JMP   LBB12_3                // <--                                  // b	.LBB12_3
+
+LBB12_4:
+	CMP   $16, R9                // <--                                  // cmp	x9, #16
+	BLT   LBB12_5                // <--                                  // b.lt	.LBB12_5
+	SUB   $16, R9, R13           // <--                                  // sub	x13, x9, #16
+	WORD  $0x3ced6964            // FMOVQ (R11)(R13), F4                 // ldr	q4, [x11, x13]
+	VORR  V0.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v0.16b
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	WORD  $0x0f0c8484            // VSHRN $4, V4.H8, V4.B8               // shrn	v4.8b, v4.8h, #4
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	JMP   LBB12_9                // <--                                  // b	.LBB12_9
+
+LBB12_5:
+	CMP   $1, R9                 // <--                                  // cmp	x9, #1
+	BLT   LBB12_33               // <--                                  // b.lt	.LBB12_33
+	MOVD  ZR, R13                // <--                                  // mov	x13, xzr
+	TBNZ  $63, R15, LBB12_6      // <--                                  // tbnz	x15, #63, .LBB12_6
+	WORD  $0x3dc00164            // FMOVQ (R11), F4                      // ldr	q4, [x11]
+	VORR  V0.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v0.16b
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	WORD  $0x0f0c8484            // VSHRN $4, V4.H8, V4.B8               // shrn	v4.8b, v4.8h, #4
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	LSL   $2, R9, R14            // <--                                  // lsl	x14, x9, #2
+	WORD  $0xd2800031            // MOVD $1, R17                         // mov	x17, #1
+	LSL   R14, R17, R17          // <--                                  // lsl	x17, x17, x14
+	SUB   $1, R17, R17           // <--                                  // sub	x17, x17, #1
+	AND   R17, R12, R12          // <--                                  // and	x12, x12, x17
+	JMP   LBB12_9                // <--                                  // b	.LBB12_9
+
+LBB12_6:
+	MOVD ZR, R12 // <--                                  // mov	x12, xzr
+	MOVD ZR, R14 // <--                                  // mov	x14, xzr
+
+LBB12_7:
+	WORD $0x386e6971   // MOVBU (R11)(R14), R17                // ldrb	w17, [x11, x14]
+	ORRW R25, R17, R17 // <--                                  // orr	w17, w17, w25
+	CMPW R2, R17       // <--                                  // cmp	w17, w2
+	BNE  LBB12_8       // <--                                  // b.ne	.LBB12_8
+	LSL  $2, R14, R17  // <--                                  // lsl	x17, x14, #2
+	WORD $0xd28001f8   // MOVD $15, R24                        // mov	x24, #15
+	LSL  R17, R24, R24 // <--                                  // lsl	x24, x24, x17
+	ORR  R24, R12, R12 // <--                                  // orr	x12, x12, x24
+
+LBB12_8:
+	ADD $1, R14, R14 // <--                                  // add	x14, x14, #1
+	CMP R9, R14      // <--                                  // cmp	x14, x9
+	BLT LBB12_7      // <--                                  // b.lt	.LBB12_7
+
+LBB12_9:
+	CBZ  R12, LBB12_11    // <--                                  // cbz	x12, .LBB12_11
+	CLZ  R12, R14         // <--                                  // clz	x14, x12
+	EOR  $63, R14, R14    // <--                                  // eor	x14, x14, #0x3f
+	ADD  R14>>2, R13, R14 // <--                                  // add	x14, x13, x14, lsr #2
+	MOVD ZR, R17          // <--                                  // mov	x17, xzr
+	JMP  LBB12_27         // <--                                  // b	.LBB12_27
+
+LBB12_10:
+	ADD  $1, R10, R10  // <--                                  // add	x10, x10, #1
+	SUB  R14, R8, R17  // <--                                  // sub	x17, x8, x14
+	ASR  $8, R17, R17  // <--                                  // asr	x17, x17, #8
+	ADD  $4, R17, R17  // <--                                  // add	x17, x17, #4
+	CMP  R17, R10      // <--                                  // cmp	x10, x17
+	BGT  LBB12_12      // <--                                  // b.gt	.LBB12_12
+	SUB  R13, R14, R17 // <--                                  // sub	x17, x14, x13
+	LSL  $2, R17, R17  // <--                                  // lsl	x17, x17, #2
+	WORD $0xd2800038   // MOVD $1, R24                         // mov	x24, #1
+	LSL  R17, R24, R24 // <--                                  // lsl	x24, x24, x17
+	SUB  $1, R24, R24  // <--                                  // sub	x24, x24, #1
+	AND  R24, R12, R12 // <--                                  // and	x12, x12, x24
+	JMP  LBB12_9       // <--                                  // b	.LBB12_9
+
+LBB12_11:
+	MOVD R13, R9 // <--                                  // mov	x9, x13
+	JMP  LBB12_3 // <--                                  // b	.LBB12_3
+
+LBB12_12:
+	MOVD  R14, R9           // <--                                  // mov	x9, x14
+	ADD   R5, R0, R16       // <--                                  // add	x16, x0, x5
+	SUBW  $97, R4, R12      // <--                                  // sub	w12, w4, #97
+	WORD  $0x5280040d       // MOVW $32, R13                        // mov	w13, #32
+	CMPW  $26, R12          // <--                                  // cmp	w12, #26
+	CSELW LO, R13, ZR, R26  // <--                                  // csel	w26, w13, wzr, lo
+	VDUP  R26, V2.B16       // <--                                  // dup	v2.16b, w26
+	VDUP  R4, V3.B16        // <--                                  // dup	v3.16b, w4
+	MOVD  ZR, R10           // <--                                  // mov	x10, xzr
+	WORD  $0xd280010c       // MOVD $8, R12                         // mov	x12, #8
+	WORD  $0xd280008d       // MOVD $4, R13                         // mov	x13, #4
+	CMP   $63, R7           // <--                                  // cmp	x7, #63
+	CSEL  GT, R13, R12, R19 // <--                                  // csel	x19, x13, x12, gt
+
+LBB12_13:
+	CMP   $16, R9                // <--                                  // cmp	x9, #16
+	BLT   LBB12_14               // <--                                  // b.lt	.LBB12_14
+	SUB   $16, R9, R13           // <--                                  // sub	x13, x9, #16
+	WORD  $0x3ced6964            // FMOVQ (R11)(R13), F4                 // ldr	q4, [x11, x13]
+	WORD  $0x3ced6a05            // FMOVQ (R16)(R13), F5                 // ldr	q5, [x16, x13]
+	VORR  V0.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v0.16b
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	VORR  V2.B16, V5.B16, V5.B16 // <--                                  // orr	v5.16b, v5.16b, v2.16b
+	VCMEQ V3.B16, V5.B16, V5.B16 // <--                                  // cmeq	v5.16b, v5.16b, v3.16b
+	VAND  V5.B16, V4.B16, V4.B16 // <--                                  // and	v4.16b, v4.16b, v5.16b
+	WORD  $0x0f0c8484            // VSHRN $4, V4.H8, V4.B8               // shrn	v4.8b, v4.8h, #4
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	JMP   LBB12_18               // <--                                  // b	.LBB12_18
+
+LBB12_14:
+	CMP   $1, R9                 // <--                                  // cmp	x9, #1
+	BLT   LBB12_33               // <--                                  // b.lt	.LBB12_33
+	MOVD  ZR, R13                // <--                                  // mov	x13, xzr
+	TBNZ  $63, R15, LBB12_15     // <--                                  // tbnz	x15, #63, .LBB12_15
+	WORD  $0x3dc00164            // FMOVQ (R11), F4                      // ldr	q4, [x11]
+	WORD  $0x3dc00205            // FMOVQ (R16), F5                      // ldr	q5, [x16]
+	VORR  V0.B16, V4.B16, V4.B16 // <--                                  // orr	v4.16b, v4.16b, v0.16b
+	VCMEQ V1.B16, V4.B16, V4.B16 // <--                                  // cmeq	v4.16b, v4.16b, v1.16b
+	VORR  V2.B16, V5.B16, V5.B16 // <--                                  // orr	v5.16b, v5.16b, v2.16b
+	VCMEQ V3.B16, V5.B16, V5.B16 // <--                                  // cmeq	v5.16b, v5.16b, v3.16b
+	VAND  V5.B16, V4.B16, V4.B16 // <--                                  // and	v4.16b, v4.16b, v5.16b
+	WORD  $0x0f0c8484            // VSHRN $4, V4.H8, V4.B8               // shrn	v4.8b, v4.8h, #4
+	FMOVD F4, R12                // <--                                  // fmov	x12, d4
+	LSL   $2, R9, R14            // <--                                  // lsl	x14, x9, #2
+	WORD  $0xd2800031            // MOVD $1, R17                         // mov	x17, #1
+	LSL   R14, R17, R17          // <--                                  // lsl	x17, x17, x14
+	SUB   $1, R17, R17           // <--                                  // sub	x17, x17, #1
+	AND   R17, R12, R12          // <--                                  // and	x12, x12, x17
+	JMP   LBB12_18               // <--                                  // b	.LBB12_18
+
+LBB12_15:
+	MOVD ZR, R12 // <--                                  // mov	x12, xzr
+	MOVD ZR, R14 // <--                                  // mov	x14, xzr
+
+LBB12_16:
+	WORD $0x386e6971   // MOVBU (R11)(R14), R17                // ldrb	w17, [x11, x14]
+	ORRW R25, R17, R17 // <--                                  // orr	w17, w17, w25
+	CMPW R2, R17       // <--                                  // cmp	w17, w2
+	BNE  LBB12_17      // <--                                  // b.ne	.LBB12_17
+	WORD $0x386e6a11   // MOVBU (R16)(R14), R17                // ldrb	w17, [x16, x14]
+	ORRW R26, R17, R17 // <--                                  // orr	w17, w17, w26
+	CMPW R4, R17       // <--                                  // cmp	w17, w4
+	BNE  LBB12_17      // <--                                  // b.ne	.LBB12_17
+	LSL  $2, R14, R17  // <--                                  // lsl	x17, x14, #2
+	WORD $0xd28001f8   // MOVD $15, R24                        // mov	x24, #15
+	LSL  R17, R24, R24 // <--                                  // lsl	x24, x24, x17
+	ORR  R24, R12, R12 // <--                                  // orr	x12, x12, x24
+
+LBB12_17:
+	ADD $1, R14, R14 // <--                                  // add	x14, x14, #1
+	CMP R9, R14      // <--                                  // cmp	x14, x9
+	BLT LBB12_16     // <--                                  // b.lt	.LBB12_16
+
+LBB12_18:
+	CBZ  R12, LBB12_20    // <--                                  // cbz	x12, .LBB12_20
+	CLZ  R12, R14         // <--                                  // clz	x14, x12
+	EOR  $63, R14, R14    // <--                                  // eor	x14, x14, #0x3f
+	ADD  R14>>2, R13, R14 // <--                                  // add	x14, x13, x14, lsr #2
+	WORD $0xd2800031      // MOVD $1, R17                         // mov	x17, #1
+	JMP  LBB12_27         // <--                                  // b	.LBB12_27
+
+LBB12_19:
+	ADD  $1, R10, R10  // <--                                  // add	x10, x10, #1
+	CMP  R19, R10      // <--                                  // cmp	x10, x19
+	BGT  LBB12_21      // <--                                  // b.gt	.LBB12_21
+	SUB  R13, R14, R17 // <--                                  // sub	x17, x14, x13
+	LSL  $2, R17, R17  // <--                                  // lsl	x17, x17, #2
+	WORD $0xd2800038   // MOVD $1, R24                         // mov	x24, #1
+	LSL  R17, R24, R24 // <--                                  // lsl	x24, x24, x17
+	SUB  $1, R24, R24  // <--                                  // sub	x24, x24, #1
+	AND  R24, R12, R12 // <--                                  // and	x12, x12, x24
+	JMP  LBB12_18      // <--                                  // b	.LBB12_18
+
+LBB12_20:
+	MOVD R13, R9  // <--                                  // mov	x9, x13
+	JMP  LBB12_13 // <--                                  // b	.LBB12_13
+
+LBB12_21:
+	CMP  $1, R14      // <--                                  // cmp	x14, #1
+	BLT  LBB12_33     // <--                                  // b.lt	.LBB12_33
+	SUB  $1, R14, R14 // <--                                  // sub	x14, x14, #1
+	MOVW $403, R3     // <--                                  // mov	w3, #403
+	WORD $0x72a02003  // MOVKW $(256<<16), R3                 // movk	w3, #256, lsl #16
+	WORD $0x52800033  // MOVW $1, R19                         // mov	w19, #1
+	WORD $0x2a0303ed  // MOVW R3, R13                         // mov	w13, w3
+	MOVD R7, R12      // <--                                  // mov	x12, x7
+
+LBB12_22:
+	TBZ  $0, R12, LBB12_23 // <--                                  // tbz	w12, #0, .LBB12_23
+	MULW R13, R19, R19     // <--                                  // mul	w19, w19, w13
+
+LBB12_23:
+	MULW R13, R13, R13 // <--                                  // mul	w13, w13, w13
+	LSR  $1, R12, R12  // <--                                  // lsr	x12, x12, #1
+	CBNZ R12, LBB12_22 // <--                                  // cbnz	x12, .LBB12_22
+	MOVW ZR, R5        // <--                                  // mov	w5, wzr
+	MOVW ZR, R12       // <--                                  // mov	w12, wzr
+	SUB  $1, R7, R13   // <--                                  // sub	x13, x7, #1
+	ADD  R14, R0, R16  // <--                                  // add	x16, x0, x14
+
+LBB12_24:
+	WORD  $0x386d68d7       // MOVBU (R6)(R13), R23                 // ldrb	w23, [x6, x13]
+	MADDW R3, R23, R5, R5   // <--                                  // madd	w5, w5, w3, w23
+	WORD  $0x386d6a17       // MOVBU (R16)(R13), R23                // ldrb	w23, [x16, x13]
+	SUBW  $65, R23, R24     // <--                                  // sub	w24, w23, #65
+	CMPW  $26, R24          // <--                                  // cmp	w24, #26
+	ADDW  $32, R23, R24     // <--                                  // add	w24, w23, #32
+	CSELW LO, R24, R23, R23 // <--                                  // csel	w23, w24, w23, lo
+	MADDW R3, R23, R12, R12 // <--                                  // madd	w12, w12, w3, w23
+	SUBS  $1, R13, R13      // <--                                  // subs	x13, x13, #1
+	BGE   LBB12_24          // <--                                  // b.ge	.LBB12_24
+
+LBB12_25:
+	CMPW R5, R12     // <--                                  // cmp	w12, w5
+	BNE  LBB12_26    // <--                                  // b.ne	.LBB12_26
+	WORD $0xd2800051 // MOVD $2, R17                         // mov	x17, #2
+	JMP  LBB12_27    // <--                                  // b	.LBB12_27
+
+LBB12_26:
+	CBZ   R14, LBB12_33      // <--                                  // cbz	x14, .LBB12_33
+	SUB   $1, R14, R14       // <--                                  // sub	x14, x14, #1
+	WORD  $0x386e6817        // MOVBU (R0)(R14), R23                 // ldrb	w23, [x0, x14]
+	SUBW  $65, R23, R24      // <--                                  // sub	w24, w23, #65
+	CMPW  $26, R24           // <--                                  // cmp	w24, #26
+	ADDW  $32, R23, R24      // <--                                  // add	w24, w23, #32
+	CSELW LO, R24, R23, R23  // <--                                  // csel	w23, w24, w23, lo
+	MADDW R3, R23, R12, R12  // <--                                  // madd	w12, w12, w3, w23
+	ADD   R7, R14, R13       // <--                                  // add	x13, x14, x7
+	WORD  $0x386d6817        // MOVBU (R0)(R13), R23                 // ldrb	w23, [x0, x13]
+	SUBW  $65, R23, R24      // <--                                  // sub	w24, w23, #65
+	CMPW  $26, R24           // <--                                  // cmp	w24, #26
+	ADDW  $32, R23, R24      // <--                                  // add	w24, w23, #32
+	CSELW LO, R24, R23, R23  // <--                                  // csel	w23, w24, w23, lo
+	MSUBW R23, R12, R19, R12 // <--                                  // msub	w12, w19, w23, w12
+	JMP   LBB12_25           // <--                                  // b	.LBB12_25
+
+LBB12_27:
+	ADD  R14, R0, R20 // <--                                  // add	x20, x0, x14
+	CMP  $16, R7      // <--                                  // cmp	x7, #16
+	BLT  LBB12_29     // <--                                  // b.lt	.LBB12_29
+	MOVD R6, R21      // <--                                  // mov	x21, x6
+	MOVD R7, R22      // <--                                  // mov	x22, x7
+
+LBB12_28:
+	WORD  $0x3dc00290               // FMOVQ (R20), F16                     // ldr	q16, [x20]
+	WORD  $0x3dc002b1               // FMOVQ (R21), F17                     // ldr	q17, [x21]
+	VSUB  V21.B16, V16.B16, V18.B16 // <--                                  // sub	v18.16b, v16.16b, v21.16b
+	WORD  $0x6e3236d2               // VCMHI V18.B16, V22.B16, V18.B16      // cmhi	v18.16b, v22.16b, v18.16b
+	VAND  V20.B16, V18.B16, V18.B16 // <--                                  // and	v18.16b, v18.16b, v20.16b
+	VORR  V18.B16, V16.B16, V16.B16 // <--                                  // orr	v16.16b, v16.16b, v18.16b
+	VEOR  V17.B16, V16.B16, V16.B16 // <--                                  // eor	v16.16b, v16.16b, v17.16b
+	WORD  $0x6e30aa10               // VUMAXV V16.B16, V16                  // umaxv	b16, v16.16b
+	FMOVS F16, R24                  // <--                                  // fmov	w24, s16
+	CBNZW R24, LBB12_31             // <--                                  // cbnz	w24, .LBB12_31
+	ADD   $16, R20, R20             // <--                                  // add	x20, x20, #16
+	ADD   $16, R21, R21             // <--                                  // add	x21, x21, #16
+	SUB   $16, R22, R22             // <--                                  // sub	x22, x22, #16
+	CMP   $16, R22                  // <--                                  // cmp	x22, #16
+	BGE   LBB12_28                  // <--                                  // b.ge	.LBB12_28
+	CBZ   R22, LBB12_32             // <--                                  // cbz	x22, .LBB12_32
+	ADD   R22, R20, R20             // <--                                  // add	x20, x20, x22
+	ADD   R22, R21, R21             // <--                                  // add	x21, x21, x22
+	WORD  $0x3cdf0290               // FMOVQ -16(R20), F16                  // ldur	q16, [x20, #-16]
+	WORD  $0x3cdf02b1               // FMOVQ -16(R21), F17                  // ldur	q17, [x21, #-16]
+	VSUB  V21.B16, V16.B16, V18.B16 // <--                                  // sub	v18.16b, v16.16b, v21.16b
+	WORD  $0x6e3236d2               // VCMHI V18.B16, V22.B16, V18.B16      // cmhi	v18.16b, v22.16b, v18.16b
+	VAND  V20.B16, V18.B16, V18.B16 // <--                                  // and	v18.16b, v18.16b, v20.16b
+	VORR  V18.B16, V16.B16, V16.B16 // <--                                  // orr	v16.16b, v16.16b, v18.16b
+	VEOR  V17.B16, V16.B16, V16.B16 // <--                                  // eor	v16.16b, v16.16b, v17.16b
+	WORD  $0x6e30aa10               // VUMAXV V16.B16, V16                  // umaxv	b16, v16.16b
+	FMOVS F16, R24                  // <--                                  // fmov	w24, s16
+	CBNZW R24, LBB12_31             // <--                                  // cbnz	w24, .LBB12_31
+	JMP   LBB12_32                  // <--                                  // b	.LBB12_32
+
+LBB12_29:
+	MOVD ZR, R22 // <--                                  // mov	x22, xzr
+
+LBB12_30:
+	CMP   R7, R22           // <--                                  // cmp	x22, x7
+	BGE   LBB12_32          // <--                                  // b.ge	.LBB12_32
+	WORD  $0x38766a97       // MOVBU (R20)(R22), R23                // ldrb	w23, [x20, x22]
+	SUBW  $65, R23, R24     // <--                                  // sub	w24, w23, #65
+	CMPW  $26, R24          // <--                                  // cmp	w24, #26
+	ORRW  $32, R23, R24     // <--                                  // orr	w24, w23, #0x20
+	CSELW LO, R24, R23, R23 // <--                                  // csel	w23, w24, w23, lo
+	WORD  $0x387668d8       // MOVBU (R6)(R22), R24                 // ldrb	w24, [x6, x22]
+	CMPW  R24, R23          // <--                                  // cmp	w23, w24
+	BNE   LBB12_31          // <--                                  // b.ne	.LBB12_31
+	ADD   $1, R22, R22      // <--                                  // add	x22, x22, #1
+	JMP   LBB12_30          // <--                                  // b	.LBB12_30
+
+LBB12_31:
+	CBZ R17, LBB12_10 // <--                                  // cbz	x17, .LBB12_10
+	CMP $1, R17       // <--                                  // cmp	x17, #1
+	BEQ LBB12_19      // <--                                  // b.eq	.LBB12_19
+	JMP LBB12_26      // <--                                  // b	.LBB12_26
+
+LBB12_32:
+	MOVD R14, R0        // <--                                  // mov	x0, x14
+	MOVD R0, ret+64(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB12_33:
+	MOVD $-1, R0        // <--                                  // mov	x0, #-1
+	MOVD R0, ret+64(FP) // <--
+	RET                 // <--                                  // ret
@@ -1,8 +1,14 @@
 //go:build !noasm && amd64
-// Code generated by gocc -- DO NOT EDIT.
+// Code generated by gccasm -- DO NOT EDIT.
 
 package ascii
 
 
 //go:noescape
 func isAsciiSse(src string) bool
+
+//go:noescape
+func equalFoldSse(a string, b string) bool
+
+//go:noescape
+func indexMaskSse(data string, mask byte) int
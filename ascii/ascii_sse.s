@@ -1,8 +1,8 @@
 //go:build !noasm && amd64
-// Code generated by gocc v0.16.5-rev-57c4d32 -- DO NOT EDIT.
+// Code generated by gccasm -- DO NOT EDIT.
 //
 // Source file         : ascii_sse.c
-// Clang version       : Apple clang version 17.0.0 (clang-1700.6.3.2)
+// Compiler version    : gcc (Debian 12.2.0-14+deb12u1) 12.2.0
 // Target architecture : amd64
 // Compiler options    : -msse4.1
 
@@ -15,98 +15,598 @@ GLOBL LCPI0_0<>(SB), (RODATA|NOPTR), $16
 TEXT ·isAsciiSse(SB), NOSPLIT, $0-17
 	MOVQ src+0(FP), DI
 	MOVQ src_len+8(FP), SI
-	NOP                      // (skipped)                            // push	rbp
-	NOP                      // (skipped)                            // mov	rbp, rsp
-	NOP                      // (skipped)                            // and	rsp, -8
-	CMPQ SI, $0x10           // <--                                  // cmp	rsi, 16
-	JB   LBB0_9              // <--                                  // jb	.LBB0_9
-	LEAQ 0(DI)(SI*1), CX     // <--                                  // lea	rcx, [rdi + rsi]
-	WORD $0xf089             // MOVL SI, AX                          // mov	eax, esi
-	WORD $0xe083; BYTE $0x3f // ANDL $0x3f, AX                       // and	eax, 63
-	SUBQ AX, CX              // <--                                  // sub	rcx, rax
-	CMPQ CX, DI              // <--                                  // cmp	rcx, rdi
-	JBE  LBB0_5              // <--                                  // jbe	.LBB0_5
-	MOVO LCPI0_0<>(SB), X0   // <--                                  // movdqa	xmm0, xmmword ptr [rip + .LCPI0_0]
+	CMPQ SI, $0xf          // <--                                  // cmp	rsi, 15
+	JBE  LBB0_4            // <--                                  // jbe	.LBB0_4
+	MOVQ SI, AX            // <--                                  // mov	rax, rsi
+	ANDQ $-0x40, AX        // <--                                  // and	rax, -64
+	ADDQ DI, AX            // <--                                  // add	rax, rdi
+	CMPQ DI, AX            // <--                                  // cmp	rdi, rax
+	JAE  LBB0_5            // <--                                  // jae	.LBB0_5
+	MOVO LCPI0_0<>(SB), X2 // <--                                  // movdqa	xmm2, xmmword ptr [rip + 0]
+	JMP  LBB0_1            // <--                                  // jmp	.LBB0_1
+
+LBB0_0:
+	ADDQ $0x40, DI // <--                                  // add	rdi, 64
+	CMPQ DI, AX    // <--                                  // cmp	rdi, rax
+	JAE  LBB0_5    // <--                                  // jae	.LBB0_5
+
+LBB0_1:
+	MOVOU 0x20(DI), X0 // <--                                  // movdqu	xmm0, xmmword ptr [rdi + 32]
+	MOVOU 0x30(DI), X3 // <--                                  // movdqu	xmm3, xmmword ptr [rdi + 48]
+	MOVOU 0x10(DI), X1 // <--                                  // movdqu	xmm1, xmmword ptr [rdi + 16]
+	MOVOU 0(DI), X4    // <--                                  // movdqu	xmm4, xmmword ptr [rdi]
+	POR   X3, X0       // <--                                  // por	xmm0, xmm3
+	POR   X4, X1       // <--                                  // por	xmm1, xmm4
+	POR   X1, X0       // <--                                  // por	xmm0, xmm1
+	PTEST X2, X0       // <--                                  // ptest	xmm0, xmm2
+	JE    LBB0_0       // <--                                  // je	.LBB0_0
+	XORL  AX, AX       // <--                                  // xor	eax, eax
+
+LBB0_2:
+	MOVB AX, ret+16(FP) // <--
+	RET                 // <--                                  // ret
 
 LBB0_3:
-	LONG $0x0f6f0ff3             // MOVDQU 0(DI), X1                     // movdqu	xmm1, xmmword ptr [rdi]
-	LONG $0x576f0ff3; BYTE $0x10 // MOVDQU 0x10(DI), X2                  // movdqu	xmm2, xmmword ptr [rdi + 16]
-	LONG $0xd1eb0f66             // POR X1, X2                           // por	xmm2, xmm1
-	LONG $0x4f6f0ff3; BYTE $0x20 // MOVDQU 0x20(DI), X1                  // movdqu	xmm1, xmmword ptr [rdi + 32]
-	LONG $0x5f6f0ff3; BYTE $0x30 // MOVDQU 0x30(DI), X3                  // movdqu	xmm3, xmmword ptr [rdi + 48]
-	LONG $0xd9eb0f66             // POR X1, X3                           // por	xmm3, xmm1
-	LONG $0xdaeb0f66             // POR X2, X3                           // por	xmm3, xmm2
-	LONG $0x17380f66; BYTE $0xd8 // PTEST X0, X3                         // ptest	xmm3, xmm0
-	JNE  LBB0_15                 // <--                                  // jne	.LBB0_15
-	ADDQ $0x40, DI               // <--                                  // add	rdi, 64
-	CMPQ DI, CX                  // <--                                  // cmp	rdi, rcx
-	JB   LBB0_3                  // <--                                  // jb	.LBB0_3
+	ANDL $0xf, SI // <--                                  // and	esi, 15
+
+LBB0_4:
+	MOVL    $0x1, AX        // <--                                  // mov	eax, 1
+	TESTQ   SI, SI          // <--                                  // test	rsi, rsi
+	JE      LBB0_2          // <--                                  // je	.LBB0_2
+	LEAQ    0(DI)(SI*1), DX // <--                                  // lea	rdx, [rdi + rsi]
+	TESTB   $0x8, SI        // <--                                  // test	sil, 8
+	JNE     LBB0_9          // <--                                  // jne	.LBB0_9
+	TESTB   $0x4, SI        // <--                                  // test	sil, 4
+	JNE     LBB0_8          // <--                                  // jne	.LBB0_8
+	SHRQ    $0x1, SI        // <--                                  // shr	rsi, 1
+	MOVBLZX 0(DI), AX       // <--                                  // movzx	eax, byte ptr [rdi]
+	ORB     -0x1(DX), AX    // <--                                  // or	al, byte ptr [rdx - 1]
+	ORB     0(DI)(SI*1), AX // <--                                  // or	al, byte ptr [rdi + rsi]
+	WORD    $0x80a8         // TESTB $0x80, AX                      // test	al, -128
+	SETEQ   AX              // <--                                  // sete	al
+	MOVB    AX, ret+16(FP)  // <--
+	RET                     // <--                                  // ret
 
 LBB0_5:
-	ADDQ DI, AX              // <--                                  // add	rax, rdi
-	WORD $0xe683; BYTE $0x0f // ANDL $0xf, SI                        // and	esi, 15
-	SUBQ SI, AX              // <--                                  // sub	rax, rsi
-	CMPQ DI, AX              // <--                                  // cmp	rdi, rax
-	JAE  LBB0_9              // <--                                  // jae	.LBB0_9
-	MOVO LCPI0_0<>(SB), X0   // <--                                  // movdqa	xmm0, xmmword ptr [rip + .LCPI0_0]
+	MOVQ SI, AX            // <--                                  // mov	rax, rsi
+	ANDL $0x30, AX         // <--                                  // and	eax, 48
+	ADDQ DI, AX            // <--                                  // add	rax, rdi
+	CMPQ DI, AX            // <--                                  // cmp	rdi, rax
+	JAE  LBB0_3            // <--                                  // jae	.LBB0_3
+	MOVO LCPI0_0<>(SB), X2 // <--                                  // movdqa	xmm2, xmmword ptr [rip + 0]
+	JMP  LBB0_7            // <--                                  // jmp	.LBB0_7
+
+LBB0_6:
+	ADDQ $0x10, DI // <--                                  // add	rdi, 16
+	CMPQ DI, AX    // <--                                  // cmp	rdi, rax
+	JAE  LBB0_3    // <--                                  // jae	.LBB0_3
 
 LBB0_7:
-	LONG $0x0f6f0ff3             // MOVDQU 0(DI), X1                     // movdqu	xmm1, xmmword ptr [rdi]
-	LONG $0x17380f66; BYTE $0xc8 // PTEST X0, X1                         // ptest	xmm1, xmm0
-	JNE  LBB0_15                 // <--                                  // jne	.LBB0_15
-	ADDQ $0x10, DI               // <--                                  // add	rdi, 16
-	CMPQ DI, AX                  // <--                                  // cmp	rdi, rax
-	JB   LBB0_7                  // <--                                  // jb	.LBB0_7
+	MOVOU 0(DI), X5 // <--                                  // movdqu	xmm5, xmmword ptr [rdi]
+	PTEST X2, X5    // <--                                  // ptest	xmm5, xmm2
+	JE    LBB0_6    // <--                                  // je	.LBB0_6
+	XORL  AX, AX    // <--                                  // xor	eax, eax
+	JMP   LBB0_2    // <--                                  // jmp	.LBB0_2
+
+LBB0_8:
+	MOVL  0(DI), AX        // <--                                  // mov	eax, dword ptr [rdi]
+	ORL   -0x4(DX), AX     // <--                                  // or	eax, dword ptr [rdx - 4]
+	TESTL $-0x7f7f7f80, AX // <--                                  // test	eax, -2139062144
+	SETEQ AX               // <--                                  // sete	al
+	MOVB  AX, ret+16(FP)   // <--
+	RET                    // <--                                  // ret
 
 LBB0_9:
-	WORD $0x8548; BYTE $0xf6 // TESTQ SI, SI                         // test	rsi, rsi
-	JE   LBB0_13             // <--                                  // je	.LBB0_13
-	CMPQ SI, $0x8            // <--                                  // cmp	rsi, 8
-	JAE  LBB0_14             // <--                                  // jae	.LBB0_14
-	CMPQ SI, $0x4            // <--                                  // cmp	rsi, 4
-	JAE  LBB0_16             // <--                                  // jae	.LBB0_16
-	MOVQ SI, AX              // <--                                  // mov	rax, rsi
-	SHRQ $0x1, AX            // <--                                  // shr	rax
-	LONG $0x0704b60f         // MOVZX 0(DI)(AX*1), AX                // movzx	eax, byte ptr [rdi + rax]
-	ORB  0(DI), AL           // <--                                  // or	al, byte ptr [rdi]
-	ORB  -0x1(DI)(SI*1), AL  // <--                                  // or	al, byte ptr [rdi + rsi - 1]
-	WORD $0x990f; BYTE $0xc0 // SETNS AL                             // setns	al
-	NOP                      // (skipped)                            // mov	rsp, rbp
-	NOP                      // (skipped)                            // pop	rbp
-	MOVB AX, ret+16(FP)      // <--
-	RET                      // <--                                  // ret
-
-LBB0_13:
-	WORD $0x01b0        // MOVL $0x1, AL                        // mov	al, 1
-	NOP                 // (skipped)                            // mov	rsp, rbp
-	NOP                 // (skipped)                            // pop	rbp
-	MOVB AX, ret+16(FP) // <--
+	MOVQ  0(DI), AX                // <--                                  // mov	rax, qword ptr [rdi]
+	ORQ   -0x8(DX), AX             // <--                                  // or	rax, qword ptr [rdx - 8]
+	MOVQ  $-0x7f7f7f7f7f7f7f80, DX // <--                                  // movabs	rdx, -9187201950435737472
+	TESTQ DX, AX                   // <--                                  // test	rax, rdx
+	WORD  $0x940f; BYTE $0xc0      // SETEQ AX                             // sete	al
+	MOVB  AX, ret+16(FP)           // <--
+	RET                            // <--                                  // ret
+
+DATA LCPI1_0<>+0x00(SB)/8, $0x2020202020202020
+DATA LCPI1_0<>+0x08(SB)/8, $0x2020202020202020
+GLOBL LCPI1_0<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI1_1<>+0x00(SB)/8, $0x1f1f1f1f1f1f1f1f
+DATA LCPI1_1<>+0x08(SB)/8, $0x1f1f1f1f1f1f1f1f
+GLOBL LCPI1_1<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI1_2<>+0x00(SB)/8, $0x9a9a9a9a9a9a9a9a
+DATA LCPI1_2<>+0x08(SB)/8, $0x9a9a9a9a9a9a9a9a
+GLOBL LCPI1_2<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI1_3<>+0x00(SB)/8, $0x0101010101010101
+DATA LCPI1_3<>+0x08(SB)/8, $0x0101010101010101
+GLOBL LCPI1_3<>(SB), (RODATA|NOPTR), $16
+
+TEXT ·equalFoldSse(SB), NOSPLIT, $32-33
+	MOVQ a+0(FP), DI
+	MOVQ a_len+8(FP), SI
+	MOVQ b+16(FP), DX
+	MOVQ b_len+24(FP), CX
+	MOVQ DI, AX            // <--                                  // mov	rax, rdi
+	XORL R9, R9            // <--                                  // xor	r9d, r9d
+	MOVQ SI, DI            // <--                                  // mov	rdi, rsi
+	CMPQ SI, CX            // <--                                  // cmp	rsi, rcx
+	JNE  LBB1_2            // <--                                  // jne	.LBB1_2
+	MOVQ DX, SI            // <--                                  // mov	rsi, rdx
+	CMPQ DI, $0xf          // <--                                  // cmp	rdi, 15
+	JBE  LBB1_3            // <--                                  // jbe	.LBB1_3
+	MOVQ DI, DX            // <--                                  // mov	rdx, rdi
+	ANDQ $-0x20, DX        // <--                                  // and	rdx, -32
+	ADDQ AX, DX            // <--                                  // add	rdx, rax
+	CMPQ AX, DX            // <--                                  // cmp	rax, rdx
+	JAE  LBB1_7            // <--                                  // jae	.LBB1_7
+	MOVO LCPI1_0<>(SB), X5 // <--                                  // movdqa	xmm5, xmmword ptr [rip + 0]
+	MOVO LCPI1_1<>(SB), X4 // <--                                  // movdqa	xmm4, xmmword ptr [rip + 0]
+	LONG $0xf6760f66       // PCMPEQD X6, X6                       // pcmpeqd	xmm6, xmm6
+	MOVO LCPI1_2<>(SB), X3 // <--                                  // movdqa	xmm3, xmmword ptr [rip + 0]
+	MOVO LCPI1_0<>(SB), X2 // <--                                  // movdqa	xmm2, xmmword ptr [rip + 0]
+	MOVO LCPI1_3<>(SB), X1 // <--                                  // movdqa	xmm1, xmmword ptr [rip + 0]
+	JMP  LBB1_1            // <--                                  // jmp	.LBB1_1
+
+LBB1_0:
+	ADDQ $0x20, AX // <--                                  // add	rax, 32
+	ADDQ $0x20, SI // <--                                  // add	rsi, 32
+	CMPQ AX, DX    // <--                                  // cmp	rax, rdx
+	JAE  LBB1_7    // <--                                  // jae	.LBB1_7
+
+LBB1_1:
+	MOVOU   0(AX), X0    // <--                                  // movdqu	xmm0, xmmword ptr [rax]
+	MOVOU   0(SI), X7    // <--                                  // movdqu	xmm7, xmmword ptr [rsi]
+	MOVO    X3, X8       // <--                                  // movdqa	xmm8, xmm3
+	MOVO    X3, X10      // <--                                  // movdqa	xmm10, xmm3
+	PXOR    X0, X7       // <--                                  // pxor	xmm7, xmm0
+	POR     X5, X0       // <--                                  // por	xmm0, xmm5
+	PADDB   X4, X0       // <--                                  // paddb	xmm0, xmm4
+	PCMPGTB X0, X8       // <--                                  // pcmpgtb	xmm8, xmm0
+	MOVO    X2, X0       // <--                                  // movdqa	xmm0, xmm2
+	PCMPEQB X7, X0       // <--                                  // pcmpeqb	xmm0, xmm7
+	PAND    X1, X0       // <--                                  // pand	xmm0, xmm1
+	PAND    X8, X0       // <--                                  // pand	xmm0, xmm8
+	MOVOU   0x10(SI), X8 // <--                                  // movdqu	xmm8, xmmword ptr [rsi + 16]
+	MOVO    X0, X9       // <--                                  // movdqa	xmm9, xmm0
+	MOVOU   0x10(AX), X0 // <--                                  // movdqu	xmm0, xmmword ptr [rax + 16]
+	PSLLW   $0x5, X9     // <--                                  // psllw	xmm9, 5
+	PXOR    X0, X8       // <--                                  // pxor	xmm8, xmm0
+	PCMPEQB X9, X7       // <--                                  // pcmpeqb	xmm7, xmm9
+	POR     X5, X0       // <--                                  // por	xmm0, xmm5
+	PADDB   X4, X0       // <--                                  // paddb	xmm0, xmm4
+	PCMPGTB X0, X10      // <--                                  // pcmpgtb	xmm10, xmm0
+	MOVO    X2, X0       // <--                                  // movdqa	xmm0, xmm2
+	PCMPEQB X8, X0       // <--                                  // pcmpeqb	xmm0, xmm8
+	PAND    X1, X0       // <--                                  // pand	xmm0, xmm1
+	PAND    X10, X0      // <--                                  // pand	xmm0, xmm10
+	PSLLW   $0x5, X0     // <--                                  // psllw	xmm0, 5
+	PCMPEQB X8, X0       // <--                                  // pcmpeqb	xmm0, xmm8
+	PAND    X7, X0       // <--                                  // pand	xmm0, xmm7
+	PTEST   X6, X0       // <--                                  // ptest	xmm0, xmm6
+	JB      LBB1_0       // <--                                  // jb	.LBB1_0
+	XORL    R9, R9       // <--                                  // xor	r9d, r9d
+
+LBB1_2:
+	MOVL R9, AX         // <--                                  // mov	eax, r9d
+	MOVB AX, ret+32(FP) // <--
 	RET                 // <--                                  // ret
 
-LBB0_14:
-	MOVQ -0x8(DI)(SI*1), AX                // <--                                  // mov	rax, qword ptr [rdi + rsi - 8]
-	ORQ  0(DI), AX                         // <--                                  // or	rax, qword ptr [rdi]
-	QUAD $0x808080808080b948; WORD $0x8080 // MOVQ $0x8080808080808080, CX         // movabs	rcx, -9187201950435737472
-	WORD $0x8548; BYTE $0xc8               // TESTQ CX, AX                         // test	rax, rcx
-	WORD $0x940f; BYTE $0xc0               // SETE AL                              // sete	al
-	NOP                                    // (skipped)                            // mov	rsp, rbp
-	NOP                                    // (skipped)                            // pop	rbp
-	MOVB AX, ret+16(FP)                    // <--
-	RET                                    // <--                                  // ret
-
-LBB0_15:
-	XORL AX, AX         // <--                                  // xor	eax, eax
-	NOP                 // (skipped)                            // mov	rsp, rbp
-	NOP                 // (skipped)                            // pop	rbp
-	MOVB AX, ret+16(FP) // <--
+LBB1_3:
+	BYTE $0x55                    // PUSHQ BP                             // push	rbp
+	MOVQ SP, BP                   // <--                                  // mov	rbp, rsp
+	WORD $0x5441                  // PUSHQ R12                            // push	r12
+	BYTE $0x53                    // PUSHQ BX                             // push	rbx
+	CMPQ DI, $0x7                 // <--                                  // cmp	rdi, 7
+	JBE  LBB1_11                  // <--                                  // jbe	.LBB1_11
+	MOVQ 0(AX), R10               // <--                                  // mov	r10, qword ptr [rax]
+	MOVQ 0(DX), R8                // <--                                  // mov	r8, qword ptr [rdx]
+	CMPQ R10, R8                  // <--                                  // cmp	r10, r8
+	JE   LBB1_4                   // <--                                  // je	.LBB1_4
+	MOVQ $0x7f7f7f7f7f7f7f7f, BX  // <--                                  // movabs	rbx, 9187201950435737471
+	MOVQ R10, R11                 // <--                                  // mov	r11, r10
+	MOVQ $-0x505050505050506, DX  // <--                                  // movabs	rdx, -361700864190383366
+	MOVQ $0x1f1f1f1f1f1f1f1f, R12 // <--                                  // movabs	r12, 2242545357980376863
+	ANDQ BX, R11                  // <--                                  // and	r11, rbx
+	MOVQ DX, CX                   // <--                                  // mov	rcx, rdx
+	ANDQ R8, BX                   // <--                                  // and	rbx, r8
+	SUBQ R11, CX                  // <--                                  // sub	rcx, r11
+	ADDQ R12, R11                 // <--                                  // add	r11, r12
+	SUBQ BX, DX                   // <--                                  // sub	rdx, rbx
+	ADDQ R12, BX                  // <--                                  // add	rbx, r12
+	ANDQ R11, CX                  // <--                                  // and	rcx, r11
+	MOVQ R10, R11                 // <--                                  // mov	r11, r10
+	ANDQ BX, DX                   // <--                                  // and	rdx, rbx
+	NOTQ R11                      // <--                                  // not	r11
+	ANDQ R11, CX                  // <--                                  // and	rcx, r11
+	MOVQ $0x2020202020202020, R11 // <--                                  // movabs	r11, 2314885530818453536
+	SHRQ $0x2, CX                 // <--                                  // shr	rcx, 2
+	ANDQ R11, CX                  // <--                                  // and	rcx, r11
+	SUBQ CX, R10                  // <--                                  // sub	r10, rcx
+	MOVQ R8, CX                   // <--                                  // mov	rcx, r8
+	NOTQ CX                       // <--                                  // not	rcx
+	ANDQ CX, DX                   // <--                                  // and	rdx, rcx
+	SHRQ $0x2, DX                 // <--                                  // shr	rdx, 2
+	ANDQ R11, DX                  // <--                                  // and	rdx, r11
+	SUBQ DX, R8                   // <--                                  // sub	r8, rdx
+	CMPQ R10, R8                  // <--                                  // cmp	r10, r8
+	JNE  LBB1_6                   // <--                                  // jne	.LBB1_6
+
+LBB1_4:
+	MOVL $0x8, DX // <--                                  // mov	edx, 8
+
+LBB1_5:
+	CMPQ    DX, DI            // <--                                  // cmp	rdx, rdi
+	JAE     LBB1_10           // <--                                  // jae	.LBB1_10
+	MOVBLZX 0(AX)(DX*1), CX   // <--                                  // movzx	ecx, byte ptr [rax + rdx]
+	MOVBLZX 0(SI)(DX*1), R8   // <--                                  // movzx	r8d, byte ptr [rsi + rdx]
+	LEAL    -0x61(CX), R10    // <--                                  // lea	r10d, [rcx - 97]
+	LEAL    -0x20(CX), R9     // <--                                  // lea	r9d, [rcx - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	LEAL    -0x61(R8), R10    // <--                                  // lea	r10d, [r8 - 97]
+	CMOVLCS R9, CX            // <--                                  // cmovb	ecx, r9d
+	LEAL    -0x20(R8), R9     // <--                                  // lea	r9d, [r8 - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	CMOVLCS R9, R8            // <--                                  // cmovb	r8d, r9d
+	CMPB    R8, CX            // <--                                  // cmp	r8b, cl
+	JNE     LBB1_9            // <--                                  // jne	.LBB1_9
+	LEAQ    0x1(DX), CX       // <--                                  // lea	rcx, [rdx + 1]
+	CMPQ    CX, DI            // <--                                  // cmp	rcx, rdi
+	JAE     LBB1_10           // <--                                  // jae	.LBB1_10
+	MOVBLZX 0x1(AX)(DX*1), CX // <--                                  // movzx	ecx, byte ptr [rax + rdx + 1]
+	MOVBLZX 0x1(SI)(DX*1), R8 // <--                                  // movzx	r8d, byte ptr [rsi + rdx + 1]
+	LEAL    -0x61(CX), R10    // <--                                  // lea	r10d, [rcx - 97]
+	LEAL    -0x20(CX), R9     // <--                                  // lea	r9d, [rcx - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	LEAL    -0x61(R8), R10    // <--                                  // lea	r10d, [r8 - 97]
+	CMOVLCS R9, CX            // <--                                  // cmovb	ecx, r9d
+	LEAL    -0x20(R8), R9     // <--                                  // lea	r9d, [r8 - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	CMOVLCS R9, R8            // <--                                  // cmovb	r8d, r9d
+	CMPB    R8, CX            // <--                                  // cmp	r8b, cl
+	JNE     LBB1_9            // <--                                  // jne	.LBB1_9
+	LEAQ    0x2(DX), CX       // <--                                  // lea	rcx, [rdx + 2]
+	CMPQ    CX, DI            // <--                                  // cmp	rcx, rdi
+	JAE     LBB1_10           // <--                                  // jae	.LBB1_10
+	MOVBLZX 0x2(AX)(DX*1), CX // <--                                  // movzx	ecx, byte ptr [rax + rdx + 2]
+	MOVBLZX 0x2(SI)(DX*1), R8 // <--                                  // movzx	r8d, byte ptr [rsi + rdx + 2]
+	LEAL    -0x61(CX), R10    // <--                                  // lea	r10d, [rcx - 97]
+	LEAL    -0x20(CX), R9     // <--                                  // lea	r9d, [rcx - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	LEAL    -0x61(R8), R10    // <--                                  // lea	r10d, [r8 - 97]
+	CMOVLCS R9, CX            // <--                                  // cmovb	ecx, r9d
+	LEAL    -0x20(R8), R9     // <--                                  // lea	r9d, [r8 - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	CMOVLCS R9, R8            // <--                                  // cmovb	r8d, r9d
+	CMPB    R8, CX            // <--                                  // cmp	r8b, cl
+	JNE     LBB1_9            // <--                                  // jne	.LBB1_9
+	LEAQ    0x3(DX), CX       // <--                                  // lea	rcx, [rdx + 3]
+	CMPQ    CX, DI            // <--                                  // cmp	rcx, rdi
+	JAE     LBB1_10           // <--                                  // jae	.LBB1_10
+	MOVBLZX 0x3(AX)(DX*1), CX // <--                                  // movzx	ecx, byte ptr [rax + rdx + 3]
+	MOVBLZX 0x3(SI)(DX*1), R8 // <--                                  // movzx	r8d, byte ptr [rsi + rdx + 3]
+	LEAL    -0x61(CX), R10    // <--                                  // lea	r10d, [rcx - 97]
+	LEAL    -0x20(CX), R9     // <--                                  // lea	r9d, [rcx - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	LEAL    -0x61(R8), R10    // <--                                  // lea	r10d, [r8 - 97]
+	CMOVLCS R9, CX            // <--                                  // cmovb	ecx, r9d
+	LEAL    -0x20(R8), R9     // <--                                  // lea	r9d, [r8 - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	CMOVLCS R9, R8            // <--                                  // cmovb	r8d, r9d
+	CMPB    R8, CX            // <--                                  // cmp	r8b, cl
+	JNE     LBB1_9            // <--                                  // jne	.LBB1_9
+	LEAQ    0x4(DX), CX       // <--                                  // lea	rcx, [rdx + 4]
+	CMPQ    CX, DI            // <--                                  // cmp	rcx, rdi
+	JAE     LBB1_10           // <--                                  // jae	.LBB1_10
+	MOVBLZX 0x4(AX)(DX*1), CX // <--                                  // movzx	ecx, byte ptr [rax + rdx + 4]
+	MOVBLZX 0x4(SI)(DX*1), R8 // <--                                  // movzx	r8d, byte ptr [rsi + rdx + 4]
+	LEAL    -0x61(CX), R10    // <--                                  // lea	r10d, [rcx - 97]
+	LEAL    -0x20(CX), R9     // <--                                  // lea	r9d, [rcx - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	LEAL    -0x61(R8), R10    // <--                                  // lea	r10d, [r8 - 97]
+	CMOVLCS R9, CX            // <--                                  // cmovb	ecx, r9d
+	LEAL    -0x20(R8), R9     // <--                                  // lea	r9d, [r8 - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	CMOVLCS R9, R8            // <--                                  // cmovb	r8d, r9d
+	CMPB    R8, CX            // <--                                  // cmp	r8b, cl
+	JNE     LBB1_9            // <--                                  // jne	.LBB1_9
+	LEAQ    0x5(DX), CX       // <--                                  // lea	rcx, [rdx + 5]
+	CMPQ    CX, DI            // <--                                  // cmp	rcx, rdi
+	JAE     LBB1_10           // <--                                  // jae	.LBB1_10
+	MOVBLZX 0x5(AX)(DX*1), CX // <--                                  // movzx	ecx, byte ptr [rax + rdx + 5]
+	MOVBLZX 0x5(SI)(DX*1), R8 // <--                                  // movzx	r8d, byte ptr [rsi + rdx + 5]
+	LEAL    -0x61(CX), R10    // <--                                  // lea	r10d, [rcx - 97]
+	LEAL    -0x20(CX), R9     // <--                                  // lea	r9d, [rcx - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	LEAL    -0x61(R8), R10    // <--                                  // lea	r10d, [r8 - 97]
+	CMOVLCS R9, CX            // <--                                  // cmovb	ecx, r9d
+	LEAL    -0x20(R8), R9     // <--                                  // lea	r9d, [r8 - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	CMOVLCS R9, R8            // <--                                  // cmovb	r8d, r9d
+	CMPB    R8, CX            // <--                                  // cmp	r8b, cl
+	JNE     LBB1_9            // <--                                  // jne	.LBB1_9
+	LEAQ    0x6(DX), CX       // <--                                  // lea	rcx, [rdx + 6]
+	CMPQ    CX, DI            // <--                                  // cmp	rcx, rdi
+	JAE     LBB1_10           // <--                                  // jae	.LBB1_10
+	MOVBLZX 0x6(AX)(DX*1), CX // <--                                  // movzx	ecx, byte ptr [rax + rdx + 6]
+	MOVBLZX 0x6(SI)(DX*1), R8 // <--                                  // movzx	r8d, byte ptr [rsi + rdx + 6]
+	LEAL    -0x61(CX), R10    // <--                                  // lea	r10d, [rcx - 97]
+	LEAL    -0x20(CX), R9     // <--                                  // lea	r9d, [rcx - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	LEAL    -0x61(R8), R10    // <--                                  // lea	r10d, [r8 - 97]
+	CMOVLCS R9, CX            // <--                                  // cmovb	ecx, r9d
+	LEAL    -0x20(R8), R9     // <--                                  // lea	r9d, [r8 - 32]
+	CMPB    R10, $0x1a        // <--                                  // cmp	r10b, 26
+	CMOVLCS R9, R8            // <--                                  // cmovb	r8d, r9d
+	CMPB    R8, CX            // <--                                  // cmp	r8b, cl
+	JNE     LBB1_9            // <--                                  // jne	.LBB1_9
+	ADDQ    $0x7, DX          // <--                                  // add	rdx, 7
+	CMPQ    DX, DI            // <--                                  // cmp	rdx, rdi
+	JAE     LBB1_10           // <--                                  // jae	.LBB1_10
+	MOVBLZX 0x7(AX), DX       // <--                                  // movzx	edx, byte ptr [rax + 7]
+	MOVBLZX 0x7(SI), AX       // <--                                  // movzx	eax, byte ptr [rsi + 7]
+	LEAL    -0x61(DX), SI     // <--                                  // lea	esi, [rdx - 97]
+	LEAL    -0x20(DX), CX     // <--                                  // lea	ecx, [rdx - 32]
+	CMPB    SI, $0x1a         // <--                                  // cmp	sil, 26
+	LEAL    -0x61(AX), SI     // <--                                  // lea	esi, [rax - 97]
+	CMOVLCS CX, DX            // <--                                  // cmovb	edx, ecx
+	CMPB    SI, $0x1a         // <--                                  // cmp	sil, 26
+	LEAL    -0x20(AX), CX     // <--                                  // lea	ecx, [rax - 32]
+	CMOVLCS CX, AX            // <--                                  // cmovb	eax, ecx
+	CMPB    DX, AX            // <--                                  // cmp	dl, al
+	SETEQ   R9                // <--                                  // sete	r9b
+
+LBB1_6:
+	BYTE $0x5b          // POPQ BX                              // pop	rbx
+	MOVL R9, AX         // <--                                  // mov	eax, r9d
+	WORD $0x5c41        // POPQ R12                             // pop	r12
+	BYTE $0x5d          // POPQ BP                              // pop	rbp
+	MOVB AX, ret+32(FP) // <--
 	RET                 // <--                                  // ret
 
-LBB0_16:
-	LONG $0xfc37448b             // MOVL -0x4(DI)(SI*1), AX              // mov	eax, dword ptr [rdi + rsi - 4]
-	WORD $0x070b                 // ORL 0(DI), AX                        // or	eax, dword ptr [rdi]
-	LONG $0x808080a9; BYTE $0x80 // TESTL $-0x7f7f7f80, AX               // test	eax, -2139062144
-	WORD $0x940f; BYTE $0xc0     // SETE AL                              // sete	al
-	NOP                          // (skipped)                            // mov	rsp, rbp
-	NOP                          // (skipped)                            // pop	rbp
-	MOVB AX, ret+16(FP)          // <--
-	RET                          // <--                                  // ret
+LBB1_7:
+	MOVQ    DI, DX            // <--                                  // mov	rdx, rdi
+	ANDL    $0x1f, DX         // <--                                  // and	edx, 31
+	ANDL    $0x10, DI         // <--                                  // and	edi, 16
+	JE      LBB1_8            // <--                                  // je	.LBB1_8
+	MOVOU   0(AX), X6         // <--                                  // movdqu	xmm6, xmmword ptr [rax]
+	MOVOU   0(SI), X1         // <--                                  // movdqu	xmm1, xmmword ptr [rsi]
+	XORL    R9, R9            // <--                                  // xor	r9d, r9d
+	MOVO    LCPI1_0<>(SB), X0 // <--                                  // movdqa	xmm0, xmmword ptr [rip + 0]
+	MOVO    LCPI1_2<>(SB), X2 // <--                                  // movdqa	xmm2, xmmword ptr [rip + 0]
+	PXOR    X6, X1            // <--                                  // pxor	xmm1, xmm6
+	POR     X6, X0            // <--                                  // por	xmm0, xmm6
+	PADDB   LCPI1_1<>(SB), X0 // <--                                  // paddb	xmm0, xmmword ptr [rip + 0]
+	PCMPGTB X0, X2            // <--                                  // pcmpgtb	xmm2, xmm0
+	MOVO    X1, X0            // <--                                  // movdqa	xmm0, xmm1
+	PCMPEQB LCPI1_0<>(SB), X0 // <--                                  // pcmpeqb	xmm0, xmmword ptr [rip + 0]
+	PAND    LCPI1_3<>(SB), X0 // <--                                  // pand	xmm0, xmmword ptr [rip + 0]
+	PAND    X2, X0            // <--                                  // pand	xmm0, xmm2
+	PSLLW   $0x5, X0          // <--                                  // psllw	xmm0, 5
+	PCMPEQB X1, X0            // <--                                  // pcmpeqb	xmm0, xmm1
+	LONG    $0xc9760f66       // PCMPEQD X1, X1                       // pcmpeqd	xmm1, xmm1
+	PTEST   X1, X0            // <--                                  // ptest	xmm0, xmm1
+	JAE     LBB1_2            // <--                                  // jae	.LBB1_2
+	ADDQ    $0x10, AX         // <--                                  // add	rax, 16
+	ADDQ    $0x10, SI         // <--                                  // add	rsi, 16
+	SUBQ    $0x10, DX         // <--                                  // sub	rdx, 16
+
+LBB1_8:
+	MOVL    $0x1, R9            // <--                                  // mov	r9d, 1
+	TESTQ   DX, DX              // <--                                  // test	rdx, rdx
+	JE      LBB1_2              // <--                                  // je	.LBB1_2
+	MOVOU   -0x10(AX)(DX*1), X0 // <--                                  // movdqu	xmm0, xmmword ptr [rax + rdx - 16]
+	MOVOU   -0x10(SI)(DX*1), X1 // <--                                  // movdqu	xmm1, xmmword ptr [rsi + rdx - 16]
+	MOVO    LCPI1_2<>(SB), X2   // <--                                  // movdqa	xmm2, xmmword ptr [rip + 0]
+	PXOR    X0, X1              // <--                                  // pxor	xmm1, xmm0
+	POR     LCPI1_0<>(SB), X0   // <--                                  // por	xmm0, xmmword ptr [rip + 0]
+	PADDB   LCPI1_1<>(SB), X0   // <--                                  // paddb	xmm0, xmmword ptr [rip + 0]
+	PCMPGTB X0, X2              // <--                                  // pcmpgtb	xmm2, xmm0
+	MOVO    X1, X0              // <--                                  // movdqa	xmm0, xmm1
+	PCMPEQB LCPI1_0<>(SB), X0   // <--                                  // pcmpeqb	xmm0, xmmword ptr [rip + 0]
+	PAND    LCPI1_3<>(SB), X0   // <--                                  // pand	xmm0, xmmword ptr [rip + 0]
+	PAND    X2, X0              // <--                                  // pand	xmm0, xmm2
+	PSLLW   $0x5, X0            // <--                                  // psllw	xmm0, 5
+	PCMPEQB X1, X0              // <--                                  // pcmpeqb	xmm0, xmm1
+	LONG    $0xc9760f66         // PCMPEQD X1, X1                       // pcmpeqd	xmm1, xmm1
+	PTEST   X1, X0              // <--                                  // ptest	xmm0, xmm1
+	SETCS   R9                  // <--                                  // setb	r9b
+	JMP     LBB1_2              // <--                                  // jmp	.LBB1_2
+
+LBB1_9:
+	XORL R9, R9 // <--                                  // xor	r9d, r9d
+	JMP  LBB1_6 // <--                                  // jmp	.LBB1_6
+
+LBB1_10:
+	MOVL $0x1, R9 // <--                                  // mov	r9d, 1
+	JMP  LBB1_6   // <--                                  // jmp	.LBB1_6
+
+LBB1_11:
+	WORD $0xd231 // XORL DX, DX                          // xor	edx, edx
+	JMP  LBB1_5  // <--                                  // jmp	.LBB1_5
+
+TEXT ·indexMaskSse(SB), NOSPLIT, $0-32
+	MOVQ    data+0(FP), DI
+	MOVQ    data_len+8(FP), SI
+	MOVBQZX mask+16(FP), DX
+	MOVQ    DI, CX     // <--                                  // mov	rcx, rdi
+	CMPQ    SI, $0xf   // <--                                  // cmp	rsi, 15
+	JBE     LBB2_2     // <--                                  // jbe	.LBB2_2
+	MOVQ    SI, DI     // <--                                  // mov	rdi, rsi
+	MOVL    DX, X4     // <--                                  // movd	xmm4, edx
+	PXOR    X0, X0     // <--                                  // pxor	xmm0, xmm0
+	MOVQ    CX, AX     // <--                                  // mov	rax, rcx
+	ANDQ    $-0x40, DI // <--                                  // and	rdi, -64
+	PSHUFB  X0, X4     // <--                                  // pshufb	xmm4, xmm0
+	ADDQ    CX, DI     // <--                                  // add	rdi, rcx
+	MOVO    X4, X7     // <--                                  // movdqa	xmm7, xmm4
+	CMPQ    CX, DI     // <--                                  // cmp	rcx, rdi
+	JAE     LBB2_8     // <--                                  // jae	.LBB2_8
+
+LBB2_0:
+	MOVOU    0x30(AX), X0 // <--                                  // movdqu	xmm0, xmmword ptr [rax + 48]
+	MOVOU    0x10(AX), X2 // <--                                  // movdqu	xmm2, xmmword ptr [rax + 16]
+	MOVOU    0x20(AX), X1 // <--                                  // movdqu	xmm1, xmmword ptr [rax + 32]
+	MOVOU    0(AX), X3    // <--                                  // movdqu	xmm3, xmmword ptr [rax]
+	MOVO     X0, X5       // <--                                  // movdqa	xmm5, xmm0
+	MOVO     X2, X6       // <--                                  // movdqa	xmm6, xmm2
+	POR      X1, X5       // <--                                  // por	xmm5, xmm1
+	POR      X3, X6       // <--                                  // por	xmm6, xmm3
+	POR      X6, X5       // <--                                  // por	xmm5, xmm6
+	PTEST    X7, X5       // <--                                  // ptest	xmm5, xmm7
+	JE       LBB2_7       // <--                                  // je	.LBB2_7
+	PXOR     X5, X5       // <--                                  // pxor	xmm5, xmm5
+	PAND     X4, X2       // <--                                  // pand	xmm2, xmm4
+	PAND     X4, X1       // <--                                  // pand	xmm1, xmm4
+	SUBQ     CX, AX       // <--                                  // sub	rax, rcx
+	PCMPEQB  X5, X2       // <--                                  // pcmpeqb	xmm2, xmm5
+	PCMPEQB  X5, X1       // <--                                  // pcmpeqb	xmm1, xmm5
+	PAND     X4, X3       // <--                                  // pand	xmm3, xmm4
+	PCMPEQB  X5, X3       // <--                                  // pcmpeqb	xmm3, xmm5
+	PAND     X4, X0       // <--                                  // pand	xmm0, xmm4
+	PCMPEQB  X5, X0       // <--                                  // pcmpeqb	xmm0, xmm5
+	PMOVMSKB X2, DX       // <--                                  // pmovmskb	edx, xmm2
+	PMOVMSKB X1, SI       // <--                                  // pmovmskb	esi, xmm1
+	NOTL     DX           // <--                                  // not	edx
+	NOTL     SI           // <--                                  // not	esi
+	PMOVMSKB X3, R8       // <--                                  // pmovmskb	r8d, xmm3
+	MOVWLZX  DX, DX       // <--                                  // movzx	edx, dx
+	MOVWLZX  SI, SI       // <--                                  // movzx	esi, si
+	PMOVMSKB X0, DI       // <--                                  // pmovmskb	edi, xmm0
+	SHLQ     $0x20, SI    // <--                                  // shl	rsi, 32
+	SHLQ     $0x10, DX    // <--                                  // shl	rdx, 16
+	ORQ      SI, DX       // <--                                  // or	rdx, rsi
+	MOVL     R8, SI       // <--                                  // mov	esi, r8d
+	NOTL     SI           // <--                                  // not	esi
+	MOVWLZX  SI, SI       // <--                                  // movzx	esi, si
+	ORQ      SI, DX       // <--                                  // or	rdx, rsi
+	MOVL     DI, SI       // <--                                  // mov	esi, edi
+	MOVQ     AX, DI       // <--                                  // mov	rdi, rax
+	NOTL     SI           // <--                                  // not	esi
+	SHLQ     $0x30, SI    // <--                                  // shl	rsi, 48
+	ORQ      SI, DX       // <--                                  // or	rdx, rsi
+	TZCNTQ   DX, DX       // <--                                  // tzcnt	rdx, rdx
+	MOVLQSX  DX, DX       // <--                                  // movsxd	rdx, edx
+	ADDQ     DX, DI       // <--                                  // add	rdi, rdx
+
+LBB2_1:
+	MOVQ DI, AX         // <--                                  // mov	rax, rdi
+	MOVQ AX, ret+24(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB2_2:
+	MOVQ DI, AX // <--                                  // mov	rax, rdi
+
+LBB2_3:
+	MOVBLZX DX, DX                  // <--                                  // movzx	edx, dl
+	LONG    $0x101d269; WORD $0x101 // IMULL $0x1010101, DX, DX             // imul	edx, edx, 16843009
+	CMPQ    SI, $0x7                // <--                                  // cmp	rsi, 7
+	JA      LBB2_10                 // <--                                  // ja	.LBB2_10
+
+LBB2_4:
+	CMPQ SI, $0x3  // <--                                  // cmp	rsi, 3
+	JBE  LBB2_5    // <--                                  // jbe	.LBB2_5
+	MOVL DX, DI    // <--                                  // mov	edi, edx
+	ANDL 0(AX), DI // <--                                  // and	edi, dword ptr [rax]
+	JNE  LBB2_13   // <--                                  // jne	.LBB2_13
+	ADDQ $0x4, AX  // <--                                  // add	rax, 4
+	SUBQ $0x4, SI  // <--                                  // sub	rsi, 4
+
+LBB2_5:
+	MOVQ    $-0x1, DI   // <--                                  // mov	rdi, -1
+	TESTQ   SI, SI      // <--                                  // test	rsi, rsi
+	JE      LBB2_1      // <--                                  // je	.LBB2_1
+	MOVBLZX 0(AX), DI   // <--                                  // movzx	edi, byte ptr [rax]
+	CMPQ    SI, $0x1    // <--                                  // cmp	rsi, 1
+	JE      LBB2_6      // <--                                  // je	.LBB2_6
+	MOVBLZX 0x1(AX), R8 // <--                                  // movzx	r8d, byte ptr [rax + 1]
+	SHLL    $0x8, R8    // <--                                  // shl	r8d, 8
+	ORL     R8, DI      // <--                                  // or	edi, r8d
+	CMPQ    SI, $0x3    // <--                                  // cmp	rsi, 3
+	JNE     LBB2_6      // <--                                  // jne	.LBB2_6
+	MOVBLZX 0x2(AX), SI // <--                                  // movzx	esi, byte ptr [rax + 2]
+	SHLL    $0x10, SI   // <--                                  // shl	esi, 16
+	ORL     SI, DI      // <--                                  // or	edi, esi
+
+LBB2_6:
+	ANDL    DI, DX          // <--                                  // and	edx, edi
+	JE      LBB2_16         // <--                                  // je	.LBB2_16
+	TZCNTL  DX, DX          // <--                                  // tzcnt	edx, edx
+	SUBQ    CX, AX          // <--                                  // sub	rax, rcx
+	SARL    $0x3, DX        // <--                                  // sar	edx, 3
+	MOVLQSX DX, DX          // <--                                  // movsxd	rdx, edx
+	LEAQ    0(AX)(DX*1), DI // <--                                  // lea	rdi, [rax + rdx]
+	MOVQ    DI, AX          // <--                                  // mov	rax, rdi
+	MOVQ    AX, ret+24(FP)  // <--
+	RET                     // <--                                  // ret
+
+LBB2_7:
+	ADDQ $0x40, AX // <--                                  // add	rax, 64
+	CMPQ AX, DI    // <--                                  // cmp	rax, rdi
+	JB   LBB2_0    // <--                                  // jb	.LBB2_0
+
+LBB2_8:
+	MOVQ SI, DI    // <--                                  // mov	rdi, rsi
+	ANDL $0x30, DI // <--                                  // and	edi, 48
+	ADDQ AX, DI    // <--                                  // add	rdi, rax
+	CMPQ AX, DI    // <--                                  // cmp	rax, rdi
+	JAE  LBB2_15   // <--                                  // jae	.LBB2_15
+
+LBB2_9:
+	MOVOU    0(AX), X0   // <--                                  // movdqu	xmm0, xmmword ptr [rax]
+	PTEST    X7, X0      // <--                                  // ptest	xmm0, xmm7
+	JE       LBB2_14     // <--                                  // je	.LBB2_14
+	PAND     X4, X0      // <--                                  // pand	xmm0, xmm4
+	PXOR     X1, X1      // <--                                  // pxor	xmm1, xmm1
+	SUBQ     CX, AX      // <--                                  // sub	rax, rcx
+	PCMPEQB  X1, X0      // <--                                  // pcmpeqb	xmm0, xmm1
+	MOVQ     AX, DI      // <--                                  // mov	rdi, rax
+	PMOVMSKB X0, DX      // <--                                  // pmovmskb	edx, xmm0
+	XORL     $0xffff, DX // <--                                  // xor	edx, 65535
+	TZCNTL   DX, DX      // <--                                  // tzcnt	edx, edx
+	MOVLQSX  DX, AX      // <--                                  // movsxd	rax, edx
+	ADDQ     AX, DI      // <--                                  // add	rdi, rax
+	JMP      LBB2_1      // <--                                  // jmp	.LBB2_1
+
+LBB2_10:
+	MOVQ DX, DI    // <--                                  // mov	rdi, rdx
+	MOVL DX, R8    // <--                                  // mov	r8d, edx
+	SHLQ $0x20, DI // <--                                  // shl	rdi, 32
+	ADDQ R8, DI    // <--                                  // add	rdi, r8
+	ANDQ 0(AX), DI // <--                                  // and	rdi, qword ptr [rax]
+	JNE  LBB2_11   // <--                                  // jne	.LBB2_11
+	ADDQ $0x8, AX  // <--                                  // add	rax, 8
+	SUBQ $0x8, SI  // <--                                  // sub	rsi, 8
+	JMP  LBB2_4    // <--                                  // jmp	.LBB2_4
+
+LBB2_11:
+	XORL   DX, DX // <--                                  // xor	edx, edx
+	TZCNTQ DI, DX // <--                                  // tzcnt	rdx, rdi
+
+LBB2_12:
+	SUBQ CX, AX         // <--                                  // sub	rax, rcx
+	MOVQ AX, DI         // <--                                  // mov	rdi, rax
+	MOVL DX, AX         // <--                                  // mov	eax, edx
+	SARL $0x3, AX       // <--                                  // sar	eax, 3
+	CDQE                // <--                                  // cdqe
+	ADDQ AX, DI         // <--                                  // add	rdi, rax
+	MOVQ DI, AX         // <--                                  // mov	rax, rdi
+	MOVQ AX, ret+24(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB2_13:
+	XORL   DX, DX  // <--                                  // xor	edx, edx
+	TZCNTL DI, DX  // <--                                  // tzcnt	edx, edi
+	JMP    LBB2_12 // <--                                  // jmp	.LBB2_12
+
+LBB2_14:
+	ADDQ $0x10, AX // <--                                  // add	rax, 16
+	CMPQ AX, DI    // <--                                  // cmp	rax, rdi
+	JB   LBB2_9    // <--                                  // jb	.LBB2_9
+
+LBB2_15:
+	ANDL $0xf, SI // <--                                  // and	esi, 15
+	JMP  LBB2_3   // <--                                  // jmp	.LBB2_3
+
+LBB2_16:
+	MOVQ $-0x1, DI // <--                                  // mov	rdi, -1
+	JMP  LBB2_1    // <--                                  // jmp	.LBB2_1
@@ -2,8 +2,11 @@ package ascii
 
 import (
 	"bytes"
+	"encoding/json"
 	"fmt"
 	"math/rand"
+	"regexp"
+	"slices"
 	"strings"
 	"testing"
 	"unicode"
@@ -62,6 +65,29 @@ func TestAscii(t *testing.T) {
 	}
 }
 
+func TestSelectISA(t *testing.T) {
+	tests := []struct {
+		override string
+		best     isa
+		want     isa
+	}{
+		{"", isaAVX512, isaAVX512},
+		{"generic", isaAVX512, isaGeneric},
+		{"sse41", isaAVX2, isaSSE41},
+		{"avx2", isaAVX512, isaAVX2},
+		{"avx512", isaAVX2, isaAVX2},
+		{"neon", isaAVX2, isaAVX2},
+		{"avx2", isaNEON, isaNEON},
+		{"generic", isaNEON, isaGeneric},
+		{"AVX2", isaAVX512, isaAVX512},
+	}
+	for _, tt := range tests {
+		if got := selectISA(tt.override, tt.best); got != tt.want {
+			t.Errorf("selectISA(%q, %s) = %s, want %s", tt.override, isaNames[tt.best], isaNames[got], isaNames[tt.want])
+		}
+	}
+}
+
 func TestIndexMask(t *testing.T) {
 	for i := 4; i < 6400; i++ {
 		data := makeASCII(i)
@@ -449,7 +475,7 @@ func BenchmarkAsciiIndexFold(b *testing.B) {
 			b.SetBytes(int64(len(s1)))
 			rare1, off1, rare2, off2 := selectRarePairSample(s2, nil, false)
 			for i := 0; i < b.N; i++ {
-				indexFoldNEONC(s1, rare1, off1, rare2, off2, s2)
+				indexFoldC(s1, rare1, off1, rare2, off2, s2)
 			}
 		})
 	}
@@ -495,7 +521,7 @@ func BenchmarkIndexTorture(b *testing.B) {
 	rare1, off1, rare2, off2 := selectRarePairSample(benchNeedleTorture, nil, false)
 	b.Run("simd-c", func(b *testing.B) {
 		for i := 0; i < b.N; i++ {
-			indexFoldNEONC(benchInputTorture, rare1, off1, rare2, off2, benchNeedleTorture)
+			indexFoldC(benchInputTorture, rare1, off1, rare2, off2, benchNeedleTorture)
 		}
 	})
 }
@@ -997,6 +1023,467 @@ func TestSearcherCaseSensitive(t *testing.T) {
 	}
 }
 
+func TestSearcherAll(t *testing.T) {
+	// Reference: repeated Index calls, resuming after each match
+	allIndex := func(s Searcher, haystack string) []int {
+		var want []int
+		for pos := 0; pos <= len(haystack); {
+			i := s.Index(haystack[pos:])
+			if i < 0 {
+				break
+			}
+			want = append(want, pos+i)
+			pos += i + max(len(s.raw), 1)
+		}
+		return want
+	}
+	collect := func(s Searcher, haystack string) []int {
+		var got []int
+		s.All(haystack)(func(i int) bool {
+			got = append(got, i)
+			return true
+		})
+		return got
+	}
+
+	rng := rand.New(rand.NewSource(6))
+	for _, alphabet := range []string{"aA", "abAB", `"{}:,aB`, "xyzXYZ0"} {
+		for i := 0; i < 300; i++ {
+			hay := make([]byte, rng.Intn(3000))
+			for j := range hay {
+				hay[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			needle := make([]byte, rng.Intn(6))
+			for j := range needle {
+				needle[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			h := string(hay)
+			for _, cs := range []bool{false, true} {
+				s := NewSearcher(string(needle), cs)
+				want := allIndex(s, h)
+				if got := collect(s, h); !slices.Equal(got, want) {
+					t.Fatalf("Searcher(%q, %v).All(%q) = %v, want %v", needle, cs, truncate(h, 40), got, want)
+				}
+				if got := s.AppendIndices(nil, h); !slices.Equal(got, want) {
+					t.Fatalf("Searcher(%q, %v).AppendIndices(nil, %q) = %v, want %v", needle, cs, truncate(h, 40), got, want)
+				}
+				// Spare capacity is filled in place; existing elements are kept
+				dst := append(make([]int, 0, 100), -1)
+				if got := s.AppendIndices(dst, h); got[0] != -1 || !slices.Equal(got[1:], want) {
+					t.Fatalf("Searcher(%q, %v).AppendIndices(dst, %q) = %v, want [-1 %v]", needle, cs, truncate(h, 40), got, want)
+				}
+			}
+		}
+	}
+
+	// Early exit from the iterator
+	s := NewSearcher("ab", false)
+	var got []int
+	s.All(strings.Repeat("xAb", 100))(func(i int) bool {
+		got = append(got, i)
+		return len(got) < 40
+	})
+	if want := []int{1, 4, 7}; len(got) != 40 || !slices.Equal(got[:3], want) || got[39] != 118 {
+		t.Errorf("All stopped early = %v", got)
+	}
+
+	var folds []int
+	IndexFoldAll("Foo foo FOO", "foo")(func(i int) bool {
+		folds = append(folds, i)
+		return true
+	})
+	if want := []int{0, 4, 8}; !slices.Equal(folds, want) {
+		t.Errorf("IndexFoldAll = %v, want %v", folds, want)
+	}
+}
+
+func TestSearcherWholeWord(t *testing.T) {
+	tests := []struct {
+		haystack, needle string
+		cs               bool
+		want             []int
+	}{
+		{"user id=7 valid ID", "id", false, []int{5, 16}},
+		{"user id=7 valid ID", "id", true, []int{5}},
+		{"id", "id", false, []int{0}},
+		{"idid id_x (id)", "id", false, []int{11}},
+		{"a.b a.b", "a.b", true, []int{0, 4}},
+		{"valid", "id", false, nil},
+		{"", "", false, []int{0}},
+	}
+	for _, tt := range tests {
+		s := NewSearcher(tt.needle, tt.cs).WholeWord(WordBoundary)
+		if got := s.AppendIndices(nil, tt.haystack); !slices.Equal(got, tt.want) {
+			t.Errorf("WholeWord(%q, %v).AppendIndices(%q) = %v, want %v", tt.needle, tt.cs, tt.haystack, got, tt.want)
+		}
+	}
+
+	// Reference: every match of the plain Searcher, keeping whole words only
+	wordAll := func(s Searcher, haystack string, boundary CharSet) []int {
+		var want []int
+		for pos := 0; pos <= len(haystack); {
+			i := s.Index(haystack[pos:])
+			if i < 0 {
+				break
+			}
+			i += pos
+			if (i == 0 || boundary.Contains(haystack[i-1])) &&
+				(i+len(s.raw) == len(haystack) || boundary.Contains(haystack[i+len(s.raw)])) {
+				want = append(want, i)
+				pos = i + len(s.raw)
+			} else {
+				pos = i + 1
+			}
+		}
+		return want
+	}
+
+	rng := rand.New(rand.NewSource(9))
+	boundaries := []CharSet{WordBoundary, MakeCharSet(" ,"), MakeCharSet("a")}
+	for _, alphabet := range []string{"aA b", "abAB,", `"{}:,aB `, "xyzXYZ0 _"} {
+		for i := 0; i < 300; i++ {
+			hay := make([]byte, rng.Intn(3000))
+			for j := range hay {
+				hay[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			needle := make([]byte, 1+rng.Intn(5))
+			for j := range needle {
+				needle[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			h, n := string(hay), string(needle)
+			boundary := boundaries[rng.Intn(len(boundaries))]
+			for _, cs := range []bool{false, true} {
+				plain := NewSearcher(n, cs)
+				s := plain.WholeWord(boundary)
+				want := wordAll(plain, h, boundary)
+				if got := s.AppendIndices(nil, h); !slices.Equal(got, want) {
+					t.Fatalf("WholeWord(%q, %v).AppendIndices(%q) = %v, want %v", n, cs, truncate(h, 40), got, want)
+				}
+				first := -1
+				if len(want) > 0 {
+					first = want[0]
+				}
+				if got := s.Index(h); got != first {
+					t.Fatalf("WholeWord(%q, %v).Index(%q) = %d, want %d", n, cs, truncate(h, 40), got, first)
+				}
+				if got := s.Count(h); got != len(want) {
+					t.Fatalf("WholeWord(%q, %v).Count(%q) = %d, want %d", n, cs, truncate(h, 40), got, len(want))
+				}
+				// LastIndex may find a match that overlaps the last
+				// non-overlapping one, so check it is a whole word instead
+				last := s.LastIndex(h)
+				if (last < 0) != (first < 0) || last >= 0 && (last < want[len(want)-1] ||
+					plain.Index(h[last:]) != 0 || !isWordAt(h, last, len(n), &boundary.bitset)) {
+					t.Fatalf("WholeWord(%q, %v).LastIndex(%q) = %d, matches %v", n, cs, truncate(h, 40), last, want)
+				}
+			}
+		}
+	}
+}
+
+func TestGlobSearcher(t *testing.T) {
+	tests := []struct {
+		pattern, haystack string
+		cs                bool
+		want              int
+	}{
+		{"a?c", "xabc", false, 1},
+		{"a?c", "xAbC", false, 1},
+		{"a?c", "xAbC", true, -1},
+		{"a*c", "xab\nbc", true, 1},
+		{"a*b*c", "acb", true, -1},
+		{"GET /api/*?id=??", "get /api/users?id=42", false, 0},
+		{"GET /api/*?id=??", "get /api/users?id=4", false, -1},
+		{`a\*b`, "ab a*b", true, 3},
+		{`a\?`, "ab a?", true, 3},
+		{`a\`, `xa\`, true, 1},
+		{"*abc*", "xabc", true, 0},
+		{"abc*", "xabc", true, 1},
+		{"a**b", "ab", true, 0},
+		{"??", "abc", true, 0},
+		{"?", "", true, -1},
+		{"*", "", true, 0},
+		{"", "abc", true, 0},
+	}
+	for _, tt := range tests {
+		if got := NewGlobSearcher(tt.pattern, tt.cs).Index(tt.haystack); got != tt.want {
+			t.Errorf("NewGlobSearcher(%q, %v).Index(%q) = %d, want %d", tt.pattern, tt.cs, tt.haystack, got, tt.want)
+		}
+	}
+
+	rng := rand.New(rand.NewSource(24))
+	for i := 0; i < 3000; i++ {
+		pattern := make([]byte, rng.Intn(10))
+		for j := range pattern {
+			pattern[j] = "abcAB??*"[rng.Intn(8)]
+		}
+		hay := make([]byte, rng.Intn(200))
+		for j := range hay {
+			hay[j] = "abcdAB\n"[rng.Intn(7)]
+		}
+		p, h := string(pattern), string(hay)
+		for _, cs := range []bool{false, true} {
+			want := -1
+			if loc := globRegexp(p, cs).FindStringIndex(h); loc != nil {
+				want = loc[0]
+			}
+			if got := NewGlobSearcher(p, cs).Index(h); got != want {
+				t.Fatalf("NewGlobSearcher(%q, %v).Index(%q) = %d, want %d", p, cs, h, got, want)
+			}
+		}
+	}
+}
+
+func TestCompileLike(t *testing.T) {
+	tests := []struct {
+		pattern, s string
+		cs         bool
+		want       bool
+		plan       likePlan
+	}{
+		{"abc", "ABC", false, true, likeEqual},
+		{"abc", "ABC", true, false, likeEqual},
+		{"abc", "abcd", true, false, likeEqual},
+		{"a_c", "abc", true, true, likeGeneral},
+		{"a_c", "abbc", true, false, likeGeneral},
+		{"%", "", true, true, likeAll},
+		{"%%", "x", true, true, likeAll},
+		{"GET /%", "get /index", false, true, likePrefix},
+		{"%.json", "a.JSON", false, true, likeSuffix},
+		{"%.json", "a.JSON", true, false, likeSuffix},
+		{"%abc%", "xxabcxx", true, true, likeContains},
+		{"%abc%def_", "abcdefX", false, true, likeGeneral},
+		{"%abc%def_", "abcdef", false, false, likeGeneral},
+		{"ab%ab", "ab", true, false, likeGeneral},
+		{"ab%ab", "abab", true, true, likeGeneral},
+		{`100\%`, "100%", true, true, likeEqual},
+		{`100\%`, "1000", true, false, likeEqual},
+		{`a\_%`, "a_b", true, true, likePrefix},
+		{`a\_%`, "abb", true, false, likePrefix},
+		{"%a%b%c%", "xaxbxcx", true, true, likeGeneral},
+		{"%a%b%c%", "xcxbxax", true, false, likeGeneral},
+	}
+	for _, tt := range tests {
+		m := CompileLike(tt.pattern, tt.cs)
+		if got := m.Match(tt.s); got != tt.want || m.plan != tt.plan {
+			t.Errorf("CompileLike(%q, %v).Match(%q) = %v with plan %d, want %v with plan %d", tt.pattern, tt.cs, tt.s, got, m.plan, tt.want, tt.plan)
+		}
+	}
+
+	rng := rand.New(rand.NewSource(25))
+	for i := 0; i < 2000; i++ {
+		pattern := make([]byte, rng.Intn(8))
+		for j := range pattern {
+			pattern[j] = "abAB__%%"[rng.Intn(8)]
+		}
+		p := string(pattern)
+		var data []byte
+		offsets := []uint32{0}
+		for r := rng.Intn(100); r >= 0; r-- {
+			row := make([]byte, rng.Intn(12))
+			for j := range row {
+				row[j] = "abcAB\n"[rng.Intn(6)]
+			}
+			data = append(data, row...)
+			offsets = append(offsets, uint32(len(data)))
+		}
+		rows := len(offsets) - 1
+
+		for _, cs := range []bool{false, true} {
+			m, re := CompileLike(p, cs), likeRegexp(p, cs)
+			out := make([]uint64, (rows+63)/64)
+			for j := range out {
+				out[j] = ^uint64(0)
+			}
+			m.MatchColumn(data, offsets, out)
+			for r := 0; r < rows; r++ {
+				row := string(data[offsets[r]:offsets[r+1]])
+				want := re.MatchString(row)
+				if got := m.Match(row); got != want {
+					t.Fatalf("CompileLike(%q, %v).Match(%q) = %v, want %v", p, cs, row, got, want)
+				}
+				if got := out[r/64]&(1<<(r%64)) != 0; got != want {
+					t.Fatalf("CompileLike(%q, %v): row %d %q selected = %v, want %v", p, cs, r, row, got, want)
+				}
+			}
+		}
+	}
+}
+
+// likeRegexp translates a LIKE pattern into an anchored regexp, as a
+// reference for LikeMatcher.
+func likeRegexp(pattern string, caseSensitive bool) *regexp.Regexp {
+	glob := strings.NewReplacer("_", "?", "%", "*", "?", `\?`, "*", `\*`, `\_`, "_", `\%`, "%", `\\`, `\\`).Replace(pattern)
+	return regexp.MustCompile(`^(?:` + globRegexp(glob, caseSensitive).String() + `)$`)
+}
+
+// globRegexp compiles a glob pattern into a regexp that finds the same
+// matches, as a reference for GlobSearcher.
+func globRegexp(pattern string, caseSensitive bool) *regexp.Regexp {
+	var sb strings.Builder
+	sb.WriteString("(?s)")
+	if !caseSensitive {
+		sb.WriteString("(?i)")
+	}
+	for i := 0; i < len(pattern); i++ {
+		switch c := pattern[i]; c {
+		case '*':
+			sb.WriteString(".*?")
+		case '?':
+			sb.WriteString(".")
+		default:
+			if c == '\\' && i+1 < len(pattern) {
+				i++
+				c = pattern[i]
+			}
+			sb.WriteString(regexp.QuoteMeta(string(c)))
+		}
+	}
+	return regexp.MustCompile(sb.String())
+}
+
+func TestFieldSearcher(t *testing.T) {
+	tests := []struct {
+		key, needle, haystack string
+		cs                    bool
+		want                  int
+	}{
+		{"level", "err", `{"level":"ERROR"}`, false, 10},
+		{"level", "err", `{"level":"ERROR"}`, true, -1},
+		{"level", "err", `{"msg":"error","level":"info"}`, false, -1},
+		{"level", "err", `{"msg":"\"level\":\"error\"","level":"info"}`, false, -1},
+		{"level", "err", `{"msg":"level","level" : "x error"}`, false, 28},
+		{"level", "info", `{"level":"x\"info"}`, false, 13},
+		{"level", "x", `{"level":"\\"}x`, false, -1},
+		{"level", "err", `{"x\"level":"ERROR"}`, false, -1},
+		{"level", "err", `{"x\"level":"ERROR","level":"err"}`, false, 29},
+		{"level", "err", `{"x\\","level":"ERROR"}`, false, 16},
+		{"id", "42", `{"a":{"id":7},"id": 42}`, false, 20},
+		{"a", "7", `{"a":{"id":7},"id": 42}`, false, 11},
+		{"a", "42", `{"a":[{"b":"]"}],"id": 42}`, false, -1},
+		{"a", "", `{"b":1,"a":true}`, false, 11},
+		{"a", "1", `"a"`, false, -1},
+		{"a", "1", `"a": 1`, false, 5},
+		{"a", "1", `"a":"1`, false, 5},
+	}
+	for _, tt := range tests {
+		f := NewFieldSearcher(tt.key, tt.needle, tt.cs)
+		if got := f.Index(tt.haystack); got != tt.want {
+			t.Errorf("NewFieldSearcher(%q, %q, %v).Index(%s) = %d, want %d", tt.key, tt.needle, tt.cs, tt.haystack, got, tt.want)
+		}
+	}
+
+	// Flat objects with distinct keys, against the decoded raw values
+	rng := rand.New(rand.NewSource(23))
+	keys := []string{"a", "b", "ab", "level"}
+	rnd := func(n int, alphabet string) string {
+		b := make([]byte, n)
+		for i := range b {
+			b[i] = alphabet[rng.Intn(len(alphabet))]
+		}
+		return string(b)
+	}
+	space := func() string { return rnd(rng.Intn(2), " \n") }
+	for i := 0; i < 3000; i++ {
+		var sb strings.Builder
+		sb.WriteString("{")
+		for j, k := range rng.Perm(len(keys))[:rng.Intn(len(keys)+1)] {
+			if j > 0 {
+				sb.WriteString(",")
+			}
+			var v []byte
+			if rng.Intn(4) == 0 {
+				v = []byte(fmt.Sprint(rng.Intn(1000)))
+			} else {
+				v, _ = json.Marshal(rnd(rng.Intn(12), `abAB"\:{},level `))
+			}
+			fmt.Fprintf(&sb, "%s%q%s:%s%s", space(), keys[k], space(), space(), v)
+		}
+		sb.WriteString("}")
+		h := sb.String()
+
+		var obj map[string]json.RawMessage
+		if err := json.Unmarshal([]byte(h), &obj); err != nil {
+			t.Fatalf("%s: %v", h, err)
+		}
+		key, needle, cs := keys[rng.Intn(len(keys))], rnd(rng.Intn(3)+1, `ab"\:1`), rng.Intn(2) == 0
+		raw := string(obj[key])
+		if strings.HasPrefix(raw, `"`) {
+			raw = raw[1 : len(raw)-1]
+		}
+		want := strings.Contains(raw, needle) || !cs && IndexFold(raw, needle) >= 0
+		got := NewFieldSearcher(key, needle, cs).Index(h)
+		if (got >= 0) != want || got >= 0 && (cs && h[got:got+len(needle)] != needle || !strings.EqualFold(h[got:got+len(needle)], needle)) {
+			t.Fatalf("NewFieldSearcher(%q, %q, %v).Index(%s) = %d, want match %v", key, needle, cs, h, got, want)
+		}
+	}
+}
+
+func TestCount(t *testing.T) {
+	rng := rand.New(rand.NewSource(7))
+	for _, alphabet := range []string{"aA", "abAB", `"{}:,aB`, "xyzXYZ0"} {
+		for i := 0; i < 300; i++ {
+			hay := make([]byte, rng.Intn(3000))
+			for j := range hay {
+				hay[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			needle := make([]byte, rng.Intn(6))
+			for j := range needle {
+				needle[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			h, n := string(hay), string(needle)
+
+			want := strings.Count(strings.ToLower(h), strings.ToLower(n))
+			if got := CountFold(h, n); got != want {
+				t.Fatalf("CountFold(%q, %q) = %d, want %d", truncate(h, 40), n, got, want)
+			}
+			if got := NewSearcher(n, false).Count(h); got != want {
+				t.Fatalf("Searcher(%q, false).Count(%q) = %d, want %d", n, truncate(h, 40), got, want)
+			}
+			want = strings.Count(h, n)
+			if got := NewSearcher(n, true).Count(h); got != want {
+				t.Fatalf("Searcher(%q, true).Count(%q) = %d, want %d", n, truncate(h, 40), got, want)
+			}
+		}
+	}
+}
+
+func TestLastIndex(t *testing.T) {
+	rng := rand.New(rand.NewSource(8))
+	for _, alphabet := range []string{"aA", "abAB", `"{}:,aB`, "xyzXYZ0"} {
+		for i := 0; i < 500; i++ {
+			hay := make([]byte, rng.Intn(3000))
+			for j := range hay {
+				hay[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			needle := make([]byte, rng.Intn(80))
+			for j := range needle {
+				needle[j] = alphabet[rng.Intn(len(alphabet))]
+			}
+			if rng.Intn(2) == 0 && len(hay) > len(needle) {
+				// Plant a match so the found paths get exercised too
+				copy(hay[rng.Intn(len(hay)-len(needle)):], strings.ToUpper(string(needle)))
+			}
+			h, n := string(hay), string(needle)
+
+			want := strings.LastIndex(normalizeASCII(h), normalizeASCII(n))
+			if got := LastIndexFold(h, n); got != want {
+				t.Fatalf("LastIndexFold(%q, %q) = %d, want %d", truncate(h, 40), n, got, want)
+			}
+			if got := lastIndexFoldGo(h, n); got != want {
+				t.Fatalf("lastIndexFoldGo(%q, %q) = %d, want %d", truncate(h, 40), n, got, want)
+			}
+			if got := NewSearcher(n, false).LastIndex(h); got != want {
+				t.Fatalf("Searcher(%q, false).LastIndex(%q) = %d, want %d", n, truncate(h, 40), got, want)
+			}
+			want = strings.LastIndex(h, n)
+			if got := NewSearcher(n, true).LastIndex(h); got != want {
+				t.Fatalf("Searcher(%q, true).LastIndex(%q) = %d, want %d", n, truncate(h, 40), got, want)
+			}
+		}
+	}
+}
+
 func TestAdaptive(t *testing.T) {
 	tests := []struct {
 		haystack, needle string
@@ -1421,6 +1908,176 @@ func BenchmarkSearchNeedle(b *testing.B) {
 	})
 }
 
+func BenchmarkSearcherAll(b *testing.B) {
+	// A log line with a term to highlight every ~200 bytes, plus near-misses
+	var sb strings.Builder
+	for sb.Len() < 64<<10 {
+		sb.WriteString("[INFO] request from client=10.0.0.1 status=200 ERRANT path=/api/v1/items?id=42 ")
+		sb.WriteString("[WARN] Error while reading body, retrying request id=42 attempt=2 ")
+	}
+	haystack := sb.String()
+	s := NewSearcher("error", false)
+
+	b.Run("IndexLoop", func(b *testing.B) {
+		b.SetBytes(int64(len(haystack)))
+		var sink int
+		for i := 0; i < b.N; i++ {
+			for pos := 0; ; {
+				idx := s.Index(haystack[pos:])
+				if idx < 0 {
+					break
+				}
+				sink++
+				pos += idx + len("error")
+			}
+		}
+		_ = sink
+	})
+	b.Run("AppendIndices", func(b *testing.B) {
+		b.SetBytes(int64(len(haystack)))
+		var dst []int
+		for i := 0; i < b.N; i++ {
+			dst = s.AppendIndices(dst[:0], haystack)
+		}
+	})
+}
+
+func BenchmarkSearcherWholeWord(b *testing.B) {
+	// The needle mostly occurs inside longer words ("valid", "ident")
+	var sb strings.Builder
+	for sb.Len() < 64<<10 {
+		sb.WriteString("validate the identity of a valid request, invalid tokens are dropped; ")
+		sb.WriteString("ident=guid valid=true ")
+	}
+	sb.WriteString("user id=42")
+	haystack := sb.String()
+	s := NewSearcher("id", false)
+	word := s.WholeWord(WordBoundary)
+
+	b.Run("IndexLoop", func(b *testing.B) {
+		b.SetBytes(int64(len(haystack)))
+		var sink int
+		for i := 0; i < b.N; i++ {
+			for pos := 0; ; {
+				idx := s.Index(haystack[pos:])
+				if idx < 0 {
+					break
+				}
+				idx += pos
+				if (idx == 0 || WordBoundary.Contains(haystack[idx-1])) &&
+					(idx+2 == len(haystack) || WordBoundary.Contains(haystack[idx+2])) {
+					sink = idx
+					break
+				}
+				pos = idx + 1
+			}
+		}
+		_ = sink
+	})
+	b.Run("WholeWord", func(b *testing.B) {
+		b.SetBytes(int64(len(haystack)))
+		var sink int
+		for i := 0; i < b.N; i++ {
+			sink = word.Index(haystack)
+		}
+		_ = sink
+	})
+}
+
+func BenchmarkLastIndexFold(b *testing.B) {
+	// Tail-of-record lookup: the last "status": in a 4 KiB JSON line
+	needle := `"status":`
+	s := NewSearcher(needle, false)
+	haystack := strings.Repeat(`{"id":12345,"status":"ok","msg":"fine"},`, 100) + `{"id":1,"Status":500}`
+
+	b.Run("Go", func(b *testing.B) {
+		b.SetBytes(int64(len(haystack)))
+		for i := 0; i < b.N; i++ {
+			lastIndexFoldGo(haystack, needle)
+		}
+	})
+	b.Run("LastIndexFold", func(b *testing.B) {
+		b.SetBytes(int64(len(haystack)))
+		for i := 0; i < b.N; i++ {
+			LastIndexFold(haystack, needle)
+		}
+	})
+	b.Run("SearcherLastIndex", func(b *testing.B) {
+		b.SetBytes(int64(len(haystack)))
+		for i := 0; i < b.N; i++ {
+			s.LastIndex(haystack)
+		}
+	})
+	b.Run("SearcherIndexLoop", func(b *testing.B) {
+		b.SetBytes(int64(len(haystack)))
+		for i := 0; i < b.N; i++ {
+			last := -1
+			for pos := 0; ; {
+				idx := s.Index(haystack[pos:])
+				if idx < 0 {
+					break
+				}
+				last = pos + idx
+				pos = last + 1
+			}
+			_ = last
+		}
+	})
+}
+
+func BenchmarkCountFold(b *testing.B) {
+	// Term frequency over a 64 KiB record: dense has a match every ~40 bytes,
+	// sparse one every ~4 KiB.
+	needle := "Error"
+	s := NewSearcher(needle, false)
+	for _, tc := range []struct {
+		name  string
+		every int
+	}{{"dense", 1}, {"sparse", 100}} {
+		var sb strings.Builder
+		for i := 0; sb.Len() < 64<<10; i++ {
+			if i%tc.every == 0 {
+				sb.WriteString("ts=42 level=ERROR msg=retry ")
+			} else {
+				sb.WriteString("ts=42 level=INFO msg=reply ")
+			}
+		}
+		haystack := sb.String()
+
+		b.Run(tc.name+"/IndexFoldLoop", func(b *testing.B) {
+			b.SetBytes(int64(len(haystack)))
+			var sink int
+			for i := 0; i < b.N; i++ {
+				for h := haystack; ; {
+					idx := IndexFold(h, needle)
+					if idx < 0 {
+						break
+					}
+					sink++
+					h = h[idx+len(needle):]
+				}
+			}
+			_ = sink
+		})
+		b.Run(tc.name+"/CountFold", func(b *testing.B) {
+			b.SetBytes(int64(len(haystack)))
+			var sink int
+			for i := 0; i < b.N; i++ {
+				sink += CountFold(haystack, needle)
+			}
+			_ = sink
+		})
+		b.Run(tc.name+"/SearcherCount", func(b *testing.B) {
+			b.SetBytes(int64(len(haystack)))
+			var sink int
+			for i := 0; i < b.N; i++ {
+				sink += s.Count(haystack)
+			}
+			_ = sink
+		})
+	}
+}
+
 // BenchmarkNeedleReuse demonstrates the advantage of precomputing Needle once
 // and reusing it across many haystacks (typical database/log search use case).
 func BenchmarkNeedleReuse(b *testing.B) {
@@ -1631,6 +2288,128 @@ func BenchmarkRankTableUUID(b *testing.B) {
 	}
 }
 
+// BenchmarkCompileLike compares LikeMatcher with the equivalent regexp on
+// a column of short log lines, 1 in 1000 of which match, row by row and
+// through MatchColumn.
+func BenchmarkCompileLike(b *testing.B) {
+	var data []byte
+	offsets := []uint32{0}
+	for i := 0; i < 100000; i++ {
+		line := fmt.Sprintf("2024-01-01 12:00:%02d INFO GET /api/v1/users/%d served", i%60, i)
+		if i%1000 == 0 {
+			line = fmt.Sprintf("2024-01-01 12:00:%02d ERROR GET /api/v1/users/%d upstream timeout", i%60, i)
+		}
+		data = append(data, line...)
+		offsets = append(offsets, uint32(len(data)))
+	}
+	rows := len(offsets) - 1
+	out := make([]uint64, (rows+63)/64)
+
+	for _, tc := range []struct {
+		name, pattern string
+	}{
+		{"Prefix", "2024-01-01 12:00:0_ error%"},
+		{"Infix", "%timeout%"},
+		{"Chain", "%error%/users/_%timeout"},
+	} {
+		re := likeRegexp(tc.pattern, false)
+		m := CompileLike(tc.pattern, false)
+		b.Run(tc.name+"/Regexp", func(b *testing.B) {
+			b.SetBytes(int64(len(data)))
+			for i := 0; i < b.N; i++ {
+				for r := 0; r < rows; r++ {
+					setBit(out, r, re.MatchString(bytesToString(data[offsets[r]:offsets[r+1]])))
+				}
+			}
+		})
+		b.Run(tc.name+"/Match", func(b *testing.B) {
+			b.SetBytes(int64(len(data)))
+			for i := 0; i < b.N; i++ {
+				for r := 0; r < rows; r++ {
+					setBit(out, r, m.Match(bytesToString(data[offsets[r]:offsets[r+1]])))
+				}
+			}
+		})
+		b.Run(tc.name+"/MatchColumn", func(b *testing.B) {
+			b.SetBytes(int64(len(data)))
+			for i := 0; i < b.N; i++ {
+				m.MatchColumn(data, offsets, out)
+			}
+		})
+	}
+}
+
+// BenchmarkGlobSearcher compares GlobSearcher with the equivalent regexp
+// on 64 KiB of log lines that contain the first segment but never the
+// whole pattern.
+func BenchmarkGlobSearcher(b *testing.B) {
+	var sb strings.Builder
+	for i := 0; sb.Len() < 64<<10; i++ {
+		fmt.Fprintf(&sb, "2024-01-01 12:00:%02d WARN upstream=10.0.%d.%d retry=%d\n", i%60, i%256, i%100, i%5)
+	}
+	haystack := sb.String()
+
+	for _, tc := range []struct {
+		name, pattern string
+	}{
+		{"Gap", "upstream=*timeout"},
+		{"Wildcards", "retry=? status=5??"},
+	} {
+		re := globRegexp(tc.pattern, false)
+		g := NewGlobSearcher(tc.pattern, false)
+		b.Run(tc.name+"/Regexp", func(b *testing.B) {
+			b.SetBytes(int64(len(haystack)))
+			for i := 0; i < b.N; i++ {
+				re.FindStringIndex(haystack)
+			}
+		})
+		b.Run(tc.name+"/GlobSearcher", func(b *testing.B) {
+			b.SetBytes(int64(len(haystack)))
+			for i := 0; i < b.N; i++ {
+				g.Index(haystack)
+			}
+		})
+	}
+}
+
+// BenchmarkFieldSearcher compares FieldSearcher with finding the key and
+// then searching its value in Go, on the UUID trace corpus. The needle is
+// in the middle of one span_id value, so it cannot be searched together
+// with the key.
+func BenchmarkFieldSearcher(b *testing.B) {
+	corpus := buildUUIDHeavyCorpus()
+	key, needle := `span_id`, `-4385-`
+	f := NewFieldSearcher(key, needle, false)
+	if f.Index(corpus) < 0 {
+		b.Fatal("needle not in corpus")
+	}
+
+	b.Run("KeyThenValue", func(b *testing.B) {
+		b.SetBytes(int64(len(corpus)))
+		quoted := `"` + key + `":"`
+		for i := 0; i < b.N; i++ {
+			for pos := 0; ; {
+				k := IndexFold(corpus[pos:], quoted)
+				if k < 0 {
+					break
+				}
+				start := pos + k + len(quoted)
+				end := start + strings.IndexByte(corpus[start:], '"')
+				if IndexFold(corpus[start:end], needle) >= 0 {
+					break
+				}
+				pos = end
+			}
+		}
+	})
+	b.Run("FieldSearcher", func(b *testing.B) {
+		b.SetBytes(int64(len(corpus)))
+		for i := 0; i < b.N; i++ {
+			f.Index(corpus)
+		}
+	})
+}
+
 // buildRankTable computes a byte frequency rank table from a corpus.
 func buildRankTable(corpus string) [256]byte {
 	var counts [256]int
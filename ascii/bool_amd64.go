@@ -0,0 +1,112 @@
+//go:build !noasm && amd64
+
+package ascii
+
+// searchTBL_AVX2 is the AVX2-accelerated TBL engine for 1-8 patterns.
+// Requires at least 32 candidate positions (len(haystack)-minPatternLen+1).
+// Returns the final foundMask after scanning the haystack; if offsets is
+// non-nil, the first offset of each pattern found is stored in it.
+//
+//go:noescape
+func searchTBL_AVX2(
+	haystack string,
+	masksLo *[16]uint8,
+	masksHi *[16]uint8,
+	verifyValues *[64]uint64,
+	verifyMasks *[64]uint64,
+	verifyLengths *[64]uint16,
+	verifyPtrs *[64]string,
+	verifyBoundaries *[64]*CharSet,
+	verifyExact uint64,
+	numPatterns int,
+	minPatternLen int,
+	immediateTrueMask uint64,
+	immediateFalseMask uint64,
+	initialFoundMask uint64,
+	offsets *[64]int,
+) uint64
+
+// searchFDR_AVX2 is the AVX2-accelerated FDR engine for 9-64 patterns.
+// Uses a VPSHUFB coarse prefilter, then FDR hash confirmation.
+// Requires at least 32 candidate positions (len(haystack)-minPatternLen+1).
+// Returns the final foundMask after scanning the haystack; if offsets is
+// non-nil, the first offset of each pattern found is stored in it.
+//
+//go:noescape
+func searchFDR_AVX2(
+	haystack string,
+	stateTable *uint64,
+	domainMask uint32,
+	stride int,
+	coarseLo *[16]uint8,
+	coarseHi *[16]uint8,
+	groupLUT *[256]uint64,
+	verifyValues *[64]uint64,
+	verifyMasks *[64]uint64,
+	verifyLengths *[64]uint16,
+	verifyPtrs *[64]string,
+	verifyBoundaries *[64]*CharSet,
+	verifyExact uint64,
+	numPatterns int,
+	minPatternLen int,
+	immediateTrueMask uint64,
+	immediateFalseMask uint64,
+	initialFoundMask uint64,
+	offsets *[64]int,
+) uint64
+
+// searchTBLAVX2 runs the Direct TBL engine for 1-8 patterns with AVX2;
+// haystacks shorter than one 32-byte block use the Go implementation.
+func (bs *BooleanSearch) searchTBLAVX2(haystack string, foundMask uint64, offsets *[64]int) uint64 {
+	if len(haystack)-bs.minPatternLen+1 < 32 {
+		return bs.searchTBLGo(haystack, foundMask, offsets)
+	}
+	trueMask, falseMask := bs.stopMasks(offsets)
+	return searchTBL_AVX2(
+		haystack,
+		&bs.tbl.masksLo,
+		&bs.tbl.masksHi,
+		&bs.verify.values,
+		&bs.verify.masks,
+		&bs.verify.lengths,
+		&bs.verify.ptrs,
+		&bs.verify.boundaries,
+		bs.verify.exact,
+		bs.numPatterns,
+		bs.minPatternLen,
+		trueMask,
+		falseMask,
+		foundMask,
+		offsets,
+	)
+}
+
+// searchFDRAVX2 runs the FDR engine for 9-64 patterns with AVX2;
+// haystacks shorter than one 32-byte block use the Go implementation.
+func (bs *BooleanSearch) searchFDRAVX2(haystack string, foundMask uint64, offsets *[64]int) uint64 {
+	if len(haystack)-bs.minPatternLen+1 < 32 {
+		return bs.searchFDRGo(haystack, foundMask, offsets)
+	}
+	trueMask, falseMask := bs.stopMasks(offsets)
+	return searchFDR_AVX2(
+		haystack,
+		&bs.fdr.stateTable[0],
+		bs.fdr.domainMask,
+		bs.fdr.stride,
+		&bs.fdr.coarseLo,
+		&bs.fdr.coarseHi,
+		&bs.fdr.groupLUT,
+		&bs.verify.values,
+		&bs.verify.masks,
+		&bs.verify.lengths,
+		&bs.verify.ptrs,
+		&bs.verify.boundaries,
+		bs.verify.exact,
+		bs.numPatterns,
+		bs.minPatternLen,
+		trueMask,
+		falseMask,
+		foundMask,
+		offsets,
+	)
+}
@@ -0,0 +1,273 @@
+package ascii
+
+import "strings"
+
+// =============================================================================
+// Anchored Patterns
+// =============================================================================
+
+// Anchor restricts where a pattern must occur in the haystack.
+type Anchor uint8
+
+const (
+	Unanchored      Anchor = iota // anywhere
+	AnchorStart                   // at the start of the haystack
+	AnchorEnd                     // at the end of the haystack
+	AnchorLineStart               // at the start of a line: the haystack start or after '\n'
+	AnchorLineEnd                 // at the end of a line: before '\n' or at the haystack end
+)
+
+// PrefixCI creates a case-insensitive check that the haystack starts with
+// pattern.
+func PrefixCI(pattern string) *ContainsExpr {
+	return &ContainsExpr{Pattern: pattern, Anchor: AnchorStart}
+}
+
+// PrefixCS creates a case-sensitive check that the haystack starts with
+// pattern.
+func PrefixCS(pattern string) *ContainsExpr {
+	return &ContainsExpr{Pattern: pattern, CaseSensitive: true, Anchor: AnchorStart}
+}
+
+// SuffixCI creates a case-insensitive check that the haystack ends with
+// pattern.
+func SuffixCI(pattern string) *ContainsExpr {
+	return &ContainsExpr{Pattern: pattern, Anchor: AnchorEnd}
+}
+
+// SuffixCS creates a case-sensitive check that the haystack ends with
+// pattern.
+func SuffixCS(pattern string) *ContainsExpr {
+	return &ContainsExpr{Pattern: pattern, CaseSensitive: true, Anchor: AnchorEnd}
+}
+
+// LinePrefixCI creates a case-insensitive check that some line of the
+// haystack starts with pattern. Lines end at '\n'.
+func LinePrefixCI(pattern string) *ContainsExpr {
+	return &ContainsExpr{Pattern: pattern, Anchor: AnchorLineStart}
+}
+
+// LinePrefixCS creates a case-sensitive check that some line of the
+// haystack starts with pattern. Lines end at '\n'.
+func LinePrefixCS(pattern string) *ContainsExpr {
+	return &ContainsExpr{Pattern: pattern, CaseSensitive: true, Anchor: AnchorLineStart}
+}
+
+// LineSuffixCI creates a case-insensitive check that some line of the
+// haystack ends with pattern. Lines end at '\n', which is not part of the
+// line; a preceding '\r' is.
+func LineSuffixCI(pattern string) *ContainsExpr {
+	return &ContainsExpr{Pattern: pattern, Anchor: AnchorLineEnd}
+}
+
+// LineSuffixCS creates a case-sensitive check that some line of the
+// haystack ends with pattern. Lines end at '\n', which is not part of the
+// line; a preceding '\r' is.
+func LineSuffixCS(pattern string) *ContainsExpr {
+	return &ContainsExpr{Pattern: pattern, CaseSensitive: true, Anchor: AnchorLineEnd}
+}
+
+// scanned returns the patterns the search engines look for. Anchored and
+// glob patterns are not in the engine tables: anchored patterns are compared
+// directly at the haystack edges and after newlines (see anchorsAtStart),
+// and glob patterns are found by their GlobSearcher.
+func (bs *BooleanSearch) scanned() []Pattern {
+	return bs.patterns[:bs.numScanned]
+}
+
+// anchored returns the anchored and glob patterns.
+func (bs *BooleanSearch) anchored() []Pattern {
+	return bs.patterns[bs.numScanned:]
+}
+
+// matchAt reports whether p occurs at offset i of haystack.
+func (p *Pattern) matchAt(haystack string, i int) bool {
+	if i < 0 || i+p.Length > len(haystack) {
+		return false
+	}
+	s := haystack[i : i+p.Length]
+	if p.CaseSensitive {
+		if s != p.Text {
+			return false
+		}
+	} else if !impl.equalFold(s, p.Text) {
+		return false
+	}
+	return p.Boundary == nil || isWordAt(haystack, i, p.Length, &p.Boundary.bitset)
+}
+
+// anchorFound marks anchored pattern p found at offset i. found holds the
+// found patterns as in evaluateSet; offsets, if non-nil, records the
+// offsets of IDs below 64.
+func anchorFound(p *Pattern, i int, found []uint64, offsets *[64]int) {
+	found[p.ID/64] |= 1 << (p.ID % 64)
+	if offsets != nil && p.ID < 64 {
+		offsets[p.ID] = i
+	}
+}
+
+func isFound(found []uint64, id uint16) bool {
+	return found[id/64]&(1<<(id%64)) != 0
+}
+
+// findAnchors checks the anchored patterns against haystack, adding those
+// that occur to found. Offsets are the first occurrence of each.
+func (bs *BooleanSearch) findAnchors(haystack string, found []uint64, offsets *[64]int) {
+	bs.anchorsAtStart(haystack, found, offsets)
+	bs.anchorsAtNewlines(haystack, found, offsets)
+	bs.anchorsAtEnd(haystack, found, offsets)
+	bs.findGlobs(haystack, found, offsets)
+}
+
+// anchorsAtStart checks the patterns anchored to the start of haystack and
+// the line starting there.
+func (bs *BooleanSearch) anchorsAtStart(haystack string, found []uint64, offsets *[64]int) {
+	for i := range bs.anchored() {
+		p := &bs.anchored()[i]
+		if (p.Anchor == AnchorStart || p.Anchor == AnchorLineStart) && !isFound(found, p.ID) && p.matchAt(haystack, 0) {
+			anchorFound(p, 0, found, offsets)
+		}
+	}
+}
+
+// anchorsAtEnd checks the patterns anchored to the end of haystack and the
+// line ending there.
+func (bs *BooleanSearch) anchorsAtEnd(haystack string, found []uint64, offsets *[64]int) {
+	for i := range bs.anchored() {
+		p := &bs.anchored()[i]
+		at := len(haystack) - p.Length
+		if (p.Anchor == AnchorEnd || p.Anchor == AnchorLineEnd) && !isFound(found, p.ID) && p.matchAt(haystack, at) {
+			anchorFound(p, at, found, offsets)
+		}
+	}
+}
+
+// lineSearchLimit is the number of line-anchored patterns up to which each
+// is searched for together with its newline. Beyond it, a single pass over
+// the newlines checks them all.
+const lineSearchLimit = 4
+
+// buildSearchers builds the GlobSearchers of the glob patterns and the
+// searchers for the line-anchored patterns joined with their newline:
+// "\n" + text for line starts, text + "\n" for line ends.
+func (bs *BooleanSearch) buildSearchers() {
+	bs.lineSearchers = nil
+	for i, p := range bs.anchored() {
+		if p.Glob {
+			g := NewGlobSearcher(p.Text, p.CaseSensitive)
+			bs.anchored()[i].glob = &g
+		}
+		if p.Anchor != AnchorLineStart && p.Anchor != AnchorLineEnd {
+			continue
+		}
+		if bs.lineSearchers == nil {
+			bs.lineSearchers = make([]Searcher, len(bs.anchored()))
+		}
+		needle := "\n" + p.Text
+		if p.Anchor == AnchorLineEnd {
+			needle = p.Text + "\n"
+		}
+		bs.lineSearchers[i] = NewSearcher(needle, p.CaseSensitive)
+	}
+}
+
+// anchorsAtNewlines checks the line-anchored patterns around each '\n' of
+// haystack. The edges of haystack are not treated as line edges.
+func (bs *BooleanSearch) anchorsAtNewlines(haystack string, found []uint64, offsets *[64]int) {
+	if bs.lineSearchers == nil {
+		return
+	}
+	var buf [16]*Pattern
+	lines := buf[:0]
+	for i := range bs.anchored() {
+		p := &bs.anchored()[i]
+		if (p.Anchor == AnchorLineStart || p.Anchor == AnchorLineEnd) && !isFound(found, p.ID) {
+			lines = append(lines, p)
+		}
+	}
+
+	if len(lines) <= lineSearchLimit {
+		// Dense newlines make a search per pattern cheaper than stopping
+		// at each of them
+		for _, p := range lines {
+			s := &bs.lineSearchers[int(p.ID)-bs.numScanned]
+			for from := 0; ; {
+				i := s.Index(haystack[from:])
+				if i < 0 {
+					break
+				}
+				at := from + i
+				if p.Anchor == AnchorLineStart {
+					at++
+				}
+				if p.Boundary == nil || isWordAt(haystack, at, p.Length, &p.Boundary.bitset) {
+					anchorFound(p, at, found, offsets)
+					break
+				}
+				from += i + 1
+			}
+		}
+		return
+	}
+
+	for nl := 0; len(lines) > 0; nl++ {
+		i := strings.IndexByte(haystack[nl:], '\n')
+		if i < 0 {
+			return
+		}
+		nl += i
+
+		kept := lines[:0]
+		for _, p := range lines {
+			at := nl + 1
+			if p.Anchor == AnchorLineEnd {
+				at = nl - p.Length
+			}
+			if p.matchAt(haystack, at) {
+				anchorFound(p, at, found, offsets)
+			} else {
+				kept = append(kept, p)
+			}
+		}
+		lines = kept
+	}
+}
+
+// =============================================================================
+// Glob Patterns
+// =============================================================================
+
+// GlobCI creates a case-insensitive containment check for a glob pattern:
+// '?' matches any byte and '*' any run of bytes (see GlobSearcher). Glob
+// patterns are unanchored and cannot be whole-word.
+func GlobCI(pattern string) *ContainsExpr {
+	return &ContainsExpr{Pattern: pattern, Glob: true}
+}
+
+// GlobCS creates a case-sensitive containment check for a glob pattern.
+func GlobCS(pattern string) *ContainsExpr {
+	return &ContainsExpr{Pattern: pattern, CaseSensitive: true, Glob: true}
+}
+
+// findGlobs searches haystack for the glob patterns not yet in found.
+func (bs *BooleanSearch) findGlobs(haystack string, found []uint64, offsets *[64]int) {
+	for i := range bs.anchored() {
+		p := &bs.anchored()[i]
+		if p.glob == nil || isFound(found, p.ID) {
+			continue
+		}
+		if at := p.glob.Index(haystack); at >= 0 {
+			anchorFound(p, at, found, offsets)
+		}
+	}
+}
+
+// hasGlobs reports whether any pattern is a glob.
+func (bs *BooleanSearch) hasGlobs() bool {
+	for _, p := range bs.anchored() {
+		if p.Glob {
+			return true
+		}
+	}
+	return false
+}
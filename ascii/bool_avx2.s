@@ -0,0 +1,341 @@
+//go:build !noasm && amd64
+
+// AVX2-accelerated multi-needle boolean substring search
+//
+// This file implements the Direct TBL engine for 1-8 patterns.
+// Uses nibble-based VPSHUFB lookups (Teddy-style) to filter candidate
+// positions 32 at a time, then verifies matches using masked 8-byte
+// comparisons. Same tables and verification scheme as bool_neon.s.
+
+#include "textflag.h"
+
+// func searchTBL_AVX2(
+//     haystack string,                // +0(FP): ptr, +8(FP): len
+//     masksLo *[16]uint8,             // +16(FP)
+//     masksHi *[16]uint8,             // +24(FP)
+//     verifyValues *[64]uint64,       // +32(FP)
+//     verifyMasks *[64]uint64,        // +40(FP)
+//     verifyLengths *[64]uint16,      // +48(FP)
+//     verifyPtrs *[64]string,         // +56(FP) (for long patterns)
+//     verifyBoundaries *[64]*CharSet, // +64(FP) whole-word boundary sets, nil entries match anywhere
+//     verifyExact uint64,             // +72(FP) patterns compared exactly, without case folding
+//     numPatterns int,                // +80(FP)
+//     minPatternLen int,              // +88(FP)
+//     immediateTrueMask uint64,       // +96(FP)
+//     immediateFalseMask uint64,      // +104(FP)
+//     initialFoundMask uint64,        // +112(FP)
+//     offsets *[64]int,               // +120(FP) first match offsets, may be nil
+// ) uint64                            // +128(FP) return value
+//
+// The caller guarantees at least 32 candidate positions
+// (len(haystack) - minPatternLen + 1 >= 32); the final partial block is
+// handled by re-scanning an overlapping 32-byte window. Positions are
+// visited in increasing order, so the offset stored for a pattern is its
+// first match.
+//
+// Register allocation:
+// AX  = candidate position bitmask for the current block
+// BX  = candidate patterns at the current position
+// CX  = shift count / current position
+// DX  = haystack len
+// SI  = haystack ptr
+// DI  = block start position
+// R8  = verifyValues ptr
+// R9  = verifyMasks ptr
+// R10 = verifyLengths ptr
+// R11 = pattern ID
+// R12 = pattern length / temp
+// R13 = foundMask (accumulator)
+// R14 = temp
+// R15 = number of candidate positions (len - minPatternLen + 1)
+//
+// Y0 = masksLo (both lanes), Y1 = masksHi (both lanes), Y2 = 0x0F,
+// Y3 = all ones, Y9 = foundMask broadcast (found patterns are never candidates)
+//
+// Stack: 0(SP) = 32-byte candidate vector, 32(SP) = allPatternsMask,
+// 40(SP), 48(SP) = spill slots
+
+TEXT ·searchTBL_AVX2(SB), NOSPLIT, $56-136
+	MOVQ haystack_base+0(FP), SI
+	MOVQ haystack_len+8(FP), DX
+	MOVQ masksLo+16(FP), R12
+	MOVQ masksHi+24(FP), R14
+	MOVQ verifyValues+32(FP), R8
+	MOVQ verifyMasks+40(FP), R9
+	MOVQ verifyLengths+48(FP), R10
+	MOVQ initialFoundMask+112(FP), R13
+
+	// Number of candidate positions
+	MOVQ DX, R15
+	SUBQ minPatternLen+88(FP), R15
+	INCQ R15
+
+	// allPatternsMask = (1 << numPatterns) - 1
+	MOVQ numPatterns+80(FP), CX
+	MOVL $1, AX
+	SHLQ CX, AX
+	DECQ AX
+	MOVQ AX, 32(SP)
+
+	// Load TBL masks into both 128-bit lanes
+	VBROADCASTI128 (R12), Y0
+	VBROADCASTI128 (R14), Y1
+
+	// Nibble mask and all-ones constants
+	MOVQ         $0x0F0F0F0F0F0F0F0F, R12
+	MOVQ         R12, X2
+	VPBROADCASTQ X2, Y2
+	VPCMPEQB     Y3, Y3, Y3
+
+	MOVQ         R13, X9
+	VPBROADCASTB X9, Y9
+
+	XORQ DI, DI
+
+// ============================================================================
+// VECTORIZED 32-BYTE LOOP
+// ============================================================================
+loop32:
+	LEAQ 32(DI), R12
+	CMPQ R12, R15
+	JA   tail
+	XORL CX, CX
+
+block:
+	// CX = number of leading positions already scanned (overlapping tail)
+	VMOVDQU (SI)(DI*1), Y4
+	VPSRLW  $4, Y4, Y5
+	VPAND   Y2, Y4, Y4                // Y4 = lo nibbles
+	VPAND   Y2, Y5, Y5                // Y5 = hi nibbles
+	VPSHUFB Y4, Y0, Y4                // Y4 = masksLo[lo_nibble]
+	VPSHUFB Y5, Y1, Y5                // Y5 = masksHi[hi_nibble]
+
+	// Combine: 0 bit = pattern might match
+	VPOR Y4, Y5, Y4
+	VPOR Y9, Y4, Y4
+
+	// Positions with any 0 bit have candidates
+	VPCMPEQB  Y3, Y4, Y5
+	VPMOVMSKB Y5, AX
+	NOTL      AX
+	SHRL      CX, AX
+	SHLL      CX, AX
+	TESTL     AX, AX
+	JZ        next_block
+
+	VMOVDQU Y4, (SP)
+
+process_pos:
+	BSFL AX, CX
+	BTRL CX, AX
+
+	// Candidates for this position, minus patterns found since the block load
+	MOVBLZX (SP)(CX*1), BX
+	NOTL    BX
+	ANDL    $0xFF, BX
+	MOVQ    R13, R12
+	NOTQ    R12
+	ANDQ    R12, BX
+	JZ      next_pos
+
+	ADDQ DI, CX                       // CX = haystack position
+
+verify:
+	BSFQ BX, R11
+	BTRQ R11, BX
+
+	// Check pattern length vs remaining haystack
+	MOVWQZX (R10)(R11*2), R12
+	LEAQ    (CX)(R12*1), R14
+	CMPQ    R14, DX
+	JA      next_cand
+
+	// Load 8 bytes from haystack at position (without reading past the end)
+	LEAQ 8(CX), R14
+	CMPQ R14, DX
+	JA   load_near_end
+	MOVQ (SI)(CX*1), R14
+
+verify_masked:
+	ANDQ (R9)(R11*8), R14
+	CMPQ R14, (R8)(R11*8)
+	JNE  next_cand
+
+	// For patterns > 8 bytes, do extended verification
+	CMPQ R12, $8
+	JA   verify_long
+
+check_word:
+	// Whole-word patterns: the bytes around the match must be boundaries
+	MOVQ  verifyBoundaries+64(FP), R12
+	MOVQ  (R12)(R11*8), R12           // R12 = boundary bitset, nil for substring patterns
+	TESTQ R12, R12
+	JZ    matched
+	TESTQ CX, CX
+	JZ    check_word_end
+	MOVBQZX -1(SI)(CX*1), R14
+	BTQ     R14, (R12)
+	JCC     next_cand
+
+check_word_end:
+	MOVWQZX (R10)(R11*2), R14
+	ADDQ    CX, R14
+	CMPQ    R14, DX
+	JAE     matched
+	MOVBQZX (SI)(R14*1), R14
+	BTQ     R14, (R12)
+	JCC     next_cand
+
+matched:
+	BTSQ         R11, R13             // foundMask |= (1 << pid)
+	MOVQ         R13, X9
+	VPBROADCASTB X9, Y9
+
+	// offsets[pid] = position
+	MOVQ  offsets+120(FP), R12
+	TESTQ R12, R12
+	JZ    check_term
+	MOVQ  CX, (R12)(R11*8)
+
+check_term:
+	// Check immediate termination
+	MOVQ  immediateTrueMask+96(FP), R12
+	ORQ   immediateFalseMask+104(FP), R12
+	TESTQ R12, R13
+	JNZ   done
+
+	// All patterns found?
+	CMPQ R13, 32(SP)
+	JEQ  done
+
+next_cand:
+	TESTQ BX, BX
+	JNZ   verify
+
+next_pos:
+	TESTL AX, AX
+	JNZ   process_pos
+
+next_block:
+	ADDQ $32, DI
+	JMP  loop32
+
+tail:
+	// Rescan the last 32 positions, skipping those already covered
+	CMPQ DI, R15
+	JAE  done
+	MOVQ DI, CX
+	MOVQ R15, DI
+	SUBQ $32, DI
+	SUBQ DI, CX
+	JMP  block
+
+load_near_end:
+	// Fewer than 8 bytes left: load the final 8 bytes and shift the
+	// ones at position down (haystack is at least 32 bytes long)
+	MOVQ CX, 40(SP)
+	MOVQ -8(SI)(DX*1), R14
+	SUBQ DX, CX
+	ADDQ $8, CX
+	SHLQ $3, CX
+	SHRQ CX, R14
+	MOVQ 40(SP), CX
+	JMP  verify_masked
+
+verify_long:
+	// Long pattern verification (>8 bytes)
+	// CX = haystack position, R11 = pattern ID, R12 = pattern length
+	// First 8 bytes already matched. Now check bytes 8 onwards against
+	// verifyPtrs[pid]: uppercase, or as is for the patterns in verifyExact.
+	MOVQ AX, 40(SP)
+	MOVQ BX, 48(SP)
+
+	// verifyPtrs is [64]string, each string is 16 bytes (ptr + len)
+	MOVQ verifyPtrs+56(FP), R14
+	MOVQ R11, AX
+	SHLQ $4, AX
+	MOVQ (R14)(AX*1), R14             // R14 = pattern ptr
+
+	LEAQ (SI)(CX*1), BX               // BX = haystack ptr + position
+	SUBQ BX, R14                      // R14 = pattern ptr - haystack ptr
+	ADDQ BX, R12                      // R12 = end ptr
+	ADDQ $8, BX
+
+	// From 32 bytes on, compare a vector at a time with lowercase haystack
+	// letters folded to uppercase unless the compare is exact; the last
+	// window overlaps the previous one.
+	MOVQ R12, AX
+	SUBQ BX, AX
+	CMPQ AX, $32
+	JB   verify_long_loop
+	MOVL         $0x1f1f1f1f, AX
+	VMOVD        AX, X10
+	VPBROADCASTD X10, Y10             // Y10 = bias mapping 'a'-'z' to -128..-103
+	MOVL         $0x9a9a9a9a, AX
+	VMOVD        AX, X11
+	VPBROADCASTD X11, Y11             // Y11 = -102
+	MOVL         $0x20202020, AX
+	BTQ          R11, verifyExact+72(FP)
+	JCC          verify_long_fold
+	XORL         AX, AX               // case-sensitive: compare exactly
+
+verify_long_fold:
+	VMOVD        AX, X12
+	VPBROADCASTD X12, Y12             // Y12 = case bit, zero for exact compares
+
+verify_long_vec:
+	VMOVDQU   (BX), Y13
+	VPADDB    Y10, Y13, Y14
+	VPCMPGTB  Y14, Y11, Y14           // 0xFF where the haystack byte is 'a'-'z'
+	VPAND     Y12, Y14, Y14
+	VPSUBB    Y14, Y13, Y13           // fold to uppercase
+	VPCMPEQB  (BX)(R14*1), Y13, Y13
+	VPMOVMSKB Y13, AX
+	CMPL      AX, $0xffffffff
+	JNE       verify_long_fail
+	ADDQ      $32, BX
+	LEAQ      32(BX), AX
+	CMPQ      AX, R12
+	JBE       verify_long_vec
+	CMPQ      BX, R12
+	JAE       verify_long_ok
+	LEAQ      -32(R12), BX
+	JMP       verify_long_vec
+
+verify_long_loop:
+	CMPQ BX, R12
+	JAE  verify_long_ok
+
+	MOVBLZX (BX), AX
+	CMPB    AX, (BX)(R14*1)
+	JEQ     verify_long_next
+
+	// Case-sensitive patterns match exactly; for the others the pattern
+	// byte is uppercase
+	BTQ  R11, verifyExact+72(FP)
+	JCS  verify_long_fail
+	SUBL $0x61, AX                    // check if lowercase
+	CMPL AX, $26
+	JAE  verify_long_fail
+	ADDL $0x41, AX                    // convert to uppercase
+	CMPB AX, (BX)(R14*1)
+	JNE  verify_long_fail
+
+verify_long_next:
+	INCQ BX
+	JMP  verify_long_loop
+
+verify_long_ok:
+	MOVQ 40(SP), AX
+	MOVQ 48(SP), BX
+	JMP  check_word
+
+verify_long_fail:
+	MOVQ 40(SP), AX
+	MOVQ 48(SP), BX
+	JMP  next_cand
+
+done:
+	VZEROUPPER
+	MOVQ R13, ret+128(FP)
+	RET
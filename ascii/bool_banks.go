@@ -0,0 +1,278 @@
+package ascii
+
+import (
+	"math/bits"
+	"sync"
+	"unsafe"
+)
+
+// maxPatterns is the largest number of distinct patterns a BooleanSearch can
+// hold: 64 banks of 64 patterns, so that bankTable entries fit a uint64.
+const maxPatterns = 64 * 64
+
+// maxPatternLen is the longest pattern a BooleanSearch accepts, limited by
+// the uint16 verify lengths.
+const maxPatternLen = 1<<16 - 1
+
+// bankDomain is the FDR hash domain shared by all banks.
+const bankDomain = 13
+
+// maxKernelBanks is the most banks scanned by one FDR kernel pass each.
+// Beyond it, one shared hash pass over the banks after bank 0 costs less
+// than a SIMD pass per bank.
+const maxKernelBanks = 8
+
+// foundSets recycles the found sets matchBanks evaluates the expression on.
+var foundSets = sync.Pool{
+	New: func() any { return new([maxPatterns / 64]uint64) },
+}
+
+// patternBank is the FDR state for 64 patterns of a search with more than
+// 64 patterns. Pattern IDs within a bank are local (0-63).
+type patternBank struct {
+	stateTable []uint64 // 2^bankDomain entries, inverted like fdr.stateTable
+	verify     verifyTables
+	all        uint64 // mask of the scanned patterns in this bank
+
+	// search is the bank as a search of its own, over bank-local IDs, for
+	// the SIMD FDR engines (see buildBankSearches)
+	search *BooleanSearch
+}
+
+// buildBanks splits the patterns into banks of 64 and builds their tables.
+// The small-set engines (TBL, FDR, flood table) are left unused.
+func (bs *BooleanSearch) buildBanks() {
+	numBanks := (bs.numPatterns + 63) / 64
+	domainMask := uint32(1)<<bankDomain - 1
+
+	bs.fdr.domain = bankDomain
+	bs.fdr.domainMask = domainMask
+	bs.banks = make([]patternBank, numBanks)
+	bs.bankTable = make([]uint64, 1<<bankDomain)
+	for i := range bs.bankTable {
+		bs.bankTable[i] = ^uint64(0)
+	}
+
+	for b := range bs.banks {
+		bank := &bs.banks[b]
+		bank.stateTable = make([]uint64, 1<<bankDomain)
+		for i := range bank.stateTable {
+			bank.stateTable[i] = ^uint64(0)
+		}
+	}
+
+	for _, p := range bs.scanned() {
+		bank := &bs.banks[p.ID/64]
+		local := uint8(p.ID % 64)
+
+		bank.verify.add(local, p)
+		bank.all |= 1 << local
+		if len(p.Text) == 0 {
+			continue
+		}
+		populateFDRPattern(bank.stateTable, domainMask, p, 1<<local)
+		populateFDRPattern(bs.bankTable, domainMask, p, 1<<(p.ID/64))
+	}
+
+	bs.computeImmediateSets()
+	bs.buildBankSearches()
+}
+
+// buildBankSearches sets up every bank as a 64-pattern FDR search, so that
+// the SIMD engines can scan it. The searches share the banks' state tables;
+// the verify tables are copied, so they must be complete by now.
+func (bs *BooleanSearch) buildBankSearches() {
+	for b := range bs.banks {
+		bank := &bs.banks[b]
+		lo, hi := 64*b, min(64*b+64, bs.numPatterns)
+		sub := &BooleanSearch{
+			immediateTrueMask:  bs.immediateTrueSet[b],
+			immediateFalseMask: bs.immediateFalseSet[b],
+			patterns:           make([]Pattern, hi-lo),
+			numPatterns:        hi - lo,
+			numScanned:         max(min(bs.numScanned, hi)-lo, 0),
+			useFDR:             true,
+			verify:             bank.verify,
+		}
+		for i, p := range bs.patterns[lo:hi] {
+			p.ID = uint16(i)
+			sub.patterns[i] = p
+		}
+		sub.minPatternLen = sub.scannedMinLength()
+
+		sub.fdr.domain = bs.fdr.domain
+		sub.fdr.domainMask = bs.fdr.domainMask
+		sub.fdr.stride = 1
+		sub.fdr.stateTable = bank.stateTable
+		sub.buildFDRCoarseTables()
+		bank.search = sub
+	}
+}
+
+// computeImmediateSets is computeImmediateMasks over the banked pattern IDs.
+func (bs *BooleanSearch) computeImmediateSets() {
+	bs.immediateTrueSet, bs.immediateFalseSet = bs.patternImmediateSets(len(bs.banks))
+}
+
+// patternImmediateSets is immediateSets of the search's expression, over its
+// patterns only.
+func (bs *BooleanSearch) patternImmediateSets(numBanks int) (trueSet, falseSet []uint64) {
+	trueSet, falseSet = immediateSets(bs.expr, numBanks)
+
+	// Constants set the bits past the last pattern too
+	if n := bs.numPatterns % 64; n != 0 {
+		trueSet[numBanks-1] &= 1<<n - 1
+		falseSet[numBanks-1] &= 1<<n - 1
+	}
+	return trueSet, falseSet
+}
+
+// immediateSets returns the patterns that make e TRUE when found alone,
+// with the others unknown, and those that make it FALSE. It computes both
+// sets for all patterns in one pass over e, rather than evaluating e once
+// per pattern, which is quadratic in large rule sets.
+func immediateSets(e BoolExpr, numBanks int) (trueSet, falseSet []uint64) {
+	switch e := e.(type) {
+	case *NotExpr:
+		trueSet, falseSet = immediateSets(e.Child, numBanks)
+		return falseSet, trueSet
+	case *AndExpr:
+		trueSet, falseSet = immediateSets(e.Left, numBanks)
+		rightTrue, rightFalse := immediateSets(e.Right, numBanks)
+		for i := range trueSet {
+			trueSet[i] &= rightTrue[i]
+			falseSet[i] |= rightFalse[i]
+		}
+		return trueSet, falseSet
+	case *OrExpr:
+		trueSet, falseSet = immediateSets(e.Left, numBanks)
+		rightTrue, rightFalse := immediateSets(e.Right, numBanks)
+		for i := range trueSet {
+			trueSet[i] |= rightTrue[i]
+			falseSet[i] &= rightFalse[i]
+		}
+		return trueSet, falseSet
+	}
+
+	trueSet, falseSet = make([]uint64, numBanks), make([]uint64, numBanks)
+	switch e := e.(type) {
+	case *ContainsExpr:
+		if bank := int(e.patternID / 64); bank < numBanks {
+			trueSet[bank] = 1 << (e.patternID % 64)
+		}
+	case *constExpr:
+		set := trueSet
+		if e.value == FALSE {
+			set = falseSet
+		}
+		for i := range set {
+			set[i] = ^uint64(0)
+		}
+	}
+	return trueSet, falseSet
+}
+
+// matchBanks runs the banked search and evaluates the expression. It also
+// returns the found mask of bank 0, whose offsets are recorded if non-nil.
+func (bs *BooleanSearch) matchBanks(haystack string, offsets *[64]int) (bool, uint64) {
+	buf := foundSets.Get().(*[maxPatterns / 64]uint64)
+	found := buf[:len(bs.banks)]
+	clear(found)
+	bs.findAnchors(haystack, found, offsets)
+	bs.searchBanks(haystack, found, offsets)
+	matched, found0 := bs.expr.evaluateSet(found, true) == TRUE, found[0]
+	foundSets.Put(buf)
+	return matched, found0
+}
+
+// searchBanks scans the haystack for the patterns of every bank,
+// accumulating found patterns in found[bank]. Bank 0, and every bank of
+// searches with up to maxKernelBanks banks, is scanned by the FDR engine,
+// one pass per bank. The other banks share one pass in which each position
+// is hashed once: bankTable narrows the lookup to banks with candidates at
+// that hash, and only those banks' state tables are consulted. Positions
+// with fewer than 4 bytes left check every pattern not yet found.
+func (bs *BooleanSearch) searchBanks(haystack string, found []uint64, offsets *[64]int) {
+	trueSet, falseSet := bs.immediateTrueSet, bs.immediateFalseSet
+	if offsets != nil {
+		// Recording offsets needs every pattern, so never stop early
+		trueSet, falseSet = nil, nil
+	}
+
+	n := len(haystack)
+	if bs.numScanned == 0 {
+		return
+	}
+
+	kernelBanks := 1
+	if len(bs.banks) <= maxKernelBanks {
+		kernelBanks = len(bs.banks)
+	}
+	for b := range bs.banks[:kernelBanks] {
+		sub := bs.banks[b].search
+		if sub.numScanned == 0 {
+			continue
+		}
+		var subOffsets *[64]int
+		if b == 0 {
+			subOffsets = offsets
+		}
+		found[b] = sub.searchFDR(haystack, found[b], subOffsets)
+		if trueSet != nil && found[b]&(trueSet[b]|falseSet[b]) != 0 {
+			return
+		}
+	}
+	if kernelBanks == len(bs.banks) {
+		return
+	}
+
+	hayPtr := unsafe.Pointer(unsafe.StringData(haystack))
+	allBanks := uint64(1)<<len(bs.banks) - 1
+	done := uint64(1)<<kernelBanks - 1 // banks with every pattern found
+
+	for pos := 0; pos <= n-bs.minPatternLen; pos++ {
+		var hash uint32
+		live := allBanks &^ done
+		hashed := pos+4 <= n
+		if hashed {
+			hash = *(*uint32)(unsafe.Pointer(uintptr(hayPtr) + uintptr(pos))) & bs.fdr.domainMask
+			live &^= bs.bankTable[hash]
+		}
+
+		for live != 0 {
+			b := bits.TrailingZeros64(live)
+			live &= live - 1
+			bank := &bs.banks[b]
+
+			candidates := bank.all
+			if hashed {
+				candidates = ^bank.stateTable[hash]
+			}
+			candidates &^= found[b]
+
+			for candidates != 0 {
+				pid := uint8(bits.TrailingZeros64(candidates))
+				candidates &^= 1 << pid
+
+				if !bank.verify.match(haystack, pos, pid) {
+					continue
+				}
+				found[b] |= 1 << pid
+
+				// Check for early termination
+				if trueSet != nil && (trueSet[b]|falseSet[b])&(1<<pid) != 0 {
+					return
+				}
+			}
+
+			if found[b]&bank.all == bank.all {
+				done |= 1 << b
+			}
+		}
+
+		// Check if all patterns found
+		if done == allBanks {
+			return
+		}
+	}
+}
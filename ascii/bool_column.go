@@ -0,0 +1,168 @@
+package ascii
+
+import "unsafe"
+
+// columnBlockBytes is the size of the row groups MatchColumn scans with a
+// single engine call before looking at individual rows.
+const columnBlockBytes = 4096
+
+const (
+	blockHitWindow = 16 // blockHitRate halves its counts every this many scans
+	blockSkipRun   = 32 // groups not scanned as a whole once hits are dense
+)
+
+// blockHitRate tracks how often a group scan finds a pattern. A group with
+// a hit is scanned again row by row, so when most groups have one the group
+// scan is wasted work: the next blockSkipRun groups then go straight to the
+// rows. One group is scanned after each run, so that the group scans come
+// back once hits thin out.
+type blockHitRate struct {
+	scanned, hits int // recent group scans and those with a hit
+	skip          int // groups left to match row by row without a scan
+}
+
+// scan reports whether the next group is to be scanned as a whole.
+func (h *blockHitRate) scan() bool {
+	if h.skip > 0 {
+		h.skip--
+		return false
+	}
+	return true
+}
+
+// record notes the result of a group scan.
+func (h *blockHitRate) record(hit bool) {
+	if hit {
+		h.hits++
+	}
+	if h.scanned++; h.scanned == blockHitWindow {
+		h.scanned, h.hits = h.scanned/2, h.hits/2
+	}
+	// Dense once three in four recent scans had a hit
+	if h.scanned >= 4 && 4*h.hits >= 3*h.scanned {
+		h.skip = blockSkipRun
+	}
+}
+
+// MatchColumn evaluates the search over every row of a string column stored
+// Arrow-style: row i is data[offsets[i]:offsets[i+1]], so offsets holds one
+// more entry than there are rows. Bit i%64 of out[i/64] is set if row i
+// matches and cleared otherwise; out must hold at least (rows+63)/64 words.
+//
+// Rows are scanned in groups of about columnBlockBytes with one engine call
+// per group. A group with no pattern anywhere in its bytes decides all of
+// its rows at once; only groups with a hit are revisited row by row, so
+// selective searches over short rows avoid the per-row call overhead of
+// Match. When most groups have a hit, the group scan is skipped for a run
+// of groups (see blockHitRate), so non-selective searches do not scan
+// their rows twice. Searches that scan for whole-word patterns skip the
+// group scan, since a row's edges are word boundaries that the group does
+// not see. Anchored and glob patterns, whole-word ones included, are
+// checked per row either way.
+func (bs *BooleanSearch) MatchColumn(data []byte, offsets []uint32, out []uint64) {
+	rows := len(offsets) - 1
+	if rows <= 0 {
+		return
+	}
+	_ = out[(rows-1)/64]
+
+	// Result of a row without any pattern
+	var empty bool
+	var set []uint64
+	if bs.banks != nil {
+		set = make([]uint64, len(bs.banks))
+		empty = bs.expr.evaluateSet(set, true) == TRUE
+	} else {
+		empty = bs.expr.Evaluate(0, true) == TRUE
+	}
+
+	prefilter := !bs.scansWholeWords()
+	anchors := bs.numScanned < bs.numPatterns
+	var rate blockHitRate
+	for first := 0; first < rows; {
+		// Grow the group until it holds columnBlockBytes (or one large row)
+		last := first + 1
+		for last < rows && offsets[last+1]-offsets[first] <= columnBlockBytes {
+			last++
+		}
+
+		hit := bs.numScanned > 0
+		if hit && prefilter && rate.scan() {
+			hit = bs.anyPattern(bytesToString(data[offsets[first]:offsets[last]]), set)
+			rate.record(hit)
+		}
+		if !hit {
+			for i := first; i < last; i++ {
+				v := empty
+				if anchors {
+					v = bs.matchRow(bytesToString(data[offsets[i]:offsets[i+1]]), set, false)
+				}
+				setBit(out, i, v)
+			}
+		} else {
+			for i := first; i < last; i++ {
+				setBit(out, i, bs.matchRow(bytesToString(data[offsets[i]:offsets[i+1]]), set, true))
+			}
+		}
+		first = last
+	}
+}
+
+// anyPattern reports whether any pattern may occur in haystack. set is
+// scratch space for banked searches.
+func (bs *BooleanSearch) anyPattern(haystack string, set []uint64) bool {
+	if set != nil {
+		clear(set)
+		bs.searchBanks(haystack, set, nil)
+		for _, m := range set {
+			if m != 0 {
+				return true
+			}
+		}
+		return false
+	}
+	if bs.useFDR {
+		return bs.searchFDR(haystack, 0, nil) != 0
+	}
+	return bs.searchTBL(haystack, 0, nil) != 0
+}
+
+// matchRow is Match without the flood precheck. With scan false only the
+// anchored and glob patterns are checked: the row is known not to contain
+// any scanned one. set is scratch space for banked searches.
+func (bs *BooleanSearch) matchRow(row string, set []uint64, scan bool) bool {
+	if set != nil {
+		clear(set)
+		bs.findAnchors(row, set, nil)
+		if scan {
+			bs.searchBanks(row, set, nil)
+		}
+		return bs.expr.evaluateSet(set, true) == TRUE
+	}
+	var found uint64
+	if bs.numScanned < bs.numPatterns {
+		found = bs.matchAnchors(row, nil)
+	}
+	switch {
+	case !scan:
+	case bs.useFDR:
+		found = bs.searchFDR(row, found, nil)
+	default:
+		found = bs.searchTBL(row, found, nil)
+	}
+	return bs.expr.Evaluate(found, true) == TRUE
+}
+
+// setBit sets or clears bit i of the bitmap.
+func setBit(bitmap []uint64, i int, v bool) {
+	if v {
+		bitmap[i/64] |= 1 << (i % 64)
+	} else {
+		bitmap[i/64] &^= 1 << (i % 64)
+	}
+}
+
+// bytesToString returns a string sharing b's memory.
+func bytesToString(b []byte) string {
+	return unsafe.String(unsafe.SliceData(b), len(b))
+}
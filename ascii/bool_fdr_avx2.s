@@ -0,0 +1,380 @@
+//go:build !noasm && amd64
+
+// AVX2-accelerated FDR engine for 9-64 patterns
+//
+// Uses a VPSHUFB coarse prefilter over 32 positions at a time, then FDR hash
+// confirmation for the positions that survive it. The 8-bit group mask per
+// position is converted to a 64-bit pattern mask via the precomputed LUT.
+// Same tables and verification scheme as bool_fdr_neon.s.
+
+#include "textflag.h"
+
+// func searchFDR_AVX2(
+//     haystack string,                // +0(FP): ptr, +8(FP): len
+//     stateTable *uint64,             // +16(FP)
+//     domainMask uint32,              // +24(FP)
+//     stride int,                     // +32(FP) (unused, every position is checked)
+//     coarseLo *[16]uint8,            // +40(FP) - TBL prefilter tables
+//     coarseHi *[16]uint8,            // +48(FP)
+//     groupLUT *[256]uint64,          // +56(FP) - 8-bit group mask → 64-bit pattern mask
+//     verifyValues *[64]uint64,       // +64(FP)
+//     verifyMasks *[64]uint64,        // +72(FP)
+//     verifyLengths *[64]uint16,      // +80(FP)
+//     verifyPtrs *[64]string,         // +88(FP)
+//     verifyBoundaries *[64]*CharSet, // +96(FP) whole-word boundary sets, nil entries match anywhere
+//     verifyExact uint64,             // +104(FP) patterns compared exactly, without case folding
+//     numPatterns int,                // +112(FP)
+//     minPatternLen int,              // +120(FP)
+//     immediateTrueMask uint64,       // +128(FP)
+//     immediateFalseMask uint64,      // +136(FP)
+//     initialFoundMask uint64,        // +144(FP)
+//     offsets *[64]int,               // +152(FP) first match offsets, may be nil
+// ) uint64                            // +160(FP) return value
+//
+// The caller guarantees at least 32 candidate positions
+// (len(haystack) - minPatternLen + 1 >= 32); the final partial block is
+// handled by re-scanning an overlapping 32-byte window. Positions are
+// visited in increasing order, so the offset stored for a pattern is its
+// first match.
+//
+// Register allocation:
+// AX  = candidate position bitmask for the current block
+// BX  = candidate patterns at the current position
+// CX  = shift count / current position
+// DX  = haystack len
+// SI  = haystack ptr
+// DI  = block start position
+// R8  = stateTable ptr
+// R9  = groupLUT ptr
+// R10 = domainMask
+// R11 = pattern ID
+// R12 = temp
+// R13 = foundMask (accumulator)
+// R14 = temp
+// R15 = number of candidate positions (len - minPatternLen + 1)
+//
+// The verify tables are only needed for candidates that pass the FDR hash,
+// so they are read from the argument frame instead of holding registers.
+//
+// Y0 = coarseLo (both lanes), Y1 = coarseHi (both lanes), Y2 = 0x0F,
+// Y3 = all ones
+//
+// Stack: 0(SP) = 32-byte group mask vector, 32(SP) = allPatternsMask,
+// 40(SP), 48(SP) = spill slots, 56(SP) = pattern length
+
+TEXT ·searchFDR_AVX2(SB), NOSPLIT, $64-168
+	MOVQ haystack_base+0(FP), SI
+	MOVQ haystack_len+8(FP), DX
+	MOVQ stateTable+16(FP), R8
+	MOVL domainMask+24(FP), R10
+	MOVQ coarseLo+40(FP), R12
+	MOVQ coarseHi+48(FP), R14
+	MOVQ groupLUT+56(FP), R9
+	MOVQ initialFoundMask+144(FP), R13
+
+	// Number of candidate positions
+	MOVQ DX, R15
+	SUBQ minPatternLen+120(FP), R15
+	INCQ R15
+
+	// allPatternsMask = (1 << numPatterns) - 1, for numPatterns <= 64
+	MOVQ  numPatterns+112(FP), CX
+	MOVQ  $-1, AX
+	CMPQ  CX, $64
+	JAE   all_mask_done
+	MOVL  $1, AX
+	SHLQ  CX, AX
+	DECQ  AX
+
+all_mask_done:
+	MOVQ AX, 32(SP)
+
+	// Load TBL prefilter tables into both 128-bit lanes
+	VBROADCASTI128 (R12), Y0
+	VBROADCASTI128 (R14), Y1
+
+	// Nibble mask and all-ones constants
+	MOVQ         $0x0F0F0F0F0F0F0F0F, R12
+	MOVQ         R12, X2
+	VPBROADCASTQ X2, Y2
+	VPCMPEQB     Y3, Y3, Y3
+
+	XORQ DI, DI
+
+// ============================================================================
+// MAIN LOOP: coarse prefilter for 32 positions at a time
+// ============================================================================
+fdr_loop32:
+	LEAQ 32(DI), R12
+	CMPQ R12, R15
+	JA   fdr_tail
+	XORL CX, CX
+
+fdr_block:
+	// CX = number of leading positions already scanned (overlapping tail)
+	VMOVDQU (SI)(DI*1), Y4
+	VPSRLW  $4, Y4, Y5
+	VPAND   Y2, Y4, Y4                // Y4 = lo nibbles
+	VPAND   Y2, Y5, Y5                // Y5 = hi nibbles
+	VPSHUFB Y4, Y0, Y4                // Y4 = coarseLo[lo_nibble]
+	VPSHUFB Y5, Y1, Y5                // Y5 = coarseHi[hi_nibble]
+
+	// Combine: 0 bit = group might match (inverted logic)
+	VPOR Y4, Y5, Y4
+
+	// Positions with any 0 bit have candidate groups
+	VPCMPEQB  Y3, Y4, Y5
+	VPMOVMSKB Y5, AX
+	NOTL      AX
+	SHRL      CX, AX
+	SHLL      CX, AX
+	TESTL     AX, AX
+	JZ        fdr_next_block
+
+	VMOVDQU Y4, (SP)
+
+fdr_process_pos:
+	BSFL AX, CX
+	BTRL CX, AX
+
+	// LUT lookup: group mask → pattern mask
+	MOVBLZX (SP)(CX*1), BX
+	NOTL    BX
+	ANDL    $0xFF, BX
+	MOVQ    (R9)(BX*8), BX
+
+	ADDQ DI, CX                       // CX = haystack position
+
+	// FDR hash lookup on the 4 bytes at position (without reading past the end)
+	LEAQ 4(CX), R14
+	CMPQ R14, DX
+	JA   fdr_hash_near_end
+	MOVL (SI)(CX*1), R12
+
+fdr_hash:
+	ANDL R10, R12
+	MOVQ (R8)(R12*8), R12
+
+	// Combine: candidates = ~state & LUT_mask & ~foundMask
+	NOTQ R12
+	ANDQ R12, BX
+	MOVQ R13, R12
+	NOTQ R12
+	ANDQ R12, BX
+	JZ   fdr_next_pos
+
+fdr_verify:
+	BSFQ BX, R11
+	BTRQ R11, BX
+
+	// Check pattern length vs remaining haystack
+	MOVQ    verifyLengths+80(FP), R12
+	MOVWQZX (R12)(R11*2), R12
+	MOVQ    R12, 56(SP)
+	ADDQ    CX, R12
+	CMPQ    R12, DX
+	JA      fdr_next_cand
+
+	// Load 8 bytes from haystack at position (without reading past the end)
+	LEAQ 8(CX), R14
+	CMPQ R14, DX
+	JA   fdr_load_near_end
+	MOVQ (SI)(CX*1), R14
+
+fdr_verify_masked:
+	MOVQ verifyMasks+72(FP), R12
+	ANDQ (R12)(R11*8), R14
+	MOVQ verifyValues+64(FP), R12
+	CMPQ R14, (R12)(R11*8)
+	JNE  fdr_next_cand
+
+	// For patterns > 8 bytes, do extended verification
+	MOVQ 56(SP), R12
+	CMPQ R12, $8
+	JA   fdr_verify_long
+
+fdr_check_word:
+	// Whole-word patterns: the bytes around the match must be boundaries
+	MOVQ  verifyBoundaries+96(FP), R12
+	MOVQ  (R12)(R11*8), R12           // R12 = boundary bitset, nil for substring patterns
+	TESTQ R12, R12
+	JZ    fdr_matched
+	TESTQ CX, CX
+	JZ    fdr_check_word_end
+	MOVBQZX -1(SI)(CX*1), R14
+	BTQ     R14, (R12)
+	JCC     fdr_next_cand
+
+fdr_check_word_end:
+	MOVQ    56(SP), R14
+	ADDQ    CX, R14
+	CMPQ    R14, DX
+	JAE     fdr_matched
+	MOVBQZX (SI)(R14*1), R14
+	BTQ     R14, (R12)
+	JCC     fdr_next_cand
+
+fdr_matched:
+	BTSQ R11, R13                     // foundMask |= (1 << pid)
+
+	// offsets[pid] = position
+	MOVQ  offsets+152(FP), R12
+	TESTQ R12, R12
+	JZ    fdr_check_term
+	MOVQ  CX, (R12)(R11*8)
+
+fdr_check_term:
+	// Check immediate termination
+	MOVQ  immediateTrueMask+128(FP), R12
+	ORQ   immediateFalseMask+136(FP), R12
+	TESTQ R12, R13
+	JNZ   fdr_done
+
+	// All patterns found?
+	CMPQ R13, 32(SP)
+	JEQ  fdr_done
+
+fdr_next_cand:
+	TESTQ BX, BX
+	JNZ   fdr_verify
+
+fdr_next_pos:
+	TESTL AX, AX
+	JNZ   fdr_process_pos
+
+fdr_next_block:
+	ADDQ $32, DI
+	JMP  fdr_loop32
+
+fdr_tail:
+	// Rescan the last 32 positions, skipping those already covered
+	CMPQ DI, R15
+	JAE  fdr_done
+	MOVQ DI, CX
+	MOVQ R15, DI
+	SUBQ $32, DI
+	SUBQ DI, CX
+	JMP  fdr_block
+
+fdr_hash_near_end:
+	// Fewer than 4 bytes left: load the final 4 bytes and shift the ones at
+	// position down. The missing bytes are don't-care for patterns short
+	// enough to fit, so zero padding is fine.
+	MOVQ CX, 40(SP)
+	MOVL -4(SI)(DX*1), R12
+	SUBQ DX, CX
+	ADDQ $4, CX
+	SHLQ $3, CX
+	SHRL CX, R12
+	MOVQ 40(SP), CX
+	JMP  fdr_hash
+
+fdr_load_near_end:
+	// Fewer than 8 bytes left: load the final 8 bytes and shift the
+	// ones at position down (haystack is at least 32 bytes long)
+	MOVQ CX, 40(SP)
+	MOVQ -8(SI)(DX*1), R14
+	SUBQ DX, CX
+	ADDQ $8, CX
+	SHLQ $3, CX
+	SHRQ CX, R14
+	MOVQ 40(SP), CX
+	JMP  fdr_verify_masked
+
+fdr_verify_long:
+	// Long pattern verification (>8 bytes)
+	// CX = haystack position, R11 = pattern ID, R12 = pattern length
+	// First 8 bytes already matched. Now check bytes 8 onwards against
+	// verifyPtrs[pid]: uppercase, or as is for the patterns in verifyExact.
+	MOVQ AX, 40(SP)
+	MOVQ BX, 48(SP)
+
+	// verifyPtrs is [64]string, each string is 16 bytes (ptr + len)
+	MOVQ verifyPtrs+88(FP), R14
+	MOVQ R11, AX
+	SHLQ $4, AX
+	MOVQ (R14)(AX*1), R14             // R14 = pattern ptr
+
+	LEAQ (SI)(CX*1), BX               // BX = haystack ptr + position
+	SUBQ BX, R14                      // R14 = pattern ptr - haystack ptr
+	ADDQ BX, R12                      // R12 = end ptr
+	ADDQ $8, BX
+
+	// From 32 bytes on, compare a vector at a time with lowercase haystack
+	// letters folded to uppercase unless the compare is exact; the last
+	// window overlaps the previous one.
+	MOVQ R12, AX
+	SUBQ BX, AX
+	CMPQ AX, $32
+	JB   fdr_long_loop
+	MOVL         $0x1f1f1f1f, AX
+	VMOVD        AX, X10
+	VPBROADCASTD X10, Y10             // Y10 = bias mapping 'a'-'z' to -128..-103
+	MOVL         $0x9a9a9a9a, AX
+	VMOVD        AX, X11
+	VPBROADCASTD X11, Y11             // Y11 = -102
+	MOVL         $0x20202020, AX
+	BTQ          R11, verifyExact+104(FP)
+	JCC          fdr_long_fold
+	XORL         AX, AX               // case-sensitive: compare exactly
+
+fdr_long_fold:
+	VMOVD        AX, X12
+	VPBROADCASTD X12, Y12             // Y12 = case bit, zero for exact compares
+
+fdr_long_vec:
+	VMOVDQU   (BX), Y13
+	VPADDB    Y10, Y13, Y14
+	VPCMPGTB  Y14, Y11, Y14           // 0xFF where the haystack byte is 'a'-'z'
+	VPAND     Y12, Y14, Y14
+	VPSUBB    Y14, Y13, Y13           // fold to uppercase
+	VPCMPEQB  (BX)(R14*1), Y13, Y13
+	VPMOVMSKB Y13, AX
+	CMPL      AX, $0xffffffff
+	JNE       fdr_long_fail
+	ADDQ      $32, BX
+	LEAQ      32(BX), AX
+	CMPQ      AX, R12
+	JBE       fdr_long_vec
+	CMPQ      BX, R12
+	JAE       fdr_long_ok
+	LEAQ      -32(R12), BX
+	JMP       fdr_long_vec
+
+fdr_long_loop:
+	CMPQ BX, R12
+	JAE  fdr_long_ok
+
+	MOVBLZX (BX), AX
+	CMPB    AX, (BX)(R14*1)
+	JEQ     fdr_long_next
+
+	// Case-sensitive patterns match exactly; for the others the pattern
+	// byte is uppercase
+	BTQ  R11, verifyExact+104(FP)
+	JCS  fdr_long_fail
+	SUBL $0x61, AX                    // check if lowercase
+	CMPL AX, $26
+	JAE  fdr_long_fail
+	ADDL $0x41, AX                    // convert to uppercase
+	CMPB AX, (BX)(R14*1)
+	JNE  fdr_long_fail
+
+fdr_long_next:
+	INCQ BX
+	JMP  fdr_long_loop
+
+fdr_long_ok:
+	MOVQ 40(SP), AX
+	MOVQ 48(SP), BX
+	JMP  fdr_check_word
+
+fdr_long_fail:
+	MOVQ 40(SP), AX
+	MOVQ 48(SP), BX
+	JMP  fdr_next_cand
+
+fdr_done:
+	VZEROUPPER
+	MOVQ R13, ret+160(FP)
+	RET
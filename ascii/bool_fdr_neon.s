@@ -12,20 +12,32 @@
 //     haystack string,           // +0(FP): ptr, +8(FP): len
 //     stateTable *uint64,        // +16(FP)
 //     domainMask uint32,         // +24(FP)
-//     stride int,                // +32(FP)
+//     stride int,                // +32(FP) (unused, every position is checked)
 //     coarseLo *[16]uint8,       // +40(FP) - TBL prefilter tables
 //     coarseHi *[16]uint8,       // +48(FP)
 //     groupLUT *[256]uint64,     // +56(FP) - 8-bit group mask → 64-bit pattern mask
 //     verifyValues *[64]uint64,  // +64(FP)
 //     verifyMasks *[64]uint64,   // +72(FP)
-//     verifyLengths *[64]uint8,  // +80(FP)
+//     verifyLengths *[64]uint16, // +80(FP)
 //     verifyPtrs *[64]string,    // +88(FP)
-//     numPatterns int,           // +96(FP)
-//     minPatternLen int,         // +104(FP)
-//     immediateTrueMask uint64,  // +112(FP)
-//     immediateFalseMask uint64, // +120(FP)
-//     initialFoundMask uint64,   // +128(FP)
-// ) uint64                       // +136(FP) return value
+//     verifyExact uint64,        // +96(FP) patterns compared exactly, without case folding
+//     numPatterns int,           // +104(FP)
+//     minPatternLen int,         // +112(FP)
+//     immediateTrueMask uint64,  // +120(FP)
+//     immediateFalseMask uint64, // +128(FP)
+//     initialFoundMask uint64,   // +136(FP)
+//     offsets *[64]int,          // +144(FP) - first offset per pattern, or nil
+// ) uint64                       // +152(FP) return value
+//
+// The state table is keyed on the first 4 bytes of each pattern, so every
+// position is hashed. The main loop takes 16 positions at a time: the TBL
+// prefilter gives a group mask per byte, and each nonzero byte is hashed
+// and its candidates verified. It runs while the 4-byte hashes of the whole
+// block lie inside the haystack; the remaining positions are checked one at
+// a time, hashing the last few with zero bytes in place of those past the
+// end (short patterns match any byte there, see expandFDRHash). Positions
+// are visited in increasing order, so the offset stored for a pattern is its
+// first match.
 //
 // Register allocation:
 // R0  = haystack ptr
@@ -39,11 +51,15 @@
 // R8  = immediateTrueMask
 // R9  = immediateFalseMask
 // R10 = foundMask (accumulator)
-// R11 = current position
+// R11 = current position (block start in the main loop)
 // R12 = searchLen (haystack_len - minPatternLen)
 // R13 = allPatternsMask
-// R14 = stride
-// R15-R17, R19-R26 = temp (avoid R18 platform, R27 REGTMP)
+// R14 = 0 in the main loop, 1 in the tail (where verification returns to)
+// R17 = candidate patterns at position R21
+// R21 = position being verified
+// R24 = position of byte 0 of R25
+// R25, R26 = group mask bytes left in the low and high half of the block
+// R15, R16, R19, R20, R22, R23 = temp (avoid R18 platform, R27 REGTMP)
 //
 // Vector registers:
 // V0  = coarseLo TBL table
@@ -51,24 +67,23 @@
 // V2  = 0x0F nibble mask
 // V3  = all ones for NOT
 
-TEXT ·searchFDR_NEON(SB), NOSPLIT, $0-144
+TEXT ·searchFDR_NEON(SB), NOSPLIT, $0-160
 	// Load parameters
 	MOVD  haystack+0(FP), R0
 	MOVD  haystack_len+8(FP), R1
 	MOVD  stateTable+16(FP), R2
 	MOVW  domainMask+24(FP), R3
-	MOVD  stride+32(FP), R14
 	MOVD  coarseLo+40(FP), R15
 	MOVD  coarseHi+48(FP), R16
 	MOVD  groupLUT+56(FP), R4
 	MOVD  verifyValues+64(FP), R5
 	MOVD  verifyMasks+72(FP), R6
 	MOVD  verifyLengths+80(FP), R7
-	MOVD  numPatterns+96(FP), R17
-	MOVD  minPatternLen+104(FP), R19
-	MOVD  immediateTrueMask+112(FP), R8
-	MOVD  immediateFalseMask+120(FP), R9
-	MOVD  initialFoundMask+128(FP), R10
+	MOVD  numPatterns+104(FP), R17
+	MOVD  minPatternLen+112(FP), R19
+	MOVD  immediateTrueMask+120(FP), R8
+	MOVD  immediateFalseMask+128(FP), R9
+	MOVD  initialFoundMask+136(FP), R10
 
 	// Calculate searchLen = len - minPatternLen
 	SUBS  R19, R1, R12
@@ -81,6 +96,7 @@ TEXT ·searchFDR_NEON(SB), NOSPLIT, $0-144
 
 	// Setup current position
 	MOVD  ZR, R11
+	MOVD  ZR, R14
 
 	// Load TBL prefilter tables into vector registers
 	VLD1  (R15), [V0.B16]              // V0 = coarseLo table
@@ -96,18 +112,18 @@ TEXT ·searchFDR_NEON(SB), NOSPLIT, $0-144
 	VMOV  R15, V3.D[0]
 	VMOV  R15, V3.D[1]                // V3 = all ones
 
-	// Check if we can do 16-byte chunks with stride 4
-	CMP   $4, R14
-	BNE   fdr_tail_entry
-
-	// Check if enough bytes for 16-byte chunk
-	CMP   $16, R12
-	BLT   fdr_tail_entry
-
 // ============================================================================
-// MAIN LOOP: Process 16 bytes at a time with TBL prefilter (stride 4)
+// MAIN LOOP: Process 16 positions at a time with TBL prefilter
 // ============================================================================
 fdr_loop16:
+	CMP   R12, R11
+	BGT   fdr_done
+
+	// The hash at the last position of the block reads up to pos+19
+	ADD   $19, R11, R15
+	CMP   R1, R15
+	BGT   fdr_tail_entry
+
 	// Load 16 bytes from haystack
 	ADD   R0, R11, R15
 	VLD1  (R15), [V16.B16]
@@ -126,22 +142,40 @@ fdr_loop16:
 	// Invert: 1 bit = candidate group
 	VEOR  V3.B16, V8.B16, V8.B16
 
-	// Quick check: any candidates at all?
-	VADDP V8.D2, V8.D2, V9.D2
-	VMOV  V9.D[0], R15
-	CBZ   R15, fdr_loop16_next
-
-	// Position 0: byte 0
-	VMOV  V8.B[0], R16                // R16 = group mask at pos 0
-	CBZ   R16, fdr_pos4
+	VMOV  V8.D[0], R25                // group masks of positions 0-7
+	VMOV  V8.D[1], R26                // group masks of positions 8-15
+	MOVD  R11, R24
+
+fdr_next_byte:
+	CBNZ  R25, fdr_byte
+	CBZ   R26, fdr_loop16_next
+
+	// Move on to the high half
+	MOVD  R26, R25
+	MOVD  ZR, R26
+	ADD   $8, R24, R24
+
+fdr_byte:
+	// Lowest nonzero byte of R25: R16 = its bit offset
+	RBIT  R25, R16
+	CLZ   R16, R16
+	AND   $0x38, R16, R16
+	ADD   R16>>3, R24, R21            // R21 = position
+
+	// R19 = group mask, cleared from R25
+	LSR   R16, R25, R19
+	AND   $0xFF, R19, R19
+	MOVD  $0xFF, R15
+	LSL   R16, R15, R15
+	BIC   R15, R25, R25
 
 	// LUT lookup: group mask → pattern mask
-	LSL   $3, R16, R17                // offset = groupMask * 8
-	ADD   R4, R17, R17
-	MOVD  (R17), R19                  // R19 = pattern mask from LUT
+	LSL   $3, R19, R19                // offset = groupMask * 8
+	ADD   R4, R19, R19
+	MOVD  (R19), R19                  // R19 = pattern mask from LUT
 
 	// FDR hash lookup
-	ADD   R0, R11, R15
+	ADD   R0, R21, R15
 	MOVWU (R15), R15
 	AND   R3, R15, R15
 	LSL   $3, R15, R17
@@ -149,440 +183,25 @@ fdr_loop16:
 	MOVD  (R17), R17                  // R17 = state table entry
 
 	// Combine: candidates = ~state & LUT_mask & ~foundMask
-	MVN   R17, R17
-	AND   R19, R17, R17
-	BIC   R10, R17, R17
-	CBZ   R17, fdr_pos4
-
-	MOVD  R11, R21                    // R21 = current position
-
-fdr_verify_0:
-	RBIT  R17, R19
-	CLZ   R19, R19                    // R19 = pattern ID
-
-	ADD   R7, R19, R20
-	MOVBU (R20), R20                  // R20 = pattern length
-	ADD   R21, R20, R22
-	CMP   R1, R22
-	BGT   fdr_clear_0
-
-	ADD   R0, R21, R22
-	MOVD  (R22), R22                  // R22 = haystack bytes
-
-	LSL   $3, R19, R23
-	ADD   R5, R23, R24
-	MOVD  (R24), R24                  // expected value
-	ADD   R6, R23, R23
-	MOVD  (R23), R23                  // mask
-
-	AND   R23, R22, R22
-	CMP   R24, R22
-	BNE   fdr_clear_0
-
-	CMP   $8, R20
-	BGT   fdr_verify_long_0
-
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	ORR   R22, R10, R10
-
-	TST   R8, R10
-	BNE   fdr_done
-	TST   R9, R10
-	BNE   fdr_done
-	CMP   R13, R10
-	BEQ   fdr_done
-	B     fdr_clear_0
-
-fdr_verify_long_0:
-	MOVD  verifyPtrs+88(FP), R22
-	LSL   $4, R19, R23
-	ADD   R22, R23, R22
-	MOVD  (R22), R22
-
-	ADD   $8, R21, R15
-	ADD   R0, R15, R15
-	ADD   $8, R22, R22
-	SUB   $8, R20, R23
-
-fdr_long_loop_0:
-	CBZ   R23, fdr_long_match_0
-	MOVBU (R15), R24
-	MOVBU (R22), R25
-	CMPW  R25, R24
-	BEQ   fdr_long_next_0
-	SUBW  $'a', R24, R25
-	CMPW  $26, R25
-	BCS   fdr_clear_0
-	MOVBU (R15), R24
-	ANDW  $0xDF, R24, R24
-	MOVBU (R22), R25
-	CMPW  R25, R24
-	BNE   fdr_clear_0
-
-fdr_long_next_0:
-	ADD   $1, R15, R15
-	ADD   $1, R22, R22
-	SUB   $1, R23, R23
-	B     fdr_long_loop_0
-
-fdr_long_match_0:
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	ORR   R22, R10, R10
-	TST   R8, R10
-	BNE   fdr_done
-	TST   R9, R10
-	BNE   fdr_done
-	CMP   R13, R10
-	BEQ   fdr_done
-
-fdr_clear_0:
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	BIC   R22, R17, R17
-	CBNZ  R17, fdr_verify_0
-
-fdr_pos4:
-	VMOV  V8.B[4], R16
-	CBZ   R16, fdr_pos8
-
-	ADD   $4, R11, R21
-	CMP   R12, R21
-	BGT   fdr_pos8
-
-	LSL   $3, R16, R17
-	ADD   R4, R17, R17
-	MOVD  (R17), R19
-
-	ADD   R0, R21, R15
-	MOVWU (R15), R15
-	AND   R3, R15, R15
-	LSL   $3, R15, R17
-	ADD   R2, R17, R17
-	MOVD  (R17), R17
-
-	MVN   R17, R17
-	AND   R19, R17, R17
+	BIC   R17, R19, R17
 	BIC   R10, R17, R17
-	CBZ   R17, fdr_pos8
-
-fdr_verify_4:
-	RBIT  R17, R19
-	CLZ   R19, R19
-
-	ADD   R7, R19, R20
-	MOVBU (R20), R20
-	ADD   R21, R20, R22
-	CMP   R1, R22
-	BGT   fdr_clear_4
-
-	ADD   R0, R21, R22
-	MOVD  (R22), R22
-
-	LSL   $3, R19, R23
-	ADD   R5, R23, R24
-	MOVD  (R24), R24
-	ADD   R6, R23, R23
-	MOVD  (R23), R23
-
-	AND   R23, R22, R22
-	CMP   R24, R22
-	BNE   fdr_clear_4
-
-	CMP   $8, R20
-	BGT   fdr_verify_long_4
-
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	ORR   R22, R10, R10
-	TST   R8, R10
-	BNE   fdr_done
-	TST   R9, R10
-	BNE   fdr_done
-	CMP   R13, R10
-	BEQ   fdr_done
-	B     fdr_clear_4
-
-fdr_verify_long_4:
-	MOVD  verifyPtrs+88(FP), R22
-	LSL   $4, R19, R23
-	ADD   R22, R23, R22
-	MOVD  (R22), R22
-	ADD   $8, R21, R15
-	ADD   R0, R15, R15
-	ADD   $8, R22, R22
-	SUB   $8, R20, R23
-
-fdr_long_loop_4:
-	CBZ   R23, fdr_long_match_4
-	MOVBU (R15), R24
-	MOVBU (R22), R25
-	CMPW  R25, R24
-	BEQ   fdr_long_next_4
-	SUBW  $'a', R24, R25
-	CMPW  $26, R25
-	BCS   fdr_clear_4
-	MOVBU (R15), R24
-	ANDW  $0xDF, R24, R24
-	MOVBU (R22), R25
-	CMPW  R25, R24
-	BNE   fdr_clear_4
-
-fdr_long_next_4:
-	ADD   $1, R15, R15
-	ADD   $1, R22, R22
-	SUB   $1, R23, R23
-	B     fdr_long_loop_4
-
-fdr_long_match_4:
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	ORR   R22, R10, R10
-	TST   R8, R10
-	BNE   fdr_done
-	TST   R9, R10
-	BNE   fdr_done
-	CMP   R13, R10
-	BEQ   fdr_done
-
-fdr_clear_4:
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	BIC   R22, R17, R17
-	CBNZ  R17, fdr_verify_4
-
-fdr_pos8:
-	VMOV  V8.B[8], R16
-	CBZ   R16, fdr_pos12
-
-	ADD   $8, R11, R21
-	CMP   R12, R21
-	BGT   fdr_pos12
-
-	LSL   $3, R16, R17
-	ADD   R4, R17, R17
-	MOVD  (R17), R19
-
-	ADD   R0, R21, R15
-	MOVWU (R15), R15
-	AND   R3, R15, R15
-	LSL   $3, R15, R17
-	ADD   R2, R17, R17
-	MOVD  (R17), R17
-
-	MVN   R17, R17
-	AND   R19, R17, R17
-	BIC   R10, R17, R17
-	CBZ   R17, fdr_pos12
-
-fdr_verify_8:
-	RBIT  R17, R19
-	CLZ   R19, R19
-
-	ADD   R7, R19, R20
-	MOVBU (R20), R20
-	ADD   R21, R20, R22
-	CMP   R1, R22
-	BGT   fdr_clear_8
-
-	ADD   R0, R21, R22
-	MOVD  (R22), R22
-
-	LSL   $3, R19, R23
-	ADD   R5, R23, R24
-	MOVD  (R24), R24
-	ADD   R6, R23, R23
-	MOVD  (R23), R23
-
-	AND   R23, R22, R22
-	CMP   R24, R22
-	BNE   fdr_clear_8
-
-	CMP   $8, R20
-	BGT   fdr_verify_long_8
-
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	ORR   R22, R10, R10
-	TST   R8, R10
-	BNE   fdr_done
-	TST   R9, R10
-	BNE   fdr_done
-	CMP   R13, R10
-	BEQ   fdr_done
-	B     fdr_clear_8
-
-fdr_verify_long_8:
-	MOVD  verifyPtrs+88(FP), R22
-	LSL   $4, R19, R23
-	ADD   R22, R23, R22
-	MOVD  (R22), R22
-	ADD   $8, R21, R15
-	ADD   R0, R15, R15
-	ADD   $8, R22, R22
-	SUB   $8, R20, R23
-
-fdr_long_loop_8:
-	CBZ   R23, fdr_long_match_8
-	MOVBU (R15), R24
-	MOVBU (R22), R25
-	CMPW  R25, R24
-	BEQ   fdr_long_next_8
-	SUBW  $'a', R24, R25
-	CMPW  $26, R25
-	BCS   fdr_clear_8
-	MOVBU (R15), R24
-	ANDW  $0xDF, R24, R24
-	MOVBU (R22), R25
-	CMPW  R25, R24
-	BNE   fdr_clear_8
-
-fdr_long_next_8:
-	ADD   $1, R15, R15
-	ADD   $1, R22, R22
-	SUB   $1, R23, R23
-	B     fdr_long_loop_8
-
-fdr_long_match_8:
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	ORR   R22, R10, R10
-	TST   R8, R10
-	BNE   fdr_done
-	TST   R9, R10
-	BNE   fdr_done
-	CMP   R13, R10
-	BEQ   fdr_done
-
-fdr_clear_8:
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	BIC   R22, R17, R17
-	CBNZ  R17, fdr_verify_8
-
-fdr_pos12:
-	VMOV  V8.B[12], R16
-	CBZ   R16, fdr_loop16_next
-
-	ADD   $12, R11, R21
-	CMP   R12, R21
-	BGT   fdr_loop16_next
-
-	LSL   $3, R16, R17
-	ADD   R4, R17, R17
-	MOVD  (R17), R19
-
-	ADD   R0, R21, R15
-	MOVWU (R15), R15
-	AND   R3, R15, R15
-	LSL   $3, R15, R17
-	ADD   R2, R17, R17
-	MOVD  (R17), R17
-
-	MVN   R17, R17
-	AND   R19, R17, R17
-	BIC   R10, R17, R17
-	CBZ   R17, fdr_loop16_next
-
-fdr_verify_12:
-	RBIT  R17, R19
-	CLZ   R19, R19
-
-	ADD   R7, R19, R20
-	MOVBU (R20), R20
-	ADD   R21, R20, R22
-	CMP   R1, R22
-	BGT   fdr_clear_12
-
-	ADD   R0, R21, R22
-	MOVD  (R22), R22
-
-	LSL   $3, R19, R23
-	ADD   R5, R23, R24
-	MOVD  (R24), R24
-	ADD   R6, R23, R23
-	MOVD  (R23), R23
-
-	AND   R23, R22, R22
-	CMP   R24, R22
-	BNE   fdr_clear_12
-
-	CMP   $8, R20
-	BGT   fdr_verify_long_12
-
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	ORR   R22, R10, R10
-	TST   R8, R10
-	BNE   fdr_done
-	TST   R9, R10
-	BNE   fdr_done
-	CMP   R13, R10
-	BEQ   fdr_done
-	B     fdr_clear_12
-
-fdr_verify_long_12:
-	MOVD  verifyPtrs+88(FP), R22
-	LSL   $4, R19, R23
-	ADD   R22, R23, R22
-	MOVD  (R22), R22
-	ADD   $8, R21, R15
-	ADD   R0, R15, R15
-	ADD   $8, R22, R22
-	SUB   $8, R20, R23
-
-fdr_long_loop_12:
-	CBZ   R23, fdr_long_match_12
-	MOVBU (R15), R24
-	MOVBU (R22), R25
-	CMPW  R25, R24
-	BEQ   fdr_long_next_12
-	SUBW  $'a', R24, R25
-	CMPW  $26, R25
-	BCS   fdr_clear_12
-	MOVBU (R15), R24
-	ANDW  $0xDF, R24, R24
-	MOVBU (R22), R25
-	CMPW  R25, R24
-	BNE   fdr_clear_12
-
-fdr_long_next_12:
-	ADD   $1, R15, R15
-	ADD   $1, R22, R22
-	SUB   $1, R23, R23
-	B     fdr_long_loop_12
-
-fdr_long_match_12:
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	ORR   R22, R10, R10
-	TST   R8, R10
-	BNE   fdr_done
-	TST   R9, R10
-	BNE   fdr_done
-	CMP   R13, R10
-	BEQ   fdr_done
-
-fdr_clear_12:
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	BIC   R22, R17, R17
-	CBNZ  R17, fdr_verify_12
+	CBZ   R17, fdr_next_byte
+	B     fdr_verify
 
 fdr_loop16_next:
 	ADD   $16, R11, R11
-	CMP   R12, R11
-	BLE   fdr_loop16
+	B     fdr_loop16
 
 // ============================================================================
 // TAIL: Handle remaining positions one at a time
 // ============================================================================
 fdr_tail_entry:
+	MOVD  $1, R14
+
+fdr_tail_loop:
 	CMP   R12, R11
 	BGT   fdr_done
 
-fdr_tail_loop:
 	// TBL prefilter for single position
 	ADD   R0, R11, R15
 	MOVBU (R15), R16
@@ -608,93 +227,116 @@ fdr_tail_loop:
 	ADD   R4, R17, R17
 	MOVD  (R17), R19
 
-	// FDR hash lookup
+	// FDR hash lookup. Within 3 bytes of the end, load the last 4 bytes
+	// and shift the ones at the position down, zero-filling the rest.
+	ADD   $4, R11, R16
+	CMP   R1, R16
+	BGT   fdr_tail_hash_end
 	ADD   R0, R11, R15
 	MOVWU (R15), R15
+	B     fdr_tail_hash
+
+fdr_tail_hash_end:
+	ADD   R0, R1, R15
+	MOVWU -4(R15), R15
+	SUB   R1, R16, R16
+	LSL   $3, R16, R16
+	LSRW  R16, R15, R15
+
+fdr_tail_hash:
 	AND   R3, R15, R15
 	LSL   $3, R15, R17
 	ADD   R2, R17, R17
 	MOVD  (R17), R17
 
-	MVN   R17, R17
-	AND   R19, R17, R17
+	BIC   R17, R19, R17
 	BIC   R10, R17, R17
 	CBZ   R17, fdr_tail_next
 
 	MOVD  R11, R21
+	B     fdr_verify
+
+fdr_tail_next:
+	ADD   $1, R11, R11
+	B     fdr_tail_loop
 
-fdr_tail_verify:
+// ============================================================================
+// VERIFY: candidates R17 at position R21; returns to the loop given by R14
+// ============================================================================
+fdr_verify:
 	RBIT  R17, R19
-	CLZ   R19, R19
+	CLZ   R19, R19                    // R19 = pattern ID
 
-	ADD   R7, R19, R20
-	MOVBU (R20), R20
+	ADD   R19<<1, R7, R20
+	MOVHU (R20), R20                  // R20 = pattern length
 	ADD   R21, R20, R22
 	CMP   R1, R22
-	BGT   fdr_tail_clear
+	BGT   fdr_clear
 
+	// Load 8 bytes at the position, without reading past the end
+	ADD   $8, R21, R22
+	CMP   R1, R22
+	BGT   fdr_load_near_end
 	ADD   R0, R21, R22
-	MOVD  (R22), R22
+	MOVD  (R22), R22                  // R22 = haystack bytes
 
+fdr_loaded:
 	LSL   $3, R19, R23
-	ADD   R5, R23, R24
-	MOVD  (R24), R24
+	ADD   R5, R23, R15
+	MOVD  (R15), R15                  // expected value
 	ADD   R6, R23, R23
-	MOVD  (R23), R23
+	MOVD  (R23), R23                  // mask
 
 	AND   R23, R22, R22
-	CMP   R24, R22
-	BNE   fdr_tail_clear
+	CMP   R15, R22
+	BNE   fdr_clear
 
 	CMP   $8, R20
-	BGT   fdr_tail_long
-
-	MOVD  $1, R22
-	LSL   R19, R22, R22
-	ORR   R22, R10, R10
-	TST   R8, R10
-	BNE   fdr_done
-	TST   R9, R10
-	BNE   fdr_done
-	CMP   R13, R10
-	BEQ   fdr_done
-	B     fdr_tail_clear
+	BLE   fdr_matched
 
-fdr_tail_long:
+	// Long pattern: bytes 8 onwards against verifyPtrs[pid], which is
+	// uppercase unless the pattern is in verifyExact
 	MOVD  verifyPtrs+88(FP), R22
 	LSL   $4, R19, R23
 	ADD   R22, R23, R22
-	MOVD  (R22), R22
+	MOVD  (R22), R16
+	ADD   $8, R16, R16                // R16 = pattern ptr + 8
 	ADD   $8, R21, R15
-	ADD   R0, R15, R15
-	ADD   $8, R22, R22
-	SUB   $8, R20, R23
-
-fdr_tail_long_loop:
-	CBZ   R23, fdr_tail_long_match
-	MOVBU (R15), R24
-	MOVBU (R22), R25
-	CMPW  R25, R24
-	BEQ   fdr_tail_long_next
-	SUBW  $'a', R24, R25
-	CMPW  $26, R25
-	BCS   fdr_tail_clear
-	MOVBU (R15), R24
-	ANDW  $0xDF, R24, R24
-	MOVBU (R22), R25
-	CMPW  R25, R24
-	BNE   fdr_tail_clear
-
-fdr_tail_long_next:
+	ADD   R0, R15, R15                // R15 = haystack ptr + position + 8
+	SUB   $8, R20, R20                // R20 = bytes left
+
+fdr_long_loop:
+	CBZ   R20, fdr_matched
+	MOVBU (R15), R22
+	MOVBU (R16), R23
+	CMPW  R23, R22
+	BEQ   fdr_long_next
+	SUBW  $'a', R22, R22              // haystack byte must be lowercase
+	CMPW  $26, R22
+	BCS   fdr_clear
+	SUBW  $'A', R23, R23              // and the uppercase pattern byte
+	CMPW  R23, R22
+	BNE   fdr_clear
+	MOVD  verifyExact+96(FP), R22     // equal up to case: not enough for
+	LSR   R19, R22, R22               // case-sensitive patterns
+	TBNZ  $0, R22, fdr_clear
+
+fdr_long_next:
 	ADD   $1, R15, R15
-	ADD   $1, R22, R22
-	SUB   $1, R23, R23
-	B     fdr_tail_long_loop
+	ADD   $1, R16, R16
+	SUB   $1, R20, R20
+	B     fdr_long_loop
 
-fdr_tail_long_match:
+fdr_matched:
 	MOVD  $1, R22
 	LSL   R19, R22, R22
 	ORR   R22, R10, R10
+	MOVD  offsets+144(FP), R22
+	CBZ   R22, fdr_rec_skip
+	ADD   R19<<3, R22, R22
+	MOVD  R21, (R22)
+
+fdr_rec_skip:
 	TST   R8, R10
 	BNE   fdr_done
 	TST   R9, R10
@@ -702,17 +344,26 @@ fdr_tail_long_match:
 	CMP   R13, R10
 	BEQ   fdr_done
 
-fdr_tail_clear:
+fdr_clear:
 	MOVD  $1, R22
 	LSL   R19, R22, R22
 	BIC   R22, R17, R17
-	CBNZ  R17, fdr_tail_verify
+	CBNZ  R17, fdr_verify
 
-fdr_tail_next:
-	ADD   R14, R11, R11
-	CMP   R12, R11
-	BLE   fdr_tail_loop
+	CBNZ  R14, fdr_tail_next
+	B     fdr_next_byte
 
 fdr_done:
-	MOVD  R10, ret+136(FP)
+	MOVD  R10, ret+152(FP)
 	RET
+
+fdr_load_near_end:
+	// Fewer than 8 bytes left: load the final 8 bytes and shift the ones at
+	// the position down (the caller guarantees a haystack of at least 8
+	// bytes); the pattern masks ignore the zero fill
+	SUB   R1, R22, R22
+	LSL   $3, R22, R22
+	ADD   R0, R1, R23
+	MOVD  -8(R23), R23
+	LSR   R22, R23, R22
+	B     fdr_loaded
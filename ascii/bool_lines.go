@@ -0,0 +1,83 @@
+package ascii
+
+import "bytes"
+
+// LineRange is a line of a buffer: buf[Start:End], without its '\n'.
+type LineRange struct {
+	Start, End int
+}
+
+// MatchLines appends to dst the ranges of the lines of buf that match the
+// expression and returns the extended slice. Lines end at '\n', which is
+// not part of the range; a '\r' before it is. A last line without a '\n'
+// counts if it is not empty. Each line is matched as its own haystack, so
+// anchored patterns refer to the line's edges.
+//
+// As in MatchColumn, the buffer is scanned in blocks of whole lines of about
+// columnBlockBytes with one engine call per block, and only blocks with a
+// hit are split into lines and matched one by one. Lines of blocks without
+// a hit are only visited if the expression holds without any pattern, or
+// to check anchored and glob patterns. When most blocks have a hit, the
+// block scan is skipped for a run of blocks (see blockHitRate). Whole-word
+// patterns whose boundary set lacks '\n' skip the block scan.
+func (bs *BooleanSearch) MatchLines(buf []byte, dst []LineRange) []LineRange {
+	// Result of a line without any pattern
+	var empty bool
+	var set []uint64
+	if bs.banks != nil {
+		set = make([]uint64, len(bs.banks))
+		empty = bs.expr.evaluateSet(set, true) == TRUE
+	} else {
+		empty = bs.expr.Evaluate(0, true) == TRUE
+	}
+
+	prefilter := bs.linePrefilter()
+	anchors := bs.numScanned < bs.numPatterns
+	var rate blockHitRate
+	for start := 0; start < len(buf); {
+		// Extend the block to the end of the line that crosses
+		// columnBlockBytes
+		end := len(buf)
+		if start+columnBlockBytes < len(buf) {
+			if i := bytes.IndexByte(buf[start+columnBlockBytes:], '\n'); i >= 0 {
+				end = start + columnBlockBytes + i + 1
+			}
+		}
+
+		scan := bs.numScanned > 0
+		if scan && prefilter && rate.scan() {
+			scan = bs.anyPattern(bytesToString(buf[start:end]), set)
+			rate.record(scan)
+		}
+		if scan || empty || anchors {
+			for s := start; s < end; {
+				e := end
+				if i := bytes.IndexByte(buf[s:end], '\n'); i >= 0 {
+					e = s + i
+				}
+				v := empty
+				if scan || anchors {
+					v = bs.matchRow(bytesToString(buf[s:e]), set, scan)
+				}
+				if v {
+					dst = append(dst, LineRange{Start: s, End: e})
+				}
+				s = e + 1
+			}
+		}
+		start = end
+	}
+	return dst
+}
+
+// linePrefilter reports whether blocks of whole lines can be scanned at
+// once: a whole word in a line stays one in the block if '\n' is a
+// boundary of its pattern.
+func (bs *BooleanSearch) linePrefilter() bool {
+	for _, p := range bs.scanned() {
+		if p.Boundary != nil && !p.Boundary.Contains('\n') {
+			return false
+		}
+	}
+	return true
+}
@@ -0,0 +1,551 @@
+package ascii
+
+import (
+	"encoding/binary"
+	"errors"
+	"unsafe"
+)
+
+// Serialized BooleanSearch layout (little-endian, uint64 arrays aligned to 8
+// bytes from the start of the blob):
+//
+//	header   magic, version, flags, pattern count, min length, immediate masks
+//	patterns per pattern: text length, flags (case, whole word, anchor, glob),
+//	         boundary set of whole-word patterns, text, uppercase text
+//	expr     prefix-encoded tree: kind byte, pattern ID and case flag for
+//	         Contains, value for constants
+//	tbl      masksLo, masksHi
+//	fdr      domain, stride, stateTable, coarseLo/Hi, groupMasks, groupLUT
+//	verify   values, masks, lengths, tails
+//	flood    per byte value: min length, pattern IDs
+//	banks    bank count, bankTable, immediate sets, per bank: stateTable,
+//	         verify tables, pattern mask
+//
+// LoadBooleanSearch points the hash tables and pattern strings into the blob
+// instead of copying them; the fixed-size tables are copied, which is a
+// memcpy rather than the table construction MakeBooleanSearch does. The
+// verify tables are rebuilt from the patterns and compared with the loaded
+// ones (see validTables), and the small per-bank FDR prefilter tables are
+// rebuilt (see buildBankSearches).
+
+const (
+	boolSearchMagic   = "VELOZBS\x00"
+	boolSearchVersion = 2
+)
+
+const (
+	exprContains byte = iota
+	exprAnd
+	exprOr
+	exprNot
+	exprConst
+)
+
+// maxExprDepth bounds the nesting of serialized expressions, so that
+// decoding an untrusted blob cannot recurse without limit. Left-deep chains
+// over the largest rule sets, with a Not on each term, stay within it.
+const maxExprDepth = 4 * maxPatterns
+
+var errBadBooleanSearch = errors.New("ascii: malformed serialized BooleanSearch")
+
+// MarshalBinary serializes the compiled search, including its hash tables,
+// for LoadBooleanSearch.
+func (bs *BooleanSearch) MarshalBinary() ([]byte, error) {
+	var w blobWriter
+	w.bytes([]byte(boolSearchMagic))
+	w.u32(boolSearchVersion)
+	var flags uint32
+	if bs.useFDR {
+		flags |= 1
+	}
+	w.u32(flags)
+	w.u32(uint32(bs.numPatterns))
+	w.u32(uint32(bs.minPatternLen))
+	w.u64(bs.immediateTrueMask)
+	w.u64(bs.immediateFalseMask)
+
+	for _, p := range bs.patterns {
+		w.u32(uint32(len(p.Text)))
+		var flags uint8
+		if p.CaseSensitive {
+			flags |= 1
+		}
+		if p.Boundary != nil {
+			flags |= 2
+		}
+		flags |= uint8(p.Anchor) << 2
+		if p.Glob {
+			flags |= 32
+		}
+		w.u8(flags)
+		if p.Boundary != nil {
+			for _, x := range p.Boundary.bitset {
+				w.u64(x)
+			}
+		}
+		w.bytes([]byte(p.Text))
+		w.bytes([]byte(p.normText))
+	}
+	if err := w.expr(bs.expr, 0); err != nil {
+		return nil, err
+	}
+
+	w.bytes(bs.tbl.masksLo[:])
+	w.bytes(bs.tbl.masksHi[:])
+
+	w.u32(uint32(bs.fdr.domain))
+	w.u32(uint32(bs.fdr.stride))
+	w.u64s(bs.fdr.stateTable)
+	w.bytes(bs.fdr.coarseLo[:])
+	w.bytes(bs.fdr.coarseHi[:])
+	w.u64s(bs.fdr.groupMasks[:])
+	w.u64s(bs.fdr.groupLUT[:])
+	w.verify(&bs.verify)
+
+	for c := range bs.flood {
+		e := &bs.flood[c]
+		w.u16(e.minLength)
+		w.u16(uint16(len(e.patternIDs)))
+		w.bytes(e.patternIDs)
+	}
+
+	w.u32(uint32(len(bs.banks)))
+	if bs.banks != nil {
+		w.u64s(bs.bankTable)
+		w.u64s(bs.immediateTrueSet)
+		w.u64s(bs.immediateFalseSet)
+		for i := range bs.banks {
+			bank := &bs.banks[i]
+			w.u64s(bank.stateTable)
+			w.verify(&bank.verify)
+			w.u64(bank.all)
+		}
+	}
+	return w.b, nil
+}
+
+// LoadBooleanSearch returns the search serialized by MarshalBinary. The hash
+// tables and pattern strings of the result point into data, so data must not
+// be modified while the search is in use; an mmapped file works well. Tables
+// are copied instead when data is not 8-byte aligned or the host is
+// big-endian.
+func LoadBooleanSearch(data []byte) (*BooleanSearch, error) {
+	r := blobReader{b: data}
+	if string(r.take(len(boolSearchMagic))) != boolSearchMagic || r.u32() != boolSearchVersion {
+		return nil, errBadBooleanSearch
+	}
+
+	bs := &BooleanSearch{}
+	flags := r.u32()
+	bs.useFDR = flags&1 != 0
+	bs.numPatterns = int(r.u32())
+	bs.minPatternLen = int(r.u32())
+	bs.immediateTrueMask = r.u64()
+	bs.immediateFalseMask = r.u64()
+	if r.err != nil || bs.numPatterns > maxPatterns {
+		return nil, errBadBooleanSearch
+	}
+
+	bs.patterns = make([]Pattern, bs.numPatterns)
+	for i := range bs.patterns {
+		n := int(r.u32())
+		if n > maxPatternLen {
+			return nil, errBadBooleanSearch
+		}
+		flags := r.u8()
+		// Glob patterns are never whole-word or anchored
+		if Anchor(flags>>2&7) > AnchorLineEnd || flags >= 64 || flags&32 != 0 && flags&(2|7<<2) != 0 {
+			return nil, errBadBooleanSearch
+		}
+		var boundary *CharSet
+		if flags&2 != 0 {
+			boundary = new(CharSet)
+			for j := range boundary.bitset {
+				boundary.bitset[j] = r.u64()
+			}
+		}
+		text := r.str(n)
+		bs.patterns[i] = Pattern{ID: uint16(i), Text: text, Length: n, CaseSensitive: flags&1 != 0, Boundary: boundary, Anchor: Anchor(flags >> 2 & 7), Glob: flags&32 != 0, normText: r.str(n)}
+
+		// Anchored and glob patterns come after the scanned ones
+		if bs.patterns[i].Anchor == Unanchored && !bs.patterns[i].Glob {
+			if bs.numScanned != i {
+				return nil, errBadBooleanSearch
+			}
+			bs.numScanned++
+		}
+	}
+	// The engines scan up to len(haystack)-minPatternLen
+	if bs.minPatternLen != bs.scannedMinLength() {
+		return nil, errBadBooleanSearch
+	}
+	bs.expr = r.expr(bs.patterns, 0)
+	bs.buildSearchers()
+
+	copy(bs.tbl.masksLo[:], r.take(16))
+	copy(bs.tbl.masksHi[:], r.take(16))
+
+	bs.fdr.domain = int(r.u32())
+	bs.fdr.stride = int(r.u32())
+	if bs.fdr.domain > 16 {
+		return nil, errBadBooleanSearch
+	}
+	bs.fdr.domainMask = uint32(1)<<bs.fdr.domain - 1
+	bs.fdr.stateTable = r.u64s()
+	copy(bs.fdr.coarseLo[:], r.take(16))
+	copy(bs.fdr.coarseHi[:], r.take(16))
+	r.u64sInto(bs.fdr.groupMasks[:])
+	r.u64sInto(bs.fdr.groupLUT[:])
+	r.verify(&bs.verify)
+
+	// Flood entries name scanned patterns, with the shortest one's length
+	for c := range bs.flood {
+		e := &bs.flood[c]
+		e.minLength = r.u16()
+		var minLength uint16
+		if ids := r.take(int(r.u16())); len(ids) > 0 {
+			e.patternIDs = ids[:len(ids):len(ids)]
+			for _, id := range ids {
+				if int(id) >= bs.numScanned {
+					r.err = errBadBooleanSearch
+					break
+				}
+				if n := uint16(bs.patterns[id].Length); minLength == 0 || n < minLength {
+					minLength = n
+				}
+			}
+		}
+		if e.minLength != minLength {
+			r.err = errBadBooleanSearch
+		}
+	}
+
+	if numBanks := int(r.u32()); numBanks > 0 {
+		if numBanks != (bs.numPatterns+63)/64 {
+			return nil, errBadBooleanSearch
+		}
+		bs.bankTable = r.u64s()
+		bs.immediateTrueSet = r.u64s()
+		bs.immediateFalseSet = r.u64s()
+		bs.banks = make([]patternBank, numBanks)
+		for i := range bs.banks {
+			bank := &bs.banks[i]
+			bank.stateTable = r.u64s()
+			r.verify(&bank.verify)
+			bank.all = r.u64()
+			if len(bank.stateTable) != 1<<bs.fdr.domain {
+				r.err = errBadBooleanSearch
+			}
+		}
+		if len(bs.bankTable) != 1<<bs.fdr.domain || len(bs.immediateTrueSet) != numBanks || len(bs.immediateFalseSet) != numBanks {
+			r.err = errBadBooleanSearch
+		}
+	} else if bs.numPatterns > 64 || (bs.useFDR && len(bs.fdr.stateTable) != 1<<bs.fdr.domain) {
+		r.err = errBadBooleanSearch
+	}
+	if r.err != nil || r.off != len(data) {
+		return nil, errBadBooleanSearch
+	}
+
+	if !bs.validTables() || !bs.validImmediate() {
+		return nil, errBadBooleanSearch
+	}
+	if bs.banks != nil {
+		bs.buildBankSearches()
+	}
+	return bs, nil
+}
+
+// validTables checks the loaded tables against the patterns. The verify
+// tables must be the ones the patterns build; they are replaced by those,
+// which also point the verifiers at the pattern text and boundary sets. The
+// hash and nibble tables must not report slots without a scanned pattern,
+// whose verify entries are empty and would match anywhere.
+func (bs *BooleanSearch) validTables() bool {
+	if bs.banks != nil {
+		var banksAll uint64
+		for b := range bs.banks {
+			bank := &bs.banks[b]
+			n := max(min(bs.numScanned-64*b, 64), 0)
+			all := uint64(1)<<n - 1
+			if bank.all != all || !bank.verify.load(bs.patterns[64*b:64*b+n]) || !tableWithin(bank.stateTable, all) {
+				return false
+			}
+			if all != 0 {
+				banksAll |= 1 << b
+			}
+		}
+		return bs.fdr.stride == 0 && !bs.useFDR && tableWithin(bs.bankTable, banksAll)
+	}
+
+	all := uint64(1)<<bs.numScanned - 1
+	if bs.useFDR != (bs.numScanned > 8) || !bs.verify.load(bs.scanned()) {
+		return false
+	}
+	if !bs.useFDR {
+		// Without scanned patterns the TBL engine is not run, and constant
+		// searches leave its masks zero
+		for i := range bs.tbl.masksLo {
+			if bs.numScanned > 0 && (^(bs.tbl.masksLo[i]|uint8(all)) != 0 || ^(bs.tbl.masksHi[i]|uint8(all)) != 0) {
+				return false
+			}
+		}
+		return bs.fdr.stride == 0
+	}
+	for _, m := range bs.fdr.groupMasks {
+		if m&^all != 0 {
+			return false
+		}
+	}
+	for _, m := range bs.fdr.groupLUT {
+		if m&^all != 0 {
+			return false
+		}
+	}
+	return bs.fdr.stride == 1 && tableWithin(bs.fdr.stateTable, all)
+}
+
+// validImmediate checks the early-termination masks against the ones the
+// expression gives. Wrong ones would stop scans at the first hit of a
+// pattern and take the result from it.
+func (bs *BooleanSearch) validImmediate() bool {
+	if bs.numPatterns == 0 {
+		return bs.immediateTrueMask == 0 && bs.immediateFalseMask == 0
+	}
+	if bs.banks == nil {
+		trueSet, falseSet := bs.patternImmediateSets(1)
+		return bs.immediateTrueMask == trueSet[0] && bs.immediateFalseMask == falseSet[0]
+	}
+	trueSet, falseSet := bs.patternImmediateSets(len(bs.banks))
+	for b := range bs.banks {
+		if bs.immediateTrueSet[b] != trueSet[b] || bs.immediateFalseSet[b] != falseSet[b] {
+			return false
+		}
+	}
+	return bs.immediateTrueMask == 0 && bs.immediateFalseMask == 0
+}
+
+// load replaces the verify tables by the ones patterns build, in slots 0 to
+// len(patterns)-1, and reports whether the loaded values, masks, lengths and
+// tails were exactly those.
+func (vt *verifyTables) load(patterns []Pattern) bool {
+	var want verifyTables
+	for i, p := range patterns {
+		want.add(uint8(i), p)
+	}
+	ok := want.values == vt.values && want.masks == vt.masks && want.lengths == vt.lengths && want.tails == vt.tails
+	*vt = want
+	return ok
+}
+
+// tableWithin reports whether every entry of an inverted state table clears
+// only bits in all.
+func tableWithin(table []uint64, all uint64) bool {
+	for _, e := range table {
+		if e|all != ^uint64(0) {
+			return false
+		}
+	}
+	return true
+}
+
+// blobWriter appends the little-endian serialized form of a BooleanSearch.
+type blobWriter struct {
+	b []byte
+}
+
+func (w *blobWriter) bytes(b []byte) { w.b = append(w.b, b...) }
+func (w *blobWriter) u8(v uint8)     { w.b = append(w.b, v) }
+func (w *blobWriter) u16(v uint16)   { w.b = binary.LittleEndian.AppendUint16(w.b, v) }
+func (w *blobWriter) u32(v uint32)   { w.b = binary.LittleEndian.AppendUint32(w.b, v) }
+func (w *blobWriter) u64(v uint64)   { w.b = binary.LittleEndian.AppendUint64(w.b, v) }
+
+func (w *blobWriter) bool(v bool) {
+	if v {
+		w.u8(1)
+	} else {
+		w.u8(0)
+	}
+}
+
+// u64s writes a length-prefixed uint64 array, padded so that the array
+// starts 8-byte aligned.
+func (w *blobWriter) u64s(v []uint64) {
+	w.u32(uint32(len(v)))
+	for len(w.b)%8 != 0 {
+		w.u8(0)
+	}
+	for _, x := range v {
+		w.u64(x)
+	}
+}
+
+func (w *blobWriter) verify(vt *verifyTables) {
+	w.u64s(vt.values[:])
+	w.u64s(vt.masks[:])
+	for _, l := range vt.lengths {
+		w.u16(l)
+	}
+	w.u64s(vt.tails[:])
+}
+
+func (w *blobWriter) expr(e BoolExpr, depth int) error {
+	if depth == maxExprDepth {
+		return errors.New("ascii: expression too deep to serialize")
+	}
+	switch e := e.(type) {
+	case *ContainsExpr:
+		w.u8(exprContains)
+		w.u16(e.patternID)
+		w.bool(e.CaseSensitive)
+	case *AndExpr:
+		w.u8(exprAnd)
+		if err := w.expr(e.Left, depth+1); err != nil {
+			return err
+		}
+		return w.expr(e.Right, depth+1)
+	case *OrExpr:
+		w.u8(exprOr)
+		if err := w.expr(e.Left, depth+1); err != nil {
+			return err
+		}
+		return w.expr(e.Right, depth+1)
+	case *NotExpr:
+		w.u8(exprNot)
+		return w.expr(e.Child, depth+1)
+	case *constExpr:
+		w.u8(exprConst)
+		w.bool(e.value == TRUE)
+	default:
+		return errors.New("ascii: cannot serialize expression node")
+	}
+	return nil
+}
+
+// blobReader decodes a serialized BooleanSearch. Reads past the end set err
+// and return zero values, so callers check err once at the end.
+type blobReader struct {
+	b   []byte
+	off int
+	err error
+}
+
+func (r *blobReader) take(n int) []byte {
+	if r.err != nil || n < 0 || n > len(r.b)-r.off {
+		r.err = errBadBooleanSearch
+		return nil
+	}
+	b := r.b[r.off : r.off+n]
+	r.off += n
+	return b
+}
+
+func (r *blobReader) u8() uint8 {
+	if b := r.take(1); b != nil {
+		return b[0]
+	}
+	return 0
+}
+
+func (r *blobReader) u16() uint16 {
+	if b := r.take(2); b != nil {
+		return binary.LittleEndian.Uint16(b)
+	}
+	return 0
+}
+
+func (r *blobReader) u32() uint32 {
+	if b := r.take(4); b != nil {
+		return binary.LittleEndian.Uint32(b)
+	}
+	return 0
+}
+
+func (r *blobReader) u64() uint64 {
+	if b := r.take(8); b != nil {
+		return binary.LittleEndian.Uint64(b)
+	}
+	return 0
+}
+
+// str returns the next n bytes as a string sharing the blob's memory.
+func (r *blobReader) str(n int) string {
+	return bytesToString(r.take(n))
+}
+
+// u64s returns the next length-prefixed uint64 array. It aliases the blob
+// when the host layout allows, and is a copy otherwise.
+func (r *blobReader) u64s() []uint64 {
+	n := int(r.u32())
+	if r.err != nil || n > len(r.b) {
+		r.err = errBadBooleanSearch
+		return nil
+	}
+	r.take(-r.off & 7)
+	b := r.take(8 * n)
+	if r.err != nil || n == 0 {
+		return nil
+	}
+	if littleEndian && uintptr(unsafe.Pointer(&b[0]))%8 == 0 {
+		return unsafe.Slice((*uint64)(unsafe.Pointer(&b[0])), n)
+	}
+	v := make([]uint64, n)
+	for i := range v {
+		v[i] = binary.LittleEndian.Uint64(b[8*i:])
+	}
+	return v
+}
+
+// u64sInto reads a length-prefixed uint64 array of exactly len(dst) entries.
+func (r *blobReader) u64sInto(dst []uint64) {
+	if v := r.u64s(); len(v) == len(dst) {
+		copy(dst, v)
+	} else {
+		r.err = errBadBooleanSearch
+	}
+}
+
+func (r *blobReader) verify(vt *verifyTables) {
+	r.u64sInto(vt.values[:])
+	r.u64sInto(vt.masks[:])
+	for i := range vt.lengths {
+		vt.lengths[i] = r.u16()
+	}
+	r.u64sInto(vt.tails[:])
+}
+
+func (r *blobReader) expr(patterns []Pattern, depth int) BoolExpr {
+	if r.err != nil || depth == maxExprDepth {
+		r.err = errBadBooleanSearch
+		return nil
+	}
+	switch r.u8() {
+	case exprContains:
+		id := r.u16()
+		cs := r.u8() != 0
+		if r.err != nil || int(id) >= len(patterns) {
+			r.err = errBadBooleanSearch
+			return nil
+		}
+		return &ContainsExpr{Pattern: patterns[id].Text, CaseSensitive: cs, Boundary: patterns[id].Boundary, Anchor: patterns[id].Anchor, Glob: patterns[id].Glob, patternID: id}
+	case exprAnd:
+		l := r.expr(patterns, depth+1)
+		return And(l, r.expr(patterns, depth+1))
+	case exprOr:
+		l := r.expr(patterns, depth+1)
+		return Or(l, r.expr(patterns, depth+1))
+	case exprNot:
+		return Not(r.expr(patterns, depth+1))
+	case exprConst:
+		return constOf(r.u8() != 0)
+	}
+	r.err = errBadBooleanSearch
+	return nil
+}
+
+// littleEndian reports whether the host stores integers little-endian, so
+// that serialized tables can be used in place.
+var littleEndian = func() bool {
+	x := uint16(1)
+	return *(*byte)(unsafe.Pointer(&x)) == 1
+}()
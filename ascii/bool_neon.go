@@ -3,7 +3,8 @@
 package ascii
 
 // searchTBL_NEON is the NEON-accelerated TBL engine for 1-8 patterns.
-// Returns the final foundMask after scanning the haystack.
+// Returns the final foundMask after scanning the haystack; if offsets is
+// non-nil, the first offset of each pattern found is stored in it.
 //
 //go:noescape
 func searchTBL_NEON(
@@ -12,18 +13,21 @@ func searchTBL_NEON(
 	masksHi *[16]uint8,
 	verifyValues *[64]uint64,
 	verifyMasks *[64]uint64,
-	verifyLengths *[64]uint8,
+	verifyLengths *[64]uint16,
 	verifyPtrs *[64]string,
+	verifyExact uint64,
 	numPatterns int,
 	minPatternLen int,
 	immediateTrueMask uint64,
 	immediateFalseMask uint64,
 	initialFoundMask uint64,
+	offsets *[64]int,
 ) uint64
 
 // searchFDR_NEON is the NEON-accelerated FDR engine for 9-64 patterns.
 // Uses TBL prefilter for fast path, then FDR hash confirmation.
-// Returns the final foundMask after scanning the haystack.
+// Returns the final foundMask after scanning the haystack; if offsets is
+// non-nil, the first offset of each pattern found is stored in it.
 //
 //go:noescape
 func searchFDR_NEON(
@@ -36,11 +40,72 @@ func searchFDR_NEON(
 	groupLUT *[256]uint64,
 	verifyValues *[64]uint64,
 	verifyMasks *[64]uint64,
-	verifyLengths *[64]uint8,
+	verifyLengths *[64]uint16,
 	verifyPtrs *[64]string,
+	verifyExact uint64,
 	numPatterns int,
 	minPatternLen int,
 	immediateTrueMask uint64,
 	immediateFalseMask uint64,
 	initialFoundMask uint64,
+	offsets *[64]int,
 ) uint64
+
+// searchTBLNEON uses the NEON-accelerated TBL engine.
+// It handles all pattern lengths with long verification.
+func (bs *BooleanSearch) searchTBLNEON(haystack string, foundMask uint64, offsets *[64]int) uint64 {
+	if len(haystack) < 8 || bs.verify.words != 0 {
+		// Fall back to Go for haystacks shorter than a verify load, and for
+		// whole-word patterns, whose boundaries the NEON kernels do not check
+		return bs.searchTBLGo(haystack, foundMask, offsets)
+	}
+	trueMask, falseMask := bs.stopMasks(offsets)
+	return searchTBL_NEON(
+		haystack,
+		&bs.tbl.masksLo,
+		&bs.tbl.masksHi,
+		&bs.verify.values,
+		&bs.verify.masks,
+		&bs.verify.lengths,
+		&bs.verify.ptrs,
+		bs.verify.exact,
+		bs.numPatterns,
+		bs.minPatternLen,
+		trueMask,
+		falseMask,
+		foundMask,
+		offsets,
+	)
+}
+
+// searchFDRNEON uses the NEON-accelerated FDR engine for 9-64 patterns.
+func (bs *BooleanSearch) searchFDRNEON(haystack string, foundMask uint64, offsets *[64]int) uint64 {
+	if len(haystack) < 8 || bs.verify.words != 0 {
+		// Fall back to Go for haystacks shorter than a verify load, and for
+		// whole-word patterns, whose boundaries the NEON kernels do not check
+		return bs.searchFDRGo(haystack, foundMask, offsets)
+	}
+
+	// Use NEON implementation with TBL prefilter + FDR confirmation
+	trueMask, falseMask := bs.stopMasks(offsets)
+	return searchFDR_NEON(
+		haystack,
+		&bs.fdr.stateTable[0],
+		bs.fdr.domainMask,
+		bs.fdr.stride,
+		&bs.fdr.coarseLo,
+		&bs.fdr.coarseHi,
+		&bs.fdr.groupLUT,
+		&bs.verify.values,
+		&bs.verify.masks,
+		&bs.verify.lengths,
+		&bs.verify.ptrs,
+		bs.verify.exact,
+		bs.numPatterns,
+		bs.minPatternLen,
+		trueMask,
+		falseMask,
+		foundMask,
+		offsets,
+	)
+}
@@ -14,14 +14,16 @@
 //     masksHi *[16]uint8,        // +24(FP)
 //     verifyValues *[64]uint64,  // +32(FP)
 //     verifyMasks *[64]uint64,   // +40(FP)
-//     verifyLengths *[64]uint8,  // +48(FP)
-//     verifyPtrs *[64]string,    // +56(FP) (unused, for long patterns)
-//     numPatterns int,           // +64(FP)
-//     minPatternLen int,         // +72(FP)
-//     immediateTrueMask uint64,  // +80(FP)
-//     immediateFalseMask uint64, // +88(FP)
-//     initialFoundMask uint64,   // +96(FP)
-// ) uint64                       // +104(FP) return value
+//     verifyLengths *[64]uint16, // +48(FP)
+//     verifyPtrs *[64]string,    // +56(FP) (for long patterns)
+//     verifyExact uint64,        // +64(FP) patterns compared exactly, without case folding
+//     numPatterns int,           // +72(FP)
+//     minPatternLen int,         // +80(FP)
+//     immediateTrueMask uint64,  // +88(FP)
+//     immediateFalseMask uint64, // +96(FP)
+//     initialFoundMask uint64,   // +104(FP)
+//     offsets *[64]int,          // +112(FP) - first offset per pattern, or nil
+// ) uint64                       // +120(FP) return value
 //
 // Register allocation:
 // R0  = haystack ptr
@@ -42,7 +44,7 @@
 // R15 = temp
 // R16, R17, R19-R27 = temp (avoid R18 - platform register)
 
-TEXT ·searchTBL_NEON(SB), NOSPLIT, $0-112
+TEXT ·searchTBL_NEON(SB), NOSPLIT, $0-128
 	MOVD  haystack+0(FP), R0
 	MOVD  haystack_len+8(FP), R1
 	MOVD  masksLo+16(FP), R2
@@ -50,11 +52,11 @@ TEXT ·searchTBL_NEON(SB), NOSPLIT, $0-112
 	MOVD  verifyValues+32(FP), R4
 	MOVD  verifyMasks+40(FP), R5
 	MOVD  verifyLengths+48(FP), R6
-	MOVD  numPatterns+64(FP), R7
-	MOVD  minPatternLen+72(FP), R8
-	MOVD  immediateTrueMask+80(FP), R9
-	MOVD  immediateFalseMask+88(FP), R10
-	MOVD  initialFoundMask+96(FP), R11
+	MOVD  numPatterns+72(FP), R7
+	MOVD  minPatternLen+80(FP), R8
+	MOVD  immediateTrueMask+88(FP), R9
+	MOVD  immediateFalseMask+96(FP), R10
+	MOVD  initialFoundMask+104(FP), R11
 
 	// Calculate searchLen = len - minPatternLen
 	SUBS  R8, R1, R12
@@ -149,16 +151,21 @@ verify_lo:
 	CLZ   R24, R24                    // R24 = pattern ID (0-7)
 
 	// Check pattern length vs remaining haystack
-	ADD   R6, R24, R25
-	MOVBU (R25), R25                  // R25 = pattern length
+	ADD   R24<<1, R6, R25
+	MOVHU (R25), R25                  // R25 = pattern length
 	ADD   R21, R25, R26
 	CMP   R1, R26
 	BGT   clear_lo_bit
 
-	// Load 8 bytes from haystack at position
+	// Load 8 bytes from haystack at position, without reading past the end
+	ADD   $8, R21, R26
+	CMP   R1, R26
+	BGT   lo_load_near_end
 	ADD   R0, R21, R26
 	MOVD  (R26), R26                  // R26 = haystack bytes
 
+lo_loaded:
+
 	// Load verify value and mask
 	LSL   $3, R24, R27                // offset = pid * 8
 	ADD   R4, R27, R15
@@ -179,6 +186,11 @@ verify_lo:
 	MOVD  $1, R26
 	LSL   R24, R26, R26
 	ORR   R26, R11, R11               // foundMask |= (1 << pid)
+	MOVD  offsets+112(FP), R26
+	CBZ   R26, tbl_rec_skip_0
+	ADD   R24<<3, R26, R26
+	MOVD  R21, (R26)
+tbl_rec_skip_0:
 
 	// Check immediate termination
 	TST   R9, R11
@@ -202,7 +214,7 @@ verify_lo_long:
 	MOVD  verifyPtrs+56(FP), R26      // R26 = verifyPtrs base
 	LSL   $4, R24, R27                // offset = pid * 16
 	ADD   R26, R27, R26               // R26 = &verifyPtrs[pid]
-	MOVD  (R26), R26                  // R26 = pattern string ptr (already uppercase normalized)
+	MOVD  (R26), R26                  // R26 = pattern string ptr
 
 	// Setup comparison loop
 	// Use end pointer instead of counter to avoid R27 (REGTMP) clobbering
@@ -222,8 +234,8 @@ verify_lo_long_loop:
 	MOVBU (R15), R22                  // haystack byte
 	MOVBU (R26), R27                  // pattern byte (REGTMP, but used immediately)
 
-	// Case-insensitive comparison
-	// Pattern is already uppercase. Haystack byte needs case-folding.
+	// Case-insensitive comparison: the pattern is uppercase unless it is
+	// in verifyExact. Haystack byte needs case-folding.
 	CMPW  R27, R22
 	BEQ   verify_lo_long_next
 
@@ -240,6 +252,11 @@ verify_lo_long_loop:
 	CMPW  R27, R22
 	BNE   clear_lo_bit                // Mismatch
 
+	// Equal only up to case: a mismatch for case-sensitive patterns
+	MOVD  verifyExact+64(FP), R22
+	LSR   R24, R22, R22
+	TBNZ  $0, R22, clear_lo_bit
+
 verify_lo_long_next:
 	ADD   $1, R15, R15
 	ADD   $1, R26, R26
@@ -251,6 +268,11 @@ lo_match_success:
 	MOVD  $1, R26
 	LSL   R24, R26, R26
 	ORR   R26, R11, R11               // foundMask |= (1 << pid)
+	MOVD  offsets+112(FP), R26
+	CBZ   R26, tbl_rec_skip_1
+	ADD   R24<<3, R26, R26
+	MOVD  R21, (R26)
+tbl_rec_skip_1:
 
 	// Check immediate termination
 	TST   R9, R11
@@ -306,15 +328,19 @@ verify_hi:
 	RBIT  R23, R24
 	CLZ   R24, R24
 
-	ADD   R6, R24, R25
-	MOVBU (R25), R25
+	ADD   R24<<1, R6, R25
+	MOVHU (R25), R25
 	ADD   R21, R25, R26
 	CMP   R1, R26
 	BGT   clear_hi_bit
 
+	ADD   $8, R21, R26
+	CMP   R1, R26
+	BGT   hi_load_near_end
 	ADD   R0, R21, R26
 	MOVD  (R26), R26
 
+hi_loaded:
 	LSL   $3, R24, R27
 	ADD   R4, R27, R15
 	MOVD  (R15), R15
@@ -331,6 +357,11 @@ verify_hi:
 	MOVD  $1, R26
 	LSL   R24, R26, R26
 	ORR   R26, R11, R11
+	MOVD  offsets+112(FP), R26
+	CBZ   R26, tbl_rec_skip_2
+	ADD   R24<<3, R26, R26
+	MOVD  R21, (R26)
+tbl_rec_skip_2:
 
 	TST   R9, R11
 	BNE   done
@@ -379,6 +410,10 @@ verify_hi_long_loop:
 	CMPW  R27, R22
 	BNE   clear_hi_bit
 
+	MOVD  verifyExact+64(FP), R22
+	LSR   R24, R22, R22
+	TBNZ  $0, R22, clear_hi_bit
+
 verify_hi_long_next:
 	ADD   $1, R15, R15
 	ADD   $1, R26, R26
@@ -388,6 +423,11 @@ hi_match_success:
 	MOVD  $1, R26
 	LSL   R24, R26, R26
 	ORR   R26, R11, R11
+	MOVD  offsets+112(FP), R26
+	CBZ   R26, tbl_rec_skip_3
+	ADD   R24<<3, R26, R26
+	MOVD  R21, (R26)
+tbl_rec_skip_3:
 
 	TST   R9, R11
 	BNE   done
@@ -454,16 +494,21 @@ verify_scalar:
 	CLZ   R19, R19                    // R19 = pattern ID
 
 	// Bounds check
-	ADD   R6, R19, R20
-	MOVBU (R20), R20                  // pattern length
+	ADD   R19<<1, R6, R20
+	MOVHU (R20), R20                  // pattern length
 	ADD   R21, R20, R22
 	CMP   R1, R22
 	BGT   clear_scalar_bit
 
 	// Load and verify
+	ADD   $8, R21, R22
+	CMP   R1, R22
+	BGT   scalar_load_near_end
 	ADD   R0, R21, R22
 	MOVD  (R22), R22                  // haystack bytes
 
+scalar_loaded:
+
 	LSL   $3, R19, R23
 	ADD   R4, R23, R24
 	MOVD  (R24), R24                  // expected
@@ -481,6 +526,11 @@ verify_scalar:
 	MOVD  $1, R22
 	LSL   R19, R22, R22
 	ORR   R22, R11, R11
+	MOVD  offsets+112(FP), R22
+	CBZ   R22, tbl_rec_skip_4
+	ADD   R19<<3, R22, R22
+	MOVD  R21, (R22)
+tbl_rec_skip_4:
 
 	TST   R9, R11
 	BNE   done
@@ -524,6 +574,10 @@ verify_scalar_long_loop:
 	CMPW  R25, R24
 	BNE   clear_scalar_bit
 
+	MOVD  verifyExact+64(FP), R24
+	LSR   R19, R24, R24
+	TBNZ  $0, R24, clear_scalar_bit
+
 verify_scalar_long_next:
 	ADD   $1, R15, R15
 	ADD   $1, R22, R22
@@ -534,6 +588,11 @@ scalar_match_success:
 	MOVD  $1, R22
 	LSL   R19, R22, R22
 	ORR   R22, R11, R11
+	MOVD  offsets+112(FP), R22
+	CBZ   R22, tbl_rec_skip_5
+	ADD   R19<<3, R22, R22
+	MOVD  R21, (R22)
+tbl_rec_skip_5:
 
 	TST   R9, R11
 	BNE   done
@@ -557,5 +616,34 @@ scalar_next:
 	CBNZ  R16, scalar_loop
 
 done:
-	MOVD  R11, ret+104(FP)
+	MOVD  R11, ret+120(FP)
 	RET
+
+// ============================================================================
+// NEAR-END LOADS: fewer than 8 bytes left at the position. Load the final 8
+// bytes and shift the ones at the position down (the caller guarantees a
+// haystack of at least 8 bytes); the pattern masks ignore the zero fill.
+// ============================================================================
+lo_load_near_end:
+	SUB   R1, R26, R26                // R26 = bytes past the end
+	LSL   $3, R26, R26
+	ADD   R0, R1, R15
+	MOVD  -8(R15), R15
+	LSR   R26, R15, R26
+	B     lo_loaded
+
+hi_load_near_end:
+	SUB   R1, R26, R26
+	LSL   $3, R26, R26
+	ADD   R0, R1, R15
+	MOVD  -8(R15), R15
+	LSR   R26, R15, R26
+	B     hi_loaded
+
+scalar_load_near_end:
+	SUB   R1, R22, R22
+	LSL   $3, R22, R22
+	ADD   R0, R1, R23
+	MOVD  -8(R23), R23
+	LSR   R22, R23, R22
+	B     scalar_loaded
@@ -0,0 +1,250 @@
+package ascii
+
+import "strings"
+
+// =============================================================================
+// Expression Optimization
+// =============================================================================
+
+// constExpr is an expression whose value does not depend on the haystack. It
+// only appears in compiled searches, as the result of constant folding.
+type constExpr struct {
+	value Result // TRUE or FALSE
+}
+
+var (
+	constTrue  = &constExpr{value: TRUE}
+	constFalse = &constExpr{value: FALSE}
+)
+
+func (e *constExpr) Evaluate(foundMask uint64, final bool) Result  { return e.value }
+func (e *constExpr) evaluateSet(found []uint64, final bool) Result { return e.value }
+func (e *constExpr) collectPatterns(patterns *[]Pattern)           {}
+
+// optimizeExpr returns an equivalent expression that needs fewer patterns:
+//
+//   - nested And/Or nodes are flattened so that all operands of a chain can
+//     be compared with each other,
+//   - Contains("") and double negations are folded, as are constants,
+//   - duplicate and subsumed patterns are dropped: a pattern that contains
+//     another implies it, so Or("err", "error") needs only "err" and
+//     And("err", "error") only "error"; a whole-word pattern implies the
+//     plain one, but is only implied by the same whole word; likewise an
+//     anchored pattern is only implied by one with the same anchor, and a
+//     glob pattern only by itself,
+//   - contradictions and tautologies such as And("error", Not("err")) fold
+//     to constants.
+//
+// Contains nodes of expr are reused; And, Or and Not nodes are rebuilt.
+func optimizeExpr(expr BoolExpr) BoolExpr {
+	switch e := expr.(type) {
+	case *ContainsExpr:
+		if e.Pattern == "" {
+			return constTrue
+		}
+		return e
+	case *NotExpr:
+		switch c := optimizeExpr(e.Child).(type) {
+		case *constExpr:
+			return constOf(c.value != TRUE)
+		case *NotExpr:
+			return c.Child
+		default:
+			return Not(c)
+		}
+	case *AndExpr:
+		return optimizeChain(expr, true)
+	case *OrExpr:
+		return optimizeChain(expr, false)
+	}
+	return expr
+}
+
+// literal is a Contains operand of a chain, possibly negated.
+type literal struct {
+	c     *ContainsExpr
+	neg   bool
+	cs    bool   // matched case-sensitively: CaseSensitive and has a letter
+	upper string // uppercase pattern
+}
+
+// optimizeChain optimizes the And (isAnd) or Or chain rooted at expr.
+func optimizeChain(expr BoolExpr, isAnd bool) BoolExpr {
+	// The value that decides the chain: FALSE for And, TRUE for Or
+	absorbing := constOf(!isAnd)
+
+	var operands []BoolExpr
+	var lits []literal
+	var drop []int
+	var flatten func(e BoolExpr) bool
+	flatten = func(e BoolExpr) bool {
+		if l, r, ok := chainOperands(e, isAnd); ok {
+			return flatten(l) && flatten(r)
+		}
+
+		o := optimizeExpr(e)
+		if _, _, ok := chainOperands(o, isAnd); ok {
+			// Folding a Not exposed another chain of the same kind
+			return flatten(o)
+		}
+		if c, ok := o.(*constExpr); ok {
+			return c != absorbing
+		}
+
+		x, ok := toLiteral(o)
+		if !ok {
+			operands = append(operands, o)
+			return true
+		}
+		// An Or is handled as the negation of an And of the negated
+		// operands, so that one set of rules covers both
+		x.neg = x.neg != !isAnd
+
+		drop = drop[:0]
+		for i, k := range lits {
+			switch {
+			case x.neg != k.neg:
+				// p and not q is a contradiction if p implies q
+				p, q := x, k
+				if x.neg {
+					p, q = k, x
+				}
+				if p.contains(q) {
+					return false
+				}
+			case k.implies(x):
+				// x adds nothing to the And
+				return true
+			case x.implies(k):
+				drop = append(drop, i)
+			}
+		}
+		kept := lits[:0]
+		for i, k := range lits {
+			if len(drop) > 0 && drop[0] == i {
+				drop = drop[1:]
+				continue
+			}
+			kept = append(kept, k)
+		}
+		lits = append(kept, x)
+		return true
+	}
+	if !flatten(expr) {
+		return absorbing
+	}
+
+	for _, l := range lits {
+		if l.neg == isAnd {
+			operands = append(operands, Not(l.c))
+		} else {
+			operands = append(operands, l.c)
+		}
+	}
+	if len(operands) == 0 {
+		return constOf(isAnd)
+	}
+
+	return buildChain(operands, isAnd)
+}
+
+// buildChain combines operands into a balanced And (isAnd) or Or tree, which
+// keeps evaluation recursion shallow for long chains.
+func buildChain(operands []BoolExpr, isAnd bool) BoolExpr {
+	if len(operands) == 1 {
+		return operands[0]
+	}
+	l, r := buildChain(operands[:len(operands)/2], isAnd), buildChain(operands[len(operands)/2:], isAnd)
+	if isAnd {
+		return And(l, r)
+	}
+	return Or(l, r)
+}
+
+// chainOperands returns the operands of e if it is an And (isAnd) or Or node.
+func chainOperands(e BoolExpr, isAnd bool) (left, right BoolExpr, ok bool) {
+	if isAnd {
+		if a, ok := e.(*AndExpr); ok {
+			return a.Left, a.Right, true
+		}
+	} else if o, ok := e.(*OrExpr); ok {
+		return o.Left, o.Right, true
+	}
+	return nil, nil, false
+}
+
+// toLiteral returns e as a literal if it is a Contains or a negated Contains.
+func toLiteral(e BoolExpr) (literal, bool) {
+	neg := false
+	if n, ok := e.(*NotExpr); ok {
+		e, neg = n.Child, true
+	}
+	c, ok := e.(*ContainsExpr)
+	if !ok {
+		return literal{}, false
+	}
+	return literal{c: c, neg: neg, cs: c.CaseSensitive && hasAlpha(c.Pattern), upper: toUpperString(c.Pattern)}, true
+}
+
+// implies reports whether l being true guarantees that m is true. Both must
+// have the same sign.
+func (l literal) implies(m literal) bool {
+	if l.neg {
+		// Absence of l's pattern implies absence of m's if m contains l
+		return m.contains(l)
+	}
+	return l.contains(m)
+}
+
+// contains reports whether a haystack containing l's pattern must also
+// contain m's.
+func (l literal) contains(m literal) bool {
+	if len(m.upper) > len(l.upper) {
+		return false
+	}
+	if l.c.Glob || m.c.Glob {
+		// Glob and plain text only compare as the same glob
+		return l.c.Glob && m.c.Glob && (l.upper == m.upper && !m.cs || l.cs && l.c.Pattern == m.c.Pattern)
+	}
+	if m.c.Boundary != nil {
+		// A whole word is only implied by the same whole word
+		if l.c.Boundary == nil || *l.c.Boundary != *m.c.Boundary || len(l.upper) != len(m.upper) {
+			return false
+		}
+	}
+	contains := strings.Contains
+	switch m.c.Anchor {
+	case Unanchored:
+	case l.c.Anchor:
+		// The same anchor, extended away from it
+		if m.c.Anchor == AnchorStart || m.c.Anchor == AnchorLineStart {
+			contains = strings.HasPrefix
+		} else {
+			contains = strings.HasSuffix
+		}
+	default:
+		return false
+	}
+	if m.cs {
+		// Only a case-sensitive match pins down the case of the haystack
+		return l.cs && contains(l.c.Pattern, m.c.Pattern)
+	}
+	return contains(l.upper, m.upper)
+}
+
+func constOf(v bool) *constExpr {
+	if v {
+		return constTrue
+	}
+	return constFalse
+}
+
+// hasAlpha reports whether s contains an ASCII letter.
+func hasAlpha(s string) bool {
+	for i := 0; i < len(s); i++ {
+		if isAlpha(s[i]) {
+			return true
+		}
+	}
+	return false
+}
@@ -25,6 +25,10 @@ type BoolExpr interface {
 	// If final is false, patterns not in foundMask are UNKNOWN.
 	Evaluate(foundMask uint64, final bool) Result
 
+	// evaluateSet is Evaluate over a found set of any width: bit id%64 of
+	// found[id/64] is set if pattern id was found.
+	evaluateSet(found []uint64, final bool) Result
+
 	// collectPatterns collects all patterns in this expression into the slice.
 	collectPatterns(patterns *[]Pattern)
 }
@@ -33,7 +37,10 @@ type BoolExpr interface {
 type ContainsExpr struct {
 	Pattern       string
 	CaseSensitive bool
-	patternID     uint8 // assigned during compilation
+	Boundary      *CharSet // non-nil: whole-word matches only (see WholeWord)
+	Anchor        Anchor   // where the pattern must occur (see PrefixCI)
+	Glob          bool     // Pattern has wildcards (see GlobCI)
+	patternID     uint16   // assigned during compilation
 }
 
 // AndExpr represents logical AND of two expressions.
@@ -70,6 +77,19 @@ func ContainsCS(pattern string) *ContainsExpr {
 	return &ContainsExpr{Pattern: pattern, CaseSensitive: true}
 }
 
+// WholeWord restricts e to whole-word matches: occurrences whose
+// neighbouring bytes are in boundary (usually WordBoundary) or lie past
+// either end of the haystack. It returns e. An empty pattern still matches
+// everywhere. Glob patterns cannot be whole-word: MakeBooleanSearch panics
+// on them.
+//
+// The AVX2 boolean kernels check the boundaries while verifying candidates.
+// On NEON, searches with whole-word patterns run on the Go engines.
+func (e *ContainsExpr) WholeWord(boundary CharSet) *ContainsExpr {
+	e.Boundary = &boundary
+	return e
+}
+
 // And creates an AND expression.
 func And(left, right BoolExpr) *AndExpr {
 	return &AndExpr{Left: left, Right: right}
@@ -99,10 +119,25 @@ func (e *ContainsExpr) Evaluate(foundMask uint64, final bool) Result {
 	return UNKNOWN
 }
 
+func (e *ContainsExpr) evaluateSet(found []uint64, final bool) Result {
+	if bank := int(e.patternID / 64); bank < len(found) && found[bank]&(1<<(e.patternID%64)) != 0 {
+		return TRUE
+	}
+	if final {
+		return FALSE
+	}
+	return UNKNOWN
+}
+
 func (e *AndExpr) Evaluate(foundMask uint64, final bool) Result {
-	l := e.Left.Evaluate(foundMask, final)
-	r := e.Right.Evaluate(foundMask, final)
+	return and3(e.Left.Evaluate(foundMask, final), e.Right.Evaluate(foundMask, final))
+}
+
+func (e *AndExpr) evaluateSet(found []uint64, final bool) Result {
+	return and3(e.Left.evaluateSet(found, final), e.Right.evaluateSet(found, final))
+}
 
+func and3(l, r Result) Result {
 	if l == FALSE || r == FALSE {
 		return FALSE
 	}
@@ -113,9 +148,14 @@ func (e *AndExpr) Evaluate(foundMask uint64, final bool) Result {
 }
 
 func (e *OrExpr) Evaluate(foundMask uint64, final bool) Result {
-	l := e.Left.Evaluate(foundMask, final)
-	r := e.Right.Evaluate(foundMask, final)
+	return or3(e.Left.Evaluate(foundMask, final), e.Right.Evaluate(foundMask, final))
+}
+
+func (e *OrExpr) evaluateSet(found []uint64, final bool) Result {
+	return or3(e.Left.evaluateSet(found, final), e.Right.evaluateSet(found, final))
+}
 
+func or3(l, r Result) Result {
 	if l == TRUE || r == TRUE {
 		return TRUE
 	}
@@ -126,8 +166,14 @@ func (e *OrExpr) Evaluate(foundMask uint64, final bool) Result {
 }
 
 func (e *NotExpr) Evaluate(foundMask uint64, final bool) Result {
-	c := e.Child.Evaluate(foundMask, final)
+	return not3(e.Child.Evaluate(foundMask, final))
+}
 
+func (e *NotExpr) evaluateSet(found []uint64, final bool) Result {
+	return not3(e.Child.evaluateSet(found, final))
+}
+
+func not3(c Result) Result {
 	if c == TRUE {
 		return FALSE
 	}
@@ -142,10 +188,15 @@ func (e *NotExpr) Evaluate(foundMask uint64, final bool) Result {
 // =============================================================================
 
 func (e *ContainsExpr) collectPatterns(patterns *[]Pattern) {
-	*patterns = append(*patterns, Pattern{
-		Text:          e.Pattern,
-		CaseSensitive: e.CaseSensitive,
-	})
+	if e.Glob && (e.Boundary != nil || e.Anchor != Unanchored) {
+		panic("ascii: BooleanSearch glob patterns cannot be whole-word or anchored")
+	}
+	*patterns = append(*patterns, e.pattern())
+}
+
+// pattern returns the pattern e searches for.
+func (e *ContainsExpr) pattern() Pattern {
+	return Pattern{Text: e.Pattern, CaseSensitive: e.CaseSensitive, Boundary: e.Boundary, Anchor: e.Anchor, Glob: e.Glob}
 }
 
 func (e *AndExpr) collectPatterns(patterns *[]Pattern) {
@@ -168,17 +219,21 @@ func (e *NotExpr) collectPatterns(patterns *[]Pattern) {
 
 // Pattern represents a single search pattern with its metadata.
 type Pattern struct {
-	ID            uint8
+	ID            uint16
 	Text          string
 	Length        int
 	CaseSensitive bool
-	normText      string // uppercase-normalized for case-insensitive
+	Boundary      *CharSet // non-nil for whole-word patterns
+	Anchor        Anchor   // anchored and glob patterns have the IDs after the scanned ones
+	Glob          bool
+	normText      string        // uppercase-normalized for case-insensitive
+	glob          *GlobSearcher // for glob patterns
 }
 
 // FloodEntry stores flood detection info for a single byte value.
 type FloodEntry struct {
 	patternIDs []uint8
-	minLength  uint8
+	minLength  uint16
 }
 
 // BooleanSearch is the compiled multi-needle boolean search engine.
@@ -191,7 +246,9 @@ type BooleanSearch struct {
 	// === Patterns ===
 	patterns      []Pattern
 	numPatterns   int
-	minPatternLen int
+	numScanned    int        // patterns found by the engines; anchored ones follow
+	minPatternLen int        // of the scanned patterns
+	lineSearchers []Searcher // per anchored pattern, see anchorsAtNewlines
 
 	// === Engine Selection ===
 	useFDR bool // true for 9-64 patterns
@@ -206,7 +263,7 @@ type BooleanSearch struct {
 	fdr struct {
 		domain     int      // 9-15 bits
 		domainMask uint32   // (1 << domain) - 1
-		stride     int      // 1, 2, or 4
+		stride     int      // positions per hash step (always 1)
 		stateTable []uint64 // 2^domain entries, each is 64-bit pattern mask
 
 		// TBL prefilter: coarse group-based filtering to skip most FDR lookups
@@ -219,15 +276,36 @@ type BooleanSearch struct {
 	}
 
 	// === Verification ===
-	verify struct {
-		values  [64]uint64 // first 8 bytes as uint64, with case-fold applied
-		masks   [64]uint64 // mask: 0 bits where don't-care
-		lengths [64]uint8
-		ptrs    [64]string // full pattern for long verification
-	}
+	verify verifyTables
 
 	// === Flood Detection ===
 	flood [256]FloodEntry
+
+	// === Pattern Banks (65+ patterns) ===
+	// Pattern id lives in banks[id/64] as bank-local pattern id%64. All banks
+	// share one FDR hash, so a single pass over the haystack serves them all.
+	banks             []patternBank
+	bankTable         []uint64 // hash → bank mask (inverted: 0 = bank might match)
+	immediateTrueSet  []uint64 // per-bank immediateTrueMask
+	immediateFalseSet []uint64 // per-bank immediateFalseMask
+}
+
+// verifyTables holds the verification data for up to 64 patterns.
+type verifyTables struct {
+	values  [64]uint64 // first 8 bytes as uint64, with case-fold applied
+	masks   [64]uint64 // mask: 0 bits where don't-care
+	lengths [64]uint16
+	ptrs    [64]string // full pattern for long verification
+	tails   [64]uint64 // last 8 bytes of patterns longer than 8
+
+	// Case-sensitive patterns: ptrs and tails hold their text as is and are
+	// compared exactly; the others hold it uppercase
+	exact uint64
+
+	// Whole-word patterns: the bytes around a match must be in
+	// boundaries[id]; nil for substring patterns
+	boundaries [64]*CharSet
+	words      uint64 // patterns with a boundary set
 }
 
 // =============================================================================
@@ -235,16 +313,27 @@ type BooleanSearch struct {
 // =============================================================================
 
 // MakeBooleanSearch compiles a boolean expression into a search engine.
+// The expression is simplified first (see optimizeExpr), so patterns that
+// cannot change the result are not searched for.
 func MakeBooleanSearch(expr BoolExpr) *BooleanSearch {
 	bs := &BooleanSearch{
-		expr: expr,
+		expr: optimizeExpr(expr),
 	}
 
 	// Extract patterns from expression tree
 	bs.extractPatterns()
+	if bs.numPatterns == 0 {
+		// The expression folded to a constant
+		return bs
+	}
+
+	if bs.numPatterns > 64 {
+		bs.buildBanks()
+		return bs
+	}
 
 	// Select engine based on pattern count
-	bs.useFDR = bs.numPatterns > 8
+	bs.useFDR = bs.numScanned > 8
 
 	// Build search tables
 	if bs.useFDR {
@@ -265,48 +354,102 @@ func (bs *BooleanSearch) extractPatterns() {
 	var patterns []Pattern
 	bs.expr.collectPatterns(&patterns)
 
-	// Deduplicate patterns by text (case-normalized)
-	seen := make(map[string]uint8)
+	// Deduplicate patterns by text and case sensitivity
+	seen := make(map[patternKey]uint16)
 	unique := make([]Pattern, 0, len(patterns))
 
 	for _, p := range patterns {
 		norm := toUpperString(p.Text)
-		if id, ok := seen[norm]; ok {
+		key := makePatternKey(p)
+		if id, ok := seen[key]; ok {
 			// Pattern already exists, reuse ID
 			p.ID = id
 		} else {
-			p.ID = uint8(len(unique))
+			if len(unique) == maxPatterns {
+				panic("ascii: BooleanSearch supports at most 4096 distinct patterns")
+			}
+			if len(p.Text) > maxPatternLen {
+				panic("ascii: BooleanSearch patterns must be at most 65535 bytes")
+			}
+			p.ID = uint16(len(unique))
 			p.Length = len(p.Text)
 			p.normText = norm
-			seen[norm] = p.ID
+			seen[key] = p.ID
 			unique = append(unique, p)
 		}
 	}
 
-	bs.patterns = unique
-	bs.numPatterns = len(unique)
-
-	// Calculate minimum pattern length
-	bs.minPatternLen = 255
+	// Anchored patterns are checked at fixed positions and glob patterns by
+	// their own searchers rather than by the engines, so they take the IDs
+	// after the scanned ones
+	scanned := make([]Pattern, 0, len(unique))
+	var anchored []Pattern
 	for _, p := range unique {
-		if p.Length < bs.minPatternLen {
-			bs.minPatternLen = p.Length
+		if p.Anchor == Unanchored && !p.Glob {
+			scanned = append(scanned, p)
+		} else {
+			anchored = append(anchored, p)
 		}
 	}
-	if bs.minPatternLen == 255 {
-		bs.minPatternLen = 1
+	unique = append(scanned, anchored...)
+	for i := range unique {
+		unique[i].ID = uint16(i)
+		seen[makePatternKey(unique[i])] = uint16(i)
 	}
 
+	bs.patterns = unique
+	bs.numPatterns = len(unique)
+	bs.numScanned = len(scanned)
+	bs.buildSearchers()
+
+	bs.minPatternLen = bs.scannedMinLength()
+
 	// Assign IDs back to expression nodes
 	bs.assignPatternIDs(bs.expr, seen)
 }
 
+// scannedMinLength returns the length of the shortest scanned pattern, or 1
+// if there is none. The engines scan up to len(haystack)-minPatternLen.
+func (bs *BooleanSearch) scannedMinLength() int {
+	n := 1
+	for i, p := range bs.scanned() {
+		if i == 0 || p.Length < n {
+			n = p.Length
+		}
+	}
+	return n
+}
+
+// patternKey identifies a distinct pattern: its uppercase text, or its text
+// as given if it is matched case-sensitively, its word boundary set, its
+// anchor and whether it is a glob.
+// Case-sensitive patterns without letters match exactly like
+// case-insensitive ones and share their key.
+type patternKey struct {
+	text          string
+	caseSensitive bool
+	word          bool
+	boundary      CharSet
+	anchor        Anchor
+	glob          bool
+}
+
+func makePatternKey(p Pattern) patternKey {
+	k := patternKey{text: toUpperString(p.Text), anchor: p.Anchor, glob: p.Glob}
+	if p.CaseSensitive && hasAlpha(p.Text) {
+		k.text, k.caseSensitive = p.Text, true
+	}
+	if p.Boundary != nil {
+		k.word, k.boundary = true, *p.Boundary
+	}
+	return k
+}
+
 // assignPatternIDs assigns pattern IDs to ContainsExpr nodes.
-func (bs *BooleanSearch) assignPatternIDs(expr BoolExpr, idMap map[string]uint8) {
+func (bs *BooleanSearch) assignPatternIDs(expr BoolExpr, idMap map[patternKey]uint16) {
 	switch e := expr.(type) {
 	case *ContainsExpr:
-		norm := toUpperString(e.Pattern)
-		e.patternID = idMap[norm]
+		e.patternID = idMap[makePatternKey(e.pattern())]
 	case *AndExpr:
 		bs.assignPatternIDs(e.Left, idMap)
 		bs.assignPatternIDs(e.Right, idMap)
@@ -345,7 +488,7 @@ func (bs *BooleanSearch) buildTBLMasks() {
 	}
 
 	// For each pattern, clear the bit for nibbles that could match
-	for _, p := range bs.patterns {
+	for _, p := range bs.scanned() {
 		if len(p.Text) == 0 {
 			continue
 		}
@@ -389,11 +532,11 @@ func (bs *BooleanSearch) buildFDRTables() {
 	// Determine domain size based on pattern count
 	// More patterns → larger domain to reduce collisions
 	switch {
-	case bs.numPatterns <= 16:
+	case bs.numScanned <= 16:
 		bs.fdr.domain = 10 // 1024 entries
-	case bs.numPatterns <= 32:
+	case bs.numScanned <= 32:
 		bs.fdr.domain = 11 // 2048 entries
-	case bs.numPatterns <= 48:
+	case bs.numScanned <= 48:
 		bs.fdr.domain = 12 // 4096 entries
 	default:
 		bs.fdr.domain = 13 // 8192 entries
@@ -409,18 +552,13 @@ func (bs *BooleanSearch) buildFDRTables() {
 		bs.fdr.stateTable[i] = ^uint64(0) // All 1s = no patterns match
 	}
 
-	// Calculate stride based on minimum pattern length
-	switch {
-	case bs.minPatternLen >= 4:
-		bs.fdr.stride = 4
-	case bs.minPatternLen >= 2:
-		bs.fdr.stride = 2
-	default:
-		bs.fdr.stride = 1
-	}
+	// The state table is keyed on the first 4 bytes of each pattern, so every
+	// haystack position has to be hashed: a stride > 1 would miss patterns
+	// starting between the sampled positions.
+	bs.fdr.stride = 1
 
 	// For each pattern, populate the hash table
-	for _, p := range bs.patterns {
+	for _, p := range bs.scanned() {
 		if len(p.Text) == 0 {
 			continue
 		}
@@ -429,7 +567,7 @@ func (bs *BooleanSearch) buildFDRTables() {
 
 		// Generate all hash values this pattern could match
 		// For short patterns (< 4 bytes), we need to handle don't-care bytes
-		bs.populateFDRPattern(p, patBit)
+		populateFDRPattern(bs.fdr.stateTable, bs.fdr.domainMask, p, patBit)
 	}
 
 	// Build coarse TBL prefilter tables for NEON fast path
@@ -454,7 +592,7 @@ func (bs *BooleanSearch) buildFDRCoarseTables() {
 
 	// Assign patterns to groups using round-robin based on pattern ID
 	// This gives reasonable distribution. Alternative: group by first byte rarity.
-	for _, p := range bs.patterns {
+	for _, p := range bs.scanned() {
 		if len(p.Text) == 0 {
 			continue
 		}
@@ -511,8 +649,9 @@ func (bs *BooleanSearch) buildFDRCoarseTables() {
 	}
 }
 
-// populateFDRPattern populates the FDR hash table for a single pattern.
-func (bs *BooleanSearch) populateFDRPattern(p Pattern, patBit uint64) {
+// populateFDRPattern clears patBit in every entry of the FDR hash table that
+// the first 4 bytes of pattern p can hash to.
+func populateFDRPattern(table []uint64, domainMask uint32, p Pattern, patBit uint64) {
 	text := p.Text
 	length := len(text)
 
@@ -539,25 +678,25 @@ func (bs *BooleanSearch) populateFDRPattern(p Pattern, patBit uint64) {
 	}
 
 	// Expand all combinations of don't-care positions
-	bs.expandFDRHash(hashBytes, dontCareMask, 0, patBit)
+	expandFDRHash(table, domainMask, hashBytes, dontCareMask, 0, patBit)
 }
 
 // expandFDRHash recursively expands all hash combinations for don't-care positions.
-func (bs *BooleanSearch) expandFDRHash(hashBytes [4]byte, dontCare [4]bool, pos int, patBit uint64) {
+func expandFDRHash(table []uint64, domainMask uint32, hashBytes [4]byte, dontCare [4]bool, pos int, patBit uint64) {
 	if pos == 4 {
 		// All positions processed, compute hash and clear the pattern bit
 		hash := uint32(hashBytes[0]) |
 			(uint32(hashBytes[1]) << 8) |
 			(uint32(hashBytes[2]) << 16) |
 			(uint32(hashBytes[3]) << 24)
-		hash &= bs.fdr.domainMask
-		bs.fdr.stateTable[hash] &^= patBit // Clear bit = pattern might match
+		hash &= domainMask
+		table[hash] &^= patBit // Clear bit = pattern might match
 		return
 	}
 
 	if !dontCare[pos] {
 		// Not a don't-care position, recurse with current value
-		bs.expandFDRHash(hashBytes, dontCare, pos+1, patBit)
+		expandFDRHash(table, domainMask, hashBytes, dontCare, pos+1, patBit)
 	} else {
 		// Don't-care position: try all 256 values
 		// (For case-insensitive letters, we only need upper and lower)
@@ -565,56 +704,83 @@ func (bs *BooleanSearch) expandFDRHash(hashBytes [4]byte, dontCare [4]bool, pos
 		if isAlpha(c) {
 			// Try both cases
 			hashBytes[pos] = c &^ 0x20 // uppercase
-			bs.expandFDRHash(hashBytes, dontCare, pos+1, patBit)
+			expandFDRHash(table, domainMask, hashBytes, dontCare, pos+1, patBit)
 			hashBytes[pos] = c | 0x20 // lowercase
-			bs.expandFDRHash(hashBytes, dontCare, pos+1, patBit)
+			expandFDRHash(table, domainMask, hashBytes, dontCare, pos+1, patBit)
 		} else if c == 0 && pos > 0 {
 			// Short pattern don't-care: try all 256 values
 			// This is expensive but necessary for correctness
 			for v := 0; v < 256; v++ {
 				hashBytes[pos] = byte(v)
-				bs.expandFDRHash(hashBytes, dontCare, pos+1, patBit)
+				expandFDRHash(table, domainMask, hashBytes, dontCare, pos+1, patBit)
 			}
 		} else {
-			bs.expandFDRHash(hashBytes, dontCare, pos+1, patBit)
+			expandFDRHash(table, domainMask, hashBytes, dontCare, pos+1, patBit)
 		}
 	}
 }
 
 // buildVerifyTables builds the verification lookup tables.
 func (bs *BooleanSearch) buildVerifyTables() {
-	for _, p := range bs.patterns {
-		id := p.ID
-		bs.verify.lengths[id] = uint8(len(p.Text))
-		bs.verify.ptrs[id] = p.normText
+	for _, p := range bs.scanned() {
+		bs.verify.add(uint8(p.ID), p)
+	}
+}
 
-		if len(p.Text) == 0 {
-			continue
-		}
+// add stores the verification data for pattern p under id.
+func (vt *verifyTables) add(id uint8, p Pattern) {
+	vt.lengths[id] = uint16(len(p.Text))
+	vt.setText(id, p)
+	vt.setBoundary(id, p.Boundary)
+	if len(p.Text) > 8 {
+		vt.tails[id] = *(*uint64)(unsafe.Pointer(unsafe.StringData(vt.ptrs[id][len(p.Text)-8:])))
+	}
 
-		// Build the first 8 bytes as uint64 with case-fold applied
-		var value, mask uint64
-		for i := 0; i < 8 && i < len(p.Text); i++ {
-			c := p.Text[i]
-			var v, m byte
+	if len(p.Text) == 0 {
+		return
+	}
 
-			if p.CaseSensitive {
-				v = c
-				m = 0xFF
-			} else if isAlpha(c) {
-				v = c &^ 0x20  // uppercase
-				m = 0xFF ^ 0x20 // mask out bit 5
-			} else {
-				v = c
-				m = 0xFF
-			}
+	// Build the first 8 bytes as uint64 with case-fold applied
+	var value, mask uint64
+	for i := 0; i < 8 && i < len(p.Text); i++ {
+		c := p.Text[i]
+		var v, m byte
 
-			value |= uint64(v) << (i * 8)
-			mask |= uint64(m) << (i * 8)
+		if p.CaseSensitive {
+			v = c
+			m = 0xFF
+		} else if isAlpha(c) {
+			v = c &^ 0x20  // uppercase
+			m = 0xFF ^ 0x20 // mask out bit 5
+		} else {
+			v = c
+			m = 0xFF
 		}
 
-		bs.verify.values[id] = value
-		bs.verify.masks[id] = mask
+		value |= uint64(v) << (i * 8)
+		mask |= uint64(m) << (i * 8)
+	}
+
+	vt.values[id] = value
+	vt.masks[id] = mask
+}
+
+// setText stores the text pattern id is verified against: as is for
+// case-sensitive patterns, uppercase for the others.
+func (vt *verifyTables) setText(id uint8, p Pattern) {
+	vt.ptrs[id] = p.normText
+	vt.exact &^= 1 << id
+	if p.CaseSensitive {
+		vt.ptrs[id] = p.Text
+		vt.exact |= 1 << id
+	}
+}
+
+// setBoundary makes pattern id match whole words only if boundary is non-nil.
+func (vt *verifyTables) setBoundary(id uint8, boundary *CharSet) {
+	vt.boundaries[id] = boundary
+	if boundary != nil {
+		vt.words |= 1 << id
 	}
 }
 
@@ -622,11 +788,11 @@ func (bs *BooleanSearch) buildVerifyTables() {
 func (bs *BooleanSearch) buildFloodTable() {
 	// For each byte value, determine which patterns could match a flood
 	for c := 0; c < 256; c++ {
-		for _, p := range bs.patterns {
+		for _, p := range bs.scanned() {
 			if bs.patternMatchesFlood(p, byte(c)) {
-				bs.flood[c].patternIDs = append(bs.flood[c].patternIDs, p.ID)
-				if bs.flood[c].minLength == 0 || uint8(p.Length) < bs.flood[c].minLength {
-					bs.flood[c].minLength = uint8(p.Length)
+				bs.flood[c].patternIDs = append(bs.flood[c].patternIDs, uint8(p.ID))
+				if bs.flood[c].minLength == 0 || uint16(p.Length) < bs.flood[c].minLength {
+					bs.flood[c].minLength = uint16(p.Length)
 				}
 			}
 		}
@@ -635,6 +801,10 @@ func (bs *BooleanSearch) buildFloodTable() {
 
 // patternMatchesFlood checks if a pattern would match a flood of the given byte.
 func (bs *BooleanSearch) patternMatchesFlood(p Pattern, floodChar byte) bool {
+	if p.Boundary != nil {
+		// Whether a whole-word pattern matches depends on the flood's edges
+		return false
+	}
 	for i := 0; i < len(p.Text); i++ {
 		c := p.Text[i]
 		if p.CaseSensitive {
@@ -696,14 +866,27 @@ func isAlpha(c byte) bool {
 // Match returns true if the haystack matches the boolean expression.
 func (bs *BooleanSearch) Match(haystack string) bool {
 	if bs.numPatterns == 0 {
-		return false
+		return bs.expr.Evaluate(0, true) == TRUE
+	}
+	if bs.banks != nil {
+		matched, _ := bs.matchBanks(haystack, nil)
+		return matched
 	}
 
 	var foundMask uint64
 
+	// Anchored and glob patterns first: anchors only take a few
+	// comparisons, and either may decide the result
+	if bs.numScanned < bs.numPatterns {
+		foundMask = bs.matchAnchors(haystack, nil)
+		if bs.checkEarlyTermination(foundMask) || bs.numScanned == 0 {
+			return bs.expr.Evaluate(foundMask, true) == TRUE
+		}
+	}
+
 	// Check for flood first (adversarial input protection)
 	if len(haystack) >= 64 {
-		foundMask = bs.checkFlood(haystack)
+		foundMask |= bs.checkFlood(haystack)
 		if bs.checkEarlyTermination(foundMask) {
 			return bs.expr.Evaluate(foundMask, true) == TRUE
 		}
@@ -711,15 +894,108 @@ func (bs *BooleanSearch) Match(haystack string) bool {
 
 	// Run the appropriate engine
 	if bs.useFDR {
-		foundMask = bs.searchFDR(haystack, foundMask)
+		foundMask = bs.searchFDR(haystack, foundMask, nil)
 	} else {
-		foundMask = bs.searchTBL(haystack, foundMask)
+		foundMask = bs.searchTBL(haystack, foundMask, nil)
 	}
 
 	// Final evaluation
 	return bs.expr.Evaluate(foundMask, true) == TRUE
 }
 
+// MatchDetail is like Match but also reports which patterns occur in the
+// haystack: bit i of found is set if the pattern with ID i (see Patterns)
+// occurs. If offsets is non-nil, offsets[i] is set to the first offset of
+// pattern i, or -1 if it does not occur. The offsets are recorded by the
+// search engine in the same pass; unlike Match, the scan only stops early
+// once every pattern has been found. With more than 64 patterns, found and
+// offsets cover IDs 0-63.
+func (bs *BooleanSearch) MatchDetail(haystack string, offsets *[64]int) (matched bool, found uint64) {
+	if bs.numPatterns == 0 {
+		if offsets != nil {
+			*offsets = noOffsets
+		}
+		return bs.expr.Evaluate(0, true) == TRUE, 0
+	}
+	// Recording offsets is also what turns off early termination.
+	if offsets == nil {
+		offsets = new([64]int)
+	}
+	*offsets = noOffsets
+	if bs.banks != nil {
+		return bs.matchBanks(haystack, offsets)
+	}
+
+	if bs.numScanned < bs.numPatterns {
+		found = bs.matchAnchors(haystack, offsets)
+	}
+
+	// No flood precheck: it marks patterns found without knowing where.
+	switch {
+	case bs.numScanned == 0:
+		// Only anchored patterns
+	case bs.useFDR:
+		found = bs.searchFDR(haystack, found, offsets)
+	default:
+		found = bs.searchTBL(haystack, found, offsets)
+	}
+	return bs.expr.Evaluate(found, true) == TRUE, found
+}
+
+// matchAnchors returns the mask of the anchored patterns that occur in
+// haystack, for searches with up to 64 patterns.
+func (bs *BooleanSearch) matchAnchors(haystack string, offsets *[64]int) uint64 {
+	var found [1]uint64
+	bs.findAnchors(haystack, found[:], offsets)
+	return found[0]
+}
+
+// Patterns returns the distinct patterns searched for, indexed by ID.
+// Case-insensitive patterns that differ only in case share an ID, and
+// patterns the optimizer proved redundant are not included. Anchored
+// patterns have the highest IDs.
+func (bs *BooleanSearch) Patterns() []Pattern {
+	return append([]Pattern(nil), bs.patterns...)
+}
+
+// hasWholeWords reports whether any pattern only matches whole words.
+func (bs *BooleanSearch) hasWholeWords() bool {
+	for _, p := range bs.patterns {
+		if p.Boundary != nil {
+			return true
+		}
+	}
+	return false
+}
+
+// scansWholeWords reports whether any scanned pattern only matches whole
+// words. Anchored and glob patterns are checked apart from the scan.
+func (bs *BooleanSearch) scansWholeWords() bool {
+	for _, p := range bs.scanned() {
+		if p.Boundary != nil {
+			return true
+		}
+	}
+	return false
+}
+
+// noOffsets is an offsets array with no pattern found.
+var noOffsets = func() (o [64]int) {
+	for i := range o {
+		o[i] = -1
+	}
+	return o
+}()
+
+// stopMasks returns the immediate TRUE/FALSE masks the engines stop on.
+// When offsets are recorded every pattern has to be found, so there are none.
+func (bs *BooleanSearch) stopMasks(offsets *[64]int) (trueMask, falseMask uint64) {
+	if offsets != nil {
+		return 0, 0
+	}
+	return bs.immediateTrueMask, bs.immediateFalseMask
+}
+
 // checkEarlyTermination returns true if we can terminate early.
 func (bs *BooleanSearch) checkEarlyTermination(foundMask uint64) bool {
 	if foundMask&bs.immediateTrueMask != 0 {
@@ -772,38 +1048,14 @@ func (bs *BooleanSearch) checkFlood(haystack string) uint64 {
 	return foundMask
 }
 
-// searchTBL uses the Direct TBL engine for 1-8 patterns.
-// On ARM64 with NEON, this calls the optimized assembly implementation.
-func (bs *BooleanSearch) searchTBL(haystack string, foundMask uint64) uint64 {
-	// NEON version handles all pattern lengths with long verification
-	return bs.searchTBLNEON(haystack, foundMask)
-}
-
-// searchTBLNEON uses the NEON-accelerated TBL engine.
-// This is called by searchTBL on ARM64 when NEON is available.
-func (bs *BooleanSearch) searchTBLNEON(haystack string, foundMask uint64) uint64 {
-	return searchTBL_NEON(
-		haystack,
-		&bs.tbl.masksLo,
-		&bs.tbl.masksHi,
-		&bs.verify.values,
-		&bs.verify.masks,
-		&bs.verify.lengths,
-		&bs.verify.ptrs,
-		bs.numPatterns,
-		bs.minPatternLen,
-		bs.immediateTrueMask,
-		bs.immediateFalseMask,
-		foundMask,
-	)
-}
-
 // searchTBLGo is the pure Go implementation of the TBL engine.
-func (bs *BooleanSearch) searchTBLGo(haystack string, foundMask uint64) uint64 {
+// If offsets is non-nil, the first offset of each found pattern is stored in it.
+func (bs *BooleanSearch) searchTBLGo(haystack string, foundMask uint64, offsets *[64]int) uint64 {
 	n := len(haystack)
 	if n == 0 {
 		return foundMask
 	}
+	trueMask, falseMask := bs.stopMasks(offsets)
 
 	// Need all patterns found mask for early termination check
 	allPatterns := uint64((1 << bs.numPatterns) - 1)
@@ -829,12 +1081,15 @@ func (bs *BooleanSearch) searchTBLGo(haystack string, foundMask uint64) uint64 {
 
 			if bs.verifyPattern(haystack, pos, pid) {
 				foundMask |= 1 << pid
+				if offsets != nil {
+					offsets[pid] = pos
+				}
 
 				// Check for early termination
-				if foundMask&bs.immediateTrueMask != 0 {
+				if foundMask&trueMask != 0 {
 					return foundMask
 				}
-				if foundMask&bs.immediateFalseMask != 0 {
+				if foundMask&falseMask != 0 {
 					return foundMask
 				}
 			}
@@ -849,48 +1104,24 @@ func (bs *BooleanSearch) searchTBLGo(haystack string, foundMask uint64) uint64 {
 	return foundMask
 }
 
-// searchFDR uses the FDR engine for 9-64 patterns.
-func (bs *BooleanSearch) searchFDR(haystack string, foundMask uint64) uint64 {
-	n := len(haystack)
-	if n < 4 {
-		// Fall back to Go for very short haystacks
-		return bs.searchFDRGo(haystack, foundMask)
-	}
-
-	// Use NEON implementation with TBL prefilter + FDR confirmation
-	return searchFDR_NEON(
-		haystack,
-		&bs.fdr.stateTable[0],
-		bs.fdr.domainMask,
-		bs.fdr.stride,
-		&bs.fdr.coarseLo,
-		&bs.fdr.coarseHi,
-		&bs.fdr.groupLUT,
-		&bs.verify.values,
-		&bs.verify.masks,
-		&bs.verify.lengths,
-		&bs.verify.ptrs,
-		bs.numPatterns,
-		bs.minPatternLen,
-		bs.immediateTrueMask,
-		bs.immediateFalseMask,
-		foundMask,
-	)
-}
-
 // searchFDRGo is the pure Go implementation of the FDR engine.
-func (bs *BooleanSearch) searchFDRGo(haystack string, foundMask uint64) uint64 {
+// If offsets is non-nil, the first offset of each found pattern is stored in it.
+func (bs *BooleanSearch) searchFDRGo(haystack string, foundMask uint64, offsets *[64]int) uint64 {
 	n := len(haystack)
+	trueMask, falseMask := bs.stopMasks(offsets)
 	if n < 4 {
 		// Very short haystack - scan each position
 		for pos := 0; pos <= n-bs.minPatternLen; pos++ {
-			for _, p := range bs.patterns {
+			for _, p := range bs.scanned() {
 				if foundMask&(1<<p.ID) != 0 {
 					continue
 				}
-				if bs.verifyPattern(haystack, pos, p.ID) {
+				if bs.verifyPattern(haystack, pos, uint8(p.ID)) {
 					foundMask |= 1 << p.ID
-					if bs.checkEarlyTermination(foundMask) {
+					if offsets != nil {
+						offsets[p.ID] = pos
+					}
+					if foundMask&(trueMask|falseMask) != 0 {
 						return foundMask
 					}
 				}
@@ -899,11 +1130,10 @@ func (bs *BooleanSearch) searchFDRGo(haystack string, foundMask uint64) uint64 {
 		return foundMask
 	}
 
-	stride := bs.fdr.stride
 	allPatterns := uint64((1 << bs.numPatterns) - 1)
 	hayPtr := unsafe.Pointer(unsafe.StringData(haystack))
 
-	for pos := 0; pos <= n-4; pos += stride {
+	for pos := 0; pos <= n-4; pos++ {
 		// Hash: load 4 bytes, mask to domain
 		hash := *(*uint32)(unsafe.Pointer(uintptr(hayPtr) + uintptr(pos))) & bs.fdr.domainMask
 
@@ -923,12 +1153,15 @@ func (bs *BooleanSearch) searchFDRGo(haystack string, foundMask uint64) uint64 {
 
 			if bs.verifyPattern(haystack, pos, pid) {
 				foundMask |= 1 << pid
+				if offsets != nil {
+					offsets[pid] = pos
+				}
 
 				// Check for early termination
-				if foundMask&bs.immediateTrueMask != 0 {
+				if foundMask&trueMask != 0 {
 					return foundMask
 				}
-				if foundMask&bs.immediateFalseMask != 0 {
+				if foundMask&falseMask != 0 {
 					return foundMask
 				}
 			}
@@ -940,15 +1173,18 @@ func (bs *BooleanSearch) searchFDRGo(haystack string, foundMask uint64) uint64 {
 		}
 	}
 
-	// Handle tail (last 3 bytes that weren't covered by stride)
-	for pos := ((n - 4) / stride) * stride; pos <= n-bs.minPatternLen; pos++ {
-		for _, p := range bs.patterns {
+	// Handle tail (last 3 positions, too short for a 4-byte hash)
+	for pos := n - 3; pos <= n-bs.minPatternLen; pos++ {
+		for _, p := range bs.scanned() {
 			if foundMask&(1<<p.ID) != 0 {
 				continue // Already found
 			}
-			if bs.verifyPattern(haystack, pos, p.ID) {
+			if bs.verifyPattern(haystack, pos, uint8(p.ID)) {
 				foundMask |= 1 << p.ID
-				if bs.checkEarlyTermination(foundMask) {
+				if offsets != nil {
+					offsets[p.ID] = pos
+				}
+				if foundMask&(trueMask|falseMask) != 0 {
 					return foundMask
 				}
 			}
@@ -960,41 +1196,63 @@ func (bs *BooleanSearch) searchFDRGo(haystack string, foundMask uint64) uint64 {
 
 // verifyPattern verifies if pattern pid matches at position pos in haystack.
 func (bs *BooleanSearch) verifyPattern(haystack string, pos int, pid uint8) bool {
-	length := int(bs.verify.lengths[pid])
+	return bs.verify.match(haystack, pos, pid)
+}
+
+// match verifies if pattern pid matches at position pos in haystack.
+func (vt *verifyTables) match(haystack string, pos int, pid uint8) bool {
+	length := int(vt.lengths[pid])
 	if pos+length > len(haystack) {
 		return false
 	}
 
 	hayPtr := unsafe.Pointer(unsafe.StringData(haystack))
 
+	if b := vt.boundaries[pid]; b != nil && !isWordAt(haystack, pos, length, &b.bitset) {
+		return false
+	}
+
 	// Quick 8-byte masked comparison for short patterns
 	if length <= 8 {
-		hay := *(*uint64)(unsafe.Pointer(uintptr(hayPtr) + uintptr(pos)))
-		return (hay & bs.verify.masks[pid]) == bs.verify.values[pid]
+		return (loadWord(haystack, pos) & vt.masks[pid]) == vt.values[pid]
 	}
 
 	// First 8 bytes
 	hay := *(*uint64)(unsafe.Pointer(uintptr(hayPtr) + uintptr(pos)))
-	if (hay & bs.verify.masks[pid]) != bs.verify.values[pid] {
+	if (hay & vt.masks[pid]) != vt.values[pid] {
 		return false
 	}
 
-	// Remaining bytes (full pattern comparison)
-	pattern := bs.verify.ptrs[pid]
-	for i := 8; i < length; i++ {
-		h := haystack[pos+i]
-		p := pattern[i]
-		// Case-insensitive comparison (pattern is uppercase)
-		if h != p {
-			hu := h
-			if hu >= 'a' && hu <= 'z' {
-				hu -= 0x20
-			}
-			if hu != p {
-				return false
-			}
+	// Remaining bytes: up to 16 bytes with one overlapping word, beyond that
+	// with a string compare. Case-insensitive patterns fold the haystack to
+	// uppercase, using the SIMD EqualFold kernel for the string compare.
+	exact := vt.exact&(1<<pid) != 0
+	if length <= 16 {
+		hay := *(*uint64)(unsafe.Pointer(uintptr(hayPtr) + uintptr(pos+length-8)))
+		if !exact {
+			hay = asciiFoldWord(hay)
 		}
+		return hay == vt.tails[pid]
 	}
+	if exact {
+		return haystack[pos+8:pos+length] == vt.ptrs[pid][8:]
+	}
+	return impl.equalFold(haystack[pos+8:pos+length], vt.ptrs[pid][8:])
+}
 
-	return true
+// loadWord returns the 8 bytes of s at pos as a little-endian word, without
+// reading past the end of s: missing bytes read as zero.
+func loadWord(s string, pos int) uint64 {
+	p := unsafe.Pointer(unsafe.StringData(s))
+	if pos+8 <= len(s) {
+		return *(*uint64)(unsafe.Pointer(uintptr(p) + uintptr(pos)))
+	}
+	if len(s) >= 8 {
+		return *(*uint64)(unsafe.Pointer(uintptr(p) + uintptr(len(s)-8))) >> (8 * (pos + 8 - len(s)))
+	}
+	var w uint64
+	for i := len(s) - 1; i >= pos; i-- {
+		w = w<<8 | uint64(s[i])
+	}
+	return w
 }
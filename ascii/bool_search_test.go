@@ -1,12 +1,13 @@
-//go:build !noasm && arm64
-
 package ascii
 
 import (
+	"bytes"
 	"fmt"
 	"math/rand"
+	"regexp"
 	"strings"
 	"testing"
+	"unsafe"
 )
 
 // =============================================================================
@@ -22,6 +23,15 @@ func boolSearchReference(haystack string, expr BoolExpr) bool {
 func evalExprReference(haystack string, expr BoolExpr) bool {
 	switch e := expr.(type) {
 	case *ContainsExpr:
+		if e.Glob {
+			return globRegexp(e.Pattern, e.CaseSensitive).MatchString(haystack)
+		}
+		if (e.Boundary != nil || e.Anchor != Unanchored) && e.Pattern != "" {
+			return containsAtReference(haystack, e)
+		}
+		if e.CaseSensitive {
+			return strings.Contains(haystack, e.Pattern)
+		}
 		return IndexFold(haystack, e.Pattern) != -1
 	case *AndExpr:
 		return evalExprReference(haystack, e.Left) && evalExprReference(haystack, e.Right)
@@ -34,6 +44,41 @@ func evalExprReference(haystack string, expr BoolExpr) bool {
 	}
 }
 
+// containsAtReference checks every offset for a match of e that is a whole
+// word, if e has a boundary, and sits where its anchor requires.
+func containsAtReference(haystack string, e *ContainsExpr) bool {
+	n := len(e.Pattern)
+	for i := 0; i+n <= len(haystack); i++ {
+		s := haystack[i : i+n]
+		if e.CaseSensitive && s != e.Pattern || !e.CaseSensitive && !strings.EqualFold(s, e.Pattern) {
+			continue
+		}
+		start, end := i == 0, i+n == len(haystack)
+		switch e.Anchor {
+		case AnchorStart:
+			if !start {
+				continue
+			}
+		case AnchorEnd:
+			if !end {
+				continue
+			}
+		case AnchorLineStart:
+			if !start && haystack[i-1] != '\n' {
+				continue
+			}
+		case AnchorLineEnd:
+			if !end && haystack[i+n] != '\n' {
+				continue
+			}
+		}
+		if e.Boundary == nil || (start || e.Boundary.Contains(haystack[i-1])) && (end || e.Boundary.Contains(haystack[i+n])) {
+			return true
+		}
+	}
+	return false
+}
+
 // =============================================================================
 // Unit Tests
 // =============================================================================
@@ -104,8 +149,8 @@ func TestBoolSearchBasic(t *testing.T) {
 }
 
 func TestBoolSearchPatternCounts(t *testing.T) {
-	// Test different pattern counts to exercise both Direct TBL (1-8) and FDR (9-64) engines
-	patternCounts := []int{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 16, 32, 64}
+	// Test different pattern counts to exercise Direct TBL (1-8), FDR (9-64) and banked (65+) engines
+	patternCounts := []int{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 16, 32, 64, 65, 200, 2000}
 
 	for _, n := range patternCounts {
 		t.Run(fmt.Sprintf("%d_patterns", n), func(t *testing.T) {
@@ -634,7 +679,7 @@ func BenchmarkBoolSearchLongPatterns(b *testing.B) {
 	haystackSize := 64 * 1024
 	haystack := strings.Repeat("abcdefghijklmnopqrstuvwxyz0123456789", haystackSize/36)
 
-	patternLengths := []int{4, 8, 16, 32, 64, 128}
+	patternLengths := []int{4, 8, 16, 32, 64, 128, 256, 1024}
 
 	for _, plen := range patternLengths {
 		pattern := strings.Repeat("xyz", plen/3+1)[:plen]
@@ -648,6 +693,22 @@ func BenchmarkBoolSearchLongPatterns(b *testing.B) {
 			}
 		})
 	}
+
+	// Haystack of near misses that differ from the pattern in the last byte,
+	// so every candidate runs the full long verification
+	for _, plen := range []int{16, 64, 256, 1024} {
+		pattern := strings.Repeat("stack frame ", plen/12+1)[:plen]
+		miss := pattern[:plen-1] + "#"
+		nearMiss := strings.Repeat(miss, haystackSize/plen)
+		bs := MakeBooleanSearch(Contains(pattern))
+
+		b.Run(fmt.Sprintf("NearMiss_%d", plen), func(b *testing.B) {
+			b.SetBytes(int64(len(nearMiss)))
+			for i := 0; i < b.N; i++ {
+				boolBenchSink = bs.Match(nearMiss)
+			}
+		})
+	}
 }
 
 // BenchmarkBoolSearchManyPatterns benchmarks large pattern counts for FDR engine.
@@ -701,6 +762,183 @@ func BenchmarkBoolSearchManyPatterns(b *testing.B) {
 	}
 }
 
+// BenchmarkBoolSearchBanks benchmarks pattern sets above 64, which are split
+// into banks scanned in a single pass, against the 64-pattern FDR engine. No
+// pattern matches, so every byte is scanned.
+func BenchmarkBoolSearchBanks(b *testing.B) {
+	haystack := strings.Repeat("abcdefghijklmnopqrstuvwxyz ", 64*1024/27)
+
+	for _, n := range []int{64, 65, 200, 1000, 2000} {
+		var expr BoolExpr = Contains(fmt.Sprintf("rule-%04d", 0))
+		for i := 1; i < n; i++ {
+			expr = Or(expr, Contains(fmt.Sprintf("rule-%04d", i)))
+		}
+		bs := MakeBooleanSearch(expr)
+
+		name := fmt.Sprintf("Banks_%d", n)
+		if bs.banks == nil {
+			name = fmt.Sprintf("FDR_%d", n)
+		}
+		b.Run(name, func(b *testing.B) {
+			b.SetBytes(int64(len(haystack)))
+			for i := 0; i < b.N; i++ {
+				boolBenchSink = bs.Match(haystack)
+			}
+		})
+	}
+}
+
+// BenchmarkBooleanStream compares streaming a 1MB record in 64KB chunks
+// with matching it as one contiguous buffer.
+func BenchmarkBooleanStream(b *testing.B) {
+	haystack := strings.Repeat("abcdefghijklmnopqrstuvwxyz ", 1024*1024/27)
+	bs := MakeBooleanSearch(And(Contains("error"), Not(Contains("timeout"))))
+	const chunkSize = 64 * 1024
+
+	b.Run("Match", func(b *testing.B) {
+		b.SetBytes(int64(len(haystack)))
+		for i := 0; i < b.N; i++ {
+			boolBenchSink = bs.Match(haystack)
+		}
+	})
+	b.Run("Stream", func(b *testing.B) {
+		s := bs.NewStream()
+		b.SetBytes(int64(len(haystack)))
+		for i := 0; i < b.N; i++ {
+			s.Reset()
+			for off := 0; off < len(haystack); off += chunkSize {
+				s.WriteString(haystack[off:min(off+chunkSize, len(haystack))])
+			}
+			boolBenchSink = s.Result()
+		}
+	})
+}
+
+// BenchmarkMatchColumn compares MatchColumn with calling Match per row on
+// a column of short log lines, 1 in 1000 of which matches, with a
+// non-selective search that matches nearly every row, and with an anchored
+// whole-word term, which leaves the group scan on.
+func BenchmarkMatchColumn(b *testing.B) {
+	var data []byte
+	offsets := []uint32{0}
+	for i := 0; i < 100000; i++ {
+		line := fmt.Sprintf("2024-01-01 12:00:%02d INFO request served id=%d", i%60, i)
+		if i%1000 == 0 {
+			line = fmt.Sprintf("2024-01-01 12:00:%02d ERROR upstream timeout id=%d", i%60, i)
+		}
+		data = append(data, line...)
+		offsets = append(offsets, uint32(len(data)))
+	}
+	rows := len(offsets) - 1
+	out := make([]uint64, (rows+63)/64)
+
+	var fdr BoolExpr = Contains("error")
+	for _, p := range []string{"fatal", "panic", "critical", "exception", "denied", "refused", "overflow", "deadlock"} {
+		fdr = Or(fdr, Contains(p))
+	}
+	for _, tc := range []struct {
+		name string
+		expr BoolExpr
+	}{
+		{"TBL", And(Contains("error"), Not(Contains("retry")))},
+		{"FDR", fdr},
+		{"Dense", And(Contains("request"), Not(Contains("retry")))},
+		{"AnchoredWord", Or(Contains("error"), SuffixCS("id=99999").WholeWord(WordBoundary))},
+	} {
+		bs := MakeBooleanSearch(tc.expr)
+
+		b.Run(tc.name+"/PerRow", func(b *testing.B) {
+			b.SetBytes(int64(len(data)))
+			for i := 0; i < b.N; i++ {
+				for r := 0; r < rows; r++ {
+					setBit(out, r, bs.Match(bytesToString(data[offsets[r]:offsets[r+1]])))
+				}
+			}
+		})
+		b.Run(tc.name+"/Column", func(b *testing.B) {
+			b.SetBytes(int64(len(data)))
+			for i := 0; i < b.N; i++ {
+				bs.MatchColumn(data, offsets, out)
+			}
+		})
+	}
+}
+
+// BenchmarkMatchLines compares MatchLines with splitting the buffer into
+// lines and calling Match on each, on NDJSON records 1 in 1000 of which
+// match, and with a non-selective search that matches nearly every record.
+func BenchmarkMatchLines(b *testing.B) {
+	var buf []byte
+	for i := 0; i < 100000; i++ {
+		level := "info"
+		if i%1000 == 0 {
+			level = "error"
+		}
+		buf = fmt.Appendf(buf, `{"ts":"2024-01-01T12:00:%02dZ","level":"%s","msg":"request served","id":%d}`+"\n", i%60, level, i)
+	}
+	dst := make([]LineRange, 0, 1024)
+
+	for _, tc := range []struct {
+		name string
+		expr BoolExpr
+	}{
+		{"TBL", And(Contains(`"level":"error"`), Not(Contains("retry")))},
+		{"FDR", Or(Contains(`"level":"error"`), Or(Contains("fatal"), Or(Contains("panic"), Or(Contains("critical"),
+			Or(Contains("exception"), Or(Contains("denied"), Or(Contains("refused"), Or(Contains("overflow"), Contains("deadlock")))))))))},
+		{"Dense", And(Contains("request served"), Not(Contains(`"level":"error"`)))},
+	} {
+		bs := MakeBooleanSearch(tc.expr)
+
+		b.Run(tc.name+"/PerLine", func(b *testing.B) {
+			b.SetBytes(int64(len(buf)))
+			for i := 0; i < b.N; i++ {
+				dst = dst[:0]
+				for start := 0; start < len(buf); {
+					end := start + bytes.IndexByte(buf[start:], '\n')
+					if bs.Match(bytesToString(buf[start:end])) {
+						dst = append(dst, LineRange{start, end})
+					}
+					start = end + 1
+				}
+			}
+		})
+		b.Run(tc.name+"/MatchLines", func(b *testing.B) {
+			b.SetBytes(int64(len(buf)))
+			for i := 0; i < b.N; i++ {
+				dst = bs.MatchLines(buf, dst[:0])
+			}
+		})
+	}
+}
+
+// BenchmarkLoadBooleanSearch compares compiling a search with loading its
+// serialized form.
+func BenchmarkLoadBooleanSearch(b *testing.B) {
+	for _, n := range []int{8, 64, 2000} {
+		var expr BoolExpr = Contains(fmt.Sprintf("rule-%04d", 0))
+		for i := 1; i < n; i++ {
+			expr = Or(expr, Contains(fmt.Sprintf("rule-%04d", i)))
+		}
+		blob, err := MakeBooleanSearch(expr).MarshalBinary()
+		if err != nil {
+			b.Fatal(err)
+		}
+		blob = alignedCopy(blob)
+
+		b.Run(fmt.Sprintf("Make_%d", n), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				boolBenchSink = MakeBooleanSearch(expr) != nil
+			}
+		})
+		b.Run(fmt.Sprintf("Load_%d", n), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				bs, _ := LoadBooleanSearch(blob)
+				boolBenchSink = bs != nil
+			}
+		})
+	}
+}
+
 // BenchmarkBoolSearchRealWorld benchmarks realistic scenarios.
 func BenchmarkBoolSearchRealWorld(b *testing.B) {
 	// Log search: find error OR warning OR critical
@@ -799,3 +1037,1220 @@ func randomExpr(rng *rand.Rand, patterns []string, depth int) BoolExpr {
 	}
 	return Contains(patterns[0])
 }
+
+// TestBoolSearchEngineMatchesGo checks the platform TBL and FDR engines
+// against the pure Go implementations, with single matches placed across
+// block boundaries and at the very end of the haystack.
+func TestBoolSearchEngineMatchesGo(t *testing.T) {
+	rng := rand.New(rand.NewSource(7))
+
+	for i := 0; i < 300; i++ {
+		numPatterns := rng.Intn(24) + 1
+		var expr BoolExpr
+		patterns := make([]string, numPatterns)
+		for j := range patterns {
+			// FDR expands every don't-care byte of short patterns, so keep
+			// them at 2+ bytes to bound construction time
+			patterns[j] = randomString(rng, rng.Intn(19)+2)
+			var c *ContainsExpr
+			if rng.Intn(2) == 0 {
+				c = ContainsCS(patterns[j])
+			} else {
+				c = ContainsCI(patterns[j])
+			}
+			if expr == nil {
+				expr = c
+			} else {
+				expr = And(expr, c)
+			}
+		}
+		bs := MakeBooleanSearch(expr)
+
+		for _, n := range []int{31, 32, 33, 63, 64, 65, 100, 257} {
+			b := []byte(strings.Repeat("-", n))
+			p := patterns[rng.Intn(numPatterns)]
+			if len(p) <= n {
+				pos := rng.Intn(n - len(p) + 1)
+				if rng.Intn(2) == 0 {
+					pos = n - len(p)
+				}
+				copy(b[pos:], p)
+			}
+			haystack := string(b)
+
+			var got, want uint64
+			if bs.useFDR {
+				got, want = bs.searchFDR(haystack, 0, nil), bs.searchFDRGo(haystack, 0, nil)
+			} else {
+				got, want = bs.searchTBL(haystack, 0, nil), bs.searchTBLGo(haystack, 0, nil)
+			}
+			if got != want {
+				t.Fatalf("patterns=%q haystack=%q: foundMask = %#x, want %#x", patterns, haystack, got, want)
+			}
+		}
+	}
+}
+
+// TestBoolSearchCaseSensitiveLong checks that case-sensitive patterns longer
+// than 8 bytes are compared exactly past their first 8 bytes, by the Go and
+// SIMD engines and for every way the tail is verified.
+func TestBoolSearchCaseSensitiveLong(t *testing.T) {
+	rng := rand.New(rand.NewSource(17))
+	for _, numPatterns := range []int{1, 12} {
+		for n := 9; n <= 72; n++ {
+			// A lowercase letter past byte 8, and the pattern with it in
+			// uppercase
+			b := []byte(randomString(rng, n))
+			b[8+rng.Intn(n-8)] = 'k'
+			p := string(b)
+			flipped := strings.Replace(p[8:], "k", "K", 1)
+			flipped = p[:8] + flipped
+
+			var expr BoolExpr = ContainsCS(p)
+			for i := 1; i < numPatterns; i++ {
+				expr = Or(expr, ContainsCS(fmt.Sprintf("#%02d#", i)))
+			}
+			bs := MakeBooleanSearch(expr)
+
+			for _, pad := range []int{0, 40} {
+				for _, tc := range []struct {
+					haystack string
+					want     bool
+				}{
+					{strings.Repeat("-", pad) + p, true},
+					{strings.Repeat("-", pad) + flipped, false},
+					{strings.Repeat("-", pad) + flipped + "-" + p, true},
+				} {
+					var found uint64
+					if bs.useFDR {
+						found = bs.searchFDRGo(tc.haystack, 0, nil)
+					} else {
+						found = bs.searchTBLGo(tc.haystack, 0, nil)
+					}
+					if got := found&1 != 0; got != tc.want {
+						t.Fatalf("pattern %q, haystack %q: Go engine found = %v, want %v", p, tc.haystack, got, tc.want)
+					}
+					if got := bs.Match(tc.haystack); got != tc.want {
+						t.Fatalf("pattern %q, haystack %q: Match = %v, want %v", p, tc.haystack, got, tc.want)
+					}
+				}
+			}
+		}
+	}
+}
+
+// TestBoolSearchFDRAllOffsets checks that FDR finds a pattern at every
+// haystack offset, not just at multiples of the hash stride.
+func TestBoolSearchFDRAllOffsets(t *testing.T) {
+	patterns := []string{"alpha1", "bravo2", "charlie3", "delta4", "echo5", "foxtrot6", "golf7", "hotel8", "india9", "juliett10"}
+	var expr BoolExpr = Contains(patterns[0])
+	for _, p := range patterns[1:] {
+		expr = Or(expr, Contains(p))
+	}
+	bs := MakeBooleanSearch(expr)
+	if !bs.useFDR {
+		t.Fatal("expected FDR engine")
+	}
+
+	for _, p := range []string{"india9", "JULIETT10"} {
+		for n := len(p); n < 100; n++ {
+			for pos := 0; pos+len(p) <= n; pos++ {
+				haystack := strings.Repeat(".", pos) + p + strings.Repeat(".", n-pos-len(p))
+				if !bs.Match(haystack) {
+					t.Fatalf("Match(%q) = false, want true", haystack)
+				}
+			}
+		}
+	}
+}
+
+// TestMatchDetail checks the found mask and first offsets reported by both
+// engines against strings.Index on the case-folded haystack.
+func TestMatchDetail(t *testing.T) {
+	rng := rand.New(rand.NewSource(7))
+	const alphabet = "abcABC-"
+	rnd := func(n int, charset string) string {
+		b := make([]byte, n)
+		for i := range b {
+			b[i] = charset[rng.Intn(len(charset))]
+		}
+		return string(b)
+	}
+
+	for i := 0; i < 300; i++ {
+		patterns := make([]string, rng.Intn(20)+1)
+		for j := range patterns {
+			patterns[j] = rnd(rng.Intn(12)+1, "abc")
+		}
+		bs := MakeBooleanSearch(randomExpr(rng, patterns, 3))
+
+		for _, n := range []int{0, 3, 17, 40, 100, 300} {
+			haystack := rnd(n, alphabet)
+			upper := strings.ToUpper(haystack)
+
+			var offsets [64]int
+			matched, found := bs.MatchDetail(haystack, &offsets)
+			if want := bs.Match(haystack); matched != want {
+				t.Fatalf("MatchDetail(%q) matched = %v, want %v", haystack, matched, want)
+			}
+			for id, p := range bs.Patterns() {
+				if int(p.ID) != id {
+					t.Fatalf("Patterns()[%d].ID = %d", id, p.ID)
+				}
+				want := strings.Index(upper, strings.ToUpper(p.Text))
+				if got := offsets[id]; got != want {
+					t.Fatalf("patterns=%q haystack=%q: offsets[%d] (%q) = %d, want %d", patterns, haystack, id, p.Text, got, want)
+				}
+				if got := found&(1<<id) != 0; got != (want >= 0) {
+					t.Fatalf("patterns=%q haystack=%q: found bit %d = %v, want %v", patterns, haystack, id, got, want >= 0)
+				}
+			}
+			if _, f := bs.MatchDetail(haystack, nil); f != found {
+				t.Fatalf("MatchDetail(%q, nil) found = %#x, want %#x", haystack, f, found)
+			}
+		}
+	}
+}
+
+// randomTree combines exprs into a balanced tree of random And/Or/Not nodes.
+func randomTree(rng *rand.Rand, exprs []BoolExpr) BoolExpr {
+	var e BoolExpr
+	if len(exprs) == 1 {
+		e = exprs[0]
+	} else {
+		l, r := randomTree(rng, exprs[:len(exprs)/2]), randomTree(rng, exprs[len(exprs)/2:])
+		if rng.Intn(2) == 0 {
+			e = And(l, r)
+		} else {
+			e = Or(l, r)
+		}
+	}
+	if rng.Intn(4) == 0 {
+		e = Not(e)
+	}
+	return e
+}
+
+// TestBoolSearchBanks checks searches with more than 64 patterns, where
+// expressions reference patterns across several banks.
+func TestBoolSearchBanks(t *testing.T) {
+	rng := rand.New(rand.NewSource(64))
+	rnd := func(n int, charset string) string {
+		b := make([]byte, n)
+		for i := range b {
+			b[i] = charset[rng.Intn(len(charset))]
+		}
+		return string(b)
+	}
+
+	for _, numPatterns := range []int{65, 130, 500, 1500} {
+		for i := 0; i < 20; i++ {
+			// Patterns of one length cannot subsume each other, so the
+			// optimizer keeps enough of them for the banked engine
+			patternLen := rng.Intn(8) + 5
+			exprs := make([]BoolExpr, numPatterns)
+			for j := range exprs {
+				exprs[j] = Contains(rnd(patternLen, "abcdefghij"))
+			}
+			expr := randomTree(rng, exprs)
+			bs := MakeBooleanSearch(expr)
+			if bs.banks == nil {
+				t.Fatalf("%d patterns: expected banked engine", bs.numPatterns)
+			}
+
+			for _, n := range []int{0, 2, 5, 40, 300} {
+				haystack := rnd(n, "abcdefghijABCDEFGHIJ")
+				want := boolSearchReference(haystack, expr)
+				if got := bs.Match(haystack); got != want {
+					t.Fatalf("%d patterns, haystack %q: Match = %v, want %v", numPatterns, haystack, got, want)
+				}
+				var offsets [64]int
+				if got, _ := bs.MatchDetail(haystack, &offsets); got != want {
+					t.Fatalf("%d patterns, haystack %q: MatchDetail = %v, want %v", numPatterns, haystack, got, want)
+				}
+				for _, p := range bs.Patterns()[:64] {
+					if want := IndexFold(haystack, p.Text); offsets[p.ID] != want {
+						t.Fatalf("%d patterns, haystack %q: offset of %q = %d, want %d", numPatterns, haystack, p.Text, offsets[p.ID], want)
+					}
+				}
+			}
+		}
+	}
+}
+
+// TestBooleanStream feeds haystacks in random chunk sizes and checks the
+// result against Match over the whole haystack, including matches that
+// straddle chunk boundaries and the early Done signal.
+func TestBooleanStream(t *testing.T) {
+	rng := rand.New(rand.NewSource(15))
+	rnd := func(n int, charset string) string {
+		b := make([]byte, n)
+		for i := range b {
+			b[i] = charset[rng.Intn(len(charset))]
+		}
+		return string(b)
+	}
+
+	for _, numPatterns := range []int{1, 4, 8, 12, 40, 90} {
+		for i := 0; i < 30; i++ {
+			exprs := make([]BoolExpr, numPatterns)
+			for j := range exprs {
+				exprs[j] = Contains(rnd(rng.Intn(12)+3, "abcdef"))
+			}
+			expr := randomTree(rng, exprs)
+			bs := MakeBooleanSearch(expr)
+			s := bs.NewStream()
+
+			for _, n := range []int{0, 10, 100, 1000} {
+				haystack := rnd(n, "abcdefABCDEF")
+				want := bs.Match(haystack)
+				if ref := boolSearchReference(haystack, expr); want != ref {
+					t.Fatalf("Match(%q) = %v, reference %v", haystack, want, ref)
+				}
+
+				s.Reset()
+				var decided, decidedAt bool
+				for rest := haystack; len(rest) > 0; {
+					k := min(rng.Intn(20)+1, len(rest))
+					s.WriteString(rest[:k])
+					rest = rest[k:]
+					if s.Done() && !decided {
+						decided, decidedAt = true, s.Result()
+					}
+				}
+				if got := s.Result(); got != want {
+					t.Fatalf("%d patterns, haystack %q: stream Result = %v, want %v", numPatterns, haystack, got, want)
+				}
+				if decided && decidedAt != want {
+					t.Fatalf("%d patterns, haystack %q: Result at Done = %v, want %v", numPatterns, haystack, decidedAt, want)
+				}
+			}
+		}
+	}
+}
+
+// TestMatchColumn checks the selection bitmap against Match per row, for
+// sparse and dense hits and rows of mixed lengths including empty rows.
+func TestMatchColumn(t *testing.T) {
+	rng := rand.New(rand.NewSource(16))
+	rnd := func(n int, charset string) string {
+		b := make([]byte, n)
+		for i := range b {
+			b[i] = charset[rng.Intn(len(charset))]
+		}
+		return string(b)
+	}
+
+	for _, numPatterns := range []int{1, 5, 20, 80} {
+		for i := 0; i < 20; i++ {
+			exprs := make([]BoolExpr, numPatterns)
+			for j := range exprs {
+				c := Contains(rnd(rng.Intn(6)+3, "abcdef"))
+				if rng.Intn(8) == 0 {
+					// Checked per row, so the group scan stays on
+					c.Anchor = Anchor(rng.Intn(4) + 1)
+					c.WholeWord(WordBoundary)
+				}
+				exprs[j] = c
+			}
+			bs := MakeBooleanSearch(randomTree(rng, exprs))
+
+			// Mostly filler rows; "abcdef" rows make hits likely. Every
+			// other column has them in half the rows, so that most groups
+			// have a hit and the group scans are skipped
+			rows := rng.Intn(1000) + 1
+			density := 20
+			if i%2 == 1 {
+				density = 2
+			}
+			var data []byte
+			offsets := []uint32{0}
+			for r := 0; r < rows; r++ {
+				charset := "ghijklmnop"
+				if rng.Intn(density) == 0 {
+					charset = "abcdefABCDEF "
+				}
+				data = append(data, rnd(rng.Intn(200), charset)...)
+				offsets = append(offsets, uint32(len(data)))
+			}
+
+			out := make([]uint64, (rows+63)/64)
+			for j := range out {
+				out[j] = ^uint64(0)
+			}
+			bs.MatchColumn(data, offsets, out)
+			for r := 0; r < rows; r++ {
+				row := string(data[offsets[r]:offsets[r+1]])
+				if got, want := out[r/64]&(1<<(r%64)) != 0, bs.Match(row); got != want {
+					t.Fatalf("%d patterns: row %d %q selected = %v, want %v", numPatterns, r, row, got, want)
+				}
+			}
+		}
+	}
+}
+
+// TestMatchLines checks the matching line ranges against the reference on
+// each line, for sparse and dense hits, empty lines and a last line with
+// and without '\n'.
+func TestMatchLines(t *testing.T) {
+	for _, tc := range []struct {
+		expr BoolExpr
+		buf  string
+		want []LineRange
+	}{
+		{ContainsCS("ab"), "ab\nx\r\nxab", []LineRange{{0, 2}, {6, 9}}},
+		{Not(ContainsCS("ab")), "ab\n\nx\n", []LineRange{{3, 3}, {4, 5}}},
+		{ContainsCS("ab").WholeWord(MakeCharSet(" ")), "x ab\nab\nabc\n", []LineRange{{0, 4}, {5, 7}}},
+		{LineSuffixCS("b"), "ab\nb\nbc", []LineRange{{0, 2}, {3, 4}}},
+		{PrefixCS("b"), "ab\nb\nbc", []LineRange{{3, 4}, {5, 7}}},
+	} {
+		got := MakeBooleanSearch(tc.expr).MatchLines([]byte(tc.buf), nil)
+		if fmt.Sprint(got) != fmt.Sprint(tc.want) {
+			t.Errorf("MatchLines(%q) = %v, want %v", tc.buf, got, tc.want)
+		}
+	}
+
+	rng := rand.New(rand.NewSource(22))
+	rnd := func(n int, charset string) string {
+		b := make([]byte, n)
+		for i := range b {
+			b[i] = charset[rng.Intn(len(charset))]
+		}
+		return string(b)
+	}
+	boundaries := []CharSet{WordBoundary, MakeCharSet(" ")}
+
+	for _, numPatterns := range []int{1, 5, 20, 80} {
+		for i := 0; i < 20; i++ {
+			exprs := make([]BoolExpr, numPatterns)
+			for j := range exprs {
+				c := &ContainsExpr{Pattern: rnd(rng.Intn(4)+2, "abcdef")}
+				switch rng.Intn(6) {
+				case 0:
+					c.WholeWord(boundaries[rng.Intn(len(boundaries))])
+				case 1:
+					c.Anchor = Anchor(rng.Intn(4) + 1)
+				}
+				exprs[j] = c
+			}
+			expr := randomTree(rng, exprs)
+			bs := MakeBooleanSearch(expr)
+
+			// Mostly filler lines; "abcdef" lines make hits likely. Every
+			// other buffer has them in half the lines, so that most blocks
+			// have a hit and the block scans are skipped
+			density := 20
+			if i%2 == 1 {
+				density = 2
+			}
+			var buf []byte
+			for n := rng.Intn(1000); n > 0; n-- {
+				charset := "ghijklmnop "
+				if rng.Intn(density) == 0 {
+					charset = "abcdefABCDEF "
+				}
+				buf = append(buf, rnd(rng.Intn(200), charset)...)
+				buf = append(buf, '\n')
+			}
+			if rng.Intn(2) == 0 {
+				buf = append(buf, rnd(rng.Intn(20), "abcdef ")...)
+			}
+
+			var want []LineRange
+			for start := 0; start < len(buf); {
+				end := bytes.IndexByte(buf[start:], '\n')
+				if end < 0 {
+					end = len(buf)
+				} else {
+					end += start
+				}
+				if boolSearchReference(string(buf[start:end]), expr) {
+					want = append(want, LineRange{start, end})
+				}
+				start = end + 1
+			}
+			got := bs.MatchLines(buf, []LineRange{{-1, -1}})
+			if len(got) != len(want)+1 || got[0] != (LineRange{-1, -1}) {
+				t.Fatalf("%d patterns: %d lines match, want %d", numPatterns, len(got)-1, len(want))
+			}
+			for j, r := range got[1:] {
+				if r != want[j] {
+					t.Fatalf("%d patterns: match %d is %v %q, want %v", numPatterns, j, r, buf[r.Start:r.End], want[j])
+				}
+			}
+		}
+	}
+}
+
+// TestBoolSearchLongPatterns checks patterns around and above the old
+// 255-byte limit, with case variations and single-byte mismatches at every
+// position of the long verification, in both engines.
+func TestBoolSearchLongPatterns(t *testing.T) {
+	rng := rand.New(rand.NewSource(17))
+	filler := []string{"alpha1", "bravo2", "charlie3", "delta4", "echo5", "foxtrot6", "golf7", "hotel8", "india9"}
+
+	for _, n := range []int{9, 15, 16, 17, 31, 40, 41, 72, 255, 256, 300, 1000, 5000} {
+		pattern := randomString(rng, n)
+		for _, fdr := range []bool{false, true} {
+			var expr BoolExpr = Contains(pattern)
+			if fdr {
+				for _, f := range filler {
+					expr = Or(expr, Contains(f))
+				}
+			}
+			bs := MakeBooleanSearch(expr)
+
+			for _, pad := range []int{0, 3, 40} {
+				prefix, suffix := strings.Repeat(".", pad), strings.Repeat("-", 40-pad)
+				check := func(haystack string, want bool) {
+					t.Helper()
+					if got := bs.Match(haystack); got != want {
+						t.Fatalf("len %d fdr=%v: Match = %v, want %v", n, fdr, got, want)
+					}
+					var got, ref uint64
+					if fdr {
+						got, ref = bs.searchFDR(haystack, 0, nil), bs.searchFDRGo(haystack, 0, nil)
+					} else {
+						got, ref = bs.searchTBL(haystack, 0, nil), bs.searchTBLGo(haystack, 0, nil)
+					}
+					if got != ref {
+						t.Fatalf("len %d fdr=%v: engine found %#x, Go found %#x", n, fdr, got, ref)
+					}
+				}
+
+				check(prefix+pattern+suffix, true)
+				check(prefix+strings.ToLower(pattern)+suffix, true)
+				check(prefix+strings.ToUpper(pattern)+suffix, true)
+				check(prefix+pattern[:n-1]+suffix, false)
+				for i := 0; i < n; i += max(1, n/50) {
+					b := []byte(pattern)
+					b[i] = '#'
+					check(prefix+string(b)+suffix, false)
+				}
+				b := []byte(pattern)
+				b[n-1] = '#'
+				check(prefix+string(b)+suffix, false)
+			}
+		}
+	}
+}
+
+// TestBooleanSearchMarshal round-trips searches of every engine through
+// MarshalBinary and LoadBooleanSearch and compares their results.
+func TestBooleanSearchMarshal(t *testing.T) {
+	rng := rand.New(rand.NewSource(18))
+
+	for _, numPatterns := range []int{1, 5, 9, 40, 64, 65, 300} {
+		for i := 0; i < 10; i++ {
+			exprs := make([]BoolExpr, numPatterns)
+			for j := range exprs {
+				// Short patterns expand to many FDR hash entries; keep
+				// FDR searches quick to build
+				minLen := 1
+				if numPatterns > 8 {
+					minLen = 3
+				}
+				text := randomString(rng, rng.Intn(10)+minLen)
+				if j == 0 && i%3 == 0 {
+					text = randomString(rng, 300)
+				}
+				if rng.Intn(2) == 0 {
+					exprs[j] = ContainsCS(text)
+				} else {
+					exprs[j] = Contains(text)
+				}
+			}
+			bs := MakeBooleanSearch(randomTree(rng, exprs))
+
+			blob, err := bs.MarshalBinary()
+			if err != nil {
+				t.Fatal(err)
+			}
+			loaded, err := LoadBooleanSearch(alignedCopy(blob))
+			if err != nil {
+				t.Fatalf("%d patterns: %v", numPatterns, err)
+			}
+
+			for _, n := range []int{0, 5, 100, 2000} {
+				haystack := randomString(rng, n)
+				for k := 0; k < 3 && bs.numPatterns > 0; k++ {
+					p := bs.patterns[rng.Intn(bs.numPatterns)].Text
+					at := rng.Intn(len(haystack) + 1)
+					haystack = haystack[:at] + p + haystack[at:]
+				}
+				if got, want := loaded.Match(haystack), bs.Match(haystack); got != want {
+					t.Fatalf("%d patterns: loaded Match = %v, want %v", numPatterns, got, want)
+				}
+			}
+		}
+	}
+
+	// Large tables and pattern text are used in place
+	var expr BoolExpr = Contains("pattern-00")
+	for i := 1; i < 20; i++ {
+		expr = Or(expr, Contains(fmt.Sprintf("pattern-%02d", i)))
+	}
+	blob, _ := MakeBooleanSearch(expr).MarshalBinary()
+	blob = alignedCopy(blob)
+	loaded, err := LoadBooleanSearch(blob)
+	if err != nil {
+		t.Fatal(err)
+	}
+	inBlob := func(p unsafe.Pointer) bool {
+		start := uintptr(unsafe.Pointer(&blob[0]))
+		return uintptr(p) >= start && uintptr(p) < start+uintptr(len(blob))
+	}
+	if littleEndian && !inBlob(unsafe.Pointer(&loaded.fdr.stateTable[0])) {
+		t.Error("stateTable was copied")
+	}
+	if !inBlob(unsafe.Pointer(unsafe.StringData(loaded.patterns[0].Text))) {
+		t.Error("pattern text was copied")
+	}
+
+	// Truncated or corrupted blobs are rejected without panicking
+	for n := 0; n < len(blob); n += 7 {
+		if _, err := LoadBooleanSearch(blob[:n]); err == nil {
+			t.Fatalf("truncated to %d bytes: expected error", n)
+		}
+	}
+	for i := 0; i < 2000; i++ {
+		bad := alignedCopy(blob)
+		bad[rng.Intn(len(bad))] ^= byte(rng.Intn(255) + 1)
+		if bs, err := LoadBooleanSearch(bad); err == nil {
+			bs.Match(randomString(rng, 100))
+		}
+	}
+
+	// Tables corrupted consistently with each other, such as a verify slot
+	// filled in together with the hash bits that would report it, are
+	// rejected too
+	many := func(n int) BoolExpr {
+		var expr BoolExpr = Contains("pattern-000")
+		for i := 1; i < n; i++ {
+			expr = Or(expr, Contains(fmt.Sprintf("pattern-%03d", i)))
+		}
+		return expr
+	}
+	forge := func(vt *verifyTables, id uint8) {
+		vt.add(id, Pattern{Text: "forged", Length: 6, normText: "FORGED"})
+	}
+	corruptions := []struct {
+		name    string
+		expr    BoolExpr
+		corrupt func(bs *BooleanSearch)
+	}{
+		{"tbl_slot", Or(Contains("abc"), Contains("xyz")), func(bs *BooleanSearch) {
+			forge(&bs.verify, 2)
+			bs.tbl.masksLo['f'&15] &^= 1 << 2
+			bs.tbl.masksHi['f'>>4] &^= 1 << 2
+		}},
+		{"fdr_slot", many(20), func(bs *BooleanSearch) {
+			forge(&bs.verify, 30)
+			for i := range bs.fdr.stateTable {
+				bs.fdr.stateTable[i] &^= 1 << 30
+			}
+		}},
+		{"fdr_group", many(20), func(bs *BooleanSearch) {
+			forge(&bs.verify, 30)
+			bs.fdr.groupMasks[30%8] |= 1 << 30
+		}},
+		{"fdr_stride", many(20), func(bs *BooleanSearch) {
+			bs.fdr.stride = 2
+		}},
+		{"bank_slot", many(70), func(bs *BooleanSearch) {
+			forge(&bs.banks[1].verify, 10)
+			bs.banks[1].all |= 1 << 10
+		}},
+		{"bank_table", many(70), func(bs *BooleanSearch) {
+			for i := range bs.bankTable {
+				bs.bankTable[i] &^= 1 << 2
+			}
+		}},
+		{"verify_text", Or(Contains("abc"), Contains("xyz")), func(bs *BooleanSearch) {
+			forge(&bs.verify, 1)
+			bs.verify.lengths[1] = 3
+		}},
+		{"min_length", Or(Contains("abc"), Contains("xyz")), func(bs *BooleanSearch) {
+			bs.minPatternLen = 0
+		}},
+		{"bank_min_length", many(70), func(bs *BooleanSearch) {
+			bs.minPatternLen = 1000
+		}},
+		{"immediate_true", And(Contains("abc"), Contains("xyz")), func(bs *BooleanSearch) {
+			bs.immediateTrueMask = 1
+		}},
+		{"immediate_false", And(Contains("abc"), Contains("xyz")), func(bs *BooleanSearch) {
+			bs.immediateFalseMask = 3
+		}},
+		{"glob_boundary", Or(Contains("abc"), GlobCI("a?c")), func(bs *BooleanSearch) {
+			bs.anchored()[0].Boundary = &WordBoundary
+		}},
+		{"glob_anchor", Or(Contains("abc"), GlobCI("a?c")), func(bs *BooleanSearch) {
+			bs.anchored()[0].Anchor = AnchorEnd
+		}},
+		{"bank_immediate", many(70), func(bs *BooleanSearch) {
+			bs.immediateFalseSet[1] = bs.banks[1].all
+		}},
+		{"flood_length", Or(Contains("aaa"), Contains("aaaaa")), func(bs *BooleanSearch) {
+			bs.flood['a'].patternIDs = bs.flood['a'].patternIDs[1:]
+			bs.flood['a'].minLength = 3
+		}},
+	}
+	for _, tt := range corruptions {
+		bs := MakeBooleanSearch(tt.expr)
+		tt.corrupt(bs)
+		blob, err := bs.MarshalBinary()
+		if err != nil {
+			t.Fatal(err)
+		}
+		if _, err := LoadBooleanSearch(alignedCopy(blob)); err == nil {
+			t.Errorf("%s: expected error", tt.name)
+		}
+	}
+
+	// Expressions nest up to maxExprDepth; deeper blobs, such as one with a
+	// million more Not bytes, are rejected without recursing through them
+	bs := MakeBooleanSearch(Contains("abc"))
+	var deep BoolExpr = bs.expr
+	for i := 0; i < maxExprDepth-1; i++ {
+		deep = Not(deep)
+	}
+	bs.expr = deep
+	bs.immediateTrueMask, bs.immediateFalseMask = 0, 0
+	bs.computeImmediateMasks()
+	blob, err = bs.MarshalBinary()
+	if err != nil {
+		t.Fatal(err)
+	}
+	if _, err := LoadBooleanSearch(alignedCopy(blob)); err != nil {
+		t.Fatalf("depth %d: %v", maxExprDepth, err)
+	}
+	bs.expr = Not(deep)
+	if _, err := bs.MarshalBinary(); err == nil {
+		t.Errorf("depth %d: expected MarshalBinary error", maxExprDepth+1)
+	}
+	nots := bytes.Repeat([]byte{exprNot}, maxExprDepth-1)
+	at := bytes.Index(blob, nots)
+	bad := append(append(blob[:at:at], bytes.Repeat([]byte{exprNot}, 1<<20)...), blob[at:]...)
+	if _, err := LoadBooleanSearch(alignedCopy(bad)); err == nil {
+		t.Errorf("%d nested Not bytes: expected error", len(nots)+1<<20)
+	}
+}
+
+// TestBoolSearchOptimize checks the expression optimizer: the patterns it
+// keeps, constant folding, and equivalence with the unoptimized expression.
+func TestBoolSearchOptimize(t *testing.T) {
+	patterns := func(bs *BooleanSearch) []string {
+		var out []string
+		for _, p := range bs.Patterns() {
+			out = append(out, p.Text)
+		}
+		return out
+	}
+
+	tests := []struct {
+		name     string
+		expr     BoolExpr
+		patterns []string
+	}{
+		{"or_subsumed", Or(Contains("err"), Contains("error")), []string{"err"}},
+		{"and_subsumed", And(Contains("error"), Contains("err")), []string{"error"}},
+		{"or_duplicate", Or(Contains("err"), Contains("ERR")), []string{"err"}},
+		{"or_flattened", Or(Or(Contains("timeout"), Contains("fatal")), Or(Contains("fatal error"), Contains("time"))), []string{"fatal", "time"}},
+		{"and_not_subsumed", And(Not(Contains("err")), Not(Contains("error"))), []string{"err"}},
+		{"double_not", Not(Not(Contains("abc"))), []string{"abc"}},
+		{"cs_not_subsumed_by_ci", Or(Contains("err"), ContainsCS("Error")), []string{"err"}},
+		{"ci_not_subsumed_by_cs", Or(ContainsCS("err"), Contains("error")), []string{"err", "error"}},
+		{"cs_case_distinct", And(ContainsCS("Err"), Not(ContainsCS("err"))), []string{"Err", "err"}},
+		{"cs_case_distinct_long", And(ContainsCS("Error_Code"), Not(ContainsCS("Error_CODE"))), []string{"Error_Code", "Error_CODE"}},
+		{"cs_no_letters", Or(ContainsCS("404"), Contains("404")), []string{"404"}},
+		{"contradiction", And(Contains("error"), Not(Contains("err"))), nil},
+		{"tautology", Or(Not(Contains("error")), Contains("err")), nil},
+		{"not_tautology", Or(Not(Contains("err")), Contains("error")), []string{"err", "error"}},
+		{"empty_pattern", And(Contains(""), Contains("abc")), []string{"abc"}},
+		{"empty_pattern_only", Not(Contains("")), nil},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			bs := MakeBooleanSearch(tt.expr)
+			if got := patterns(bs); fmt.Sprint(got) != fmt.Sprint(tt.patterns) {
+				t.Fatalf("patterns = %q, want %q", got, tt.patterns)
+			}
+			for _, h := range []string{"", "err", "Err", "ERROR", "an error occurred", "Error 404", "timeout", "fatal error", "Error_Code", "Error_CODE"} {
+				if got, want := bs.Match(h), boolSearchReference(h, tt.expr); got != want {
+					t.Errorf("Match(%q) = %v, want %v", h, got, want)
+				}
+			}
+		})
+	}
+
+	// Case-sensitive patterns that differ in case only past byte 8 stay
+	// apart, in the optimizer and in the engines' long-pattern verification
+	bs := MakeBooleanSearch(And(ContainsCS("Error_Code"), Not(ContainsCS("Error_CODE"))))
+	if !bs.Match("Error_Code") || bs.Match("Error_CODE") || !bs.Match(strings.Repeat(".", 40)+"Error_Code") {
+		t.Errorf("And(ContainsCS(%q), Not(ContainsCS(%q))) matches the wrong case", "Error_Code", "Error_CODE")
+	}
+
+	// Dropping subsumed patterns can move a search from FDR to TBL
+	var expr BoolExpr = Contains("fail")
+	for _, p := range []string{"failed", "failure", "fail2ban", "panic", "panicked", "oom", "oom-killer", "deny", "denylist"} {
+		expr = Or(expr, Contains(p))
+	}
+	if bs := MakeBooleanSearch(expr); bs.useFDR || bs.numPatterns != 4 {
+		t.Errorf("got %d patterns, FDR %v; want 4 patterns with TBL", bs.numPatterns, bs.useFDR)
+	}
+
+	// Random expressions over patterns that often contain one another. Up
+	// to 8 patterns keeps to TBL; FDR tables for short patterns are slow to
+	// build.
+	rng := rand.New(rand.NewSource(19))
+	for i := 0; i < 2000; i++ {
+		exprs := make([]BoolExpr, rng.Intn(8)+1)
+		for j := range exprs {
+			text := randomString(rng, rng.Intn(4))
+			text = strings.Map(func(r rune) rune { return 'a' + r%3 }, text)
+			if rng.Intn(3) == 0 {
+				exprs[j] = ContainsCS(strings.ToUpper(text))
+			} else {
+				exprs[j] = Contains(text)
+			}
+		}
+		expr := randomTree(rng, exprs)
+		bs := MakeBooleanSearch(expr)
+		for k := 0; k < 10; k++ {
+			h := strings.Map(func(r rune) rune { return rune("abcABC"[r%6]) }, randomString(rng, rng.Intn(12)))
+			if got, want := bs.Match(h), boolSearchReference(h, expr); got != want {
+				t.Fatalf("Match(%q) = %v, want %v for %d patterns %q", h, got, want, bs.numPatterns, patterns(bs))
+			}
+		}
+	}
+}
+
+// alignedCopy returns a copy of b that starts on an 8-byte boundary, as an
+// mmapped file would.
+func alignedCopy(b []byte) []byte {
+	words := make([]uint64, (len(b)+7)/8)
+	out := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(words))), len(b))
+	copy(out, b)
+	return out
+}
+
+// TestBoolSearchWholeWord checks whole-word patterns in every engine and in
+// MatchColumn, BooleanStream and the serialized form, against a reference
+// that tries every offset.
+func TestBoolSearchWholeWord(t *testing.T) {
+	tests := []struct {
+		expr     BoolExpr
+		haystack string
+		want     bool
+	}{
+		{ContainsCI("id").WholeWord(WordBoundary), "user ID=7", true},
+		{ContainsCI("id").WholeWord(WordBoundary), "valid ident", false},
+		{ContainsCS("id").WholeWord(WordBoundary), "user ID=7", false},
+		{ContainsCI("id").WholeWord(WordBoundary), "id", true},
+		{And(ContainsCI("id").WholeWord(WordBoundary), ContainsCI("id")), "valid", false},
+		{Or(ContainsCI("id").WholeWord(WordBoundary), Not(ContainsCI("id"))), "valid", false},
+		{ContainsCI("a b").WholeWord(MakeCharSet(",")), "xa b,a b", true},
+		{ContainsCI("a b").WholeWord(MakeCharSet(",")), "xa b a bx", false},
+	}
+	for _, tt := range tests {
+		bs := MakeBooleanSearch(tt.expr)
+		if got := bs.Match(tt.haystack); got != tt.want {
+			t.Errorf("Match(%q) = %v, want %v", tt.haystack, got, tt.want)
+		}
+		long := strings.Repeat("valid ", 20) + tt.haystack
+		if got := bs.Match(long); got != tt.want {
+			t.Errorf("Match(%q) = %v, want %v", long, got, tt.want)
+		}
+	}
+
+	rng := rand.New(rand.NewSource(20))
+	rnd := func(n int, charset string) string {
+		b := make([]byte, n)
+		for i := range b {
+			b[i] = charset[rng.Intn(len(charset))]
+		}
+		return string(b)
+	}
+	boundaries := []CharSet{WordBoundary, MakeCharSet(" ,")}
+
+	for _, numPatterns := range []int{1, 4, 8, 12, 40, 90} {
+		for i := 0; i < 30; i++ {
+			exprs := make([]BoolExpr, numPatterns)
+			for j := range exprs {
+				c := &ContainsExpr{Pattern: rnd(rng.Intn(4)+1, "abc"), CaseSensitive: rng.Intn(3) == 0}
+				if numPatterns > 8 {
+					c.Pattern = rnd(rng.Intn(3)+3, "abcdef")
+				}
+				if rng.Intn(3) != 0 {
+					c.WholeWord(boundaries[rng.Intn(len(boundaries))])
+				}
+				exprs[j] = c
+			}
+			expr := randomTree(rng, exprs)
+			bs := MakeBooleanSearch(expr)
+			blob, err := bs.MarshalBinary()
+			if err != nil {
+				t.Fatal(err)
+			}
+			loaded, err := LoadBooleanSearch(alignedCopy(blob))
+			if err != nil {
+				t.Fatal(err)
+			}
+			s := bs.NewStream()
+
+			var data []byte
+			offsets := []uint32{0}
+			for _, n := range []int{0, 1, 5, 40, 100, 1000} {
+				haystack := rnd(n, "abcdefABC ,-")
+				want := boolSearchReference(haystack, expr)
+				if got := bs.Match(haystack); got != want {
+					t.Fatalf("%d patterns, haystack %q: Match = %v, want %v", numPatterns, haystack, got, want)
+				}
+				if got, _ := bs.MatchDetail(haystack, nil); got != want {
+					t.Fatalf("%d patterns, haystack %q: MatchDetail = %v, want %v", numPatterns, haystack, got, want)
+				}
+				if got := loaded.Match(haystack); got != want {
+					t.Fatalf("%d patterns, haystack %q: loaded Match = %v, want %v", numPatterns, haystack, got, want)
+				}
+
+				s.Reset()
+				for rest := haystack; len(rest) > 0; {
+					k := min(rng.Intn(20)+1, len(rest))
+					s.WriteString(rest[:k])
+					rest = rest[k:]
+					if s.Done() && s.Result() != want {
+						t.Fatalf("%d patterns, haystack %q: Result at Done = %v, want %v", numPatterns, haystack, !want, want)
+					}
+				}
+				if got := s.Result(); got != want {
+					t.Fatalf("%d patterns, haystack %q: stream Result = %v, want %v", numPatterns, haystack, got, want)
+				}
+
+				data = append(data, haystack...)
+				offsets = append(offsets, uint32(len(data)))
+			}
+
+			out := make([]uint64, 1)
+			bs.MatchColumn(data, offsets, out)
+			for r := 0; r+1 < len(offsets); r++ {
+				row := string(data[offsets[r]:offsets[r+1]])
+				if got, want := out[0]&(1<<r) != 0, boolSearchReference(row, expr); got != want {
+					t.Fatalf("%d patterns: row %d %q selected = %v, want %v", numPatterns, r, row, got, want)
+				}
+			}
+		}
+	}
+
+	// Without a free sentinel byte the stream keeps the whole input
+	var all []byte
+	for c := 0; c < 256; c++ {
+		all = append(all, byte(c))
+	}
+	expr := Or(ContainsCS("x").WholeWord(MakeCharSet(string(all[:128]))), ContainsCS("y").WholeWord(MakeCharSet(string(all[128:]))))
+	s := MakeBooleanSearch(expr).NewStream()
+	if s.sentinel != -1 {
+		t.Fatalf("sentinel = %d, want -1", s.sentinel)
+	}
+	for _, haystack := range []string{"a x b", "axb", "\x80x"} {
+		s.Reset()
+		s.WriteString(haystack[:2])
+		s.WriteString(haystack[2:])
+		if got, want := s.Result(), boolSearchReference(haystack, expr); got != want {
+			t.Errorf("stream Result(%q) = %v, want %v", haystack, got, want)
+		}
+	}
+}
+
+func TestBoolSearchAnchored(t *testing.T) {
+	tests := []struct {
+		expr     BoolExpr
+		haystack string
+		want     bool
+	}{
+		{PrefixCI("get "), "GET /index.html", true},
+		{PrefixCI("get "), " GET /index.html", false},
+		{PrefixCS("GET"), "get /", false},
+		{SuffixCS(".html"), "GET /index.html", true},
+		{SuffixCS(".html"), "GET /index.html\n", false},
+		{SuffixCI("x"), "", false},
+		{LinePrefixCS("From:"), "To: a\nFrom: b\n", true},
+		{LinePrefixCS("From:"), "To: a From: b\n", false},
+		{LinePrefixCS("To:"), "To: a\nFrom: b\n", true},
+		{LineSuffixCI("ok"), "a OK\nb fail", true},
+		{LineSuffixCI("ok"), "a fail\nb ok", true},
+		{LineSuffixCI("ok"), "a OK \nb fail", false},
+		{LinePrefixCI("ab").WholeWord(WordBoundary), "x\nabc\nab d", true},
+		{LinePrefixCI("ab").WholeWord(WordBoundary), "x\nabc\nabd", false},
+		{And(PrefixCI("get"), ContainsCI("get")), "x get", false},
+		{And(PrefixCI("get"), Not(ContainsCI("ge"))), "get", false},
+		{Or(PrefixCS("ab"), PrefixCS("abc")), "abd", true},
+		{And(PrefixCS("ab"), Not(PrefixCS("abc"))), "abc", false},
+		{And(PrefixCS("ab"), Not(SuffixCS("ab"))), "ab", false},
+	}
+	for i, tt := range tests {
+		bs := MakeBooleanSearch(tt.expr)
+		if got := bs.Match(tt.haystack); got != tt.want {
+			t.Errorf("case %d: Match(%q) = %v, want %v", i, tt.haystack, got, tt.want)
+		}
+		if got := boolSearchReference(tt.haystack, tt.expr); got != tt.want {
+			t.Errorf("case %d: reference(%q) = %v, want %v", i, tt.haystack, got, tt.want)
+		}
+	}
+
+	// Anchored patterns are not in the engine tables
+	bs := MakeBooleanSearch(And(ContainsCI("abc"), Or(PrefixCI("abc"), LineSuffixCS("def"))))
+	if bs.numPatterns != 3 || bs.numScanned != 1 || bs.Patterns()[0].Anchor != Unanchored {
+		t.Fatalf("numPatterns = %d, numScanned = %d, want 3 and 1 scanned first", bs.numPatterns, bs.numScanned)
+	}
+
+	rng := rand.New(rand.NewSource(21))
+	rnd := func(n int, charset string) string {
+		b := make([]byte, n)
+		for i := range b {
+			b[i] = charset[rng.Intn(len(charset))]
+		}
+		return string(b)
+	}
+
+	for _, numPatterns := range []int{1, 4, 8, 12, 40, 90} {
+		for i := 0; i < 30; i++ {
+			exprs := make([]BoolExpr, numPatterns)
+			for j := range exprs {
+				c := &ContainsExpr{Pattern: rnd(rng.Intn(3)+1, "abc"), CaseSensitive: rng.Intn(3) == 0}
+				if numPatterns > 8 {
+					c.Pattern = rnd(rng.Intn(3)+2, "abcd")
+				}
+				if rng.Intn(4) != 0 {
+					c.Anchor = Anchor(rng.Intn(4) + 1)
+				}
+				if rng.Intn(4) == 0 {
+					c.WholeWord(WordBoundary)
+				}
+				exprs[j] = c
+			}
+			expr := randomTree(rng, exprs)
+			bs := MakeBooleanSearch(expr)
+			blob, err := bs.MarshalBinary()
+			if err != nil {
+				t.Fatal(err)
+			}
+			loaded, err := LoadBooleanSearch(alignedCopy(blob))
+			if err != nil {
+				t.Fatal(err)
+			}
+			s := bs.NewStream()
+
+			var data []byte
+			offsets := []uint32{0}
+			for _, n := range []int{0, 1, 3, 8, 40, 100, 1000} {
+				haystack := rnd(n, "abcdAB\n\n ")
+				want := boolSearchReference(haystack, expr)
+				if got := bs.Match(haystack); got != want {
+					t.Fatalf("%d patterns, haystack %q: Match = %v, want %v", numPatterns, haystack, got, want)
+				}
+				if got, _ := bs.MatchDetail(haystack, nil); got != want {
+					t.Fatalf("%d patterns, haystack %q: MatchDetail = %v, want %v", numPatterns, haystack, got, want)
+				}
+				if got := loaded.Match(haystack); got != want {
+					t.Fatalf("%d patterns, haystack %q: loaded Match = %v, want %v", numPatterns, haystack, got, want)
+				}
+
+				s.Reset()
+				for rest := haystack; len(rest) > 0; {
+					k := min(rng.Intn(20)+1, len(rest))
+					s.WriteString(rest[:k])
+					rest = rest[k:]
+					if s.Done() && s.Result() != want {
+						t.Fatalf("%d patterns, haystack %q: Result at Done = %v, want %v", numPatterns, haystack, !want, want)
+					}
+				}
+				if got := s.Result(); got != want {
+					t.Fatalf("%d patterns, haystack %q: stream Result = %v, want %v", numPatterns, haystack, got, want)
+				}
+
+				data = append(data, haystack...)
+				offsets = append(offsets, uint32(len(data)))
+			}
+
+			out := make([]uint64, 1)
+			bs.MatchColumn(data, offsets, out)
+			for r := 0; r+1 < len(offsets); r++ {
+				row := string(data[offsets[r]:offsets[r+1]])
+				if got, want := out[0]&(1<<r) != 0, boolSearchReference(row, expr); got != want {
+					t.Fatalf("%d patterns: row %d %q selected = %v, want %v", numPatterns, r, row, got, want)
+				}
+			}
+		}
+	}
+
+	// Offsets of anchored patterns
+	var offs [64]int
+	bs = MakeBooleanSearch(And(LinePrefixCS("b"), SuffixCS("c")))
+	if ok, found := bs.MatchDetail("a\nb\nc", &offs); !ok || found != 3 || offs[0] != 2 || offs[1] != 4 {
+		t.Errorf("MatchDetail = %v, %b, offsets %v, want true, 11, [2 4]", ok, found, offs[:2])
+	}
+}
+
+func BenchmarkBoolSearchAnchored(b *testing.B) {
+	var sb strings.Builder
+	for i := 0; sb.Len() < 64<<10; i++ {
+		fmt.Fprintf(&sb, "2024-01-%02d 12:00:%02d INFO request id=%d served in %dms\n", i%28+1, i%60, i, i%300)
+	}
+	haystack := sb.String()
+	for _, bc := range []struct {
+		name string
+		expr BoolExpr
+	}{
+		{"Contains", Or(ContainsCS("\nERROR"), ContainsCS("\nFATAL"))},
+		{"LinePrefix", Or(LinePrefixCS("ERROR"), LinePrefixCS("FATAL"))},
+		{"Prefix", Or(PrefixCS("ERROR"), PrefixCS("FATAL"))},
+	} {
+		bs := MakeBooleanSearch(bc.expr)
+		b.Run(bc.name, func(b *testing.B) {
+			b.SetBytes(int64(len(haystack)))
+			for i := 0; i < b.N; i++ {
+				bs.Match(haystack)
+			}
+		})
+	}
+}
+
+func TestBoolSearchGlob(t *testing.T) {
+	tests := []struct {
+		expr     BoolExpr
+		haystack string
+		want     bool
+	}{
+		{GlobCI("get /api/*?id=??"), "GET /api/users?id=42 HTTP/1.1", true},
+		{GlobCI("get /api/*?id=??"), "GET /api/users?id=4", false},
+		{GlobCS("a?c"), "xAbC abc", true},
+		{GlobCS("a?c"), "xAbC", false},
+		{GlobCI("err*timeout"), "error: upstream timeout", true},
+		{GlobCI("err*timeout"), "timeout after error", false},
+		{And(GlobCI("a*b"), Not(ContainsCI("a*b"))), "axb", true},
+		{And(GlobCI("a*b"), Not(GlobCI("a*b"))), "axb", false},
+		{Or(GlobCI("a?b"), Not(GlobCS("a?b"))), "aXb", true},
+	}
+	for i, tt := range tests {
+		bs := MakeBooleanSearch(tt.expr)
+		if got := bs.Match(tt.haystack); got != tt.want {
+			t.Errorf("case %d: Match(%q) = %v, want %v", i, tt.haystack, got, tt.want)
+		}
+	}
+
+	// Glob patterns cannot be whole-word or anchored
+	for i, expr := range []BoolExpr{
+		Or(ContainsCI("x"), GlobCI("ab").WholeWord(WordBoundary)),
+		&ContainsExpr{Pattern: "a*b", Glob: true, Anchor: AnchorLineStart},
+	} {
+		func() {
+			defer func() {
+				if recover() == nil {
+					t.Errorf("case %d: MakeBooleanSearch did not panic", i)
+				}
+			}()
+			MakeBooleanSearch(expr)
+		}()
+	}
+
+	var offs [64]int
+	bs := MakeBooleanSearch(And(ContainsCI("x"), GlobCI("b?d")))
+	if ok, found := bs.MatchDetail("abcdx", &offs); !ok || found != 3 || offs[bs.numScanned] != 1 {
+		t.Errorf("MatchDetail = %v, %b, offsets %v, want true, 11, glob at 1", ok, found, offs[:2])
+	}
+
+	rng := rand.New(rand.NewSource(24))
+	rnd := func(n int, charset string) string {
+		b := make([]byte, n)
+		for i := range b {
+			b[i] = charset[rng.Intn(len(charset))]
+		}
+		return string(b)
+	}
+	for _, numPatterns := range []int{1, 4, 12, 90} {
+		for i := 0; i < 30; i++ {
+			exprs := make([]BoolExpr, numPatterns)
+			for j := range exprs {
+				c := &ContainsExpr{Pattern: rnd(rng.Intn(4)+2, "abcd"), CaseSensitive: rng.Intn(3) == 0}
+				if rng.Intn(2) == 0 {
+					c.Pattern, c.Glob = rnd(rng.Intn(5)+2, "abcd??*"), true
+				}
+				exprs[j] = c
+			}
+			expr := randomTree(rng, exprs)
+			bs := MakeBooleanSearch(expr)
+			blob, err := bs.MarshalBinary()
+			if err != nil {
+				t.Fatal(err)
+			}
+			loaded, err := LoadBooleanSearch(alignedCopy(blob))
+			if err != nil {
+				t.Fatal(err)
+			}
+			s := bs.NewStream()
+
+			var buf []byte
+			for _, n := range []int{0, 1, 3, 8, 40, 100, 1000} {
+				haystack := rnd(n, "abcdAB ")
+				want := boolSearchReference(haystack, expr)
+				if got := bs.Match(haystack); got != want {
+					t.Fatalf("%d patterns, haystack %q: Match = %v, want %v", numPatterns, haystack, got, want)
+				}
+				if got, _ := bs.MatchDetail(haystack, nil); got != want {
+					t.Fatalf("%d patterns, haystack %q: MatchDetail = %v, want %v", numPatterns, haystack, got, want)
+				}
+				if got := loaded.Match(haystack); got != want {
+					t.Fatalf("%d patterns, haystack %q: loaded Match = %v, want %v", numPatterns, haystack, got, want)
+				}
+
+				s.Reset()
+				for rest := haystack; len(rest) > 0; {
+					k := min(rng.Intn(20)+1, len(rest))
+					s.WriteString(rest[:k])
+					rest = rest[k:]
+				}
+				if got := s.Result(); got != want {
+					t.Fatalf("%d patterns, haystack %q: stream Result = %v, want %v", numPatterns, haystack, got, want)
+				}
+
+				buf = append(append(buf, haystack...), '\n')
+			}
+
+			lines := bs.MatchLines(buf, nil)
+			for start, r := 0, 0; start < len(buf); {
+				end := start + bytes.IndexByte(buf[start:], '\n')
+				if want := boolSearchReference(string(buf[start:end]), expr); want != (r < len(lines) && lines[r].Start == start) {
+					t.Fatalf("%d patterns: line %q selected = %v, want %v", numPatterns, buf[start:end], !want, want)
+				} else if want {
+					r++
+				}
+				start = end + 1
+			}
+		}
+	}
+}
+
+func BenchmarkBoolSearchGlob(b *testing.B) {
+	var sb strings.Builder
+	for i := 0; sb.Len() < 64<<10; i++ {
+		fmt.Fprintf(&sb, "2024-01-01 12:00:%02d GET /api/v1/users/%d?page=%d 200\n", i%60, i, i%10)
+	}
+	haystack := sb.String()
+	expr := Or(GlobCI("post /api/*/admin"), GlobCI("/users/??? 5??"))
+	bs := MakeBooleanSearch(expr)
+	re := regexp.MustCompile(`(?is)post /api/.*?/admin|/users/... 5..`)
+
+	b.Run("Regexp", func(b *testing.B) {
+		b.SetBytes(int64(len(haystack)))
+		for i := 0; i < b.N; i++ {
+			re.MatchString(haystack)
+		}
+	})
+	b.Run("BooleanSearch", func(b *testing.B) {
+		b.SetBytes(int64(len(haystack)))
+		for i := 0; i < b.N; i++ {
+			bs.Match(haystack)
+		}
+	})
+}
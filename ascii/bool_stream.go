@@ -0,0 +1,282 @@
+package ascii
+
+import "unsafe"
+
+// BooleanStream evaluates a BooleanSearch over input that arrives in
+// chunks, such as a record read from disk or the network in pieces. It
+// carries the found patterns and the last maxPatternLen-1 bytes between
+// chunks, so matches that straddle a chunk boundary are found without
+// copying the record into one buffer.
+//
+// Whole-word patterns need the bytes on both sides of a match, so searches
+// with them copy each chunk into a frame together with the carried bytes:
+// the frame is closed by a sentinel byte that is neither a boundary nor the
+// first or last byte of any pattern, which keeps matches at its edges from
+// counting until the bytes around them are known. If every byte value is
+// taken, the stream keeps the whole input and scans it in Result. So do
+// searches with glob patterns, as a '*' may span any number of chunks.
+//
+// Line-anchored patterns are checked around the newlines of each chunk and
+// of the carried bytes. Patterns anchored to the record edges are checked in
+// Result against the first and last bytes written, so they never end the
+// stream early.
+//
+// A BooleanStream is not safe for concurrent use.
+type BooleanStream struct {
+	bs    *BooleanSearch
+	keep  int    // bytes carried between chunks: longest pattern - 1
+	tail  []byte // last keep bytes written so far
+	join  []byte // scratch for tail + head of the next chunk
+	found uint64 // found patterns (searches with up to 64 patterns)
+	set   []uint64
+	done  bool
+
+	// Anchored patterns: the first keep bytes of the input
+	anchors bool
+	head    []byte
+
+	// Whole-word and glob patterns (see above)
+	words    bool
+	sentinel int    // frame sentinel, or -1 to keep the whole input
+	frame    []byte // scratch frame, or the whole input
+	final    []uint64
+	written  int // bytes written, capped at keep+1
+}
+
+// NewStream returns a BooleanStream for the search.
+func (bs *BooleanSearch) NewStream() *BooleanStream {
+	maxLen := 0
+	for _, p := range bs.patterns {
+		maxLen = max(maxLen, p.Length)
+	}
+	s := &BooleanStream{bs: bs}
+	if bs.hasGlobs() {
+		s.words, s.sentinel = true, -1
+	} else if bs.hasWholeWords() {
+		s.words, s.sentinel = true, frameSentinel(bs.patterns)
+		// Carry a whole pattern ending just before the chunk, and the byte
+		// before it
+		maxLen += 2
+	}
+	if bs.numScanned < bs.numPatterns {
+		// A line-anchored pattern is matched together with its newline
+		s.anchors = true
+		maxLen++
+	}
+	if maxLen > 1 {
+		s.keep = maxLen - 1
+		s.tail = make([]byte, 0, s.keep)
+		s.join = make([]byte, 0, 2*s.keep)
+	}
+	if s.anchors {
+		s.head = make([]byte, 0, s.keep)
+	}
+	if bs.banks != nil {
+		s.set = make([]uint64, len(bs.banks))
+	}
+	s.done = bs.numPatterns == 0
+	return s
+}
+
+// Write scans the next chunk of the stream. Once the result is decided
+// (see Done) further chunks are ignored. It always returns len(chunk), nil.
+func (s *BooleanStream) Write(chunk []byte) (int, error) {
+	if s.done || len(chunk) == 0 {
+		return len(chunk), nil
+	}
+	if s.anchors && len(s.head) < s.keep {
+		s.head = append(s.head, chunk[:min(len(chunk), s.keep-len(s.head))]...)
+	}
+	if s.words {
+		s.writeFrame(chunk)
+		return len(chunk), nil
+	}
+
+	// A match across the boundary starts in the tail and ends within the
+	// first keep bytes of the chunk.
+	if len(s.tail) > 0 {
+		s.join = append(append(s.join[:0], s.tail...), chunk[:min(s.keep, len(chunk))]...)
+		s.scan(s.join)
+	}
+	if !s.done {
+		s.scan(chunk)
+	}
+
+	s.keepTail(chunk)
+	return len(chunk), nil
+}
+
+// writeFrame scans chunk in a frame for searches with whole-word patterns.
+func (s *BooleanStream) writeFrame(chunk []byte) {
+	if s.sentinel < 0 {
+		s.frame = append(s.frame, chunk...)
+		return
+	}
+	s.frame = append(append(s.startFrame(), chunk...), byte(s.sentinel))
+	s.scan(s.frame)
+	s.keepTail(chunk)
+	s.written = min(s.written+len(chunk), s.keep+1)
+}
+
+// startFrame starts a frame in s.frame with the carried bytes, preceded by
+// the sentinel unless they are the start of the input.
+func (s *BooleanStream) startFrame() []byte {
+	s.frame = s.frame[:0]
+	if s.written > len(s.tail) {
+		s.frame = append(s.frame, byte(s.sentinel))
+	}
+	return append(s.frame, s.tail...)
+}
+
+// keepTail updates the carried bytes after chunk was written.
+func (s *BooleanStream) keepTail(chunk []byte) {
+	if s.keep > 0 {
+		if len(chunk) >= s.keep {
+			s.tail = append(s.tail[:0], chunk[len(chunk)-s.keep:]...)
+		} else {
+			s.tail = append(s.tail, chunk...)
+			if drop := len(s.tail) - s.keep; drop > 0 {
+				s.tail = s.tail[:copy(s.tail, s.tail[drop:])]
+			}
+		}
+	}
+}
+
+// frameSentinel returns a byte that no pattern starts or ends with and that
+// is not a boundary of any whole-word pattern or a newline, or -1 if there
+// is none.
+func frameSentinel(patterns []Pattern) int {
+	var used CharSet
+	used.bitset['\n'>>6] |= 1 << ('\n' & 63)
+	for _, p := range patterns {
+		if p.Length > 0 {
+			for _, c := range [2]byte{p.normText[0], p.normText[p.Length-1]} {
+				used.bitset[c>>6] |= 1 << (c & 63)
+				c = toLower(c)
+				used.bitset[c>>6] |= 1 << (c & 63)
+			}
+		}
+		if p.Boundary != nil {
+			for i, x := range p.Boundary.bitset {
+				used.bitset[i] |= x
+			}
+		}
+	}
+	for c := 0; c < 256; c++ {
+		if !used.Contains(byte(c)) {
+			return c
+		}
+	}
+	return -1
+}
+
+// WriteString is Write for a string chunk.
+func (s *BooleanStream) WriteString(chunk string) (int, error) {
+	return s.Write(unsafe.Slice(unsafe.StringData(chunk), len(chunk)))
+}
+
+// scan runs the search engine over b, accumulating found patterns.
+func (s *BooleanStream) scan(b []byte) {
+	s.found, s.done = s.search(b, s.found, s.set)
+}
+
+// search runs the search engine over b, adding the patterns it finds to
+// found, or to set for banked searches. It reports whether the result is
+// decided.
+func (s *BooleanStream) search(b []byte, found uint64, set []uint64) (uint64, bool) {
+	bs := s.bs
+	haystack := bytesToString(b)
+
+	if set != nil {
+		if s.anchors {
+			bs.anchorsAtNewlines(haystack, set, nil)
+			bs.findGlobs(haystack, set, nil)
+		}
+		bs.searchBanks(haystack, set, nil)
+		done := true
+		for i := range bs.banks {
+			if set[i]&(bs.immediateTrueSet[i]|bs.immediateFalseSet[i]) != 0 {
+				return found, true
+			}
+			all := ^uint64(0)
+			if i == len(bs.banks)-1 && bs.numPatterns%64 != 0 {
+				all = 1<<(bs.numPatterns%64) - 1
+			}
+			done = done && set[i] == all
+		}
+		return found, done
+	}
+
+	if s.anchors {
+		f := [1]uint64{found}
+		bs.anchorsAtNewlines(haystack, f[:], nil)
+		bs.findGlobs(haystack, f[:], nil)
+		found = f[0]
+	}
+	switch {
+	case bs.numScanned == 0:
+	case bs.useFDR:
+		found = bs.searchFDR(haystack, found, nil)
+	default:
+		found = bs.searchTBL(haystack, found, nil)
+	}
+	allPatterns := uint64(1)<<bs.numPatterns - 1
+	return found, bs.checkEarlyTermination(found) || found == allPatterns
+}
+
+// Done reports whether the result is decided, either because a pattern
+// that alone determines the expression was found or because every pattern
+// was. The caller may stop feeding chunks at that point.
+func (s *BooleanStream) Done() bool {
+	return s.done
+}
+
+// Result reports whether the input written so far matches the expression.
+func (s *BooleanStream) Result() bool {
+	found, set := s.found, s.set
+	if s.words && !s.done || s.anchors {
+		// Whole words and anchored patterns that end the input so far. They
+		// are not added to the stream's state: more input may still follow
+		// them.
+		if set != nil {
+			s.final = append(s.final[:0], set...)
+			set = s.final
+		}
+	}
+	if s.words && !s.done {
+		if s.sentinel < 0 {
+			found, _ = s.search(s.frame, found, set)
+		} else if len(s.tail) > 0 {
+			found, _ = s.search(s.startFrame(), found, set)
+		}
+	}
+	if s.anchors {
+		last := s.tail
+		if s.words && s.sentinel < 0 {
+			last = s.frame
+		}
+		one := [1]uint64{found}
+		f := set
+		if f == nil {
+			f = one[:]
+		}
+		s.bs.anchorsAtStart(bytesToString(s.head), f, nil)
+		s.bs.anchorsAtEnd(bytesToString(last), f, nil)
+		found = one[0]
+	}
+	if set != nil {
+		return s.bs.expr.evaluateSet(set, true) == TRUE
+	}
+	return s.bs.expr.Evaluate(found, true) == TRUE
+}
+
+// Reset clears the stream so it can be reused for a new record.
+func (s *BooleanStream) Reset() {
+	s.tail = s.tail[:0]
+	s.head = s.head[:0]
+	s.frame = s.frame[:0]
+	s.written = 0
+	s.found = 0
+	clear(s.set)
+	s.done = s.bs.numPatterns == 0
+}
@@ -373,4 +373,837 @@ int64_t index_mask_avx(unsigned char *data, uint64_t length, uint8_t mask)
     }
 
     return -1;
-}
\ No newline at end of file
+}
+
+// =============================================================================
+// Adaptive rare-byte IndexFold (AVX2 port of the NEON INDEX_IMPL design)
+// =============================================================================
+// 1. Rare byte filtering with optional case-folding (OR 0x20)
+// 2. Adaptive switch to 2-byte mode after too many false positives
+// 3. Rabin-Karp fallback when the 2-byte filter keeps failing too
+// 4. Tiered loops (128-byte, 32-byte, masked tail); VPMOVMSKB gives the
+//    candidate bitmask directly, so no syndrome packing is needed
+// 5. Vectorized verification with tail masking
+
+// Tail masks for verifying the final 1-31 bytes: load from (32 - len) to get
+// a vector whose first len bytes are 0xFF.
+static const uint8_t tail_mask_table[64] __attribute__((aligned(32))) = {
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+// A 32-byte load from p can run past the end of the buffer, but it is safe
+// as long as it does not cross into the next (possibly unmapped) page.
+static inline bool load32_safe(const unsigned char *p)
+{
+    return ((uintptr_t)p & 4095) <= 4096 - 32;
+}
+
+// Case-fold a byte to uppercase, same mapping as the NEON fold_table
+static inline uint8_t fold_upper(uint8_t c)
+{
+    return (uint8_t)(c - 'a') < 26 ? c - 0x20 : c;
+}
+
+// Case-fold a byte to lowercase, matching the normalizeASCII pattern
+static inline uint8_t fold_lower(uint8_t c)
+{
+    return (uint8_t)(c - 'A') < 26 ? c + 0x20 : c;
+}
+
+static inline uint8_t no_fold(uint8_t c)
+{
+    return c;
+}
+
+// Returns non-zero bytes where a and b differ other than by ASCII letter case.
+// Same arithmetic as equal_fold_vec: (a|0x20) + 0x1f maps 'a'-'z' to 0x80-0x99.
+static inline __m256i fold_mismatch_vec(__m256i va, __m256i vb)
+{
+    const __m256i v_0x20 = _mm256_set1_epi8(0x20);
+    __m256i diff = _mm256_xor_si256(va, vb);
+    __m256i is_case_diff = _mm256_cmpeq_epi8(diff, v_0x20);
+    __m256i tmp = _mm256_add_epi8(_mm256_or_si256(va, v_0x20), _mm256_set1_epi8(0x1f));
+    __m256i is_alpha = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)0x9a), tmp);
+    __m256i case_mask = _mm256_and_si256(_mm256_and_si256(is_case_diff, is_alpha), v_0x20);
+    return _mm256_xor_si256(diff, case_mask);
+}
+
+// Returns non-zero bytes where lowercase(a) differs from the already
+// lowercase b. a + 0x3f maps 'A'-'Z' to 0x80-0x99.
+static inline __m256i norm_mismatch_vec(__m256i va, __m256i vb)
+{
+    __m256i tmp = _mm256_add_epi8(va, _mm256_set1_epi8(0x3f));
+    __m256i is_upper = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)0x9a), tmp);
+    __m256i lower = _mm256_or_si256(va, _mm256_and_si256(is_upper, _mm256_set1_epi8(0x20)));
+    return _mm256_xor_si256(lower, vb);
+}
+
+static inline __m256i exact_mismatch_vec(__m256i va, __m256i vb)
+{
+    return _mm256_xor_si256(va, vb);
+}
+
+static inline bool equal_norm_scalar(const uint8_t *a, const uint8_t *b, int64_t len)
+{
+    for (int64_t i = 0; i < len; i++) {
+        if (fold_lower(a[i]) != b[i]) return false;
+    }
+    return true;
+}
+
+static inline bool equal_exact_scalar(const uint8_t *a, const uint8_t *b, int64_t len)
+{
+    for (int64_t i = 0; i < len; i++) {
+        if (a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+// EQUAL_IMPL generates a candidate verifier from a per-vector mismatch function.
+// Needles of 32+ bytes use full vectors plus one overlapped vector for the
+// final 1-31 bytes; shorter needles use a single masked vector unless that
+// load would cross into the next page.
+#define EQUAL_IMPL(func_name, MISMATCH_VEC, SCALAR_FN)                          \
+static inline bool func_name(const unsigned char *a, const unsigned char *b,     \
+                             int64_t len)                                        \
+{                                                                                \
+    if (len >= 32) {                                                             \
+        const unsigned char *a_last = a + len - 32;                              \
+        const unsigned char *b_last = b + len - 32;                              \
+        for (; a < a_last; a += 32, b += 32) {                                   \
+            __m256i va = _mm256_loadu_si256((const __m256i *)a);                 \
+            __m256i vb = _mm256_loadu_si256((const __m256i *)b);                 \
+            __m256i mis = MISMATCH_VEC(va, vb);                                  \
+            if (!_mm256_testz_si256(mis, mis)) return false;                     \
+        }                                                                        \
+        __m256i va = _mm256_loadu_si256((const __m256i *)a_last);                \
+        __m256i vb = _mm256_loadu_si256((const __m256i *)b_last);                \
+        __m256i mis = MISMATCH_VEC(va, vb);                                      \
+        return _mm256_testz_si256(mis, mis);                                     \
+    }                                                                            \
+                                                                                 \
+    if (load32_safe(a) && load32_safe(b)) {                                      \
+        __m256i mask = _mm256_loadu_si256((const __m256i *)(tail_mask_table + 32 - len)); \
+        __m256i va = _mm256_loadu_si256((const __m256i *)a);                     \
+        __m256i vb = _mm256_loadu_si256((const __m256i *)b);                     \
+        __m256i mis = MISMATCH_VEC(va, vb);                                      \
+        return _mm256_testz_si256(mis, mask);                                    \
+    }                                                                            \
+                                                                                 \
+    return SCALAR_FN(a, b, len);                                                 \
+}
+
+// Compare haystack against un-normalized needle (IndexFold)
+EQUAL_IMPL(equal_fold_both, fold_mismatch_vec, equal_fold_scalar)
+// Compare haystack against lowercase needle (Searcher.Index, case-insensitive)
+EQUAL_IMPL(equal_fold_normalized, norm_mismatch_vec, equal_norm_scalar)
+// Exact comparison (Searcher.Index, case-sensitive)
+EQUAL_IMPL(equal_exact, exact_mismatch_vec, equal_exact_scalar)
+
+// =============================================================================
+// Rabin-Karp fallback for pathological inputs (same hash as the NEON kernels)
+// =============================================================================
+
+#define PRIME_RK 16777619
+
+// Compute B^n mod 2^32 using repeated squaring
+static inline uint32_t pow_prime(uint64_t n)
+{
+    uint32_t result = 1;
+    uint32_t base = PRIME_RK;
+    while (n > 0) {
+        if (n & 1) result *= base;
+        base *= base;
+        n >>= 1;
+    }
+    return result;
+}
+
+// RABIN_KARP_IMPL generates a rolling-hash search.
+// HAY_FOLD folds haystack bytes, NEEDLE_FOLD folds needle bytes.
+#define RABIN_KARP_IMPL(func_name, HAY_FOLD, NEEDLE_FOLD, VERIFY_FN)             \
+__attribute__((always_inline)) static inline int64_t func_name(                  \
+    const unsigned char *haystack, int64_t haystack_len,                         \
+    const unsigned char *needle, int64_t needle_len)                             \
+{                                                                                \
+    if (needle_len <= 0) return 0;                                               \
+    if (haystack_len < needle_len) return -1;                                    \
+                                                                                 \
+    const int64_t search_len = haystack_len - needle_len + 1;                    \
+    const uint32_t antisigma = 0u - pow_prime(needle_len);                       \
+                                                                                 \
+    uint32_t target = 0, h = 0;                                                  \
+    for (int64_t i = 0; i < needle_len; i++) {                                   \
+        target = target * PRIME_RK + NEEDLE_FOLD(needle[i]);                     \
+        h = h * PRIME_RK + HAY_FOLD(haystack[i]);                                \
+    }                                                                            \
+                                                                                 \
+    for (int64_t i = 0;; i++) {                                                  \
+        if (h == target && VERIFY_FN(haystack + i, needle, needle_len)) {        \
+            return i;                                                            \
+        }                                                                        \
+        if (i + 1 >= search_len) break;                                          \
+        h = h * PRIME_RK + HAY_FOLD(haystack[i + needle_len])                    \
+            + antisigma * HAY_FOLD(haystack[i]);                                 \
+    }                                                                            \
+    return -1;                                                                   \
+}
+
+RABIN_KARP_IMPL(index_fold_rabin_karp_impl, fold_upper, fold_upper, equal_fold_both)
+RABIN_KARP_IMPL(index_exact_rabin_karp_impl, no_fold, no_fold, equal_exact)
+RABIN_KARP_IMPL(index_prefolded_rabin_karp_impl, fold_lower, no_fold, equal_fold_normalized)
+
+// RABIN_KARP_LAST_IMPL is RABIN_KARP_IMPL walking from the end of the haystack.
+#define RABIN_KARP_LAST_IMPL(func_name, HAY_FOLD, NEEDLE_FOLD, VERIFY_FN)        \
+__attribute__((always_inline)) static inline int64_t func_name(                  \
+    const unsigned char *haystack, int64_t haystack_len,                         \
+    const unsigned char *needle, int64_t needle_len)                             \
+{                                                                                \
+    if (needle_len <= 0) return haystack_len;                                    \
+    if (haystack_len < needle_len) return -1;                                    \
+                                                                                 \
+    const int64_t last = haystack_len - needle_len;                              \
+    const uint32_t sigma = pow_prime(needle_len);                                \
+                                                                                 \
+    /* Byte k of the window is weighted by B^k, so sliding left is h*B + new */  \
+    uint32_t target = 0, h = 0;                                                  \
+    for (int64_t i = needle_len - 1; i >= 0; i--) {                              \
+        target = target * PRIME_RK + NEEDLE_FOLD(needle[i]);                     \
+        h = h * PRIME_RK + HAY_FOLD(haystack[last + i]);                         \
+    }                                                                            \
+                                                                                 \
+    for (int64_t i = last;; i--) {                                               \
+        if (h == target && VERIFY_FN(haystack + i, needle, needle_len)) {        \
+            return i;                                                            \
+        }                                                                        \
+        if (i == 0) break;                                                       \
+        h = h * PRIME_RK + HAY_FOLD(haystack[i - 1])                             \
+            - sigma * HAY_FOLD(haystack[i - 1 + needle_len]);                    \
+    }                                                                            \
+    return -1;                                                                   \
+}
+
+RABIN_KARP_LAST_IMPL(last_index_fold_rabin_karp_impl, fold_upper, fold_upper, equal_fold_both)
+RABIN_KARP_LAST_IMPL(last_index_exact_rabin_karp_impl, no_fold, no_fold, equal_exact)
+RABIN_KARP_LAST_IMPL(last_index_prefolded_rabin_karp_impl, fold_lower, no_fold, equal_fold_normalized)
+
+// gocc: indexFoldRabinKarpAvx(haystack string, needle string) int
+int64_t index_fold_rabin_karp_avx2(unsigned char *haystack, int64_t haystack_len,
+                                   unsigned char *needle, int64_t needle_len)
+{
+    return index_fold_rabin_karp_impl(haystack, haystack_len, needle, needle_len);
+}
+
+// gocc: indexExactRabinKarpAvx(haystack string, needle string) int
+int64_t index_exact_rabin_karp_avx2(unsigned char *haystack, int64_t haystack_len,
+                                    unsigned char *needle, int64_t needle_len)
+{
+    return index_exact_rabin_karp_impl(haystack, haystack_len, needle, needle_len);
+}
+
+// gocc: indexPrefoldedRabinKarpAvx(haystack string, needle string) int
+int64_t index_prefolded_rabin_karp_avx2(unsigned char *haystack, int64_t haystack_len,
+                                        unsigned char *needle, int64_t needle_len)
+{
+    return index_prefolded_rabin_karp_impl(haystack, haystack_len, needle, needle_len);
+}
+
+// =============================================================================
+// INDEX_IMPL: adaptive rare-byte search
+// =============================================================================
+// FILTER_FOLD: 0 = exact matching, 1 = case-folding with OR 0x20
+// VERIFY_FN: verification function (equal_fold_both, ...)
+// RK_IMPL: Rabin-Karp fallback once the 2-byte filter stops paying off
+//
+// Positions are tracked relative to the haystack start; the rare1 byte of the
+// candidate at position pos lives at haystack[pos + off1]. Loop bounds on
+// search_len keep every load in bounds, so only the tail needs masking.
+// Each mode has a single verification site to keep the generated code small.
+
+// Candidate bitmask for the 32 positions at p: bit i is set if (p[i] | mask) == target
+static inline uint32_t match_mask32(const unsigned char *p, __m256i v_mask, __m256i v_target)
+{
+    __m256i d = _mm256_loadu_si256((const __m256i *)p);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_or_si256(d, v_mask), v_target));
+}
+
+// Same as match_mask32 for the final n < 32 positions, without reading
+// across a page boundary past the end of the haystack.
+static inline uint32_t match_mask_tail(const unsigned char *p, int64_t n,
+                                       uint8_t mask, uint8_t target,
+                                       __m256i v_mask, __m256i v_target)
+{
+    uint32_t bits = 0;
+    if (load32_safe(p)) {
+        bits = match_mask32(p, v_mask, v_target);
+    } else {
+        for (int64_t i = 0; i < n; i++) {
+            if ((uint8_t)(p[i] | mask) == target) bits |= 1U << i;
+        }
+    }
+    return bits & (uint32_t)((1ULL << n) - 1);
+}
+
+// Bit c of the 256-bit set is set if byte c is a word boundary.
+__attribute__((always_inline)) static inline bool is_boundary(const uint64_t *boundary, uint8_t c)
+{
+    return (boundary[c >> 6] >> (c & 63)) & 1;
+}
+
+// A match at cand is a whole word if the bytes on either side of it are
+// boundaries; the ends of the haystack count as boundaries.
+__attribute__((always_inline)) static inline bool word_at(
+    const unsigned char *haystack, int64_t haystack_len,
+    int64_t cand, int64_t needle_len, const uint64_t *boundary)
+{
+    return (cand == 0 || is_boundary(boundary, haystack[cand - 1])) &&
+           (cand + needle_len == haystack_len ||
+            is_boundary(boundary, haystack[cand + needle_len]));
+}
+
+// MODE_FIRST returns the first match offset or -1. MODE_ALL writes up to
+// out_cap non-overlapping match offsets to out and MODE_COUNT only counts
+// them; both return the number of matches. With WORD set, matches that are
+// not whole words (see word_at) are skipped without counting as filter
+// failures, so they do not push the search out of the SIMD loops.
+#define MODE_FIRST 0
+#define MODE_ALL   1
+#define MODE_COUNT 2
+
+#define INDEX_IMPL(func_name, FILTER_FOLD, VERIFY_FN, RK_IMPL, MODE, WORD)       \
+__attribute__((always_inline)) static inline int64_t func_name(                  \
+    unsigned char *haystack, int64_t haystack_len,                               \
+    uint8_t rare1, int64_t off1,                                                 \
+    uint8_t rare2, int64_t off2,                                                 \
+    unsigned char *needle, int64_t needle_len,                                   \
+    int64_t *out, int64_t out_cap,                                               \
+    const uint64_t *boundary)                                                    \
+{                                                                                \
+    if (haystack_len < needle_len) return MODE == MODE_FIRST ? -1 : 0;           \
+    if (needle_len <= 0) return 0;                                               \
+                                                                                 \
+    const int64_t search_len = haystack_len - needle_len + 1;                    \
+                                                                                 \
+    /* FILTER_FOLD=1: OR 0x20 for letters to case-fold */                        \
+    /* FILTER_FOLD=0: always 0x00 (exact match) */                               \
+    const uint8_t rare1_mask = (FILTER_FOLD && (uint8_t)(rare1 - 'a') < 26) ? 0x20 : 0x00; \
+    const __m256i v_mask1 = _mm256_set1_epi8((char)rare1_mask);                  \
+    const __m256i v_target1 = _mm256_set1_epi8((char)rare1);                     \
+    const unsigned char *rare1_base = haystack + off1;                           \
+                                                                                 \
+    int64_t pos = 0;                                                             \
+    int64_t failures = 0;                                                        \
+    int64_t count = 0;                                                           \
+                                                                                 \
+    /* ===================================================================== */  \
+    /* 1-BYTE MODE                                                           */  \
+    /* ===================================================================== */  \
+    for (;;) {                                                                   \
+        /* Skip 128-byte blocks without a single candidate */                    \
+        while (pos + 128 <= search_len) {                                        \
+            const unsigned char *p = rare1_base + pos;                           \
+            __m256i m0 = _mm256_cmpeq_epi8(_mm256_or_si256(_mm256_loadu_si256((const __m256i *)(p)), v_mask1), v_target1); \
+            __m256i m1 = _mm256_cmpeq_epi8(_mm256_or_si256(_mm256_loadu_si256((const __m256i *)(p + 32)), v_mask1), v_target1); \
+            __m256i m2 = _mm256_cmpeq_epi8(_mm256_or_si256(_mm256_loadu_si256((const __m256i *)(p + 64)), v_mask1), v_target1); \
+            __m256i m3 = _mm256_cmpeq_epi8(_mm256_or_si256(_mm256_loadu_si256((const __m256i *)(p + 96)), v_mask1), v_target1); \
+            __m256i any = _mm256_or_si256(_mm256_or_si256(m0, m1), _mm256_or_si256(m2, m3)); \
+            if (!_mm256_testz_si256(any, any)) break;                            \
+            pos += 128;                                                          \
+        }                                                                        \
+                                                                                 \
+        uint64_t bits;                                                           \
+        int64_t step;                                                            \
+        if (pos + 64 <= search_len) {                                            \
+            bits = match_mask32(rare1_base + pos, v_mask1, v_target1) |          \
+                   ((uint64_t)match_mask32(rare1_base + pos + 32, v_mask1, v_target1) << 32); \
+            step = 64;                                                           \
+        } else if (pos + 32 <= search_len) {                                     \
+            bits = match_mask32(rare1_base + pos, v_mask1, v_target1);           \
+            step = 32;                                                           \
+        } else if (pos < search_len) {                                           \
+            step = search_len - pos;                                             \
+            bits = match_mask_tail(rare1_base + pos, step, rare1_mask, rare1,    \
+                                   v_mask1, v_target1);                          \
+        } else {                                                                 \
+            return MODE == MODE_FIRST ? -1 : count;                              \
+        }                                                                        \
+                                                                                 \
+        while (bits) {                                                           \
+            int64_t cand = pos + __builtin_ctzll(bits);                          \
+            if (VERIFY_FN(haystack + cand, needle, needle_len)) {                \
+                if (WORD && !word_at(haystack, haystack_len, cand,               \
+                                     needle_len, boundary)) {                    \
+                    bits &= bits - 1;                                            \
+                    continue;                                                    \
+                }                                                                \
+                if (MODE == MODE_FIRST) return cand;                             \
+                if (MODE == MODE_ALL) out[count] = cand;                         \
+                count++;                                                         \
+                if (MODE == MODE_ALL && count == out_cap) return count;          \
+                /* Matches do not overlap: resume right after this one */        \
+                step = cand + needle_len - pos;                                  \
+                break;                                                           \
+            }                                                                    \
+            failures++;                                                          \
+            if (failures > 4 + (cand >> 8)) {                                    \
+                pos = cand + 1;                                                  \
+                goto setup_2byte_mode;                                           \
+            }                                                                    \
+            bits &= bits - 1;                                                    \
+        }                                                                        \
+        pos += step;                                                             \
+    }                                                                            \
+                                                                                 \
+    /* ===================================================================== */  \
+    /* 2-BYTE MODE: filter on BOTH rare1 AND rare2                           */  \
+    /* ===================================================================== */  \
+setup_2byte_mode:;                                                               \
+    const uint8_t rare2_mask = (FILTER_FOLD && (uint8_t)(rare2 - 'a') < 26) ? 0x20 : 0x00; \
+    const __m256i v_mask2 = _mm256_set1_epi8((char)rare2_mask);                  \
+    const __m256i v_target2 = _mm256_set1_epi8((char)rare2);                     \
+    /* off2 < needle_len, so the search_len bounds cover rare2 loads too */      \
+    const unsigned char *rare2_base = haystack + off2;                           \
+                                                                                 \
+    /* Lower threshold for long needles since each verification is expensive */ \
+    int64_t failures_2byte = 0;                                                  \
+    const int64_t rk_threshold = (needle_len >= 64) ? 4 : 8;                     \
+                                                                                 \
+    for (;;) {                                                                   \
+        uint64_t bits;                                                           \
+        int64_t step;                                                            \
+        if (pos + 64 <= search_len) {                                            \
+            bits = (match_mask32(rare1_base + pos, v_mask1, v_target1) &         \
+                    match_mask32(rare2_base + pos, v_mask2, v_target2)) |        \
+                   ((uint64_t)(match_mask32(rare1_base + pos + 32, v_mask1, v_target1) & \
+                               match_mask32(rare2_base + pos + 32, v_mask2, v_target2)) << 32); \
+            step = 64;                                                           \
+        } else if (pos + 32 <= search_len) {                                     \
+            bits = match_mask32(rare1_base + pos, v_mask1, v_target1) &          \
+                   match_mask32(rare2_base + pos, v_mask2, v_target2);           \
+            step = 32;                                                           \
+        } else if (pos < search_len) {                                           \
+            step = search_len - pos;                                             \
+            bits = match_mask_tail(rare1_base + pos, step, rare1_mask, rare1,    \
+                                   v_mask1, v_target1) &                         \
+                   match_mask_tail(rare2_base + pos, step, rare2_mask, rare2,    \
+                                   v_mask2, v_target2);                          \
+        } else {                                                                 \
+            return MODE == MODE_FIRST ? -1 : count;                              \
+        }                                                                        \
+                                                                                 \
+        while (bits) {                                                           \
+            int64_t cand = pos + __builtin_ctzll(bits);                          \
+            if (VERIFY_FN(haystack + cand, needle, needle_len)) {                \
+                if (WORD && !word_at(haystack, haystack_len, cand,               \
+                                     needle_len, boundary)) {                    \
+                    bits &= bits - 1;                                            \
+                    continue;                                                    \
+                }                                                                \
+                if (MODE == MODE_FIRST) return cand;                             \
+                if (MODE == MODE_ALL) out[count] = cand;                         \
+                count++;                                                         \
+                if (MODE == MODE_ALL && count == out_cap) return count;          \
+                /* Matches do not overlap: resume right after this one */        \
+                step = cand + needle_len - pos;                                  \
+                break;                                                           \
+            }                                                                    \
+            failures_2byte++;                                                    \
+            if (failures_2byte > rk_threshold) {                                 \
+                pos = cand + 1;                                                  \
+                goto fallback_rabin_karp;                                        \
+            }                                                                    \
+            bits &= bits - 1;                                                    \
+        }                                                                        \
+        pos += step;                                                             \
+    }                                                                            \
+                                                                                 \
+fallback_rabin_karp:;                                                            \
+    /* Too many false positives in 2-byte mode - switch to Rabin-Karp */         \
+    {                                                                            \
+        for (;;) {                                                               \
+            int64_t rk_result = RK_IMPL(haystack + pos, haystack_len - pos,      \
+                                        needle, needle_len);                     \
+            if (WORD && rk_result >= 0 &&                                        \
+                !word_at(haystack, haystack_len, pos + rk_result,                \
+                         needle_len, boundary)) {                                \
+                pos += rk_result + 1;                                            \
+                continue;                                                        \
+            }                                                                    \
+            if (MODE == MODE_FIRST)                                              \
+                return (rk_result >= 0) ? pos + rk_result : -1;                  \
+            if (rk_result < 0) return count;                                     \
+            if (MODE == MODE_ALL) out[count] = pos + rk_result;                  \
+            count++;                                                             \
+            if (MODE == MODE_ALL && count == out_cap) return count;              \
+            pos += rk_result + needle_len;                                       \
+        }                                                                        \
+    }                                                                            \
+}
+
+INDEX_IMPL(index_needle_exact_impl, 0, equal_exact, index_exact_rabin_karp_impl, MODE_FIRST, 0)
+INDEX_IMPL(index_needle_fold_both_impl, 1, equal_fold_both, index_fold_rabin_karp_impl, MODE_FIRST, 0)
+INDEX_IMPL(search_needle_fold_norm_impl, 1, equal_fold_normalized, index_prefolded_rabin_karp_impl, MODE_FIRST, 0)
+INDEX_IMPL(index_all_exact_impl, 0, equal_exact, index_exact_rabin_karp_impl, MODE_ALL, 0)
+INDEX_IMPL(search_all_fold_norm_impl, 1, equal_fold_normalized, index_prefolded_rabin_karp_impl, MODE_ALL, 0)
+INDEX_IMPL(count_exact_impl, 0, equal_exact, index_exact_rabin_karp_impl, MODE_COUNT, 0)
+INDEX_IMPL(count_fold_both_impl, 1, equal_fold_both, index_fold_rabin_karp_impl, MODE_COUNT, 0)
+INDEX_IMPL(count_fold_norm_impl, 1, equal_fold_normalized, index_prefolded_rabin_karp_impl, MODE_COUNT, 0)
+INDEX_IMPL(index_word_exact_impl, 0, equal_exact, index_exact_rabin_karp_impl, MODE_FIRST, 1)
+INDEX_IMPL(search_word_fold_norm_impl, 1, equal_fold_normalized, index_prefolded_rabin_karp_impl, MODE_FIRST, 1)
+
+// LAST_INDEX_IMPL is INDEX_IMPL walking from the end: blocks are taken from
+// the top of the unchecked range [0, end), candidates are visited highest
+// bit first, and the partial block is the one at the start of the haystack.
+#define LAST_INDEX_IMPL(func_name, FILTER_FOLD, VERIFY_FN, RK_IMPL)              \
+__attribute__((always_inline)) static inline int64_t func_name(                  \
+    unsigned char *haystack, int64_t haystack_len,                               \
+    uint8_t rare1, int64_t off1,                                                 \
+    uint8_t rare2, int64_t off2,                                                 \
+    unsigned char *needle, int64_t needle_len)                                   \
+{                                                                                \
+    if (haystack_len < needle_len) return -1;                                    \
+    if (needle_len <= 0) return haystack_len;                                    \
+                                                                                 \
+    const int64_t search_len = haystack_len - needle_len + 1;                    \
+                                                                                 \
+    const uint8_t rare1_mask = (FILTER_FOLD && (uint8_t)(rare1 - 'a') < 26) ? 0x20 : 0x00; \
+    const __m256i v_mask1 = _mm256_set1_epi8((char)rare1_mask);                  \
+    const __m256i v_target1 = _mm256_set1_epi8((char)rare1);                     \
+    const unsigned char *rare1_base = haystack + off1;                           \
+                                                                                 \
+    /* Candidates in [0, end) have not been checked yet */                       \
+    int64_t end = search_len;                                                    \
+    int64_t failures = 0;                                                        \
+                                                                                 \
+    /* ===================================================================== */  \
+    /* 1-BYTE MODE                                                           */  \
+    /* ===================================================================== */  \
+    for (;;) {                                                                   \
+        /* Skip 128-byte blocks without a single candidate */                    \
+        while (end >= 128) {                                                     \
+            const unsigned char *p = rare1_base + end - 128;                     \
+            __m256i m0 = _mm256_cmpeq_epi8(_mm256_or_si256(_mm256_loadu_si256((const __m256i *)(p)), v_mask1), v_target1); \
+            __m256i m1 = _mm256_cmpeq_epi8(_mm256_or_si256(_mm256_loadu_si256((const __m256i *)(p + 32)), v_mask1), v_target1); \
+            __m256i m2 = _mm256_cmpeq_epi8(_mm256_or_si256(_mm256_loadu_si256((const __m256i *)(p + 64)), v_mask1), v_target1); \
+            __m256i m3 = _mm256_cmpeq_epi8(_mm256_or_si256(_mm256_loadu_si256((const __m256i *)(p + 96)), v_mask1), v_target1); \
+            __m256i any = _mm256_or_si256(_mm256_or_si256(m0, m1), _mm256_or_si256(m2, m3)); \
+            if (!_mm256_testz_si256(any, any)) break;                            \
+            end -= 128;                                                          \
+        }                                                                        \
+                                                                                 \
+        uint64_t bits;                                                           \
+        int64_t base;                                                            \
+        if (end >= 64) {                                                         \
+            base = end - 64;                                                     \
+            bits = match_mask32(rare1_base + base, v_mask1, v_target1) |         \
+                   ((uint64_t)match_mask32(rare1_base + base + 32, v_mask1, v_target1) << 32); \
+        } else if (end >= 32) {                                                  \
+            base = end - 32;                                                     \
+            bits = match_mask32(rare1_base + base, v_mask1, v_target1);          \
+        } else if (end > 0) {                                                    \
+            base = 0;                                                            \
+            bits = match_mask_tail(rare1_base, end, rare1_mask, rare1,           \
+                                   v_mask1, v_target1);                          \
+        } else {                                                                 \
+            return -1;                                                           \
+        }                                                                        \
+                                                                                 \
+        while (bits) {                                                           \
+            int64_t cand = base + 63 - __builtin_clzll(bits);                    \
+            if (VERIFY_FN(haystack + cand, needle, needle_len)) {                \
+                return cand;                                                     \
+            }                                                                    \
+            failures++;                                                          \
+            if (failures > 4 + ((search_len - cand) >> 8)) {                     \
+                end = cand;                                                      \
+                goto setup_2byte_mode;                                           \
+            }                                                                    \
+            bits &= ~(1ULL << (cand - base));                                    \
+        }                                                                        \
+        end = base;                                                              \
+    }                                                                            \
+                                                                                 \
+    /* ===================================================================== */  \
+    /* 2-BYTE MODE: filter on BOTH rare1 AND rare2                           */  \
+    /* ===================================================================== */  \
+setup_2byte_mode:;                                                               \
+    const uint8_t rare2_mask = (FILTER_FOLD && (uint8_t)(rare2 - 'a') < 26) ? 0x20 : 0x00; \
+    const __m256i v_mask2 = _mm256_set1_epi8((char)rare2_mask);                  \
+    const __m256i v_target2 = _mm256_set1_epi8((char)rare2);                     \
+    const unsigned char *rare2_base = haystack + off2;                           \
+                                                                                 \
+    int64_t failures_2byte = 0;                                                  \
+    const int64_t rk_threshold = (needle_len >= 64) ? 4 : 8;                     \
+                                                                                 \
+    for (;;) {                                                                   \
+        uint64_t bits;                                                           \
+        int64_t base;                                                            \
+        if (end >= 64) {                                                         \
+            base = end - 64;                                                     \
+            bits = (match_mask32(rare1_base + base, v_mask1, v_target1) &        \
+                    match_mask32(rare2_base + base, v_mask2, v_target2)) |       \
+                   ((uint64_t)(match_mask32(rare1_base + base + 32, v_mask1, v_target1) & \
+                               match_mask32(rare2_base + base + 32, v_mask2, v_target2)) << 32); \
+        } else if (end >= 32) {                                                  \
+            base = end - 32;                                                     \
+            bits = match_mask32(rare1_base + base, v_mask1, v_target1) &         \
+                   match_mask32(rare2_base + base, v_mask2, v_target2);          \
+        } else if (end > 0) {                                                    \
+            base = 0;                                                            \
+            bits = match_mask_tail(rare1_base, end, rare1_mask, rare1,           \
+                                   v_mask1, v_target1) &                         \
+                   match_mask_tail(rare2_base, end, rare2_mask, rare2,           \
+                                   v_mask2, v_target2);                          \
+        } else {                                                                 \
+            return -1;                                                           \
+        }                                                                        \
+                                                                                 \
+        while (bits) {                                                           \
+            int64_t cand = base + 63 - __builtin_clzll(bits);                    \
+            if (VERIFY_FN(haystack + cand, needle, needle_len)) {                \
+                return cand;                                                     \
+            }                                                                    \
+            failures_2byte++;                                                    \
+            if (failures_2byte > rk_threshold) {                                 \
+                end = cand;                                                      \
+                goto fallback_rabin_karp;                                        \
+            }                                                                    \
+            bits &= ~(1ULL << (cand - base));                                    \
+        }                                                                        \
+        end = base;                                                              \
+    }                                                                            \
+                                                                                 \
+fallback_rabin_karp:;                                                            \
+    /* Rabin-Karp over the windows that start before end */                      \
+    return RK_IMPL(haystack, end - 1 + needle_len, needle, needle_len);          \
+}
+
+LAST_INDEX_IMPL(last_index_exact_impl, 0, equal_exact, last_index_exact_rabin_karp_impl)
+LAST_INDEX_IMPL(last_index_fold_both_impl, 1, equal_fold_both, last_index_fold_rabin_karp_impl)
+LAST_INDEX_IMPL(last_search_needle_fold_norm_impl, 1, equal_fold_normalized, last_index_prefolded_rabin_karp_impl)
+
+// Case-sensitive search - for Searcher.Index
+// gocc: indexExactAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t index_exact_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return index_needle_exact_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, 0);
+}
+
+// Case-insensitive search (fold on-the-fly) - for IndexFold
+// gocc: indexFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t index_fold_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return index_needle_fold_both_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, 0);
+}
+
+// Case-insensitive search against a pre-normalized (lowercase) needle - for Searcher.Index
+// gocc: searchNeedleFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t search_needle_fold_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return search_needle_fold_norm_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, 0);
+}
+
+// All non-overlapping case-sensitive matches, written to out - for Searcher.All
+// Returns the number of offsets written; a full buffer means there may be more.
+// gocc: indexAllExactAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, out []int) int
+int64_t index_all_exact_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len,
+    int64_t *out, int64_t out_len, int64_t out_cap)
+{
+    return index_all_exact_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, out, out_len, 0);
+}
+
+// All non-overlapping matches of a pre-normalized needle, written to out - for Searcher.All
+// gocc: searchAllFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, out []int) int
+int64_t search_all_fold_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len,
+    int64_t *out, int64_t out_len, int64_t out_cap)
+{
+    return search_all_fold_norm_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, out, out_len, 0);
+}
+
+// Whole-word searches: bytes next to a match must be in the boundary set
+// gocc: indexWordExactAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, boundary *[4]uint64) int
+int64_t index_word_exact_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len, const uint64_t *boundary)
+{
+    return index_word_exact_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, boundary);
+}
+
+// gocc: searchWordFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, boundary *[4]uint64) int
+int64_t search_word_fold_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len, const uint64_t *boundary)
+{
+    return search_word_fold_norm_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, boundary);
+}
+
+// Non-overlapping match counts - for Count, CountFold and Searcher.Count
+// gocc: countExactAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t count_exact_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return count_exact_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, 0);
+}
+
+// gocc: countFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t count_fold_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return count_fold_both_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, 0);
+}
+
+// gocc: countNeedleFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t count_needle_fold_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return count_fold_norm_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, 0);
+}
+
+// Reverse searches - for LastIndexFold and Searcher.LastIndex
+// gocc: lastIndexExactAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t last_index_exact_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return last_index_exact_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len);
+}
+
+// gocc: lastIndexFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t last_index_fold_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return last_index_fold_both_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len);
+}
+
+// gocc: lastSearchNeedleFoldAvx(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t last_search_needle_fold_avx2(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return last_search_needle_fold_norm_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len);
+}
+
+// =============================================================================
+// IndexAny using a 256-bit bitset and two-nibble PSHUFB lookups
+// =============================================================================
+// For a byte c with hi = c >> 4 and lo = c & 15, the nibble table holds
+// bit (hi & 7) of entry lo when c is in the set. The low 128-bit lane covers
+// c < 128 and the high lane c >= 128, so indexing with c & 0x8F zeroes the
+// wrong half (PSHUFB returns 0 for indices with bit 7 set).
+
+// Expand the CharSet bitset into the nibble table. Bytes 2j and 2j+1 of each
+// lane are the set bits for hi nibble j (lane 0) and j + 8 (lane 1).
+static inline __m256i charset_nibble_table(__m256i bitset)
+{
+    const __m256i bit_pattern = _mm256_set1_epi64x(0x8040201008040201LL);
+    __m256i table = _mm256_setzero_si256();
+    for (int j = 0; j < 8; j++) {
+        __m256i spread = _mm256_shuffle_epi8(bitset, _mm256_setr_epi8(
+            2*j, 2*j, 2*j, 2*j, 2*j, 2*j, 2*j, 2*j,
+            2*j+1, 2*j+1, 2*j+1, 2*j+1, 2*j+1, 2*j+1, 2*j+1, 2*j+1,
+            2*j, 2*j, 2*j, 2*j, 2*j, 2*j, 2*j, 2*j,
+            2*j+1, 2*j+1, 2*j+1, 2*j+1, 2*j+1, 2*j+1, 2*j+1, 2*j+1));
+        __m256i has = _mm256_cmpeq_epi8(_mm256_and_si256(spread, bit_pattern), bit_pattern);
+        table = _mm256_or_si256(table, _mm256_and_si256(has, _mm256_set1_epi8((char)(1 << j))));
+    }
+    return table;
+}
+
+// Bit i is set if data[i] is in the set
+static inline uint32_t charset_match32(__m256i d, __m256i table_lo, __m256i table_hi,
+                                       __m256i hi_bits, __m256i v_0x8f, __m256i v_0x80,
+                                       __m256i v_0x07)
+{
+    __m256i idx = _mm256_and_si256(d, v_0x8f);
+    __m256i row = _mm256_or_si256(_mm256_shuffle_epi8(table_lo, idx),
+                                  _mm256_shuffle_epi8(table_hi, _mm256_xor_si256(idx, v_0x80)));
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(d, 4), v_0x07);
+    __m256i bit = _mm256_shuffle_epi8(hi_bits, hi);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit));
+}
+
+// gocc: indexAnyAvxBitset(data string, bitset0 uint64, bitset1 uint64, bitset2 uint64, bitset3 uint64) int
+int64_t index_any_avx2_bitset(unsigned char *data, uint64_t data_len,
+    uint64_t bitset0, uint64_t bitset1, uint64_t bitset2, uint64_t bitset3)
+{
+    if (data_len == 0) {
+        return -1;
+    }
+
+    const unsigned char *data_start = data;
+    const unsigned char *data_end = data + data_len;
+
+    __m256i table = charset_nibble_table(_mm256_setr_epi64x(bitset0, bitset1, bitset2, bitset3));
+    const __m256i table_lo = _mm256_permute2x128_si256(table, table, 0x00);
+    const __m256i table_hi = _mm256_permute2x128_si256(table, table, 0x11);
+    const __m256i hi_bits = _mm256_set1_epi64x(0x8040201008040201LL);
+    const __m256i v_0x8f = _mm256_set1_epi8((char)0x8f);
+    const __m256i v_0x80 = _mm256_set1_epi8((char)0x80);
+    const __m256i v_0x07 = _mm256_set1_epi8(0x07);
+
+    // Process 64 bytes at a time
+    for (; data + 64 <= data_end; data += 64) {
+        __m256i d0 = _mm256_loadu_si256((const __m256i *)data);
+        __m256i d1 = _mm256_loadu_si256((const __m256i *)(data + 32));
+        uint64_t bits = charset_match32(d0, table_lo, table_hi, hi_bits, v_0x8f, v_0x80, v_0x07) |
+            ((uint64_t)charset_match32(d1, table_lo, table_hi, hi_bits, v_0x8f, v_0x80, v_0x07) << 32);
+        if (bits) {
+            return (data - data_start) + __builtin_ctzll(bits);
+        }
+    }
+
+    if (data + 32 <= data_end) {
+        __m256i d = _mm256_loadu_si256((const __m256i *)data);
+        uint32_t bits = charset_match32(d, table_lo, table_hi, hi_bits, v_0x8f, v_0x80, v_0x07);
+        if (bits) {
+            return (data - data_start) + __builtin_ctz(bits);
+        }
+        data += 32;
+    }
+
+    int64_t n = data_end - data;
+    if (n == 0) {
+        return -1;
+    }
+
+    // Final 1-31 bytes: one masked vector unless it would cross a page
+    if (load32_safe(data)) {
+        __m256i d = _mm256_loadu_si256((const __m256i *)data);
+        uint32_t bits = charset_match32(d, table_lo, table_hi, hi_bits, v_0x8f, v_0x80, v_0x07);
+        bits &= (uint32_t)((1ULL << n) - 1);
+        return bits ? (data - data_start) + __builtin_ctz(bits) : -1;
+    }
+
+    for (int64_t i = 0; i < n; i++) {
+        unsigned char c = data[i];
+        uint64_t word;
+        switch (c >> 6) {
+            case 0: word = bitset0; break;
+            case 1: word = bitset1; break;
+            case 2: word = bitset2; break;
+            default: word = bitset3; break;
+        }
+        if (word & (1ULL << (c & 63))) {
+            return (data - data_start) + i;
+        }
+    }
+
+    return -1;
+}
@@ -0,0 +1,764 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <x86intrin.h>
+
+// AVX-512BW kernels. Every loop works on 64-byte vectors and the final
+// partial vector is handled with a masked load: masked-off bytes are never
+// read, so there is no page-crossing check and no scalar tail.
+
+// Load mask for the first n bytes of a vector (n < 64)
+static inline __mmask64 tail_mask64(uint64_t n)
+{
+    return (__mmask64)((1ULL << n) - 1);
+}
+
+// gocc: isAsciiAvx512(src string) bool
+bool is_ascii_avx512(unsigned char *src, uint64_t src_len)
+{
+    const __m512i hi_mask_v = _mm512_set1_epi8((char)0x80);
+
+    // Process 4 vectors at once for better ILP (256 bytes per iteration)
+    for (const unsigned char *data256_end = (src + src_len) - (src_len % 256); src < data256_end; src += 256)
+    {
+        __m512i v0 = _mm512_loadu_si512((const void *)(src));
+        __m512i v1 = _mm512_loadu_si512((const void *)(src + 64));
+        __m512i v2 = _mm512_loadu_si512((const void *)(src + 128));
+        __m512i v3 = _mm512_loadu_si512((const void *)(src + 192));
+
+        // OR all vectors together - if any byte has MSB set, result will too
+        __m512i combined = _mm512_or_si512(_mm512_or_si512(v0, v1),
+                                           _mm512_or_si512(v2, v3));
+
+        if (_mm512_test_epi8_mask(combined, hi_mask_v))
+        {
+            return false;
+        }
+    }
+    src_len %= 256;
+
+    // Process remaining 64-byte chunks
+    for (const unsigned char *data64_end = (src + src_len) - (src_len % 64); src < data64_end; src += 64)
+    {
+        __m512i chunk = _mm512_loadu_si512((const void *)(src));
+        if (_mm512_test_epi8_mask(chunk, hi_mask_v))
+        {
+            return false;
+        }
+    }
+    src_len %= 64;
+
+    if (src_len == 0)
+        return true;
+
+    __m512i chunk = _mm512_maskz_loadu_epi8(tail_mask64(src_len), src);
+    return _mm512_test_epi8_mask(chunk, hi_mask_v) == 0;
+}
+
+// gocc: indexMaskAvx512(data string, mask byte) int
+int64_t index_mask_avx512(unsigned char *data, uint64_t length, uint8_t mask)
+{
+    const unsigned char *data_start = data;
+    const __m512i mask_vec = _mm512_set1_epi8(mask);
+
+    // Process 256 bytes at a time (4 x 64 bytes)
+    for (const unsigned char *data256_end = (data + length) - (length % 256); data < data256_end; data += 256)
+    {
+        __m512i v0 = _mm512_loadu_si512((const void *)(data));
+        __m512i v1 = _mm512_loadu_si512((const void *)(data + 64));
+        __m512i v2 = _mm512_loadu_si512((const void *)(data + 128));
+        __m512i v3 = _mm512_loadu_si512((const void *)(data + 192));
+
+        __m512i combined = _mm512_or_si512(_mm512_or_si512(v0, v1),
+                                           _mm512_or_si512(v2, v3));
+
+        // If no bytes have any bits set that match the mask, continue
+        if (!_mm512_test_epi8_mask(combined, mask_vec))
+        {
+            continue;
+        }
+
+        // VPTESTMB gives the match bitmask directly
+        uint64_t match0 = _mm512_test_epi8_mask(v0, mask_vec);
+        if (match0) {
+            return (data - data_start) + __builtin_ctzll(match0);
+        }
+
+        uint64_t match1 = _mm512_test_epi8_mask(v1, mask_vec);
+        if (match1) {
+            return (data - data_start) + 64 + __builtin_ctzll(match1);
+        }
+
+        uint64_t match2 = _mm512_test_epi8_mask(v2, mask_vec);
+        if (match2) {
+            return (data - data_start) + 128 + __builtin_ctzll(match2);
+        }
+
+        // This must have a match since combined had one
+        uint64_t match3 = _mm512_test_epi8_mask(v3, mask_vec);
+        return (data - data_start) + 192 + __builtin_ctzll(match3);
+    }
+    length %= 256;
+
+    // Process 64 bytes at a time
+    for (const unsigned char *data64_end = (data + length) - (length % 64); data < data64_end; data += 64)
+    {
+        __m512i chunk = _mm512_loadu_si512((const void *)(data));
+        uint64_t match = _mm512_test_epi8_mask(chunk, mask_vec);
+        if (match) {
+            return (data - data_start) + __builtin_ctzll(match);
+        }
+    }
+    length %= 64;
+
+    if (length == 0)
+        return -1;
+
+    __m512i chunk = _mm512_maskz_loadu_epi8(tail_mask64(length), data);
+    uint64_t match = _mm512_test_epi8_mask(chunk, mask_vec);
+    if (match) {
+        return (data - data_start) + __builtin_ctzll(match);
+    }
+    return -1;
+}
+
+// Returns a bit for every byte where a and b differ other than by ASCII letter case.
+static inline uint64_t fold_mismatch_mask(__m512i va, __m512i vb)
+{
+    const __m512i v_0x20 = _mm512_set1_epi8(0x20);
+    __m512i diff = _mm512_xor_si512(va, vb);
+    // (a|0x20) - 'a' < 26 for both cases of a letter
+    __mmask64 is_alpha = _mm512_cmplt_epu8_mask(
+        _mm512_sub_epi8(_mm512_or_si512(va, v_0x20), _mm512_set1_epi8('a')),
+        _mm512_set1_epi8(26));
+    __mmask64 case_diff = _mm512_mask_cmpeq_epi8_mask(is_alpha, diff, v_0x20);
+    return _mm512_test_epi8_mask(diff, diff) & ~case_diff;
+}
+
+// Returns a bit for every byte where lowercase(a) differs from the already
+// lowercase b.
+static inline uint64_t norm_mismatch_mask(__m512i va, __m512i vb)
+{
+    __mmask64 is_upper = _mm512_cmplt_epu8_mask(
+        _mm512_sub_epi8(va, _mm512_set1_epi8('A')), _mm512_set1_epi8(26));
+    __m512i lower = _mm512_mask_add_epi8(va, is_upper, va, _mm512_set1_epi8(0x20));
+    return _mm512_cmpneq_epi8_mask(lower, vb);
+}
+
+static inline uint64_t exact_mismatch_mask(__m512i va, __m512i vb)
+{
+    return _mm512_cmpneq_epi8_mask(va, vb);
+}
+
+// ASCII case-insensitive string comparison using AVX-512BW
+// gocc: equalFoldAvx512(a, b string) bool
+bool equal_fold_avx512(const char *a, uint64_t a_len, const char *b, uint64_t b_len) {
+    if (a_len != b_len)
+        return false;
+
+    size_t len = a_len;
+
+    // Process 128 bytes at a time
+    for (const char *end = (a + len) - (len % 128); a < end; a += 128, b += 128) {
+        __m512i a0 = _mm512_loadu_si512((const void *)a);
+        __m512i a1 = _mm512_loadu_si512((const void *)(a + 64));
+        __m512i b0 = _mm512_loadu_si512((const void *)b);
+        __m512i b1 = _mm512_loadu_si512((const void *)(b + 64));
+
+        if (fold_mismatch_mask(a0, b0) | fold_mismatch_mask(a1, b1)) {
+            return false;
+        }
+    }
+    len %= 128;
+
+    if (len >= 64) {
+        __m512i va = _mm512_loadu_si512((const void *)a);
+        __m512i vb = _mm512_loadu_si512((const void *)b);
+        if (fold_mismatch_mask(va, vb)) {
+            return false;
+        }
+        a += 64;
+        b += 64;
+        len -= 64;
+    }
+
+    if (len == 0)
+        return true;
+
+    // Masked-off bytes load as zero in both inputs and compare equal
+    __mmask64 m = tail_mask64(len);
+    __m512i va = _mm512_maskz_loadu_epi8(m, a);
+    __m512i vb = _mm512_maskz_loadu_epi8(m, b);
+    return fold_mismatch_mask(va, vb) == 0;
+}
+
+// =============================================================================
+// Rare-byte needle search (same algorithm as ascii_avx2.c, 64 positions per
+// vector). Candidate verification uses masked loads for the final partial
+// vector, so it never needs a scalar path.
+// =============================================================================
+
+// EQUAL_IMPL generates a candidate verifier from a per-vector mismatch function.
+#define EQUAL_IMPL(func_name, MISMATCH_MASK)                                     \
+static inline bool func_name(const unsigned char *a, const unsigned char *b,     \
+                             int64_t len)                                        \
+{                                                                                \
+    for (; len >= 64; a += 64, b += 64, len -= 64) {                             \
+        __m512i va = _mm512_loadu_si512((const void *)a);                        \
+        __m512i vb = _mm512_loadu_si512((const void *)b);                        \
+        if (MISMATCH_MASK(va, vb)) return false;                                 \
+    }                                                                            \
+    if (len == 0) return true;                                                   \
+    __mmask64 m = tail_mask64(len);                                              \
+    __m512i va = _mm512_maskz_loadu_epi8(m, a);                                  \
+    __m512i vb = _mm512_maskz_loadu_epi8(m, b);                                  \
+    return MISMATCH_MASK(va, vb) == 0;                                           \
+}
+
+// Compare haystack against un-normalized needle (IndexFold)
+EQUAL_IMPL(equal_fold_both, fold_mismatch_mask)
+// Compare haystack against lowercase needle (Searcher.Index, case-insensitive)
+EQUAL_IMPL(equal_fold_normalized, norm_mismatch_mask)
+// Exact comparison (Searcher.Index, case-sensitive)
+EQUAL_IMPL(equal_exact, exact_mismatch_mask)
+
+// Case-fold a byte to uppercase, same mapping as the NEON fold_table
+static inline uint8_t fold_upper(uint8_t c)
+{
+    return (uint8_t)(c - 'a') < 26 ? c - 0x20 : c;
+}
+
+// Case-fold a byte to lowercase, matching the normalizeASCII pattern
+static inline uint8_t fold_lower(uint8_t c)
+{
+    return (uint8_t)(c - 'A') < 26 ? c + 0x20 : c;
+}
+
+static inline uint8_t no_fold(uint8_t c)
+{
+    return c;
+}
+
+#define PRIME_RK 16777619
+
+// Compute B^n mod 2^32 using repeated squaring
+static inline uint32_t pow_prime(uint64_t n)
+{
+    uint32_t result = 1;
+    uint32_t base = PRIME_RK;
+    while (n > 0) {
+        if (n & 1) result *= base;
+        base *= base;
+        n >>= 1;
+    }
+    return result;
+}
+
+// RABIN_KARP_IMPL generates a rolling-hash search.
+// HAY_FOLD folds haystack bytes, NEEDLE_FOLD folds needle bytes.
+#define RABIN_KARP_IMPL(func_name, HAY_FOLD, NEEDLE_FOLD, VERIFY_FN)             \
+__attribute__((always_inline)) static inline int64_t func_name(                  \
+    const unsigned char *haystack, int64_t haystack_len,                         \
+    const unsigned char *needle, int64_t needle_len)                             \
+{                                                                                \
+    if (needle_len <= 0) return 0;                                               \
+    if (haystack_len < needle_len) return -1;                                    \
+                                                                                 \
+    const int64_t search_len = haystack_len - needle_len + 1;                    \
+    const uint32_t antisigma = 0u - pow_prime(needle_len);                       \
+                                                                                 \
+    uint32_t target = 0, h = 0;                                                  \
+    for (int64_t i = 0; i < needle_len; i++) {                                   \
+        target = target * PRIME_RK + NEEDLE_FOLD(needle[i]);                     \
+        h = h * PRIME_RK + HAY_FOLD(haystack[i]);                                \
+    }                                                                            \
+                                                                                 \
+    for (int64_t i = 0;; i++) {                                                  \
+        if (h == target && VERIFY_FN(haystack + i, needle, needle_len)) {        \
+            return i;                                                            \
+        }                                                                        \
+        if (i + 1 >= search_len) break;                                          \
+        h = h * PRIME_RK + HAY_FOLD(haystack[i + needle_len])                    \
+            + antisigma * HAY_FOLD(haystack[i]);                                 \
+    }                                                                            \
+    return -1;                                                                   \
+}
+
+RABIN_KARP_IMPL(index_fold_rabin_karp_impl, fold_upper, fold_upper, equal_fold_both)
+RABIN_KARP_IMPL(index_exact_rabin_karp_impl, no_fold, no_fold, equal_exact)
+RABIN_KARP_IMPL(index_prefolded_rabin_karp_impl, fold_lower, no_fold, equal_fold_normalized)
+
+// RABIN_KARP_LAST_IMPL is RABIN_KARP_IMPL walking from the end of the haystack.
+#define RABIN_KARP_LAST_IMPL(func_name, HAY_FOLD, NEEDLE_FOLD, VERIFY_FN)        \
+__attribute__((always_inline)) static inline int64_t func_name(                  \
+    const unsigned char *haystack, int64_t haystack_len,                         \
+    const unsigned char *needle, int64_t needle_len)                             \
+{                                                                                \
+    if (needle_len <= 0) return haystack_len;                                    \
+    if (haystack_len < needle_len) return -1;                                    \
+                                                                                 \
+    const int64_t last = haystack_len - needle_len;                              \
+    const uint32_t sigma = pow_prime(needle_len);                                \
+                                                                                 \
+    /* Byte k of the window is weighted by B^k, so sliding left is h*B + new */  \
+    uint32_t target = 0, h = 0;                                                  \
+    for (int64_t i = needle_len - 1; i >= 0; i--) {                              \
+        target = target * PRIME_RK + NEEDLE_FOLD(needle[i]);                     \
+        h = h * PRIME_RK + HAY_FOLD(haystack[last + i]);                         \
+    }                                                                            \
+                                                                                 \
+    for (int64_t i = last;; i--) {                                               \
+        if (h == target && VERIFY_FN(haystack + i, needle, needle_len)) {        \
+            return i;                                                            \
+        }                                                                        \
+        if (i == 0) break;                                                       \
+        h = h * PRIME_RK + HAY_FOLD(haystack[i - 1])                             \
+            - sigma * HAY_FOLD(haystack[i - 1 + needle_len]);                    \
+    }                                                                            \
+    return -1;                                                                   \
+}
+
+RABIN_KARP_LAST_IMPL(last_index_fold_rabin_karp_impl, fold_upper, fold_upper, equal_fold_both)
+RABIN_KARP_LAST_IMPL(last_index_exact_rabin_karp_impl, no_fold, no_fold, equal_exact)
+RABIN_KARP_LAST_IMPL(last_index_prefolded_rabin_karp_impl, fold_lower, no_fold, equal_fold_normalized)
+
+// Candidate bitmask for the 64 positions at p: bit i is set if (p[i] | mask) == target
+static inline uint64_t match_mask64(const unsigned char *p, __m512i v_mask, __m512i v_target)
+{
+    __m512i d = _mm512_loadu_si512((const void *)p);
+    return _mm512_cmpeq_epi8_mask(_mm512_or_si512(d, v_mask), v_target);
+}
+
+// Same as match_mask64 for the final n < 64 positions
+static inline uint64_t match_mask_tail(const unsigned char *p, int64_t n,
+                                       __m512i v_mask, __m512i v_target)
+{
+    __mmask64 m = tail_mask64(n);
+    __m512i d = _mm512_maskz_loadu_epi8(m, p);
+    return _mm512_mask_cmpeq_epi8_mask(m, _mm512_or_si512(d, v_mask), v_target);
+}
+
+// FILTER_FOLD: 0 = exact matching, 1 = case-folding with OR 0x20
+// VERIFY_FN: verification function (equal_fold_both, ...)
+// RK_IMPL: Rabin-Karp fallback once the 2-byte filter stops paying off
+// Bit c of the 256-bit set is set if byte c is a word boundary.
+__attribute__((always_inline)) static inline bool is_boundary(const uint64_t *boundary, uint8_t c)
+{
+    return (boundary[c >> 6] >> (c & 63)) & 1;
+}
+
+// A match at cand is a whole word if the bytes on either side of it are
+// boundaries; the ends of the haystack count as boundaries.
+__attribute__((always_inline)) static inline bool word_at(
+    const unsigned char *haystack, int64_t haystack_len,
+    int64_t cand, int64_t needle_len, const uint64_t *boundary)
+{
+    return (cand == 0 || is_boundary(boundary, haystack[cand - 1])) &&
+           (cand + needle_len == haystack_len ||
+            is_boundary(boundary, haystack[cand + needle_len]));
+}
+
+// MODE_FIRST returns the first match offset or -1. MODE_ALL writes up to
+// out_cap non-overlapping match offsets to out and MODE_COUNT only counts
+// them; both return the number of matches. With WORD set, matches that are
+// not whole words (see word_at) are skipped without counting as filter
+// failures, so they do not push the search out of the SIMD loops.
+#define MODE_FIRST 0
+#define MODE_ALL   1
+#define MODE_COUNT 2
+
+#define INDEX_IMPL(func_name, FILTER_FOLD, VERIFY_FN, RK_IMPL, MODE, WORD)       \
+__attribute__((always_inline)) static inline int64_t func_name(                  \
+    unsigned char *haystack, int64_t haystack_len,                               \
+    uint8_t rare1, int64_t off1,                                                 \
+    uint8_t rare2, int64_t off2,                                                 \
+    unsigned char *needle, int64_t needle_len,                                   \
+    int64_t *out, int64_t out_cap,                                               \
+    const uint64_t *boundary)                                                    \
+{                                                                                \
+    if (haystack_len < needle_len) return MODE == MODE_FIRST ? -1 : 0;           \
+    if (needle_len <= 0) return 0;                                               \
+                                                                                 \
+    const int64_t search_len = haystack_len - needle_len + 1;                    \
+                                                                                 \
+    const uint8_t rare1_mask = (FILTER_FOLD && (uint8_t)(rare1 - 'a') < 26) ? 0x20 : 0x00; \
+    const __m512i v_mask1 = _mm512_set1_epi8((char)rare1_mask);                  \
+    const __m512i v_target1 = _mm512_set1_epi8((char)rare1);                     \
+    const unsigned char *rare1_base = haystack + off1;                           \
+                                                                                 \
+    int64_t pos = 0;                                                             \
+    int64_t failures = 0;                                                        \
+    int64_t count = 0;                                                           \
+                                                                                 \
+    /* ===================================================================== */  \
+    /* 1-BYTE MODE                                                           */  \
+    /* ===================================================================== */  \
+    for (;;) {                                                                   \
+        /* Skip 256-byte blocks without a single candidate */                    \
+        while (pos + 256 <= search_len) {                                        \
+            const unsigned char *p = rare1_base + pos;                           \
+            uint64_t any = match_mask64(p, v_mask1, v_target1) |                 \
+                           match_mask64(p + 64, v_mask1, v_target1) |            \
+                           match_mask64(p + 128, v_mask1, v_target1) |           \
+                           match_mask64(p + 192, v_mask1, v_target1);            \
+            if (any) break;                                                      \
+            pos += 256;                                                          \
+        }                                                                        \
+                                                                                 \
+        uint64_t bits;                                                           \
+        int64_t step;                                                            \
+        if (pos + 64 <= search_len) {                                            \
+            bits = match_mask64(rare1_base + pos, v_mask1, v_target1);           \
+            step = 64;                                                           \
+        } else if (pos < search_len) {                                           \
+            step = search_len - pos;                                             \
+            bits = match_mask_tail(rare1_base + pos, step, v_mask1, v_target1);  \
+        } else {                                                                 \
+            return MODE == MODE_FIRST ? -1 : count;                              \
+        }                                                                        \
+                                                                                 \
+        while (bits) {                                                           \
+            int64_t cand = pos + __builtin_ctzll(bits);                          \
+            if (VERIFY_FN(haystack + cand, needle, needle_len)) {                \
+                if (WORD && !word_at(haystack, haystack_len, cand,               \
+                                     needle_len, boundary)) {                    \
+                    bits &= bits - 1;                                            \
+                    continue;                                                    \
+                }                                                                \
+                if (MODE == MODE_FIRST) return cand;                             \
+                if (MODE == MODE_ALL) out[count] = cand;                         \
+                count++;                                                         \
+                if (MODE == MODE_ALL && count == out_cap) return count;          \
+                /* Matches do not overlap: resume right after this one */        \
+                step = cand + needle_len - pos;                                  \
+                break;                                                           \
+            }                                                                    \
+            failures++;                                                          \
+            if (failures > 4 + (cand >> 8)) {                                    \
+                pos = cand + 1;                                                  \
+                goto setup_2byte_mode;                                           \
+            }                                                                    \
+            bits &= bits - 1;                                                    \
+        }                                                                        \
+        pos += step;                                                             \
+    }                                                                            \
+                                                                                 \
+    /* ===================================================================== */  \
+    /* 2-BYTE MODE: filter on BOTH rare1 AND rare2                           */  \
+    /* ===================================================================== */  \
+setup_2byte_mode:;                                                               \
+    const uint8_t rare2_mask = (FILTER_FOLD && (uint8_t)(rare2 - 'a') < 26) ? 0x20 : 0x00; \
+    const __m512i v_mask2 = _mm512_set1_epi8((char)rare2_mask);                  \
+    const __m512i v_target2 = _mm512_set1_epi8((char)rare2);                     \
+    /* off2 < needle_len, so the search_len bounds cover rare2 loads too */      \
+    const unsigned char *rare2_base = haystack + off2;                           \
+                                                                                 \
+    /* Lower threshold for long needles since each verification is expensive */ \
+    int64_t failures_2byte = 0;                                                  \
+    const int64_t rk_threshold = (needle_len >= 64) ? 4 : 8;                     \
+                                                                                 \
+    for (;;) {                                                                   \
+        uint64_t bits;                                                           \
+        int64_t step;                                                            \
+        if (pos + 64 <= search_len) {                                            \
+            bits = match_mask64(rare1_base + pos, v_mask1, v_target1) &          \
+                   match_mask64(rare2_base + pos, v_mask2, v_target2);           \
+            step = 64;                                                           \
+        } else if (pos < search_len) {                                           \
+            step = search_len - pos;                                             \
+            bits = match_mask_tail(rare1_base + pos, step, v_mask1, v_target1) & \
+                   match_mask_tail(rare2_base + pos, step, v_mask2, v_target2);  \
+        } else {                                                                 \
+            return MODE == MODE_FIRST ? -1 : count;                              \
+        }                                                                        \
+                                                                                 \
+        while (bits) {                                                           \
+            int64_t cand = pos + __builtin_ctzll(bits);                          \
+            if (VERIFY_FN(haystack + cand, needle, needle_len)) {                \
+                if (WORD && !word_at(haystack, haystack_len, cand,               \
+                                     needle_len, boundary)) {                    \
+                    bits &= bits - 1;                                            \
+                    continue;                                                    \
+                }                                                                \
+                if (MODE == MODE_FIRST) return cand;                             \
+                if (MODE == MODE_ALL) out[count] = cand;                         \
+                count++;                                                         \
+                if (MODE == MODE_ALL && count == out_cap) return count;          \
+                /* Matches do not overlap: resume right after this one */        \
+                step = cand + needle_len - pos;                                  \
+                break;                                                           \
+            }                                                                    \
+            failures_2byte++;                                                    \
+            if (failures_2byte > rk_threshold) {                                 \
+                pos = cand + 1;                                                  \
+                goto fallback_rabin_karp;                                        \
+            }                                                                    \
+            bits &= bits - 1;                                                    \
+        }                                                                        \
+        pos += step;                                                             \
+    }                                                                            \
+                                                                                 \
+fallback_rabin_karp:;                                                            \
+    /* Too many false positives in 2-byte mode - switch to Rabin-Karp */         \
+    {                                                                            \
+        for (;;) {                                                               \
+            int64_t rk_result = RK_IMPL(haystack + pos, haystack_len - pos,      \
+                                        needle, needle_len);                     \
+            if (WORD && rk_result >= 0 &&                                        \
+                !word_at(haystack, haystack_len, pos + rk_result,                \
+                         needle_len, boundary)) {                                \
+                pos += rk_result + 1;                                            \
+                continue;                                                        \
+            }                                                                    \
+            if (MODE == MODE_FIRST)                                              \
+                return (rk_result >= 0) ? pos + rk_result : -1;                  \
+            if (rk_result < 0) return count;                                     \
+            if (MODE == MODE_ALL) out[count] = pos + rk_result;                  \
+            count++;                                                             \
+            if (MODE == MODE_ALL && count == out_cap) return count;              \
+            pos += rk_result + needle_len;                                       \
+        }                                                                        \
+    }                                                                            \
+}
+
+INDEX_IMPL(index_needle_exact_impl, 0, equal_exact, index_exact_rabin_karp_impl, MODE_FIRST, 0)
+INDEX_IMPL(index_needle_fold_both_impl, 1, equal_fold_both, index_fold_rabin_karp_impl, MODE_FIRST, 0)
+INDEX_IMPL(search_needle_fold_norm_impl, 1, equal_fold_normalized, index_prefolded_rabin_karp_impl, MODE_FIRST, 0)
+INDEX_IMPL(index_all_exact_impl, 0, equal_exact, index_exact_rabin_karp_impl, MODE_ALL, 0)
+INDEX_IMPL(search_all_fold_norm_impl, 1, equal_fold_normalized, index_prefolded_rabin_karp_impl, MODE_ALL, 0)
+INDEX_IMPL(count_exact_impl, 0, equal_exact, index_exact_rabin_karp_impl, MODE_COUNT, 0)
+INDEX_IMPL(count_fold_both_impl, 1, equal_fold_both, index_fold_rabin_karp_impl, MODE_COUNT, 0)
+INDEX_IMPL(count_fold_norm_impl, 1, equal_fold_normalized, index_prefolded_rabin_karp_impl, MODE_COUNT, 0)
+INDEX_IMPL(index_word_exact_impl, 0, equal_exact, index_exact_rabin_karp_impl, MODE_FIRST, 1)
+INDEX_IMPL(search_word_fold_norm_impl, 1, equal_fold_normalized, index_prefolded_rabin_karp_impl, MODE_FIRST, 1)
+
+// LAST_INDEX_IMPL is INDEX_IMPL walking from the end: blocks are taken from
+// the top of the unchecked range [0, end), candidates are visited highest
+// bit first, and the partial block is the one at the start of the haystack.
+#define LAST_INDEX_IMPL(func_name, FILTER_FOLD, VERIFY_FN, RK_IMPL)              \
+__attribute__((always_inline)) static inline int64_t func_name(                  \
+    unsigned char *haystack, int64_t haystack_len,                               \
+    uint8_t rare1, int64_t off1,                                                 \
+    uint8_t rare2, int64_t off2,                                                 \
+    unsigned char *needle, int64_t needle_len)                                   \
+{                                                                                \
+    if (haystack_len < needle_len) return -1;                                    \
+    if (needle_len <= 0) return haystack_len;                                    \
+                                                                                 \
+    const int64_t search_len = haystack_len - needle_len + 1;                    \
+                                                                                 \
+    const uint8_t rare1_mask = (FILTER_FOLD && (uint8_t)(rare1 - 'a') < 26) ? 0x20 : 0x00; \
+    const __m512i v_mask1 = _mm512_set1_epi8((char)rare1_mask);                  \
+    const __m512i v_target1 = _mm512_set1_epi8((char)rare1);                     \
+    const unsigned char *rare1_base = haystack + off1;                           \
+                                                                                 \
+    /* Candidates in [0, end) have not been checked yet */                       \
+    int64_t end = search_len;                                                    \
+    int64_t failures = 0;                                                        \
+                                                                                 \
+    /* ===================================================================== */  \
+    /* 1-BYTE MODE                                                           */  \
+    /* ===================================================================== */  \
+    for (;;) {                                                                   \
+        /* Skip 256-byte blocks without a single candidate */                    \
+        while (end >= 256) {                                                     \
+            const unsigned char *p = rare1_base + end - 256;                     \
+            uint64_t any = match_mask64(p, v_mask1, v_target1) |                 \
+                           match_mask64(p + 64, v_mask1, v_target1) |            \
+                           match_mask64(p + 128, v_mask1, v_target1) |           \
+                           match_mask64(p + 192, v_mask1, v_target1);            \
+            if (any) break;                                                      \
+            end -= 256;                                                          \
+        }                                                                        \
+                                                                                 \
+        uint64_t bits;                                                           \
+        int64_t base;                                                            \
+        if (end >= 64) {                                                         \
+            base = end - 64;                                                     \
+            bits = match_mask64(rare1_base + base, v_mask1, v_target1);          \
+        } else if (end > 0) {                                                    \
+            base = 0;                                                            \
+            bits = match_mask_tail(rare1_base, end, v_mask1, v_target1);         \
+        } else {                                                                 \
+            return -1;                                                           \
+        }                                                                        \
+                                                                                 \
+        while (bits) {                                                           \
+            int64_t cand = base + 63 - __builtin_clzll(bits);                    \
+            if (VERIFY_FN(haystack + cand, needle, needle_len)) {                \
+                return cand;                                                     \
+            }                                                                    \
+            failures++;                                                          \
+            if (failures > 4 + ((search_len - cand) >> 8)) {                     \
+                end = cand;                                                      \
+                goto setup_2byte_mode;                                           \
+            }                                                                    \
+            bits &= ~(1ULL << (cand - base));                                    \
+        }                                                                        \
+        end = base;                                                              \
+    }                                                                            \
+                                                                                 \
+    /* ===================================================================== */  \
+    /* 2-BYTE MODE: filter on BOTH rare1 AND rare2                           */  \
+    /* ===================================================================== */  \
+setup_2byte_mode:;                                                               \
+    const uint8_t rare2_mask = (FILTER_FOLD && (uint8_t)(rare2 - 'a') < 26) ? 0x20 : 0x00; \
+    const __m512i v_mask2 = _mm512_set1_epi8((char)rare2_mask);                  \
+    const __m512i v_target2 = _mm512_set1_epi8((char)rare2);                     \
+    const unsigned char *rare2_base = haystack + off2;                           \
+                                                                                 \
+    int64_t failures_2byte = 0;                                                  \
+    const int64_t rk_threshold = (needle_len >= 64) ? 4 : 8;                     \
+                                                                                 \
+    for (;;) {                                                                   \
+        uint64_t bits;                                                           \
+        int64_t base;                                                            \
+        if (end >= 64) {                                                         \
+            base = end - 64;                                                     \
+            bits = match_mask64(rare1_base + base, v_mask1, v_target1) &         \
+                   match_mask64(rare2_base + base, v_mask2, v_target2);          \
+        } else if (end > 0) {                                                    \
+            base = 0;                                                            \
+            bits = match_mask_tail(rare1_base, end, v_mask1, v_target1) &        \
+                   match_mask_tail(rare2_base, end, v_mask2, v_target2);         \
+        } else {                                                                 \
+            return -1;                                                           \
+        }                                                                        \
+                                                                                 \
+        while (bits) {                                                           \
+            int64_t cand = base + 63 - __builtin_clzll(bits);                    \
+            if (VERIFY_FN(haystack + cand, needle, needle_len)) {                \
+                return cand;                                                     \
+            }                                                                    \
+            failures_2byte++;                                                    \
+            if (failures_2byte > rk_threshold) {                                 \
+                end = cand;                                                      \
+                goto fallback_rabin_karp;                                        \
+            }                                                                    \
+            bits &= ~(1ULL << (cand - base));                                    \
+        }                                                                        \
+        end = base;                                                              \
+    }                                                                            \
+                                                                                 \
+fallback_rabin_karp:;                                                            \
+    /* Rabin-Karp over the windows that start before end */                      \
+    return RK_IMPL(haystack, end - 1 + needle_len, needle, needle_len);          \
+}
+
+LAST_INDEX_IMPL(last_index_exact_impl, 0, equal_exact, last_index_exact_rabin_karp_impl)
+LAST_INDEX_IMPL(last_index_fold_both_impl, 1, equal_fold_both, last_index_fold_rabin_karp_impl)
+LAST_INDEX_IMPL(last_search_needle_fold_norm_impl, 1, equal_fold_normalized, last_index_prefolded_rabin_karp_impl)
+
+// Case-sensitive search - for Searcher.Index
+// gocc: indexExactAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t index_exact_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return index_needle_exact_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, 0);
+}
+
+// Case-insensitive search (fold on-the-fly) - for IndexFold
+// gocc: indexFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t index_fold_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return index_needle_fold_both_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, 0);
+}
+
+// Case-insensitive search against a pre-normalized (lowercase) needle - for Searcher.Index
+// gocc: searchNeedleFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t search_needle_fold_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return search_needle_fold_norm_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, 0);
+}
+
+// All non-overlapping case-sensitive matches, written to out - for Searcher.All
+// Returns the number of offsets written; a full buffer means there may be more.
+// gocc: indexAllExactAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, out []int) int
+int64_t index_all_exact_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len,
+    int64_t *out, int64_t out_len, int64_t out_cap)
+{
+    return index_all_exact_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, out, out_len, 0);
+}
+
+// All non-overlapping matches of a pre-normalized needle, written to out - for Searcher.All
+// gocc: searchAllFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, out []int) int
+int64_t search_all_fold_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len,
+    int64_t *out, int64_t out_len, int64_t out_cap)
+{
+    return search_all_fold_norm_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, out, out_len, 0);
+}
+
+// Whole-word searches: bytes next to a match must be in the boundary set
+// gocc: indexWordExactAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, boundary *[4]uint64) int
+int64_t index_word_exact_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len, const uint64_t *boundary)
+{
+    return index_word_exact_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, boundary);
+}
+
+// gocc: searchWordFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, boundary *[4]uint64) int
+int64_t search_word_fold_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len, const uint64_t *boundary)
+{
+    return search_word_fold_norm_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, boundary);
+}
+
+// Non-overlapping match counts - for Count, CountFold and Searcher.Count
+// gocc: countExactAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t count_exact_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return count_exact_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, 0);
+}
+
+// gocc: countFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t count_fold_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return count_fold_both_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, 0);
+}
+
+// gocc: countNeedleFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t count_needle_fold_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return count_fold_norm_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len, 0, 0, 0);
+}
+
+// Reverse searches - for LastIndexFold and Searcher.LastIndex
+// gocc: lastIndexExactAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t last_index_exact_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return last_index_exact_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len);
+}
+
+// gocc: lastIndexFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t last_index_fold_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return last_index_fold_both_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len);
+}
+
+// gocc: lastSearchNeedleFoldAvx512(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t last_search_needle_fold_avx512(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return last_search_needle_fold_norm_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len);
+}
@@ -82,7 +82,7 @@ int64_t index_any_neon_bitset(unsigned char *data, uint64_t data_len,
 
 
 
-// gocc: ValidString(data string) bool
+// gocc: isAsciiNeon(data string) bool
 bool ascii_valid_string(unsigned char *data, uint64_t length)
 {
     const uint64_t blockSize = 16; // NEON can process 128 bits (16 bytes) at a time
@@ -159,7 +159,7 @@ bool ascii_valid_string(unsigned char *data, uint64_t length)
     return (data32 & 0x80808080) ? false : true;
 }
 
-// gocc: IndexMask(data string, mask byte) int
+// gocc: indexMaskNeon(data string, mask byte) int
 int64_t index_mask(unsigned char *data, uint64_t length, uint8_t mask)
 {
     const uint64_t blockSize = 16; // NEON can process 128 bits (16 bytes) at a time
@@ -419,7 +419,7 @@ __attribute__((always_inline)) static inline bool equal_fold_core(unsigned char
     return true;
 }
 
-// gocc: EqualFold(a, b string) bool
+// gocc: equalFoldNeon(a, b string) bool
 bool equal_fold(unsigned char *a, uint64_t a_len, unsigned char *b, uint64_t b_len)
 {
     if (a_len != b_len)
@@ -1731,6 +1731,9 @@ do { \
     } \
 } while(0)
 
+// First match only. Unlike the x86 INDEX_IMPL there is no MODE_ALL or
+// MODE_COUNT: all-matches searches and counts restart this kernel after each
+// match (allFromIndex and countFromIndex in dispatch.go).
 #define INDEX_IMPL(func_name, FILTER_FOLD, VERIFY_FN, RK_IMPL) \
 __attribute__((always_inline)) static inline int64_t func_name( \
     unsigned char *haystack, int64_t haystack_len, \
@@ -2361,3 +2364,272 @@ __attribute__((noinline)) int64_t search_needle_fold(unsigned char *haystack, in
     volatile int64_t result = search_needle_fold_norm_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len);
     return result;
 }
+
+// =============================================================================
+// Reverse search - LastIndex / LastIndexFold
+// =============================================================================
+// LAST_INDEX_IMPL is INDEX_IMPL walking from the end: 16-byte blocks are
+// taken from the top of the unchecked range [0, end), candidates are visited
+// highest nibble first, and the partial block is the one at the start of the
+// haystack. Blocks of 64 bytes without a rare byte are skipped in one test.
+
+static inline uint8_t fold_upper(uint8_t c) {
+    return (uint8_t)(c - 'a') < 26 ? c - 0x20 : c;
+}
+
+static inline uint8_t fold_lower(uint8_t c) {
+    return (uint8_t)(c - 'A') < 26 ? c + 0x20 : c;
+}
+
+static inline uint8_t no_fold(uint8_t c) {
+    return c;
+}
+
+// Byte differences of 16 haystack bytes a and needle bytes b: zero where the
+// bytes are equal for the search mode
+__attribute__((always_inline)) static inline uint8x16_t diff_exact(uint8x16_t a, uint8x16_t b) {
+    return veorq_u8(a, b);
+}
+
+__attribute__((always_inline)) static inline uint8x16_t diff_fold_normalized(uint8x16_t a, uint8x16_t b) {
+    const uint8x16_t is_upper = vcltq_u8(vsubq_u8(a, vdupq_n_u8('A')), vdupq_n_u8(26));
+    return veorq_u8(vorrq_u8(a, vandq_u8(is_upper, vdupq_n_u8(0x20))), b);
+}
+
+__attribute__((always_inline)) static inline uint8x16_t diff_fold_both(uint8x16_t a, uint8x16_t b) {
+    const uint8x16_t v_32 = vdupq_n_u8(0x20);
+    uint8x16_t diff = veorq_u8(a, b);
+    uint8x16_t is_case_diff = vceqq_u8(diff, v_32);
+    uint8x16_t is_letter = vcltq_u8(vaddq_u8(vorrq_u8(a, v_32), vdupq_n_u8(159)), vdupq_n_u8(26));
+    return veorq_u8(diff, vandq_u8(vandq_u8(is_case_diff, is_letter), v_32));
+}
+
+// EQUAL_WITHIN_IMPL compares len bytes at a and b without reading past
+// either: 16-byte blocks and an overlapping last block, or single bytes for
+// needles shorter than 16.
+#define EQUAL_WITHIN_IMPL(func_name, DIFF_FN, HAY_FOLD, NEEDLE_FOLD)             \
+__attribute__((always_inline)) static inline bool func_name(                     \
+    const unsigned char *a, const unsigned char *b, int64_t len)                 \
+{                                                                                \
+    if (len < 16) {                                                              \
+        for (int64_t i = 0; i < len; i++) {                                      \
+            if (HAY_FOLD(a[i]) != NEEDLE_FOLD(b[i])) return false;               \
+        }                                                                        \
+        return true;                                                             \
+    }                                                                            \
+    int64_t i = 0;                                                               \
+    for (; i + 16 <= len; i += 16) {                                             \
+        if (vmaxvq_u8(DIFF_FN(vld1q_u8(a + i), vld1q_u8(b + i)))) return false;  \
+    }                                                                            \
+    if (i < len) {                                                               \
+        if (vmaxvq_u8(DIFF_FN(vld1q_u8(a + len - 16), vld1q_u8(b + len - 16)))) { \
+            return false;                                                        \
+        }                                                                        \
+    }                                                                            \
+    return true;                                                                 \
+}
+
+EQUAL_WITHIN_IMPL(equal_within_exact, diff_exact, no_fold, no_fold)
+EQUAL_WITHIN_IMPL(equal_within_fold_both, diff_fold_both, fold_upper, fold_upper)
+EQUAL_WITHIN_IMPL(equal_within_fold_normalized, diff_fold_normalized, fold_lower, no_fold)
+
+// RABIN_KARP_LAST_IMPL walks a Rabin-Karp window from the end of the
+// haystack: byte k of the window is weighted by B^k, so sliding left is
+// h*B + new - B^w*old.
+#define RABIN_KARP_LAST_IMPL(func_name, HAY_FOLD, NEEDLE_FOLD, VERIFY_FN)        \
+__attribute__((always_inline)) static inline int64_t func_name(                  \
+    const unsigned char *haystack, int64_t haystack_len,                         \
+    const unsigned char *needle, int64_t needle_len)                             \
+{                                                                                \
+    if (needle_len <= 0) return haystack_len;                                    \
+    if (haystack_len < needle_len) return -1;                                    \
+                                                                                 \
+    const int64_t last = haystack_len - needle_len;                              \
+    const uint32_t sigma = pow_prime(needle_len);                                \
+                                                                                 \
+    uint32_t target = 0, h = 0;                                                  \
+    for (int64_t i = needle_len - 1; i >= 0; i--) {                              \
+        target = target * PRIME_RK + NEEDLE_FOLD(needle[i]);                     \
+        h = h * PRIME_RK + HAY_FOLD(haystack[last + i]);                         \
+    }                                                                            \
+                                                                                 \
+    for (int64_t i = last;; i--) {                                               \
+        if (h == target && VERIFY_FN(haystack + i, needle, needle_len)) {        \
+            return i;                                                            \
+        }                                                                        \
+        if (i == 0) break;                                                       \
+        h = h * PRIME_RK + HAY_FOLD(haystack[i - 1])                             \
+            - sigma * HAY_FOLD(haystack[i - 1 + needle_len]);                    \
+    }                                                                            \
+    return -1;                                                                   \
+}
+
+RABIN_KARP_LAST_IMPL(last_index_exact_rabin_karp_impl, no_fold, no_fold, equal_within_exact)
+RABIN_KARP_LAST_IMPL(last_index_fold_rabin_karp_impl, fold_upper, fold_upper, equal_within_fold_both)
+RABIN_KARP_LAST_IMPL(last_index_prefolded_rabin_karp_impl, fold_lower, no_fold, equal_within_fold_normalized)
+
+// Nibble syndrome of the 16 bytes at p that equal target once ORed with mask
+__attribute__((always_inline)) static inline uint64_t rare_syndrome(const unsigned char *p,
+    uint8x16_t v_mask, uint8x16_t v_target) {
+    return extract_syndrome_shrn(vceqq_u8(vorrq_u8(vld1q_u8(p), v_mask), v_target));
+}
+
+// Nibble syndrome of the first n < 16 bytes at p, byte by byte
+__attribute__((always_inline)) static inline uint64_t rare_syndrome_bytes(const unsigned char *p,
+    int64_t n, uint8_t mask, uint8_t target) {
+    uint64_t bits = 0;
+    for (int64_t i = 0; i < n; i++) {
+        if ((uint8_t)(p[i] | mask) == target) bits |= 0xFULL << (4 * i);
+    }
+    return bits;
+}
+
+#define LAST_INDEX_IMPL(func_name, FILTER_FOLD, VERIFY_FN, RK_IMPL)              \
+__attribute__((always_inline)) static inline int64_t func_name(                  \
+    unsigned char *haystack, int64_t haystack_len,                               \
+    uint8_t rare1, int64_t off1,                                                 \
+    uint8_t rare2, int64_t off2,                                                 \
+    unsigned char *needle, int64_t needle_len)                                   \
+{                                                                                \
+    if (haystack_len < needle_len) return -1;                                    \
+    if (needle_len <= 0) return haystack_len;                                    \
+                                                                                 \
+    const int64_t search_len = haystack_len - needle_len + 1;                    \
+                                                                                 \
+    const uint8_t rare1_mask = (FILTER_FOLD && (uint8_t)(rare1 - 'a') < 26) ? 0x20 : 0x00; \
+    const uint8x16_t v_mask1 = vdupq_n_u8(rare1_mask);                           \
+    const uint8x16_t v_target1 = vdupq_n_u8(rare1);                              \
+    const unsigned char *rare1_base = haystack + off1;                           \
+                                                                                 \
+    /* The partial block is loaded whole if 16 bytes follow both offsets */      \
+    const bool tail_load = haystack_len - 16 >= (off1 > off2 ? off1 : off2);     \
+                                                                                 \
+    /* Candidates in [0, end) have not been checked yet */                       \
+    int64_t end = search_len;                                                    \
+    int64_t failures = 0;                                                        \
+                                                                                 \
+    /* ===================================================================== */  \
+    /* 1-BYTE MODE                                                           */  \
+    /* ===================================================================== */  \
+    for (;;) {                                                                   \
+        /* Skip 64-byte blocks without a single candidate */                     \
+        while (end >= 64) {                                                      \
+            const unsigned char *p = rare1_base + end - 64;                      \
+            uint8x16_t m0 = vceqq_u8(vorrq_u8(vld1q_u8(p), v_mask1), v_target1);      \
+            uint8x16_t m1 = vceqq_u8(vorrq_u8(vld1q_u8(p + 16), v_mask1), v_target1); \
+            uint8x16_t m2 = vceqq_u8(vorrq_u8(vld1q_u8(p + 32), v_mask1), v_target1); \
+            uint8x16_t m3 = vceqq_u8(vorrq_u8(vld1q_u8(p + 48), v_mask1), v_target1); \
+            if (any_nonzero(vorrq_u8(vorrq_u8(m0, m1), vorrq_u8(m2, m3)))) break; \
+            end -= 64;                                                           \
+        }                                                                        \
+                                                                                 \
+        uint64_t bits;                                                           \
+        int64_t base;                                                            \
+        if (end >= 16) {                                                         \
+            base = end - 16;                                                     \
+            bits = rare_syndrome(rare1_base + base, v_mask1, v_target1);         \
+        } else if (end > 0) {                                                    \
+            base = 0;                                                            \
+            bits = tail_load                                                     \
+                ? rare_syndrome(rare1_base, v_mask1, v_target1) & ((1ULL << (4 * end)) - 1) \
+                : rare_syndrome_bytes(rare1_base, end, rare1_mask, rare1);       \
+        } else {                                                                 \
+            return -1;                                                           \
+        }                                                                        \
+                                                                                 \
+        while (bits) {                                                           \
+            int64_t cand = base + ((63 - __builtin_clzll(bits)) >> 2);           \
+            if (VERIFY_FN(haystack + cand, needle, needle_len)) {                \
+                return cand;                                                     \
+            }                                                                    \
+            failures++;                                                          \
+            if (failures > 4 + ((search_len - cand) >> 8)) {                     \
+                end = cand;                                                      \
+                goto setup_2byte_mode;                                           \
+            }                                                                    \
+            bits &= (1ULL << (4 * (cand - base))) - 1;                           \
+        }                                                                        \
+        end = base;                                                              \
+    }                                                                            \
+                                                                                 \
+    /* ===================================================================== */  \
+    /* 2-BYTE MODE: filter on BOTH rare1 AND rare2                           */  \
+    /* ===================================================================== */  \
+setup_2byte_mode:;                                                               \
+    const uint8_t rare2_mask = (FILTER_FOLD && (uint8_t)(rare2 - 'a') < 26) ? 0x20 : 0x00; \
+    const uint8x16_t v_mask2 = vdupq_n_u8(rare2_mask);                           \
+    const uint8x16_t v_target2 = vdupq_n_u8(rare2);                              \
+    const unsigned char *rare2_base = haystack + off2;                           \
+                                                                                 \
+    int64_t failures_2byte = 0;                                                  \
+    const int64_t rk_threshold = (needle_len >= 64) ? 4 : 8;                     \
+                                                                                 \
+    for (;;) {                                                                   \
+        uint64_t bits;                                                           \
+        int64_t base;                                                            \
+        if (end >= 16) {                                                         \
+            base = end - 16;                                                     \
+            bits = rare_syndrome(rare1_base + base, v_mask1, v_target1) &        \
+                   rare_syndrome(rare2_base + base, v_mask2, v_target2);         \
+        } else if (end > 0) {                                                    \
+            base = 0;                                                            \
+            bits = tail_load                                                     \
+                ? rare_syndrome(rare1_base, v_mask1, v_target1) &                \
+                  rare_syndrome(rare2_base, v_mask2, v_target2) &                \
+                  ((1ULL << (4 * end)) - 1)                                      \
+                : rare_syndrome_bytes(rare1_base, end, rare1_mask, rare1) &      \
+                  rare_syndrome_bytes(rare2_base, end, rare2_mask, rare2);       \
+        } else {                                                                 \
+            return -1;                                                           \
+        }                                                                        \
+                                                                                 \
+        while (bits) {                                                           \
+            int64_t cand = base + ((63 - __builtin_clzll(bits)) >> 2);           \
+            if (VERIFY_FN(haystack + cand, needle, needle_len)) {                \
+                return cand;                                                     \
+            }                                                                    \
+            failures_2byte++;                                                    \
+            if (failures_2byte > rk_threshold) {                                 \
+                end = cand;                                                      \
+                goto fallback_rabin_karp;                                        \
+            }                                                                    \
+            bits &= (1ULL << (4 * (cand - base))) - 1;                           \
+        }                                                                        \
+        end = base;                                                              \
+    }                                                                            \
+                                                                                 \
+fallback_rabin_karp:;                                                            \
+    /* Rabin-Karp over the windows that start before end */                      \
+    return RK_IMPL(haystack, end - 1 + needle_len, needle, needle_len);          \
+}
+
+LAST_INDEX_IMPL(last_index_exact_impl, 0, equal_within_exact, last_index_exact_rabin_karp_impl)
+LAST_INDEX_IMPL(last_index_fold_both_impl, 1, equal_within_fold_both, last_index_fold_rabin_karp_impl)
+LAST_INDEX_IMPL(last_search_needle_fold_norm_impl, 1, equal_within_fold_normalized, last_index_prefolded_rabin_karp_impl)
+
+// Case-sensitive reverse search - for Searcher.LastIndex
+// gocc: lastIndexExactNEON(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t last_index_exact_neon(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return last_index_exact_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len);
+}
+
+// Case-insensitive reverse search (fold on-the-fly) - for LastIndexFold
+// gocc: lastIndexFoldNEON(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t last_index_fold_neon(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return last_index_fold_both_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len);
+}
+
+// Case-insensitive reverse search (pre-normalized needle) - for Searcher.LastIndex
+// gocc: lastSearchNeedleFoldNEON(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+int64_t last_search_needle_fold_neon(unsigned char *haystack, int64_t haystack_len,
+    uint8_t rare1, int64_t off1, uint8_t rare2, int64_t off2,
+    unsigned char *needle, int64_t needle_len)
+{
+    return last_search_needle_fold_norm_impl(haystack, haystack_len, rare1, off1, rare2, off2, needle, needle_len);
+}
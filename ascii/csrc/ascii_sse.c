@@ -81,4 +81,241 @@ bool is_ascii_sse(unsigned char *src, uint64_t src_len)
     data32 |= data_end[-1];
 
     return (data32 & 0x80808080) ? false : true;
-}
\ No newline at end of file
+}
+
+#define hasbetween(x, m, n) ((~0ull / 255 * (127 + (n)) - ((x) & ~0ull / 255 * 127) & ~(x) & ((x) & ~0ull / 255 * 127) + ~0ull / 255 * (127 - (m))) & ~0ull / 255 * 128)
+
+// Scalar fallback: compare 8 bytes at a time using lookup table
+static inline bool equal_fold_scalar(const uint8_t *a, const uint8_t *b, size_t len)
+{
+    size_t i = 0;
+
+    // Process 8 bytes at a time
+    for (; i + 8 <= len; i += 8)
+    {
+        uint64_t a64, b64;
+        __builtin_memcpy(&a64, a + i, sizeof(a64));
+        __builtin_memcpy(&b64, b + i, sizeof(a64));
+        if (a64 == b64) continue;
+
+        uint64_t aMask = hasbetween(a64, 'a' - 1, 'z' + 1);
+        uint64_t bMask = hasbetween(b64, 'a' - 1, 'z' + 1);
+
+        uint64_t aFolded = a64 - (aMask >> 2);
+        uint64_t bFolded = b64 - (bMask >> 2);
+
+        if (aFolded != bFolded) return false;
+    }
+
+    // Handle remaining bytes
+    for (; i < len; i++)
+    {
+        uint8_t aCh = a[i];
+        uint8_t bCh = b[i];
+
+        if (aCh >= 'a' && aCh <= 'z') aCh -= 0x20;
+        if (bCh >= 'a' && bCh <= 'z') bCh -= 0x20;
+
+        if (aCh != bCh) return false;
+    }
+
+    return true;
+}
+
+// SSE helper: check if 16 bytes are equal (case-insensitive)
+// Returns mask where 0xFF = match, 0x00 = mismatch
+static inline __m128i equal_fold_vec(__m128i va, __m128i vb,
+                                     __m128i v_0x20, __m128i v_0x1f,
+                                     __m128i v_0x9a, __m128i v_0x01) {
+    // diff = a ^ b (0x00 if equal, 0x20 if case differs, other if mismatch)
+    __m128i diff = _mm_xor_si128(va, vb);
+
+    // mask_0x20 = (diff == 0x20) - potential case difference
+    __m128i mask_0x20 = _mm_cmpeq_epi8(diff, v_0x20);
+
+    // Check if character is ASCII letter [A-Za-z]
+    // Force to lowercase: tmp = a | 0x20
+    __m128i tmp = _mm_or_si128(va, v_0x20);
+    // Shift range: tmp = tmp + 0x1f  (now 'a'=0x80, 'z'=0x99)
+    tmp = _mm_add_epi8(tmp, v_0x1f);
+    // is_alpha = (0x9a > tmp) signed - true for 0x80-0x99
+    __m128i is_alpha = _mm_cmpgt_epi8(v_0x9a, tmp);
+
+    // acceptable_diff = is_alpha & mask_0x20 & 0x01
+    __m128i acceptable = _mm_and_si128(is_alpha, mask_0x20);
+    acceptable = _mm_and_si128(acceptable, v_0x01);
+    // Shift 0x01 -> 0x20 to match the diff value
+    acceptable = _mm_slli_epi16(acceptable, 5);
+
+    // Match if diff == acceptable (either both 0, or both 0x20 for valid case diff)
+    return _mm_cmpeq_epi8(diff, acceptable);
+}
+
+// ASCII case-insensitive string comparison using SSE4.1
+// gocc: equalFoldSse(a, b string) bool
+bool equal_fold_sse(const char *a, uint64_t a_len, const char *b, uint64_t b_len) {
+    if (a_len != b_len)
+        return false;
+
+    size_t len = a_len;
+
+    if (len < 16) return equal_fold_scalar((const uint8_t *)a, (const uint8_t *)b, len);
+
+    // Broadcast constants
+    const __m128i v_0x20 = _mm_set1_epi8(0x20);
+    const __m128i v_0x1f = _mm_set1_epi8(0x1f);
+    const __m128i v_0x9a = _mm_set1_epi8((char)0x9a);
+    const __m128i v_0x01 = _mm_set1_epi8(0x01);
+    const __m128i all_ones = _mm_set1_epi8((char)0xFF);
+
+    // Process 32 bytes at a time
+    for (const char *end = (a + len) - (len % 32); a < end; a += 32, b += 32) {
+        __m128i a0 = _mm_loadu_si128((const __m128i *)a);
+        __m128i a1 = _mm_loadu_si128((const __m128i *)(a + 16));
+        __m128i b0 = _mm_loadu_si128((const __m128i *)b);
+        __m128i b1 = _mm_loadu_si128((const __m128i *)(b + 16));
+
+        __m128i eq0 = equal_fold_vec(a0, b0, v_0x20, v_0x1f, v_0x9a, v_0x01);
+        __m128i eq1 = equal_fold_vec(a1, b1, v_0x20, v_0x1f, v_0x9a, v_0x01);
+        __m128i combined = _mm_and_si128(eq0, eq1);
+
+        // PTEST: testc returns 1 if (~combined & all_ones) == 0, i.e. combined is all ones
+        if (!_mm_testc_si128(combined, all_ones)) {
+            return false;
+        }
+    }
+    len %= 32;
+
+    // Process 16 bytes
+    if (len >= 16) {
+        __m128i va = _mm_loadu_si128((const __m128i *)a);
+        __m128i vb = _mm_loadu_si128((const __m128i *)b);
+        __m128i eq = equal_fold_vec(va, vb, v_0x20, v_0x1f, v_0x9a, v_0x01);
+
+        if (!_mm_testc_si128(eq, all_ones)) {
+            return false;
+        }
+        a += 16;
+        b += 16;
+        len -= 16;
+    }
+
+    if (len == 0)
+        return true;
+
+    // Overlapped tail load for final 1-15 bytes
+    const char *aEnd = (a + len) - 16;
+    const char *bEnd = (b + len) - 16;
+
+    __m128i va = _mm_loadu_si128((const __m128i *)aEnd);
+    __m128i vb = _mm_loadu_si128((const __m128i *)bEnd);
+    __m128i eq = equal_fold_vec(va, vb, v_0x20, v_0x1f, v_0x9a, v_0x01);
+
+    return _mm_testc_si128(eq, all_ones);
+}
+
+// gocc: indexMaskSse(data string, mask byte) int
+int64_t index_mask_sse(unsigned char *data, uint64_t length, uint8_t mask)
+{
+    const unsigned char *data_start = data;
+
+    if (length >= 16)
+    {
+        const __m128i mask_vec = _mm_set1_epi8(mask);
+        const __m128i zero = _mm_setzero_si128();
+
+        // Process 64 bytes at a time (4 x 16 bytes)
+        for (const unsigned char *data64_end = (data + length) - (length % 64); data < data64_end; data += 64)
+        {
+            __m128i v0 = _mm_loadu_si128((const __m128i *)(data));
+            __m128i v1 = _mm_loadu_si128((const __m128i *)(data + 16));
+            __m128i v2 = _mm_loadu_si128((const __m128i *)(data + 32));
+            __m128i v3 = _mm_loadu_si128((const __m128i *)(data + 48));
+
+            __m128i combined = _mm_or_si128(_mm_or_si128(v0, v1),
+                                            _mm_or_si128(v2, v3));
+
+            // If no bytes have any bits set that match the mask, continue
+            if (_mm_testz_si128(combined, mask_vec))
+            {
+                continue;
+            }
+
+            // Build a 64-bit match mask from the four 16-bit movemasks
+            uint64_t m0 = (uint16_t)~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v0, mask_vec), zero));
+            uint64_t m1 = (uint16_t)~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v1, mask_vec), zero));
+            uint64_t m2 = (uint16_t)~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v2, mask_vec), zero));
+            uint64_t m3 = (uint16_t)~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v3, mask_vec), zero));
+            uint64_t match = m0 | (m1 << 16) | (m2 << 32) | (m3 << 48);
+            return (data - data_start) + __builtin_ctzll(match);
+        }
+        length %= 64;
+
+        // Process 16 bytes at a time
+        for (const unsigned char *data16_end = (data + length) - (length % 16); data < data16_end; data += 16)
+        {
+            __m128i chunk = _mm_loadu_si128((const __m128i *)(data));
+
+            if (_mm_testz_si128(chunk, mask_vec))
+            {
+                continue;
+            }
+
+            __m128i result = _mm_and_si128(chunk, mask_vec);
+            int cmp_mask = _mm_movemask_epi8(_mm_cmpeq_epi8(result, zero));
+            int match_mask = (~cmp_mask) & 0xFFFF;
+            return (data - data_start) + __builtin_ctz(match_mask);
+        }
+        length %= 16;
+    }
+
+    // Scalar fallback for remaining bytes (0-15 bytes)
+    uint32_t mask32 = mask;
+    mask32 |= mask32 << 8;
+    mask32 |= mask32 << 16;
+
+    if (length >= 8)
+    {
+        uint64_t mask64 = mask32;
+        mask64 |= mask64 << 32;
+
+        uint64_t data64;
+        __builtin_memcpy(&data64, data, sizeof(data64));
+        data64 &= mask64;
+        if (data64 != 0)
+        {
+            return (data - data_start) + __builtin_ctzll(data64) / 8;
+        }
+        data += 8;
+        length -= 8;
+    }
+
+    uint32_t data32;
+
+    if (length >= 4)
+    {
+        __builtin_memcpy(&data32, data, sizeof(data32));
+        data32 &= mask32;
+        if (data32 != 0)
+        {
+            return (data - data_start) + __builtin_ctz(data32) / 8;
+        }
+        data += 4;
+        length -= 4;
+    }
+
+    // Handle the remaining bytes (if any)
+    data32 = 0;
+    for (uint64_t i = 0; i < length; i++)
+    {
+        data32 |= (uint32_t)data[i] << (8 * i);
+    }
+
+    data32 &= mask32;
+    if (data32)
+    {
+        return (data - data_start) + __builtin_ctz(data32) / 8;
+    }
+
+    return -1;
+}
@@ -0,0 +1,453 @@
+package ascii
+
+import (
+	"iter"
+	"os"
+	"strings"
+)
+
+// isa identifies a kernel tier. The x86 tiers are ordered: each one implies
+// the instructions of the tiers before it.
+type isa uint8
+
+const (
+	isaGeneric isa = iota
+	isaSSE41
+	isaAVX2
+	isaAVX512
+	isaNEON
+)
+
+var isaNames = [...]string{"generic", "sse41", "avx2", "avx512", "neon"}
+
+// activeISA is the tier the dispatch table is built for: the best one the
+// CPU supports, unless VELOZ_ISA names another tier the CPU supports.
+var activeISA = selectISA(os.Getenv("VELOZ_ISA"), detectISA())
+
+// impl holds the kernel for every operation, selected once at init. It is
+// assigned in init because some kernels (the BooleanSearch verifier) call
+// back through impl, which a variable initializer would reject as a cycle.
+var impl kernels
+
+func init() {
+	impl = kernelsFor(activeISA)
+}
+
+// ISA returns the name of the kernel tier selected at init: "generic",
+// "sse41", "avx2", "avx512" or "neon". It can be lowered for A/B testing with
+// the VELOZ_ISA environment variable; names of tiers the CPU does not support
+// are ignored.
+func ISA() string {
+	return isaNames[activeISA]
+}
+
+func selectISA(override string, best isa) isa {
+	for i, name := range isaNames {
+		t := isa(i)
+		if name != override {
+			continue
+		}
+		if t == isaGeneric || t == best || (best != isaNEON && t < best) {
+			return t
+		}
+	}
+	return best
+}
+
+// needleFunc searches for needle using a precomputed rare byte pair.
+type needleFunc func(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int
+
+// needleAllFunc writes the offsets of up to len(out) non-overlapping matches
+// of needle to out and returns how many it wrote.
+type needleAllFunc func(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, out []int) int
+
+// kernels is the dispatch table: one implementation per operation.
+type kernels struct {
+	validString     func(s string) bool
+	indexMask       func(s string, mask byte) int
+	equalFold       func(a, b string) bool
+	indexFold       func(haystack, needle string) int
+	countFold       func(haystack, needle string) int
+	lastIndexFold   func(haystack, needle string) int
+	indexAnyCharSet func(data string, cs CharSet) int
+
+	// Searcher.Index: indexExact takes the raw needle, searchFold the
+	// lowercase one.
+	indexExact needleFunc
+	searchFold needleFunc
+
+	// Searcher.All and AppendIndices
+	indexAllExact needleAllFunc
+	searchAllFold needleAllFunc
+
+	// Searcher.Count
+	countExact      needleFunc
+	countNeedleFold needleFunc
+
+	// Searcher.LastIndex
+	lastIndexExact       needleFunc
+	lastSearchNeedleFold needleFunc
+
+	// Searcher.WholeWord
+	indexWordExact wordFunc
+	searchWordFold wordFunc
+
+	// BooleanSearch engines
+	searchTBL func(bs *BooleanSearch, haystack string, foundMask uint64, offsets *[64]int) uint64
+	searchFDR func(bs *BooleanSearch, haystack string, foundMask uint64, offsets *[64]int) uint64
+}
+
+func genericKernels() kernels {
+	k := kernels{
+		validString:     isAsciiGo[string],
+		indexMask:       indexMaskGo[string],
+		equalFold:       equalFoldGo,
+		indexFold:       indexFoldGo[string],
+		indexAnyCharSet: indexAnyCharSetGo,
+		lastIndexFold:   lastIndexFoldGo,
+		indexExact: func(haystack string, _ byte, _ int, _ byte, _ int, needle string) int {
+			return strings.Index(haystack, needle)
+		},
+		searchFold: func(haystack string, _ byte, _ int, _ byte, _ int, needle string) int {
+			return indexFoldGo(haystack, needle)
+		},
+		lastIndexExact: func(haystack string, _ byte, _ int, _ byte, _ int, needle string) int {
+			return strings.LastIndex(haystack, needle)
+		},
+		lastSearchNeedleFold: func(haystack string, _ byte, _ int, _ byte, _ int, needle string) int {
+			return lastIndexFoldGo(haystack, needle)
+		},
+		searchTBL: (*BooleanSearch).searchTBLGo,
+		searchFDR: (*BooleanSearch).searchFDRGo,
+	}
+	k.indexAllExact = allFromIndex(k.indexExact)
+	k.searchAllFold = allFromIndex(k.searchFold)
+	k.countExact = countFromIndex(k.indexExact)
+	k.countNeedleFold = countFromIndex(k.searchFold)
+	k.indexWordExact = wordFromIndex(k.indexExact)
+	k.searchWordFold = wordFromIndex(k.searchFold)
+	k.countFold = func(haystack, needle string) int {
+		n := 0
+		for {
+			i := indexFoldGo(haystack, needle)
+			if i < 0 {
+				return n
+			}
+			n++
+			haystack = haystack[i+len(needle):]
+		}
+	}
+	return k
+}
+
+// allFromIndex builds an all-matches kernel for tiers that only have a
+// first-match one, calling it again after every match. The NEON kernels in
+// csrc/ascii_neon.c have no all-matches mode yet, so arm64 uses this too.
+func allFromIndex(index needleFunc) needleAllFunc {
+	return func(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, out []int) int {
+		n, pos := 0, 0
+		for n < len(out) && len(haystack)-pos >= len(needle) {
+			i := index(haystack[pos:], rare1, off1, rare2, off2, needle)
+			if i < 0 {
+				break
+			}
+			out[n] = pos + i
+			n++
+			pos += i + len(needle)
+		}
+		return n
+	}
+}
+
+// countFromIndex builds a counting kernel for tiers that only have a
+// first-match one. As with allFromIndex, arm64 uses this for its NEON kernels.
+func countFromIndex(index needleFunc) needleFunc {
+	return func(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string) int {
+		n, pos := 0, 0
+		for len(haystack)-pos >= len(needle) {
+			i := index(haystack[pos:], rare1, off1, rare2, off2, needle)
+			if i < 0 {
+				break
+			}
+			n++
+			pos += i + len(needle)
+		}
+		return n
+	}
+}
+
+func ValidString(s string) bool {
+	return impl.validString(s)
+}
+
+func IndexMask(s string, mask byte) int {
+	return impl.indexMask(s, mask)
+}
+
+func EqualFold(a, b string) bool {
+	return impl.equalFold(a, b)
+}
+
+// IndexFold finds the first case-insensitive match of needle in haystack.
+// The SIMD tiers use rare-byte filtering with on-the-fly case folding.
+func IndexFold(haystack, needle string) int {
+	if len(needle) == 0 {
+		return 0
+	}
+	if len(haystack) < len(needle) {
+		return -1
+	}
+	return impl.indexFold(haystack, needle)
+}
+
+// LastIndexFold finds the last case-insensitive match of needle in haystack,
+// scanning from the end. An empty needle matches at len(haystack).
+//
+// AVX2, AVX-512 and NEON have a reverse kernel; the other tiers use
+// lastIndexFoldGo.
+func LastIndexFold(haystack, needle string) int {
+	if len(needle) == 0 {
+		return len(haystack)
+	}
+	if len(haystack) < len(needle) {
+		return -1
+	}
+	return impl.lastIndexFold(haystack, needle)
+}
+
+// CountFold returns the number of non-overlapping case-insensitive matches of
+// needle in haystack. An empty needle matches at every offset, so the count
+// is len(haystack)+1.
+//
+// On AVX2 and AVX-512 the whole count is taken in one kernel call. The other
+// tiers, NEON included, call their first-match kernel again after each match
+// (see countFromIndex).
+func CountFold(haystack, needle string) int {
+	if len(needle) == 0 {
+		return len(haystack) + 1
+	}
+	if len(haystack) < len(needle) {
+		return 0
+	}
+	return impl.countFold(haystack, needle)
+}
+
+// IndexFoldAll returns an iterator over the offsets of all non-overlapping
+// case-insensitive matches of needle in haystack. To search many haystacks
+// for the same needle, build a Searcher once and use Searcher.All.
+func IndexFoldAll(haystack, needle string) iter.Seq[int] {
+	return NewSearcher(needle, false).All(haystack)
+}
+
+// CharSet represents a precomputed character set for fast IndexAny lookups.
+// Build once with MakeCharSet, then reuse with IndexAnyCharSet.
+type CharSet struct {
+	bitset [4]uint64
+}
+
+// MakeCharSet creates a CharSet from the given characters.
+func MakeCharSet(chars string) CharSet {
+	var cs CharSet
+	for i := 0; i < len(chars); i++ {
+		c := chars[i]
+		cs.bitset[c>>6] |= 1 << (c & 63)
+	}
+	return cs
+}
+
+// IndexAnyCharSet finds the first occurrence of any byte from cs in data.
+// Returns -1 if no match is found.
+func IndexAnyCharSet(data string, cs CharSet) int {
+	if cs.bitset == [4]uint64{} {
+		return -1
+	}
+	return impl.indexAnyCharSet(data, cs)
+}
+
+// indexAnyCharSetGo is a Go fallback for small data using prebuilt CharSet.
+func indexAnyCharSetGo(s string, cs CharSet) int {
+	for i := 0; i < len(s); i++ {
+		c := s[i]
+		if cs.bitset[c>>6]&(1<<(c&63)) != 0 {
+			return i
+		}
+	}
+	return -1
+}
+
+// IndexAny finds the first occurrence of any byte from chars in data.
+// Returns -1 if no match is found.
+func IndexAny(data, chars string) int {
+	if len(chars) == 0 {
+		return -1
+	}
+	// For very small data, Go is faster (bitset building overhead dominates)
+	if len(data) < 16 {
+		return indexAnyGo(data, chars)
+	}
+	return impl.indexAnyCharSet(data, MakeCharSet(chars))
+}
+
+// Index finds the first occurrence of the pattern in haystack.
+// Uses the case sensitivity specified when the Searcher was created.
+func (s Searcher) Index(haystack string) int {
+	if len(s.raw) == 0 {
+		return 0
+	}
+	if len(haystack) < len(s.raw) {
+		return -1
+	}
+	if s.boundary != nil {
+		return s.wordIndex(haystack, 0)
+	}
+	if s.caseSensitive {
+		return impl.indexExact(haystack, s.rare1, s.off1, s.rare2, s.off2, s.raw)
+	}
+	// Use pre-normalized pattern for faster case-insensitive verification
+	return impl.searchFold(haystack, s.rare1, s.off1, s.rare2, s.off2, s.norm)
+}
+
+// LastIndex finds the last occurrence of the pattern in haystack, scanning
+// from the end. An empty pattern matches at len(haystack).
+//
+// As with LastIndexFold, only AVX2, AVX-512 and NEON run this in a SIMD
+// kernel.
+func (s Searcher) LastIndex(haystack string) int {
+	if len(s.raw) == 0 {
+		return len(haystack)
+	}
+	if len(haystack) < len(s.raw) {
+		return -1
+	}
+	if s.boundary != nil {
+		return s.wordLastIndex(haystack)
+	}
+	if s.caseSensitive {
+		return impl.lastIndexExact(haystack, s.rare1, s.off1, s.rare2, s.off2, s.raw)
+	}
+	return impl.lastSearchNeedleFold(haystack, s.rare1, s.off1, s.rare2, s.off2, s.norm)
+}
+
+// All returns an iterator over the offsets of all non-overlapping matches of
+// the pattern in haystack, in increasing order. An empty pattern matches at
+// every offset, including len(haystack).
+//
+// On AVX2 and AVX-512, matches are found in batches by a single kernel call
+// each, which keeps the adaptive filter state across matches instead of
+// restarting it like a loop over Index does. The other tiers, NEON included,
+// call their first-match kernel again after each match (see allFromIndex).
+func (s Searcher) All(haystack string) iter.Seq[int] {
+	return func(yield func(int) bool) {
+		if len(s.raw) == 0 {
+			for i := 0; i <= len(haystack); i++ {
+				if !yield(i) {
+					return
+				}
+			}
+			return
+		}
+		if s.boundary != nil {
+			s.wordAll(haystack, yield)
+			return
+		}
+		var buf [32]int
+		pos := 0
+		for len(haystack)-pos >= len(s.raw) {
+			n := s.indexAll(haystack[pos:], buf[:])
+			for _, i := range buf[:n] {
+				if !yield(pos + i) {
+					return
+				}
+			}
+			if n < len(buf) {
+				return
+			}
+			pos += buf[n-1] + len(s.raw)
+		}
+	}
+}
+
+// AppendIndices appends the offsets of all non-overlapping matches of the
+// pattern in haystack to dst and returns the extended slice. Spare capacity
+// in dst is filled directly by the search kernel.
+func (s Searcher) AppendIndices(dst []int, haystack string) []int {
+	if len(s.raw) == 0 {
+		for i := 0; i <= len(haystack); i++ {
+			dst = append(dst, i)
+		}
+		return dst
+	}
+	if s.boundary != nil {
+		s.wordAll(haystack, func(i int) bool {
+			dst = append(dst, i)
+			return true
+		})
+		return dst
+	}
+	var buf [32]int
+	pos := 0
+	for len(haystack)-pos >= len(s.raw) {
+		out := dst[len(dst):cap(dst)]
+		direct := len(out) >= len(buf)
+		if !direct {
+			out = buf[:]
+		}
+		n := s.indexAll(haystack[pos:], out)
+		for i := range out[:n] {
+			out[i] += pos
+		}
+		if direct {
+			dst = dst[:len(dst)+n]
+		} else {
+			dst = append(dst, buf[:n]...)
+		}
+		if n < len(out) {
+			break
+		}
+		pos = dst[len(dst)-1] + len(s.raw)
+	}
+	return dst
+}
+
+// Count returns the number of non-overlapping matches of the pattern in
+// haystack without materializing their offsets. An empty pattern matches at
+// every offset, so the count is len(haystack)+1.
+//
+// Like CountFold, it stays in one kernel call only on AVX2 and AVX-512.
+func (s Searcher) Count(haystack string) int {
+	if len(s.raw) == 0 {
+		return len(haystack) + 1
+	}
+	if len(haystack) < len(s.raw) {
+		return 0
+	}
+	if s.boundary != nil {
+		n := 0
+		s.wordAll(haystack, func(int) bool {
+			n++
+			return true
+		})
+		return n
+	}
+	if s.caseSensitive {
+		return impl.countExact(haystack, s.rare1, s.off1, s.rare2, s.off2, s.raw)
+	}
+	return impl.countNeedleFold(haystack, s.rare1, s.off1, s.rare2, s.off2, s.norm)
+}
+
+func (s Searcher) indexAll(haystack string, out []int) int {
+	if s.caseSensitive {
+		return impl.indexAllExact(haystack, s.rare1, s.off1, s.rare2, s.off2, s.raw, out)
+	}
+	return impl.searchAllFold(haystack, s.rare1, s.off1, s.rare2, s.off2, s.norm, out)
+}
+
+// searchTBL uses the Direct TBL engine for 1-8 patterns.
+func (bs *BooleanSearch) searchTBL(haystack string, foundMask uint64, offsets *[64]int) uint64 {
+	return impl.searchTBL(bs, haystack, foundMask, offsets)
+}
+
+// searchFDR uses the FDR engine for 9-64 patterns.
+func (bs *BooleanSearch) searchFDR(haystack string, foundMask uint64, offsets *[64]int) uint64 {
+	return impl.searchFDR(bs, haystack, foundMask, offsets)
+}
@@ -0,0 +1,154 @@
+package ascii
+
+// Byte sets that end a run of plain bytes in the JSON value scans
+var (
+	jsonStringStop = MakeCharSet(`"\`)
+	jsonNestedStop = MakeCharSet(`"[]{}`)
+	jsonScalarStop = MakeCharSet(",]} \t\r\n")
+)
+
+// FieldSearcher finds a needle inside the value of a given key of JSON
+// text such as log lines, for field:value queries: with
+// NewFieldSearcher("level", "err", false), Index finds "ERROR" in
+// {"level":"ERROR"} but not in {"msg":"error","level":"info"}.
+//
+// The key is found with the rare-byte kernel of a Searcher for the quoted
+// key, and the value is bounded with IndexAnyCharSet scans for quotes and
+// escapes (and brackets, for nested values). Only the value is searched
+// for the needle. The text is not validated or unescaped: the needle is
+// matched against a string value as written between its quotes, and
+// against the text of any other value.
+type FieldSearcher struct {
+	key    Searcher // the key in quotes, matched case-sensitively
+	needle Searcher
+}
+
+// NewFieldSearcher creates a FieldSearcher for the needle in the values of
+// key. The key is given as it appears between the quotes of the JSON text
+// and matched case-sensitively, as JSON keys are; caseSensitive applies to
+// the needle.
+func NewFieldSearcher(key, valueNeedle string, caseSensitive bool) FieldSearcher {
+	return FieldSearcher{
+		key:    NewSearcher(`"`+key+`"`, true),
+		needle: NewSearcher(valueNeedle, caseSensitive),
+	}
+}
+
+// Index returns the offset of the first match of the needle inside a
+// value of the key, or -1. An empty needle matches at the start of the
+// first value.
+func (f FieldSearcher) Index(haystack string) int {
+	for pos := 0; len(haystack)-pos >= len(f.key.raw); {
+		i := f.key.Index(haystack[pos:])
+		if i < 0 {
+			return -1
+		}
+		// Inside strings quotes are escaped, so in valid JSON a quoted key
+		// followed by a colon is always a key, unless its opening quote is
+		// itself escaped
+		start, end, ok := jsonValueAfterKey(haystack, pos+i+len(f.key.raw))
+		if !ok || escapedAt(haystack, pos+i) {
+			pos += i + 1
+			continue
+		}
+		if j := f.needle.Index(haystack[start:end]); j >= 0 {
+			return start + j
+		}
+		// Nested occurrences of the key were searched with the value
+		pos = max(end, pos+i+1)
+	}
+	return -1
+}
+
+// Contains reports whether the needle occurs inside a value of the key.
+func (f FieldSearcher) Contains(haystack string) bool {
+	return f.Index(haystack) >= 0
+}
+
+// jsonValueAfterKey returns the span of the value that follows a quoted key
+// ending at i: the contents of a string value without its quotes, or the
+// text of any other value. ok is false if no colon follows. Values cut off
+// by the end of haystack extend to it.
+func jsonValueAfterKey(haystack string, i int) (start, end int, ok bool) {
+	i = skipJSONSpace(haystack, i)
+	if i == len(haystack) || haystack[i] != ':' {
+		return 0, 0, false
+	}
+	i = skipJSONSpace(haystack, i+1)
+	if i == len(haystack) {
+		return i, i, true
+	}
+
+	switch haystack[i] {
+	case '"':
+		return i + 1, jsonStringEnd(haystack, i+1), true
+	case '{', '[':
+		return i, jsonNestedEnd(haystack, i), true
+	}
+	if j := IndexAnyCharSet(haystack[i:], jsonScalarStop); j >= 0 {
+		return i, i + j, true
+	}
+	return i, len(haystack), true
+}
+
+// jsonStringEnd returns the offset of the quote that closes the string
+// whose contents start at i, or len(haystack).
+func jsonStringEnd(haystack string, i int) int {
+	for i < len(haystack) {
+		j := IndexAnyCharSet(haystack[i:], jsonStringStop)
+		if j < 0 {
+			break
+		}
+		i += j
+		if haystack[i] == '"' {
+			return i
+		}
+		// Skip the escaped byte
+		i += 2
+	}
+	return len(haystack)
+}
+
+// jsonNestedEnd returns the offset just past the object or array that opens
+// at i, or len(haystack).
+func jsonNestedEnd(haystack string, i int) int {
+	depth := 0
+	for i < len(haystack) {
+		j := IndexAnyCharSet(haystack[i:], jsonNestedStop)
+		if j < 0 {
+			break
+		}
+		i += j
+		switch haystack[i] {
+		case '"':
+			i = jsonStringEnd(haystack, i+1)
+		case '{', '[':
+			depth++
+		default:
+			if depth--; depth == 0 {
+				return i + 1
+			}
+		}
+		i++
+	}
+	return len(haystack)
+}
+
+// escapedAt reports whether the byte at i is escaped: preceded by an odd
+// number of backslashes.
+func escapedAt(haystack string, i int) bool {
+	j := i
+	for j > 0 && haystack[j-1] == '\\' {
+		j--
+	}
+	return (i-j)%2 == 1
+}
+
+// skipJSONSpace returns the offset of the first byte at or after i that is
+// not JSON whitespace.
+func skipJSONSpace(haystack string, i int) int {
+	for i < len(haystack) && (haystack[i] == ' ' || haystack[i] == '\t' || haystack[i] == '\n' || haystack[i] == '\r') {
+		i++
+	}
+	return i
+}
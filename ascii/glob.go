@@ -0,0 +1,179 @@
+package ascii
+
+// GlobSearcher finds glob patterns: '?' matches any single byte, '*' any
+// run of bytes (including none), and '\' makes the next byte literal. So
+// NewGlobSearcher("GET /api/*?id=??", false) finds "get /api/users?id=42"
+// and "a?c" finds "abc" and "a.c". Fixed gaps are written as runs of '?'.
+//
+// The pattern is split at each '*' into blocks of fixed length, and each
+// block into literal segments at fixed offsets. Every block is found with
+// the Searcher kernel for its rarest segment, chosen by the rare-byte ranks
+// of selectRarePairFull; the other segments are compared at their offsets
+// from each candidate. Blocks are searched left to right, each after the
+// end of the previous one, so a search is a single pass over the haystack.
+type GlobSearcher struct {
+	blocks        []globBlock
+	caseSensitive bool
+	leadingStar   bool // matches start at 0
+}
+
+// globBlock is the part of a glob pattern between two '*'s.
+type globBlock struct {
+	length int           // bytes matched, '?'s included
+	segs   []globSegment // literal runs between the '?'s
+	anchor int           // segment found with search, or -1 if there is none
+	search Searcher
+}
+
+// globSegment is a literal run of a block, at offset off from its start.
+type globSegment struct {
+	off  int
+	text string
+}
+
+// NewGlobSearcher creates a GlobSearcher for pattern. If caseSensitive is
+// false, literal bytes match case-insensitively (ASCII letters only).
+func NewGlobSearcher(pattern string, caseSensitive bool) GlobSearcher {
+	parts := globParts(pattern, '?', '*', caseSensitive)
+	g := GlobSearcher{caseSensitive: caseSensitive, leadingStar: len(parts) > 1 && parts[0].length == 0}
+	for _, b := range parts {
+		if b.length > 0 {
+			g.blocks = append(g.blocks, b)
+		}
+	}
+	return g
+}
+
+// globParts splits pattern at each unescaped many byte into blocks, empty
+// ones included, with one as the single-byte wildcard.
+func globParts(pattern string, one, many byte, caseSensitive bool) []globBlock {
+	var parts []globBlock
+	var b globBlock
+	var lit []byte
+	flush := func() {
+		if len(lit) > 0 {
+			b.segs = append(b.segs, globSegment{off: b.length - len(lit), text: string(lit)})
+			lit = lit[:0]
+		}
+	}
+	for i := 0; i < len(pattern); i++ {
+		switch c := pattern[i]; c {
+		case many:
+			flush()
+			parts = append(parts, b.withAnchor(caseSensitive))
+			b = globBlock{}
+		case one:
+			flush()
+			b.length++
+		default:
+			if c == '\\' && i+1 < len(pattern) {
+				i++
+				c = pattern[i]
+			}
+			lit = append(lit, c)
+			b.length++
+		}
+	}
+	flush()
+	return append(parts, b.withAnchor(caseSensitive))
+}
+
+// withAnchor returns b with the segment whose rare pair is rarest (the
+// longer one on ties) as its anchor.
+func (b globBlock) withAnchor(caseSensitive bool) globBlock {
+	ranks := getRankTable(nil, caseSensitive)
+	b.anchor = -1
+	best := 0
+	for i, s := range b.segs {
+		rare1, _, rare2, _ := selectRarePairFull(s.text, nil, caseSensitive)
+		score := int(ranks[rare1]) + int(ranks[rare2])
+		if b.anchor < 0 || score < best || score == best && len(s.text) > len(b.segs[b.anchor].text) {
+			b.anchor, best = i, score
+		}
+	}
+	if b.anchor >= 0 {
+		b.search = NewSearcher(b.segs[b.anchor].text, caseSensitive)
+	}
+	return b
+}
+
+// literal returns the text of a block without wildcards.
+func (b *globBlock) literal() (string, bool) {
+	switch {
+	case b.length == 0:
+		return "", true
+	case len(b.segs) == 1 && len(b.segs[0].text) == b.length:
+		return b.segs[0].text, true
+	}
+	return "", false
+}
+
+func (b *globBlock) isLiteral() bool {
+	_, ok := b.literal()
+	return ok
+}
+
+// Index returns the offset of the first match of the pattern in haystack,
+// or -1. A pattern that starts with '*' matches at 0 if it matches at all.
+func (g GlobSearcher) Index(haystack string) int {
+	start, pos := 0, 0
+	for k := range g.blocks {
+		i := g.blocks[k].index(haystack, pos, g.caseSensitive)
+		if i < 0 {
+			// Later candidates for the earlier blocks end later still
+			return -1
+		}
+		if k == 0 && !g.leadingStar {
+			start = i
+		}
+		pos = i + g.blocks[k].length
+	}
+	return start
+}
+
+// Contains reports whether the pattern occurs in haystack.
+func (g GlobSearcher) Contains(haystack string) bool {
+	return g.Index(haystack) >= 0
+}
+
+// index returns the first offset at or after pos where the block matches,
+// or -1.
+func (b *globBlock) index(haystack string, pos int, caseSensitive bool) int {
+	if b.anchor < 0 {
+		if len(haystack)-pos >= b.length {
+			return pos
+		}
+		return -1
+	}
+	a := &b.segs[b.anchor]
+	for from := pos + a.off; len(haystack)-from >= len(a.text); {
+		j := b.search.Index(haystack[from:])
+		if j < 0 {
+			return -1
+		}
+		start := from + j - a.off
+		if start+b.length > len(haystack) {
+			return -1
+		}
+		if b.matchAt(haystack, start, caseSensitive, b.anchor) {
+			return start
+		}
+		from += j + 1
+	}
+	return -1
+}
+
+// matchAt compares the segments other than skip (the anchor, or -1) at
+// offset i, which must leave room for the block.
+func (b *globBlock) matchAt(haystack string, i int, caseSensitive bool, skip int) bool {
+	for k, s := range b.segs {
+		if k == skip {
+			continue
+		}
+		t := haystack[i+s.off : i+s.off+len(s.text)]
+		if caseSensitive && t != s.text || !caseSensitive && !impl.equalFold(t, s.text) {
+			return false
+		}
+	}
+	return true
+}
@@ -0,0 +1,159 @@
+package ascii
+
+import "strings"
+
+// likePlan is the way a LikeMatcher evaluates its pattern.
+type likePlan uint8
+
+const (
+	likeGeneral  likePlan = iota // fixed head and tail, chained search for the middle
+	likeAll                      // '%': every string
+	likeEqual                    // 'abc'
+	likePrefix                   // 'abc%'
+	likeSuffix                   // '%abc'
+	likeContains                 // '%abc%'
+)
+
+// LikeMatcher evaluates a SQL LIKE pattern, or ILIKE if compiled without
+// case sensitivity: '%' matches any run of bytes, '_' any single byte and
+// '\' makes the next byte literal. Unlike a Searcher, the pattern must
+// match the whole string.
+//
+// CompileLike picks a plan by the shape of the pattern: a comparison for a
+// literal, HasPrefixFold or HasSuffixFold (or their case-sensitive
+// counterparts) for a literal with one '%' at the end or start, a Searcher
+// for a single literal between '%'s, and otherwise fixed-offset compares of
+// the parts before the first and after the last '%' followed by a chained
+// search for the parts in between, as in GlobSearcher.
+type LikeMatcher struct {
+	plan          likePlan
+	literal       string // likeEqual, likePrefix, likeSuffix
+	searcher      Searcher
+	head, tail    globBlock   // likeGeneral: the parts before the first and after the last '%'
+	middle        []globBlock // likeGeneral: the non-empty parts in between
+	exact         bool        // likeGeneral: no '%', so head is the whole pattern
+	minLen        int
+	caseSensitive bool
+}
+
+// CompileLike compiles a LIKE pattern. If caseSensitive is false it has
+// ILIKE semantics, folding ASCII letters only.
+func CompileLike(pattern string, caseSensitive bool) *LikeMatcher {
+	parts := globParts(pattern, '_', '%', caseSensitive)
+	m := &LikeMatcher{caseSensitive: caseSensitive}
+	for i := range parts {
+		m.minLen += parts[i].length
+	}
+
+	head, tail := &parts[0], &parts[len(parts)-1]
+	for i := 1; i < len(parts)-1; i++ {
+		if parts[i].length > 0 {
+			m.middle = append(m.middle, parts[i])
+		}
+	}
+	headText, headLiteral := head.literal()
+	tailText, tailLiteral := tail.literal()
+
+	switch {
+	case len(parts) == 1 && headLiteral:
+		m.plan, m.literal = likeEqual, headText
+	case len(parts) == 1:
+		m.head, m.exact = *head, true
+	case len(m.middle) == 0 && head.length == 0 && tail.length == 0:
+		m.plan = likeAll
+	case len(m.middle) == 0 && tail.length == 0 && headLiteral:
+		m.plan, m.literal = likePrefix, headText
+	case len(m.middle) == 0 && head.length == 0 && tailLiteral:
+		m.plan, m.literal = likeSuffix, tailText
+	case len(m.middle) == 1 && head.length == 0 && tail.length == 0 && m.middle[0].isLiteral():
+		m.plan, m.searcher = likeContains, m.middle[0].search
+	default:
+		m.head, m.tail = *head, *tail
+	}
+	return m
+}
+
+// Match reports whether s matches the pattern.
+func (m *LikeMatcher) Match(s string) bool {
+	switch m.plan {
+	case likeAll:
+		return true
+	case likeEqual:
+		if m.caseSensitive {
+			return s == m.literal
+		}
+		return EqualFold(s, m.literal)
+	case likePrefix:
+		if m.caseSensitive {
+			return strings.HasPrefix(s, m.literal)
+		}
+		return HasPrefixFold(s, m.literal)
+	case likeSuffix:
+		if m.caseSensitive {
+			return strings.HasSuffix(s, m.literal)
+		}
+		return HasSuffixFold(s, m.literal)
+	case likeContains:
+		return m.searcher.Index(s) >= 0
+	}
+
+	if len(s) < m.minLen || m.exact && len(s) != m.minLen {
+		return false
+	}
+	if !m.head.matchAt(s, 0, m.caseSensitive, -1) || !m.tail.matchAt(s, len(s)-m.tail.length, m.caseSensitive, -1) {
+		return false
+	}
+	// The middle parts in order between head and tail: taking the first
+	// match of each leaves the most room for the rest
+	s = s[:len(s)-m.tail.length]
+	pos := m.head.length
+	for i := range m.middle {
+		j := m.middle[i].index(s, pos, m.caseSensitive)
+		if j < 0 {
+			return false
+		}
+		pos = j + m.middle[i].length
+	}
+	return true
+}
+
+// MatchColumn evaluates the pattern over every row of a string column
+// stored Arrow-style, like BooleanSearch.MatchColumn: row i is
+// data[offsets[i]:offsets[i+1]], and bit i%64 of out[i/64] is set if row i
+// matches and cleared otherwise. out must hold at least (rows+63)/64 words.
+//
+// For '%abc%' the Searcher runs over the whole column at once and only the
+// rows it stops in are checked, so the rows in between are not searched
+// one by one.
+func (m *LikeMatcher) MatchColumn(data []byte, offsets []uint32, out []uint64) {
+	rows := len(offsets) - 1
+	if rows <= 0 {
+		return
+	}
+	_ = out[(rows-1)/64]
+
+	if m.plan != likeContains {
+		for i := 0; i < rows; i++ {
+			setBit(out, i, m.Match(bytesToString(data[offsets[i]:offsets[i+1]])))
+		}
+		return
+	}
+
+	for row := 0; row < rows; {
+		i := m.searcher.Index(bytesToString(data[offsets[row]:offsets[rows]]))
+		if i < 0 {
+			for ; row < rows; row++ {
+				setBit(out, row, false)
+			}
+			return
+		}
+		// Skip to the row the match starts in; it may run into the next
+		at := offsets[row] + uint32(i)
+		for offsets[row+1] <= at {
+			setBit(out, row, false)
+			row++
+		}
+		setBit(out, row, m.Match(bytesToString(data[offsets[row]:offsets[row+1]])))
+		row++
+	}
+}
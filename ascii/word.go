@@ -0,0 +1,115 @@
+package ascii
+
+// WordBoundary is the default boundary set for whole-word matching: every
+// byte except ASCII letters, digits and '_'.
+var WordBoundary = func() CharSet {
+	var cs CharSet
+	for c := 0; c < 256; c++ {
+		if !isAlpha(byte(c)) && !(c >= '0' && c <= '9') && c != '_' {
+			cs.bitset[c>>6] |= 1 << (c & 63)
+		}
+	}
+	return cs
+}()
+
+// Contains reports whether c is in the set.
+func (cs *CharSet) Contains(c byte) bool {
+	return cs.bitset[c>>6]&(1<<(c&63)) != 0
+}
+
+// wordFunc is a needleFunc that only accepts whole-word matches: the bytes
+// on either side of the match, where present, must be in boundary.
+type wordFunc func(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, boundary *[4]uint64) int
+
+// wordFromIndex builds a whole-word kernel for tiers without one, checking
+// the boundaries of each match and resuming the search after rejected ones.
+func wordFromIndex(index needleFunc) wordFunc {
+	return func(haystack string, rare1 byte, off1 int, rare2 byte, off2 int, needle string, boundary *[4]uint64) int {
+		for pos := 0; len(haystack)-pos >= len(needle); {
+			i := index(haystack[pos:], rare1, off1, rare2, off2, needle)
+			if i < 0 {
+				return -1
+			}
+			if isWordAt(haystack, pos+i, len(needle), boundary) {
+				return pos + i
+			}
+			pos += i + 1
+		}
+		return -1
+	}
+}
+
+// isWordAt reports whether the n bytes at i are a whole word: the bytes
+// around them are boundaries or the ends of haystack.
+func isWordAt(haystack string, i, n int, boundary *[4]uint64) bool {
+	return (i == 0 || boundary[haystack[i-1]>>6]&(1<<(haystack[i-1]&63)) != 0) &&
+		(i+n == len(haystack) || boundary[haystack[i+n]>>6]&(1<<(haystack[i+n]&63)) != 0)
+}
+
+// WholeWord returns a copy of the Searcher that only matches whole words:
+// occurrences whose neighbouring bytes are in boundary (usually
+// WordBoundary) or lie past either end of the haystack. With it,
+// NewSearcher("id", false).WholeWord(WordBoundary) finds "id" in "user id"
+// but not in "valid". An empty pattern still matches at every offset.
+//
+// On amd64 (AVX2 and up) Index checks the boundaries in the kernel's
+// verification step, so rejected occurrences do not leave the SIMD loop.
+// Elsewhere, NEON included, each match of the plain kernel is checked in Go
+// and the kernel is restarted after rejected ones.
+func (s Searcher) WholeWord(boundary CharSet) Searcher {
+	s.boundary = &boundary
+	return s
+}
+
+// wordIndex returns the first whole-word match at or after from, or -1.
+func (s Searcher) wordIndex(haystack string, from int) int {
+	for len(haystack)-from >= len(s.raw) {
+		var i int
+		if s.caseSensitive {
+			i = impl.indexWordExact(haystack[from:], s.rare1, s.off1, s.rare2, s.off2, s.raw, &s.boundary.bitset)
+		} else {
+			i = impl.searchWordFold(haystack[from:], s.rare1, s.off1, s.rare2, s.off2, s.norm, &s.boundary.bitset)
+		}
+		if i < 0 {
+			return -1
+		}
+		// The kernel sees the start of haystack[from:] as a boundary
+		if i > 0 || from == 0 || s.boundary.Contains(haystack[from-1]) {
+			return from + i
+		}
+		from++
+	}
+	return -1
+}
+
+// wordLastIndex returns the last whole-word match, or -1.
+func (s Searcher) wordLastIndex(haystack string) int {
+	for end := len(haystack); end >= len(s.raw); {
+		var i int
+		if s.caseSensitive {
+			i = impl.lastIndexExact(haystack[:end], s.rare1, s.off1, s.rare2, s.off2, s.raw)
+		} else {
+			i = impl.lastSearchNeedleFold(haystack[:end], s.rare1, s.off1, s.rare2, s.off2, s.norm)
+		}
+		if i < 0 {
+			return -1
+		}
+		if isWordAt(haystack, i, len(s.raw), &s.boundary.bitset) {
+			return i
+		}
+		end = i + len(s.raw) - 1
+	}
+	return -1
+}
+
+// wordAll calls yield with the offsets of the non-overlapping whole-word
+// matches until it returns false.
+func (s Searcher) wordAll(haystack string, yield func(int) bool) {
+	for pos := 0; ; {
+		i := s.wordIndex(haystack, pos)
+		if i < 0 || !yield(i) {
+			return
+		}
+		pos = i + len(s.raw)
+	}
+}
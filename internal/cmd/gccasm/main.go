@@ -0,0 +1,932 @@
+// Command gccasm compiles the amd64 C kernels with gcc and emits Go
+// assembly in the layout gocc produces: one TEXT block per function
+// annotated with a "// gocc: name(args) ret" comment, plus the Go
+// declarations for them.
+//
+// Each instruction is disassembled with objdump and translated to Go
+// syntax when the Go assembler encodes the translation to the same bytes;
+// the others are kept as raw LONG/WORD/BYTE sequences. It needs gcc,
+// binutils objdump and the go command on PATH.
+//
+// Usage, from the package directory (see generate.go):
+//
+//	go run ../internal/cmd/gccasm -p ascii -o ./ -a avx2 csrc/ascii_avx2.c
+package main
+
+import (
+	"bufio"
+	"bytes"
+	"debug/elf"
+	"encoding/binary"
+	"flag"
+	"fmt"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"regexp"
+	"sort"
+	"strconv"
+	"strings"
+)
+
+type goArg struct {
+	name, typ string
+}
+
+type fnSpec struct {
+	goName  string
+	args    []goArg
+	ret     string
+	cName   string
+	cParams []string
+}
+
+var (
+	flagPkg   = flag.String("p", "", "package")
+	flagOut   = flag.String("o", "./", "output dir")
+	flagArch  = flag.String("a", "avx2", "arch: amd64|avx2|avx512")
+	flagOpt   = flag.String("O", "3", "opt level")
+	flagExtra = flag.String("m", "", "extra -m flags, comma separated")
+	flagKeep  = flag.Bool("keep", false, "keep temp files")
+	flagTags  = flag.String("tags", "!noasm && amd64", "build tags")
+)
+
+func die(f string, a ...any) {
+	fmt.Fprintf(os.Stderr, f+"\n", a...)
+	os.Exit(1)
+}
+
+func main() {
+	flag.Parse()
+	if flag.NArg() != 1 {
+		die("usage: gccasm [flags] file.c")
+	}
+	src := flag.Arg(0)
+	specs := parseSpecs(src)
+	if len(specs) == 0 {
+		die("no gocc annotations in %s", src)
+	}
+
+	archFlags := []string{}
+	switch *flagArch {
+	case "amd64":
+	case "avx2":
+		archFlags = append(archFlags, "-mavx2", "-mfma", "-mpopcnt")
+	case "avx512":
+		archFlags = append(archFlags, "-mavx512f", "-mavx512bw", "-mavx512vl", "-mavx512vbmi", "-mavx2", "-mfma", "-mpopcnt")
+	default:
+		die("bad arch")
+	}
+	for _, m := range strings.Split(*flagExtra, ",") {
+		if m != "" {
+			archFlags = append(archFlags, m)
+		}
+	}
+
+	tmp, err := os.MkdirTemp("", "gccasm")
+	if err != nil {
+		die("%v", err)
+	}
+	if !*flagKeep {
+		defer os.RemoveAll(tmp)
+	} else {
+		fmt.Fprintln(os.Stderr, "tmp:", tmp)
+	}
+	obj := filepath.Join(tmp, "out.o")
+	args := []string{"-O" + *flagOpt}
+	args = append(args, archFlags...)
+	args = append(args,
+		"-mno-red-zone", "-mincoming-stack-boundary=3",
+		"-fno-asynchronous-unwind-tables", "-fno-unwind-tables",
+		"-fno-stack-protector", "-fcf-protection=none", "-fno-jump-tables",
+		"-fno-reorder-blocks-and-partition", "-fno-exceptions", "-fPIC", "-fno-plt",
+		"-fno-ipa-cp-clone", "-fno-ipa-sra", "-fno-ipa-cp", "-fno-partial-inlining",
+		"-fno-tree-loop-distribute-patterns", "-fno-tree-vectorize", "-fno-tree-slp-vectorize",
+		"-c", "-o", obj, src)
+	cmd := exec.Command("gcc", args...)
+	cmd.Stderr = os.Stderr
+	if err := cmd.Run(); err != nil {
+		die("gcc failed: %v", err)
+	}
+
+	ef, err := elf.Open(obj)
+	if err != nil {
+		die("%v", err)
+	}
+	syms, _ := ef.Symbols()
+	text := ef.Section(".text")
+	if text == nil {
+		die("no .text")
+	}
+	for _, s := range ef.Sections {
+		if strings.HasPrefix(s.Name, ".text") && s.Name != ".text" && s.Size > 0 {
+			die("unexpected section %s", s.Name)
+		}
+	}
+	relocs := readRelocs(ef, ".rela.text")
+
+	insts := disassemble(obj)
+
+	ctx := &emitCtx{ef: ef, syms: syms, dataNames: map[dataKey]string{}}
+	var body strings.Builder
+	var goStubs strings.Builder
+	for fi, spec := range specs {
+		var sym *elf.Symbol
+		for i := range syms {
+			if syms[i].Name == spec.cName && elf.ST_TYPE(syms[i].Info) == elf.STT_FUNC {
+				sym = &syms[i]
+			}
+		}
+		if sym == nil {
+			die("function %s not found in object", spec.cName)
+		}
+		var fn []inst
+		for _, in := range insts {
+			if in.addr >= sym.Value && in.addr < sym.Value+sym.Size {
+				fn = append(fn, in)
+			}
+		}
+		var fb strings.Builder
+		ctx.data.Reset()
+		ctx.emitFunc(&fb, fi, spec, fn, relocs)
+		body.WriteString(ctx.data.String())
+		body.WriteString(fb.String())
+		fmt.Fprintf(&goStubs, "\n//go:noescape\nfunc %s(%s)", spec.goName, goArgList(spec.args))
+		if spec.ret != "" {
+			fmt.Fprintf(&goStubs, " %s", spec.ret)
+		}
+		goStubs.WriteString("\n")
+	}
+
+	base := strings.TrimSuffix(filepath.Base(src), ".c")
+	ver := gccVersion()
+	opts := strings.Join(archFlags, " ")
+	if opts == "" {
+		opts = "[none]"
+	}
+	var out strings.Builder
+	fmt.Fprintf(&out, "//go:build %s\n", *flagTags)
+	out.WriteString("// Code generated by gccasm -- DO NOT EDIT.\n//\n")
+	fmt.Fprintf(&out, "// Source file         : %s.c\n", base)
+	fmt.Fprintf(&out, "// Compiler version    : %s\n", ver)
+	out.WriteString("// Target architecture : amd64\n")
+	fmt.Fprintf(&out, "// Compiler options    : %s\n\n", opts)
+	out.WriteString("#include \"textflag.h\"\n\n")
+	out.WriteString(strings.TrimRight(body.String(), "\n") + "\n")
+
+	if err := os.WriteFile(filepath.Join(*flagOut, base+".s"), []byte(out.String()), 0o644); err != nil {
+		die("%v", err)
+	}
+	stub := fmt.Sprintf("//go:build %s\n// Code generated by gccasm -- DO NOT EDIT.\n\npackage %s\n\n%s", *flagTags, *flagPkg, goStubs.String())
+	if err := os.WriteFile(filepath.Join(*flagOut, base+".go"), []byte(stub), 0o644); err != nil {
+		die("%v", err)
+	}
+}
+
+func gccVersion() string {
+	out, _ := exec.Command("gcc", "--version").Output()
+	line, _, _ := strings.Cut(string(out), "\n")
+	return strings.TrimSpace(line)
+}
+
+func goArgList(args []goArg) string {
+	var parts []string
+	for _, a := range args {
+		parts = append(parts, a.name+" "+a.typ)
+	}
+	return strings.Join(parts, ", ")
+}
+
+var reGocc = regexp.MustCompile(`^\s*//\s*gocc:\s*(\w+)\((.*)\)\s*(.*)$`)
+var reFuncName = regexp.MustCompile(`(\w+)\s*\($`)
+
+func parseSpecs(path string) []fnSpec {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		die("%v", err)
+	}
+	lines := strings.Split(string(data), "\n")
+	var specs []fnSpec
+	for i := 0; i < len(lines); i++ {
+		m := reGocc.FindStringSubmatch(lines[i])
+		if m == nil {
+			continue
+		}
+		spec := fnSpec{goName: m[1], ret: strings.TrimSpace(m[3])}
+		// parse go args: "a, b string, c int"
+		var pending []string
+		for _, part := range splitTop(m[2]) {
+			part = strings.TrimSpace(part)
+			if part == "" {
+				continue
+			}
+			f := strings.Fields(part)
+			if len(f) == 1 {
+				pending = append(pending, f[0])
+				continue
+			}
+			typ := strings.Join(f[1:], " ")
+			for _, p := range pending {
+				spec.args = append(spec.args, goArg{p, typ})
+			}
+			pending = nil
+			spec.args = append(spec.args, goArg{f[0], typ})
+		}
+		if len(pending) > 0 {
+			die("bad gocc args: %s", lines[i])
+		}
+		// find C function definition
+		j := i + 1
+		for ; j < len(lines); j++ {
+			l := strings.TrimSpace(lines[j])
+			if l == "" || strings.HasPrefix(l, "//") {
+				continue
+			}
+			break
+		}
+		sig := ""
+		for ; j < len(lines); j++ {
+			sig += " " + strings.TrimSpace(lines[j])
+			if strings.Contains(lines[j], ")") {
+				break
+			}
+		}
+		open := strings.Index(sig, "(")
+		closeIdx := strings.Index(sig, ")")
+		nm := reFuncName.FindStringSubmatch(strings.TrimSpace(sig[:open+1]))
+		if nm == nil {
+			die("cannot find C function after %s", lines[i])
+		}
+		spec.cName = nm[1]
+		for _, p := range strings.Split(sig[open+1:closeIdx], ",") {
+			p = strings.TrimSpace(p)
+			if p == "" || p == "void" {
+				continue
+			}
+			f := strings.FieldsFunc(p, func(r rune) bool { return r == ' ' || r == '*' || r == '\t' })
+			spec.cParams = append(spec.cParams, f[len(f)-1])
+		}
+		specs = append(specs, spec)
+	}
+	return specs
+}
+
+func splitTop(s string) []string {
+	var out []string
+	depth := 0
+	start := 0
+	for i, c := range s {
+		switch c {
+		case '[', '(', '{':
+			depth++
+		case ']', ')', '}':
+			depth--
+		case ',':
+			if depth == 0 {
+				out = append(out, s[start:i])
+				start = i + 1
+			}
+		}
+	}
+	out = append(out, s[start:])
+	return out
+}
+
+type reloc struct {
+	off    uint64
+	typ    elf.R_X86_64
+	sym    uint32
+	addend int64
+}
+
+func readRelocs(ef *elf.File, name string) []reloc {
+	s := ef.Section(name)
+	if s == nil {
+		return nil
+	}
+	data, err := s.Data()
+	if err != nil {
+		die("%v", err)
+	}
+	var out []reloc
+	for i := 0; i+24 <= len(data); i += 24 {
+		off := binary.LittleEndian.Uint64(data[i:])
+		info := binary.LittleEndian.Uint64(data[i+8:])
+		add := int64(binary.LittleEndian.Uint64(data[i+16:]))
+		out = append(out, reloc{off, elf.R_X86_64(info & 0xffffffff), uint32(info >> 32), add})
+	}
+	return out
+}
+
+type inst struct {
+	addr  uint64
+	bytes []byte
+	mnem  string
+	ops   string
+	text  string
+}
+
+var reInst = regexp.MustCompile(`^\s*([0-9a-f]+):\t((?:[0-9a-f]{2} )+)\s*\t(.*)$`)
+
+func disassemble(obj string) []inst {
+	out, err := exec.Command("objdump", "-d", "-w", "-M", "intel", "--insn-width=16", "--no-addresses=no", obj).Output()
+	if err != nil {
+		out, err = exec.Command("objdump", "-d", "-w", "-M", "intel", "--insn-width=16", obj).Output()
+		if err != nil {
+			die("objdump: %v", err)
+		}
+	}
+	var res []inst
+	sc := bufio.NewScanner(bytes.NewReader(out))
+	for sc.Scan() {
+		m := reInst.FindStringSubmatch(sc.Text())
+		if m == nil {
+			continue
+		}
+		addr, _ := strconv.ParseUint(m[1], 16, 64)
+		var bs []byte
+		for _, h := range strings.Fields(m[2]) {
+			v, _ := strconv.ParseUint(h, 16, 8)
+			bs = append(bs, byte(v))
+		}
+		text := m[3]
+		if i := strings.Index(text, "#"); i >= 0 {
+			text = text[:i]
+		}
+		text = strings.TrimSpace(text)
+		mn, ops, _ := strings.Cut(text, " ")
+		ops = strings.TrimSpace(ops)
+		// prefixes
+		for mn == "rep" || mn == "repz" || mn == "lock" || mn == "data16" || mn == "cs" || mn == "ds" || mn == "notrack" || mn == "bnd" {
+			if mn == "repz" && ops == "ret" {
+				break
+			}
+			mn, ops, _ = strings.Cut(ops, " ")
+			ops = strings.TrimSpace(ops)
+		}
+		res = append(res, inst{addr: addr, bytes: bs, mnem: mn, ops: ops, text: text})
+	}
+	return res
+}
+
+type dataKey struct {
+	sec uint16
+	off uint64
+}
+
+type emitCtx struct {
+	ef        *elf.File
+	syms      []elf.Symbol
+	data      strings.Builder
+	dataNames map[dataKey]string
+	symData   map[string]bool
+}
+
+type line struct {
+	label   string // if non-empty, this is a label line
+	blank   bool
+	mnem    string
+	ops     string
+	comment string // "<--" or go syntax
+	orig    string
+	noOrig  bool
+}
+
+func (c *emitCtx) emitFunc(w *strings.Builder, fi int, spec fnSpec, fn []inst, relocs []reloc) {
+	if len(fn) == 0 {
+		die("empty function %s", spec.cName)
+	}
+	// argument layout
+	type slot struct {
+		name string
+		off  int
+		size int
+	}
+	var slots []slot
+	off := 0
+	for _, a := range spec.args {
+		switch {
+		case a.typ == "string":
+			off = align(off, 8)
+			slots = append(slots, slot{a.name, off, 8}, slot{a.name + "_len", off + 8, 8})
+			off += 16
+		case strings.HasPrefix(a.typ, "[]"):
+			off = align(off, 8)
+			slots = append(slots, slot{a.name, off, 8}, slot{a.name + "_len", off + 8, 8}, slot{a.name + "_cap", off + 16, 8})
+			off += 24
+		case a.typ == "byte" || a.typ == "uint8" || a.typ == "bool" || a.typ == "int8":
+			slots = append(slots, slot{a.name, off, 1})
+			off += 1
+		case a.typ == "uint32" || a.typ == "int32":
+			off = align(off, 4)
+			slots = append(slots, slot{a.name, off, 4})
+			off += 4
+		case a.typ == "uint16" || a.typ == "int16":
+			off = align(off, 2)
+			slots = append(slots, slot{a.name, off, 2})
+			off += 2
+		default:
+			off = align(off, 8)
+			slots = append(slots, slot{a.name, off, 8})
+			off += 8
+		}
+	}
+	if len(slots) != len(spec.cParams) {
+		die("%s: go args expand to %d params, C has %d", spec.goName, len(slots), len(spec.cParams))
+	}
+	retOff := align(off, 8)
+	retSize := 0
+	switch spec.ret {
+	case "":
+	case "bool", "byte", "uint8", "int8":
+		retSize = 1
+	case "uint32", "int32":
+		retSize = 4
+	default:
+		retSize = 8
+	}
+	argSize := retOff + retSize
+	if spec.ret == "" {
+		argSize = off
+	}
+
+	// stack usage
+	stackUse := 0
+	for _, in := range fn {
+		switch in.mnem {
+		case "push":
+			stackUse += 8
+		case "sub":
+			if strings.HasPrefix(in.ops, "rsp,") {
+				v, err := strconv.ParseInt(strings.TrimPrefix(in.ops[4:], "0x"), 16, 64)
+				if err == nil {
+					stackUse += int(v)
+				}
+			}
+		case "and":
+			if strings.HasPrefix(in.ops, "rsp,") {
+				stackUse += 64
+			}
+		case "call":
+			die("%s: calls are not supported: %s", spec.cName, in.text)
+		}
+	}
+	nStack := 0
+	if len(slots) > 6 {
+		nStack = len(slots) - 6
+	}
+	frame := 0
+	if nStack > 0 || stackUse > 0 {
+		frame = align(8*(nStack+1)+stackUse, 8)
+	}
+
+	// labels
+	labels := map[uint64]string{}
+	start, end := fn[0].addr, fn[len(fn)-1].addr+uint64(len(fn[len(fn)-1].bytes))
+	var targets []uint64
+	for _, in := range fn {
+		if isBranch(in.mnem) {
+			t, ok := branchTarget(in.ops)
+			if !ok {
+				die("%s: indirect branch %s", spec.cName, in.text)
+			}
+			if t < start || t >= end {
+				die("%s: branch out of function: %s", spec.cName, in.text)
+			}
+			targets = append(targets, t)
+		}
+	}
+	sort.Slice(targets, func(i, j int) bool { return targets[i] < targets[j] })
+	n := 0
+	for _, t := range targets {
+		if _, ok := labels[t]; !ok {
+			labels[t] = fmt.Sprintf("LBB%d_%d", fi, n)
+			n++
+		}
+	}
+
+	var lines []line
+	regs := []string{"DI", "SI", "DX", "CX", "R8", "R9"}
+	for i, s := range slots {
+		var mn string
+		switch s.size {
+		case 1:
+			mn = "MOVBQZX"
+		case 2:
+			mn = "MOVWQZX"
+		case 4:
+			mn = "MOVL"
+		default:
+			mn = "MOVQ"
+		}
+		if i < 6 {
+			lines = append(lines, line{mnem: mn, ops: fmt.Sprintf("%s+%d(FP), %s", s.name, s.off, regs[i]), noOrig: true})
+		} else {
+			lines = append(lines, line{mnem: mn, ops: fmt.Sprintf("%s+%d(FP), AX", s.name, s.off), noOrig: true})
+			lines = append(lines, line{mnem: "MOVQ", ops: fmt.Sprintf("AX, %d(SP)", 8*(i-6+1)), noOrig: true})
+		}
+	}
+
+	// candidates for native translation
+	type cand struct {
+		idx   int
+		goStr string
+		bytes []byte
+		rip   bool
+	}
+	var cands []cand
+	pending := map[int]*line{}
+	seenRet := false
+	for _, in := range fn {
+		if lbl, ok := labels[in.addr]; ok {
+			lines = append(lines, line{blank: true}, line{label: lbl})
+		}
+		orig := intelText(in)
+		switch {
+		case in.mnem == "ret" || (in.mnem == "repz" && in.ops == "ret"):
+			if retSize > 0 {
+				var mn string
+				switch retSize {
+				case 1:
+					mn = "MOVB"
+				case 4:
+					mn = "MOVL"
+				default:
+					mn = "MOVQ"
+				}
+				lines = append(lines, line{mnem: mn, ops: fmt.Sprintf("AX, ret+%d(FP)", retOff), comment: "<--", noOrig: true})
+			}
+			lines = append(lines, line{mnem: "RET", comment: "<--", orig: "ret"}, line{blank: true})
+			seenRet = true
+			continue
+		case isBranch(in.mnem):
+			t, _ := branchTarget(in.ops)
+			lines = append(lines, line{mnem: goBranch(in.mnem), ops: labels[t], comment: "<--", orig: in.mnem + "\t" + "." + labels[t]})
+			continue
+		case isNopPad(in):
+			continue
+		case in.mnem == "leave" && !seenRet:
+			// No LEAVE in the Go assembler; spell it out so the POP is tracked
+			lines = append(lines, line{mnem: "MOVQ", ops: "BP, SP", comment: "<--", orig: "leave"},
+				line{mnem: "POPQ", ops: "BP", comment: "<--", noOrig: true})
+			continue
+		}
+		// relocations within this instruction
+		var rel *reloc
+		for i := range relocs {
+			r := &relocs[i]
+			if r.off >= in.addr && r.off < in.addr+uint64(len(in.bytes)) {
+				rel = r
+			}
+		}
+		if rel != nil {
+			if rel.typ != elf.R_X86_64_PC32 && rel.typ != elf.R_X86_64_PLT32 {
+				die("%s: unsupported relocation %v in %s", spec.cName, rel.typ, in.text)
+			}
+			next := in.addr + uint64(len(in.bytes))
+			sym := c.syms[rel.sym-1]
+			target := sym.Value + uint64(rel.addend) + (next - rel.off)
+			name := c.dataSymbol(fi, sym, target)
+			goStr, ok := toGo(in, name)
+			if !ok {
+				die("%s: cannot translate rip-relative instruction %q", spec.cName, in.text)
+			}
+			lines = append(lines, line{mnem: goStr, comment: "<--", orig: orig})
+			cands = append(cands, cand{len(lines) - 1, goStr, in.bytes, true})
+			continue
+		}
+		goStr, ok := toGo(in, "")
+		// The assembler tracks PUSH/POP linearly, so epilogues after the
+		// first RET must stay raw to keep its SP bookkeeping balanced.
+		if seenRet && (in.mnem == "push" || in.mnem == "pop") {
+			ok = false
+		}
+		lines = append(lines, line{mnem: "", ops: "", comment: goStr, orig: orig})
+		idx := len(lines) - 1
+		pending[idx] = &lines[idx]
+		lines[idx].mnem = rawBytes(in.bytes)
+		if ok {
+			cands = append(cands, cand{idx, goStr, in.bytes, false})
+		}
+		if !ok && goStr == "" {
+			lines[idx].comment = strings.ToUpper(in.mnem)
+		}
+	}
+
+	// verify candidates by assembling them
+	for {
+		var src strings.Builder
+		src.WriteString("#include \"textflag.h\"\n")
+		names := map[string]bool{}
+		for _, cd := range cands {
+			if cd.rip {
+				for _, f := range strings.FieldsFunc(cd.goStr, func(r rune) bool { return r == ' ' || r == ',' }) {
+					if i := strings.Index(f, "<>"); i >= 0 {
+						names[f[:i]] = true
+					}
+				}
+			}
+		}
+		for nm := range names {
+			fmt.Fprintf(&src, "DATA %s<>+0(SB)/8, $0\nGLOBL %s<>(SB), (RODATA|NOPTR), $64\n", nm, nm)
+		}
+		for i, cd := range cands {
+			fmt.Fprintf(&src, "TEXT ·c%d(SB), NOSPLIT, $0\n\t%s\n", i, cd.goStr)
+		}
+		res, badLines, err := assemble(src.String())
+		if err != nil {
+			if len(badLines) == 0 {
+				die("asm verify failed: %.2000v", err)
+			}
+			drop := map[int]bool{}
+			for _, badLine := range badLines {
+				// line numbering: 1 include + 2*names + 2*i+1
+				ci := (badLine - 2 - 2*len(names) - 1) / 2
+				if ci < 0 || ci >= len(cands) {
+					die("asm verify failed at line %d: %.2000v", badLine, err)
+				}
+				if cands[ci].rip {
+					die("%s: rip-relative translation rejected by assembler: %s (%.500v)", spec.cName, cands[ci].goStr, err)
+				}
+				drop[ci] = true
+			}
+			var kept []cand
+			for i, cd := range cands {
+				if !drop[i] {
+					kept = append(kept, cd)
+				}
+			}
+			cands = kept
+			continue
+		}
+		for i, cd := range cands {
+			got := res[fmt.Sprintf("c%d", i)]
+			if bytes.Equal(got, cd.bytes) {
+				if !cd.rip {
+					l := &lines[cd.idx]
+					l.mnem = cd.goStr
+					l.comment = "<--"
+				}
+			} else if cd.rip && !(len(got) == len(cd.bytes) && isUnalignedRewrite(cd.goStr)) {
+				die("%s: rip-relative translation mismatch: %s got % x want % x", spec.cName, cd.goStr, got, cd.bytes)
+			}
+		}
+		break
+	}
+
+	// split mnemonic/operands
+	for i := range lines {
+		l := &lines[i]
+		if l.label != "" || l.blank || l.ops != "" {
+			continue
+		}
+		if strings.HasPrefix(l.mnem, "LONG") || strings.HasPrefix(l.mnem, "WORD") || strings.HasPrefix(l.mnem, "BYTE") || strings.HasPrefix(l.mnem, "QUAD") {
+			mn, rest, _ := strings.Cut(l.mnem, " ")
+			l.mnem, l.ops = mn, rest
+			continue
+		}
+		mn, rest, _ := strings.Cut(l.mnem, " ")
+		l.mnem, l.ops = mn, strings.TrimSpace(rest)
+	}
+
+	fmt.Fprintf(w, "TEXT ·%s(SB), NOSPLIT, $%d-%d\n", spec.goName, frame, argSize)
+	var tb strings.Builder
+	writeBlocks(&tb, lines)
+	w.WriteString(strings.TrimRight(tb.String(), "\n") + "\n\n")
+}
+
+func writeBlocks(w *strings.Builder, lines []line) {
+	i := 0
+	lastBlank := true
+	for i < len(lines) {
+		if lines[i].blank {
+			if !lastBlank {
+				w.WriteString("\n")
+			}
+			lastBlank = true
+			i++
+			continue
+		}
+		lastBlank = false
+		if lines[i].label != "" {
+			fmt.Fprintf(w, "%s:\n", lines[i].label)
+			i++
+			continue
+		}
+		j := i
+		for j < len(lines) && !lines[j].blank && lines[j].label == "" {
+			j++
+		}
+		block := lines[i:j]
+		mw := 0
+		for _, l := range block {
+			if len(l.mnem) > mw {
+				mw = len(l.mnem)
+			}
+		}
+		iw := 0
+		strs := make([]string, len(block))
+		for k, l := range block {
+			s := l.mnem
+			if l.ops != "" {
+				s = fmt.Sprintf("%-*s %s", mw, l.mnem, l.ops)
+			}
+			strs[k] = s
+			if l.comment != "" || !l.noOrig {
+				if len(s) > iw {
+					iw = len(s)
+				}
+			}
+		}
+		for k, l := range block {
+			s := strs[k]
+			if l.comment == "" && l.noOrig {
+				fmt.Fprintf(w, "\t%s\n", s)
+				continue
+			}
+			if l.noOrig {
+				fmt.Fprintf(w, "\t%-*s // %s\n", iw, s, l.comment)
+				continue
+			}
+			fmt.Fprintf(w, "\t%-*s // %-36s // %s\n", iw, s, l.comment, l.orig)
+		}
+		i = j
+	}
+}
+
+func rawBytes(b []byte) string {
+	var parts []string
+	for len(b) >= 4 {
+		parts = append(parts, fmt.Sprintf("LONG $0x%08x", binary.LittleEndian.Uint32(b)))
+		b = b[4:]
+	}
+	if len(b) >= 2 {
+		parts = append(parts, fmt.Sprintf("WORD $0x%04x", binary.LittleEndian.Uint16(b)))
+		b = b[2:]
+	}
+	if len(b) == 1 {
+		parts = append(parts, fmt.Sprintf("BYTE $0x%02x", b[0]))
+	}
+	// strip leading zeros similar to gocc ($0x4f6ffec5)
+	for i, p := range parts {
+		mn, v, _ := strings.Cut(p, " $0x")
+		v = strings.TrimLeft(v, "0")
+		if v == "" {
+			v = "0"
+		}
+		parts[i] = mn + " $0x" + v
+	}
+	return strings.Join(parts, "; ")
+}
+
+func align(x, a int) int { return (x + a - 1) / a * a }
+
+func isBranch(m string) bool {
+	return m == "jmp" || (strings.HasPrefix(m, "j") && m != "jmp")
+}
+
+func branchTarget(ops string) (uint64, bool) {
+	f := strings.Fields(ops)
+	if len(f) == 0 {
+		return 0, false
+	}
+	v, err := strconv.ParseUint(f[0], 16, 64)
+	return v, err == nil
+}
+
+var branchMap = map[string]string{
+	"jmp": "JMP", "je": "JE", "jz": "JE", "jne": "JNE", "jnz": "JNE",
+	"jb": "JB", "jc": "JB", "jnae": "JB", "jae": "JAE", "jnb": "JAE", "jnc": "JAE",
+	"jbe": "JBE", "jna": "JBE", "ja": "JA", "jnbe": "JA",
+	"jl": "JL", "jnge": "JL", "jge": "JGE", "jnl": "JGE", "jle": "JLE", "jng": "JLE", "jg": "JG", "jnle": "JG",
+	"js": "JS", "jns": "JNS", "jo": "JO", "jno": "JNO", "jp": "JP", "jpe": "JP", "jnp": "JNP", "jpo": "JNP",
+}
+
+func goBranch(m string) string {
+	if g, ok := branchMap[m]; ok {
+		return g
+	}
+	die("unknown branch %s", m)
+	return ""
+}
+
+func isNopPad(in inst) bool {
+	return in.mnem == "nop" || in.mnem == "xchg" && in.ops == "ax,ax" || strings.HasPrefix(in.text, "data16") || strings.HasPrefix(in.text, "cs nop")
+}
+
+func (c *emitCtx) dataSymbol(fi int, sym elf.Symbol, target uint64) string {
+	sec := c.ef.Sections[sym.Section]
+	// named object covering target?
+	for _, s := range c.syms {
+		if s.Section == sym.Section && elf.ST_TYPE(s.Info) == elf.STT_OBJECT && target >= s.Value && target < s.Value+s.Size {
+			name := strings.ReplaceAll(s.Name, ".", "_")
+			if c.symData == nil {
+				c.symData = map[string]bool{}
+			}
+			if !c.symData[name] {
+				c.symData[name] = true
+				data, _ := sec.Data()
+				c.writeData(name, data[s.Value:s.Value+s.Size])
+			}
+			if target == s.Value {
+				return name + "<>(SB)"
+			}
+			return fmt.Sprintf("%s<>+%d(SB)", name, target-s.Value)
+		}
+	}
+	key := dataKey{uint16(sym.Section), target}
+	if nm, ok := c.dataNames[key]; ok {
+		return nm + "<>(SB)"
+	}
+	size := sec.Entsize
+	data, _ := sec.Data()
+	if size == 0 {
+		// anonymous data in non-merge section: take until the end of the section
+		size = uint64(len(data)) - target
+	}
+	k := 0
+	for _, nm := range c.dataNames {
+		if strings.HasPrefix(nm, fmt.Sprintf("LCPI%d_", fi)) {
+			k++
+		}
+	}
+	name := fmt.Sprintf("LCPI%d_%d", fi, k)
+	c.dataNames[key] = name
+	c.writeData(name, data[target:target+size])
+	return name + "<>(SB)"
+}
+
+func (c *emitCtx) writeData(name string, b []byte) {
+	off := 0
+	for len(b) > 0 {
+		switch {
+		case len(b) >= 8:
+			fmt.Fprintf(&c.data, "DATA %s<>+0x%02x(SB)/8, $0x%016x\n", name, off, binary.LittleEndian.Uint64(b))
+			b, off = b[8:], off+8
+		case len(b) >= 4:
+			fmt.Fprintf(&c.data, "DATA %s<>+0x%02x(SB)/4, $0x%08x\n", name, off, binary.LittleEndian.Uint32(b))
+			b, off = b[4:], off+4
+		case len(b) >= 2:
+			fmt.Fprintf(&c.data, "DATA %s<>+0x%02x(SB)/2, $0x%04x\n", name, off, binary.LittleEndian.Uint16(b))
+			b, off = b[2:], off+2
+		default:
+			fmt.Fprintf(&c.data, "DATA %s<>+0x%02x(SB)/1, $0x%02x\n", name, off, b[0])
+			b, off = b[1:], off+1
+		}
+	}
+	fmt.Fprintf(&c.data, "GLOBL %s<>(SB), (RODATA|NOPTR), $%d\n\n", name, off)
+}
+
+var reAsmErr = regexp.MustCompile(`invalid instruction.*\.s:(\d+)\)|\.s:(\d+): `)
+
+func assemble(src string) (map[string][]byte, []int, error) {
+	dir, _ := os.MkdirTemp("", "gccasm-asm")
+	defer os.RemoveAll(dir)
+	f := filepath.Join(dir, "v.s")
+	os.WriteFile(f, []byte(src), 0o644)
+	goroot, _ := exec.Command("go", "env", "GOROOT").Output()
+	cmd := exec.Command("go", "tool", "asm", "-p", "main", "-I", filepath.Join(strings.TrimSpace(string(goroot)), "pkg", "include"), "-S", "-o", filepath.Join(dir, "v.o"), f)
+	cmd.Env = append(os.Environ(), "GOARCH=amd64")
+	var stderr bytes.Buffer
+	cmd.Stderr = &stderr
+	out, err := cmd.Output()
+	if err != nil {
+		msg := stderr.String() + string(out)
+		var bad []int
+		for _, l := range strings.Split(msg, "\n") {
+			if m := reAsmErr.FindStringSubmatch(l); m != nil {
+				n, _ := strconv.Atoi(m[1] + m[2])
+				bad = append(bad, n)
+			}
+		}
+		return nil, bad, fmt.Errorf("%s", msg)
+	}
+	res := map[string][]byte{}
+	var cur string
+	reHead := regexp.MustCompile(`^"".(c\d+) STEXT|^main\.(c\d+) STEXT`)
+	reHex := regexp.MustCompile(`^\t0x[0-9a-f]{4} ((?:[0-9a-f]{2} )+)`)
+	for _, l := range strings.Split(string(out), "\n") {
+		if m := reHead.FindStringSubmatch(l); m != nil {
+			cur = m[1] + m[2]
+			continue
+		}
+		if m := reHex.FindStringSubmatch(l); m != nil && cur != "" {
+			for _, h := range strings.Fields(m[1]) {
+				v, _ := strconv.ParseUint(h, 16, 8)
+				res[cur] = append(res[cur], byte(v))
+			}
+		}
+	}
+	return res, nil, nil
+}
+
+// isUnalignedRewrite reports whether goStr is an aligned load that toGo
+// deliberately turned into its unaligned form.
+func isUnalignedRewrite(goStr string) bool {
+	for _, u := range unalignedMove {
+		if strings.HasPrefix(goStr, u+" ") {
+			return true
+		}
+	}
+	return false
+}
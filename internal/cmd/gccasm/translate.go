@@ -0,0 +1,407 @@
+package main
+
+import (
+	"fmt"
+	"regexp"
+	"strconv"
+	"strings"
+)
+
+var gpRegs = map[string]struct {
+	name string
+	size int
+}{}
+
+func init() {
+	add := func(n string, g string, sz int) {
+		gpRegs[n] = struct {
+			name string
+			size int
+		}{g, sz}
+	}
+	base := []struct{ q, d, w, b, g string }{
+		{"rax", "eax", "ax", "al", "AX"}, {"rbx", "ebx", "bx", "bl", "BX"},
+		{"rcx", "ecx", "cx", "cl", "CX"}, {"rdx", "edx", "dx", "dl", "DX"},
+		{"rsi", "esi", "si", "sil", "SI"}, {"rdi", "edi", "di", "dil", "DI"},
+		{"rbp", "ebp", "bp", "bpl", "BP"}, {"rsp", "esp", "sp", "spl", "SP"},
+	}
+	for _, r := range base {
+		add(r.q, r.g, 8)
+		add(r.d, r.g, 4)
+		add(r.w, r.g, 2)
+		add(r.b, r.g, 1)
+	}
+	for i := 8; i < 16; i++ {
+		g := fmt.Sprintf("R%d", i)
+		add(fmt.Sprintf("r%d", i), g, 8)
+		add(fmt.Sprintf("r%dd", i), g, 4)
+		add(fmt.Sprintf("r%dw", i), g, 2)
+		add(fmt.Sprintf("r%db", i), g, 1)
+	}
+	add("ah", "AH", 1)
+	add("bh", "BH", 1)
+	add("ch", "CH", 1)
+	add("dh", "DH", 1)
+}
+
+var reVecReg = regexp.MustCompile(`^([xyz])mm(\d+)$`)
+var reKReg = regexp.MustCompile(`^k(\d)$`)
+var ptrSizes = map[string]int{"BYTE": 1, "WORD": 2, "DWORD": 4, "QWORD": 8, "XMMWORD": 16, "YMMWORD": 32, "ZMMWORD": 64}
+
+type operand struct {
+	kind    byte // 'r' gp reg, 'v' vec reg, 'k' mask reg, 'm' memory, 'i' imm
+	goStr   string
+	size    int
+	maskReg string // {kN}
+	zero    bool   // {z}
+	bcst    bool
+}
+
+func parseOperand(s string, ripName string, opSize int) (operand, bool) {
+	s = strings.TrimSpace(s)
+	var op operand
+	// decorations
+	for {
+		i := strings.LastIndex(s, "{")
+		if i < 0 || !strings.HasSuffix(s, "}") {
+			break
+		}
+		dec := s[i+1 : len(s)-1]
+		s = s[:i]
+		switch {
+		case dec == "z":
+			op.zero = true
+		case reKReg.MatchString(dec):
+			op.maskReg = "K" + dec[1:]
+		case strings.HasPrefix(dec, "1to"):
+			op.bcst = true
+		default:
+			return op, false
+		}
+	}
+	if r, ok := gpRegs[s]; ok {
+		op.kind, op.goStr, op.size = 'r', r.name, r.size
+		return op, true
+	}
+	if m := reVecReg.FindStringSubmatch(s); m != nil {
+		op.kind = 'v'
+		op.goStr = strings.ToUpper(m[1]) + m[2]
+		op.size = map[string]int{"x": 16, "y": 32, "z": 64}[m[1]]
+		return op, true
+	}
+	if m := reKReg.FindStringSubmatch(s); m != nil {
+		op.kind, op.goStr = 'k', "K"+m[1]
+		return op, true
+	}
+	if strings.Contains(s, "[") {
+		op.kind = 'm'
+		pre, rest, _ := strings.Cut(s, "[")
+		pre = strings.TrimSpace(pre)
+		if strings.HasSuffix(pre, "PTR") {
+			w := strings.Fields(pre)[0]
+			op.size = ptrSizes[w]
+			if strings.HasPrefix(w, "DWORD") && op.bcst {
+				op.size = 4
+			}
+		}
+		inner := strings.TrimSuffix(rest, "]")
+		var baseR, idxR string
+		scale := 1
+		var disp int64
+		// tokenize on + and -
+		tok := ""
+		sign := int64(1)
+		flush := func() bool {
+			t := strings.TrimSpace(tok)
+			tok = ""
+			if t == "" {
+				return true
+			}
+			if strings.Contains(t, "*") {
+				r, sc, _ := strings.Cut(t, "*")
+				g, ok := gpRegs[r]
+				if !ok {
+					return false
+				}
+				idxR = g.name
+				scale, _ = strconv.Atoi(sc)
+				return true
+			}
+			if t == "rip" {
+				baseR = "rip"
+				return true
+			}
+			if g, ok := gpRegs[t]; ok {
+				if baseR == "" {
+					baseR = g.name
+				} else {
+					idxR = g.name
+				}
+				return true
+			}
+			v, err := strconv.ParseUint(strings.TrimPrefix(t, "0x"), 16, 64)
+			if err != nil {
+				return false
+			}
+			disp += sign * int64(v)
+			return true
+		}
+		for _, c := range inner {
+			if c == '+' || c == '-' {
+				if !flush() {
+					return op, false
+				}
+				if c == '-' {
+					sign = -1
+				} else {
+					sign = 1
+				}
+				continue
+			}
+			tok += string(c)
+		}
+		if !flush() {
+			return op, false
+		}
+		if baseR == "rip" {
+			if ripName == "" {
+				return op, false
+			}
+			op.goStr = ripName
+			return op, true
+		}
+		var b strings.Builder
+		if disp < 0 {
+			fmt.Fprintf(&b, "-0x%x", -disp)
+		} else if disp == 0 {
+			b.WriteString("0")
+		} else {
+			fmt.Fprintf(&b, "0x%x", disp)
+		}
+		if baseR != "" {
+			fmt.Fprintf(&b, "(%s)", baseR)
+		}
+		if idxR != "" {
+			fmt.Fprintf(&b, "(%s*%d)", idxR, scale)
+		}
+		op.goStr = b.String()
+		return op, true
+	}
+	// immediate
+	v, err := strconv.ParseUint(strings.TrimPrefix(s, "0x"), 16, 64)
+	if !strings.HasPrefix(s, "0x") {
+		v, err = strconv.ParseUint(s, 10, 64)
+	}
+	if err != nil {
+		return op, false
+	}
+	op.kind = 'i'
+	sv := int64(v)
+	switch {
+	case opSize == 8 && sv < 0:
+	case opSize == 4 && v >= 0x80000000 && v <= 0xffffffff:
+		sv = int64(int32(uint32(v)))
+	case opSize == 2 && v >= 0x8000 && v <= 0xffff:
+		sv = int64(int16(uint16(v)))
+	default:
+		op.goStr = fmt.Sprintf("$0x%x", v)
+		return op, true
+	}
+	if sv < 0 {
+		op.goStr = fmt.Sprintf("$-0x%x", -sv)
+	} else {
+		op.goStr = fmt.Sprintf("$0x%x", sv)
+	}
+	return op, true
+}
+
+func splitOps(s string) []string {
+	if s == "" {
+		return nil
+	}
+	var out []string
+	depth := 0
+	start := 0
+	for i, c := range s {
+		switch c {
+		case '[', '{':
+			depth++
+		case ']', '}':
+			depth--
+		case ',':
+			if depth == 0 {
+				out = append(out, s[start:i])
+				start = i + 1
+			}
+		}
+	}
+	return append(out, s[start:])
+}
+
+var sizeSuffix = map[int]string{1: "B", 2: "W", 4: "L", 8: "Q"}
+
+// gp instructions taking a size suffix
+var gpSized = map[string]bool{
+	"mov": true, "add": true, "sub": true, "and": true, "or": true, "xor": true, "cmp": true,
+	"test": true, "lea": true, "inc": true, "dec": true, "neg": true, "not": true, "shl": true,
+	"sal": true, "shr": true, "sar": true, "rol": true, "ror": true, "imul": true, "tzcnt": true,
+	"lzcnt": true, "popcnt": true, "bsf": true, "bsr": true, "bt": true, "adc": true, "sbb": true,
+	"xchg": true, "andn": true, "blsr": true, "blsi": true, "blsmsk": true, "shlx": true,
+	"shrx": true, "sarx": true, "bzhi": true, "pdep": true, "pext": true, "bswap": true,
+	"push": true, "pop": true, "mul": true, "div": true, "idiv": true, "shld": true, "shrd": true,
+	"btr": true, "bts": true, "btc": true, "rorx": true,
+}
+
+var condMap = map[string]string{
+	"e": "EQ", "z": "EQ", "ne": "NE", "nz": "NE", "b": "CS", "c": "CS", "nae": "CS",
+	"ae": "CC", "nb": "CC", "nc": "CC", "be": "LS", "na": "LS", "a": "HI", "nbe": "HI",
+	"l": "LT", "nge": "LT", "ge": "GE", "nl": "GE", "le": "LE", "ng": "LE", "g": "GT", "nle": "GT",
+	"s": "MI", "ns": "PL", "o": "OS", "no": "OC", "p": "PS", "pe": "PS", "np": "PC", "po": "PC",
+}
+
+var sseRename = map[string]string{
+	"movabs": "MOVQ", "movdqu": "MOVOU", "movdqa": "MOVO", "movd": "MOVL", "movq": "MOVQ",
+	"cdqe": "CDQE", "cqo": "CQO", "cdq": "CDQ",
+}
+
+var unalignedMove = map[string]string{
+	"VMOVDQA64": "VMOVDQU64", "VMOVDQA32": "VMOVDQU32", "VMOVAPS": "VMOVUPS", "VMOVAPD": "VMOVUPD",
+}
+
+// toGo converts an objdump intel instruction into Go assembler syntax.
+func toGo(in inst, ripName string) (string, bool) {
+	mn := in.mnem
+	raw := splitOps(in.ops)
+	// determine operand size from first register/memory operand
+	opSize := 0
+	for _, r := range raw {
+		o, ok := parseOperand(r, ripName, 0)
+		if ok && (o.kind == 'r' || o.kind == 'm') && o.size > 0 {
+			opSize = o.size
+			break
+		}
+	}
+	var ops []operand
+	for _, r := range raw {
+		o, ok := parseOperand(r, ripName, opSize)
+		if !ok {
+			return "", false
+		}
+		ops = append(ops, o)
+	}
+	var gm string
+	suffix := ""
+	switch {
+	case mn == "movzx" || mn == "movsx" || mn == "movsxd":
+		if len(ops) != 2 {
+			return "", false
+		}
+		sx := "ZX"
+		if mn != "movzx" {
+			sx = "SX"
+		}
+		gm = "MOV" + sizeSuffix[ops[1].size] + sizeSuffix[ops[0].size] + sx
+	case strings.HasPrefix(mn, "set") && condMap[mn[3:]] != "":
+		gm = "SET" + condMap[mn[3:]]
+	case strings.HasPrefix(mn, "cmov") && condMap[mn[4:]] != "":
+		gm = "CMOV" + sizeSuffix[ops[0].size] + condMap[mn[4:]]
+	case gpSized[mn]:
+		if opSize == 0 || sizeSuffix[opSize] == "" {
+			return "", false
+		}
+		if mn == "lea" {
+			opSize = ops[0].size
+		}
+		gm = strings.ToUpper(mn) + sizeSuffix[opSize]
+		if mn == "shl" || mn == "sal" {
+			gm = "SHL" + sizeSuffix[opSize]
+		}
+	case sseRename[mn] != "":
+		gm = sseRename[mn]
+	default:
+		gm = strings.ToUpper(mn)
+	}
+	// Go only guarantees 32-byte alignment for DATA symbols
+	if u, ok := unalignedMove[gm]; ok {
+		for _, o := range ops {
+			if o.kind == 'm' && strings.Contains(o.goStr, "(SB)") && o.size > 32 {
+				gm = u
+			}
+		}
+	}
+	if mn == "xchg" && len(ops) == 2 && ops[0].goStr == ops[1].goStr {
+		return "", false
+	}
+	// reverse operands, handle mask/zero decorations on destination
+	var parts []string
+	if mn == "cmp" {
+		for i, j := 0, len(ops)-1; i < j; i, j = i+1, j-1 {
+			ops[i], ops[j] = ops[j], ops[i]
+		}
+	}
+	for i := len(ops) - 1; i >= 0; i-- {
+		o := ops[i]
+		if o.bcst {
+			suffix += ".BCST"
+		}
+		if i == 0 && o.maskReg != "" {
+			parts = append(parts, o.maskReg)
+		}
+		if i == 0 && o.zero {
+			suffix = ".Z" + suffix
+		}
+		parts = append(parts, o.goStr)
+	}
+	if len(parts) == 0 {
+		return gm + suffix, true
+	}
+	return gm + suffix + " " + strings.Join(parts, ", "), true
+}
+
+var reHexImm = regexp.MustCompile(`0x[0-9a-f]+`)
+var rePtr = regexp.MustCompile(`(BYTE|WORD|DWORD|QWORD|XMMWORD|YMMWORD|ZMMWORD) PTR`)
+
+// intelText renders an instruction the way clang's intel printer does:
+// lowercase size keywords, spaced address arithmetic and decimal immediates.
+func intelText(in inst) string {
+	raw := splitOps(in.ops)
+	opSize := 0
+	for _, r := range raw {
+		if o, ok := parseOperand(r, "x", 0); ok && (o.kind == 'r' || o.kind == 'm') && o.size > 0 {
+			opSize = o.size
+			break
+		}
+	}
+	var parts []string
+	for _, r := range raw {
+		r = rePtr.ReplaceAllStringFunc(r, strings.ToLower)
+		if i := strings.Index(r, "["); i >= 0 {
+			j := strings.Index(r, "]")
+			inner := r[i+1 : j]
+			inner = strings.ReplaceAll(inner, "*1", "")
+			inner = reHexImm.ReplaceAllStringFunc(inner, func(h string) string {
+				v, _ := strconv.ParseUint(h[2:], 16, 64)
+				return strconv.FormatUint(v, 10)
+			})
+			inner = strings.ReplaceAll(strings.ReplaceAll(inner, "+", " + "), "-", " - ")
+			r = r[:i+1] + inner + r[j:]
+		} else if strings.HasPrefix(r, "0x") {
+			v, _ := strconv.ParseUint(r[2:], 16, 64)
+			sv := int64(v)
+			switch {
+			case opSize == 4 && v >= 0x80000000 && v <= 0xffffffff:
+				sv = int64(int32(uint32(v)))
+			case opSize == 2 && v >= 0x8000 && v <= 0xffff:
+				sv = int64(int16(uint16(v)))
+			case opSize == 1 && v >= 0x80 && v <= 0xff:
+				sv = int64(int8(uint8(v)))
+			}
+			r = strconv.FormatInt(sv, 10)
+		}
+		parts = append(parts, r)
+	}
+	if len(parts) == 0 {
+		return in.mnem
+	}
+	return in.mnem + "\t" + strings.Join(parts, ", ")
+}
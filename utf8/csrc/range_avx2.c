@@ -90,6 +90,113 @@ static inline __m256i push_last_3bytes_of_a_to_b(__m256i a, __m256i b) {
   return _mm256_alignr_epi8(b, _mm256_permute2x128_si256(a, b, 0x21), 13);
 }
 
+/*
+ * Last-byte thresholds for a pending multi-byte sequence: the block ends
+ * inside a character if its last byte starts a 2+ byte sequence, the one
+ * before a 3+ byte sequence, or the one before that a 4 byte sequence
+ * (first_len is length minus 1).
+ */
+static const int8_t _incomplete_tbl[] = {
+    127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 2, 1, 0,
+};
+
+/*
+ * Run the range state machine over one 32-byte block, accumulating
+ * out-of-range bytes into error1/error2.
+ */
+static inline void utf8_range_block(const __m256i input,
+    __m256i *prev_input, __m256i *prev_first_len,
+    __m256i *error1, __m256i *error2,
+    const __m256i first_len_tbl, const __m256i first_range_tbl,
+    const __m256i range_min_tbl, const __m256i range_max_tbl,
+    const __m256i df_ee_tbl, const __m256i ef_fe_tbl)
+{
+    /* high_nibbles = input >> 4 */
+    const __m256i high_nibbles =
+        _mm256_and_si256(_mm256_srli_epi16(input, 4), _mm256_set1_epi8(0x0F));
+
+    /* first_len = legal character length minus 1 */
+    /* 0 for 00~7F, 1 for C0~DF, 2 for E0~EF, 3 for F0~FF */
+    /* first_len = first_len_tbl[high_nibbles] */
+    __m256i first_len = _mm256_shuffle_epi8(first_len_tbl, high_nibbles);
+
+    /* First Byte: set range index to 8 for bytes within 0xC0 ~ 0xFF */
+    /* range = first_range_tbl[high_nibbles] */
+    __m256i range = _mm256_shuffle_epi8(first_range_tbl, high_nibbles);
+
+    /* Second Byte: set range index to first_len */
+    /* 0 for 00~7F, 1 for C0~DF, 2 for E0~EF, 3 for F0~FF */
+    /* range |= (first_len, prev_first_len) << 1 byte */
+    range = _mm256_or_si256(
+            range, push_last_byte_of_a_to_b(*prev_first_len, first_len));
+
+    /* Third Byte: set range index to saturate_sub(first_len, 1) */
+    /* 0 for 00~7F, 0 for C0~DF, 1 for E0~EF, 2 for F0~FF */
+    __m256i tmp1, tmp2;
+
+    /* tmp1 = (first_len, prev_first_len) << 2 bytes */
+    tmp1 = push_last_2bytes_of_a_to_b(*prev_first_len, first_len);
+    /* tmp2 = saturate_sub(tmp1, 1) */
+    tmp2 = _mm256_subs_epu8(tmp1, _mm256_set1_epi8(1));
+
+    /* range |= tmp2 */
+    range = _mm256_or_si256(range, tmp2);
+
+    /* Fourth Byte: set range index to saturate_sub(first_len, 2) */
+    /* 0 for 00~7F, 0 for C0~DF, 0 for E0~EF, 1 for F0~FF */
+    /* tmp1 = (first_len, prev_first_len) << 3 bytes */
+    tmp1 = push_last_3bytes_of_a_to_b(*prev_first_len, first_len);
+    /* tmp2 = saturate_sub(tmp1, 2) */
+    tmp2 = _mm256_subs_epu8(tmp1, _mm256_set1_epi8(2));
+    /* range |= tmp2 */
+    range = _mm256_or_si256(range, tmp2);
+
+    /*
+     * Now we have below range indices caluclated
+     * Correct cases:
+     * - 8 for C0~FF
+     * - 3 for 1st byte after F0~FF
+     * - 2 for 1st byte after E0~EF or 2nd byte after F0~FF
+     * - 1 for 1st byte after C0~DF or 2nd byte after E0~EF or
+     *         3rd byte after F0~FF
+     * - 0 for others
+     * Error cases:
+     *   9,10,11 if non ascii First Byte overlaps
+     *   E.g., F1 80 C2 90 --> 8 3 10 2, where 10 indicates error
+     */
+
+    /* Adjust Second Byte range for special First Bytes(E0,ED,F0,F4) */
+    /* Overlaps lead to index 9~15, which are illegal in range table */
+    __m256i shift1, pos, range2;
+    /* shift1 = (input, prev_input) << 1 byte */
+    shift1 = push_last_byte_of_a_to_b(*prev_input, input);
+    pos = _mm256_sub_epi8(shift1, _mm256_set1_epi8(0xEF));
+    /*
+     * shift1:  | EF  F0 ... FE | FF  00  ... ...  DE | DF  E0 ... EE |
+     * pos:     | 0   1      15 | 16  17           239| 240 241    255|
+     * pos-240: | 0   0      0  | 0   0            0  | 0   1      15 |
+     * pos+112: | 112 113    127|       >= 128        |     >= 128    |
+     */
+    tmp1 = _mm256_subs_epu8(pos, _mm256_set1_epi8(0xF0));
+    range2 = _mm256_shuffle_epi8(df_ee_tbl, tmp1);
+    tmp2 = _mm256_adds_epu8(pos, _mm256_set1_epi8(112));
+    range2 = _mm256_add_epi8(range2, _mm256_shuffle_epi8(ef_fe_tbl, tmp2));
+
+    range = _mm256_add_epi8(range, range2);
+
+    /* Load min and max values per calculated range index */
+    __m256i minv = _mm256_shuffle_epi8(range_min_tbl, range);
+    __m256i maxv = _mm256_shuffle_epi8(range_max_tbl, range);
+
+    /* Check value range */
+    *error1 = _mm256_or_si256(*error1, _mm256_cmpgt_epi8(minv, input));
+    *error2 = _mm256_or_si256(*error2, _mm256_cmpgt_epi8(input, maxv));
+
+    *prev_input = input;
+    *prev_first_len = first_len;
+}
+
 // gocc: utf8_valid_range_avx2(src string) bool
 bool utf8_valid_range_avx2(const unsigned char *src, int64_t src_len)
 {
@@ -110,102 +217,40 @@ bool utf8_valid_range_avx2(const unsigned char *src, int64_t src_len)
             _mm256_loadu_si256((const __m256i *)_df_ee_tbl);
         const __m256i ef_fe_tbl =
             _mm256_loadu_si256((const __m256i *)_ef_fe_tbl);
+        const __m256i incomplete_tbl =
+            _mm256_loadu_si256((const __m256i *)_incomplete_tbl);
 
         __m256i error1 = _mm256_set1_epi8(0);
         __m256i error2 = _mm256_set1_epi8(0);
 
-        while (src_len >= 32) {
-            const __m256i input = _mm256_loadu_si256((const __m256i *)src);
+        while (src_len >= 64) {
+            const __m256i input0 = _mm256_loadu_si256((const __m256i *)src);
+            const __m256i input1 = _mm256_loadu_si256((const __m256i *)(src + 32));
+
+            if (_mm256_movemask_epi8(_mm256_or_si256(input0, input1)) == 0) {
+                /*
+                 * Pure ASCII block: the only possible error is a multi-byte
+                 * sequence left open by the previous block. The range state
+                 * of an ASCII block is all zeros.
+                 */
+                error1 = _mm256_or_si256(error1,
+                        _mm256_cmpgt_epi8(prev_first_len, incomplete_tbl));
+                prev_input = input1;
+                prev_first_len = _mm256_setzero_si256();
+            } else {
+                utf8_range_block(input0, &prev_input, &prev_first_len,
+                        &error1, &error2, first_len_tbl, first_range_tbl,
+                        range_min_tbl, range_max_tbl, df_ee_tbl, ef_fe_tbl);
+                utf8_range_block(input1, &prev_input, &prev_first_len,
+                        &error1, &error2, first_len_tbl, first_range_tbl,
+                        range_min_tbl, range_max_tbl, df_ee_tbl, ef_fe_tbl);
+            }
 
-            /* high_nibbles = input >> 4 */
-            const __m256i high_nibbles =
-                _mm256_and_si256(_mm256_srli_epi16(input, 4), _mm256_set1_epi8(0x0F));
-
-            /* first_len = legal character length minus 1 */
-            /* 0 for 00~7F, 1 for C0~DF, 2 for E0~EF, 3 for F0~FF */
-            /* first_len = first_len_tbl[high_nibbles] */
-            __m256i first_len = _mm256_shuffle_epi8(first_len_tbl, high_nibbles);
-
-            /* First Byte: set range index to 8 for bytes within 0xC0 ~ 0xFF */
-            /* range = first_range_tbl[high_nibbles] */
-            __m256i range = _mm256_shuffle_epi8(first_range_tbl, high_nibbles);
-
-            /* Second Byte: set range index to first_len */
-            /* 0 for 00~7F, 1 for C0~DF, 2 for E0~EF, 3 for F0~FF */
-            /* range |= (first_len, prev_first_len) << 1 byte */
-            range = _mm256_or_si256(
-                    range, push_last_byte_of_a_to_b(prev_first_len, first_len));
-
-            /* Third Byte: set range index to saturate_sub(first_len, 1) */
-            /* 0 for 00~7F, 0 for C0~DF, 1 for E0~EF, 2 for F0~FF */
-            __m256i tmp1, tmp2;
-
-            /* tmp1 = (first_len, prev_first_len) << 2 bytes */
-            tmp1 = push_last_2bytes_of_a_to_b(prev_first_len, first_len);
-            /* tmp2 = saturate_sub(tmp1, 1) */
-            tmp2 = _mm256_subs_epu8(tmp1, _mm256_set1_epi8(1));
-
-            /* range |= tmp2 */
-            range = _mm256_or_si256(range, tmp2);
-
-            /* Fourth Byte: set range index to saturate_sub(first_len, 2) */
-            /* 0 for 00~7F, 0 for C0~DF, 0 for E0~EF, 1 for F0~FF */
-            /* tmp1 = (first_len, prev_first_len) << 3 bytes */
-            tmp1 = push_last_3bytes_of_a_to_b(prev_first_len, first_len);
-            /* tmp2 = saturate_sub(tmp1, 2) */
-            tmp2 = _mm256_subs_epu8(tmp1, _mm256_set1_epi8(2));
-            /* range |= tmp2 */
-            range = _mm256_or_si256(range, tmp2);
-
-            /*
-             * Now we have below range indices caluclated
-             * Correct cases:
-             * - 8 for C0~FF
-             * - 3 for 1st byte after F0~FF
-             * - 2 for 1st byte after E0~EF or 2nd byte after F0~FF
-             * - 1 for 1st byte after C0~DF or 2nd byte after E0~EF or
-             *         3rd byte after F0~FF
-             * - 0 for others
-             * Error cases:
-             *   9,10,11 if non ascii First Byte overlaps
-             *   E.g., F1 80 C2 90 --> 8 3 10 2, where 10 indicates error
-             */
-
-            /* Adjust Second Byte range for special First Bytes(E0,ED,F0,F4) */
-            /* Overlaps lead to index 9~15, which are illegal in range table */
-            __m256i shift1, pos, range2;
-            /* shift1 = (input, prev_input) << 1 byte */
-            shift1 = push_last_byte_of_a_to_b(prev_input, input);
-            pos = _mm256_sub_epi8(shift1, _mm256_set1_epi8(0xEF));
-            /*
-             * shift1:  | EF  F0 ... FE | FF  00  ... ...  DE | DF  E0 ... EE |
-             * pos:     | 0   1      15 | 16  17           239| 240 241    255|
-             * pos-240: | 0   0      0  | 0   0            0  | 0   1      15 |
-             * pos+112: | 112 113    127|       >= 128        |     >= 128    |
-             */
-            tmp1 = _mm256_subs_epu8(pos, _mm256_set1_epi8(0xF0));
-            range2 = _mm256_shuffle_epi8(df_ee_tbl, tmp1);
-            tmp2 = _mm256_adds_epu8(pos, _mm256_set1_epi8(112));
-            range2 = _mm256_add_epi8(range2, _mm256_shuffle_epi8(ef_fe_tbl, tmp2));
-
-            range = _mm256_add_epi8(range, range2);
-
-            /* Load min and max values per calculated range index */
-            __m256i minv = _mm256_shuffle_epi8(range_min_tbl, range);
-            __m256i maxv = _mm256_shuffle_epi8(range_max_tbl, range);
-
-            /* Check value range */
-            error1 = _mm256_or_si256(error1, _mm256_cmpgt_epi8(minv, input));
-            error2 = _mm256_or_si256(error2, _mm256_cmpgt_epi8(input, maxv));
-
-            prev_input = input;
-            prev_first_len = first_len;
-
-            src += 32;
-            src_len -= 32;
+            src += 64;
+            src_len -= 64;
 
             /* Perform error check every now and then */
-            if (src_len % 256 < 32)
+            if (src_len % 256 < 64)
             {
                 __m256i error = _mm256_or_si256(error1, error2);
                 if (!_mm256_testz_si256(error, error))
@@ -213,6 +258,15 @@ bool utf8_valid_range_avx2(const unsigned char *src, int64_t src_len)
             }
         }
 
+        if (src_len >= 32) {
+            const __m256i input = _mm256_loadu_si256((const __m256i *)src);
+            utf8_range_block(input, &prev_input, &prev_first_len,
+                    &error1, &error2, first_len_tbl, first_range_tbl,
+                    range_min_tbl, range_max_tbl, df_ee_tbl, ef_fe_tbl);
+            src += 32;
+            src_len -= 32;
+        }
+
         __m256i error = _mm256_or_si256(error1, error2);
         if (!_mm256_testz_si256(error, error))
             return false;
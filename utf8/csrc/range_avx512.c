@@ -0,0 +1,155 @@
+/*
+ * AVX-512BW/VBMI UTF-8 validation using the lookup algorithm from
+ * "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser, Lemire).
+ *
+ * Every byte pair (prev1, input) is classified with three nibble lookups
+ * whose AND is non-zero for an invalid pair; 3- and 4-byte sequences are
+ * checked separately from prev2/prev3. The previous-byte vectors come from
+ * a single VPERMT2B across the previous and current block, and the final
+ * partial block uses a zero-masked load, so no scalar tail is needed.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <x86intrin.h>
+
+/* Error classes, one bit each */
+#define TOO_SHORT      (1 << 0) /* 11______ 0_______ */
+#define TOO_LONG       (1 << 1) /* 0_______ 10______ */
+#define OVERLONG_3     (1 << 2) /* 11100000 100_____ */
+#define TOO_LARGE      (1 << 3) /* 11110100 1001____, 11110100 101_____ */
+#define SURROGATE      (1 << 4) /* 11101101 101_____ */
+#define OVERLONG_2     (1 << 5) /* 1100000_ 10______ */
+#define TOO_LARGE_1000 (1 << 6) /* 11110101+ 1000____ */
+#define OVERLONG_4     (1 << 6) /* 11110000 1000____ */
+#define TWO_CONTS      (1 << 7) /* 10______ 10______ */
+#define CARRY          (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+/* Indexed by the high nibble of the first byte of the pair */
+static const uint8_t _byte_1_high_tbl[16] = {
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+    TOO_SHORT | OVERLONG_2,
+    TOO_SHORT,
+    TOO_SHORT | OVERLONG_3 | SURROGATE,
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4,
+};
+
+/* Indexed by the low nibble of the first byte of the pair */
+static const uint8_t _byte_1_low_tbl[16] = {
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+    CARRY | OVERLONG_2,
+    CARRY,
+    CARRY,
+    CARRY | TOO_LARGE,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+};
+
+/* Indexed by the high nibble of the second byte of the pair */
+static const uint8_t _byte_2_high_tbl[16] = {
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+};
+
+/*
+ * A block ends inside a character if its last byte is a 2+ byte lead, the
+ * one before a 3+ byte lead or the one before that a 4 byte lead. Bytes
+ * above these thresholds survive the saturating subtraction.
+ */
+static const uint8_t _incomplete_max[64] = {
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1,
+};
+
+/* VPERMT2B indices selecting (prev, input) shifted right by N bytes */
+#define PREV_IDX(n) _mm512_add_epi8(_mm512_set_epi64( \
+    0x3f3e3d3c3b3a3938, 0x3736353433323130, 0x2f2e2d2c2b2a2928, 0x2726252423222120, \
+    0x1f1e1d1c1b1a1918, 0x1716151413121110, 0x0f0e0d0c0b0a0908, 0x0706050403020100), \
+    _mm512_set1_epi8(64 - (n)))
+
+// gocc: utf8_valid_avx512(src string) bool
+bool utf8_valid_avx512(const unsigned char *src, int64_t src_len)
+{
+    const __m512i byte_1_high_tbl =
+        _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)_byte_1_high_tbl));
+    const __m512i byte_1_low_tbl =
+        _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)_byte_1_low_tbl));
+    const __m512i byte_2_high_tbl =
+        _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)_byte_2_high_tbl));
+    const __m512i incomplete_max = _mm512_loadu_si512((const void *)_incomplete_max);
+    const __m512i nibble_mask = _mm512_set1_epi8(0x0F);
+    const __m512i prev1_idx = PREV_IDX(1);
+    const __m512i prev2_idx = PREV_IDX(2);
+    const __m512i prev3_idx = PREV_IDX(3);
+
+    __m512i prev_input = _mm512_setzero_si512();
+    __m512i prev_incomplete = _mm512_setzero_si512();
+    __m512i error = _mm512_setzero_si512();
+
+    while (src_len > 0) {
+        __m512i input;
+        if (src_len >= 64) {
+            input = _mm512_loadu_si512((const void *)src);
+        } else {
+            /* Zero padding is ASCII, so a truncated sequence shows up as TOO_SHORT */
+            input = _mm512_maskz_loadu_epi8((__mmask64)((1ULL << src_len) - 1), src);
+        }
+
+        if (_mm512_movepi8_mask(input) == 0) {
+            /* Pure ASCII block: only a sequence left open by the previous block can fail */
+            error = _mm512_or_si512(error, prev_incomplete);
+            prev_incomplete = _mm512_setzero_si512();
+        } else {
+            const __m512i prev1 = _mm512_permutex2var_epi8(prev_input, prev1_idx, input);
+            const __m512i prev2 = _mm512_permutex2var_epi8(prev_input, prev2_idx, input);
+            const __m512i prev3 = _mm512_permutex2var_epi8(prev_input, prev3_idx, input);
+
+            const __m512i byte_1_high = _mm512_shuffle_epi8(byte_1_high_tbl,
+                _mm512_and_si512(_mm512_srli_epi16(prev1, 4), nibble_mask));
+            const __m512i byte_1_low = _mm512_shuffle_epi8(byte_1_low_tbl,
+                _mm512_and_si512(prev1, nibble_mask));
+            const __m512i byte_2_high = _mm512_shuffle_epi8(byte_2_high_tbl,
+                _mm512_and_si512(_mm512_srli_epi16(input, 4), nibble_mask));
+
+            /* special_cases = byte_1_high & byte_1_low & byte_2_high */
+            const __m512i special_cases =
+                _mm512_ternarylogic_epi64(byte_1_high, byte_1_low, byte_2_high, 0x80);
+
+            /* Third and fourth bytes must be continuations: prev2 >= E0 or prev3 >= F0 */
+            const __m512i is_third_byte = _mm512_subs_epu8(prev2, _mm512_set1_epi8(0xE0 - 0x80));
+            const __m512i is_fourth_byte = _mm512_subs_epu8(prev3, _mm512_set1_epi8(0xF0 - 0x80));
+            const __m512i must23_80 = _mm512_and_si512(
+                _mm512_or_si512(is_third_byte, is_fourth_byte), _mm512_set1_epi8((char)0x80));
+
+            error = _mm512_or_si512(error, _mm512_xor_si512(must23_80, special_cases));
+            prev_incomplete = _mm512_subs_epu8(input, incomplete_max);
+
+            if (_mm512_test_epi8_mask(error, error))
+                return false;
+        }
+
+        prev_input = input;
+        src += 64;
+        src_len -= 64;
+    }
+
+    error = _mm512_or_si512(error, prev_incomplete);
+    return _mm512_test_epi8_mask(error, error) == 0;
+}
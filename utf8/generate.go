@@ -1,4 +1,6 @@
-//go:generate go run github.com/mhr3/goruntool@v0.1.1 github.com/mhr3/gocc/cmd/gocc@v0.16.3 csrc/range_avx2.c -l -p utf8 -o ./ -a avx2 -O3
+//go:generate go run ../internal/cmd/gccasm -p utf8 -o ./ -a avx2 csrc/range_avx2.c
+//go:generate go run ../internal/cmd/gccasm -p utf8 -o ./ -a avx512 csrc/range_avx512.c
+//go:generate go run ../internal/cmd/gccasm -p utf8 -o ./ -a amd64 -m=-msse4.1 csrc/range_sse.c
 //go:generate go run github.com/mhr3/goruntool@v0.1.1 github.com/mhr3/gocc/cmd/gocc@v0.16.3 csrc/range_neon.c -l -p utf8 -o ./ -a arm64 -O3
 
 package utf8
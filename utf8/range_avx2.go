@@ -1,5 +1,5 @@
 //go:build !noasm && amd64
-// Code generated by gocc -- DO NOT EDIT.
+// Code generated by gccasm -- DO NOT EDIT.
 
 package utf8
 
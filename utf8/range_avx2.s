@@ -1,17 +1,17 @@
 //go:build !noasm && amd64
-// Code generated by gocc v0.16.3-rev-6adf1e2 -- DO NOT EDIT.
+// Code generated by gccasm -- DO NOT EDIT.
 //
 // Source file         : range_avx2.c
-// Clang version       : Apple clang version 17.0.0 (clang-1700.6.3.2)
+// Compiler version    : gcc (Debian 12.2.0-14+deb12u1) 12.2.0
 // Target architecture : amd64
-// Compiler options    : -mavx2 -mfma
+// Compiler options    : -mavx2 -mfma -mpopcnt
 
 #include "textflag.h"
 
-DATA LCPI0_0<>+0x00(SB)/8, $0x0f0f0f0f0f0f0f0f
-DATA LCPI0_0<>+0x08(SB)/8, $0x0f0f0f0f0f0f0f0f
-DATA LCPI0_0<>+0x10(SB)/8, $0x0f0f0f0f0f0f0f0f
-DATA LCPI0_0<>+0x18(SB)/8, $0x0f0f0f0f0f0f0f0f
+DATA LCPI0_0<>+0x00(SB)/8, $0x7f7f7f7f7f7f7f7f
+DATA LCPI0_0<>+0x08(SB)/8, $0x7f7f7f7f7f7f7f7f
+DATA LCPI0_0<>+0x10(SB)/8, $0x7f7f7f7f7f7f7f7f
+DATA LCPI0_0<>+0x18(SB)/8, $0x0001027f7f7f7f7f
 GLOBL LCPI0_0<>(SB), (RODATA|NOPTR), $32
 
 DATA LCPI0_1<>+0x00(SB)/8, $0x0000000000000000
@@ -20,301 +20,402 @@ DATA LCPI0_1<>+0x10(SB)/8, $0x0000000000000000
 DATA LCPI0_1<>+0x18(SB)/8, $0x0302010100000000
 GLOBL LCPI0_1<>(SB), (RODATA|NOPTR), $32
 
-DATA LCPI0_2<>+0x00(SB)/8, $0x0000000000000000
-DATA LCPI0_2<>+0x08(SB)/8, $0x0808080800000000
-DATA LCPI0_2<>+0x10(SB)/8, $0x0000000000000000
-DATA LCPI0_2<>+0x18(SB)/8, $0x0808080800000000
+DATA LCPI0_2<>+0x00(SB)/8, $0x0000000000000200
+DATA LCPI0_2<>+0x08(SB)/8, $0x0003000000000000
+DATA LCPI0_2<>+0x10(SB)/8, $0x0000000000000200
+DATA LCPI0_2<>+0x18(SB)/8, $0x0003000000000000
 GLOBL LCPI0_2<>(SB), (RODATA|NOPTR), $32
 
-DATA LCPI0_3<>+0x00(SB)/8, $0x0101010101010101
-DATA LCPI0_3<>+0x08(SB)/8, $0x0101010101010101
-DATA LCPI0_3<>+0x10(SB)/8, $0x0101010101010101
-DATA LCPI0_3<>+0x18(SB)/8, $0x0101010101010101
+DATA LCPI0_3<>+0x00(SB)/8, $0x0000000000000000
+DATA LCPI0_3<>+0x08(SB)/8, $0x0808080800000000
+DATA LCPI0_3<>+0x10(SB)/8, $0x0000000000000000
+DATA LCPI0_3<>+0x18(SB)/8, $0x0808080800000000
 GLOBL LCPI0_3<>(SB), (RODATA|NOPTR), $32
 
-DATA LCPI0_4<>+0x00(SB)/8, $0x0202020202020202
-DATA LCPI0_4<>+0x08(SB)/8, $0x0202020202020202
-DATA LCPI0_4<>+0x10(SB)/8, $0x0202020202020202
-DATA LCPI0_4<>+0x18(SB)/8, $0x0202020202020202
+DATA LCPI0_4<>+0x00(SB)/8, $0x0000040000000300
+DATA LCPI0_4<>+0x08(SB)/8, $0x0000000000000000
+DATA LCPI0_4<>+0x10(SB)/8, $0x0000040000000300
+DATA LCPI0_4<>+0x18(SB)/8, $0x0000000000000000
 GLOBL LCPI0_4<>(SB), (RODATA|NOPTR), $32
 
-DATA LCPI0_5<>+0x00(SB)/8, $0x1111111111111111
-DATA LCPI0_5<>+0x08(SB)/8, $0x1111111111111111
-DATA LCPI0_5<>+0x10(SB)/8, $0x1111111111111111
-DATA LCPI0_5<>+0x18(SB)/8, $0x1111111111111111
+DATA LCPI0_5<>+0x00(SB)/8, $0x809080a080808000
+DATA LCPI0_5<>+0x08(SB)/8, $0x7f7f7f7f7f7f7fc2
+DATA LCPI0_5<>+0x10(SB)/8, $0x809080a080808000
+DATA LCPI0_5<>+0x18(SB)/8, $0x7f7f7f7f7f7f7fc2
 GLOBL LCPI0_5<>(SB), (RODATA|NOPTR), $32
 
-DATA LCPI0_6<>+0x00(SB)/8, $0xf0f0f0f0f0f0f0f0
-DATA LCPI0_6<>+0x08(SB)/8, $0xf0f0f0f0f0f0f0f0
-DATA LCPI0_6<>+0x10(SB)/8, $0xf0f0f0f0f0f0f0f0
-DATA LCPI0_6<>+0x18(SB)/8, $0xf0f0f0f0f0f0f0f0
+DATA LCPI0_6<>+0x00(SB)/8, $0x8fbf9fbfbfbfbf7f
+DATA LCPI0_6<>+0x08(SB)/8, $0x80808080808080f4
+DATA LCPI0_6<>+0x10(SB)/8, $0x8fbf9fbfbfbfbf7f
+DATA LCPI0_6<>+0x18(SB)/8, $0x80808080808080f4
 GLOBL LCPI0_6<>(SB), (RODATA|NOPTR), $32
 
-DATA LCPI0_7<>+0x00(SB)/8, $0x0000000000000200
-DATA LCPI0_7<>+0x08(SB)/8, $0x0003000000000000
-DATA LCPI0_7<>+0x10(SB)/8, $0x0000000000000200
-DATA LCPI0_7<>+0x18(SB)/8, $0x0003000000000000
-GLOBL LCPI0_7<>(SB), (RODATA|NOPTR), $32
-
-DATA LCPI0_8<>+0x00(SB)/8, $0x7070707070707070
-DATA LCPI0_8<>+0x08(SB)/8, $0x7070707070707070
-DATA LCPI0_8<>+0x10(SB)/8, $0x7070707070707070
-DATA LCPI0_8<>+0x18(SB)/8, $0x7070707070707070
-GLOBL LCPI0_8<>(SB), (RODATA|NOPTR), $32
-
-DATA LCPI0_9<>+0x00(SB)/8, $0x0000040000000300
-DATA LCPI0_9<>+0x08(SB)/8, $0x0000000000000000
-DATA LCPI0_9<>+0x10(SB)/8, $0x0000040000000300
-DATA LCPI0_9<>+0x18(SB)/8, $0x0000000000000000
-GLOBL LCPI0_9<>(SB), (RODATA|NOPTR), $32
-
-DATA LCPI0_10<>+0x00(SB)/8, $0x809080a080808000
-DATA LCPI0_10<>+0x08(SB)/8, $0x7f7f7f7f7f7f7fc2
-DATA LCPI0_10<>+0x10(SB)/8, $0x809080a080808000
-DATA LCPI0_10<>+0x18(SB)/8, $0x7f7f7f7f7f7f7fc2
-GLOBL LCPI0_10<>(SB), (RODATA|NOPTR), $32
-
-DATA LCPI0_11<>+0x00(SB)/8, $0x8fbf9fbfbfbfbf7f
-DATA LCPI0_11<>+0x08(SB)/8, $0x80808080808080f4
-DATA LCPI0_11<>+0x10(SB)/8, $0x8fbf9fbfbfbfbf7f
-DATA LCPI0_11<>+0x18(SB)/8, $0x80808080808080f4
-GLOBL LCPI0_11<>(SB), (RODATA|NOPTR), $32
-
-DATA LCPI0_12<>+0x00(SB)/1, $0x02
-GLOBL LCPI0_12<>(SB), (RODATA|NOPTR), $1
-
-DATA LCPI0_13<>+0x00(SB)/1, $0x11
-GLOBL LCPI0_13<>(SB), (RODATA|NOPTR), $1
-
-DATA LCPI0_14<>+0x00(SB)/1, $0xf0
-GLOBL LCPI0_14<>(SB), (RODATA|NOPTR), $1
-
-DATA LCPI0_16<>+0x00(SB)/1, $0x70
-GLOBL LCPI0_16<>(SB), (RODATA|NOPTR), $1
-
-DATA LCPI0_15<>+0x00(SB)/8, $0x0000000000000200
-DATA LCPI0_15<>+0x08(SB)/8, $0x0003000000000000
-GLOBL LCPI0_15<>(SB), (RODATA|NOPTR), $16
-
-DATA LCPI0_17<>+0x00(SB)/8, $0x0000040000000300
-DATA LCPI0_17<>+0x08(SB)/8, $0x0000000000000000
-GLOBL LCPI0_17<>(SB), (RODATA|NOPTR), $16
-
-DATA LCPI0_18<>+0x00(SB)/8, $0x809080a080808000
-DATA LCPI0_18<>+0x08(SB)/8, $0x7f7f7f7f7f7f7fc2
-GLOBL LCPI0_18<>(SB), (RODATA|NOPTR), $16
-
-DATA LCPI0_19<>+0x00(SB)/8, $0x8fbf9fbfbfbfbf7f
-DATA LCPI0_19<>+0x08(SB)/8, $0x80808080808080f4
-GLOBL LCPI0_19<>(SB), (RODATA|NOPTR), $16
-
-DATA LCPI0_20<>+0x00(SB)/8, $0x0000000000000000
-DATA LCPI0_20<>+0x08(SB)/8, $0x0302010100000000
-GLOBL LCPI0_20<>(SB), (RODATA|NOPTR), $16
-
-DATA LCPI0_21<>+0x00(SB)/8, $0x0000000000000000
-DATA LCPI0_21<>+0x08(SB)/8, $0x0808080800000000
-GLOBL LCPI0_21<>(SB), (RODATA|NOPTR), $16
-
-TEXT ·utf8_valid_range_avx2(SB), NOSPLIT, $0-17
-	MOVQ           src+0(FP), DI
-	MOVQ           src_len+8(FP), SI
-	NOP                                    // (skipped)                            // push	rbp
-	NOP                                    // (skipped)                            // mov	rbp, rsp
-	NOP                                    // (skipped)                            // and	rsp, -8
-	CMPQ           SI, $0x20               // <--                                  // cmp	rsi, 32
-	JL             LBB0_1                  // <--                                  // jl	.LBB0_1
-	LONG           $0xffefc1c5             // VPXOR X7, X7, X7                     // vpxor	xmm7, xmm7, xmm7
-	LONG           $0xc0eff9c5             // VPXOR X0, X0, X0                     // vpxor	xmm0, xmm0, xmm0
-	VPBROADCASTB   LCPI0_12<>(SB), Y5      // <--                                  // vpbroadcastb	ymm5, byte ptr [rip + .LCPI0_12]
-	VPBROADCASTB   LCPI0_13<>(SB), Y6      // <--                                  // vpbroadcastb	ymm6, byte ptr [rip + .LCPI0_13]
-	VPBROADCASTB   LCPI0_14<>(SB), Y8      // <--                                  // vpbroadcastb	ymm8, byte ptr [rip + .LCPI0_14]
-	VBROADCASTI128 LCPI0_15<>(SB), Y9      // <--                                  // vbroadcasti128	ymm9, xmmword ptr [rip + .LCPI0_15]
-	VPBROADCASTB   LCPI0_16<>(SB), Y10     // <--                                  // vpbroadcastb	ymm10, byte ptr [rip + .LCPI0_16]
-	VBROADCASTI128 LCPI0_17<>(SB), Y11     // <--                                  // vbroadcasti128	ymm11, xmmword ptr [rip + .LCPI0_17]
-	VBROADCASTI128 LCPI0_18<>(SB), Y12     // <--                                  // vbroadcasti128	ymm12, xmmword ptr [rip + .LCPI0_18]
-	VBROADCASTI128 LCPI0_19<>(SB), Y13     // <--                                  // vbroadcasti128	ymm13, xmmword ptr [rip + .LCPI0_19]
-	LONG           $0xef0941c4; BYTE $0xf6 // VPXOR X14, X14, X14                  // vpxor	xmm14, xmm14, xmm14
-	LONG           $0xef0141c4; BYTE $0xff // VPXOR X15, X15, X15                  // vpxor	xmm15, xmm15, xmm15
-	JMP            LBB0_4                  // <--                                  // jmp	.LBB0_4
+TEXT ·utf8_valid_range_avx2(SB), NOSPLIT, $176-17
+	MOVQ         src+0(FP), DI
+	MOVQ         src_len+8(FP), SI
+	PUSHQ        BP                     // <--                                  // push	rbp
+	MOVQ         DI, DX                 // <--                                  // mov	rdx, rdi
+	MOVQ         SP, BP                 // <--                                  // mov	rbp, rsp
+	ANDQ         $-0x20, SP             // <--                                  // and	rsp, -32
+	SUBQ         $0x60, SP              // <--                                  // sub	rsp, 96
+	CMPQ         SI, $0x1f              // <--                                  // cmp	rsi, 31
+	JLE          LBB0_7                 // <--                                  // jle	.LBB0_7
+	CMPQ         SI, $0x3f              // <--                                  // cmp	rsi, 63
+	JLE          LBB0_21                // <--                                  // jle	.LBB0_21
+	MOVQ         $0xf0f0f0f0f0f0f0f, AX // <--                                  // movabs	rax, 1085102592571150095
+	VPXOR        X10, X10, X10          // <--                                  // vpxor	xmm10, xmm10, xmm10
+	MOVL         $0x1, CX               // <--                                  // mov	ecx, 1
+	VMOVQ        AX, X2                 // <--                                  // vmovq	xmm2, rax
+	VMOVDQA      Y10, Y5                // <--                                  // vmovdqa	ymm5, ymm10
+	VMOVDQA      Y10, Y1                // <--                                  // vmovdqa	ymm1, ymm10
+	VPBROADCASTQ X2, Y2                 // <--                                  // vpbroadcastq	ymm2, xmm2
+	VMOVDQA      Y10, Y6                // <--                                  // vmovdqa	ymm6, ymm10
+	VMOVDQA      Y2, 0x40(SP)           // <--                                  // vmovdqa	ymmword ptr [rsp + 64], ymm2
+	JMP          LBB0_3                 // <--                                  // jmp	.LBB0_3
+
+LBB0_0:
+	VPCMPGTB LCPI0_0<>(SB), Y1, Y1 // <--                                  // vpcmpgtb	ymm1, ymm1, ymmword ptr [rip + 0]
+	VPOR     Y1, Y5, Y5            // <--                                  // vpor	ymm5, ymm5, ymm1
+	VPXOR    X1, X1, X1            // <--                                  // vpxor	xmm1, xmm1, xmm1
+	LONG     $0xf56ffdc5           // VMOVDQA Y5, Y6                       // vmovdqa	ymm6, ymm5
+
+LBB0_1:
+	SUBQ   $0x40, SI   // <--                                  // sub	rsi, 64
+	ADDQ   $0x40, DX   // <--                                  // add	rdx, 64
+	TESTB  $0xc0, SI   // <--                                  // test	sil, -64
+	JNE    LBB0_2      // <--                                  // jne	.LBB0_2
+	VPOR   Y10, Y5, Y3 // <--                                  // vpor	ymm3, ymm5, ymm10
+	VPTEST Y3, Y3      // <--                                  // vptest	ymm3, ymm3
+	JNE    LBB0_18     // <--                                  // jne	.LBB0_18
+	CMPQ   SI, $0x3f   // <--                                  // cmp	rsi, 63
+	JLE    LBB0_4      // <--                                  // jle	.LBB0_4
+
+LBB0_2:
+	LONG $0xf26ffdc5 // VMOVDQA Y2, Y6                       // vmovdqa	ymm6, ymm2
 
 LBB0_3:
-	ADDQ $0x20, DI    // <--                                  // add	rdi, 32
-	LEAQ 0x20(SI), AX // <--                                  // lea	rax, [rsi + 32]
-	CMPQ AX, $0x3f    // <--                                  // cmp	rax, 63
-	JBE  LBB0_8       // <--                                  // jbe	.LBB0_8
+	VMOVDQU      0(DX), Y3          // <--                                  // vmovdqu	ymm3, ymmword ptr [rdx]
+	VMOVDQU      0x20(DX), Y2       // <--                                  // vmovdqu	ymm2, ymmword ptr [rdx + 32]
+	VPOR         Y3, Y2, Y0         // <--                                  // vpor	ymm0, ymm2, ymm3
+	VPMOVMSKB    Y0, AX             // <--                                  // vpmovmskb	eax, ymm0
+	VMOVDQA      Y10, Y0            // <--                                  // vmovdqa	ymm0, ymm10
+	TESTL        AX, AX             // <--                                  // test	eax, eax
+	JE           LBB0_0             // <--                                  // je	.LBB0_0
+	VMOVDQA      LCPI0_1<>(SB), Y4  // <--                                  // vmovdqa	ymm4, ymmword ptr [rip + 0]
+	VPSRLW       $0x4, Y3, Y8       // <--                                  // vpsrlw	ymm8, ymm3, 4
+	VPERM2I128   $0x21, Y3, Y6, Y6  // <--                                  // vperm2i128	ymm6, ymm6, ymm3, 33
+	VPAND        0x40(SP), Y8, Y8   // <--                                  // vpand	ymm8, ymm8, ymmword ptr [rsp + 64]
+	MOVL         $0x2, AX           // <--                                  // mov	eax, 2
+	VPALIGNR     $0xf, Y6, Y3, Y6   // <--                                  // vpalignr	ymm6, ymm3, ymm6, 15
+	VMOVDQA      LCPI0_2<>(SB), Y11 // <--                                  // vmovdqa	ymm11, ymmword ptr [rip + 0]
+	VMOVD        CX, X15            // <--                                  // vmovd	xmm15, ecx
+	VPSHUFB      Y8, Y4, Y7         // <--                                  // vpshufb	ymm7, ymm4, ymm8
+	VMOVD        AX, X12            // <--                                  // vmovd	xmm12, eax
+	MOVL         $0x11, AX          // <--                                  // mov	eax, 17
+	VMOVDQA      LCPI0_3<>(SB), Y4  // <--                                  // vmovdqa	ymm4, ymmword ptr [rip + 0]
+	VPERM2I128   $0x21, Y7, Y1, Y1  // <--                                  // vperm2i128	ymm1, ymm1, ymm7, 33
+	VPBROADCASTB X15, Y15           // <--                                  // vpbroadcastb	ymm15, xmm15
+	VPBROADCASTB X12, Y12           // <--                                  // vpbroadcastb	ymm12, xmm12
+	VPSHUFB      Y8, Y4, Y8         // <--                                  // vpshufb	ymm8, ymm4, ymm8
+	VPALIGNR     $0xf, Y1, Y7, Y9   // <--                                  // vpalignr	ymm9, ymm7, ymm1, 15
+	VMOVD        AX, X4             // <--                                  // vmovd	xmm4, eax
+	MOVL         $-0x10, AX         // <--                                  // mov	eax, -16
+	VPBROADCASTB X4, Y4             // <--                                  // vpbroadcastb	ymm4, xmm4
+	VMOVD        AX, X0             // <--                                  // vmovd	xmm0, eax
+	MOVL         $0x70, AX          // <--                                  // mov	eax, 112
+	VPADDB       Y6, Y4, Y6         // <--                                  // vpaddb	ymm6, ymm4, ymm6
+	VPBROADCASTB X0, Y0             // <--                                  // vpbroadcastb	ymm0, xmm0
+	VPOR         Y8, Y9, Y9         // <--                                  // vpor	ymm9, ymm9, ymm8
+	VPSUBUSB     Y0, Y6, Y14        // <--                                  // vpsubusb	ymm14, ymm6, ymm0
+	VPALIGNR     $0xe, Y1, Y7, Y13  // <--                                  // vpalignr	ymm13, ymm7, ymm1, 14
+	VMOVDQA      Y0, 0x20(SP)       // <--                                  // vmovdqa	ymmword ptr [rsp + 32], ymm0
+	VMOVDQA      LCPI0_4<>(SB), Y0  // <--                                  // vmovdqa	ymm0, ymmword ptr [rip + 0]
+	VPSHUFB      Y14, Y11, Y14      // <--                                  // vpshufb	ymm14, ymm11, ymm14
+	VMOVD        AX, X11            // <--                                  // vmovd	xmm11, eax
+	VPSUBUSB     Y15, Y13, Y13      // <--                                  // vpsubusb	ymm13, ymm13, ymm15
+	VPBROADCASTB X11, Y11           // <--                                  // vpbroadcastb	ymm11, xmm11
+	VPALIGNR     $0xd, Y1, Y7, Y1   // <--                                  // vpalignr	ymm1, ymm7, ymm1, 13
+	VPSUBUSB     Y12, Y1, Y1        // <--                                  // vpsubusb	ymm1, ymm1, ymm12
+	VPADDUSB     Y11, Y6, Y6        // <--                                  // vpaddusb	ymm6, ymm6, ymm11
+	VPSHUFB      Y6, Y0, Y6         // <--                                  // vpshufb	ymm6, ymm0, ymm6
+	VPOR         Y1, Y13, Y13       // <--                                  // vpor	ymm13, ymm13, ymm1
+	VMOVDQA      LCPI0_5<>(SB), Y0  // <--                                  // vmovdqa	ymm0, ymmword ptr [rip + 0]
+	VMOVDQA      LCPI0_1<>(SB), Y1  // <--                                  // vmovdqa	ymm1, ymmword ptr [rip + 0]
+	VPOR         Y13, Y9, Y9        // <--                                  // vpor	ymm9, ymm9, ymm13
+	VPADDB       Y6, Y14, Y14       // <--                                  // vpaddb	ymm14, ymm14, ymm6
+	VPADDB       Y9, Y14, Y14       // <--                                  // vpaddb	ymm14, ymm14, ymm9
+	VPSRLW       $0x4, Y2, Y9       // <--                                  // vpsrlw	ymm9, ymm2, 4
+	VPAND        0x40(SP), Y9, Y9   // <--                                  // vpand	ymm9, ymm9, ymmword ptr [rsp + 64]
+	VPSHUFB      Y14, Y0, Y13       // <--                                  // vpshufb	ymm13, ymm0, ymm14
+	VMOVDQA      LCPI0_6<>(SB), Y0  // <--                                  // vmovdqa	ymm0, ymmword ptr [rip + 0]
+	VPCMPGTB     Y3, Y13, Y13       // <--                                  // vpcmpgtb	ymm13, ymm13, ymm3
+	VPSHUFB      Y14, Y0, Y6        // <--                                  // vpshufb	ymm6, ymm0, ymm14
+	VMOVDQA      LCPI0_3<>(SB), Y0  // <--                                  // vmovdqa	ymm0, ymmword ptr [rip + 0]
+	VMOVDQA      Y6, 0(SP)          // <--                                  // vmovdqa	ymmword ptr [rsp], ymm6
+	VPSHUFB      Y9, Y1, Y6         // <--                                  // vpshufb	ymm6, ymm1, ymm9
+	VPERM2I128   $0x21, Y6, Y7, Y7  // <--                                  // vperm2i128	ymm7, ymm7, ymm6, 33
+	LONG         $0xce6ffdc5        // VMOVDQA Y6, Y1                       // vmovdqa	ymm1, ymm6
+	VPSHUFB      Y9, Y0, Y9         // <--                                  // vpshufb	ymm9, ymm0, ymm9
+	VPALIGNR     $0xf, Y7, Y6, Y14  // <--                                  // vpalignr	ymm14, ymm6, ymm7, 15
+	VPALIGNR     $0xe, Y7, Y6, Y8   // <--                                  // vpalignr	ymm8, ymm6, ymm7, 14
+	VPALIGNR     $0xd, Y7, Y6, Y6   // <--                                  // vpalignr	ymm6, ymm6, ymm7, 13
+	VPERM2I128   $0x21, Y2, Y3, Y7  // <--                                  // vperm2i128	ymm7, ymm3, ymm2, 33
+	VPSUBUSB     Y15, Y8, Y8        // <--                                  // vpsubusb	ymm8, ymm8, ymm15
+	VMOVDQA      LCPI0_4<>(SB), Y15 // <--                                  // vmovdqa	ymm15, ymmword ptr [rip + 0]
+	VPALIGNR     $0xf, Y7, Y2, Y7   // <--                                  // vpalignr	ymm7, ymm2, ymm7, 15
+	VPSUBUSB     Y12, Y6, Y6        // <--                                  // vpsubusb	ymm6, ymm6, ymm12
+	VPOR         Y9, Y14, Y14       // <--                                  // vpor	ymm14, ymm14, ymm9
+	VMOVDQA      LCPI0_2<>(SB), Y12 // <--                                  // vmovdqa	ymm12, ymmword ptr [rip + 0]
+	VPADDB       Y7, Y4, Y4         // <--                                  // vpaddb	ymm4, ymm4, ymm7
+	VPSUBUSB     0x20(SP), Y4, Y0   // <--                                  // vpsubusb	ymm0, ymm4, ymmword ptr [rsp + 32]
+	VPOR         Y6, Y8, Y8         // <--                                  // vpor	ymm8, ymm8, ymm6
+	VPADDUSB     Y11, Y4, Y4        // <--                                  // vpaddusb	ymm4, ymm4, ymm11
+	VPOR         Y14, Y8, Y8        // <--                                  // vpor	ymm8, ymm8, ymm14
+	VMOVDQA      LCPI0_6<>(SB), Y11 // <--                                  // vmovdqa	ymm11, ymmword ptr [rip + 0]
+	VPSHUFB      Y4, Y15, Y4        // <--                                  // vpshufb	ymm4, ymm15, ymm4
+	VPCMPGTB     0(SP), Y3, Y3      // <--                                  // vpcmpgtb	ymm3, ymm3, ymmword ptr [rsp]
+	VPSHUFB      Y0, Y12, Y0        // <--                                  // vpshufb	ymm0, ymm12, ymm0
+	VPADDB       Y4, Y0, Y0         // <--                                  // vpaddb	ymm0, ymm0, ymm4
+	VMOVDQA      LCPI0_5<>(SB), Y4  // <--                                  // vmovdqa	ymm4, ymmword ptr [rip + 0]
+	VPADDB       Y8, Y0, Y0         // <--                                  // vpaddb	ymm0, ymm0, ymm8
+	VPSHUFB      Y0, Y4, Y4         // <--                                  // vpshufb	ymm4, ymm4, ymm0
+	VPSHUFB      Y0, Y11, Y0        // <--                                  // vpshufb	ymm0, ymm11, ymm0
+	VPCMPGTB     Y2, Y4, Y4         // <--                                  // vpcmpgtb	ymm4, ymm4, ymm2
+	VPCMPGTB     Y0, Y2, Y0         // <--                                  // vpcmpgtb	ymm0, ymm2, ymm0
+	VPOR         Y13, Y4, Y4        // <--                                  // vpor	ymm4, ymm4, ymm13
+	VPOR         Y3, Y0, Y0         // <--                                  // vpor	ymm0, ymm0, ymm3
+	VPOR         Y5, Y4, Y5         // <--                                  // vpor	ymm5, ymm4, ymm5
+	VPOR         Y0, Y10, Y10       // <--                                  // vpor	ymm10, ymm10, ymm0
+	LONG         $0xf56ffdc5        // VMOVDQA Y5, Y6                       // vmovdqa	ymm6, ymm5
+	VMOVDQA      Y10, Y0            // <--                                  // vmovdqa	ymm0, ymm10
+	JMP          LBB0_1             // <--                                  // jmp	.LBB0_1
 
 LBB0_4:
-	LONG           $0xcf6ffdc5               // VMOVDQA Y7, Y1                       // vmovdqa	ymm1, ymm7
-	LONG           $0xd06ffdc5               // VMOVDQA Y0, Y2                       // vmovdqa	ymm2, ymm0
-	LONG           $0x076ffec5               // VMOVDQU 0(DI), Y0                    // vmovdqu	ymm0, ymmword ptr [rdi]
-	LONG           $0xd071c5c5; BYTE $0x04   // VPSRLW $0x4, Y0, Y7                  // vpsrlw	ymm7, ymm0, 4
-	VPAND          LCPI0_0<>(SB), Y7, Y3     // <--                                  // vpand	ymm3, ymm7, ymmword ptr [rip + .LCPI0_0]
-	VBROADCASTI128 LCPI0_20<>(SB), Y4        // <--                                  // vbroadcasti128	ymm4, xmmword ptr [rip + .LCPI0_20]
-	LONG           $0x005de2c4; BYTE $0xfb   // VPSHUFB Y3, Y4, Y7                   // vpshufb	ymm7, ymm4, ymm3
-	VBROADCASTI128 LCPI0_21<>(SB), Y4        // <--                                  // vbroadcasti128	ymm4, xmmword ptr [rip + .LCPI0_21]
-	LONG           $0x005de2c4; BYTE $0xdb   // VPSHUFB Y3, Y4, Y3                   // vpshufb	ymm3, ymm4, ymm3
-	LONG           $0x4675e3c4; WORD $0x21cf // VPERM2I128 $0x21, Y7, Y1, Y1         // vperm2i128	ymm1, ymm1, ymm7, 33
-	LONG           $0x0f45e3c4; WORD $0x0fe1 // VPALIGNR $0xf, Y1, Y7, Y4            // vpalignr	ymm4, ymm7, ymm1, 15
-	LONG           $0xdbebddc5               // VPOR Y3, Y4, Y3                      // vpor	ymm3, ymm4, ymm3
-	LONG           $0x0f45e3c4; WORD $0x0ee1 // VPALIGNR $0xe, Y1, Y7, Y4            // vpalignr	ymm4, ymm7, ymm1, 14
-	VPSUBUSB       LCPI0_3<>(SB), Y4, Y4     // <--                                  // vpsubusb	ymm4, ymm4, ymmword ptr [rip + .LCPI0_3]
-	LONG           $0xdcebe5c5               // VPOR Y4, Y3, Y3                      // vpor	ymm3, ymm3, ymm4
-	LONG           $0x0f45e3c4; WORD $0x0dc9 // VPALIGNR $0xd, Y1, Y7, Y1            // vpalignr	ymm1, ymm7, ymm1, 13
-	LONG           $0xcdd8f5c5               // VPSUBUSB Y5, Y1, Y1                  // vpsubusb	ymm1, ymm1, ymm5
-	LONG           $0xc9ebe5c5               // VPOR Y1, Y3, Y1                      // vpor	ymm1, ymm3, ymm1
-	LONG           $0x466de3c4; WORD $0x21d0 // VPERM2I128 $0x21, Y0, Y2, Y2         // vperm2i128	ymm2, ymm2, ymm0, 33
-	LONG           $0x0f7de3c4; WORD $0x0fd2 // VPALIGNR $0xf, Y2, Y0, Y2            // vpalignr	ymm2, ymm0, ymm2, 15
-	LONG           $0xd6fcedc5               // VPADDB Y6, Y2, Y2                    // vpaddb	ymm2, ymm2, ymm6
-	LONG           $0xd86dc1c4; BYTE $0xd8   // VPSUBUSB Y8, Y2, Y3                  // vpsubusb	ymm3, ymm2, ymm8
-	LONG           $0x0035e2c4; BYTE $0xdb   // VPSHUFB Y3, Y9, Y3                   // vpshufb	ymm3, ymm9, ymm3
-	LONG           $0xd2dcadc5               // VPADDUSB Y2, Y10, Y2                 // vpaddusb	ymm2, ymm10, ymm2
-	LONG           $0x0025e2c4; BYTE $0xd2   // VPSHUFB Y2, Y11, Y2                  // vpshufb	ymm2, ymm11, ymm2
-	LONG           $0xd3fcedc5               // VPADDB Y3, Y2, Y2                    // vpaddb	ymm2, ymm2, ymm3
-	LONG           $0xc9fcedc5               // VPADDB Y1, Y2, Y1                    // vpaddb	ymm1, ymm2, ymm1
-	LONG           $0x001de2c4; BYTE $0xd1   // VPSHUFB Y1, Y12, Y2                  // vpshufb	ymm2, ymm12, ymm1
-	LONG           $0xd064edc5               // VPCMPGTB Y0, Y2, Y2                  // vpcmpgtb	ymm2, ymm2, ymm0
-	LONG           $0xf2eb0dc5               // VPOR Y2, Y14, Y14                    // vpor	ymm14, ymm14, ymm2
-	LONG           $0x0015e2c4; BYTE $0xc9   // VPSHUFB Y1, Y13, Y1                  // vpshufb	ymm1, ymm13, ymm1
-	LONG           $0xc964fdc5               // VPCMPGTB Y1, Y0, Y1                  // vpcmpgtb	ymm1, ymm0, ymm1
-	LONG           $0xf9eb05c5               // VPOR Y1, Y15, Y15                    // vpor	ymm15, ymm15, ymm1
-	ADDQ           $-0x20, SI                // <--                                  // add	rsi, -32
-	LONG           $0xe0c6f640               // TESTL $0xe0, SI                      // test	sil, -32
-	JNE            LBB0_3                    // <--                                  // jne	.LBB0_3
-	LONG           $0xeb05c1c4; BYTE $0xce   // VPOR Y14, Y15, Y1                    // vpor	ymm1, ymm15, ymm14
-	LONG           $0x177de2c4; BYTE $0xc9   // VPTEST Y1, Y1                        // vptest	ymm1, ymm1
-	JE             LBB0_3                    // <--                                  // je	.LBB0_3
-	XORL           AX, AX                    // <--                                  // xor	eax, eax
+	CMPQ SI, $0x1f // <--                                  // cmp	rsi, 31
+	JG   LBB0_22   // <--                                  // jg	.LBB0_22
+
+LBB0_5:
+	VPOR         Y0, Y6, Y6   // <--                                  // vpor	ymm6, ymm6, ymm0
+	XORL         AX, AX       // <--                                  // xor	eax, eax
+	VPTEST       Y6, Y6       // <--                                  // vptest	ymm6, ymm6
+	JNE          LBB0_20      // <--                                  // jne	.LBB0_20
+	VEXTRACTI128 $0x1, Y2, X2 // <--                                  // vextracti128	xmm2, ymm2, 1
+	VPEXTRD      $0x3, X2, AX // <--                                  // vpextrd	eax, xmm2, 3
+	MOVL         AX, CX       // <--                                  // mov	ecx, eax
+	SARL         $0x18, CX    // <--                                  // sar	ecx, 24
+	CMPB         CX, $0xc0    // <--                                  // cmp	cl, -64
+	JGE          LBB0_19      // <--                                  // jge	.LBB0_19
+	MOVL         AX, CX       // <--                                  // mov	ecx, eax
+	SHLL         $0x8, CX     // <--                                  // shl	ecx, 8
+	SARL         $0x18, CX    // <--                                  // sar	ecx, 24
+	CMPB         CX, $0xc0    // <--                                  // cmp	cl, -64
+	JGE          LBB0_23      // <--                                  // jge	.LBB0_23
+	MOVBLSX      AH, AX       // <--                                  // movsx	eax, ah
+	WORD         $0xc03c      // CMPB AX, $0xc0                       // cmp	al, -64
+	JL           LBB0_6       // <--                                  // jl	.LBB0_6
+	SUBQ         $0x3, DX     // <--                                  // sub	rdx, 3
+	LEAL         0x3(SI), CX  // <--                                  // lea	ecx, [rsi + 3]
+	VZEROUPPER                // <--                                  // vzeroupper
+	JMP          LBB0_9       // <--                                  // jmp	.LBB0_9
+
+LBB0_6:
+	VZEROUPPER // <--                                  // vzeroupper
 
 LBB0_7:
-	NOP                 // (skipped)                            // mov	rsp, rbp
-	NOP                 // (skipped)                            // pop	rbp
-	VZEROUPPER          // <--                                  // vzeroupper
-	MOVB AX, ret+16(FP) // <--
-	RET                 // <--                                  // ret
-
-LBB0_1:
-	WORD $0xf685 // TESTL SI, SI                         // test	esi, esi
-	JNE  LBB0_15 // <--                                  // jne	.LBB0_15
-	JMP  LBB0_13 // <--                                  // jmp	.LBB0_13
+	MOVL  SI, CX  // <--                                  // mov	ecx, esi
+	TESTL SI, SI  // <--                                  // test	esi, esi
+	JNE   LBB0_9  // <--                                  // jne	.LBB0_9
+	JMP   LBB0_13 // <--                                  // jmp	.LBB0_13
 
 LBB0_8:
-	LONG $0xeb0dc1c4; BYTE $0xcf   // VPOR Y15, Y14, Y1                    // vpor	ymm1, ymm14, ymm15
-	LONG $0x177de2c4; BYTE $0xc9   // VPTEST Y1, Y1                        // vptest	ymm1, ymm1
-	JNE  LBB0_29                   // <--                                  // jne	.LBB0_29
-	LONG $0x397de3c4; WORD $0x01c0 // VEXTRACTI128 $0x1, Y0, X0            // vextracti128	xmm0, ymm0, 1
-	LONG $0x1679e3c4; WORD $0x03c1 // VPEXTRD $0x3, X0, CX                 // vpextrd	ecx, xmm0, 3
-	LONG $0x000001b8; BYTE $0x00   // MOVL $0x1, AX                        // mov	eax, 1
-	CMPL CX, $-0x40000001          // <--                                  // cmp	ecx, -1073741825
-	JG   LBB0_12                   // <--                                  // jg	.LBB0_12
-	WORD $0xca89                   // MOVL CX, DX                          // mov	edx, ecx
-	WORD $0xe2c1; BYTE $0x08       // SHLL $0x8, DX                        // shl	edx, 8
-	LONG $0x000002b8; BYTE $0x00   // MOVL $0x2, AX                        // mov	eax, 2
-	CMPL DX, $-0x40000001          // <--                                  // cmp	edx, -1073741825
-	JG   LBB0_12                   // <--                                  // jg	.LBB0_12
-	WORD $0xbf0f; BYTE $0xc1       // MOVSX CX, AX                         // movsx	eax, cx
-	XORL CX, CX                    // <--                                  // xor	ecx, ecx
-	CMPL AX, $-0x4000              // <--                                  // cmp	eax, -16384
-	WORD $0x9d0f; BYTE $0xc1       // SETGE CL                             // setge	cl
-	LEAQ 0(CX)(CX*2), AX           // <--                                  // lea	rax, [rcx + 2*rcx]
+	ADDQ DI, DX  // <--                                  // add	rdx, rdi
+	SUBL AX, CX  // <--                                  // sub	ecx, eax
+	JE   LBB0_13 // <--                                  // je	.LBB0_13
+
+LBB0_9:
+	MOVBLZX 0(DX), SI      // <--                                  // movzx	esi, byte ptr [rdx]
+	MOVL    $0x1, DI       // <--                                  // mov	edi, 1
+	MOVL    $0x1, AX       // <--                                  // mov	eax, 1
+	TESTB   SI, SI         // <--                                  // test	sil, sil
+	JNS     LBB0_8         // <--                                  // jns	.LBB0_8
+	LEAL    0x3e(SI), AX   // <--                                  // lea	eax, [rsi + 62]
+	WORD    $0x1d3c        // CMPB AX, $0x1d                       // cmp	al, 29
+	SETLS   AX             // <--                                  // setbe	al
+	CMPL    CX, $0x1       // <--                                  // cmp	ecx, 1
+	SETGT   DI             // <--                                  // setg	dil
+	ANDB    DI, AX         // <--                                  // and	al, dil
+	JNE     LBB0_15        // <--                                  // jne	.LBB0_15
+	CMPL    CX, $0x2       // <--                                  // cmp	ecx, 2
+	JLE     LBB0_14        // <--                                  // jle	.LBB0_14
+	MOVBLZX 0x1(DX), R8    // <--                                  // movzx	r8d, byte ptr [rdx + 1]
+	CMPB    0x2(DX), $0xc0 // <--                                  // cmp	byte ptr [rdx + 2], -64
+	SETLT   AX             // <--                                  // setl	al
+	CMPB    R8, $0xc0      // <--                                  // cmp	r8b, -64
+	SETLT   DI             // <--                                  // setl	dil
+	ANDB    DI, AX         // <--                                  // and	al, dil
+	JE      LBB0_14        // <--                                  // je	.LBB0_14
+	CMPB    SI, $0xe0      // <--                                  // cmp	sil, -32
+	JNE     LBB0_10        // <--                                  // jne	.LBB0_10
+	MOVL    $0x3, DI       // <--                                  // mov	edi, 3
+	MOVL    $0x3, AX       // <--                                  // mov	eax, 3
+	CMPB    R8, $0x9f      // <--                                  // cmp	r8b, -97
+	JA      LBB0_8         // <--                                  // ja	.LBB0_8
+
+LBB0_10:
+	LEAL  0x1f(SI), AX   // <--                                  // lea	eax, [rsi + 31]
+	WORD  $0xb3c         // CMPB AX, $0xb                        // cmp	al, 11
+	JBE   LBB0_16        // <--                                  // jbe	.LBB0_16
+	CMPB  SI, $0xed      // <--                                  // cmp	sil, -19
+	SETEQ AX             // <--                                  // sete	al
+	CMPB  R8, $0x9f      // <--                                  // cmp	r8b, -97
+	SETLS DI             // <--                                  // setbe	dil
+	ANDB  DI, AX         // <--                                  // and	al, dil
+	JNE   LBB0_16        // <--                                  // jne	.LBB0_16
+	LEAL  0x12(SI), DI   // <--                                  // lea	edi, [rsi + 18]
+	CMPB  DI, $0x1       // <--                                  // cmp	dil, 1
+	JBE   LBB0_16        // <--                                  // jbe	.LBB0_16
+	CMPL  CX, $0x3       // <--                                  // cmp	ecx, 3
+	JE    LBB0_14        // <--                                  // je	.LBB0_14
+	CMPB  0x3(DX), $0xc0 // <--                                  // cmp	byte ptr [rdx + 3], -64
+	JGE   LBB0_14        // <--                                  // jge	.LBB0_14
+	CMPB  SI, $0xf0      // <--                                  // cmp	sil, -16
+	JNE   LBB0_11        // <--                                  // jne	.LBB0_11
+	MOVL  $0x4, DI       // <--                                  // mov	edi, 4
+	MOVL  $0x4, AX       // <--                                  // mov	eax, 4
+	CMPB  R8, $0x8f      // <--                                  // cmp	r8b, -113
+	JA    LBB0_8         // <--                                  // ja	.LBB0_8
+
+LBB0_11:
+	LEAL  0xf(SI), AX // <--                                  // lea	eax, [rsi + 15]
+	WORD  $0x23c      // CMPB AX, $0x2                        // cmp	al, 2
+	JBE   LBB0_12     // <--                                  // jbe	.LBB0_12
+	CMPB  SI, $0xf4   // <--                                  // cmp	sil, -12
+	SETEQ AX          // <--                                  // sete	al
+	CMPB  R8, $0x8f   // <--                                  // cmp	r8b, -113
+	SETLS SI          // <--                                  // setbe	sil
+	ANDB  SI, AX      // <--                                  // and	al, sil
+	JE    LBB0_14     // <--                                  // je	.LBB0_14
 
 LBB0_12:
-	SUBQ AX, DI  // <--                                  // sub	rdi, rax
-	ADDQ AX, SI  // <--                                  // add	rsi, rax
-	WORD $0xf685 // TESTL SI, SI                         // test	esi, esi
-	JNE  LBB0_15 // <--                                  // jne	.LBB0_15
+	MOVL $0x4, DI // <--                                  // mov	edi, 4
+	MOVL $0x4, AX // <--                                  // mov	eax, 4
+	ADDQ DI, DX   // <--                                  // add	rdx, rdi
+	SUBL AX, CX   // <--                                  // sub	ecx, eax
+	JNE  LBB0_9   // <--                                  // jne	.LBB0_9
 
 LBB0_13:
-	WORD $0x01b0        // MOVL $0x1, AL                        // mov	al, 1
-	NOP                 // (skipped)                            // mov	rsp, rbp
-	NOP                 // (skipped)                            // pop	rbp
-	VZEROUPPER          // <--                                  // vzeroupper
-	MOVB AX, ret+16(FP) // <--
-	RET                 // <--                                  // ret
+	MOVL $0x1, AX // <--                                  // mov	eax, 1
 
 LBB0_14:
-	WORD $0x8944; BYTE $0xc0 // MOVL R8, AX                          // mov	eax, r8d
-	ADDQ AX, DI              // <--                                  // add	rdi, rax
-	WORD $0x2944; BYTE $0xc6 // SUBL R8, SI                          // sub	esi, r8d
-	JE   LBB0_13             // <--                                  // je	.LBB0_13
+	MOVQ BP, SP         // <--                                  // leave
+	POPQ BP             // <--
+	MOVB AX, ret+16(FP) // <--
+	RET                 // <--                                  // ret
 
 LBB0_15:
-	WORD $0xb60f; BYTE $0x0f       // MOVZX 0(DI), CX                      // movzx	ecx, byte ptr [rdi]
-	LONG $0x0001b841; WORD $0x0000 // MOVL $0x1, R8                        // mov	r8d, 1
-	WORD $0xc984                   // TESTL CL, CL                         // test	cl, cl
-	JNS  LBB0_14                   // <--                                  // jns	.LBB0_14
-	CMPL SI, $0x2                  // <--                                  // cmp	esi, 2
-	JL   LBB0_19                   // <--                                  // jl	.LBB0_19
-	WORD $0x418d; BYTE $0x3e       // LEAL 0x3e(CX), AX                    // lea	eax, [rcx + 62]
-	WORD $0x1d3c                   // CMPL AL, $0x1d                       // cmp	al, 29
-	JA   LBB0_19                   // <--                                  // ja	.LBB0_19
-	LONG $0x0002b841; WORD $0x0000 // MOVL $0x2, R8                        // mov	r8d, 2
-	CMPB 0x1(DI), $0xc0            // <--                                  // cmp	byte ptr [rdi + 1], -64
-	JL   LBB0_14                   // <--                                  // jl	.LBB0_14
-
-LBB0_19:
-	CMPL SI, $0x3                  // <--                                  // cmp	esi, 3
-	JL   LBB0_29                   // <--                                  // jl	.LBB0_29
-	LONG $0x0157b60f               // MOVZX 0x1(DI), DX                    // movzx	edx, byte ptr [rdi + 1]
-	WORD $0xfa80; BYTE $0xc0       // CMPL DL, $0xc0                       // cmp	dl, -64
-	LONG $0xc09c0f41               // SETL R8                              // setl	r8b
-	CMPB 0x2(DI), $0xc0            // <--                                  // cmp	byte ptr [rdi + 2], -64
-	WORD $0x9c0f; BYTE $0xc0       // SETL AL                              // setl	al
-	WORD $0x2044; BYTE $0xc0       // ANDL R8, AL                          // and	al, r8b
-	WORD $0x013c                   // CMPL AL, $0x1                        // cmp	al, 1
-	JNE  LBB0_24                   // <--                                  // jne	.LBB0_24
-	WORD $0xf980; BYTE $0xe0       // CMPL CL, $0xe0                       // cmp	cl, -32
-	LONG $0xc0940f41               // SETE R8                              // sete	r8b
-	WORD $0xfa80; BYTE $0xa0       // CMPL DL, $0xa0                       // cmp	dl, -96
-	LONG $0xc1930f41               // SETAE R9                             // setae	r9b
-	WORD $0x2045; BYTE $0xc1       // ANDL R8, R9                          // and	r9b, r8b
-	LONG $0x1f418d44               // LEAL 0x1f(CX), R8                    // lea	r8d, [rcx + 31]
-	CMPB R8, $0xc                  // <--                                  // cmp	r8b, 12
-	LONG $0xc0920f41               // SETB R8                              // setb	r8b
-	WORD $0x0845; BYTE $0xc8       // ORL R9, R8                           // or	r8b, r9b
-	LONG $0x0003b841; WORD $0x0000 // MOVL $0x3, R8                        // mov	r8d, 3
-	JNE  LBB0_14                   // <--                                  // jne	.LBB0_14
-	WORD $0xf980; BYTE $0xed       // CMPL CL, $0xed                       // cmp	cl, -19
-	LONG $0xc1940f41               // SETE R9                              // sete	r9b
-	WORD $0xfa80; BYTE $0xa0       // CMPL DL, $0xa0                       // cmp	dl, -96
-	LONG $0xc2920f41               // SETB R10                             // setb	r10b
-	WORD $0x8941; BYTE $0xcb       // MOVL CX, R11                         // mov	r11d, ecx
-	ANDB $0xfe, R11                // <--                                  // and	r11b, -2
-	CMPB R11, $0xee                // <--                                  // cmp	r11b, -18
-	JE   LBB0_14                   // <--                                  // je	.LBB0_14
-	WORD $0x2045; BYTE $0xd1       // ANDL R10, R9                         // and	r9b, r10b
-	JNE  LBB0_14                   // <--                                  // jne	.LBB0_14
-
-LBB0_24:
-	CMPL SI, $0x3                  // <--                                  // cmp	esi, 3
-	JE   LBB0_29                   // <--                                  // je	.LBB0_29
-	CMPB 0x3(DI), $0xc0            // <--                                  // cmp	byte ptr [rdi + 3], -64
-	LONG $0xc09c0f41               // SETL R8                              // setl	r8b
-	WORD $0x2044; BYTE $0xc0       // ANDL R8, AL                          // and	al, r8b
-	WORD $0x013c                   // CMPL AL, $0x1                        // cmp	al, 1
-	JNE  LBB0_29                   // <--                                  // jne	.LBB0_29
-	WORD $0xf980; BYTE $0xf0       // CMPL CL, $0xf0                       // cmp	cl, -16
-	WORD $0x940f; BYTE $0xc0       // SETE AL                              // sete	al
-	WORD $0xfa80; BYTE $0x90       // CMPL DL, $0x90                       // cmp	dl, -112
-	LONG $0xc0930f41               // SETAE R8                             // setae	r8b
-	WORD $0x2041; BYTE $0xc0       // ANDL AL, R8                          // and	r8b, al
-	WORD $0x418d; BYTE $0x0f       // LEAL 0xf(CX), AX                     // lea	eax, [rcx + 15]
-	WORD $0x033c                   // CMPL AL, $0x3                        // cmp	al, 3
-	WORD $0x920f; BYTE $0xc0       // SETB AL                              // setb	al
-	WORD $0x0844; BYTE $0xc0       // ORL R8, AL                           // or	al, r8b
-	LONG $0x0004b841; WORD $0x0000 // MOVL $0x4, R8                        // mov	r8d, 4
-	JNE  LBB0_14                   // <--                                  // jne	.LBB0_14
-	XORL AX, AX                    // <--                                  // xor	eax, eax
-	WORD $0xf980; BYTE $0xf4       // CMPL CL, $0xf4                       // cmp	cl, -12
-	JNE  LBB0_7                    // <--                                  // jne	.LBB0_7
-	WORD $0xfa80; BYTE $0x8f       // CMPL DL, $0x8f                       // cmp	dl, -113
-	JBE  LBB0_14                   // <--                                  // jbe	.LBB0_14
-	JMP  LBB0_7                    // <--                                  // jmp	.LBB0_7
-
-LBB0_29:
+	CMPB 0x1(DX), $0xc0 // <--                                  // cmp	byte ptr [rdx + 1], -64
+	JL   LBB0_17        // <--                                  // jl	.LBB0_17
+	BYTE $0xc9          // LEAVE                                // leave
 	XORL AX, AX         // <--                                  // xor	eax, eax
-	NOP                 // (skipped)                            // mov	rsp, rbp
-	NOP                 // (skipped)                            // pop	rbp
-	VZEROUPPER          // <--                                  // vzeroupper
 	MOVB AX, ret+16(FP) // <--
 	RET                 // <--                                  // ret
+
+LBB0_16:
+	MOVL $0x3, DI // <--                                  // mov	edi, 3
+	MOVL $0x3, AX // <--                                  // mov	eax, 3
+	JMP  LBB0_8   // <--                                  // jmp	.LBB0_8
+
+LBB0_17:
+	MOVL $0x2, DI // <--                                  // mov	edi, 2
+	MOVL $0x2, AX // <--                                  // mov	eax, 2
+	JMP  LBB0_8   // <--                                  // jmp	.LBB0_8
+
+LBB0_18:
+	XORL       AX, AX         // <--                                  // xor	eax, eax
+	VZEROUPPER                // <--                                  // vzeroupper
+	BYTE       $0xc9          // LEAVE                                // leave
+	MOVB       AX, ret+16(FP) // <--
+	RET                       // <--                                  // ret
+
+LBB0_19:
+	SUBQ       $0x1, DX    // <--                                  // sub	rdx, 1
+	LEAL       0x1(SI), CX // <--                                  // lea	ecx, [rsi + 1]
+	VZEROUPPER             // <--                                  // vzeroupper
+	JMP        LBB0_9      // <--                                  // jmp	.LBB0_9
+
+LBB0_20:
+	VZEROUPPER                // <--                                  // vzeroupper
+	BYTE       $0xc9          // LEAVE                                // leave
+	MOVB       AX, ret+16(FP) // <--
+	RET                       // <--                                  // ret
+
+LBB0_21:
+	VPXOR X0, X0, X0  // <--                                  // vpxor	xmm0, xmm0, xmm0
+	LONG  $0xf06ffdc5 // VMOVDQA Y0, Y6                       // vmovdqa	ymm6, ymm0
+	LONG  $0xd06ffdc5 // VMOVDQA Y0, Y2                       // vmovdqa	ymm2, ymm0
+	LONG  $0xc86ffdc5 // VMOVDQA Y0, Y1                       // vmovdqa	ymm1, ymm0
+
+LBB0_22:
+	VMOVDQU      0(DX), Y4              // <--                                  // vmovdqu	ymm4, ymmword ptr [rdx]
+	VMOVDQA      LCPI0_3<>(SB), Y7      // <--                                  // vmovdqa	ymm7, ymmword ptr [rip + 0]
+	ADDQ         $0x20, DX              // <--                                  // add	rdx, 32
+	SUBQ         $0x20, SI              // <--                                  // sub	rsi, 32
+	MOVQ         $0xf0f0f0f0f0f0f0f, AX // <--                                  // movabs	rax, 1085102592571150095
+	VMOVQ        AX, X3                 // <--                                  // vmovq	xmm3, rax
+	VPSRLW       $0x4, Y4, Y5           // <--                                  // vpsrlw	ymm5, ymm4, 4
+	MOVL         $0x1, AX               // <--                                  // mov	eax, 1
+	VPBROADCASTQ X3, Y3                 // <--                                  // vpbroadcastq	ymm3, xmm3
+	VMOVD        AX, X9                 // <--                                  // vmovd	xmm9, eax
+	MOVL         $0x2, AX               // <--                                  // mov	eax, 2
+	VPAND        Y3, Y5, Y5             // <--                                  // vpand	ymm5, ymm5, ymm3
+	VMOVDQA      LCPI0_1<>(SB), Y3      // <--                                  // vmovdqa	ymm3, ymmword ptr [rip + 0]
+	VPBROADCASTB X9, Y9                 // <--                                  // vpbroadcastb	ymm9, xmm9
+	VPSHUFB      Y5, Y7, Y7             // <--                                  // vpshufb	ymm7, ymm7, ymm5
+	VPSHUFB      Y5, Y3, Y3             // <--                                  // vpshufb	ymm3, ymm3, ymm5
+	VPERM2I128   $0x21, Y3, Y1, Y1      // <--                                  // vperm2i128	ymm1, ymm1, ymm3, 33
+	VPALIGNR     $0xf, Y1, Y3, Y8       // <--                                  // vpalignr	ymm8, ymm3, ymm1, 15
+	VPALIGNR     $0xe, Y1, Y3, Y5       // <--                                  // vpalignr	ymm5, ymm3, ymm1, 14
+	VPALIGNR     $0xd, Y1, Y3, Y3       // <--                                  // vpalignr	ymm3, ymm3, ymm1, 13
+	VMOVD        AX, X1                 // <--                                  // vmovd	xmm1, eax
+	MOVL         $0x11, AX              // <--                                  // mov	eax, 17
+	VPBROADCASTB X1, Y1                 // <--                                  // vpbroadcastb	ymm1, xmm1
+	VPSUBUSB     Y9, Y5, Y5             // <--                                  // vpsubusb	ymm5, ymm5, ymm9
+	VPSUBUSB     Y1, Y3, Y3             // <--                                  // vpsubusb	ymm3, ymm3, ymm1
+	VPERM2I128   $0x21, Y4, Y2, Y1      // <--                                  // vperm2i128	ymm1, ymm2, ymm4, 33
+	VMOVD        AX, X2                 // <--                                  // vmovd	xmm2, eax
+	MOVL         $-0x10, AX             // <--                                  // mov	eax, -16
+	VPALIGNR     $0xf, Y1, Y4, Y1       // <--                                  // vpalignr	ymm1, ymm4, ymm1, 15
+	VMOVD        AX, X9                 // <--                                  // vmovd	xmm9, eax
+	VPBROADCASTB X2, Y2                 // <--                                  // vpbroadcastb	ymm2, xmm2
+	MOVL         $0x70, AX              // <--                                  // mov	eax, 112
+	VPADDB       Y1, Y2, Y2             // <--                                  // vpaddb	ymm2, ymm2, ymm1
+	VPBROADCASTB X9, Y9                 // <--                                  // vpbroadcastb	ymm9, xmm9
+	VMOVDQA      LCPI0_2<>(SB), Y1      // <--                                  // vmovdqa	ymm1, ymmword ptr [rip + 0]
+	VPOR         Y3, Y5, Y5             // <--                                  // vpor	ymm5, ymm5, ymm3
+	VPSUBUSB     Y9, Y2, Y9             // <--                                  // vpsubusb	ymm9, ymm2, ymm9
+	VPSHUFB      Y9, Y1, Y1             // <--                                  // vpshufb	ymm1, ymm1, ymm9
+	VMOVD        AX, X9                 // <--                                  // vmovd	xmm9, eax
+	VPBROADCASTB X9, Y9                 // <--                                  // vpbroadcastb	ymm9, xmm9
+	VPADDUSB     Y9, Y2, Y2             // <--                                  // vpaddusb	ymm2, ymm2, ymm9
+	VMOVDQA      LCPI0_4<>(SB), Y9      // <--                                  // vmovdqa	ymm9, ymmword ptr [rip + 0]
+	VPSHUFB      Y2, Y9, Y9             // <--                                  // vpshufb	ymm9, ymm9, ymm2
+	VPOR         Y7, Y8, Y2             // <--                                  // vpor	ymm2, ymm8, ymm7
+	VPOR         Y5, Y2, Y2             // <--                                  // vpor	ymm2, ymm2, ymm5
+	VPADDB       Y9, Y1, Y1             // <--                                  // vpaddb	ymm1, ymm1, ymm9
+	VPADDB       Y2, Y1, Y1             // <--                                  // vpaddb	ymm1, ymm1, ymm2
+	VMOVDQA      LCPI0_5<>(SB), Y2      // <--                                  // vmovdqa	ymm2, ymmword ptr [rip + 0]
+	VPSHUFB      Y1, Y2, Y3             // <--                                  // vpshufb	ymm3, ymm2, ymm1
+	VMOVDQA      LCPI0_6<>(SB), Y2      // <--                                  // vmovdqa	ymm2, ymmword ptr [rip + 0]
+	VPSHUFB      Y1, Y2, Y1             // <--                                  // vpshufb	ymm1, ymm2, ymm1
+	VPCMPGTB     Y4, Y3, Y2             // <--                                  // vpcmpgtb	ymm2, ymm3, ymm4
+	VPCMPGTB     Y1, Y4, Y1             // <--                                  // vpcmpgtb	ymm1, ymm4, ymm1
+	VPOR         Y2, Y6, Y6             // <--                                  // vpor	ymm6, ymm6, ymm2
+	LONG         $0xd46ffdc5            // VMOVDQA Y4, Y2                       // vmovdqa	ymm2, ymm4
+	VPOR         Y1, Y0, Y0             // <--                                  // vpor	ymm0, ymm0, ymm1
+	JMP          LBB0_5                 // <--                                  // jmp	.LBB0_5
+
+LBB0_23:
+	SUBQ $0x2, DX            // <--                                  // sub	rdx, 2
+	LEAL 0x2(SI), CX         // <--                                  // lea	ecx, [rsi + 2]
+	WORD $0xf8c5; BYTE $0x77 // VZEROUPPER                           // vzeroupper
+	JMP  LBB0_9              // <--                                  // jmp	.LBB0_9
@@ -0,0 +1,211 @@
+//go:build !noasm && amd64
+// Code generated by gccasm -- DO NOT EDIT.
+//
+// Source file         : range_avx512.c
+// Compiler version    : gcc (Debian 12.2.0-14+deb12u1) 12.2.0
+// Target architecture : amd64
+// Compiler options    : -mavx512f -mavx512bw -mavx512vl -mavx512vbmi -mavx2 -mfma -mpopcnt
+
+#include "textflag.h"
+
+DATA LCPI0_0<>+0x00(SB)/8, $0x0202020202020202
+DATA LCPI0_0<>+0x08(SB)/8, $0x4915012180808080
+GLOBL LCPI0_0<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_1<>+0x00(SB)/8, $0xcbcbcb8b8383a3e7
+DATA LCPI0_1<>+0x08(SB)/8, $0xcbcbdbcbcbcbcbcb
+GLOBL LCPI0_1<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_2<>+0x00(SB)/8, $0x0101010101010101
+DATA LCPI0_2<>+0x08(SB)/8, $0x01010101babaaee6
+GLOBL LCPI0_2<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_3<>+0x00(SB)/8, $0x464544434241403f
+DATA LCPI0_3<>+0x08(SB)/8, $0x4e4d4c4b4a494847
+DATA LCPI0_3<>+0x10(SB)/8, $0x565554535251504f
+DATA LCPI0_3<>+0x18(SB)/8, $0x5e5d5c5b5a595857
+DATA LCPI0_3<>+0x20(SB)/8, $0x666564636261605f
+DATA LCPI0_3<>+0x28(SB)/8, $0x6e6d6c6b6a696867
+DATA LCPI0_3<>+0x30(SB)/8, $0x767574737271706f
+DATA LCPI0_3<>+0x38(SB)/8, $0x7e7d7c7b7a797877
+DATA LCPI0_3<>+0x40(SB)/8, $0x4544434241403f3e
+DATA LCPI0_3<>+0x48(SB)/8, $0x4d4c4b4a49484746
+DATA LCPI0_3<>+0x50(SB)/8, $0x5554535251504f4e
+DATA LCPI0_3<>+0x58(SB)/8, $0x5d5c5b5a59585756
+DATA LCPI0_3<>+0x60(SB)/8, $0x6564636261605f5e
+DATA LCPI0_3<>+0x68(SB)/8, $0x6d6c6b6a69686766
+DATA LCPI0_3<>+0x70(SB)/8, $0x7574737271706f6e
+DATA LCPI0_3<>+0x78(SB)/8, $0x7d7c7b7a79787776
+DATA LCPI0_3<>+0x80(SB)/8, $0x44434241403f3e3d
+DATA LCPI0_3<>+0x88(SB)/8, $0x4c4b4a4948474645
+DATA LCPI0_3<>+0x90(SB)/8, $0x54535251504f4e4d
+DATA LCPI0_3<>+0x98(SB)/8, $0x5c5b5a5958575655
+DATA LCPI0_3<>+0xa0(SB)/8, $0x64636261605f5e5d
+DATA LCPI0_3<>+0xa8(SB)/8, $0x6c6b6a6968676665
+DATA LCPI0_3<>+0xb0(SB)/8, $0x74737271706f6e6d
+DATA LCPI0_3<>+0xb8(SB)/8, $0x7c7b7a7978777675
+DATA LCPI0_3<>+0xc0(SB)/8, $0xffffffffffffffff
+DATA LCPI0_3<>+0xc8(SB)/8, $0xffffffffffffffff
+DATA LCPI0_3<>+0xd0(SB)/8, $0xffffffffffffffff
+DATA LCPI0_3<>+0xd8(SB)/8, $0xffffffffffffffff
+DATA LCPI0_3<>+0xe0(SB)/8, $0xffffffffffffffff
+DATA LCPI0_3<>+0xe8(SB)/8, $0xffffffffffffffff
+DATA LCPI0_3<>+0xf0(SB)/8, $0xffffffffffffffff
+DATA LCPI0_3<>+0xf8(SB)/8, $0xbfdfefffffffffff
+GLOBL LCPI0_3<>(SB), (RODATA|NOPTR), $256
+
+DATA LCPI0_4<>+0x00(SB)/8, $0x4544434241403f3e
+DATA LCPI0_4<>+0x08(SB)/8, $0x4d4c4b4a49484746
+DATA LCPI0_4<>+0x10(SB)/8, $0x5554535251504f4e
+DATA LCPI0_4<>+0x18(SB)/8, $0x5d5c5b5a59585756
+DATA LCPI0_4<>+0x20(SB)/8, $0x6564636261605f5e
+DATA LCPI0_4<>+0x28(SB)/8, $0x6d6c6b6a69686766
+DATA LCPI0_4<>+0x30(SB)/8, $0x7574737271706f6e
+DATA LCPI0_4<>+0x38(SB)/8, $0x7d7c7b7a79787776
+DATA LCPI0_4<>+0x40(SB)/8, $0x44434241403f3e3d
+DATA LCPI0_4<>+0x48(SB)/8, $0x4c4b4a4948474645
+DATA LCPI0_4<>+0x50(SB)/8, $0x54535251504f4e4d
+DATA LCPI0_4<>+0x58(SB)/8, $0x5c5b5a5958575655
+DATA LCPI0_4<>+0x60(SB)/8, $0x64636261605f5e5d
+DATA LCPI0_4<>+0x68(SB)/8, $0x6c6b6a6968676665
+DATA LCPI0_4<>+0x70(SB)/8, $0x74737271706f6e6d
+DATA LCPI0_4<>+0x78(SB)/8, $0x7c7b7a7978777675
+DATA LCPI0_4<>+0x80(SB)/8, $0xffffffffffffffff
+DATA LCPI0_4<>+0x88(SB)/8, $0xffffffffffffffff
+DATA LCPI0_4<>+0x90(SB)/8, $0xffffffffffffffff
+DATA LCPI0_4<>+0x98(SB)/8, $0xffffffffffffffff
+DATA LCPI0_4<>+0xa0(SB)/8, $0xffffffffffffffff
+DATA LCPI0_4<>+0xa8(SB)/8, $0xffffffffffffffff
+DATA LCPI0_4<>+0xb0(SB)/8, $0xffffffffffffffff
+DATA LCPI0_4<>+0xb8(SB)/8, $0xbfdfefffffffffff
+GLOBL LCPI0_4<>(SB), (RODATA|NOPTR), $192
+
+DATA LCPI0_5<>+0x00(SB)/8, $0x44434241403f3e3d
+DATA LCPI0_5<>+0x08(SB)/8, $0x4c4b4a4948474645
+DATA LCPI0_5<>+0x10(SB)/8, $0x54535251504f4e4d
+DATA LCPI0_5<>+0x18(SB)/8, $0x5c5b5a5958575655
+DATA LCPI0_5<>+0x20(SB)/8, $0x64636261605f5e5d
+DATA LCPI0_5<>+0x28(SB)/8, $0x6c6b6a6968676665
+DATA LCPI0_5<>+0x30(SB)/8, $0x74737271706f6e6d
+DATA LCPI0_5<>+0x38(SB)/8, $0x7c7b7a7978777675
+DATA LCPI0_5<>+0x40(SB)/8, $0xffffffffffffffff
+DATA LCPI0_5<>+0x48(SB)/8, $0xffffffffffffffff
+DATA LCPI0_5<>+0x50(SB)/8, $0xffffffffffffffff
+DATA LCPI0_5<>+0x58(SB)/8, $0xffffffffffffffff
+DATA LCPI0_5<>+0x60(SB)/8, $0xffffffffffffffff
+DATA LCPI0_5<>+0x68(SB)/8, $0xffffffffffffffff
+DATA LCPI0_5<>+0x70(SB)/8, $0xffffffffffffffff
+DATA LCPI0_5<>+0x78(SB)/8, $0xbfdfefffffffffff
+GLOBL LCPI0_5<>(SB), (RODATA|NOPTR), $128
+
+DATA LCPI0_6<>+0x00(SB)/8, $0xffffffffffffffff
+DATA LCPI0_6<>+0x08(SB)/8, $0xffffffffffffffff
+DATA LCPI0_6<>+0x10(SB)/8, $0xffffffffffffffff
+DATA LCPI0_6<>+0x18(SB)/8, $0xffffffffffffffff
+DATA LCPI0_6<>+0x20(SB)/8, $0xffffffffffffffff
+DATA LCPI0_6<>+0x28(SB)/8, $0xffffffffffffffff
+DATA LCPI0_6<>+0x30(SB)/8, $0xffffffffffffffff
+DATA LCPI0_6<>+0x38(SB)/8, $0xbfdfefffffffffff
+GLOBL LCPI0_6<>(SB), (RODATA|NOPTR), $64
+
+TEXT ·utf8_valid_avx512(SB), NOSPLIT, $0-17
+	MOVQ            src+0(FP), DI
+	MOVQ            src_len+8(FP), SI
+	VBROADCASTI32X4 LCPI0_0<>(SB), Z11        // <--                                  // vbroadcasti32x4	zmm11, xmmword ptr [rip + 0]
+	MOVQ            DI, AX                    // <--                                  // mov	rax, rdi
+	MOVQ            SI, CX                    // <--                                  // mov	rcx, rsi
+	VBROADCASTI32X4 LCPI0_1<>(SB), Z12        // <--                                  // vbroadcasti32x4	zmm12, xmmword ptr [rip + 0]
+	VBROADCASTI32X4 LCPI0_2<>(SB), Z13        // <--                                  // vbroadcasti32x4	zmm13, xmmword ptr [rip + 0]
+	TESTQ           SI, SI                    // <--                                  // test	rsi, rsi
+	JLE             LBB0_7                    // <--                                  // jle	.LBB0_7
+	MOVL            $0xf0f0f0f, DX            // <--                                  // mov	edx, 252645135
+	VPXOR           X6, X6, X6                // <--                                  // vpxor	xmm6, xmm6, xmm6
+	VMOVDQU64       LCPI0_3<>(SB), Z17        // <--                                  // vmovdqa64	zmm17, zmmword ptr [rip + 0]
+	VMOVDQU64       LCPI0_4<>(SB), Z16        // <--                                  // vmovdqa64	zmm16, zmmword ptr [rip + 0]
+	VPBROADCASTD    DX, Z8                    // <--                                  // vpbroadcastd	zmm8, edx
+	MOVL            $0x60, DX                 // <--                                  // mov	edx, 96
+	VMOVDQU64       LCPI0_5<>(SB), Z15        // <--                                  // vmovdqa64	zmm15, zmmword ptr [rip + 0]
+	VMOVDQU64       LCPI0_6<>(SB), Z14        // <--                                  // vmovdqa64	zmm14, zmmword ptr [rip + 0]
+	VPBROADCASTB    DX, Z10                   // <--                                  // vpbroadcastb	zmm10, edx
+	MOVL            $0x70, DX                 // <--                                  // mov	edx, 112
+	LONG            $0x48fdf162; WORD $0xd66f // VMOVDQA64 Z6, Z2                     // vmovdqa64	zmm2, zmm6
+	LONG            $0x48fdf162; WORD $0xc66f // VMOVDQA64 Z6, Z0                     // vmovdqa64	zmm0, zmm6
+	VPBROADCASTB    DX, Z9                    // <--                                  // vpbroadcastb	zmm9, edx
+	JMP             LBB0_2                    // <--                                  // jmp	.LBB0_2
+
+LBB0_0:
+	VPORD Z2, Z6, Z0                // <--                                  // vpord	zmm0, zmm6, zmm2
+	VPXOR X2, X2, X2                // <--                                  // vpxor	xmm2, xmm2, xmm2
+	LONG  $0x48fdf162; WORD $0xf06f // VMOVDQA64 Z0, Z6                     // vmovdqa64	zmm6, zmm0
+
+LBB0_1:
+	SUBQ  $0x40, CX                 // <--                                  // sub	rcx, 64
+	ADDQ  $0x40, AX                 // <--                                  // add	rax, 64
+	TESTQ CX, CX                    // <--                                  // test	rcx, rcx
+	JLE   LBB0_5                    // <--                                  // jle	.LBB0_5
+	LONG  $0x48fdf162; WORD $0xc46f // VMOVDQA64 Z4, Z0                     // vmovdqa64	zmm0, zmm4
+
+LBB0_2:
+	CMPQ      CX, $0x3f                 // <--                                  // cmp	rcx, 63
+	JBE       LBB0_4                    // <--                                  // jbe	.LBB0_4
+	VMOVDQU64 0(AX), Z4                 // <--                                  // vmovdqu64	zmm4, zmmword ptr [rax]
+	LONG      $0x48fdf162; WORD $0xcc6f // VMOVDQA64 Z4, Z1                     // vmovdqa64	zmm1, zmm4
+
+LBB0_3:
+	VPMOVB2M     Z1, K0                    // <--                                  // vpmovb2m	k0, zmm1
+	KORTESTQ     K0, K0                    // <--                                  // kortestq	k0, k0
+	JE           LBB0_0                    // <--                                  // je	.LBB0_0
+	LONG         $0x48fdf162; WORD $0xd86f // VMOVDQA64 Z0, Z3                     // vmovdqa64	zmm3, zmm0
+	LONG         $0x48fdf162; WORD $0xf86f // VMOVDQA64 Z0, Z7                     // vmovdqa64	zmm7, zmm0
+	MOVL         $-0x7f7f7f80, DX          // <--                                  // mov	edx, -2139062144
+	VPERMT2B     Z1, Z17, Z3               // <--                                  // vpermt2b	zmm3, zmm17, zmm1
+	VPSRLW       $0x4, Z4, Z5              // <--                                  // vpsrlw	zmm5, zmm4, 4
+	VPERMT2B     Z1, Z16, Z7               // <--                                  // vpermt2b	zmm7, zmm16, zmm1
+	VPSRLW       $0x4, Z3, Z2              // <--                                  // vpsrlw	zmm2, zmm3, 4
+	VPANDD       Z8, Z5, Z5                // <--                                  // vpandd	zmm5, zmm5, zmm8
+	VPANDD       Z8, Z3, Z3                // <--                                  // vpandd	zmm3, zmm3, zmm8
+	VPANDD       Z8, Z2, Z2                // <--                                  // vpandd	zmm2, zmm2, zmm8
+	VPSHUFB      Z3, Z12, Z3               // <--                                  // vpshufb	zmm3, zmm12, zmm3
+	VPSHUFB      Z5, Z13, Z5               // <--                                  // vpshufb	zmm5, zmm13, zmm5
+	VPERMT2B     Z1, Z15, Z0               // <--                                  // vpermt2b	zmm0, zmm15, zmm1
+	VPSHUFB      Z2, Z11, Z2               // <--                                  // vpshufb	zmm2, zmm11, zmm2
+	VPTERNLOGQ   $0x80, Z5, Z3, Z2         // <--                                  // vpternlogq	zmm2, zmm3, zmm5, 128
+	VPSUBUSB     Z9, Z0, Z0                // <--                                  // vpsubusb	zmm0, zmm0, zmm9
+	VPSUBUSB     Z10, Z7, Z5               // <--                                  // vpsubusb	zmm5, zmm7, zmm10
+	VPBROADCASTD DX, Z3                    // <--                                  // vpbroadcastd	zmm3, edx
+	VPTERNLOGD   $0xe0, Z5, Z0, Z3         // <--                                  // vpternlogd	zmm3, zmm0, zmm5, 224
+	LONG         $0x487df162; WORD $0xc66f // VMOVDQA32 Z6, Z0                     // vmovdqa32	zmm0, zmm6
+	VPTERNLOGD   $0xf6, Z3, Z2, Z0         // <--                                  // vpternlogd	zmm0, zmm2, zmm3, 246
+	VPSUBUSB     Z14, Z1, Z2               // <--                                  // vpsubusb	zmm2, zmm1, zmm14
+	VPTESTMB     Z0, Z0, K0                // <--                                  // vptestmb	k0, zmm0, zmm0
+	LONG         $0x48fdf162; WORD $0xf06f // VMOVDQA64 Z0, Z6                     // vmovdqa64	zmm6, zmm0
+	KORTESTQ     K0, K0                    // <--                                  // kortestq	k0, k0
+	JE           LBB0_1                    // <--                                  // je	.LBB0_1
+	XORL         AX, AX                    // <--                                  // xor	eax, eax
+	VZEROUPPER                             // <--                                  // vzeroupper
+	MOVB         AX, ret+16(FP)            // <--
+	RET                                    // <--                                  // ret
+
+LBB0_4:
+	MOVL       $0x1, DX                  // <--                                  // mov	edx, 1
+	SHLQ       CX, DX                    // <--                                  // shl	rdx, cl
+	SUBQ       $0x1, DX                  // <--                                  // sub	rdx, 1
+	KMOVQ      DX, K1                    // <--                                  // kmovq	k1, rdx
+	VMOVDQU8.Z 0(AX), K1, Z1             // <--                                  // vmovdqu8	zmm1{k1}{z}, zmmword ptr [rax]
+	LONG       $0x48fdf162; WORD $0xe16f // VMOVDQA64 Z1, Z4                     // vmovdqa64	zmm4, zmm1
+	JMP        LBB0_3                    // <--                                  // jmp	.LBB0_3
+
+LBB0_5:
+	VPORD Z2, Z0, Z0 // <--                                  // vpord	zmm0, zmm0, zmm2
+
+LBB0_6:
+	VPTESTMB   Z0, Z0, K0     // <--                                  // vptestmb	k0, zmm0, zmm0
+	KORTESTQ   K0, K0         // <--                                  // kortestq	k0, k0
+	SETEQ      AX             // <--                                  // sete	al
+	VZEROUPPER                // <--                                  // vzeroupper
+	MOVB       AX, ret+16(FP) // <--
+	RET                       // <--                                  // ret
+
+LBB0_7:
+	LONG $0xc0eff9c5 // VPXOR X0, X0, X0                     // vpxor	xmm0, xmm0, xmm0
+	JMP  LBB0_6      // <--                                  // jmp	.LBB0_6
@@ -0,0 +1,8 @@
+//go:build !noasm && amd64
+// Code generated by gccasm -- DO NOT EDIT.
+
+package utf8
+
+
+//go:noescape
+func utf8_valid_range_sse(src string) bool
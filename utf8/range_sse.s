@@ -0,0 +1,396 @@
+//go:build !noasm && amd64
+// Code generated by gccasm -- DO NOT EDIT.
+//
+// Source file         : range_sse.c
+// Compiler version    : gcc (Debian 12.2.0-14+deb12u1) 12.2.0
+// Target architecture : amd64
+// Compiler options    : -msse4.1
+
+#include "textflag.h"
+
+DATA LCPI0_0<>+0x00(SB)/8, $0x0000000000000200
+DATA LCPI0_0<>+0x08(SB)/8, $0x0003000000000000
+GLOBL LCPI0_0<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_1<>+0x00(SB)/8, $0x0000040000000300
+DATA LCPI0_1<>+0x08(SB)/8, $0x0000000000000000
+GLOBL LCPI0_1<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_2<>+0x00(SB)/8, $0x7f7f7f7f7f7f7f7f
+DATA LCPI0_2<>+0x08(SB)/8, $0x0001027f7f7f7f7f
+GLOBL LCPI0_2<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_3<>+0x00(SB)/8, $0x0000000000000000
+DATA LCPI0_3<>+0x08(SB)/8, $0x0302010100000000
+GLOBL LCPI0_3<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_4<>+0x00(SB)/8, $0x0000000000000000
+DATA LCPI0_4<>+0x08(SB)/8, $0x0808080800000000
+GLOBL LCPI0_4<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_5<>+0x00(SB)/8, $0x0f0f0f0f0f0f0f0f
+DATA LCPI0_5<>+0x08(SB)/8, $0x0f0f0f0f0f0f0f0f
+GLOBL LCPI0_5<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_6<>+0x00(SB)/8, $0x1111111111111111
+DATA LCPI0_6<>+0x08(SB)/8, $0x1111111111111111
+GLOBL LCPI0_6<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_7<>+0x00(SB)/8, $0x0101010101010101
+DATA LCPI0_7<>+0x08(SB)/8, $0x0101010101010101
+GLOBL LCPI0_7<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_8<>+0x00(SB)/8, $0xf0f0f0f0f0f0f0f0
+DATA LCPI0_8<>+0x08(SB)/8, $0xf0f0f0f0f0f0f0f0
+GLOBL LCPI0_8<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_9<>+0x00(SB)/8, $0x7070707070707070
+DATA LCPI0_9<>+0x08(SB)/8, $0x7070707070707070
+GLOBL LCPI0_9<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_10<>+0x00(SB)/8, $0x0202020202020202
+DATA LCPI0_10<>+0x08(SB)/8, $0x0202020202020202
+GLOBL LCPI0_10<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_11<>+0x00(SB)/8, $0x809080a080808000
+DATA LCPI0_11<>+0x08(SB)/8, $0x7f7f7f7f7f7f7fc2
+GLOBL LCPI0_11<>(SB), (RODATA|NOPTR), $16
+
+DATA LCPI0_12<>+0x00(SB)/8, $0x8fbf9fbfbfbfbf7f
+DATA LCPI0_12<>+0x08(SB)/8, $0x80808080808080f4
+GLOBL LCPI0_12<>(SB), (RODATA|NOPTR), $16
+
+TEXT ·utf8_valid_range_sse(SB), NOSPLIT, $112-17
+	MOVQ  src+0(FP), DI
+	MOVQ  src_len+8(FP), SI
+	PUSHQ BP                 // <--                                  // push	rbp
+	MOVQ  DI, DX             // <--                                  // mov	rdx, rdi
+	MOVQ  SP, BP             // <--                                  // mov	rbp, rsp
+	ANDQ  $-0x10, SP         // <--                                  // and	rsp, -16
+	SUBQ  $0x20, SP          // <--                                  // sub	rsp, 32
+	CMPQ  SI, $0xf           // <--                                  // cmp	rsi, 15
+	JLE   LBB0_8             // <--                                  // jle	.LBB0_8
+	CMPQ  SI, $0x1f          // <--                                  // cmp	rsi, 31
+	JLE   LBB0_18            // <--                                  // jle	.LBB0_18
+	MOVO  LCPI0_0<>(SB), X14 // <--                                  // movdqa	xmm14, xmmword ptr [rip + 0]
+	PXOR  X7, X7             // <--                                  // pxor	xmm7, xmm7
+	MOVO  LCPI0_1<>(SB), X13 // <--                                  // movdqa	xmm13, xmmword ptr [rip + 0]
+	MOVO  X7, X3             // <--                                  // movdqa	xmm3, xmm7
+	MOVO  X7, X2             // <--                                  // movdqa	xmm2, xmm7
+	MOVO  X7, X11            // <--                                  // movdqa	xmm11, xmm7
+	JMP   LBB0_3             // <--                                  // jmp	.LBB0_3
+
+LBB0_0:
+	PCMPGTB LCPI0_2<>(SB), X2 // <--                                  // pcmpgtb	xmm2, xmmword ptr [rip + 0]
+	POR     X2, X3            // <--                                  // por	xmm3, xmm2
+	PXOR    X2, X2            // <--                                  // pxor	xmm2, xmm2
+	MOVO    X3, X5            // <--                                  // movdqa	xmm5, xmm3
+
+LBB0_1:
+	SUBQ  $0x20, SI // <--                                  // sub	rsi, 32
+	ADDQ  $0x20, DX // <--                                  // add	rdx, 32
+	TESTB $0xe0, SI // <--                                  // test	sil, -32
+	JNE   LBB0_2    // <--                                  // jne	.LBB0_2
+	MOVO  X3, X1    // <--                                  // movdqa	xmm1, xmm3
+	POR   X7, X1    // <--                                  // por	xmm1, xmm7
+	PTEST X1, X1    // <--                                  // ptest	xmm1, xmm1
+	JNE   LBB0_4    // <--                                  // jne	.LBB0_4
+	CMPQ  SI, $0x1f // <--                                  // cmp	rsi, 31
+	JLE   LBB0_6    // <--                                  // jle	.LBB0_6
+
+LBB0_2:
+	MOVO X0, X11 // <--                                  // movdqa	xmm11, xmm0
+
+LBB0_3:
+	MOVOU    0x10(DX), X0        // <--                                  // movdqu	xmm0, xmmword ptr [rdx + 16]
+	MOVOU    0(DX), X1           // <--                                  // movdqu	xmm1, xmmword ptr [rdx]
+	MOVO     X0, X4              // <--                                  // movdqa	xmm4, xmm0
+	POR      X1, X4              // <--                                  // por	xmm4, xmm1
+	PMOVMSKB X4, AX              // <--                                  // pmovmskb	eax, xmm4
+	MOVO     X7, X4              // <--                                  // movdqa	xmm4, xmm7
+	TESTL    AX, AX              // <--                                  // test	eax, eax
+	JE       LBB0_0              // <--                                  // je	.LBB0_0
+	MOVO     X1, X4              // <--                                  // movdqa	xmm4, xmm1
+	MOVO     LCPI0_3<>(SB), X6   // <--                                  // movdqa	xmm6, xmmword ptr [rip + 0]
+	MOVO     LCPI0_4<>(SB), X9   // <--                                  // movdqa	xmm9, xmmword ptr [rip + 0]
+	MOVO     LCPI0_4<>(SB), X15  // <--                                  // movdqa	xmm15, xmmword ptr [rip + 0]
+	PSRLW    $0x4, X4            // <--                                  // psrlw	xmm4, 4
+	PAND     LCPI0_5<>(SB), X4   // <--                                  // pand	xmm4, xmmword ptr [rip + 0]
+	PSHUFB   X4, X6              // <--                                  // pshufb	xmm6, xmm4
+	PSHUFB   X4, X9              // <--                                  // pshufb	xmm9, xmm4
+	MOVO     X1, X4              // <--                                  // movdqa	xmm4, xmm1
+	PALIGNR  $0xf, X11, X4       // <--                                  // palignr	xmm4, xmm11, 15
+	MOVO     X6, X5              // <--                                  // movdqa	xmm5, xmm6
+	MOVO     X6, X8              // <--                                  // movdqa	xmm8, xmm6
+	PADDB    LCPI0_6<>(SB), X4   // <--                                  // paddb	xmm4, xmmword ptr [rip + 0]
+	MOVO     X6, X10             // <--                                  // movdqa	xmm10, xmm6
+	PALIGNR  $0xf, X2, X5        // <--                                  // palignr	xmm5, xmm2, 15
+	PALIGNR  $0xe, X2, X8        // <--                                  // palignr	xmm8, xmm2, 14
+	PSUBUSB  LCPI0_7<>(SB), X8   // <--                                  // psubusb	xmm8, xmmword ptr [rip + 0]
+	MOVO     X4, X11             // <--                                  // movdqa	xmm11, xmm4
+	PALIGNR  $0xd, X2, X10       // <--                                  // palignr	xmm10, xmm2, 13
+	PSUBUSB  LCPI0_8<>(SB), X11  // <--                                  // psubusb	xmm11, xmmword ptr [rip + 0]
+	PADDUSB  LCPI0_9<>(SB), X4   // <--                                  // paddusb	xmm4, xmmword ptr [rip + 0]
+	MOVO     X14, X2             // <--                                  // movdqa	xmm2, xmm14
+	PSUBUSB  LCPI0_10<>(SB), X10 // <--                                  // psubusb	xmm10, xmmword ptr [rip + 0]
+	PSHUFB   X11, X2             // <--                                  // pshufb	xmm2, xmm11
+	MOVO     X13, X11            // <--                                  // movdqa	xmm11, xmm13
+	PSHUFB   X4, X11             // <--                                  // pshufb	xmm11, xmm4
+	MOVO     X5, X4              // <--                                  // movdqa	xmm4, xmm5
+	POR      X10, X8             // <--                                  // por	xmm8, xmm10
+	MOVO     LCPI0_11<>(SB), X5  // <--                                  // movdqa	xmm5, xmmword ptr [rip + 0]
+	POR      X9, X4              // <--                                  // por	xmm4, xmm9
+	PADDB    X11, X2             // <--                                  // paddb	xmm2, xmm11
+	MOVO     LCPI0_12<>(SB), X9  // <--                                  // movdqa	xmm9, xmmword ptr [rip + 0]
+	POR      X8, X4              // <--                                  // por	xmm4, xmm8
+	MOVO     X5, X12             // <--                                  // movdqa	xmm12, xmm5
+	MOVO     X0, X8              // <--                                  // movdqa	xmm8, xmm0
+	PADDB    X4, X2              // <--                                  // paddb	xmm2, xmm4
+	PSRLW    $0x4, X8            // <--                                  // psrlw	xmm8, 4
+	MOVO     X9, X4              // <--                                  // movdqa	xmm4, xmm9
+	PAND     LCPI0_5<>(SB), X8   // <--                                  // pand	xmm8, xmmword ptr [rip + 0]
+	PSHUFB   X2, X4              // <--                                  // pshufb	xmm4, xmm2
+	PSHUFB   X2, X12             // <--                                  // pshufb	xmm12, xmm2
+	MOVO     LCPI0_3<>(SB), X2   // <--                                  // movdqa	xmm2, xmmword ptr [rip + 0]
+	MOVAPS   X4, 0x10(SP)        // <--                                  // movaps	xmmword ptr [rsp + 16], xmm4
+	PCMPGTB  X1, X12             // <--                                  // pcmpgtb	xmm12, xmm1
+	PSHUFB   X8, X2              // <--                                  // pshufb	xmm2, xmm8
+	PSHUFB   X8, X15             // <--                                  // pshufb	xmm15, xmm8
+	MOVO     X0, X8              // <--                                  // movdqa	xmm8, xmm0
+	PALIGNR  $0xf, X1, X8        // <--                                  // palignr	xmm8, xmm1, 15
+	MOVAPS   X15, 0(SP)          // <--                                  // movaps	xmmword ptr [rsp], xmm15
+	MOVO     X2, X4              // <--                                  // movdqa	xmm4, xmm2
+	PADDB    LCPI0_6<>(SB), X8   // <--                                  // paddb	xmm8, xmmword ptr [rip + 0]
+	MOVO     X2, X10             // <--                                  // movdqa	xmm10, xmm2
+	MOVO     X2, X11             // <--                                  // movdqa	xmm11, xmm2
+	MOVO     X8, X15             // <--                                  // movdqa	xmm15, xmm8
+	PALIGNR  $0xf, X6, X10       // <--                                  // palignr	xmm10, xmm6, 15
+	PSUBUSB  LCPI0_8<>(SB), X15  // <--                                  // psubusb	xmm15, xmmword ptr [rip + 0]
+	PALIGNR  $0xe, X6, X11       // <--                                  // palignr	xmm11, xmm6, 14
+	PALIGNR  $0xd, X6, X4        // <--                                  // palignr	xmm4, xmm6, 13
+	PSUBUSB  LCPI0_7<>(SB), X11  // <--                                  // psubusb	xmm11, xmmword ptr [rip + 0]
+	PSUBUSB  LCPI0_10<>(SB), X4  // <--                                  // psubusb	xmm4, xmmword ptr [rip + 0]
+	MOVO     X14, X6             // <--                                  // movdqa	xmm6, xmm14
+	PADDUSB  LCPI0_9<>(SB), X8   // <--                                  // paddusb	xmm8, xmmword ptr [rip + 0]
+	PSHUFB   X15, X6             // <--                                  // pshufb	xmm6, xmm15
+	POR      0(SP), X10          // <--                                  // por	xmm10, xmmword ptr [rsp]
+	MOVO     X13, X15            // <--                                  // movdqa	xmm15, xmm13
+	PSHUFB   X8, X15             // <--                                  // pshufb	xmm15, xmm8
+	POR      X11, X4             // <--                                  // por	xmm4, xmm11
+	POR      X10, X4             // <--                                  // por	xmm4, xmm10
+	PCMPGTB  0x10(SP), X1        // <--                                  // pcmpgtb	xmm1, xmmword ptr [rsp + 16]
+	PADDB    X15, X6             // <--                                  // paddb	xmm6, xmm15
+	PADDB    X4, X6              // <--                                  // paddb	xmm6, xmm4
+	MOVO     X0, X4              // <--                                  // movdqa	xmm4, xmm0
+	PSHUFB   X6, X5              // <--                                  // pshufb	xmm5, xmm6
+	PSHUFB   X6, X9              // <--                                  // pshufb	xmm9, xmm6
+	PCMPGTB  X9, X4              // <--                                  // pcmpgtb	xmm4, xmm9
+	PCMPGTB  X0, X5              // <--                                  // pcmpgtb	xmm5, xmm0
+	POR      X4, X1              // <--                                  // por	xmm1, xmm4
+	POR      X12, X5             // <--                                  // por	xmm5, xmm12
+	POR      X5, X3              // <--                                  // por	xmm3, xmm5
+	POR      X1, X7              // <--                                  // por	xmm7, xmm1
+	MOVO     X3, X5              // <--                                  // movdqa	xmm5, xmm3
+	MOVO     X7, X4              // <--                                  // movdqa	xmm4, xmm7
+	JMP      LBB0_1              // <--                                  // jmp	.LBB0_1
+
+LBB0_4:
+	XORL AX, AX // <--                                  // xor	eax, eax
+
+LBB0_5:
+	MOVQ BP, SP         // <--                                  // leave
+	POPQ BP             // <--
+	MOVB AX, ret+16(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB0_6:
+	CMPQ SI, $0xf // <--                                  // cmp	rsi, 15
+	JG   LBB0_19  // <--                                  // jg	.LBB0_19
+
+LBB0_7:
+	POR     X4, X5       // <--                                  // por	xmm5, xmm4
+	XORL    AX, AX       // <--                                  // xor	eax, eax
+	PTEST   X5, X5       // <--                                  // ptest	xmm5, xmm5
+	JNE     LBB0_5       // <--                                  // jne	.LBB0_5
+	PEXTRD  $0x3, X0, AX // <--                                  // pextrd	eax, xmm0, 3
+	MOVL    AX, CX       // <--                                  // mov	ecx, eax
+	SARL    $0x18, CX    // <--                                  // sar	ecx, 24
+	CMPB    CX, $0xc0    // <--                                  // cmp	cl, -64
+	JGE     LBB0_17      // <--                                  // jge	.LBB0_17
+	MOVL    AX, CX       // <--                                  // mov	ecx, eax
+	SHLL    $0x8, CX     // <--                                  // shl	ecx, 8
+	SARL    $0x18, CX    // <--                                  // sar	ecx, 24
+	CMPB    CX, $0xc0    // <--                                  // cmp	cl, -64
+	JGE     LBB0_20      // <--                                  // jge	.LBB0_20
+	MOVBLSX AH, AX       // <--                                  // movsx	eax, ah
+	WORD    $0xc03c      // CMPB AX, $0xc0                       // cmp	al, -64
+	JGE     LBB0_21      // <--                                  // jge	.LBB0_21
+
+LBB0_8:
+	MOVL  SI, CX  // <--                                  // mov	ecx, esi
+	TESTL SI, SI  // <--                                  // test	esi, esi
+	JNE   LBB0_10 // <--                                  // jne	.LBB0_10
+	JMP   LBB0_14 // <--                                  // jmp	.LBB0_14
+
+LBB0_9:
+	ADDQ DI, DX  // <--                                  // add	rdx, rdi
+	SUBL AX, CX  // <--                                  // sub	ecx, eax
+	JE   LBB0_14 // <--                                  // je	.LBB0_14
+
+LBB0_10:
+	MOVBLZX 0(DX), SI      // <--                                  // movzx	esi, byte ptr [rdx]
+	MOVL    $0x1, DI       // <--                                  // mov	edi, 1
+	MOVL    $0x1, AX       // <--                                  // mov	eax, 1
+	TESTB   SI, SI         // <--                                  // test	sil, sil
+	JNS     LBB0_9         // <--                                  // jns	.LBB0_9
+	LEAL    0x3e(SI), AX   // <--                                  // lea	eax, [rsi + 62]
+	WORD    $0x1d3c        // CMPB AX, $0x1d                       // cmp	al, 29
+	SETLS   AX             // <--                                  // setbe	al
+	CMPL    CX, $0x1       // <--                                  // cmp	ecx, 1
+	SETGT   DI             // <--                                  // setg	dil
+	ANDB    DI, AX         // <--                                  // and	al, dil
+	JNE     LBB0_15        // <--                                  // jne	.LBB0_15
+	CMPL    CX, $0x2       // <--                                  // cmp	ecx, 2
+	JLE     LBB0_5         // <--                                  // jle	.LBB0_5
+	MOVBLZX 0x1(DX), R8    // <--                                  // movzx	r8d, byte ptr [rdx + 1]
+	CMPB    0x2(DX), $0xc0 // <--                                  // cmp	byte ptr [rdx + 2], -64
+	SETLT   AX             // <--                                  // setl	al
+	CMPB    R8, $0xc0      // <--                                  // cmp	r8b, -64
+	SETLT   DI             // <--                                  // setl	dil
+	ANDB    DI, AX         // <--                                  // and	al, dil
+	JE      LBB0_5         // <--                                  // je	.LBB0_5
+	CMPB    SI, $0xe0      // <--                                  // cmp	sil, -32
+	JNE     LBB0_11        // <--                                  // jne	.LBB0_11
+	MOVL    $0x3, DI       // <--                                  // mov	edi, 3
+	MOVL    $0x3, AX       // <--                                  // mov	eax, 3
+	CMPB    R8, $0x9f      // <--                                  // cmp	r8b, -97
+	JA      LBB0_9         // <--                                  // ja	.LBB0_9
+
+LBB0_11:
+	LEAL  0x1f(SI), AX   // <--                                  // lea	eax, [rsi + 31]
+	WORD  $0xb3c         // CMPB AX, $0xb                        // cmp	al, 11
+	JBE   LBB0_16        // <--                                  // jbe	.LBB0_16
+	CMPB  SI, $0xed      // <--                                  // cmp	sil, -19
+	SETEQ AX             // <--                                  // sete	al
+	CMPB  R8, $0x9f      // <--                                  // cmp	r8b, -97
+	SETLS DI             // <--                                  // setbe	dil
+	ANDB  DI, AX         // <--                                  // and	al, dil
+	JNE   LBB0_16        // <--                                  // jne	.LBB0_16
+	LEAL  0x12(SI), DI   // <--                                  // lea	edi, [rsi + 18]
+	CMPB  DI, $0x1       // <--                                  // cmp	dil, 1
+	JBE   LBB0_16        // <--                                  // jbe	.LBB0_16
+	CMPL  CX, $0x3       // <--                                  // cmp	ecx, 3
+	JE    LBB0_5         // <--                                  // je	.LBB0_5
+	CMPB  0x3(DX), $0xc0 // <--                                  // cmp	byte ptr [rdx + 3], -64
+	JGE   LBB0_5         // <--                                  // jge	.LBB0_5
+	CMPB  SI, $0xf0      // <--                                  // cmp	sil, -16
+	JNE   LBB0_12        // <--                                  // jne	.LBB0_12
+	MOVL  $0x4, DI       // <--                                  // mov	edi, 4
+	MOVL  $0x4, AX       // <--                                  // mov	eax, 4
+	CMPB  R8, $0x8f      // <--                                  // cmp	r8b, -113
+	JA    LBB0_9         // <--                                  // ja	.LBB0_9
+
+LBB0_12:
+	LEAL  0xf(SI), AX // <--                                  // lea	eax, [rsi + 15]
+	WORD  $0x23c      // CMPB AX, $0x2                        // cmp	al, 2
+	JBE   LBB0_13     // <--                                  // jbe	.LBB0_13
+	CMPB  SI, $0xf4   // <--                                  // cmp	sil, -12
+	SETEQ AX          // <--                                  // sete	al
+	CMPB  R8, $0x8f   // <--                                  // cmp	r8b, -113
+	SETLS SI          // <--                                  // setbe	sil
+	ANDB  SI, AX      // <--                                  // and	al, sil
+	JE    LBB0_5      // <--                                  // je	.LBB0_5
+
+LBB0_13:
+	MOVL $0x4, DI // <--                                  // mov	edi, 4
+	MOVL $0x4, AX // <--                                  // mov	eax, 4
+	ADDQ DI, DX   // <--                                  // add	rdx, rdi
+	SUBL AX, CX   // <--                                  // sub	ecx, eax
+	JNE  LBB0_10  // <--                                  // jne	.LBB0_10
+
+LBB0_14:
+	BYTE $0xc9          // LEAVE                                // leave
+	MOVL $0x1, AX       // <--                                  // mov	eax, 1
+	MOVB AX, ret+16(FP) // <--
+	RET                 // <--                                  // ret
+
+LBB0_15:
+	CMPB 0x1(DX), $0xc0 // <--                                  // cmp	byte ptr [rdx + 1], -64
+	JGE  LBB0_4         // <--                                  // jge	.LBB0_4
+	MOVL $0x2, DI       // <--                                  // mov	edi, 2
+	MOVL $0x2, AX       // <--                                  // mov	eax, 2
+	JMP  LBB0_9         // <--                                  // jmp	.LBB0_9
+
+LBB0_16:
+	MOVL $0x3, DI // <--                                  // mov	edi, 3
+	MOVL $0x3, AX // <--                                  // mov	eax, 3
+	JMP  LBB0_9   // <--                                  // jmp	.LBB0_9
+
+LBB0_17:
+	SUBQ $0x1, DX    // <--                                  // sub	rdx, 1
+	LEAL 0x1(SI), CX // <--                                  // lea	ecx, [rsi + 1]
+	JMP  LBB0_10     // <--                                  // jmp	.LBB0_10
+
+LBB0_18:
+	PXOR X4, X4 // <--                                  // pxor	xmm4, xmm4
+	MOVO X4, X5 // <--                                  // movdqa	xmm5, xmm4
+	MOVO X4, X0 // <--                                  // movdqa	xmm0, xmm4
+	MOVO X4, X2 // <--                                  // movdqa	xmm2, xmm4
+
+LBB0_19:
+	MOVOU   0(DX), X3          // <--                                  // movdqu	xmm3, xmmword ptr [rdx]
+	MOVO    LCPI0_3<>(SB), X1  // <--                                  // movdqa	xmm1, xmmword ptr [rip + 0]
+	ADDQ    $0x10, DX          // <--                                  // add	rdx, 16
+	SUBQ    $0x10, SI          // <--                                  // sub	rsi, 16
+	MOVO    LCPI0_4<>(SB), X8  // <--                                  // movdqa	xmm8, xmmword ptr [rip + 0]
+	MOVO    X3, X6             // <--                                  // movdqa	xmm6, xmm3
+	PSRLW   $0x4, X6           // <--                                  // psrlw	xmm6, 4
+	PAND    LCPI0_5<>(SB), X6  // <--                                  // pand	xmm6, xmmword ptr [rip + 0]
+	PSHUFB  X6, X1             // <--                                  // pshufb	xmm1, xmm6
+	PSHUFB  X6, X8             // <--                                  // pshufb	xmm8, xmm6
+	MOVO    X1, X7             // <--                                  // movdqa	xmm7, xmm1
+	MOVO    X1, X6             // <--                                  // movdqa	xmm6, xmm1
+	PALIGNR $0xf, X2, X6       // <--                                  // palignr	xmm6, xmm2, 15
+	PALIGNR $0xe, X2, X7       // <--                                  // palignr	xmm7, xmm2, 14
+	PSUBUSB LCPI0_7<>(SB), X7  // <--                                  // psubusb	xmm7, xmmword ptr [rip + 0]
+	PALIGNR $0xd, X2, X1       // <--                                  // palignr	xmm1, xmm2, 13
+	MOVO    X3, X2             // <--                                  // movdqa	xmm2, xmm3
+	PSUBUSB LCPI0_10<>(SB), X1 // <--                                  // psubusb	xmm1, xmmword ptr [rip + 0]
+	PALIGNR $0xf, X0, X2       // <--                                  // palignr	xmm2, xmm0, 15
+	PADDB   LCPI0_6<>(SB), X2  // <--                                  // paddb	xmm2, xmmword ptr [rip + 0]
+	MOVO    LCPI0_0<>(SB), X0  // <--                                  // movdqa	xmm0, xmmword ptr [rip + 0]
+	POR     X1, X7             // <--                                  // por	xmm7, xmm1
+	MOVO    X2, X9             // <--                                  // movdqa	xmm9, xmm2
+	PADDUSB LCPI0_9<>(SB), X2  // <--                                  // paddusb	xmm2, xmmword ptr [rip + 0]
+	PSUBUSB LCPI0_8<>(SB), X9  // <--                                  // psubusb	xmm9, xmmword ptr [rip + 0]
+	PSHUFB  X9, X0             // <--                                  // pshufb	xmm0, xmm9
+	MOVO    LCPI0_1<>(SB), X9  // <--                                  // movdqa	xmm9, xmmword ptr [rip + 0]
+	PSHUFB  X2, X9             // <--                                  // pshufb	xmm9, xmm2
+	MOVO    X6, X2             // <--                                  // movdqa	xmm2, xmm6
+	POR     X8, X2             // <--                                  // por	xmm2, xmm8
+	PADDB   X9, X0             // <--                                  // paddb	xmm0, xmm9
+	MOVO    X2, X1             // <--                                  // movdqa	xmm1, xmm2
+	MOVO    LCPI0_12<>(SB), X2 // <--                                  // movdqa	xmm2, xmmword ptr [rip + 0]
+	POR     X7, X1             // <--                                  // por	xmm1, xmm7
+	PADDB   X1, X0             // <--                                  // paddb	xmm0, xmm1
+	MOVO    LCPI0_11<>(SB), X1 // <--                                  // movdqa	xmm1, xmmword ptr [rip + 0]
+	PSHUFB  X0, X2             // <--                                  // pshufb	xmm2, xmm0
+	PSHUFB  X0, X1             // <--                                  // pshufb	xmm1, xmm0
+	MOVO    X1, X0             // <--                                  // movdqa	xmm0, xmm1
+	PCMPGTB X3, X0             // <--                                  // pcmpgtb	xmm0, xmm3
+	POR     X0, X5             // <--                                  // por	xmm5, xmm0
+	MOVO    X3, X0             // <--                                  // movdqa	xmm0, xmm3
+	PCMPGTB X2, X0             // <--                                  // pcmpgtb	xmm0, xmm2
+	POR     X0, X4             // <--                                  // por	xmm4, xmm0
+	MOVO    X3, X0             // <--                                  // movdqa	xmm0, xmm3
+	JMP     LBB0_7             // <--                                  // jmp	.LBB0_7
+
+LBB0_20:
+	SUBQ $0x2, DX    // <--                                  // sub	rdx, 2
+	LEAL 0x2(SI), CX // <--                                  // lea	ecx, [rsi + 2]
+	JMP  LBB0_10     // <--                                  // jmp	.LBB0_10
+
+LBB0_21:
+	SUBQ $0x3, DX           // <--                                  // sub	rdx, 3
+	WORD $0x4e8d; BYTE $0x3 // LEAL 0x3(SI), CX                     // lea	ecx, [rsi + 3]
+	JMP  LBB0_10            // <--                                  // jmp	.LBB0_10
@@ -1,3 +1,5 @@
+//go:build !noasm && amd64
+
 package utf8
 
 import (
@@ -7,10 +9,33 @@ import (
 	"golang.org/x/sys/cpu"
 )
 
-var hasAVX2 = cpu.X86.HasAVX
+// The AVX-512 kernels are built with -mavx512f -mavx512vl and use the EVEX
+// 128- and 256-bit forms, so they need VL along with BW and VBMI.
+var (
+	hasSSE41  = cpu.X86.HasSSE41
+	hasAVX2   = cpu.X86.HasAVX2
+	hasAVX512 = cpu.X86.HasAVX512F && cpu.X86.HasAVX512VL && cpu.X86.HasAVX512BW && cpu.X86.HasAVX512VBMI
+)
+
+// validRange validates input that starts at its first non-ASCII byte. It
+// follows the kernel tier selected by the ascii package, so VELOZ_ISA
+// lowers both packages together.
+var validRange = selectValidRange(ascii.ISA())
+
+func selectValidRange(isa string) func(string) bool {
+	switch isa {
+	case "avx512":
+		return utf8_valid_avx512
+	case "avx2":
+		return utf8_valid_range_avx2
+	case "sse41":
+		return utf8_valid_range_sse
+	}
+	return nil
+}
 
 func ValidString(s string) bool {
-	if !hasAVX2 {
+	if validRange == nil {
 		return stdlib.ValidString(s)
 	}
 
@@ -20,5 +45,6 @@ func ValidString(s string) bool {
 		return true
 	}
 
-	return utf8_valid_range_avx2(s)
+	// everything before idx is ASCII, so validation can start at idx
+	return validRange(s[idx:])
 }
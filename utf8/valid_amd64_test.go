@@ -0,0 +1,66 @@
+//go:build !noasm && amd64
+
+package utf8
+
+import (
+	"math/rand"
+	"strings"
+	"testing"
+	stdlib "unicode/utf8"
+)
+
+func TestValidAvx512(t *testing.T) {
+	if !hasAVX512 {
+		t.Skip("AVX-512BW/VBMI not supported")
+	}
+	testValidKernel(t, "utf8_valid_avx512", utf8_valid_avx512)
+}
+
+func TestValidAvx2(t *testing.T) {
+	if !hasAVX2 {
+		t.Skip("AVX2 not supported")
+	}
+	testValidKernel(t, "utf8_valid_range_avx2", utf8_valid_range_avx2)
+}
+
+func TestValidSse(t *testing.T) {
+	if !hasSSE41 {
+		t.Skip("SSE4.1 not supported")
+	}
+	testValidKernel(t, "utf8_valid_range_sse", utf8_valid_range_sse)
+}
+
+func testValidKernel(t *testing.T, name string, valid func(string) bool) {
+	// Sequences placed across the block boundaries and in the tail,
+	// including ones left open before an ASCII-only block
+	pieces := []string{"☺", "日", "\xF4\x8F\xBF\xBF", "\xE2", "\xE2\x98", "\xF0\x9F", "\xC3", "\x80",
+		"\xC0\x80", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xE0\x80\x80", "\xF0\x80\x80\x80"}
+	for _, p := range pieces {
+		for n := 0; n < 200; n++ {
+			for _, s := range []string{
+				strings.Repeat("a", n) + p,
+				strings.Repeat("a", n) + p + strings.Repeat("a", 64),
+				"☺" + strings.Repeat("a", n) + p + strings.Repeat("a", 130),
+			} {
+				if got, want := valid(s), stdlib.ValidString(s); got != want {
+					t.Fatalf("%s(%q) = %v, want %v", name, s, got, want)
+				}
+			}
+		}
+	}
+
+	rng := rand.New(rand.NewSource(1))
+	for i := 0; i < 100000; i++ {
+		var b []byte
+		for n := rng.Intn(300); len(b) < n; {
+			if rng.Intn(10) < 8 {
+				b = append(b, 'a')
+			} else {
+				b = append(b, pieces[rng.Intn(len(pieces))]...)
+			}
+		}
+		if got, want := valid(string(b)), stdlib.Valid(b); got != want {
+			t.Fatalf("%s(%q) = %v, want %v", name, b, got, want)
+		}
+	}
+}
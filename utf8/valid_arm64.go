@@ -1,8 +1,18 @@
+//go:build !noasm && arm64
+
 package utf8
 
-import "github.com/mhr3/veloz/ascii"
+import (
+	stdlib "unicode/utf8"
+
+	"github.com/mhr3/veloz/ascii"
+)
 
 func ValidString(s string) bool {
+	if ascii.ISA() != "neon" {
+		return stdlib.ValidString(s)
+	}
+
 	// speed up the common case
 	idx := ascii.IndexMask(s, 0x80)
 	if idx == -1 {
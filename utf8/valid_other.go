@@ -0,0 +1,9 @@
+//go:build noasm || (!amd64 && !arm64)
+
+package utf8
+
+import stdlib "unicode/utf8"
+
+func ValidString(s string) bool {
+	return stdlib.ValidString(s)
+}
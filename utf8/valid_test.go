@@ -87,6 +87,11 @@ func TestValid(t *testing.T) {
 		// invalid at boundary
 		strings.Repeat("a", 32+31) + "\xE2a",
 		strings.Repeat("a", 14) + "☺" + strings.Repeat("a", 13) + "\xE2",
+		// sequence left open before an ASCII-only 64-byte block
+		"☺" + strings.Repeat("a", 61) + "\xE2" + strings.Repeat("a", 64),
+		"☺" + strings.Repeat("a", 62) + "\xF0\x9F" + strings.Repeat("a", 64),
+		"☺" + strings.Repeat("a", 61) + "\xE2\x98" + strings.Repeat("a", 64) + "\xBA",
+		"☺" + strings.Repeat("a", 125) + "☺" + strings.Repeat("a", 64),
 
 		// same inputs as benchmarks
 		"0123456789",
@@ -159,6 +164,7 @@ func TestValid(t *testing.T) {
 var ascii100000 = strings.Repeat("0123456789", 10000)
 var longStringMostlyASCII string // ~100KB, ~97% ASCII
 var longStringJapanese string    // ~100KB, non-ASCII
+var longStringLateUTF8 string    // ~100KB, ASCII with a non-ASCII tail
 
 func init() {
 	const japanese = "日本語日本語日本語日"
@@ -172,6 +178,7 @@ func init() {
 	}
 	longStringMostlyASCII = b.String()
 	longStringJapanese = strings.Repeat(japanese, 100_000/len(japanese))
+	longStringLateUTF8 = ascii100000[:90_000] + "日本語" + ascii100000[:10_000]
 }
 
 func BenchmarkValidStringTenASCIIChars(b *testing.B) {
@@ -232,6 +239,22 @@ func BenchmarkValidStringLongMostlyASCII(b *testing.B) {
 	})
 }
 
+func BenchmarkValidStringLongLateUTF8(b *testing.B) {
+	b.Run("std", func(b *testing.B) {
+		b.SetBytes(int64(len(longStringLateUTF8)))
+		for i := 0; i < b.N; i++ {
+			stdlib.ValidString(longStringLateUTF8)
+		}
+	})
+
+	b.Run("simd", func(b *testing.B) {
+		b.SetBytes(int64(len(longStringLateUTF8)))
+		for i := 0; i < b.N; i++ {
+			ValidString(longStringLateUTF8)
+		}
+	})
+}
+
 func BenchmarkValidStringLongJapanese(b *testing.B) {
 	b.Run("std", func(b *testing.B) {
 		b.SetBytes(int64(len(longStringJapanese)))